@@ -59,6 +59,48 @@ std::deque<std::unique_ptr<AssetResolver>> AssetManager::TakeResolvers() {
   return std::move(resolvers_);
 }
 
+void AssetManager::PrefetchAll(std::vector<std::string> asset_names,
+                               fml::BasicTaskRunner* worker_runner) {
+  if (asset_names.empty()) {
+    return;
+  }
+  auto shared_this = weak_from_this().lock();
+  if (worker_runner == nullptr || !shared_this) {
+    // Without a worker, or without shared ownership to keep this manager
+    // alive on one, warm the cache in place.
+    ResolveAndCache(asset_names);
+    return;
+  }
+  worker_runner->PostTask([shared_this = std::move(shared_this),
+                           asset_names = std::move(asset_names)]() {
+    shared_this->ResolveAndCache(asset_names);
+  });
+}
+
+void AssetManager::ResolveAndCache(
+    const std::vector<std::string>& asset_names) const {
+  TRACE_EVENT0("flutter", "AssetManager::PrefetchAll");
+  auto mappings = GetAsMappings(asset_names);
+  std::scoped_lock lock(prefetched_mappings_mutex_);
+  for (size_t i = 0; i < mappings.size(); i++) {
+    if (mappings[i] != nullptr) {
+      prefetched_mappings_[asset_names[i]] = std::move(mappings[i]);
+    }
+  }
+}
+
+std::unique_ptr<fml::Mapping> AssetManager::TakePrefetchedMapping(
+    const std::string& asset_name) const {
+  std::scoped_lock lock(prefetched_mappings_mutex_);
+  auto found = prefetched_mappings_.find(asset_name);
+  if (found == prefetched_mappings_.end()) {
+    return nullptr;
+  }
+  auto mapping = std::move(found->second);
+  prefetched_mappings_.erase(found);
+  return mapping;
+}
+
 // |AssetResolver|
 std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
     const std::string& asset_name) const {
@@ -67,6 +109,9 @@ std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
   }
   TRACE_EVENT1("flutter", "AssetManager::GetAsMapping", "name",
                asset_name.c_str());
+  if (auto prefetched = TakePrefetchedMapping(asset_name)) {
+    return prefetched;
+  }
   for (const auto& resolver : resolvers_) {
     auto mapping = resolver->GetAsMapping(asset_name);
     if (mapping != nullptr) {
@@ -77,6 +122,45 @@ std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
   return nullptr;
 }
 
+// |AssetResolver|
+std::vector<std::unique_ptr<fml::Mapping>> AssetManager::GetAsMappings(
+    const std::vector<std::string>& asset_names) const {
+  std::vector<std::unique_ptr<fml::Mapping>> mappings(asset_names.size());
+  if (asset_names.empty()) {
+    return mappings;
+  }
+  TRACE_EVENT0("flutter", "AssetManager::GetAsMappings");
+  for (const auto& resolver : resolvers_) {
+    // Only hand each resolver the names that are still unresolved so the
+    // whole remainder goes down as one batch.
+    std::vector<std::string> unresolved_names;
+    std::vector<size_t> unresolved_indices;
+    for (size_t i = 0; i < asset_names.size(); i++) {
+      if (mappings[i] == nullptr && !asset_names[i].empty()) {
+        unresolved_names.push_back(asset_names[i]);
+        unresolved_indices.push_back(i);
+      }
+    }
+    if (unresolved_names.empty()) {
+      break;
+    }
+    auto resolved = resolver->GetAsMappings(unresolved_names);
+    for (size_t i = 0; i < resolved.size(); i++) {
+      if (resolved[i] != nullptr) {
+        mappings[unresolved_indices[i]] = std::move(resolved[i]);
+      }
+    }
+  }
+#ifndef NDEBUG
+  for (size_t i = 0; i < asset_names.size(); i++) {
+    if (mappings[i] == nullptr) {
+      FML_DLOG(WARNING) << "Could not find asset: " << asset_names[i];
+    }
+  }
+#endif
+  return mappings;
+}
+
 // |AssetResolver|
 std::vector<std::unique_ptr<fml::Mapping>> AssetManager::GetAsMappings(
     const std::string& asset_pattern,
@@ -6,17 +6,21 @@
 #define FLUTTER_ASSETS_ASSET_MANAGER_H_
 
 #include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <optional>
 #include "flutter/assets/asset_resolver.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
 
 namespace flutter {
 
-class AssetManager final : public AssetResolver {
+class AssetManager final : public AssetResolver,
+                           public std::enable_shared_from_this<AssetManager> {
  public:
   AssetManager();
 
@@ -70,6 +74,25 @@ class AssetManager final : public AssetResolver {
 
   std::deque<std::unique_ptr<AssetResolver>> TakeResolvers();
 
+  //--------------------------------------------------------------------------
+  /// @brief      Resolves `asset_names` ahead of use and caches the resulting
+  ///             mappings. When `worker_runner` is non-null the resolution is
+  ///             posted there (typically the concurrent worker pool) so that
+  ///             first-frame lookups do not pay for cold opens on the UI or
+  ///             IO thread; otherwise the mappings are warmed synchronously.
+  ///
+  ///             A later `GetAsMapping` for a prefetched name hands out the
+  ///             cached mapping instead of touching the file system. Each
+  ///             cached mapping is handed out exactly once.
+  ///
+  /// @param[in]  asset_names    The assets to warm.
+  ///
+  /// @param[in]  worker_runner  The runner to resolve the assets on, or null
+  ///                            to resolve on the calling thread.
+  ///
+  void PrefetchAll(std::vector<std::string> asset_names,
+                   fml::BasicTaskRunner* worker_runner);
+
   // |AssetResolver|
   bool IsValid() const override;
 
@@ -83,6 +106,10 @@ class AssetManager final : public AssetResolver {
   std::unique_ptr<fml::Mapping> GetAsMapping(
       const std::string& asset_name) const override;
 
+  // |AssetResolver|
+  std::vector<std::unique_ptr<fml::Mapping>> GetAsMappings(
+      const std::vector<std::string>& asset_names) const override;
+
   // |AssetResolver|
   std::vector<std::unique_ptr<fml::Mapping>> GetAsMappings(
       const std::string& asset_pattern,
@@ -91,6 +118,22 @@ class AssetManager final : public AssetResolver {
  private:
   std::deque<std::unique_ptr<AssetResolver>> resolvers_;
 
+  // Resolves `asset_names` through the resolver queue and stores the non-null
+  // mappings in |prefetched_mappings_|.
+  void ResolveAndCache(const std::vector<std::string>& asset_names) const;
+
+  // Removes and returns the prefetched mapping for `asset_name` if one is
+  // cached.
+  std::unique_ptr<fml::Mapping> TakePrefetchedMapping(
+      const std::string& asset_name) const;
+
+  // Mappings warmed by |PrefetchAll| that have not been handed out yet.
+  // Guarded by |prefetched_mappings_mutex_| since prefetching may run on a
+  // worker while lookups come from the UI or IO thread.
+  mutable std::mutex prefetched_mappings_mutex_;
+  mutable std::map<std::string, std::unique_ptr<fml::Mapping>>
+      prefetched_mappings_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(AssetManager);
 };
 
@@ -60,6 +60,28 @@ class AssetResolver {
   [[nodiscard]] virtual std::unique_ptr<fml::Mapping> GetAsMapping(
       const std::string& asset_name) const = 0;
 
+  //--------------------------------------------------------------------------
+  /// @brief      Batch variant of GetAsMapping(): resolves every name in
+  ///             `asset_names` in one call. The result has one entry per name
+  ///             in input order, null for names that could not be resolved.
+  ///             Resolvers that can batch the underlying I/O (e.g. the
+  ///             directory asset bundle) override this; the default resolves
+  ///             the names one at a time.
+  ///
+  /// @param[in]  asset_names  The names of the assets to resolve.
+  ///
+  /// @return     Returns a vector with one mapping (or null) per asset name.
+  ///
+  [[nodiscard]] virtual std::vector<std::unique_ptr<fml::Mapping>>
+  GetAsMappings(const std::vector<std::string>& asset_names) const {
+    std::vector<std::unique_ptr<fml::Mapping>> mappings;
+    mappings.reserve(asset_names.size());
+    for (const auto& asset_name : asset_names) {
+      mappings.push_back(GetAsMapping(asset_name));
+    }
+    return mappings;
+  }
+
   //--------------------------------------------------------------------------
   /// @brief      Same as GetAsMapping() but returns mappings for all files
   ///             who's name matches a given pattern. Returns empty vector
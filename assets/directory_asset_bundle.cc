@@ -14,6 +14,28 @@
 
 namespace flutter {
 
+namespace {
+
+void IndexDirectory(const fml::UniqueFD& directory,
+                    const std::string& prefix,
+                    std::set<std::string>& index) {
+  fml::VisitFiles(
+      directory, [&](const fml::UniqueFD& dir, const std::string& filename) {
+        if (fml::IsDirectory(dir, filename.c_str())) {
+          fml::UniqueFD sub_dir =
+              fml::OpenDirectoryReadOnly(dir, filename.c_str());
+          if (sub_dir.is_valid()) {
+            IndexDirectory(sub_dir, prefix + filename + "/", index);
+          }
+        } else {
+          index.insert(prefix + filename);
+        }
+        return true;
+      });
+}
+
+}  // namespace
+
 DirectoryAssetBundle::DirectoryAssetBundle(
     fml::UniqueFD descriptor,
     bool is_valid_after_asset_manager_change)
@@ -42,6 +64,18 @@ AssetResolver::AssetResolverType DirectoryAssetBundle::GetType() const {
   return AssetResolver::AssetResolverType::kDirectoryAssetBundle;
 }
 
+bool DirectoryAssetBundle::IsInDirectoryIndex(
+    const std::string& asset_name) const {
+  std::scoped_lock lock(index_mutex_);
+  if (!directory_index_.has_value()) {
+    TRACE_EVENT0("flutter", "DirectoryAssetBundle::BuildDirectoryIndex");
+    std::set<std::string> index;
+    IndexDirectory(descriptor_, "", index);
+    directory_index_ = std::move(index);
+  }
+  return directory_index_->count(asset_name) > 0;
+}
+
 // |AssetResolver|
 std::unique_ptr<fml::Mapping> DirectoryAssetBundle::GetAsMapping(
     const std::string& asset_name) const {
@@ -50,6 +84,10 @@ std::unique_ptr<fml::Mapping> DirectoryAssetBundle::GetAsMapping(
     return nullptr;
   }
 
+  if (!IsInDirectoryIndex(asset_name)) {
+    return nullptr;
+  }
+
   auto mapping = std::make_unique<fml::FileMapping>(fml::OpenFile(
       descriptor_, asset_name.c_str(), false, fml::FilePermission::kRead));
 
@@ -60,6 +98,38 @@ std::unique_ptr<fml::Mapping> DirectoryAssetBundle::GetAsMapping(
   return mapping;
 }
 
+// |AssetResolver|
+std::vector<std::unique_ptr<fml::Mapping>> DirectoryAssetBundle::GetAsMappings(
+    const std::vector<std::string>& asset_names) const {
+  std::vector<std::unique_ptr<fml::Mapping>> mappings(asset_names.size());
+  if (!is_valid_) {
+    FML_DLOG(WARNING) << "Asset bundle was not valid.";
+    return mappings;
+  }
+  TRACE_EVENT0("flutter", "DirectoryAssetBundle::GetAsMappings");
+  // Only open names the directory index knows about, as one batch of opens
+  // for the whole request instead of an open per asset.
+  std::vector<std::string> present_names;
+  std::vector<size_t> present_indices;
+  for (size_t i = 0; i < asset_names.size(); i++) {
+    if (IsInDirectoryIndex(asset_names[i])) {
+      present_names.push_back(asset_names[i]);
+      present_indices.push_back(i);
+    }
+  }
+  auto descriptors = fml::OpenFilesReadOnly(descriptor_, present_names);
+  for (size_t i = 0; i < descriptors.size(); i++) {
+    if (!descriptors[i].is_valid()) {
+      continue;
+    }
+    auto mapping = std::make_unique<fml::FileMapping>(descriptors[i]);
+    if (mapping->IsValid()) {
+      mappings[present_indices[i]] = std::move(mapping);
+    }
+  }
+  return mappings;
+}
+
 std::vector<std::unique_ptr<fml::Mapping>> DirectoryAssetBundle::GetAsMappings(
     const std::string& asset_pattern,
     const std::optional<std::string>& subdir) const {
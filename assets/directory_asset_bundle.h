@@ -5,7 +5,9 @@
 #ifndef FLUTTER_ASSETS_DIRECTORY_ASSET_BUNDLE_H_
 #define FLUTTER_ASSETS_DIRECTORY_ASSET_BUNDLE_H_
 
+#include <mutex>
 #include <optional>
+#include <set>
 #include "flutter/assets/asset_resolver.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
@@ -25,6 +27,18 @@ class DirectoryAssetBundle : public AssetResolver {
   bool is_valid_ = false;
   bool is_valid_after_asset_manager_change_ = false;
 
+  // Relative paths of every regular file under |descriptor_|, built with one
+  // directory walk on first lookup. The bundle's contents are fixed for its
+  // lifetime (updated asset directories arrive as new resolvers), so the
+  // index can reject lookups for missing assets without touching the file
+  // system.
+  mutable std::mutex index_mutex_;
+  mutable std::optional<std::set<std::string>> directory_index_;
+
+  // Returns whether `asset_name` names a file in the bundle, building the
+  // index on first use.
+  bool IsInDirectoryIndex(const std::string& asset_name) const;
+
   // |AssetResolver|
   bool IsValid() const override;
 
@@ -38,6 +52,10 @@ class DirectoryAssetBundle : public AssetResolver {
   std::unique_ptr<fml::Mapping> GetAsMapping(
       const std::string& asset_name) const override;
 
+  // |AssetResolver|
+  std::vector<std::unique_ptr<fml::Mapping>> GetAsMappings(
+      const std::vector<std::string>& asset_names) const override;
+
   // |AssetResolver|
   std::vector<std::unique_ptr<fml::Mapping>> GetAsMappings(
       const std::string& asset_pattern,
@@ -0,0 +1,85 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace benchmarking {
+namespace {
+
+std::atomic<uint64_t> g_allocation_count{0};
+std::atomic<uint64_t> g_allocation_bytes{0};
+
+void* CountedAllocate(size_t size) {
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  g_allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+  return std::malloc(size);
+}
+
+}  // namespace
+
+uint64_t AllocationCounter::allocation_count() {
+  return g_allocation_count.load(std::memory_order_relaxed);
+}
+
+uint64_t AllocationCounter::allocation_bytes() {
+  return g_allocation_bytes.load(std::memory_order_relaxed);
+}
+
+}  // namespace benchmarking
+
+// Counting replacements for the global allocator entry points. These are
+// deliberately defined outside any namespace so that they replace the
+// implicitly declared global overloads for the whole binary.
+
+void* operator new(size_t size) {
+  void* ptr = benchmarking::CountedAllocate(size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void* operator new[](size_t size) {
+  void* ptr = benchmarking::CountedAllocate(size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return benchmarking::CountedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return benchmarking::CountedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
@@ -0,0 +1,39 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_BENCHMARKING_ALLOCATION_COUNTER_H_
+#define FLUTTER_BENCHMARKING_ALLOCATION_COUNTER_H_
+
+#include <cstdint>
+
+namespace benchmarking {
+
+// Process-wide counters for heap allocations.
+//
+// Linking the ":allocation_counting" source set into a benchmark binary
+// replaces the global operator new/delete entry points with counting
+// wrappers. The counters are monotonic; benchmarks sample them before and
+// after the measured section and report the deltas. Do not link this
+// source set into production binaries.
+//
+// Allocations that bypass operator new (such as direct malloc calls made
+// by Skia's sk_malloc) are not observed; callers that care about those
+// bytes should measure them at the source (for DisplayList storage,
+// DisplayList::bytes() reports the exact storage footprint).
+class AllocationCounter {
+ public:
+  // The total number of operator new allocations made by the process so
+  // far.
+  static uint64_t allocation_count();
+
+  // The total number of bytes requested from operator new by the process
+  // so far.
+  static uint64_t allocation_bytes();
+
+  AllocationCounter() = delete;
+};
+
+}  // namespace benchmarking
+
+#endif  // FLUTTER_BENCHMARKING_ALLOCATION_COUNTER_H_
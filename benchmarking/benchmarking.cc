@@ -4,6 +4,9 @@
 
 #include "benchmarking.h"
 
+#include <string_view>
+
+#include "flutter/benchmarking/perf_counters.h"
 #include "flutter/fml/backtrace.h"
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/command_line.h"
@@ -19,6 +22,18 @@ int Main(int argc, char** argv) {
       cmd.GetOptionValueWithDefault("icu-data-file-path", "icudtl.dat");
   fml::icu::InitializeICU(icudtl_path);
 #endif
+  // Strip our own flag before handing the command line to Google Benchmark,
+  // which rejects flags it does not recognize.
+  for (int i = 1; i < argc; i++) {
+    if (std::string_view{argv[i]} == "--perf-counters") {
+      PerfCounterContext::SetEnabled(true);
+      for (int j = i; j < argc - 1; j++) {
+        argv[j] = argv[j + 1];
+      }
+      argc--;
+      break;
+    }
+  }
   benchmark::Initialize(&argc, argv);
   ::benchmark::RunSpecifiedBenchmarks();
   return 0;
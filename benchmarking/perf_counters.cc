@@ -0,0 +1,130 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/perf_counters.h"
+
+#include "flutter/fml/build_config.h"
+
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif  // defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+
+namespace benchmarking {
+
+bool PerfCounterContext::enabled_ = false;
+
+bool PerfCounterContext::Enabled() {
+  return enabled_;
+}
+
+void PerfCounterContext::SetEnabled(bool enabled) {
+  enabled_ = enabled;
+}
+
+bool PerfCounterContext::IsValid() const {
+  for (size_t i = 0; i < kCounterCount; i++) {
+    if (fds_[i] < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint64_t PerfCounterContext::GetDelta(Counter counter) const {
+  return deltas_[counter];
+}
+
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+
+namespace {
+
+constexpr uint64_t kCounterConfigs[PerfCounterContext::kCounterCount] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+int OpenCounter(uint64_t config) {
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = 1;
+  // Count threads spawned by the benchmark too; suites such as the task
+  // queue benchmarks fan work out to worker threads.
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr,
+                                  /*pid=*/0, /*cpu=*/-1,
+                                  /*group_fd=*/-1, /*flags=*/0));
+}
+
+}  // namespace
+
+PerfCounterContext::PerfCounterContext() {
+  for (size_t i = 0; i < kCounterCount; i++) {
+    fds_[i] = OpenCounter(kCounterConfigs[i]);
+  }
+  if (!IsValid()) {
+    // All or nothing; partially opened counters would silently report
+    // misleading zeros for the missing events.
+    for (size_t i = 0; i < kCounterCount; i++) {
+      if (fds_[i] >= 0) {
+        close(fds_[i]);
+      }
+      fds_[i] = -1;
+    }
+  }
+}
+
+PerfCounterContext::~PerfCounterContext() {
+  for (size_t i = 0; i < kCounterCount; i++) {
+    if (fds_[i] >= 0) {
+      close(fds_[i]);
+    }
+  }
+}
+
+void PerfCounterContext::Start() {
+  for (size_t i = 0; i < kCounterCount; i++) {
+    ioctl(fds_[i], PERF_EVENT_IOC_RESET, 0);
+    ioctl(fds_[i], PERF_EVENT_IOC_ENABLE, 0);
+  }
+}
+
+void PerfCounterContext::Stop() {
+  for (size_t i = 0; i < kCounterCount; i++) {
+    ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t value = 0;
+    if (read(fds_[i], &value, sizeof(value)) == sizeof(value)) {
+      deltas_[i] += value;
+    }
+  }
+}
+
+#else  // defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+
+PerfCounterContext::PerfCounterContext() {
+  for (size_t i = 0; i < kCounterCount; i++) {
+    fds_[i] = -1;
+  }
+}
+
+PerfCounterContext::~PerfCounterContext() = default;
+
+void PerfCounterContext::Start() {}
+
+void PerfCounterContext::Stop() {}
+
+#endif  // defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+
+}  // namespace benchmarking
@@ -0,0 +1,118 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_BENCHMARKING_PERF_COUNTERS_H_
+#define FLUTTER_BENCHMARKING_PERF_COUNTERS_H_
+
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+
+namespace benchmarking {
+
+// Hardware performance counters sampled around a benchmark's measured
+// section.
+//
+// On Linux and Android the counters are read through perf_event_open and
+// cover CPU cycles, retired instructions, cache misses and branch misses
+// for the benchmark thread and any threads it spawns. On other platforms
+// (macOS only exposes equivalent data through the private kperf framework)
+// the context reports itself as invalid and ScopedPerfCounters is a no-op.
+//
+// Counting is off by default; pass --perf-counters to a benchmark binary to
+// enable it. Opening the events can also fail at runtime, for example when
+// /proc/sys/kernel/perf_event_paranoid disallows it or the binary runs
+// under an emulator without a PMU; counting degrades to a no-op in that
+// case as well.
+class PerfCounterContext {
+ public:
+  enum Counter : size_t {
+    kCpuCycles = 0,
+    kInstructions,
+    kCacheMisses,
+    kBranchMisses,
+  };
+  static constexpr size_t kCounterCount = 4;
+
+  PerfCounterContext();
+  ~PerfCounterContext();
+
+  // Whether all counters could be opened.
+  bool IsValid() const;
+
+  // Resets and enables the counters.
+  void Start();
+
+  // Disables the counters and accumulates their deltas since Start.
+  void Stop();
+
+  // The accumulated value of the given counter across all Start/Stop pairs.
+  uint64_t GetDelta(Counter counter) const;
+
+  // Whether counter collection was requested via --perf-counters.
+  static bool Enabled();
+  static void SetEnabled(bool enabled);
+
+ private:
+  int fds_[kCounterCount];
+  uint64_t deltas_[kCounterCount] = {};
+
+  static bool enabled_;
+};
+
+// Samples the hardware counters for the duration of the enclosing scope and
+// reports per-iteration deltas through the benchmark's user counters. Place
+// one on the stack ahead of the measurement loop:
+//
+//   static void BM_Example(benchmark::State& state) {
+//     benchmarking::ScopedPerfCounters perf(state);
+//     while (state.KeepRunning()) { ... }
+//   }
+//
+// Does nothing unless the binary was run with --perf-counters and the
+// counters could be opened.
+class ScopedPerfCounters {
+ public:
+  explicit ScopedPerfCounters(::benchmark::State& state) : state_(state) {
+    if (PerfCounterContext::Enabled() && context_.IsValid()) {
+      running_ = true;
+      context_.Start();
+    }
+  }
+
+  ~ScopedPerfCounters() { StopAndReport(); }
+
+  // Stops counting and publishes the per-iteration deltas. Called by the
+  // destructor; benchmarks that do unmeasured work after their loop (such
+  // as writing a snapshot image) can call it explicitly right after the
+  // loop to keep that work out of the counts.
+  void StopAndReport() {
+    if (!running_) {
+      return;
+    }
+    running_ = false;
+    context_.Stop();
+    state_.counters["CpuCycles"] = ::benchmark::Counter(
+        context_.GetDelta(PerfCounterContext::kCpuCycles),
+        ::benchmark::Counter::kAvgIterations);
+    state_.counters["Instructions"] = ::benchmark::Counter(
+        context_.GetDelta(PerfCounterContext::kInstructions),
+        ::benchmark::Counter::kAvgIterations);
+    state_.counters["CacheMisses"] = ::benchmark::Counter(
+        context_.GetDelta(PerfCounterContext::kCacheMisses),
+        ::benchmark::Counter::kAvgIterations);
+    state_.counters["BranchMisses"] = ::benchmark::Counter(
+        context_.GetDelta(PerfCounterContext::kBranchMisses),
+        ::benchmark::Counter::kAvgIterations);
+  }
+
+ private:
+  ::benchmark::State& state_;
+  PerfCounterContext context_;
+  bool running_ = false;
+};
+
+}  // namespace benchmarking
+
+#endif  // FLUTTER_BENCHMARKING_PERF_COUNTERS_H_
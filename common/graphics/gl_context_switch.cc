@@ -4,12 +4,43 @@
 
 #include "flutter/common/graphics/gl_context_switch.h"
 
+#include "flutter/fml/thread_local.h"
+
 namespace flutter {
 
+namespace {
+
+// Per-thread record of which context is current and whether a batch is
+// deferring context restores. The key is only trusted while the switch or
+// batch that recorded it is alive, so foreign code changing the context
+// between unrelated scopes cannot be mistaken for the tracked context.
+struct ThreadContextState {
+  intptr_t current_key = SwitchableGLContext::kUnknownContextKey;
+  int batch_depth = 0;
+  // The context whose removal was deferred by an active batch. Retained so
+  // |RemoveCurrent| can be issued when the outermost batch ends.
+  std::unique_ptr<SwitchableGLContext> deferred_context;
+};
+
+FML_THREAD_LOCAL fml::ThreadLocalUniquePtr<ThreadContextState> tls_state;
+
+ThreadContextState* GetThreadContextState() {
+  if (tls_state.get() == nullptr) {
+    tls_state.reset(new ThreadContextState());
+  }
+  return tls_state.get();
+}
+
+}  // namespace
+
 SwitchableGLContext::SwitchableGLContext() = default;
 
 SwitchableGLContext::~SwitchableGLContext() = default;
 
+intptr_t SwitchableGLContext::GetContextKey() const {
+  return kUnknownContextKey;
+}
+
 GLContextResult::GLContextResult() = default;
 
 GLContextResult::~GLContextResult() = default;
@@ -28,11 +59,53 @@ GLContextDefaultResult::~GLContextDefaultResult() = default;
 GLContextSwitch::GLContextSwitch(std::unique_ptr<SwitchableGLContext> context)
     : context_(std::move(context)) {
   FML_CHECK(context_ != nullptr);
+  ThreadContextState* state = GetThreadContextState();
+  intptr_t key = context_->GetContextKey();
+  if (key != SwitchableGLContext::kUnknownContextKey &&
+      key == state->current_key) {
+    already_current_ = true;
+    result_ = true;
+    return;
+  }
+  if (state->deferred_context) {
+    // A batch kept a different context current; restore it before switching.
+    state->deferred_context->RemoveCurrent();
+    state->deferred_context.reset();
+    state->current_key = SwitchableGLContext::kUnknownContextKey;
+  }
   result_ = context_->SetCurrent();
+  state->current_key = result_ ? key : SwitchableGLContext::kUnknownContextKey;
 };
 
 GLContextSwitch::~GLContextSwitch() {
+  if (already_current_) {
+    // The context was current before this scope and remains so.
+    return;
+  }
+  ThreadContextState* state = GetThreadContextState();
+  if (state->batch_depth > 0 && result_ &&
+      context_->GetContextKey() != SwitchableGLContext::kUnknownContextKey) {
+    // Keep the context current for the rest of the batch; the batch issues
+    // the removal when it ends.
+    state->deferred_context = std::move(context_);
+    return;
+  }
   context_->RemoveCurrent();
+  state->current_key = SwitchableGLContext::kUnknownContextKey;
 };
 
+GLContextSwitchBatch::GLContextSwitchBatch() {
+  GetThreadContextState()->batch_depth++;
+}
+
+GLContextSwitchBatch::~GLContextSwitchBatch() {
+  ThreadContextState* state = GetThreadContextState();
+  FML_DCHECK(state->batch_depth > 0);
+  if (--state->batch_depth == 0 && state->deferred_context) {
+    state->deferred_context->RemoveCurrent();
+    state->deferred_context.reset();
+    state->current_key = SwitchableGLContext::kUnknownContextKey;
+  }
+}
+
 }  // namespace flutter
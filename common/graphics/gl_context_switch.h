@@ -5,6 +5,7 @@
 #ifndef FLUTTER_COMMON_GRAPHICS_GL_CONTEXT_SWITCH_H_
 #define FLUTTER_COMMON_GRAPHICS_GL_CONTEXT_SWITCH_H_
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -34,6 +35,19 @@ class SwitchableGLContext {
   // object from current context;
   virtual bool RemoveCurrent() = 0;
 
+  // Returned by |GetContextKey| when the wrapped context has no stable
+  // identity. Switches to such a context are never skipped.
+  static constexpr intptr_t kUnknownContextKey = -1;
+
+  // Implement this to return a value that uniquely identifies the context
+  // wrapped by this object. Wrappers created around the same underlying
+  // context must return the same key. When the requested key matches the
+  // context recorded as current by an enclosing |GLContextSwitch| or
+  // |GLContextSwitchBatch| on this thread, making it current again is
+  // skipped. The default returns |kUnknownContextKey|, which disables the
+  // optimization for implementations that do not override this.
+  virtual intptr_t GetContextKey() const;
+
   FML_DISALLOW_COPY_AND_ASSIGN(SwitchableGLContext);
 };
 
@@ -91,6 +105,12 @@ class GLContextDefaultResult : public GLContextResult {
 ///
 /// In destruction, it should restore the current context to what was
 /// before the construction of this switch.
+///
+/// If the context is already current on this thread — because an enclosing
+/// switch or a |GLContextSwitchBatch| made a context with the same
+/// |SwitchableGLContext::GetContextKey| current — both the switch and the
+/// restore are skipped, avoiding the driver round trip of a redundant
+/// MakeCurrent.
 class GLContextSwitch final : public GLContextResult {
  public:
   //----------------------------------------------------------------------------
@@ -105,10 +125,33 @@ class GLContextSwitch final : public GLContextResult {
 
  private:
   std::unique_ptr<SwitchableGLContext> context_;
+  // True when the context was already current on construction; the scope
+  // then neither sets nor removes the current context.
+  bool already_current_ = false;
 
   FML_DISALLOW_COPY_AND_ASSIGN(GLContextSwitch);
 };
 
+//------------------------------------------------------------------------------
+/// Keeps the gl context made current by |GLContextSwitch| scopes current for
+/// the lifetime of the batch instead of restoring it after each scope.
+///
+/// Use this around a run of tasks that each open their own context switch on
+/// the same context — for example queued IO thread image uploads — so only
+/// the first task pays for making the context current. The caller must
+/// guarantee that nothing else makes a different gl context current on this
+/// thread while the batch is alive. Batches may nest; the deferred restore
+/// happens when the outermost batch ends.
+class GLContextSwitchBatch {
+ public:
+  GLContextSwitchBatch();
+
+  ~GLContextSwitchBatch();
+
+ private:
+  FML_DISALLOW_COPY_AND_ASSIGN(GLContextSwitchBatch);
+};
+
 }  // namespace flutter
 
 #endif  // FLUTTER_COMMON_GRAPHICS_GL_CONTEXT_SWITCH_H_
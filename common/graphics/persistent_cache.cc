@@ -4,7 +4,10 @@
 
 #include "flutter/common/graphics/persistent_cache.h"
 
+#include <algorithm>
 #include <future>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -17,6 +20,7 @@
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/paths.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/shell/version/version.h"
 #include "openssl/sha.h"
@@ -204,6 +208,15 @@ size_t PersistentCache::PrecompileKnownSkSLs(GrDirectContext* context) const {
     return 0;
   }
 
+  // Compile the most frequently loaded shaders first so the frame-critical
+  // ones are available earliest. The compilations themselves must stay on the
+  // rendering context's thread as GrDirectContext is not thread safe; the
+  // worker pool parallelism is in the load stage above.
+  std::stable_sort(known_sksls.begin(), known_sksls.end(),
+                   [](const SkSLCache& a, const SkSLCache& b) {
+                     return a.use_count > b.use_count;
+                   });
+
   size_t precompiled_count = 0;
   for (const auto& sksl : known_sksls) {
     TRACE_EVENT0("flutter", "PrecompilingSkSL");
@@ -221,27 +234,64 @@ size_t PersistentCache::PrecompileKnownSkSLs(GrDirectContext* context) const {
 std::vector<PersistentCache::SkSLCache> PersistentCache::LoadSkSLs() const {
   TRACE_EVENT0("flutter", "PersistentCache::LoadSkSLs");
   std::vector<PersistentCache::SkSLCache> result;
-  fml::FileVisitor visitor = [&result](const fml::UniqueFD& directory,
-                                       const std::string& filename) {
-    SkSLCache cache = LoadFile(directory, filename, true);
-    if (cache.key != nullptr && cache.value != nullptr) {
-      result.push_back(cache);
-    } else {
-      FML_LOG(ERROR) << "Failed to load: " << filename;
-    }
-    return true;
-  };
 
   // Only visit sksl_cache_directory_ if this persistent cache is valid.
   // However, we'd like to continue visit the asset dir even if this persistent
   // cache is invalid.
-  if (IsValid()) {
+  if (IsValid() && !LoadPackedSkSLs(&result)) {
     // In case `rewinddir` doesn't work reliably, load SkSLs from a freshly
     // opened directory (https://github.com/flutter/flutter/issues/65258).
     fml::UniqueFD fresh_dir =
         fml::OpenDirectoryReadOnly(*cache_directory_, kSkSLSubdirName);
     if (fresh_dir.is_valid()) {
-      fml::VisitFiles(fresh_dir, visitor);
+      std::vector<std::string> file_names;
+      fml::VisitFiles(fresh_dir, [&file_names](const fml::UniqueFD& directory,
+                                               const std::string& filename) {
+        file_names.push_back(filename);
+        return true;
+      });
+
+      // Fan the file loads out across the worker pool. The tasks only touch
+      // their own slot of |loaded| and the latch blocks until all of them are
+      // done, so the references into this frame stay valid.
+      std::vector<SkSLCache> loaded(file_names.size());
+      std::vector<fml::RefPtr<fml::TaskRunner>> workers =
+          GetWorkerTaskRunners();
+      if (workers.size() > 1 && file_names.size() > 1) {
+        fml::CountDownLatch latch(file_names.size());
+        for (size_t i = 0; i < file_names.size(); i++) {
+          workers[i % workers.size()]->PostTask(
+              [&loaded, &latch, &fresh_dir, &file_names, i]() {
+                loaded[i] = LoadFile(fresh_dir, file_names[i], true);
+                latch.CountDown();
+              });
+        }
+        latch.Wait();
+      } else {
+        for (size_t i = 0; i < file_names.size(); i++) {
+          loaded[i] = LoadFile(fresh_dir, file_names[i], true);
+        }
+      }
+
+      for (size_t i = 0; i < loaded.size(); i++) {
+        if (loaded[i].key != nullptr && loaded[i].value != nullptr) {
+          {
+            std::scoped_lock lock(use_counts_mutex_);
+            auto found = use_counts_.find(file_names[i]);
+            loaded[i].use_count =
+                found == use_counts_.end() ? 0 : found->second;
+          }
+          result.push_back(std::move(loaded[i]));
+        } else {
+          FML_LOG(ERROR) << "Failed to load: " << file_names[i];
+        }
+      }
+
+      if (!is_read_only_ && !result.empty()) {
+        // Rebuild the packed file so the next warmup skips the directory
+        // scan.
+        PackSkSLCache();
+      }
     }
   }
 
@@ -275,6 +325,146 @@ std::vector<PersistentCache::SkSLCache> PersistentCache::LoadSkSLs() const {
   return result;
 }
 
+bool PersistentCache::LoadPackedSkSLs(std::vector<SkSLCache>* result) const {
+  auto file = fml::OpenFileReadOnly(*cache_directory_, kPackedSkSLFileName);
+  if (!file.is_valid()) {
+    return false;
+  }
+  auto mapping = std::make_unique<fml::FileMapping>(file);
+  if (mapping->GetMapping() == nullptr ||
+      mapping->GetSize() < sizeof(PackedCacheHeader)) {
+    return false;
+  }
+  const uint8_t* data = mapping->GetMapping();
+  const PackedCacheHeader* header =
+      reinterpret_cast<const PackedCacheHeader*>(data);
+  if (header->signature != PackedCacheHeader::kSignature ||
+      header->version != PackedCacheHeader::kVersion1) {
+    FML_LOG(INFO) << "Packed persistent cache header is corrupt.";
+    return false;
+  }
+  size_t index_end = sizeof(PackedCacheHeader) +
+                     static_cast<size_t>(header->entry_count) *
+                         sizeof(PackedCacheEntry);
+  if (mapping->GetSize() < index_end) {
+    FML_LOG(INFO) << "Packed persistent cache index is corrupt.";
+    return false;
+  }
+  const PackedCacheEntry* entries = reinterpret_cast<const PackedCacheEntry*>(
+      data + sizeof(PackedCacheHeader));
+  std::vector<SkSLCache> loaded;
+  for (uint32_t i = 0; i < header->entry_count; i++) {
+    const PackedCacheEntry& entry = entries[i];
+    if (static_cast<size_t>(entry.key_offset) + entry.key_size >
+            mapping->GetSize() ||
+        static_cast<size_t>(entry.value_offset) + entry.value_size >
+            mapping->GetSize()) {
+      FML_LOG(INFO) << "Packed persistent cache entry is corrupt: " << i;
+      return false;
+    }
+    loaded.push_back({SkData::MakeWithCopy(data + entry.key_offset,  //
+                                           entry.key_size),
+                      SkData::MakeWithCopy(data + entry.value_offset,  //
+                                           entry.value_size),
+                      entry.use_count});
+  }
+  std::move(loaded.begin(), loaded.end(), std::back_inserter(*result));
+  return true;
+}
+
+void PersistentCache::PackSkSLCache() const {
+  if (is_read_only_ || !IsValid()) {
+    return;
+  }
+
+  std::map<std::string, uint32_t> use_counts;
+  {
+    std::scoped_lock lock(use_counts_mutex_);
+    use_counts = use_counts_;
+  }
+
+  auto task = [cache_directory = cache_directory_,
+               use_counts = std::move(use_counts)]() {
+    TRACE_EVENT0("flutter", "PersistentCachePackSkSLs");
+    fml::UniqueFD sksl_dir =
+        fml::OpenDirectoryReadOnly(*cache_directory, kSkSLSubdirName);
+    if (!sksl_dir.is_valid()) {
+      return;
+    }
+
+    std::vector<SkSLCache> entries;
+    fml::VisitFiles(sksl_dir, [&entries, &use_counts](
+                                  const fml::UniqueFD& directory,
+                                  const std::string& filename) {
+      SkSLCache cache = LoadFile(directory, filename, true);
+      if (cache.key != nullptr && cache.value != nullptr) {
+        auto found = use_counts.find(filename);
+        cache.use_count = found == use_counts.end() ? 0 : found->second;
+        entries.push_back(cache);
+      }
+      return true;
+    });
+    if (entries.empty()) {
+      return;
+    }
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const SkSLCache& a, const SkSLCache& b) {
+                       return a.use_count > b.use_count;
+                     });
+
+    size_t total_size = sizeof(PackedCacheHeader) +
+                        entries.size() * sizeof(PackedCacheEntry);
+    for (const auto& entry : entries) {
+      total_size += entry.key->size() + entry.value->size();
+    }
+    if (total_size > std::numeric_limits<uint32_t>::max()) {
+      FML_LOG(WARNING) << "SkSL cache is too large to pack.";
+      return;
+    }
+
+    uint8_t* buffer = reinterpret_cast<uint8_t*>(malloc(total_size));
+    if (!buffer) {
+      return;
+    }
+    fml::MallocMapping mapping(buffer, total_size);
+
+    PackedCacheHeader header;
+    header.entry_count = static_cast<uint32_t>(entries.size());
+    memcpy(buffer, &header, sizeof(PackedCacheHeader));
+    PackedCacheEntry* index =
+        reinterpret_cast<PackedCacheEntry*>(buffer + sizeof(PackedCacheHeader));
+    size_t offset = sizeof(PackedCacheHeader) +
+                    entries.size() * sizeof(PackedCacheEntry);
+    for (size_t i = 0; i < entries.size(); i++) {
+      index[i].key_offset = static_cast<uint32_t>(offset);
+      index[i].key_size = static_cast<uint32_t>(entries[i].key->size());
+      memcpy(buffer + offset, entries[i].key->data(), entries[i].key->size());
+      offset += entries[i].key->size();
+      index[i].value_offset = static_cast<uint32_t>(offset);
+      index[i].value_size = static_cast<uint32_t>(entries[i].value->size());
+      memcpy(buffer + offset, entries[i].value->data(),
+             entries[i].value->size());
+      offset += entries[i].value->size();
+      index[i].use_count = entries[i].use_count;
+      index[i].reserved = 0;
+    }
+
+    if (!fml::WriteAtomically(*cache_directory, kPackedSkSLFileName, mapping)) {
+      FML_LOG(WARNING) << "Could not write the packed SkSL cache.";
+    }
+  };
+
+  auto worker = GetWorkerTaskRunner();
+  if (!worker) {
+    FML_LOG(WARNING)
+        << "The persistent cache has no available workers. Packing the SkSL "
+           "cache on the current thread.";
+    task();
+  } else {
+    worker->PostTask(std::move(task));
+  }
+}
+
 PersistentCache::PersistentCache(bool read_only)
     : is_read_only_(read_only),
       cache_directory_(MakeCacheDirectory(cache_base_path_, read_only, false)),
@@ -340,6 +530,8 @@ sk_sp<SkData> PersistentCache::load(const SkData& key) {
       PersistentCache::LoadFile(*cache_directory_, file_name, false).value;
   if (result != nullptr) {
     TRACE_EVENT0("flutter", "PersistentCacheLoadHit");
+    std::scoped_lock lock(use_counts_mutex_);
+    use_counts_[file_name]++;
   }
   return result;
 }
@@ -421,6 +613,20 @@ void PersistentCache::store(const SkData& key, const SkData& data) {
   PersistentCacheStore(GetWorkerTaskRunner(),
                        cache_sksl_ ? sksl_cache_directory_ : cache_directory_,
                        std::move(file_name), std::move(mapping));
+
+  if (cache_sksl_) {
+    // A newly stored SkSL makes the packed warmup file stale. Remove it so
+    // the next |LoadSkSLs| rescans the directory and rebuilds the pack.
+    auto invalidate = [cache_directory = cache_directory_]() {
+      fml::UnlinkFile(*cache_directory, kPackedSkSLFileName);
+    };
+    auto worker = GetWorkerTaskRunner();
+    if (worker) {
+      worker->PostTask(invalidate);
+    } else {
+      invalidate();
+    }
+  }
 }
 
 void PersistentCache::DumpSkp(const SkData& data) {
@@ -467,6 +673,22 @@ fml::RefPtr<fml::TaskRunner> PersistentCache::GetWorkerTaskRunner() const {
   return worker;
 }
 
+std::vector<fml::RefPtr<fml::TaskRunner>>
+PersistentCache::GetWorkerTaskRunners() const {
+  std::vector<fml::RefPtr<fml::TaskRunner>> workers;
+
+  std::scoped_lock lock(worker_task_runners_mutex_);
+  for (const auto& runner : worker_task_runners_) {
+    // Tasks posted to a runner that runs on the calling thread could not be
+    // waited upon without deadlocking.
+    if (!runner->RunsTasksOnCurrentThread()) {
+      workers.push_back(runner);
+    }
+  }
+
+  return workers;
+}
+
 void PersistentCache::SetAssetManager(std::shared_ptr<AssetManager> value) {
   TRACE_EVENT_INSTANT0("flutter", "PersistentCache::SetAssetManager");
   asset_manager_ = std::move(value);
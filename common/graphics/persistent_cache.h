@@ -5,6 +5,7 @@
 #ifndef FLUTTER_COMMON_GRAPHICS_PERSISTENT_CACHE_H_
 #define FLUTTER_COMMON_GRAPHICS_PERSISTENT_CACHE_H_
 
+#include <map>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -66,6 +67,33 @@ class PersistentCache : public GrContextOptions::PersistentCache {
     uint32_t key_size;
   };
 
+  // Header written at the start of the packed SkSL cache file. The packed
+  // file stores every SkSL cache entry behind a single index so warmup can
+  // load all of them with one file open and one mapping instead of a
+  // directory scan.
+  struct PackedCacheHeader {
+    // A prefix used to identify the packed cache file format.
+    static const uint32_t kSignature = 0x504B534C;
+    static const uint32_t kVersion1 = 1;
+
+    uint32_t signature = kSignature;
+    uint32_t version = kVersion1;
+    uint32_t entry_count = 0;
+    uint32_t reserved = 0;
+  };
+
+  // Index record for one entry in the packed SkSL cache file. Offsets are
+  // relative to the start of the file. Entries are ordered by descending use
+  // count so the most frequently loaded shaders precompile first.
+  struct PackedCacheEntry {
+    uint32_t key_offset;
+    uint32_t key_size;
+    uint32_t value_offset;
+    uint32_t value_size;
+    uint32_t use_count;
+    uint32_t reserved;
+  };
+
   ~PersistentCache() override;
 
   void AddWorkerTaskRunner(const fml::RefPtr<fml::TaskRunner>& task_runner);
@@ -91,11 +119,25 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   struct SkSLCache {
     sk_sp<SkData> key;
     sk_sp<SkData> value;
+
+    // The number of times |load| has returned this entry in this process,
+    // carried through the packed cache file across runs. Used to compile the
+    // frame-critical shaders first during warmup.
+    uint32_t use_count = 0;
   };
 
   /// Load all the SkSL shader caches in the right directory.
+  ///
+  /// Prefers the packed cache file written by |PackSkSLCache| and falls back
+  /// to a directory scan whose file loads are fanned out across the worker
+  /// task runners.
   std::vector<SkSLCache> LoadSkSLs() const;
 
+  /// Rebuild the packed SkSL cache file from the individual files in the SkSL
+  /// cache directory. The work happens on a worker task runner; this is
+  /// scheduled automatically when |LoadSkSLs| falls back to a directory scan.
+  void PackSkSLCache() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Precompile SkSLs packaged with the application and gathered
   ///             during previous runs in the given context.
@@ -129,6 +171,7 @@ class PersistentCache : public GrContextOptions::PersistentCache {
 
   static constexpr char kSkSLSubdirName[] = "sksl";
   static constexpr char kAssetFileName[] = "io.flutter.shaders.json";
+  static constexpr char kPackedSkSLFileName[] = "io.flutter.sksl.pack";
 
  private:
   static std::string cache_base_path_;
@@ -157,12 +200,22 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   bool stored_new_shaders_ = false;
   bool is_dumping_skp_ = false;
 
+  // Number of |load| hits per cache file name, guarded by use_counts_mutex_.
+  // Snapshotted into the packed cache file so frequently used shaders
+  // precompile first on the next run.
+  mutable std::mutex use_counts_mutex_;
+  std::map<std::string, uint32_t> use_counts_;
+
   static SkSLCache LoadFile(const fml::UniqueFD& dir,
                             const std::string& file_name,
                             bool need_key);
 
   bool IsValid() const;
 
+  // Load all entries from the packed SkSL cache file into |result|. Returns
+  // false, leaving |result| untouched, when the file is absent or corrupt.
+  bool LoadPackedSkSLs(std::vector<SkSLCache>* result) const;
+
   explicit PersistentCache(bool read_only = false);
 
   // |GrContextOptions::PersistentCache|
@@ -170,6 +223,10 @@ class PersistentCache : public GrContextOptions::PersistentCache {
 
   fml::RefPtr<fml::TaskRunner> GetWorkerTaskRunner() const;
 
+  // All registered worker task runners except those that run tasks on the
+  // calling thread, which cannot be waited upon without deadlocking.
+  std::vector<fml::RefPtr<fml::TaskRunner>> GetWorkerTaskRunners() const;
+
   friend class testing::ShellTest;
 
   FML_DISALLOW_COPY_AND_ASSIGN(PersistentCache);
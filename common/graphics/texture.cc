@@ -14,13 +14,31 @@ Texture::Texture(int64_t id) : id_(id) {}
 
 Texture::~Texture() = default;
 
-TextureRegistry::TextureRegistry() = default;
+void Texture::MarkNewFrameAvailable() {
+  ++frame_generation_;
+  OnNewFrameAvailable();
+}
+
+TextureRegistry::TextureRegistry()
+    : textures_(std::make_shared<TextureMap>()) {}
+
+std::shared_ptr<const TextureRegistry::TextureMap>
+TextureRegistry::GetCurrentTextures() const {
+  return std::atomic_load_explicit(&textures_, std::memory_order_acquire);
+}
 
 void TextureRegistry::RegisterTexture(const std::shared_ptr<Texture>& texture) {
   if (!texture) {
     return;
   }
-  mapping_[texture->Id()] = texture;
+  std::scoped_lock lock(registration_mutex_);
+  // Writers are serialized by the lock, so the plain read of the current
+  // version here cannot race with another publish.
+  auto next = std::make_shared<TextureMap>(*textures_);
+  (*next)[texture->Id()] = texture;
+  std::atomic_store_explicit(
+      &textures_, std::shared_ptr<const TextureMap>(std::move(next)),
+      std::memory_order_release);
 }
 
 void TextureRegistry::RegisterContextListener(
@@ -30,12 +48,24 @@ void TextureRegistry::RegisterContextListener(
 }
 
 void TextureRegistry::UnregisterTexture(int64_t id) {
-  auto found = mapping_.find(id);
-  if (found == mapping_.end()) {
-    return;
+  std::shared_ptr<Texture> texture;
+  {
+    std::scoped_lock lock(registration_mutex_);
+    auto found = textures_->find(id);
+    if (found == textures_->end()) {
+      return;
+    }
+    texture = found->second;
+    auto next = std::make_shared<TextureMap>(*textures_);
+    next->erase(id);
+    std::atomic_store_explicit(
+        &textures_, std::shared_ptr<const TextureMap>(std::move(next)),
+        std::memory_order_release);
   }
-  found->second->OnTextureUnregistered();
-  mapping_.erase(found);
+  // Notified outside the lock, on this (raster) thread, once the version
+  // without the texture is visible to readers. The notified texture is
+  // retired through this shared reference rather than the map.
+  texture->OnTextureUnregistered();
 }
 
 void TextureRegistry::UnregisterContextListener(uintptr_t id) {
@@ -43,7 +73,7 @@ void TextureRegistry::UnregisterContextListener(uintptr_t id) {
 }
 
 void TextureRegistry::OnGrContextCreated() {
-  for (auto& it : mapping_) {
+  for (auto& it : *GetCurrentTextures()) {
     it.second->OnGrContextCreated();
   }
 
@@ -57,7 +87,7 @@ void TextureRegistry::OnGrContextCreated() {
 }
 
 void TextureRegistry::OnGrContextDestroyed() {
-  for (auto& it : mapping_) {
+  for (auto& it : *GetCurrentTextures()) {
     it.second->OnGrContextDestroyed();
   }
 
@@ -71,8 +101,11 @@ void TextureRegistry::OnGrContextDestroyed() {
 }
 
 std::shared_ptr<Texture> TextureRegistry::GetTexture(int64_t id) {
-  auto it = mapping_.find(id);
-  return it != mapping_.end() ? it->second : nullptr;
+  // A single acquire load pins the version this lookup uses; concurrent
+  // registrations publish new versions without disturbing it.
+  std::shared_ptr<const TextureMap> textures = GetCurrentTextures();
+  auto it = textures->find(id);
+  return it != textures->end() ? it->second : nullptr;
 }
 
 }  // namespace flutter
@@ -5,7 +5,10 @@
 #ifndef FLUTTER_COMMON_GRAPHICS_TEXTURE_H_
 #define FLUTTER_COMMON_GRAPHICS_TEXTURE_H_
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 
 #include "flutter/display_list/display_list_builder.h"
 #include "flutter/display_list/display_list_paint.h"
@@ -52,37 +55,59 @@ class Texture : public ContextListener {
                      bool freeze,
                      const SkSamplingOptions& sampling) = 0;
 
-  // Called on raster thread.
-  virtual void MarkNewFrameAvailable() = 0;
+  // Called on raster thread. Advances the frame generation and notifies the
+  // implementation through |OnNewFrameAvailable|.
+  void MarkNewFrameAvailable();
+
+  // Called on raster thread when the producer publishes a new frame.
+  virtual void OnNewFrameAvailable() = 0;
 
   // Called on raster thread.
   virtual void OnTextureUnregistered() = 0;
 
   int64_t Id() { return id_; }
 
+  // Called on raster thread. Identifies the latest frame published by the
+  // producer; zero until the first frame arrives. TextureLayer compares
+  // generations between frames to skip re-compositing textures whose
+  // content has not changed.
+  uint64_t frame_generation() const { return frame_generation_; }
+
  private:
   int64_t id_;
+  uint64_t frame_generation_ = 0;
   FML_DISALLOW_COPY_AND_ASSIGN(Texture);
 };
 
+// The texture mapping is kept as an RCU-style published snapshot: every
+// mutation builds a new immutable map version under a writer lock and
+// publishes it atomically, while |GetTexture| on the raster hot path
+// reads the current version with a single atomic load and no locking.
+// Registration bursts from other threads therefore can never stall
+// composition of texture-heavy frames.
 class TextureRegistry {
  public:
   TextureRegistry();
 
-  // Called from raster thread.
+  // Called from any thread. Publishes a new registry version; the raster
+  // thread observes the texture on its next |GetTexture| lookup. No
+  // texture callbacks are invoked.
   void RegisterTexture(const std::shared_ptr<Texture>& texture);
 
   // Called from raster thread.
   void RegisterContextListener(uintptr_t id,
                                std::weak_ptr<ContextListener> image);
 
-  // Called from raster thread.
+  // Called from raster thread, where texture implementations expect
+  // |Texture::OnTextureUnregistered| to run so they can release their
+  // rendering resources.
   void UnregisterTexture(int64_t id);
 
   // Called from the raster thread.
   void UnregisterContextListener(uintptr_t id);
 
-  // Called from raster thread.
+  // Called from raster thread during paint. Lock-free; reads the
+  // currently published registry version.
   std::shared_ptr<Texture> GetTexture(int64_t id);
 
   // Called from raster thread.
@@ -92,7 +117,16 @@ class TextureRegistry {
   void OnGrContextDestroyed();
 
  private:
-  std::map<int64_t, std::shared_ptr<Texture>> mapping_;
+  using TextureMap = std::map<int64_t, std::shared_ptr<Texture>>;
+
+  // The currently published version, loaded with acquire ordering.
+  std::shared_ptr<const TextureMap> GetCurrentTextures() const;
+
+  // Serializes writers; each mutation copies the current version and
+  // publishes the copy, leaving concurrent readers undisturbed on the
+  // version they already loaded.
+  std::mutex registration_mutex_;
+  std::shared_ptr<const TextureMap> textures_;
   std::map<uintptr_t, std::weak_ptr<ContextListener>> images_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(TextureRegistry);
@@ -30,12 +30,27 @@ class FrameTiming {
     kRasterStart,
     kRasterFinish,
     kRasterFinishWallTime,
+    kBufferAcquireStart,
+    kBufferAcquireFinish,
+    kRasterEncodeFinish,
+    kPresentStart,
+    kPresentFinish,
+    kGpuWorkFinish,
     kCount
   };
 
-  static constexpr Phase kPhases[kCount] = {
-      kVsyncStart,  kBuildStart,   kBuildFinish,
-      kRasterStart, kRasterFinish, kRasterFinishWallTime};
+  static constexpr Phase kPhases[kCount] = {kVsyncStart,
+                                            kBuildStart,
+                                            kBuildFinish,
+                                            kRasterStart,
+                                            kRasterFinish,
+                                            kRasterFinishWallTime,
+                                            kBufferAcquireStart,
+                                            kBufferAcquireFinish,
+                                            kRasterEncodeFinish,
+                                            kPresentStart,
+                                            kPresentFinish,
+                                            kGpuWorkFinish};
 
   static constexpr int kStatisticsCount = kCount + 5;
 
@@ -187,6 +202,13 @@ struct Settings {
   // after failing to bind to a specified port.
   bool enable_service_port_fallback = false;
 
+  // Determines whether the VM service HTTP server is started during VM
+  // bootstrap. When deferred, the service isolate is still created (its
+  // lifecycle is owned by the VM) but the socket bind and web server startup
+  // are skipped until a client requests the server via
+  // `Service.controlWebServer(enable: true)` from `dart:developer`.
+  bool defer_observatory_server_start = false;
+
   // Font settings
   bool use_test_fonts = false;
 
@@ -203,6 +225,13 @@ struct Settings {
   // not supported on the platform.
   bool enable_impeller = false;
 
+  // Issues residency hints for the Dart snapshot mappings: the snapshot
+  // ranges are prefetched before VM and isolate creation so cold launches
+  // fault them in with read-ahead, and the ranges are advised away after the
+  // first frame so cold regions can be reclaimed on low-RAM devices. Only
+  // effective for file-backed snapshot mappings.
+  bool snapshot_residency_hints = false;
+
   // Data set by platform-specific embedders for use in font initialization.
   uint32_t font_initialization_data = 0;
 
@@ -301,6 +330,39 @@ struct Settings {
   // Max bytes threshold of resource cache, or 0 for unlimited.
   size_t resource_cache_max_bytes_threshold = 0;
 
+  // Max bytes of rasterized images the raster cache retains across frames, or
+  // 0 for unlimited. When the budget is exceeded, the least recently drawn
+  // cache images are evicted and re-rasterized on demand.
+  size_t raster_cache_max_bytes = 0;
+
+  // Populate display list raster cache entries on the concurrent worker pool
+  // instead of inline on the raster thread. Items draw directly until their
+  // cache image is ready, which avoids a rasterization spike on the frame
+  // that first caches a complex item.
+  bool enable_background_raster_cache_population = false;
+
+  // Fan independent layer subtree diffs out to the concurrent worker pool
+  // when computing partial repaint damage, keeping per-frame diff cost flat
+  // as layer counts grow. Only effective when partial repaint is supported.
+  bool enable_parallel_layer_tree_diff = false;
+
+  // Preroll independent layer subtrees on the concurrent worker pool before
+  // painting. Preroll stays on the raster thread for frames that composite
+  // platform views, whose embedders are not thread safe.
+  bool enable_parallel_layer_tree_preroll = false;
+
+  // Rasterize software (CPU) bitmap images tile by tile on the concurrent
+  // worker pool instead of on one thread. Helps headless and VM
+  // deployments that have no GPU and would otherwise peg a single core.
+  bool enable_parallel_software_rasterization = false;
+
+  // Calibrate the display list complexity cost tables for the device on
+  // first launch by running a short raster microbenchmark suite, and
+  // persist the fitted per-op-class corrections. Improves raster cache
+  // admission on devices whose GPUs rank op costs differently than the
+  // reference devices the hardcoded tables were fitted on.
+  bool enable_complexity_calibration = false;
+
   /// The minimum number of samples to require in multipsampled anti-aliasing.
   ///
   /// Setting this value to 0 or 1 disables MSAA.
@@ -2,7 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <type_traits>
+#include <utility>
 
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/display_list_canvas_dispatcher.h"
@@ -26,15 +28,14 @@ DisplayList::DisplayList()
       bounds_cull_({0, 0, 0, 0}),
       can_apply_group_opacity_(true) {}
 
-DisplayList::DisplayList(uint8_t* ptr,
-                         size_t byte_count,
+DisplayList::DisplayList(DisplayListStorage&& storage,
                          unsigned int op_count,
                          size_t nested_byte_count,
                          unsigned int nested_op_count,
                          const SkRect& cull_rect,
                          bool can_apply_group_opacity)
-    : storage_(ptr),
-      byte_count_(byte_count),
+    : storage_(std::move(storage)),
+      byte_count_(storage_.used()),
       op_count_(op_count),
       nested_byte_count_(nested_byte_count),
       nested_op_count_(nested_op_count),
@@ -48,8 +49,9 @@ DisplayList::DisplayList(uint8_t* ptr,
 }
 
 DisplayList::~DisplayList() {
-  uint8_t* ptr = storage_.get();
-  DisposeOps(ptr, ptr + byte_count_);
+  for (const DisplayListStorage::Chunk& chunk : storage_.chunks()) {
+    DisposeOps(chunk.begin(), chunk.end());
+  }
 }
 
 void DisplayList::ComputeBounds() {
@@ -62,14 +64,45 @@ void DisplayList::ComputeBounds() {
   bounds_ = accumulator.bounds();
 }
 
+static void DispatchOneOp(Dispatcher& dispatcher, const DLOp* op) {
+  switch (op->type) {
+#define DL_OP_DISPATCH(name)                                \
+  case DisplayListOpType::k##name:                          \
+    static_cast<const name##Op*>(op)->dispatch(dispatcher); \
+    break;
+
+    FOR_EACH_DISPLAY_LIST_OP(DL_OP_DISPATCH)
+
+#undef DL_OP_DISPATCH
+
+    default:
+      FML_DCHECK(false);
+      break;
+  }
+}
+
 void DisplayList::ComputeRTree() {
   RTreeBoundsAccumulator accumulator;
   DisplayListBoundsCalculator calculator(accumulator, &bounds_cull_);
-  Dispatch(calculator);
+  // Dispatch op by op so every rect accumulated into the R-Tree can be
+  // tagged with the logical storage offset of the op that produced it.
+  size_t chunk_base = 0;
+  for (const DisplayListStorage::Chunk& chunk : storage_.chunks()) {
+    uint8_t* ptr = chunk.begin();
+    while (ptr < chunk.end()) {
+      auto op = reinterpret_cast<const DLOp*>(ptr);
+      accumulator.set_source_identifier(chunk_base + (ptr - chunk.begin()));
+      DispatchOneOp(calculator, op);
+      ptr += op->size;
+      FML_DCHECK(ptr <= chunk.end());
+    }
+    chunk_base += chunk.used();
+  }
   if (calculator.is_unbounded()) {
     FML_LOG(INFO) << "returning partial rtree for unbounded DisplayList";
   }
   rtree_ = accumulator.rtree();
+  rtree_offsets_ = accumulator.source_identifiers();
 }
 
 void DisplayList::Dispatch(Dispatcher& dispatcher,
@@ -79,19 +112,65 @@ void DisplayList::Dispatch(Dispatcher& dispatcher,
     auto op = reinterpret_cast<const DLOp*>(ptr);
     ptr += op->size;
     FML_DCHECK(ptr <= end);
-    switch (op->type) {
-#define DL_OP_DISPATCH(name)                                \
-  case DisplayListOpType::k##name:                          \
-    static_cast<const name##Op*>(op)->dispatch(dispatcher); \
-    break;
-
-      FOR_EACH_DISPLAY_LIST_OP(DL_OP_DISPATCH)
-
-#undef DL_OP_DISPATCH
+    DispatchOneOp(dispatcher, op);
+  }
+}
 
-      default:
-        FML_DCHECK(false);
-        return;
+void DisplayList::Dispatch(Dispatcher& dispatcher, const SkRect& cull_rect) {
+  if (cull_rect.isEmpty()) {
+    return;
+  }
+  if (cull_rect.contains(bounds())) {
+    Dispatch(dispatcher);
+    return;
+  }
+  sk_sp<const DlRTree> tree = rtree();
+  std::vector<int> rect_indices;
+  tree->search(cull_rect, &rect_indices);
+  std::vector<size_t> culled_in;
+  culled_in.reserve(rect_indices.size());
+  for (int index : rect_indices) {
+    FML_DCHECK(static_cast<size_t>(index) < rtree_offsets_.size());
+    culled_in.push_back(rtree_offsets_[index]);
+  }
+  // The search results come back in tree order, not op order.
+  std::sort(culled_in.begin(), culled_in.end());
+  // |rtree_offsets_| lists the offset of every op that contributed a
+  // rect to the R-Tree, in op order. Ops not present there are state
+  // ops (attributes, transforms, clips, save/restore) or draws with no
+  // effect, and are always replayed so replay state stays correct.
+  // Indexed ops are replayed only when the search matched them.
+  auto indexed = rtree_offsets_.begin();
+  auto matched = culled_in.begin();
+  size_t offset = 0;
+  for (const DisplayListStorage::Chunk& chunk : storage_.chunks()) {
+    uint8_t* ptr = chunk.begin();
+    while (ptr < chunk.end()) {
+      auto op = reinterpret_cast<const DLOp*>(ptr);
+      bool replay = true;
+      if (indexed != rtree_offsets_.end() && *indexed == offset) {
+        // An op can contribute more than one rect; consume them all.
+        do {
+          indexed++;
+        } while (indexed != rtree_offsets_.end() && *indexed == offset);
+        replay = false;
+        while (matched != culled_in.end() && *matched <= offset) {
+          if (*matched == offset) {
+            replay = true;
+          }
+          matched++;
+        }
+      }
+      if (replay) {
+        DispatchOneOp(dispatcher, op);
+      } else if (op->type == DisplayListOpType::kSetColorDrawRect) {
+        // A skipped fused op still carries an attribute change that the
+        // draws after it depend on; apply the state half without drawing.
+        static_cast<const SetColorDrawRectOp*>(op)->dispatchState(dispatcher);
+      }
+      offset += op->size;
+      ptr += op->size;
+      FML_DCHECK(ptr <= chunk.end());
     }
   }
 }
@@ -200,6 +279,44 @@ void DisplayList::RenderTo(SkCanvas* canvas, SkScalar opacity) const {
   Dispatch(dispatcher);
 }
 
+// Folds |size| bytes at |data| into the two running hash lanes. The two
+// lanes use independent multipliers so together they behave as a single
+// 128-bit state; this is a word-wise multiply-xorshift mix, not a
+// cryptographic hash.
+static void HashBytes(const uint8_t* data,
+                      size_t size,
+                      uint64_t* h1_ptr,
+                      uint64_t* h2_ptr) {
+  constexpr uint64_t kMul1 = 0x9e3779b97f4a7c15;
+  constexpr uint64_t kMul2 = 0xc2b2ae3d27d4eb4f;
+  uint64_t h1 = *h1_ptr;
+  uint64_t h2 = *h2_ptr;
+  while (size > 0) {
+    uint64_t word = 0;
+    size_t len = std::min(size, sizeof(uint64_t));
+    memcpy(&word, data, len);
+    h1 = (h1 ^ word) * kMul1;
+    h1 ^= h1 >> 32;
+    h2 = (h2 ^ word) * kMul2;
+    h2 ^= h2 >> 29;
+    data += len;
+    size -= len;
+  }
+  *h1_ptr = h1;
+  *h2_ptr = h2;
+}
+
+void DisplayList::ComputeDigest() const {
+  uint64_t h1 = byte_count_;
+  uint64_t h2 = op_count_;
+  for (const DisplayListStorage::Chunk& chunk : storage_.chunks()) {
+    HashBytes(chunk.begin(), chunk.used(), &h1, &h2);
+  }
+  digest_[0] = h1;
+  digest_[1] = h2;
+  digest_computed_ = true;
+}
+
 bool DisplayList::Equals(const DisplayList* other) const {
   if (this == other) {
     return true;
@@ -207,12 +324,36 @@ bool DisplayList::Equals(const DisplayList* other) const {
   if (byte_count_ != other->byte_count_ || op_count_ != other->op_count_) {
     return false;
   }
-  uint8_t* ptr = storage_.get();
-  uint8_t* o_ptr = other->storage_.get();
-  if (ptr == o_ptr) {
+  // A digest match proves the storage is byte-identical, barring a
+  // vanishingly unlikely 128-bit collision, so retained lists that have
+  // not changed compare in constant time once their digests are cached.
+  // A mismatch is not conclusive the other way: ops holding shared
+  // attribute references embed pointer values that can differ between
+  // lists that still compare equal, so fall through to the op-wise walk.
+  if (digest() == other->digest()) {
     return true;
   }
-  return CompareOps(ptr, ptr + byte_count_, o_ptr, o_ptr + other->byte_count_);
+  // The chunk layout is a pure function of the sequence of op record sizes,
+  // so lists with equal op sequences always have identical chunk boundaries
+  // and a mismatched layout means some op size differs.
+  const auto& chunks = storage_.chunks();
+  const auto& o_chunks = other->storage_.chunks();
+  if (chunks.size() != o_chunks.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < chunks.size(); i++) {
+    if (chunks[i].used() != o_chunks[i].used()) {
+      return false;
+    }
+    if (chunks[i].begin() == o_chunks[i].begin()) {
+      continue;
+    }
+    if (!CompareOps(chunks[i].begin(), chunks[i].end(), o_chunks[i].begin(),
+                    o_chunks[i].end())) {
+      return false;
+    }
+  }
+  return true;
 }
 
 }  // namespace flutter
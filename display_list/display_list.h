@@ -7,9 +7,12 @@
 
 #include <memory>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "flutter/display_list/display_list_rtree.h"
 #include "flutter/display_list/display_list_sampling_options.h"
+#include "flutter/display_list/display_list_storage.h"
 #include "flutter/display_list/types.h"
 #include "flutter/fml/logging.h"
 
@@ -60,6 +63,9 @@
 
 namespace flutter {
 
+// The draw ops (kDrawPaint onward) must remain contiguous at the tail of
+// this list; DisplayListBuilder classifies a record as rendering content
+// with a single compare against kDrawPaint.
 #define FOR_EACH_DISPLAY_LIST_OP(V) \
   V(SetAntiAlias)                   \
   V(SetDither)                      \
@@ -91,6 +97,7 @@ namespace flutter {
   V(SetSkColorSource)               \
   V(SetImageColorSource)            \
   V(SetRuntimeEffectColorSource)    \
+  V(SetSharedColorSource)           \
                                     \
   V(ClearImageFilter)               \
   V(SetPodImageFilter)              \
@@ -128,7 +135,10 @@ namespace flutter {
                                     \
   V(DrawLine)                       \
   V(DrawRect)                       \
+  V(DrawRect16)                     \
+  V(SetColorDrawRect)               \
   V(DrawOval)                       \
+  V(DrawOval16)                     \
   V(DrawCircle)                     \
   V(DrawRRect)                      \
   V(DrawDRRect)                     \
@@ -225,10 +235,19 @@ class DisplayList : public SkRefCnt {
   ~DisplayList();
 
   void Dispatch(Dispatcher& ctx) const {
-    uint8_t* ptr = storage_.get();
-    Dispatch(ctx, ptr, ptr + byte_count_);
+    for (const DisplayListStorage::Chunk& chunk : storage_.chunks()) {
+      Dispatch(ctx, chunk.begin(), chunk.end());
+    }
   }
 
+  // Dispatches only the ops needed to correctly render the content that
+  // intersects |cull_rect|: draw ops whose R-Tree bounds intersect the
+  // rect, plus all state ops (attributes, transforms, clips and layer
+  // structure) so the surviving draws replay with correct state. Useful
+  // for partial repaint, where a small damage region should not pay to
+  // replay the whole list. Computes the R-Tree on first use.
+  void Dispatch(Dispatcher& ctx, const SkRect& cull_rect);
+
   void RenderTo(DisplayListBuilder* builder,
                 SkScalar opacity = SK_Scalar1) const;
 
@@ -264,6 +283,18 @@ class DisplayList : public SkRefCnt {
     return rtree_;
   }
 
+  // A 128-bit non-cryptographic digest of the op storage, computed on
+  // demand and then cached for the lifetime of the list. Byte-identical
+  // storage always produces equal digests, which lets |Equals| compare
+  // retained lists in constant time; see |Equals| for how digest
+  // mismatches are resolved.
+  std::pair<uint64_t, uint64_t> digest() const {
+    if (!digest_computed_) {
+      ComputeDigest();
+    }
+    return {digest_[0], digest_[1]};
+  }
+
   bool Equals(const DisplayList* other) const;
   bool Equals(const DisplayList& other) const { return Equals(&other); }
   bool Equals(sk_sp<const DisplayList> other) const {
@@ -275,18 +306,14 @@ class DisplayList : public SkRefCnt {
   static void DisposeOps(uint8_t* ptr, uint8_t* end);
 
  private:
-  DisplayList(uint8_t* ptr,
-              size_t byte_count,
+  DisplayList(DisplayListStorage&& storage,
               unsigned int op_count,
               size_t nested_byte_count,
               unsigned int nested_op_count,
               const SkRect& cull_rect,
               bool can_apply_group_opacity);
 
-  struct SkFreeDeleter {
-    void operator()(uint8_t* p) { sk_free(p); }
-  };
-  std::unique_ptr<uint8_t, SkFreeDeleter> storage_;
+  DisplayListStorage storage_;
   size_t byte_count_;
   unsigned int op_count_;
 
@@ -296,14 +323,25 @@ class DisplayList : public SkRefCnt {
   uint32_t unique_id_;
   SkRect bounds_;
   sk_sp<const DlRTree> rtree_;
+  // Logical storage offset of the op that produced each rect inserted
+  // into |rtree_|, in op (and therefore non-decreasing offset) order.
+  // Computed alongside the tree by |ComputeRTree|.
+  std::vector<size_t> rtree_offsets_;
 
   // Only used for drawPaint() and drawColor()
   SkRect bounds_cull_;
 
   bool can_apply_group_opacity_;
 
+  // Lazily computed by |digest| so lists that are never compared do not
+  // pay for the hashing pass; mutable for the same reason the digest is
+  // useful - |Equals| is const.
+  mutable uint64_t digest_[2] = {0, 0};
+  mutable bool digest_computed_ = false;
+
   void ComputeBounds();
   void ComputeRTree();
+  void ComputeDigest() const;
   void Dispatch(Dispatcher& ctx, uint8_t* ptr, uint8_t* end) const;
 
   friend class DisplayListBuilder;
@@ -3,6 +3,8 @@
 // found in the LICENSE file.
 
 #include "flutter/display_list/display_list_benchmarks.h"
+
+#include "flutter/benchmarking/perf_counters.h"
 #include "flutter/display_list/display_list_builder.h"
 #include "flutter/display_list/display_list_flags.h"
 
@@ -114,10 +116,12 @@ void BM_DrawLine(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawLine-" +
                   std::to_string(state.range(0)) + ".png";
@@ -162,10 +166,12 @@ void BM_DrawRect(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawRect-" +
                   std::to_string(state.range(0)) + ".png";
@@ -207,10 +213,12 @@ void BM_DrawOval(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawOval-" +
                   std::to_string(state.range(0)) + ".png";
@@ -254,10 +262,12 @@ void BM_DrawCircle(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawCircle-" +
                   std::to_string(state.range(0)) + ".png";
@@ -331,10 +341,12 @@ void BM_DrawRRect(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawRRect-" +
                   std::to_string(state.range(0)) + ".png";
@@ -412,10 +424,12 @@ void BM_DrawDRRect(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawDRRect-" +
                   std::to_string(state.range(0)) + ".png";
@@ -464,10 +478,12 @@ void BM_DrawArc(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawArc-" +
                   std::to_string(state.range(0)) + ".png";
@@ -666,10 +682,12 @@ void BM_DrawPath(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawPath-" + label + "-" +
                   std::to_string(state.range(0)) + ".png";
@@ -811,10 +829,12 @@ void BM_DrawVertices(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawVertices-" +
                   std::to_string(disc_count) + "-" + VertexModeToString(mode) +
@@ -914,10 +934,12 @@ void BM_DrawPoints(benchmark::State& state,
 
   auto display_list = builder.Build();
 
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawPoints-" +
                   PointModeToString(mode) + "-" + std::to_string(point_count) +
@@ -988,10 +1010,12 @@ void BM_DrawImage(benchmark::State& state,
 
   auto display_list = builder.Build();
 
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawImage-" +
                   (upload_bitmap ? "Upload-" : "Texture-") +
@@ -1071,10 +1095,12 @@ void BM_DrawImageRect(benchmark::State& state,
 
   auto display_list = builder.Build();
 
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawImageRect-" +
                   (upload_bitmap ? "Upload-" : "Texture-") +
@@ -1155,10 +1181,12 @@ void BM_DrawImageNine(benchmark::State& state,
 
   auto display_list = builder.Build();
 
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawImageNine-" +
                   (upload_bitmap ? "Upload-" : "Texture-") +
@@ -1200,10 +1228,12 @@ void BM_DrawTextBlob(benchmark::State& state,
 
   auto display_list = builder.Build();
 
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawTextBlob-" +
                   std::to_string(draw_calls) + ".png";
@@ -1264,10 +1294,12 @@ void BM_DrawShadow(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-DrawShadow-" +
                   VerbToString(type) + "-" +
@@ -1317,10 +1349,12 @@ void BM_SaveLayer(benchmark::State& state,
   auto display_list = builder.Build();
 
   // We only want to time the actual rasterization.
+  benchmarking::ScopedPerfCounters perf(state);
   for ([[maybe_unused]] auto _ : state) {
     display_list->RenderTo(canvas);
     canvas_provider->GetSurface()->flushAndSubmit(true);
   }
+  perf.StopAndReport();
 
   auto filename = canvas_provider->BackendName() + "-SaveLayer-" +
                   std::to_string(save_depth) + "-" +
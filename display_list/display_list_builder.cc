@@ -11,8 +11,6 @@
 
 namespace flutter {
 
-#define DL_BUILDER_PAGE 4096
-
 // CopyV(dst, src,n, src,n, ...) copies any number of typed srcs into dst.
 static void CopyV(void* dst) {}
 
@@ -29,22 +27,18 @@ template <typename T, typename... Args>
 void* DisplayListBuilder::Push(size_t pod, int op_inc, Args&&... args) {
   size_t size = SkAlignPtr(sizeof(T) + pod);
   FML_DCHECK(size < (1 << 24));
-  if (used_ + size > allocated_) {
-    static_assert(SkIsPow2(DL_BUILDER_PAGE),
-                  "This math needs updating for non-pow2.");
-    // Next greater multiple of DL_BUILDER_PAGE.
-    allocated_ = (used_ + size + DL_BUILDER_PAGE) & ~(DL_BUILDER_PAGE - 1);
-    storage_.realloc(allocated_);
-    FML_DCHECK(storage_.get());
-    memset(storage_.get() + used_, 0, allocated_ - used_);
-  }
-  FML_DCHECK(used_ + size <= allocated_);
-  auto op = reinterpret_cast<T*>(storage_.get() + used_);
-  used_ += size;
+  auto op = reinterpret_cast<T*>(storage_.Allocate(size));
   new (op) T{std::forward<Args>(args)...};
   op->type = T::kType;
   op->size = size;
   op_count_ += op_inc;
+  // Draw ops occupy the tail of the op type enum, so a single compare
+  // classifies the record; see the note on FOR_EACH_DISPLAY_LIST_OP.
+  if constexpr (T::kType >= DisplayListOpType::kDrawPaint) {
+    render_op_count_ += 1;
+  }
+  last_op_ = op;
+  last_op_type_ = T::kType;
   return op + 1;
 }
 
@@ -52,15 +46,23 @@ sk_sp<DisplayList> DisplayListBuilder::Build() {
   while (layer_stack_.size() > 1) {
     restore();
   }
-  size_t bytes = used_;
   int count = op_count_;
   size_t nested_bytes = nested_bytes_;
   int nested_count = nested_op_count_;
-  used_ = allocated_ = op_count_ = 0;
+  op_count_ = 0;
+  render_op_count_ = 0;
   nested_bytes_ = nested_op_count_ = 0;
-  storage_.realloc(bytes);
+  // The interned instances live on through the shared references held by
+  // the ops that recorded them.
+  color_source_pool_.clear();
+  image_filter_pool_.clear();
+  // The slack in the last chunk is deliberately not trimmed away; keeping
+  // the chunk at its standard capacity lets it return to the recycling
+  // pool when the list is destroyed.
+  last_op_ = nullptr;
   bool compatible = layer_stack_.back().is_group_opacity_compatible();
-  return sk_sp<DisplayList>(new DisplayList(storage_.release(), bytes, count,
+  // Moving the storage leaves this builder with a fresh empty storage.
+  return sk_sp<DisplayList>(new DisplayList(std::move(storage_), count,
                                             nested_bytes, nested_count,
                                             cull_rect_, compatible));
 }
@@ -72,9 +74,8 @@ DisplayListBuilder::DisplayListBuilder(const SkRect& cull_rect)
 }
 
 DisplayListBuilder::~DisplayListBuilder() {
-  uint8_t* ptr = storage_.get();
-  if (ptr) {
-    DisplayList::DisposeOps(ptr, ptr + used_);
+  for (const DisplayListStorage::Chunk& chunk : storage_.chunks()) {
+    DisplayList::DisposeOps(chunk.begin(), chunk.end());
   }
 }
 
@@ -137,6 +138,32 @@ void DisplayListBuilder::onSetBlender(sk_sp<SkBlender> blender) {
     UpdateCurrentOpacityCompatibility();
   }
 }
+std::shared_ptr<DlColorSource> DisplayListBuilder::InternColorSource(
+    const DlColorSource* source) {
+  for (const auto& entry : color_source_pool_) {
+    if (*entry == *source) {
+      return entry;
+    }
+  }
+  std::shared_ptr<DlColorSource> shared = source->shared();
+  if (color_source_pool_.size() < kMaxInternedAttributes) {
+    color_source_pool_.push_back(shared);
+  }
+  return shared;
+}
+std::shared_ptr<DlImageFilter> DisplayListBuilder::InternImageFilter(
+    const DlImageFilter* filter) {
+  for (const auto& entry : image_filter_pool_) {
+    if (*entry == *filter) {
+      return entry;
+    }
+  }
+  std::shared_ptr<DlImageFilter> shared = filter->shared();
+  if (image_filter_pool_.size() < kMaxInternedAttributes) {
+    image_filter_pool_.push_back(shared);
+  }
+  return shared;
+}
 void DisplayListBuilder::onSetColorSource(const DlColorSource* source) {
   if (source == nullptr) {
     current_.setColorSource(nullptr);
@@ -156,33 +183,14 @@ void DisplayListBuilder::onSetColorSource(const DlColorSource* source) {
         Push<SetImageColorSourceOp>(0, 0, image_source);
         break;
       }
-      case DlColorSourceType::kLinearGradient: {
-        const DlLinearGradientColorSource* linear = source->asLinearGradient();
-        FML_DCHECK(linear);
-        void* pod = Push<SetPodColorSourceOp>(linear->size(), 0);
-        new (pod) DlLinearGradientColorSource(linear);
-        break;
-      }
-      case DlColorSourceType::kRadialGradient: {
-        const DlRadialGradientColorSource* radial = source->asRadialGradient();
-        FML_DCHECK(radial);
-        void* pod = Push<SetPodColorSourceOp>(radial->size(), 0);
-        new (pod) DlRadialGradientColorSource(radial);
-        break;
-      }
-      case DlColorSourceType::kConicalGradient: {
-        const DlConicalGradientColorSource* conical =
-            source->asConicalGradient();
-        FML_DCHECK(conical);
-        void* pod = Push<SetPodColorSourceOp>(conical->size(), 0);
-        new (pod) DlConicalGradientColorSource(conical);
-        break;
-      }
+      case DlColorSourceType::kLinearGradient:
+      case DlColorSourceType::kRadialGradient:
+      case DlColorSourceType::kConicalGradient:
       case DlColorSourceType::kSweepGradient: {
-        const DlSweepGradientColorSource* sweep = source->asSweepGradient();
-        FML_DCHECK(sweep);
-        void* pod = Push<SetPodColorSourceOp>(sweep->size(), 0);
-        new (pod) DlSweepGradientColorSource(sweep);
+        // Gradient payloads carry stop arrays that are often referenced by
+        // many ops in one list; record a shared reference to an interned
+        // instance instead of embedding a copy of the payload in every op.
+        Push<SetSharedColorSourceOp>(0, 0, InternColorSource(source));
         break;
       }
       case DlColorSourceType::kRuntimeEffect: {
@@ -235,7 +243,7 @@ void DisplayListBuilder::onSetImageFilter(const DlImageFilter* filter) {
       case DlImageFilterType::kComposeFilter:
       case DlImageFilterType::kLocalMatrixFilter:
       case DlImageFilterType::kColorFilter: {
-        Push<SetSharedImageFilterOp>(0, 0, filter);
+        Push<SetSharedImageFilterOp>(0, 0, InternImageFilter(filter));
         break;
       }
       case DlImageFilterType::kUnknown: {
@@ -459,7 +467,7 @@ void DisplayListBuilder::restore() {
         // Once built, the DisplayList records must remain read only to
         // ensure consistency of rendering and |Equals()| behavior.
         SaveLayerOp* op = reinterpret_cast<SaveLayerOp*>(
-            storage_.get() + layer_info.save_layer_offset);
+            storage_.At(layer_info.save_layer_offset));
         op->options = op->options.with_can_distribute_opacity();
       }
     } else {
@@ -483,7 +491,7 @@ void DisplayListBuilder::saveLayer(const SkRect* bounds,
                                    const SaveLayerOptions in_options,
                                    const DlImageFilter* backdrop) {
   SaveLayerOptions options = in_options.without_optimizations();
-  size_t save_layer_offset = used_;
+  size_t save_layer_offset = storage_.used();
   if (backdrop) {
     bounds  //
         ? Push<SaveLayerBackdropBoundsOp>(0, 1, *bounds, options, backdrop)
@@ -523,7 +531,15 @@ void DisplayListBuilder::translate(SkScalar tx, SkScalar ty) {
   if (SkScalarIsFinite(tx) && SkScalarIsFinite(ty) &&
       (tx != 0.0 || ty != 0.0)) {
     checkForDeferredSave();
-    Push<TranslateOp>(0, 1, tx, ty);
+    if (last_op_ != nullptr && last_op_type_ == DisplayListOpType::kTranslate) {
+      // Merge this translate into the one just recorded rather than
+      // paying to dispatch both on every replay of the list.
+      TranslateOp* op = reinterpret_cast<TranslateOp*>(last_op_);
+      op->tx += tx;
+      op->ty += ty;
+    } else {
+      Push<TranslateOp>(0, 1, tx, ty);
+    }
     current_layer_->matrix.preTranslate(tx, ty);
   }
 }
@@ -531,7 +547,15 @@ void DisplayListBuilder::scale(SkScalar sx, SkScalar sy) {
   if (SkScalarIsFinite(sx) && SkScalarIsFinite(sy) &&
       (sx != 1.0 || sy != 1.0)) {
     checkForDeferredSave();
-    Push<ScaleOp>(0, 1, sx, sy);
+    if (last_op_ != nullptr && last_op_type_ == DisplayListOpType::kScale) {
+      // Merge this scale into the one just recorded rather than paying
+      // to dispatch both on every replay of the list.
+      ScaleOp* op = reinterpret_cast<ScaleOp*>(last_op_);
+      op->sx *= sx;
+      op->sy *= sy;
+    } else {
+      Push<ScaleOp>(0, 1, sx, sy);
+    }
     current_layer_->matrix.preScale(sx, sy);
   }
 }
@@ -627,13 +651,26 @@ void DisplayListBuilder::clipRect(const SkRect& rect,
   if (!rect.isFinite()) {
     return;
   }
-  checkForDeferredSave();
   switch (clip_op) {
-    case SkClipOp::kIntersect:
+    case SkClipOp::kIntersect: {
+      // Elide clips that cannot tighten the current clip so they do not
+      // cost dispatch time on every replay of the list. The mapped rect
+      // only describes the exact clip region when the transform keeps
+      // rects as rects; otherwise it is a loose bounds and proves
+      // nothing. An empty current clip fails |contains| and so keeps
+      // recording clips, which is harmless.
+      SkMatrix matrix = getTransform();
+      if (matrix.rectStaysRect() &&
+          matrix.mapRect(rect).contains(current_layer_->clip_bounds)) {
+        return;
+      }
+      checkForDeferredSave();
       Push<ClipIntersectRectOp>(0, 1, rect, is_aa);
       intersect(rect);
       break;
+    }
     case SkClipOp::kDifference:
+      checkForDeferredSave();
       Push<ClipDifferenceRectOp>(0, 1, rect, is_aa);
       break;
   }
@@ -746,8 +783,38 @@ void DisplayListBuilder::drawLine(const SkPoint& p0,
   setAttributesFromDlPaint(paint, DisplayListOpFlags::kDrawLineFlags);
   drawLine(p0, p1);
 }
+// True if every coordinate of the rect is a whole number representable
+// in an int16_t, allowing the compact 16-bit op form to record it
+// losslessly.
+static bool CanUseRect16(const SkRect& rect) {
+  for (SkScalar value : {rect.fLeft, rect.fTop, rect.fRight, rect.fBottom}) {
+    int16_t quantized = static_cast<int16_t>(SkScalarTruncToInt(value));
+    if (value != static_cast<SkScalar>(quantized)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void DisplayListBuilder::drawRect(const SkRect& rect) {
-  Push<DrawRectOp>(0, 1, rect);
+  if (last_op_ != nullptr && last_op_type_ == DisplayListOpType::kSetColor &&
+      storage_.ExtendLast(SkAlignPtr(sizeof(SetColorDrawRectOp)) -
+                          SkAlignPtr(sizeof(SetColorOp)))) {
+    // Rewrite the color change just recorded into the fused form rather
+    // than paying a second op header and dispatch for this common pair.
+    SetColorOp* color_op = reinterpret_cast<SetColorOp*>(last_op_);
+    const DlColor color = color_op->color;
+    auto* op = new (color_op) SetColorDrawRectOp(color, rect);
+    op->type = SetColorDrawRectOp::kType;
+    op->size = SkAlignPtr(sizeof(SetColorDrawRectOp));
+    op_count_ += 1;
+    render_op_count_ += 1;
+    last_op_type_ = SetColorDrawRectOp::kType;
+  } else if (CanUseRect16(rect)) {
+    Push<DrawRect16Op>(0, 1, rect);
+  } else {
+    Push<DrawRectOp>(0, 1, rect);
+  }
   CheckLayerOpacityCompatibility();
 }
 void DisplayListBuilder::drawRect(const SkRect& rect, const DlPaint& paint) {
@@ -755,7 +822,11 @@ void DisplayListBuilder::drawRect(const SkRect& rect, const DlPaint& paint) {
   drawRect(rect);
 }
 void DisplayListBuilder::drawOval(const SkRect& bounds) {
-  Push<DrawOvalOp>(0, 1, bounds);
+  if (CanUseRect16(bounds)) {
+    Push<DrawOval16Op>(0, 1, bounds);
+  } else {
+    Push<DrawOvalOp>(0, 1, bounds);
+  }
   CheckLayerOpacityCompatibility();
 }
 void DisplayListBuilder::drawOval(const SkRect& bounds, const DlPaint& paint) {
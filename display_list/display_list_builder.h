@@ -14,6 +14,7 @@
 #include "flutter/display_list/display_list_paint.h"
 #include "flutter/display_list/display_list_path_effect.h"
 #include "flutter/display_list/display_list_sampling_options.h"
+#include "flutter/display_list/display_list_storage.h"
 #include "flutter/display_list/types.h"
 #include "flutter/fml/macros.h"
 
@@ -347,13 +348,27 @@ class DisplayListBuilder final : public virtual Dispatcher,
 
   sk_sp<DisplayList> Build();
 
+  // The number of rendering ops recorded so far. Unlike the total op
+  // count this excludes attribute, clip, transform and layer structure
+  // records, so a non-zero value means replaying the recording will
+  // actually emit content. Embedders use this to decide whether an
+  // overlay recording needs compositing at all without re-dispatching
+  // the op stream.
+  int render_op_count() const { return render_op_count_; }
+
  private:
   void checkForDeferredSave();
 
-  SkAutoTMalloc<uint8_t> storage_;
-  size_t used_ = 0;
-  size_t allocated_ = 0;
+  DisplayListStorage storage_;
   int op_count_ = 0;
+  int render_op_count_ = 0;
+
+  // Address and type of the most recently pushed op record, tracked for
+  // the record-time peephole merges in |translate| and |scale|. The
+  // address stays valid because the chunked storage never reallocates
+  // recorded ops.
+  void* last_op_ = nullptr;
+  DisplayListOpType last_op_type_ = DisplayListOpType::kSave;
 
   // bytes and ops from |drawPicture| and |drawDisplayList|
   size_t nested_bytes_ = 0;
@@ -510,6 +525,23 @@ class DisplayListBuilder final : public virtual Dispatcher,
   void onSetMaskFilter(const DlMaskFilter* filter);
   void onSetMaskBlurFilter(SkBlurStyle style, SkScalar sigma);
 
+  // Upper bound on the number of distinct attribute payloads remembered
+  // per pool; a list with more distinct payloads than this records the
+  // overflow without deduplication.
+  static constexpr size_t kMaxInternedAttributes = 64;
+
+  // Return a shared instance equal to the given attribute from the
+  // interning pool, adding a copy of it to the pool if no equal instance
+  // has been recorded yet. Many ops in one list frequently reference a
+  // single heavyweight attribute (e.g. one gradient shared by hundreds of
+  // buttons); interning stores the payload once and lets every op record
+  // just a shared reference.
+  std::shared_ptr<DlColorSource> InternColorSource(const DlColorSource* source);
+  std::shared_ptr<DlImageFilter> InternImageFilter(const DlImageFilter* filter);
+
+  std::vector<std::shared_ptr<DlColorSource>> color_source_pool_;
+  std::vector<std::shared_ptr<DlImageFilter>> image_filter_pool_;
+
   DlPaint current_;
   // If |current_blender_| is set then ignore |current_.getBlendMode()|
   sk_sp<SkBlender> current_blender_;
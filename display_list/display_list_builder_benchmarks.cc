@@ -2,7 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "flutter/benchmarking/allocation_counter.h"
 #include "flutter/benchmarking/benchmarking.h"
+#include "flutter/benchmarking/perf_counters.h"
 #include "flutter/display_list/display_list_test_utils.h"
 
 namespace flutter {
@@ -27,9 +29,47 @@ static void InvokeAllRenderingOps(DisplayListBuilder& builder) {
   }
 }
 
+// Samples the process allocation counters at construction and reports
+// memory behavior alongside the timing results: heap allocations and
+// heap bytes per iteration (builder churn), the encoded size of the
+// resulting DisplayList, and the average encoded bytes per op. Time
+// regressions in this suite are usually accompanied or preceded by
+// regressions in one of these.
+struct MemoryStats {
+  uint64_t start_allocation_count =
+      benchmarking::AllocationCounter::allocation_count();
+  uint64_t start_allocation_bytes =
+      benchmarking::AllocationCounter::allocation_bytes();
+  size_t list_bytes = 0;
+  unsigned int list_op_count = 0;
+
+  void Sample(const DisplayList& display_list) {
+    list_bytes = display_list.bytes();
+    list_op_count = display_list.op_count();
+  }
+
+  void Report(benchmark::State& state) const {
+    state.counters["AllocCount"] = benchmark::Counter(
+        benchmarking::AllocationCounter::allocation_count() -
+            start_allocation_count,
+        benchmark::Counter::kAvgIterations);
+    state.counters["AllocBytes"] = benchmark::Counter(
+        benchmarking::AllocationCounter::allocation_bytes() -
+            start_allocation_bytes,
+        benchmark::Counter::kAvgIterations);
+    state.counters["DisplayListBytes"] = benchmark::Counter(list_bytes);
+    if (list_op_count > 0) {
+      state.counters["BytesPerOp"] = benchmark::Counter(
+          static_cast<double>(list_bytes) / list_op_count);
+    }
+  }
+};
+
 static void Complete(DisplayListBuilder& builder,
-                     DisplayListBuilderBenchmarkType type) {
+                     DisplayListBuilderBenchmarkType type,
+                     MemoryStats& stats) {
   auto display_list = builder.Build();
+  stats.Sample(*display_list);
   switch (type) {
     case DisplayListBuilderBenchmarkType::kBounds:
       display_list->bounds();
@@ -50,52 +90,66 @@ static void Complete(DisplayListBuilder& builder,
 
 static void BM_DisplayListBuilderDefault(benchmark::State& state,
                                          DisplayListBuilderBenchmarkType type) {
+  MemoryStats stats;
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     DisplayListBuilder builder;
     InvokeAllRenderingOps(builder);
-    Complete(builder, type);
+    Complete(builder, type, stats);
   }
+  stats.Report(state);
 }
 
 static void BM_DisplayListBuilderWithScaleAndTranslate(
     benchmark::State& state,
     DisplayListBuilderBenchmarkType type) {
+  MemoryStats stats;
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     DisplayListBuilder builder;
     builder.scale(3.5, 3.5);
     builder.translate(10.3, 6.9);
     InvokeAllRenderingOps(builder);
-    Complete(builder, type);
+    Complete(builder, type, stats);
   }
+  stats.Report(state);
 }
 
 static void BM_DisplayListBuilderWithPerspective(
     benchmark::State& state,
     DisplayListBuilderBenchmarkType type) {
+  MemoryStats stats;
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     DisplayListBuilder builder;
     builder.transformFullPerspective(0, 1, 0, 12, 1, 0, 0, 33, 3, 2, 5, 29, 0,
                                      0, 0, 12);
     InvokeAllRenderingOps(builder);
-    Complete(builder, type);
+    Complete(builder, type, stats);
   }
+  stats.Report(state);
 }
 
 static void BM_DisplayListBuilderWithClipRect(
     benchmark::State& state,
     DisplayListBuilderBenchmarkType type) {
   SkRect clip_bounds = SkRect::MakeLTRB(6.5, 7.3, 90.2, 85.7);
+  MemoryStats stats;
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     DisplayListBuilder builder;
     builder.clipRect(clip_bounds, SkClipOp::kIntersect, true);
     InvokeAllRenderingOps(builder);
-    Complete(builder, type);
+    Complete(builder, type, stats);
   }
+  stats.Report(state);
 }
 
 static void BM_DisplayListBuilderWithSaveLayer(
     benchmark::State& state,
     DisplayListBuilderBenchmarkType type) {
+  MemoryStats stats;
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     DisplayListBuilder builder;
     for (auto& group : allRenderingOps) {
@@ -106,8 +160,9 @@ static void BM_DisplayListBuilderWithSaveLayer(
         builder.restore();
       }
     }
-    Complete(builder, type);
+    Complete(builder, type, stats);
   }
+  stats.Report(state);
 }
 
 static void BM_DisplayListBuilderWithSaveLayerAndImageFilter(
@@ -116,6 +171,8 @@ static void BM_DisplayListBuilderWithSaveLayerAndImageFilter(
   DlPaint layer_paint;
   layer_paint.setImageFilter(&testing::kTestBlurImageFilter1);
   SkRect layer_bounds = SkRect::MakeLTRB(6.5, 7.3, 35.2, 42.7);
+  MemoryStats stats;
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     DisplayListBuilder builder;
     for (auto& group : allRenderingOps) {
@@ -126,8 +183,9 @@ static void BM_DisplayListBuilderWithSaveLayerAndImageFilter(
         builder.restore();
       }
     }
-    Complete(builder, type);
+    Complete(builder, type, stats);
   }
+  stats.Report(state);
 }
 
 BENCHMARK_CAPTURE(BM_DisplayListBuilderDefault,
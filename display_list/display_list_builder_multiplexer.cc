@@ -7,19 +7,46 @@
 namespace flutter {
 
 void DisplayListBuilderMultiplexer::addBuilder(DisplayListBuilder* builder) {
+  // Flush first so that ops recorded before this builder was registered
+  // are not delivered to it.
+  flush();
   builders_.push_back(builder);
 }
 
+DisplayListBuilder& DisplayListBuilderMultiplexer::sharedBuilder() {
+  if (!shared_builder_) {
+    shared_builder_ = sk_make_sp<DisplayListBuilder>();
+  }
+  return *shared_builder_;
+}
+
+void DisplayListBuilderMultiplexer::flush() {
+  if (!shared_builder_) {
+    return;
+  }
+  sk_sp<DisplayList> shared_ops = shared_builder_->Build();
+  if (shared_ops->op_count() == 0) {
+    return;
+  }
+  // The ops were encoded once; each builder records only a reference to
+  // the shared list.
+  for (auto* builder : builders_) {
+    builder->drawDisplayList(shared_ops);
+  }
+}
+
 void DisplayListBuilderMultiplexer::saveLayer(
     const SkRect* bounds,
     const DlPaint* paint,
     const DlImageFilter* backdrop_filter) {
+  flush();
   for (auto* builder : builders_) {
     builder->saveLayer(bounds, paint, backdrop_filter);
   }
 }
 
 void DisplayListBuilderMultiplexer::restore() {
+  flush();
   for (auto* builder : builders_) {
     builder->restore();
   }
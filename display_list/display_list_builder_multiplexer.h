@@ -15,12 +15,33 @@ namespace flutter {
 /// A class that mutiplexes some of the DisplayListBuilder calls to multiple
 /// other builders. For now it only implements saveLayer and restore as those
 /// are needed to create a replacement for PaintContext::internal_nodes_canvas.
+///
+/// Draw content is not forwarded call by call. Instead, callers record it
+/// once into the shared builder returned by |sharedBuilder| and the
+/// multiplexer delivers the accumulated ops to every registered builder as
+/// a single drawDisplayList reference to one shared, ref-counted list. The
+/// record-time cost of N-way multiplexing is therefore one encoding of the
+/// ops plus one small reference op per builder, instead of N full copies.
+///
+/// saveLayer and restore are still forwarded to each builder individually;
+/// their layer and bounds bookkeeping is inherently per builder. Both
+/// implicitly flush the shared ops recorded so far, as does |flush|, which
+/// must be called before the registered builders are built.
 class DisplayListBuilderMultiplexer {
  public:
   DisplayListBuilderMultiplexer() = default;
 
   void addBuilder(DisplayListBuilder* builder);
 
+  /// The builder that draw content should be recorded into. The ops are
+  /// encoded once and shared by reference with every registered builder
+  /// at the next flush.
+  DisplayListBuilder& sharedBuilder();
+
+  /// Delivers the ops recorded into the shared builder since the last
+  /// flush to every registered builder.
+  void flush();
+
   void saveLayer(const SkRect* bounds,
                  const DlPaint* paint,
                  const DlImageFilter* backdrop_filter = nullptr);
@@ -29,6 +50,7 @@ class DisplayListBuilderMultiplexer {
 
  private:
   std::vector<DisplayListBuilder*> builders_;
+  sk_sp<DisplayListBuilder> shared_builder_;
 };
 
 }  // namespace flutter
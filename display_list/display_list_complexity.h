@@ -6,6 +6,7 @@
 #define FLUTTER_FLOW_DISPLAY_LIST_COMPLEXITY_H_
 
 #include "flutter/display_list/display_list.h"
+#include "flutter/display_list/display_list_complexity_calibration.h"
 #include "flutter/display_list/types.h"
 #include "third_party/skia/include/gpu/GrTypes.h"
 
@@ -25,12 +26,32 @@ class DisplayListComplexityCalculator {
   // cacheability for this particular ComplexityCalculator
   virtual bool ShouldBeCached(unsigned int complexity_score) = 0;
 
+  // Returns the number of accesses a display list with the given complexity
+  // score should accumulate before it is admitted to the raster cache, given
+  // the cache's default access threshold. Calculators that can estimate
+  // rasterization cost scale the threshold down as the score rises, reaching
+  // zero (cache as soon as seen) for sufficiently expensive display lists.
+  // Scores below the |ShouldBeCached| floor never reach this point.
+  //
+  // The default implementation leaves the threshold unscaled.
+  virtual int CacheAccessThreshold(unsigned int complexity_score,
+                                   int default_threshold) {
+    return default_threshold;
+  }
+
   // Sets a ceiling for the complexity score being calculated. By default
   // this is the largest number representable by an unsigned int.
   //
   // This setting has no effect on non-accumulator based scorers such as
   // the Naive calculator.
   virtual void SetComplexityCeiling(unsigned int ceiling) = 0;
+
+  // Installs a device calibration that rescales the calculator's
+  // per-op-class costs; see DisplayListComplexityCalibration. A null
+  // calibration restores the hardcoded tables. Ignored by scorers that
+  // have no cost tables, such as the Naive calculator.
+  virtual void SetCalibration(
+      std::shared_ptr<const DisplayListComplexityCalibration> calibration) {}
 };
 
 class DisplayListNaiveComplexityCalculator
@@ -0,0 +1,252 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_complexity_calibration.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/display_list/display_list_complexity.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/time/time_point.h"
+
+#include "third_party/skia/include/core/SkSurface.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr float kMinScale = 1.0f / 16.0f;
+constexpr float kMaxScale = 16.0f;
+
+// Serialized as a signature, a version, and one float per op class.
+constexpr uint32_t kCalibrationSignature = 0xD15C0CA1;
+constexpr uint32_t kCalibrationVersion = 1;
+
+// The class the corrections are anchored on; its kernel must be cheap,
+// stable and representative of plain geometry throughput.
+constexpr auto kAnchorClass = DisplayListComplexityOpClass::kRect;
+
+// Number of ops recorded into each kernel list and number of times each
+// list is replayed while timing. Sized so the whole suite stays in the
+// tens of milliseconds on a mid-range device.
+constexpr int kKernelOpCount = 50;
+constexpr int kKernelRepeatCount = 10;
+
+// The kernels mirror the canonical shapes exercised by the benchmarks in
+// display_list_benchmarks.cc, which the reference tables were originally
+// fitted against. They are re-recorded here because the benchmark target
+// is not part of the engine. Classes that would need external assets to
+// draw (images, text) have no kernel and keep their reference scale.
+sk_sp<DisplayList> MakeKernel(DisplayListComplexityOpClass op_class) {
+  DisplayListBuilder builder;
+  for (int i = 0; i < kKernelOpCount; i++) {
+    SkScalar offset = (i % 10) * 10.0f;
+    switch (op_class) {
+      case DisplayListComplexityOpClass::kLine:
+        builder.drawLine({offset, 0}, {offset + 100, 300});
+        break;
+      case DisplayListComplexityOpClass::kRect:
+        builder.drawRect(SkRect::MakeXYWH(offset, offset, 200, 200));
+        break;
+      case DisplayListComplexityOpClass::kOval:
+        builder.drawOval(SkRect::MakeXYWH(offset, offset, 200, 150));
+        break;
+      case DisplayListComplexityOpClass::kCircle:
+        builder.drawCircle({offset + 100, 150}, 100);
+        break;
+      case DisplayListComplexityOpClass::kRRect:
+        builder.drawRRect(SkRRect::MakeRectXY(
+            SkRect::MakeXYWH(offset, offset, 200, 200), 16, 16));
+        break;
+      case DisplayListComplexityOpClass::kDRRect: {
+        SkRect rect = SkRect::MakeXYWH(offset, offset, 200, 200);
+        builder.drawDRRect(SkRRect::MakeRectXY(rect, 16, 16),
+                           SkRRect::MakeRectXY(rect.makeInset(40, 40), 8, 8));
+        break;
+      }
+      case DisplayListComplexityOpClass::kPath: {
+        SkPath path;
+        path.moveTo(offset, 0);
+        for (int segment = 0; segment < 10; segment++) {
+          path.cubicTo(offset + segment * 20, 50, offset + segment * 20 + 10,
+                       150, offset + segment * 20 + 20, 100);
+        }
+        builder.setStyle(DlDrawStyle::kStroke);
+        builder.setStrokeWidth(4);
+        builder.drawPath(path);
+        builder.setStyle(DlDrawStyle::kFill);
+        break;
+      }
+      case DisplayListComplexityOpClass::kArc:
+        builder.drawArc(SkRect::MakeXYWH(offset, offset, 200, 200), 15, 270,
+                        false);
+        break;
+      case DisplayListComplexityOpClass::kPoints: {
+        SkPoint points[32];
+        for (size_t p = 0; p < 32; p++) {
+          points[p] = SkPoint::Make(offset + p * 8, (p % 2) * 100.0f);
+        }
+        builder.drawPoints(SkCanvas::kPoints_PointMode, 32, points);
+        break;
+      }
+      case DisplayListComplexityOpClass::kVertices: {
+        SkPoint vertices[6] = {{offset, 0},        {offset + 100, 0},
+                               {offset + 50, 100}, {offset + 100, 0},
+                               {offset + 150, 90}, {offset + 50, 100}};
+        builder.drawVertices(
+            DlVertices::Make(DlVertexMode::kTriangles, 6, vertices, nullptr,
+                             nullptr)
+                .get(),
+            DlBlendMode::kSrcOver);
+        break;
+      }
+      case DisplayListComplexityOpClass::kShadow: {
+        SkPath path;
+        path.addRRect(SkRRect::MakeRectXY(
+            SkRect::MakeXYWH(offset, offset, 200, 100), 12, 12));
+        builder.drawShadow(path, DlColor::kBlack(), 4.0f, false, 1.0f);
+        break;
+      }
+      case DisplayListComplexityOpClass::kSaveLayer: {
+        SkRect bounds = SkRect::MakeXYWH(offset, offset, 150, 150);
+        builder.saveLayer(&bounds, /*renders_with_attributes=*/true);
+        builder.drawRect(bounds);
+        builder.restore();
+        break;
+      }
+      case DisplayListComplexityOpClass::kImage:
+      case DisplayListComplexityOpClass::kTextBlob:
+      case DisplayListComplexityOpClass::kOther:
+      case DisplayListComplexityOpClass::kClassCount:
+        return nullptr;
+    }
+  }
+  return builder.Build();
+}
+
+uint64_t TimeKernel(SkSurface* surface, const sk_sp<DisplayList>& kernel) {
+  SkCanvas* canvas = surface->getCanvas();
+  // One untimed replay to warm caches and compiled shaders.
+  kernel->RenderTo(canvas);
+  surface->flushAndSubmit(true);
+  fml::TimePoint start = fml::TimePoint::Now();
+  for (int i = 0; i < kKernelRepeatCount; i++) {
+    kernel->RenderTo(canvas);
+  }
+  surface->flushAndSubmit(true);
+  return (fml::TimePoint::Now() - start).ToNanoseconds();
+}
+
+}  // namespace
+
+DisplayListComplexityCalibration::DisplayListComplexityCalibration() {
+  std::fill(scales_, scales_ + kClassCount, 1.0f);
+}
+
+void DisplayListComplexityCalibration::SetScale(
+    DisplayListComplexityOpClass op_class,
+    float scale) {
+  scales_[static_cast<size_t>(op_class)] =
+      std::clamp(scale, kMinScale, kMaxScale);
+}
+
+unsigned int DisplayListComplexityCalibration::ScaleComplexity(
+    DisplayListComplexityOpClass op_class,
+    unsigned int complexity) const {
+  float scaled = complexity * scales_[static_cast<size_t>(op_class)];
+  if (scaled >= std::numeric_limits<unsigned int>::max()) {
+    return std::numeric_limits<unsigned int>::max();
+  }
+  return static_cast<unsigned int>(scaled);
+}
+
+sk_sp<SkData> DisplayListComplexityCalibration::Serialize() const {
+  size_t size = 2 * sizeof(uint32_t) + kClassCount * sizeof(float);
+  sk_sp<SkData> data = SkData::MakeUninitialized(size);
+  uint32_t* header = static_cast<uint32_t*>(data->writable_data());
+  header[0] = kCalibrationSignature;
+  header[1] = kCalibrationVersion;
+  memcpy(header + 2, scales_, kClassCount * sizeof(float));
+  return data;
+}
+
+std::shared_ptr<DisplayListComplexityCalibration>
+DisplayListComplexityCalibration::Deserialize(const SkData* data) {
+  if (data == nullptr ||
+      data->size() != 2 * sizeof(uint32_t) + kClassCount * sizeof(float)) {
+    return nullptr;
+  }
+  const uint32_t* header = static_cast<const uint32_t*>(data->data());
+  if (header[0] != kCalibrationSignature || header[1] != kCalibrationVersion) {
+    return nullptr;
+  }
+  auto calibration = std::make_shared<DisplayListComplexityCalibration>();
+  const float* scales = reinterpret_cast<const float*>(header + 2);
+  for (size_t i = 0; i < kClassCount; i++) {
+    calibration->SetScale(static_cast<DisplayListComplexityOpClass>(i),
+                          scales[i]);
+  }
+  return calibration;
+}
+
+sk_sp<SkData> DisplayListComplexityCalibration::PersistentCacheKey() {
+  static const char kKey[] = "DisplayListComplexityCalibration.v1";
+  return SkData::MakeWithCopy(kKey, sizeof(kKey));
+}
+
+std::shared_ptr<DisplayListComplexityCalibration>
+DisplayListComplexityCalibration::Fit(
+    const std::vector<uint64_t>& measured_nanos,
+    const std::vector<uint64_t>& predicted_scores) {
+  if (measured_nanos.size() != kClassCount ||
+      predicted_scores.size() != kClassCount) {
+    return nullptr;
+  }
+  size_t anchor = static_cast<size_t>(kAnchorClass);
+  if (measured_nanos[anchor] == 0 || predicted_scores[anchor] == 0) {
+    return nullptr;
+  }
+  auto calibration = std::make_shared<DisplayListComplexityCalibration>();
+  for (size_t i = 0; i < kClassCount; i++) {
+    if (i == anchor || measured_nanos[i] == 0 || predicted_scores[i] == 0) {
+      continue;
+    }
+    // How much more (or less) expensive this class is relative to the
+    // anchor on this device, divided by how much more expensive the
+    // calculator already believes it to be.
+    float measured_ratio = static_cast<float>(measured_nanos[i]) /
+                           static_cast<float>(measured_nanos[anchor]);
+    float predicted_ratio = static_cast<float>(predicted_scores[i]) /
+                            static_cast<float>(predicted_scores[anchor]);
+    calibration->SetScale(static_cast<DisplayListComplexityOpClass>(i),
+                          measured_ratio / predicted_ratio);
+  }
+  return calibration;
+}
+
+std::shared_ptr<DisplayListComplexityCalibration>
+DisplayListComplexityCalibration::Calibrate(
+    SkSurface* surface,
+    DisplayListComplexityCalculator* calculator) {
+  if (surface == nullptr || calculator == nullptr) {
+    return nullptr;
+  }
+  std::vector<uint64_t> measured_nanos(kClassCount, 0);
+  std::vector<uint64_t> predicted_scores(kClassCount, 0);
+  for (size_t i = 0; i < kClassCount; i++) {
+    sk_sp<DisplayList> kernel =
+        MakeKernel(static_cast<DisplayListComplexityOpClass>(i));
+    if (!kernel) {
+      continue;
+    }
+    measured_nanos[i] = TimeKernel(surface, kernel);
+    predicted_scores[i] = calculator->Compute(kernel.get());
+  }
+  return Fit(measured_nanos, predicted_scores);
+}
+
+}  // namespace flutter
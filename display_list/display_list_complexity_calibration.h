@@ -0,0 +1,107 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_COMPLEXITY_CALIBRATION_H_
+#define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_COMPLEXITY_CALIBRATION_H_
+
+#include <memory>
+#include <vector>
+
+#include "flutter/display_list/types.h"
+#include "third_party/skia/include/core/SkData.h"
+
+class SkSurface;
+
+namespace flutter {
+
+class DisplayListComplexityCalculator;
+
+// The classes of draw ops that the complexity calculators can score and
+// that calibration can rescale independently. Ops that do not fit one of
+// the specific classes score under kOther, which calibration leaves
+// untouched.
+enum class DisplayListComplexityOpClass : size_t {
+  kLine,
+  kRect,
+  kOval,
+  kCircle,
+  kRRect,
+  kDRRect,
+  kPath,
+  kArc,
+  kPoints,
+  kVertices,
+  kImage,
+  kTextBlob,
+  kShadow,
+  kSaveLayer,
+  kOther,
+
+  kClassCount,
+};
+
+// Per-op-class scale factors that correct a complexity calculator's
+// hardcoded cost tables for the device actually running.
+//
+// The tables in display_list_complexity_gl.cc and _metal.cc were fitted
+// on two reference devices, and on other GPUs the relative cost of op
+// classes can shift enough to misrank workloads (for example blur heavy
+// versus path-stroke heavy scenes), corrupting raster cache admission.
+// A calibration measures a short microbenchmark kernel per op class on
+// the device, compares the measured cost ratios against the ratios the
+// calculator predicts for the same kernels, and stores the correction
+// for each class. Scores keep their absolute meaning (roughly 200,000
+// per millisecond) because the corrections are anchored on the rect
+// kernel rather than applied as absolute timings.
+class DisplayListComplexityCalibration {
+ public:
+  static constexpr size_t kClassCount =
+      static_cast<size_t>(DisplayListComplexityOpClass::kClassCount);
+
+  // All scales start at 1, leaving the calculator's scores unchanged.
+  DisplayListComplexityCalibration();
+
+  float scale(DisplayListComplexityOpClass op_class) const {
+    return scales_[static_cast<size_t>(op_class)];
+  }
+
+  // Scales are clamped to [1/16, 16]; a measurement noisy enough to fall
+  // outside that range would do more damage than a stale table.
+  void SetScale(DisplayListComplexityOpClass op_class, float scale);
+
+  // Applies the class scale to a raw complexity value, saturating at the
+  // largest representable score.
+  unsigned int ScaleComplexity(DisplayListComplexityOpClass op_class,
+                               unsigned int complexity) const;
+
+  // Serialization for PersistentCache storage.
+  sk_sp<SkData> Serialize() const;
+  static std::shared_ptr<DisplayListComplexityCalibration> Deserialize(
+      const SkData* data);
+
+  // The PersistentCache key under which fitted calibrations are stored.
+  static sk_sp<SkData> PersistentCacheKey();
+
+  // Fits per-class scales from measured kernel timings and the scores the
+  // calculator assigns to the same kernels. Classes with a zero in either
+  // vector keep a scale of 1. Both vectors are indexed by op class.
+  static std::shared_ptr<DisplayListComplexityCalibration> Fit(
+      const std::vector<uint64_t>& measured_nanos,
+      const std::vector<uint64_t>& predicted_scores);
+
+  // Runs the microbenchmark kernels against |surface|, scores the same
+  // kernels with |calculator| and returns the fitted calibration, or
+  // nullptr if the measurements are unusable. Takes tens of milliseconds;
+  // intended to run once on first launch with the result persisted.
+  static std::shared_ptr<DisplayListComplexityCalibration> Calibrate(
+      SkSurface* surface,
+      DisplayListComplexityCalculator* calculator);
+
+ private:
+  float scales_[kClassCount];
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DISPLAY_LIST_COMPLEXITY_CALIBRATION_H_
@@ -45,7 +45,10 @@ unsigned int DisplayListGLComplexityCalculator::GLHelper::BatchedComplexity() {
     draw_text_blob_complexity = (draw_text_blob_count_ + 60) * 2500 / 3;
   }
 
-  return save_layer_complexity + draw_text_blob_complexity;
+  return Calibrated(DisplayListComplexityOpClass::kSaveLayer,
+                    save_layer_complexity) +
+         Calibrated(DisplayListComplexityOpClass::kTextBlob,
+                    draw_text_blob_complexity);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::saveLayer(
@@ -97,7 +100,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawLine(const SkPoint& p0,
   unsigned int complexity =
       ((distance + 520) / 2) * non_hairline_penalty * aa_penalty;
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kLine);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawRect(const SkRect& rect) {
@@ -146,7 +150,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawRect(const SkRect& rect) {
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kRect);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawOval(
@@ -185,7 +190,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawOval(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kOval);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawCircle(
@@ -223,7 +229,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawCircle(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kCircle);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawRRect(
@@ -268,7 +275,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawRRect(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kRRect);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawDRRect(
@@ -319,7 +327,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawDRRect(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kDRRect);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawPath(const SkPath& path) {
@@ -358,7 +367,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawPath(const SkPath& path) {
   complexity += CalculatePathComplexity(path, line_verb_cost, quad_verb_cost,
                                         conic_verb_cost, cubic_verb_cost);
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kPath);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawArc(
@@ -410,7 +420,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawArc(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kArc);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawPoints(
@@ -480,7 +491,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawPoints(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kPoints);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawSkVertices(
@@ -508,7 +520,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawSkVertices(
   // c = 1
   unsigned int complexity = (approximate_vertex_count + 1600) * 250 / 2;
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kVertices);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawVertices(
@@ -527,7 +540,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawVertices(
   // c = 1
   unsigned int complexity = (vertices->vertex_count() + 1600) * 250 / 2;
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kVertices);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawImage(
@@ -571,7 +585,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawImage(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kImage);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::ImageRect(
@@ -609,7 +624,8 @@ void DisplayListGLComplexityCalculator::GLHelper::ImageRect(
     complexity = length * 200 / 11;
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kImage);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawImageNine(
@@ -634,7 +650,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawImageNine(
     complexity *= 1.4f;
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kImage);
 }
 
 void DisplayListGLComplexityCalculator::GLHelper::drawDisplayList(
@@ -643,6 +660,7 @@ void DisplayListGLComplexityCalculator::GLHelper::drawDisplayList(
     return;
   }
   GLHelper helper(Ceiling() - CurrentComplexityScore());
+  helper.SetCalibration(calibration());
   display_list->Dispatch(helper);
   AccumulateComplexity(helper.ComplexityScore());
 }
@@ -699,7 +717,8 @@ void DisplayListGLComplexityCalculator::GLHelper::drawShadow(
   unsigned int complexity = CalculatePathComplexity(
       path, line_verb_cost, quad_verb_cost, conic_verb_cost, cubic_verb_cost);
 
-  AccumulateComplexity(complexity * occluder_penalty);
+  AccumulateComplexity(complexity * occluder_penalty,
+                       DisplayListComplexityOpClass::kShadow);
 }
 
 }  // namespace flutter
@@ -7,6 +7,7 @@
 
 #include "flutter/display_list/display_list_blend_mode.h"
 #include "flutter/display_list/display_list_complexity.h"
+#include "flutter/display_list/display_list_complexity_calibration.h"
 #include "flutter/display_list/display_list_dispatcher.h"
 #include "flutter/display_list/display_list_utils.h"
 
@@ -101,6 +102,13 @@ class ComplexityCalculatorHelper
 
   virtual ~ComplexityCalculatorHelper() = default;
 
+  // Installs the device calibration that rescales per-op-class costs.
+  // May be null, in which case the hardcoded tables apply unchanged.
+  void SetCalibration(
+      std::shared_ptr<const DisplayListComplexityCalibration> calibration) {
+    calibration_ = std::move(calibration);
+  }
+
   void setDither(bool dither) override {}
   void setInvertColors(bool invert) override {}
   void setStrokeCap(DlStrokeCap cap) override {}
@@ -224,7 +232,10 @@ class ComplexityCalculatorHelper
   }
 
  protected:
-  void AccumulateComplexity(unsigned int complexity) {
+  void AccumulateComplexity(unsigned int complexity,
+                            DisplayListComplexityOpClass op_class =
+                                DisplayListComplexityOpClass::kOther) {
+    complexity = Calibrated(op_class, complexity);
     // Check to see if we will overflow by accumulating this complexity score
     if (ceiling_ - complexity_score_ < complexity) {
       is_complex_ = true;
@@ -234,6 +245,22 @@ class ComplexityCalculatorHelper
     complexity_score_ += complexity;
   }
 
+  // Applies the device calibration's scale for |op_class|, if one is
+  // installed. Used directly by |BatchedComplexity| implementations whose
+  // scores bypass |AccumulateComplexity|.
+  unsigned int Calibrated(DisplayListComplexityOpClass op_class,
+                          unsigned int complexity) {
+    return calibration_ ? calibration_->ScaleComplexity(op_class, complexity)
+                        : complexity;
+  }
+
+  // For propagating the calibration into helpers spawned for nested
+  // display lists.
+  const std::shared_ptr<const DisplayListComplexityCalibration>& calibration()
+      const {
+    return calibration_;
+  }
+
   inline bool IsAntiAliased() { return current_paint_.isAntiAlias(); }
   inline bool IsHairline() { return current_paint_.getStrokeWidth() == 0.0f; }
   inline SkPaint::Style Style() { return current_paint_.getStyle(); }
@@ -283,6 +310,8 @@ class ComplexityCalculatorHelper
  private:
   SkPaint current_paint_;
 
+  std::shared_ptr<const DisplayListComplexityCalibration> calibration_;
+
   // If we exceed the ceiling (defaults to the largest number representable
   // by unsigned int), then set the is_complex_ bool and we no longer
   // accumulate.
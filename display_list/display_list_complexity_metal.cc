@@ -59,7 +59,10 @@ DisplayListMetalComplexityCalculator::MetalHelper::BatchedComplexity() {
     draw_text_blob_complexity = (draw_text_blob_count_ + 180) * 2500 / 3;
   }
 
-  return save_layer_complexity + draw_text_blob_complexity;
+  return Calibrated(DisplayListComplexityOpClass::kSaveLayer,
+                    save_layer_complexity) +
+         Calibrated(DisplayListComplexityOpClass::kTextBlob,
+                    draw_text_blob_complexity);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::saveLayer(
@@ -108,7 +111,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawLine(
   unsigned int complexity =
       ((distance + 225) * 4 / 9) * non_hairline_penalty * aa_penalty;
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kLine);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawRect(
@@ -151,7 +155,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawRect(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kRect);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawOval(
@@ -190,7 +195,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawOval(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kOval);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawCircle(
@@ -228,7 +234,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawCircle(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kCircle);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawRRect(
@@ -264,7 +271,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawRRect(
     complexity = (area + 50000) / 625;
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kRRect);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawDRRect(
@@ -315,7 +323,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawDRRect(
     complexity = ((10 * length) + 1050) / 6;
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kDRRect);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawPath(
@@ -348,7 +357,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawPath(
       200000 + CalculatePathComplexity(path, line_verb_cost, quad_verb_cost,
                                        conic_verb_cost, cubic_verb_cost);
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kPath);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawArc(
@@ -396,7 +406,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawArc(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kArc);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawPoints(
@@ -432,7 +443,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawPoints(
       }
     }
   }
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kPoints);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawSkVertices(
@@ -460,7 +472,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawSkVertices(
   // c = 1
   unsigned int complexity = (approximate_vertex_count + 4000) * 50;
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kVertices);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawVertices(
@@ -479,7 +492,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawVertices(
   // c = 1
   unsigned int complexity = (vertices->vertex_count() + 4000) * 50;
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kVertices);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawImage(
@@ -514,7 +528,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawImage(
     complexity = complexity * multiplier + 1200;
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kImage);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::ImageRect(
@@ -560,7 +575,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::ImageRect(
     }
   }
 
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kImage);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawImageNine(
@@ -580,7 +596,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawImageNine(
   // m = 1/8000
   // c = 3
   unsigned int complexity = (area + 24000) / 20;
-  AccumulateComplexity(complexity);
+  AccumulateComplexity(complexity,
+                       DisplayListComplexityOpClass::kImage);
 }
 
 void DisplayListMetalComplexityCalculator::MetalHelper::drawDisplayList(
@@ -589,6 +606,7 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawDisplayList(
     return;
   }
   MetalHelper helper(Ceiling() - CurrentComplexityScore());
+  helper.SetCalibration(calibration());
   display_list->Dispatch(helper);
   AccumulateComplexity(helper.ComplexityScore());
 }
@@ -646,7 +664,8 @@ void DisplayListMetalComplexityCalculator::MetalHelper::drawShadow(
       0 + CalculatePathComplexity(path, line_verb_cost, quad_verb_cost,
                                   conic_verb_cost, cubic_verb_cost);
 
-  AccumulateComplexity(complexity * occluder_penalty);
+  AccumulateComplexity(complexity * occluder_penalty,
+                       DisplayListComplexityOpClass::kShadow);
 }
 
 }  // namespace flutter
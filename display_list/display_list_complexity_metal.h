@@ -16,6 +16,7 @@ class DisplayListMetalComplexityCalculator
 
   unsigned int Compute(DisplayList* display_list) override {
     MetalHelper helper(ceiling_);
+    helper.SetCalibration(calibration_);
     display_list->Dispatch(helper);
     return helper.ComplexityScore();
   }
@@ -25,10 +26,36 @@ class DisplayListMetalComplexityCalculator
     return complexity_score > 200000u;
   }
 
+  int CacheAccessThreshold(unsigned int complexity_score,
+                           int default_threshold) override {
+    // 200,000 is roughly 1ms of rasterization work. Display lists estimated
+    // at 3ms or more are cached as soon as they are seen; between the 1ms
+    // cacheability floor and 3ms the default threshold scales down linearly
+    // with the estimated cost.
+    constexpr unsigned int kCacheableScore = 200000u;
+    constexpr unsigned int kCacheImmediatelyScore = 600000u;
+    if (complexity_score >= kCacheImmediatelyScore) {
+      return 0;
+    }
+    if (complexity_score <= kCacheableScore) {
+      return default_threshold;
+    }
+    return static_cast<int>(
+        (static_cast<int64_t>(default_threshold) *
+         (kCacheImmediatelyScore - complexity_score)) /
+        (kCacheImmediatelyScore - kCacheableScore));
+  }
+
   void SetComplexityCeiling(unsigned int ceiling) override {
     ceiling_ = ceiling;
   }
 
+  void SetCalibration(
+      std::shared_ptr<const DisplayListComplexityCalibration> calibration)
+      override {
+    calibration_ = std::move(calibration);
+  }
+
  private:
   class MetalHelper : public ComplexityCalculatorHelper {
    public:
@@ -95,6 +122,7 @@ class DisplayListMetalComplexityCalculator
   static DisplayListMetalComplexityCalculator* instance_;
 
   unsigned int ceiling_;
+  std::shared_ptr<const DisplayListComplexityCalibration> calibration_;
 };
 
 }  // namespace flutter
@@ -5,12 +5,14 @@
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/display_list_builder.h"
 #include "flutter/display_list/display_list_complexity.h"
+#include "flutter/display_list/display_list_complexity_calibration.h"
 #include "flutter/display_list/display_list_complexity_gl.h"
 #include "flutter/display_list/display_list_complexity_metal.h"
 #include "flutter/display_list/display_list_sampling_options.h"
 #include "flutter/display_list/display_list_test_utils.h"
 #include "flutter/testing/testing.h"
 #include "third_party/skia/include/core/SkColor.h"
+#include "third_party/skia/include/core/SkSurface.h"
 
 namespace flutter {
 namespace testing {
@@ -61,6 +63,22 @@ TEST(DisplayListComplexity, DisplayListCeiling) {
   }
 }
 
+TEST(DisplayListComplexity, CacheAccessThresholdScalesWithCost) {
+  auto calculators = AccumulatorCalculators();
+  for (auto calculator : calculators) {
+    // At or below the cacheability floor the default threshold is unscaled.
+    ASSERT_EQ(calculator->CacheAccessThreshold(200000u, 3), 3);
+    // In between, the threshold scales down with the estimated cost.
+    ASSERT_EQ(calculator->CacheAccessThreshold(400000u, 3), 1);
+    // At or above the immediate-caching cutoff the threshold drops to zero.
+    ASSERT_EQ(calculator->CacheAccessThreshold(600000u, 3), 0);
+  }
+
+  // The naive calculator has no cost estimate and leaves the threshold alone.
+  auto naive = DisplayListNaiveComplexityCalculator::GetInstance();
+  ASSERT_EQ(naive->CacheAccessThreshold(1000000u, 3), 3);
+}
+
 TEST(DisplayListComplexity, NestedDisplayList) {
   auto display_list = GetSampleNestedDisplayList();
 
@@ -432,5 +450,106 @@ TEST(DisplayListComplexity, DrawAtlas) {
   }
 }
 
+TEST(DisplayListComplexity, CalibrationScalesScores) {
+  DisplayListBuilder builder;
+  builder.drawRect(SkRect::MakeXYWH(10, 10, 80, 80));
+  auto display_list = builder.Build();
+
+  auto calculators = AccumulatorCalculators();
+  for (auto calculator : calculators) {
+    unsigned int baseline = calculator->Compute(display_list.get());
+    ASSERT_NE(baseline, 0u);
+
+    auto calibration = std::make_shared<DisplayListComplexityCalibration>();
+    calibration->SetScale(DisplayListComplexityOpClass::kRect, 2.0f);
+    calculator->SetCalibration(calibration);
+    ASSERT_EQ(calculator->Compute(display_list.get()), baseline * 2);
+
+    // Removing the calibration restores the reference tables.
+    calculator->SetCalibration(nullptr);
+    ASSERT_EQ(calculator->Compute(display_list.get()), baseline);
+  }
+}
+
+TEST(DisplayListComplexity, CalibrationSerializeRoundTrip) {
+  DisplayListComplexityCalibration calibration;
+  calibration.SetScale(DisplayListComplexityOpClass::kLine, 0.5f);
+  calibration.SetScale(DisplayListComplexityOpClass::kPath, 3.0f);
+  // Out of range scales are clamped rather than persisted.
+  calibration.SetScale(DisplayListComplexityOpClass::kShadow, 1000.0f);
+  ASSERT_EQ(calibration.scale(DisplayListComplexityOpClass::kShadow), 16.0f);
+
+  auto data = calibration.Serialize();
+  auto restored = DisplayListComplexityCalibration::Deserialize(data.get());
+  ASSERT_NE(restored, nullptr);
+  for (size_t i = 0;
+       i < static_cast<size_t>(DisplayListComplexityOpClass::kClassCount);
+       i++) {
+    auto op_class = static_cast<DisplayListComplexityOpClass>(i);
+    ASSERT_EQ(restored->scale(op_class), calibration.scale(op_class));
+  }
+
+  // Truncated or unrecognized blobs are rejected.
+  ASSERT_EQ(DisplayListComplexityCalibration::Deserialize(nullptr), nullptr);
+  auto truncated = SkData::MakeWithCopy(data->data(), data->size() - 4);
+  ASSERT_EQ(DisplayListComplexityCalibration::Deserialize(truncated.get()),
+            nullptr);
+}
+
+TEST(DisplayListComplexity, CalibrationFitAnchorsOnRect) {
+  constexpr size_t kClassCount =
+      DisplayListComplexityCalibration::kClassCount;
+  constexpr size_t kRect =
+      static_cast<size_t>(DisplayListComplexityOpClass::kRect);
+  constexpr size_t kLine =
+      static_cast<size_t>(DisplayListComplexityOpClass::kLine);
+  constexpr size_t kOval =
+      static_cast<size_t>(DisplayListComplexityOpClass::kOval);
+
+  std::vector<uint64_t> measured(kClassCount, 0);
+  std::vector<uint64_t> predicted(kClassCount, 0);
+  measured[kRect] = 1000;
+  predicted[kRect] = 100;
+  // Lines measure twice as expensive as the calculator predicts relative
+  // to the anchor, ovals half as expensive.
+  measured[kLine] = 2000;
+  predicted[kLine] = 100;
+  measured[kOval] = 500;
+  predicted[kOval] = 100;
+
+  auto calibration =
+      DisplayListComplexityCalibration::Fit(measured, predicted);
+  ASSERT_NE(calibration, nullptr);
+  ASSERT_EQ(calibration->scale(DisplayListComplexityOpClass::kRect), 1.0f);
+  ASSERT_EQ(calibration->scale(DisplayListComplexityOpClass::kLine), 2.0f);
+  ASSERT_EQ(calibration->scale(DisplayListComplexityOpClass::kOval), 0.5f);
+  // Classes without measurements keep the reference scale.
+  ASSERT_EQ(calibration->scale(DisplayListComplexityOpClass::kPath), 1.0f);
+
+  // A fit with no usable anchor measurement is rejected.
+  measured[kRect] = 0;
+  ASSERT_EQ(DisplayListComplexityCalibration::Fit(measured, predicted),
+            nullptr);
+}
+
+TEST(DisplayListComplexity, CalibrateOnRasterSurface) {
+  auto surface = SkSurface::MakeRaster(SkImageInfo::MakeN32Premul(512, 512));
+  ASSERT_NE(surface, nullptr);
+
+  auto calibration = DisplayListComplexityCalibration::Calibrate(
+      surface.get(), DisplayListGLComplexityCalculator::GetInstance());
+  ASSERT_NE(calibration, nullptr);
+  // The anchor class is never rescaled and every fitted scale stays
+  // within the clamp range.
+  ASSERT_EQ(calibration->scale(DisplayListComplexityOpClass::kRect), 1.0f);
+  for (size_t i = 0;
+       i < static_cast<size_t>(DisplayListComplexityOpClass::kClassCount);
+       i++) {
+    auto op_class = static_cast<DisplayListComplexityOpClass>(i);
+    ASSERT_GE(calibration->scale(op_class), 1.0f / 16.0f);
+    ASSERT_LE(calibration->scale(op_class), 16.0f);
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -269,12 +269,34 @@ struct SetRuntimeEffectColorSourceOp : DLOp {
   }
 };
 
+// 4 byte header + 16 byte payload uses 24 total bytes (4 bytes unused)
+//
+// The shared instance typically comes from the DisplayListBuilder interning
+// pool so that ops repeating the same color source share one payload.
+struct SetSharedColorSourceOp : DLOp {
+  static const auto kType = DisplayListOpType::kSetSharedColorSource;
+
+  explicit SetSharedColorSourceOp(std::shared_ptr<DlColorSource> source)
+      : source(std::move(source)) {}
+
+  const std::shared_ptr<DlColorSource> source;
+
+  void dispatch(Dispatcher& dispatcher) const {
+    dispatcher.setColorSource(source.get());
+  }
+
+  DisplayListCompare equals(const SetSharedColorSourceOp* other) const {
+    return Equals(source, other->source) ? DisplayListCompare::kEqual
+                                         : DisplayListCompare::kNotEqual;
+  }
+};
+
 // 4 byte header + 16 byte payload uses 24 total bytes (4 bytes unused)
 struct SetSharedImageFilterOp : DLOp {
   static const auto kType = DisplayListOpType::kSetSharedImageFilter;
 
-  SetSharedImageFilterOp(const DlImageFilter* filter)
-      : filter(filter->shared()) {}
+  explicit SetSharedImageFilterOp(std::shared_ptr<DlImageFilter> filter)
+      : filter(std::move(filter)) {}
 
   const std::shared_ptr<DlImageFilter> filter;
 
@@ -383,8 +405,11 @@ struct TranslateOp final : DLOp {
 
   TranslateOp(SkScalar tx, SkScalar ty) : tx(tx), ty(ty) {}
 
-  const SkScalar tx;
-  const SkScalar ty;
+  // Not const: DisplayListBuilder merges a translate that immediately
+  // follows another translate into the already recorded op during the
+  // build phase.
+  SkScalar tx;
+  SkScalar ty;
 
   void dispatch(Dispatcher& dispatcher) const { dispatcher.translate(tx, ty); }
 };
@@ -395,8 +420,10 @@ struct ScaleOp final : DLOp {
 
   ScaleOp(SkScalar sx, SkScalar sy) : sx(sx), sy(sy) {}
 
-  const SkScalar sx;
-  const SkScalar sy;
+  // Not const: DisplayListBuilder merges a scale that immediately follows
+  // another scale into the already recorded op during the build phase.
+  SkScalar sx;
+  SkScalar sy;
 
   void dispatch(Dispatcher& dispatcher) const { dispatcher.scale(sx, sy); }
 };
@@ -579,6 +606,69 @@ DEFINE_DRAW_1ARG_OP(Oval, SkRect, oval)
 DEFINE_DRAW_1ARG_OP(RRect, SkRRect, rrect)
 #undef DEFINE_DRAW_1ARG_OP
 
+// 4 byte header + 8 byte payload uses 12 bytes but is rounded up to
+// 16 bytes (4 bytes unused)
+//
+// The compact form of DrawRectOp/DrawOvalOp, chosen by the builder when
+// all four coordinates are whole numbers representable in an int16_t,
+// which covers most widget and icon geometry. The rect is rebuilt at
+// full SkScalar width during dispatch so replay is identical to the
+// full-width form.
+#define DEFINE_DRAW_RECT16_OP(op_name)                               \
+  struct Draw##op_name##16Op final : DLOp {                          \
+    static const auto kType = DisplayListOpType::kDraw##op_name##16; \
+                                                                     \
+    explicit Draw##op_name##16Op(const SkRect& rect)                 \
+        : left(static_cast<int16_t>(rect.fLeft)),                    \
+          top(static_cast<int16_t>(rect.fTop)),                      \
+          right(static_cast<int16_t>(rect.fRight)),                  \
+          bottom(static_cast<int16_t>(rect.fBottom)) {}              \
+                                                                     \
+    const int16_t left;                                              \
+    const int16_t top;                                               \
+    const int16_t right;                                             \
+    const int16_t bottom;                                            \
+                                                                     \
+    void dispatch(Dispatcher& dispatcher) const {                    \
+      dispatcher.draw##op_name(                                      \
+          SkRect::MakeLTRB(left, top, right, bottom));               \
+    }                                                                \
+  };
+DEFINE_DRAW_RECT16_OP(Rect)
+DEFINE_DRAW_RECT16_OP(Oval)
+#undef DEFINE_DRAW_RECT16_OP
+
+// 4 byte header + 20 byte payload packs efficiently into 24 bytes
+//
+// Fuses the dominant attribute+draw pair - a solid color change followed
+// immediately by a rect - into a single record. The builder rewrites the
+// just-recorded SetColorOp in place when the next op is a drawRect, so
+// one record replaces the 8 byte color op and the 24 byte rect op and
+// saves an op header and a dispatch per replay. Both dispatcher calls
+// are replayed, leaving downstream attribute state identical to the
+// unfused sequence.
+struct SetColorDrawRectOp final : DLOp {
+  static const auto kType = DisplayListOpType::kSetColorDrawRect;
+
+  SetColorDrawRectOp(DlColor color, const SkRect& rect)
+      : color(color), rect(rect) {}
+
+  const DlColor color;
+  const SkRect rect;
+
+  void dispatch(Dispatcher& dispatcher) const {
+    dispatcher.setColor(color);
+    dispatcher.drawRect(rect);
+  }
+
+  // Applies only the attribute half of the record. Used by the culled
+  // dispatch path, where a skipped draw must still leave its color
+  // change behind for the draws that follow it.
+  void dispatchState(Dispatcher& dispatcher) const {
+    dispatcher.setColor(color);
+  }
+};
+
 // 4 byte header + 16 byte payload uses 20 bytes but is rounded up to 24 bytes
 // (4 bytes unused)
 struct DrawPathOp final : DLOp {
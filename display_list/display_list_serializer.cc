@@ -0,0 +1,1614 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_serializer.h"
+
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/fml/logging.h"
+
+#include "third_party/skia/include/core/SkSerialProcs.h"
+
+namespace flutter {
+
+namespace {
+
+// The serialized layout is:
+//
+//   [uint32 signature][uint32 version][uint32 image_count]
+//   image_count * ([uint32 byte_count][bytes][padding])
+//   tagged records until the end of the buffer
+//
+// where each record is a [uint32 tag] followed by a fixed payload per tag.
+// All multi-byte values are stored in host endianness and every variable
+// sized payload is padded to a 4-byte boundary, which keeps the fixed
+// values and the bulk arrays (points, gradient stops, atlas transforms)
+// naturally aligned so they can be read in place from a mapped buffer.
+constexpr uint32_t kSignature = 0x314C4446;  // 'FDL1'
+constexpr uint32_t kVersion = 1;
+
+// One tag per Dispatcher method that the format can represent. The tag
+// values are part of the persisted format; add new records at the end.
+enum class RecordType : uint32_t {
+  kSetAntiAlias = 1,
+  kSetDither,
+  kSetStyle,
+  kSetColor,
+  kSetStrokeWidth,
+  kSetStrokeMiter,
+  kSetStrokeCap,
+  kSetStrokeJoin,
+  kSetColorSource,
+  kSetColorFilter,
+  kSetInvertColors,
+  kSetBlendMode,
+  kSetPathEffect,
+  kSetMaskFilter,
+  kSetImageFilter,
+  kSave,
+  kSaveLayer,
+  kRestore,
+  kTranslate,
+  kScale,
+  kRotate,
+  kSkew,
+  kTransform2DAffine,
+  kTransformFullPerspective,
+  kTransformReset,
+  kClipRect,
+  kClipRRect,
+  kClipPath,
+  kDrawColor,
+  kDrawPaint,
+  kDrawLine,
+  kDrawRect,
+  kDrawOval,
+  kDrawCircle,
+  kDrawRRect,
+  kDrawDRRect,
+  kDrawPath,
+  kDrawArc,
+  kDrawPoints,
+  kDrawVertices,
+  kDrawImage,
+  kDrawImageRect,
+  kDrawImageNine,
+  kDrawImageLattice,
+  kDrawAtlas,
+  kDrawDisplayList,
+  kDrawTextBlob,
+  kDrawShadow,
+};
+
+// Sub-type values for the attribute records. A leading 0 always means a
+// null attribute (reset to defaults).
+constexpr uint32_t kAttributeNull = 0;
+
+class ByteWriter {
+ public:
+  template <typename T>
+  void Write(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "serialized values must be raw bytes");
+    static_assert(sizeof(T) % 4 == 0,
+                  "fixed size values must preserve 4-byte alignment");
+    WriteBytes(&value, sizeof(T));
+  }
+
+  // Booleans and enums are widened to 32 bits so their storage size does
+  // not depend on the compiler and records stay aligned.
+  void WriteBool(bool value) { Write<uint32_t>(value ? 1u : 0u); }
+
+  void WriteBytes(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    buffer_.insert(buffer_.end(), bytes, bytes + size);
+  }
+
+  void Pad() {
+    while (buffer_.size() % 4 != 0) {
+      buffer_.push_back(0);
+    }
+  }
+
+  sk_sp<SkData> ToData() const {
+    return SkData::MakeWithCopy(buffer_.data(), buffer_.size());
+  }
+
+  const uint8_t* data() const { return buffer_.data(); }
+  size_t size() const { return buffer_.size(); }
+
+ private:
+  std::vector<uint8_t> buffer_;
+};
+
+class ByteReader {
+ public:
+  ByteReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+  template <typename T>
+  T Read() {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "serialized values must be raw bytes");
+    T value{};
+    if (Require(sizeof(T))) {
+      memcpy(&value, data_ + offset_, sizeof(T));
+      offset_ += sizeof(T);
+    }
+    return value;
+  }
+
+  bool ReadBool() { return Read<uint32_t>() != 0; }
+
+  // Returns a pointer into the underlying buffer rather than copying so
+  // that bulk payloads replay zero-copy, and realigns the read cursor for
+  // the next record.
+  const void* ReadBytes(size_t size) {
+    if (!Require(size)) {
+      return nullptr;
+    }
+    const void* bytes = data_ + offset_;
+    offset_ += size;
+    while (offset_ % 4 != 0 && offset_ < size_) {
+      offset_++;
+    }
+    return bytes;
+  }
+
+  void Invalidate() { ok_ = false; }
+  bool ok() const { return ok_; }
+  bool AtEnd() const { return offset_ >= size_; }
+
+ private:
+  bool Require(size_t size) {
+    if (!ok_ || size_ - offset_ < size) {
+      ok_ = false;
+      return false;
+    }
+    return true;
+  }
+
+  const uint8_t* data_;
+  size_t size_;
+  size_t offset_ = 0;
+  bool ok_ = true;
+};
+
+void WriteMatrix(ByteWriter& writer, const SkMatrix* matrix) {
+  writer.WriteBool(matrix != nullptr);
+  if (matrix != nullptr) {
+    SkScalar buffer[9];
+    matrix->get9(buffer);
+    writer.WriteBytes(buffer, sizeof(buffer));
+  }
+}
+
+bool ReadMatrix(ByteReader& reader, SkMatrix* matrix) {
+  if (!reader.ReadBool()) {
+    return false;
+  }
+  SkScalar buffer[9];
+  for (auto& value : buffer) {
+    value = reader.Read<SkScalar>();
+  }
+  matrix->set9(buffer);
+  return true;
+}
+
+void WriteRRect(ByteWriter& writer, const SkRRect& rrect) {
+  char buffer[SkRRect::kSizeInMemory];
+  size_t size = rrect.writeToMemory(buffer);
+  writer.Write<uint32_t>(size);
+  writer.WriteBytes(buffer, size);
+  writer.Pad();
+}
+
+SkRRect ReadRRect(ByteReader& reader) {
+  uint32_t size = reader.Read<uint32_t>();
+  const void* bytes = reader.ReadBytes(size);
+  SkRRect rrect = SkRRect::MakeEmpty();
+  if (bytes == nullptr || rrect.readFromMemory(bytes, size) == 0) {
+    reader.Invalidate();
+  }
+  return rrect;
+}
+
+void WritePath(ByteWriter& writer, const SkPath& path) {
+  size_t size = path.writeToMemory(nullptr);
+  std::vector<uint8_t> buffer(size);
+  path.writeToMemory(buffer.data());
+  writer.Write<uint32_t>(size);
+  writer.WriteBytes(buffer.data(), size);
+  writer.Pad();
+}
+
+SkPath ReadPath(ByteReader& reader) {
+  uint32_t size = reader.Read<uint32_t>();
+  const void* bytes = reader.ReadBytes(size);
+  SkPath path;
+  if (bytes == nullptr || path.readFromMemory(bytes, size) == 0) {
+    reader.Invalidate();
+  }
+  return path;
+}
+
+// Resolves image table entries through the embedder hook, at most once
+// per entry no matter how many records reference it.
+class ImageTable {
+ public:
+  explicit ImageTable(DlImageDeserializer* deserializer)
+      : deserializer_(deserializer) {}
+
+  void Add(const void* data, size_t size) {
+    spans_.push_back({data, size});
+    resolved_.push_back(nullptr);
+  }
+
+  sk_sp<DlImage> Get(uint32_t index) {
+    if (index >= spans_.size()) {
+      return nullptr;
+    }
+    if (!resolved_[index]) {
+      if (deserializer_ == nullptr) {
+        return nullptr;
+      }
+      sk_sp<SkData> data =
+          SkData::MakeWithoutCopy(spans_[index].data, spans_[index].size);
+      resolved_[index] = deserializer_->DeserializeImage(*data);
+    }
+    return resolved_[index];
+  }
+
+ private:
+  struct Span {
+    const void* data;
+    size_t size;
+  };
+
+  DlImageDeserializer* deserializer_;
+  std::vector<Span> spans_;
+  std::vector<sk_sp<DlImage>> resolved_;
+};
+
+// A Dispatcher that records everything it receives into the serialized
+// byte format. Any record that cannot be represented marks the whole
+// serialization as failed.
+class Serializer final : public virtual Dispatcher {
+ public:
+  explicit Serializer(DlImageSerializer* image_serializer)
+      : image_serializer_(image_serializer) {}
+
+  bool success() const { return success_; }
+
+  sk_sp<SkData> Finish() const {
+    FML_DCHECK(success_);
+    ByteWriter assembled;
+    assembled.Write<uint32_t>(kSignature);
+    assembled.Write<uint32_t>(kVersion);
+    assembled.Write<uint32_t>(images_.size());
+    for (const auto& image : images_) {
+      assembled.Write<uint32_t>(image->size());
+      assembled.WriteBytes(image->data(), image->size());
+      assembled.Pad();
+    }
+    assembled.WriteBytes(ops_.data(), ops_.size());
+    return assembled.ToData();
+  }
+
+  void setAntiAlias(bool aa) override {
+    WriteTag(RecordType::kSetAntiAlias);
+    ops_.WriteBool(aa);
+  }
+  void setDither(bool dither) override {
+    WriteTag(RecordType::kSetDither);
+    ops_.WriteBool(dither);
+  }
+  void setStyle(DlDrawStyle style) override {
+    WriteTag(RecordType::kSetStyle);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(style));
+  }
+  void setColor(DlColor color) override {
+    WriteTag(RecordType::kSetColor);
+    ops_.Write<uint32_t>(color.argb);
+  }
+  void setStrokeWidth(float width) override {
+    WriteTag(RecordType::kSetStrokeWidth);
+    ops_.Write<float>(width);
+  }
+  void setStrokeMiter(float limit) override {
+    WriteTag(RecordType::kSetStrokeMiter);
+    ops_.Write<float>(limit);
+  }
+  void setStrokeCap(DlStrokeCap cap) override {
+    WriteTag(RecordType::kSetStrokeCap);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(cap));
+  }
+  void setStrokeJoin(DlStrokeJoin join) override {
+    WriteTag(RecordType::kSetStrokeJoin);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(join));
+  }
+
+  void setColorSource(const DlColorSource* source) override {
+    WriteTag(RecordType::kSetColorSource);
+    WriteColorSource(source);
+  }
+
+  void setColorFilter(const DlColorFilter* filter) override {
+    WriteTag(RecordType::kSetColorFilter);
+    WriteColorFilter(filter);
+  }
+
+  void setInvertColors(bool invert) override {
+    WriteTag(RecordType::kSetInvertColors);
+    ops_.WriteBool(invert);
+  }
+  void setBlendMode(DlBlendMode mode) override {
+    WriteTag(RecordType::kSetBlendMode);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(mode));
+  }
+
+  void setBlender(sk_sp<SkBlender> blender) override {
+    // An SkBlender is an arbitrary process-local object with no
+    // pointer-free representation.
+    if (blender != nullptr) {
+      success_ = false;
+    }
+  }
+
+  void setPathEffect(const DlPathEffect* effect) override {
+    WriteTag(RecordType::kSetPathEffect);
+    if (effect == nullptr) {
+      ops_.Write<uint32_t>(kAttributeNull);
+      return;
+    }
+    const DlDashPathEffect* dash = effect->asDash();
+    if (dash == nullptr) {
+      success_ = false;
+      return;
+    }
+    uint32_t count = dash->count();
+    ops_.Write<uint32_t>(1u);
+    ops_.Write<uint32_t>(count);
+    ops_.Write<SkScalar>(dash->phase());
+    ops_.WriteBytes(dash->intervals(), count * sizeof(SkScalar));
+  }
+
+  void setMaskFilter(const DlMaskFilter* filter) override {
+    WriteTag(RecordType::kSetMaskFilter);
+    if (filter == nullptr) {
+      ops_.Write<uint32_t>(kAttributeNull);
+      return;
+    }
+    const DlBlurMaskFilter* blur = filter->asBlur();
+    if (blur == nullptr) {
+      success_ = false;
+      return;
+    }
+    ops_.Write<uint32_t>(1u);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(blur->style()));
+    ops_.Write<SkScalar>(blur->sigma());
+  }
+
+  void setImageFilter(const DlImageFilter* filter) override {
+    WriteTag(RecordType::kSetImageFilter);
+    WriteImageFilter(filter);
+  }
+
+  void save() override { WriteTag(RecordType::kSave); }
+
+  void saveLayer(const SkRect* bounds,
+                 const SaveLayerOptions options,
+                 const DlImageFilter* backdrop) override {
+    WriteTag(RecordType::kSaveLayer);
+    ops_.WriteBool(bounds != nullptr);
+    if (bounds != nullptr) {
+      ops_.Write<SkRect>(*bounds);
+    }
+    static_assert(sizeof(SaveLayerOptions) == sizeof(uint32_t),
+                  "SaveLayerOptions is serialized as its 32-bit flags");
+    ops_.Write<SaveLayerOptions>(options);
+    WriteImageFilter(backdrop);
+  }
+
+  void restore() override { WriteTag(RecordType::kRestore); }
+
+  void translate(SkScalar tx, SkScalar ty) override {
+    WriteTag(RecordType::kTranslate);
+    ops_.Write<SkScalar>(tx);
+    ops_.Write<SkScalar>(ty);
+  }
+  void scale(SkScalar sx, SkScalar sy) override {
+    WriteTag(RecordType::kScale);
+    ops_.Write<SkScalar>(sx);
+    ops_.Write<SkScalar>(sy);
+  }
+  void rotate(SkScalar degrees) override {
+    WriteTag(RecordType::kRotate);
+    ops_.Write<SkScalar>(degrees);
+  }
+  void skew(SkScalar sx, SkScalar sy) override {
+    WriteTag(RecordType::kSkew);
+    ops_.Write<SkScalar>(sx);
+    ops_.Write<SkScalar>(sy);
+  }
+
+  // clang-format off
+  void transform2DAffine(SkScalar mxx, SkScalar mxy, SkScalar mxt,
+                         SkScalar myx, SkScalar myy, SkScalar myt) override {
+    WriteTag(RecordType::kTransform2DAffine);
+    SkScalar values[6] = {mxx, mxy, mxt, myx, myy, myt};
+    ops_.WriteBytes(values, sizeof(values));
+  }
+  void transformFullPerspective(
+      SkScalar mxx, SkScalar mxy, SkScalar mxz, SkScalar mxt,
+      SkScalar myx, SkScalar myy, SkScalar myz, SkScalar myt,
+      SkScalar mzx, SkScalar mzy, SkScalar mzz, SkScalar mzt,
+      SkScalar mwx, SkScalar mwy, SkScalar mwz, SkScalar mwt) override {
+    WriteTag(RecordType::kTransformFullPerspective);
+    SkScalar values[16] = {mxx, mxy, mxz, mxt, myx, myy, myz, myt,
+                           mzx, mzy, mzz, mzt, mwx, mwy, mwz, mwt};
+    ops_.WriteBytes(values, sizeof(values));
+  }
+  // clang-format on
+
+  void transformReset() override { WriteTag(RecordType::kTransformReset); }
+
+  void clipRect(const SkRect& rect, SkClipOp clip_op, bool is_aa) override {
+    WriteTag(RecordType::kClipRect);
+    ops_.Write<SkRect>(rect);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(clip_op));
+    ops_.WriteBool(is_aa);
+  }
+  void clipRRect(const SkRRect& rrect, SkClipOp clip_op, bool is_aa) override {
+    WriteTag(RecordType::kClipRRect);
+    WriteRRect(ops_, rrect);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(clip_op));
+    ops_.WriteBool(is_aa);
+  }
+  void clipPath(const SkPath& path, SkClipOp clip_op, bool is_aa) override {
+    WriteTag(RecordType::kClipPath);
+    WritePath(ops_, path);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(clip_op));
+    ops_.WriteBool(is_aa);
+  }
+
+  void drawColor(DlColor color, DlBlendMode mode) override {
+    WriteTag(RecordType::kDrawColor);
+    ops_.Write<uint32_t>(color.argb);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(mode));
+  }
+  void drawPaint() override { WriteTag(RecordType::kDrawPaint); }
+  void drawLine(const SkPoint& p0, const SkPoint& p1) override {
+    WriteTag(RecordType::kDrawLine);
+    ops_.Write<SkPoint>(p0);
+    ops_.Write<SkPoint>(p1);
+  }
+  void drawRect(const SkRect& rect) override {
+    WriteTag(RecordType::kDrawRect);
+    ops_.Write<SkRect>(rect);
+  }
+  void drawOval(const SkRect& bounds) override {
+    WriteTag(RecordType::kDrawOval);
+    ops_.Write<SkRect>(bounds);
+  }
+  void drawCircle(const SkPoint& center, SkScalar radius) override {
+    WriteTag(RecordType::kDrawCircle);
+    ops_.Write<SkPoint>(center);
+    ops_.Write<SkScalar>(radius);
+  }
+  void drawRRect(const SkRRect& rrect) override {
+    WriteTag(RecordType::kDrawRRect);
+    WriteRRect(ops_, rrect);
+  }
+  void drawDRRect(const SkRRect& outer, const SkRRect& inner) override {
+    WriteTag(RecordType::kDrawDRRect);
+    WriteRRect(ops_, outer);
+    WriteRRect(ops_, inner);
+  }
+  void drawPath(const SkPath& path) override {
+    WriteTag(RecordType::kDrawPath);
+    WritePath(ops_, path);
+  }
+  void drawArc(const SkRect& oval_bounds,
+               SkScalar start_degrees,
+               SkScalar sweep_degrees,
+               bool use_center) override {
+    WriteTag(RecordType::kDrawArc);
+    ops_.Write<SkRect>(oval_bounds);
+    ops_.Write<SkScalar>(start_degrees);
+    ops_.Write<SkScalar>(sweep_degrees);
+    ops_.WriteBool(use_center);
+  }
+  void drawPoints(SkCanvas::PointMode mode,
+                  uint32_t count,
+                  const SkPoint points[]) override {
+    WriteTag(RecordType::kDrawPoints);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(mode));
+    ops_.Write<uint32_t>(count);
+    ops_.WriteBytes(points, count * sizeof(SkPoint));
+  }
+
+  void drawSkVertices(const sk_sp<SkVertices> vertices,
+                      SkBlendMode mode) override {
+    // SkVertices references are only recorded when recapturing foreign
+    // Skia content; the DlVertices record below covers framework lists.
+    success_ = false;
+  }
+
+  void drawVertices(const DlVertices* vertices, DlBlendMode mode) override {
+    WriteTag(RecordType::kDrawVertices);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(mode));
+    ops_.Write<uint32_t>(static_cast<uint32_t>(vertices->mode()));
+    uint32_t vertex_count = vertices->vertex_count();
+    uint32_t index_count = vertices->index_count();
+    ops_.Write<uint32_t>(vertex_count);
+    ops_.Write<uint32_t>(index_count);
+    ops_.WriteBool(vertices->texture_coordinates() != nullptr);
+    ops_.WriteBool(vertices->colors() != nullptr);
+    ops_.WriteBytes(vertices->vertices(), vertex_count * sizeof(SkPoint));
+    if (vertices->texture_coordinates() != nullptr) {
+      ops_.WriteBytes(vertices->texture_coordinates(),
+                      vertex_count * sizeof(SkPoint));
+    }
+    if (vertices->colors() != nullptr) {
+      ops_.WriteBytes(vertices->colors(), vertex_count * sizeof(DlColor));
+    }
+    if (index_count > 0) {
+      ops_.WriteBytes(vertices->indices(), index_count * sizeof(uint16_t));
+      ops_.Pad();
+    }
+  }
+
+  void drawImage(const sk_sp<DlImage> image,
+                 const SkPoint point,
+                 DlImageSampling sampling,
+                 bool render_with_attributes) override {
+    uint32_t index;
+    if (!ImageIndex(image, &index)) {
+      return;
+    }
+    WriteTag(RecordType::kDrawImage);
+    ops_.Write<uint32_t>(index);
+    ops_.Write<SkPoint>(point);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(sampling));
+    ops_.WriteBool(render_with_attributes);
+  }
+
+  void drawImageRect(const sk_sp<DlImage> image,
+                     const SkRect& src,
+                     const SkRect& dst,
+                     DlImageSampling sampling,
+                     bool render_with_attributes,
+                     SkCanvas::SrcRectConstraint constraint) override {
+    uint32_t index;
+    if (!ImageIndex(image, &index)) {
+      return;
+    }
+    WriteTag(RecordType::kDrawImageRect);
+    ops_.Write<uint32_t>(index);
+    ops_.Write<SkRect>(src);
+    ops_.Write<SkRect>(dst);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(sampling));
+    ops_.WriteBool(render_with_attributes);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(constraint));
+  }
+
+  void drawImageNine(const sk_sp<DlImage> image,
+                     const SkIRect& center,
+                     const SkRect& dst,
+                     DlFilterMode filter,
+                     bool render_with_attributes) override {
+    uint32_t index;
+    if (!ImageIndex(image, &index)) {
+      return;
+    }
+    WriteTag(RecordType::kDrawImageNine);
+    ops_.Write<uint32_t>(index);
+    ops_.Write<SkIRect>(center);
+    ops_.Write<SkRect>(dst);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(filter));
+    ops_.WriteBool(render_with_attributes);
+  }
+
+  void drawImageLattice(const sk_sp<DlImage> image,
+                        const SkCanvas::Lattice& lattice,
+                        const SkRect& dst,
+                        DlFilterMode filter,
+                        bool render_with_attributes) override {
+    uint32_t index;
+    if (!ImageIndex(image, &index)) {
+      return;
+    }
+    WriteTag(RecordType::kDrawImageLattice);
+    ops_.Write<uint32_t>(index);
+    ops_.Write<SkRect>(dst);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(filter));
+    ops_.WriteBool(render_with_attributes);
+    ops_.Write<int32_t>(lattice.fXCount);
+    ops_.Write<int32_t>(lattice.fYCount);
+    ops_.WriteBool(lattice.fBounds != nullptr);
+    if (lattice.fBounds != nullptr) {
+      ops_.Write<SkIRect>(*lattice.fBounds);
+    }
+    ops_.WriteBytes(lattice.fXDivs, lattice.fXCount * sizeof(int32_t));
+    ops_.WriteBytes(lattice.fYDivs, lattice.fYCount * sizeof(int32_t));
+    uint32_t cell_count = (lattice.fXCount + 1) * (lattice.fYCount + 1);
+    ops_.WriteBool(lattice.fRectTypes != nullptr);
+    if (lattice.fRectTypes != nullptr) {
+      static_assert(sizeof(SkCanvas::Lattice::RectType) == 1,
+                    "lattice rect types are serialized as bytes");
+      ops_.WriteBytes(lattice.fRectTypes, cell_count);
+      ops_.Pad();
+    }
+    ops_.WriteBool(lattice.fColors != nullptr);
+    if (lattice.fColors != nullptr) {
+      ops_.WriteBytes(lattice.fColors, cell_count * sizeof(SkColor));
+    }
+  }
+
+  void drawAtlas(const sk_sp<DlImage> atlas,
+                 const SkRSXform xform[],
+                 const SkRect tex[],
+                 const DlColor colors[],
+                 int count,
+                 DlBlendMode mode,
+                 DlImageSampling sampling,
+                 const SkRect* cull_rect,
+                 bool render_with_attributes) override {
+    uint32_t index;
+    if (!ImageIndex(atlas, &index)) {
+      return;
+    }
+    WriteTag(RecordType::kDrawAtlas);
+    ops_.Write<uint32_t>(index);
+    ops_.Write<uint32_t>(count);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(mode));
+    ops_.Write<uint32_t>(static_cast<uint32_t>(sampling));
+    ops_.WriteBool(render_with_attributes);
+    ops_.WriteBool(cull_rect != nullptr);
+    if (cull_rect != nullptr) {
+      ops_.Write<SkRect>(*cull_rect);
+    }
+    ops_.WriteBool(colors != nullptr);
+    ops_.WriteBytes(xform, count * sizeof(SkRSXform));
+    ops_.WriteBytes(tex, count * sizeof(SkRect));
+    if (colors != nullptr) {
+      ops_.WriteBytes(colors, count * sizeof(DlColor));
+    }
+  }
+
+  void drawPicture(const sk_sp<SkPicture> picture,
+                   const SkMatrix* matrix,
+                   bool render_with_attributes) override {
+    // An SkPicture is an arbitrary process-local object with no
+    // pointer-free representation.
+    success_ = false;
+  }
+
+  void drawDisplayList(const sk_sp<DisplayList> display_list) override {
+    if (!success_) {
+      return;
+    }
+    sk_sp<SkData> nested =
+        DisplayListSerializer::Serialize(display_list, image_serializer_);
+    if (!nested) {
+      success_ = false;
+      return;
+    }
+    WriteTag(RecordType::kDrawDisplayList);
+    ops_.Write<uint32_t>(nested->size());
+    ops_.WriteBytes(nested->data(), nested->size());
+    ops_.Pad();
+  }
+
+  void drawTextBlob(const sk_sp<SkTextBlob> blob,
+                    SkScalar x,
+                    SkScalar y) override {
+    sk_sp<SkData> data = blob->serialize(SkSerialProcs{});
+    if (!data) {
+      success_ = false;
+      return;
+    }
+    WriteTag(RecordType::kDrawTextBlob);
+    ops_.Write<SkScalar>(x);
+    ops_.Write<SkScalar>(y);
+    ops_.Write<uint32_t>(data->size());
+    ops_.WriteBytes(data->data(), data->size());
+    ops_.Pad();
+  }
+
+  void drawShadow(const SkPath& path,
+                  const DlColor color,
+                  const SkScalar elevation,
+                  bool transparent_occluder,
+                  SkScalar dpr) override {
+    WriteTag(RecordType::kDrawShadow);
+    WritePath(ops_, path);
+    ops_.Write<uint32_t>(color.argb);
+    ops_.Write<SkScalar>(elevation);
+    ops_.WriteBool(transparent_occluder);
+    ops_.Write<SkScalar>(dpr);
+  }
+
+ private:
+  void WriteTag(RecordType type) {
+    ops_.Write<uint32_t>(static_cast<uint32_t>(type));
+  }
+
+  // Returns the table index for |image|, externalizing it through the
+  // embedder hook the first time it is seen.
+  bool ImageIndex(const sk_sp<DlImage>& image, uint32_t* index) {
+    if (!success_) {
+      return false;
+    }
+    if (image == nullptr || image_serializer_ == nullptr) {
+      success_ = false;
+      return false;
+    }
+    auto iter = image_indices_.find(image.get());
+    if (iter != image_indices_.end()) {
+      *index = iter->second;
+      return true;
+    }
+    sk_sp<SkData> data = image_serializer_->SerializeImage(image);
+    if (!data) {
+      success_ = false;
+      return false;
+    }
+    *index = images_.size();
+    images_.push_back(std::move(data));
+    image_indices_[image.get()] = *index;
+    return true;
+  }
+
+  void WriteColorSource(const DlColorSource* source) {
+    if (source == nullptr) {
+      ops_.Write<uint32_t>(kAttributeNull);
+      return;
+    }
+    switch (source->type()) {
+      case DlColorSourceType::kColor:
+        ops_.Write<uint32_t>(1u);
+        ops_.Write<uint32_t>(source->asColor()->color().argb);
+        return;
+      case DlColorSourceType::kLinearGradient: {
+        const DlLinearGradientColorSource* gradient =
+            source->asLinearGradient();
+        ops_.Write<uint32_t>(2u);
+        ops_.Write<SkPoint>(gradient->start_point());
+        ops_.Write<SkPoint>(gradient->end_point());
+        WriteGradient(gradient);
+        return;
+      }
+      case DlColorSourceType::kRadialGradient: {
+        const DlRadialGradientColorSource* gradient =
+            source->asRadialGradient();
+        ops_.Write<uint32_t>(3u);
+        ops_.Write<SkPoint>(gradient->center());
+        ops_.Write<SkScalar>(gradient->radius());
+        WriteGradient(gradient);
+        return;
+      }
+      case DlColorSourceType::kConicalGradient: {
+        const DlConicalGradientColorSource* gradient =
+            source->asConicalGradient();
+        ops_.Write<uint32_t>(4u);
+        ops_.Write<SkPoint>(gradient->start_center());
+        ops_.Write<SkScalar>(gradient->start_radius());
+        ops_.Write<SkPoint>(gradient->end_center());
+        ops_.Write<SkScalar>(gradient->end_radius());
+        WriteGradient(gradient);
+        return;
+      }
+      case DlColorSourceType::kSweepGradient: {
+        const DlSweepGradientColorSource* gradient = source->asSweepGradient();
+        ops_.Write<uint32_t>(5u);
+        ops_.Write<SkPoint>(gradient->center());
+        ops_.Write<SkScalar>(gradient->start());
+        ops_.Write<SkScalar>(gradient->end());
+        WriteGradient(gradient);
+        return;
+      }
+      case DlColorSourceType::kImage: {
+        const DlImageColorSource* image_source = source->asImage();
+        uint32_t index;
+        sk_sp<DlImage> image =
+            sk_ref_sp(const_cast<DlImage*>(image_source->image().get()));
+        if (!ImageIndex(image, &index)) {
+          return;
+        }
+        ops_.Write<uint32_t>(6u);
+        ops_.Write<uint32_t>(index);
+        ops_.Write<uint32_t>(
+            static_cast<uint32_t>(image_source->horizontal_tile_mode()));
+        ops_.Write<uint32_t>(
+            static_cast<uint32_t>(image_source->vertical_tile_mode()));
+        ops_.Write<uint32_t>(static_cast<uint32_t>(image_source->sampling()));
+        WriteMatrix(ops_, image_source->matrix_ptr());
+        return;
+      }
+      case DlColorSourceType::kRuntimeEffect:
+      case DlColorSourceType::kUnknown:
+        // Runtime effects and bare SkShader wrappers hold process-local
+        // objects with no pointer-free representation.
+        success_ = false;
+        return;
+    }
+    success_ = false;
+  }
+
+  void WriteGradient(const DlGradientColorSourceBase* gradient) {
+    uint32_t stop_count = gradient->stop_count();
+    ops_.Write<uint32_t>(stop_count);
+    ops_.Write<uint32_t>(static_cast<uint32_t>(gradient->tile_mode()));
+    WriteMatrix(ops_, gradient->matrix_ptr());
+    ops_.WriteBytes(gradient->colors(), stop_count * sizeof(DlColor));
+    ops_.WriteBytes(gradient->stops(), stop_count * sizeof(float));
+  }
+
+  void WriteColorFilter(const DlColorFilter* filter) {
+    if (filter == nullptr) {
+      ops_.Write<uint32_t>(kAttributeNull);
+      return;
+    }
+    switch (filter->type()) {
+      case DlColorFilterType::kBlend: {
+        const DlBlendColorFilter* blend = filter->asBlend();
+        ops_.Write<uint32_t>(1u);
+        ops_.Write<uint32_t>(blend->color().argb);
+        ops_.Write<uint32_t>(static_cast<uint32_t>(blend->mode()));
+        return;
+      }
+      case DlColorFilterType::kMatrix: {
+        float matrix[20];
+        filter->asMatrix()->get_matrix(matrix);
+        ops_.Write<uint32_t>(2u);
+        ops_.WriteBytes(matrix, sizeof(matrix));
+        return;
+      }
+      case DlColorFilterType::kSrgbToLinearGamma:
+        ops_.Write<uint32_t>(3u);
+        return;
+      case DlColorFilterType::kLinearToSrgbGamma:
+        ops_.Write<uint32_t>(4u);
+        return;
+      case DlColorFilterType::kUnknown:
+        success_ = false;
+        return;
+    }
+    success_ = false;
+  }
+
+  void WriteImageFilter(const DlImageFilter* filter) {
+    if (filter == nullptr) {
+      ops_.Write<uint32_t>(kAttributeNull);
+      return;
+    }
+    switch (filter->type()) {
+      case DlImageFilterType::kBlur: {
+        const DlBlurImageFilter* blur = filter->asBlur();
+        ops_.Write<uint32_t>(1u);
+        ops_.Write<SkScalar>(blur->sigma_x());
+        ops_.Write<SkScalar>(blur->sigma_y());
+        ops_.Write<uint32_t>(static_cast<uint32_t>(blur->tile_mode()));
+        return;
+      }
+      case DlImageFilterType::kDilate: {
+        const DlDilateImageFilter* dilate = filter->asDilate();
+        ops_.Write<uint32_t>(2u);
+        ops_.Write<SkScalar>(dilate->radius_x());
+        ops_.Write<SkScalar>(dilate->radius_y());
+        return;
+      }
+      case DlImageFilterType::kErode: {
+        const DlErodeImageFilter* erode = filter->asErode();
+        ops_.Write<uint32_t>(3u);
+        ops_.Write<SkScalar>(erode->radius_x());
+        ops_.Write<SkScalar>(erode->radius_y());
+        return;
+      }
+      case DlImageFilterType::kMatrix: {
+        const DlMatrixImageFilter* matrix = filter->asMatrix();
+        ops_.Write<uint32_t>(4u);
+        WriteMatrix(ops_, &matrix->matrix());
+        ops_.Write<uint32_t>(static_cast<uint32_t>(matrix->sampling()));
+        return;
+      }
+      case DlImageFilterType::kComposeFilter: {
+        const DlComposeImageFilter* compose = filter->asCompose();
+        ops_.Write<uint32_t>(5u);
+        WriteImageFilter(compose->outer().get());
+        WriteImageFilter(compose->inner().get());
+        return;
+      }
+      case DlImageFilterType::kColorFilter: {
+        ops_.Write<uint32_t>(6u);
+        WriteColorFilter(filter->asColorFilter()->color_filter().get());
+        return;
+      }
+      case DlImageFilterType::kLocalMatrixFilter: {
+        const DlLocalMatrixImageFilter* local = filter->asLocalMatrix();
+        ops_.Write<uint32_t>(7u);
+        WriteMatrix(ops_, &local->matrix());
+        WriteImageFilter(local->image_filter().get());
+        return;
+      }
+      case DlImageFilterType::kUnknown:
+        success_ = false;
+        return;
+    }
+    success_ = false;
+  }
+
+  ByteWriter ops_;
+  std::vector<sk_sp<SkData>> images_;
+  std::map<const DlImage*, uint32_t> image_indices_;
+  DlImageSerializer* image_serializer_;
+  bool success_ = true;
+};
+
+std::shared_ptr<DlColorFilter> ReadColorFilter(ByteReader& reader) {
+  uint32_t type = reader.Read<uint32_t>();
+  switch (type) {
+    case kAttributeNull:
+      return nullptr;
+    case 1u: {
+      DlColor color(reader.Read<uint32_t>());
+      DlBlendMode mode = static_cast<DlBlendMode>(reader.Read<uint32_t>());
+      return std::make_shared<DlBlendColorFilter>(color, mode);
+    }
+    case 2u: {
+      float matrix[20];
+      for (auto& value : matrix) {
+        value = reader.Read<float>();
+      }
+      return std::make_shared<DlMatrixColorFilter>(matrix);
+    }
+    case 3u:
+      return DlSrgbToLinearGammaColorFilter::instance;
+    case 4u:
+      return DlLinearToSrgbGammaColorFilter::instance;
+    default:
+      reader.Invalidate();
+      return nullptr;
+  }
+}
+
+std::shared_ptr<DlImageFilter> ReadImageFilter(ByteReader& reader) {
+  uint32_t type = reader.Read<uint32_t>();
+  switch (type) {
+    case kAttributeNull:
+      return nullptr;
+    case 1u: {
+      SkScalar sigma_x = reader.Read<SkScalar>();
+      SkScalar sigma_y = reader.Read<SkScalar>();
+      DlTileMode tile_mode = static_cast<DlTileMode>(reader.Read<uint32_t>());
+      return std::make_shared<DlBlurImageFilter>(sigma_x, sigma_y, tile_mode);
+    }
+    case 2u: {
+      SkScalar radius_x = reader.Read<SkScalar>();
+      SkScalar radius_y = reader.Read<SkScalar>();
+      return std::make_shared<DlDilateImageFilter>(radius_x, radius_y);
+    }
+    case 3u: {
+      SkScalar radius_x = reader.Read<SkScalar>();
+      SkScalar radius_y = reader.Read<SkScalar>();
+      return std::make_shared<DlErodeImageFilter>(radius_x, radius_y);
+    }
+    case 4u: {
+      SkMatrix matrix;
+      if (!ReadMatrix(reader, &matrix)) {
+        reader.Invalidate();
+        return nullptr;
+      }
+      DlImageSampling sampling =
+          static_cast<DlImageSampling>(reader.Read<uint32_t>());
+      return std::make_shared<DlMatrixImageFilter>(matrix, sampling);
+    }
+    case 5u: {
+      std::shared_ptr<DlImageFilter> outer = ReadImageFilter(reader);
+      std::shared_ptr<DlImageFilter> inner = ReadImageFilter(reader);
+      if (!reader.ok()) {
+        return nullptr;
+      }
+      return std::make_shared<DlComposeImageFilter>(outer, inner);
+    }
+    case 6u: {
+      std::shared_ptr<DlColorFilter> color_filter = ReadColorFilter(reader);
+      if (!reader.ok()) {
+        return nullptr;
+      }
+      return std::make_shared<DlColorFilterImageFilter>(color_filter);
+    }
+    case 7u: {
+      SkMatrix matrix;
+      if (!ReadMatrix(reader, &matrix)) {
+        reader.Invalidate();
+        return nullptr;
+      }
+      std::shared_ptr<DlImageFilter> inner = ReadImageFilter(reader);
+      if (!reader.ok()) {
+        return nullptr;
+      }
+      return std::make_shared<DlLocalMatrixImageFilter>(matrix, inner);
+    }
+    default:
+      reader.Invalidate();
+      return nullptr;
+  }
+}
+
+// Reads the common tail of a gradient record and invokes |maker| with the
+// stop data to build the concrete gradient. The color and stop arrays are
+// passed into the factory straight out of the serialized buffer.
+template <typename Maker>
+std::shared_ptr<DlColorSource> ReadGradient(ByteReader& reader, Maker maker) {
+  uint32_t stop_count = reader.Read<uint32_t>();
+  DlTileMode tile_mode = static_cast<DlTileMode>(reader.Read<uint32_t>());
+  SkMatrix matrix;
+  const SkMatrix* matrix_ptr = ReadMatrix(reader, &matrix) ? &matrix : nullptr;
+  const DlColor* colors = static_cast<const DlColor*>(
+      reader.ReadBytes(stop_count * sizeof(DlColor)));
+  const float* stops =
+      static_cast<const float*>(reader.ReadBytes(stop_count * sizeof(float)));
+  if (!reader.ok()) {
+    return nullptr;
+  }
+  return maker(stop_count, colors, stops, tile_mode, matrix_ptr);
+}
+
+std::shared_ptr<DlColorSource> ReadColorSource(ByteReader& reader,
+                                               ImageTable& images) {
+  uint32_t type = reader.Read<uint32_t>();
+  switch (type) {
+    case kAttributeNull:
+      return nullptr;
+    case 1u:
+      return std::make_shared<DlColorColorSource>(
+          DlColor(reader.Read<uint32_t>()));
+    case 2u: {
+      SkPoint start = reader.Read<SkPoint>();
+      SkPoint end = reader.Read<SkPoint>();
+      return ReadGradient(
+          reader, [&](uint32_t count, const DlColor* colors, const float* stops,
+                      DlTileMode mode, const SkMatrix* matrix) {
+            return DlColorSource::MakeLinear(start, end, count, colors, stops,
+                                             mode, matrix);
+          });
+    }
+    case 3u: {
+      SkPoint center = reader.Read<SkPoint>();
+      SkScalar radius = reader.Read<SkScalar>();
+      return ReadGradient(
+          reader, [&](uint32_t count, const DlColor* colors, const float* stops,
+                      DlTileMode mode, const SkMatrix* matrix) {
+            return DlColorSource::MakeRadial(center, radius, count, colors,
+                                             stops, mode, matrix);
+          });
+    }
+    case 4u: {
+      SkPoint start_center = reader.Read<SkPoint>();
+      SkScalar start_radius = reader.Read<SkScalar>();
+      SkPoint end_center = reader.Read<SkPoint>();
+      SkScalar end_radius = reader.Read<SkScalar>();
+      return ReadGradient(
+          reader, [&](uint32_t count, const DlColor* colors, const float* stops,
+                      DlTileMode mode, const SkMatrix* matrix) {
+            return DlColorSource::MakeConical(start_center, start_radius,
+                                              end_center, end_radius, count,
+                                              colors, stops, mode, matrix);
+          });
+    }
+    case 5u: {
+      SkPoint center = reader.Read<SkPoint>();
+      SkScalar start = reader.Read<SkScalar>();
+      SkScalar end = reader.Read<SkScalar>();
+      return ReadGradient(
+          reader, [&](uint32_t count, const DlColor* colors, const float* stops,
+                      DlTileMode mode, const SkMatrix* matrix) {
+            return DlColorSource::MakeSweep(center, start, end, count, colors,
+                                            stops, mode, matrix);
+          });
+    }
+    case 6u: {
+      sk_sp<DlImage> image = images.Get(reader.Read<uint32_t>());
+      DlTileMode horizontal = static_cast<DlTileMode>(reader.Read<uint32_t>());
+      DlTileMode vertical = static_cast<DlTileMode>(reader.Read<uint32_t>());
+      DlImageSampling sampling =
+          static_cast<DlImageSampling>(reader.Read<uint32_t>());
+      SkMatrix matrix;
+      const SkMatrix* matrix_ptr =
+          ReadMatrix(reader, &matrix) ? &matrix : nullptr;
+      if (!image) {
+        reader.Invalidate();
+        return nullptr;
+      }
+      return std::make_shared<DlImageColorSource>(image, horizontal, vertical,
+                                                  sampling, matrix_ptr);
+    }
+    default:
+      reader.Invalidate();
+      return nullptr;
+  }
+}
+
+}  // namespace
+
+sk_sp<SkData> DisplayListSerializer::Serialize(
+    const sk_sp<DisplayList>& display_list,
+    DlImageSerializer* image_serializer) {
+  if (!display_list) {
+    return nullptr;
+  }
+  Serializer serializer(image_serializer);
+  display_list->Dispatch(serializer);
+  if (!serializer.success()) {
+    return nullptr;
+  }
+  return serializer.Finish();
+}
+
+sk_sp<DisplayList> DisplayListDeserializer::Deserialize(
+    const void* data,
+    size_t size,
+    DlImageDeserializer* image_deserializer) {
+  DisplayListBuilder builder;
+  if (!Replay(data, size, builder, image_deserializer)) {
+    return nullptr;
+  }
+  return builder.Build();
+}
+
+bool DisplayListDeserializer::Replay(const void* data,
+                                     size_t size,
+                                     Dispatcher& dispatcher,
+                                     DlImageDeserializer* image_deserializer) {
+  if (data == nullptr) {
+    return false;
+  }
+  ByteReader reader(static_cast<const uint8_t*>(data), size);
+  if (reader.Read<uint32_t>() != kSignature ||
+      reader.Read<uint32_t>() != kVersion) {
+    return false;
+  }
+  ImageTable images(image_deserializer);
+  uint32_t image_count = reader.Read<uint32_t>();
+  for (uint32_t i = 0; i < image_count && reader.ok(); i++) {
+    uint32_t byte_count = reader.Read<uint32_t>();
+    const void* bytes = reader.ReadBytes(byte_count);
+    if (bytes == nullptr) {
+      return false;
+    }
+    images.Add(bytes, byte_count);
+  }
+  while (reader.ok() && !reader.AtEnd()) {
+    RecordType tag = static_cast<RecordType>(reader.Read<uint32_t>());
+    switch (tag) {
+      case RecordType::kSetAntiAlias:
+        dispatcher.setAntiAlias(reader.ReadBool());
+        break;
+      case RecordType::kSetDither:
+        dispatcher.setDither(reader.ReadBool());
+        break;
+      case RecordType::kSetStyle:
+        dispatcher.setStyle(static_cast<DlDrawStyle>(reader.Read<uint32_t>()));
+        break;
+      case RecordType::kSetColor:
+        dispatcher.setColor(DlColor(reader.Read<uint32_t>()));
+        break;
+      case RecordType::kSetStrokeWidth:
+        dispatcher.setStrokeWidth(reader.Read<float>());
+        break;
+      case RecordType::kSetStrokeMiter:
+        dispatcher.setStrokeMiter(reader.Read<float>());
+        break;
+      case RecordType::kSetStrokeCap:
+        dispatcher.setStrokeCap(
+            static_cast<DlStrokeCap>(reader.Read<uint32_t>()));
+        break;
+      case RecordType::kSetStrokeJoin:
+        dispatcher.setStrokeJoin(
+            static_cast<DlStrokeJoin>(reader.Read<uint32_t>()));
+        break;
+      case RecordType::kSetColorSource: {
+        std::shared_ptr<DlColorSource> source =
+            ReadColorSource(reader, images);
+        if (!reader.ok()) {
+          return false;
+        }
+        dispatcher.setColorSource(source.get());
+        break;
+      }
+      case RecordType::kSetColorFilter: {
+        std::shared_ptr<DlColorFilter> filter = ReadColorFilter(reader);
+        if (!reader.ok()) {
+          return false;
+        }
+        dispatcher.setColorFilter(filter.get());
+        break;
+      }
+      case RecordType::kSetInvertColors:
+        dispatcher.setInvertColors(reader.ReadBool());
+        break;
+      case RecordType::kSetBlendMode:
+        dispatcher.setBlendMode(
+            static_cast<DlBlendMode>(reader.Read<uint32_t>()));
+        break;
+      case RecordType::kSetPathEffect: {
+        if (reader.Read<uint32_t>() == kAttributeNull) {
+          dispatcher.setPathEffect(nullptr);
+          break;
+        }
+        uint32_t count = reader.Read<uint32_t>();
+        SkScalar phase = reader.Read<SkScalar>();
+        const SkScalar* intervals = static_cast<const SkScalar*>(
+            reader.ReadBytes(count * sizeof(SkScalar)));
+        if (!reader.ok()) {
+          return false;
+        }
+        std::shared_ptr<DlPathEffect> effect =
+            DlDashPathEffect::Make(intervals, count, phase);
+        dispatcher.setPathEffect(effect.get());
+        break;
+      }
+      case RecordType::kSetMaskFilter: {
+        if (reader.Read<uint32_t>() == kAttributeNull) {
+          dispatcher.setMaskFilter(nullptr);
+          break;
+        }
+        SkBlurStyle style = static_cast<SkBlurStyle>(reader.Read<uint32_t>());
+        SkScalar sigma = reader.Read<SkScalar>();
+        DlBlurMaskFilter filter(style, sigma);
+        dispatcher.setMaskFilter(&filter);
+        break;
+      }
+      case RecordType::kSetImageFilter: {
+        std::shared_ptr<DlImageFilter> filter = ReadImageFilter(reader);
+        if (!reader.ok()) {
+          return false;
+        }
+        dispatcher.setImageFilter(filter.get());
+        break;
+      }
+      case RecordType::kSave:
+        dispatcher.save();
+        break;
+      case RecordType::kSaveLayer: {
+        bool has_bounds = reader.ReadBool();
+        SkRect bounds;
+        if (has_bounds) {
+          bounds = reader.Read<SkRect>();
+        }
+        SaveLayerOptions options = reader.Read<SaveLayerOptions>();
+        std::shared_ptr<DlImageFilter> backdrop = ReadImageFilter(reader);
+        if (!reader.ok()) {
+          return false;
+        }
+        dispatcher.saveLayer(has_bounds ? &bounds : nullptr, options,
+                             backdrop.get());
+        break;
+      }
+      case RecordType::kRestore:
+        dispatcher.restore();
+        break;
+      case RecordType::kTranslate: {
+        SkScalar tx = reader.Read<SkScalar>();
+        SkScalar ty = reader.Read<SkScalar>();
+        dispatcher.translate(tx, ty);
+        break;
+      }
+      case RecordType::kScale: {
+        SkScalar sx = reader.Read<SkScalar>();
+        SkScalar sy = reader.Read<SkScalar>();
+        dispatcher.scale(sx, sy);
+        break;
+      }
+      case RecordType::kRotate:
+        dispatcher.rotate(reader.Read<SkScalar>());
+        break;
+      case RecordType::kSkew: {
+        SkScalar sx = reader.Read<SkScalar>();
+        SkScalar sy = reader.Read<SkScalar>();
+        dispatcher.skew(sx, sy);
+        break;
+      }
+      case RecordType::kTransform2DAffine: {
+        SkScalar m[6];
+        for (auto& value : m) {
+          value = reader.Read<SkScalar>();
+        }
+        dispatcher.transform2DAffine(m[0], m[1], m[2], m[3], m[4], m[5]);
+        break;
+      }
+      case RecordType::kTransformFullPerspective: {
+        SkScalar m[16];
+        for (auto& value : m) {
+          value = reader.Read<SkScalar>();
+        }
+        // clang-format off
+        dispatcher.transformFullPerspective(
+            m[0],  m[1],  m[2],  m[3],
+            m[4],  m[5],  m[6],  m[7],
+            m[8],  m[9],  m[10], m[11],
+            m[12], m[13], m[14], m[15]);
+        // clang-format on
+        break;
+      }
+      case RecordType::kTransformReset:
+        dispatcher.transformReset();
+        break;
+      case RecordType::kClipRect: {
+        SkRect rect = reader.Read<SkRect>();
+        SkClipOp clip_op = static_cast<SkClipOp>(reader.Read<uint32_t>());
+        dispatcher.clipRect(rect, clip_op, reader.ReadBool());
+        break;
+      }
+      case RecordType::kClipRRect: {
+        SkRRect rrect = ReadRRect(reader);
+        SkClipOp clip_op = static_cast<SkClipOp>(reader.Read<uint32_t>());
+        dispatcher.clipRRect(rrect, clip_op, reader.ReadBool());
+        break;
+      }
+      case RecordType::kClipPath: {
+        SkPath path = ReadPath(reader);
+        SkClipOp clip_op = static_cast<SkClipOp>(reader.Read<uint32_t>());
+        dispatcher.clipPath(path, clip_op, reader.ReadBool());
+        break;
+      }
+      case RecordType::kDrawColor: {
+        DlColor color(reader.Read<uint32_t>());
+        dispatcher.drawColor(
+            color, static_cast<DlBlendMode>(reader.Read<uint32_t>()));
+        break;
+      }
+      case RecordType::kDrawPaint:
+        dispatcher.drawPaint();
+        break;
+      case RecordType::kDrawLine: {
+        SkPoint p0 = reader.Read<SkPoint>();
+        SkPoint p1 = reader.Read<SkPoint>();
+        dispatcher.drawLine(p0, p1);
+        break;
+      }
+      case RecordType::kDrawRect:
+        dispatcher.drawRect(reader.Read<SkRect>());
+        break;
+      case RecordType::kDrawOval:
+        dispatcher.drawOval(reader.Read<SkRect>());
+        break;
+      case RecordType::kDrawCircle: {
+        SkPoint center = reader.Read<SkPoint>();
+        dispatcher.drawCircle(center, reader.Read<SkScalar>());
+        break;
+      }
+      case RecordType::kDrawRRect:
+        dispatcher.drawRRect(ReadRRect(reader));
+        break;
+      case RecordType::kDrawDRRect: {
+        SkRRect outer = ReadRRect(reader);
+        SkRRect inner = ReadRRect(reader);
+        dispatcher.drawDRRect(outer, inner);
+        break;
+      }
+      case RecordType::kDrawPath:
+        dispatcher.drawPath(ReadPath(reader));
+        break;
+      case RecordType::kDrawArc: {
+        SkRect oval_bounds = reader.Read<SkRect>();
+        SkScalar start_degrees = reader.Read<SkScalar>();
+        SkScalar sweep_degrees = reader.Read<SkScalar>();
+        dispatcher.drawArc(oval_bounds, start_degrees, sweep_degrees,
+                           reader.ReadBool());
+        break;
+      }
+      case RecordType::kDrawPoints: {
+        SkCanvas::PointMode mode =
+            static_cast<SkCanvas::PointMode>(reader.Read<uint32_t>());
+        uint32_t count = reader.Read<uint32_t>();
+        const SkPoint* points = static_cast<const SkPoint*>(
+            reader.ReadBytes(count * sizeof(SkPoint)));
+        if (!reader.ok()) {
+          return false;
+        }
+        dispatcher.drawPoints(mode, count, points);
+        break;
+      }
+      case RecordType::kDrawVertices: {
+        DlBlendMode blend_mode =
+            static_cast<DlBlendMode>(reader.Read<uint32_t>());
+        DlVertexMode vertex_mode =
+            static_cast<DlVertexMode>(reader.Read<uint32_t>());
+        uint32_t vertex_count = reader.Read<uint32_t>();
+        uint32_t index_count = reader.Read<uint32_t>();
+        bool has_texture_coordinates = reader.ReadBool();
+        bool has_colors = reader.ReadBool();
+        const SkPoint* vertices = static_cast<const SkPoint*>(
+            reader.ReadBytes(vertex_count * sizeof(SkPoint)));
+        const SkPoint* texture_coordinates =
+            has_texture_coordinates
+                ? static_cast<const SkPoint*>(
+                      reader.ReadBytes(vertex_count * sizeof(SkPoint)))
+                : nullptr;
+        const DlColor* colors =
+            has_colors ? static_cast<const DlColor*>(
+                             reader.ReadBytes(vertex_count * sizeof(DlColor)))
+                       : nullptr;
+        const uint16_t* indices =
+            index_count > 0
+                ? static_cast<const uint16_t*>(
+                      reader.ReadBytes(index_count * sizeof(uint16_t)))
+                : nullptr;
+        if (!reader.ok()) {
+          return false;
+        }
+        std::shared_ptr<DlVertices> dl_vertices =
+            DlVertices::Make(vertex_mode, vertex_count, vertices,
+                             texture_coordinates, colors, index_count, indices);
+        dispatcher.drawVertices(dl_vertices.get(), blend_mode);
+        break;
+      }
+      case RecordType::kDrawImage: {
+        sk_sp<DlImage> image = images.Get(reader.Read<uint32_t>());
+        SkPoint point = reader.Read<SkPoint>();
+        DlImageSampling sampling =
+            static_cast<DlImageSampling>(reader.Read<uint32_t>());
+        bool render_with_attributes = reader.ReadBool();
+        if (!image || !reader.ok()) {
+          return false;
+        }
+        dispatcher.drawImage(image, point, sampling, render_with_attributes);
+        break;
+      }
+      case RecordType::kDrawImageRect: {
+        sk_sp<DlImage> image = images.Get(reader.Read<uint32_t>());
+        SkRect src = reader.Read<SkRect>();
+        SkRect dst = reader.Read<SkRect>();
+        DlImageSampling sampling =
+            static_cast<DlImageSampling>(reader.Read<uint32_t>());
+        bool render_with_attributes = reader.ReadBool();
+        SkCanvas::SrcRectConstraint constraint =
+            static_cast<SkCanvas::SrcRectConstraint>(reader.Read<uint32_t>());
+        if (!image || !reader.ok()) {
+          return false;
+        }
+        dispatcher.drawImageRect(image, src, dst, sampling,
+                                 render_with_attributes, constraint);
+        break;
+      }
+      case RecordType::kDrawImageNine: {
+        sk_sp<DlImage> image = images.Get(reader.Read<uint32_t>());
+        SkIRect center = reader.Read<SkIRect>();
+        SkRect dst = reader.Read<SkRect>();
+        DlFilterMode filter = static_cast<DlFilterMode>(reader.Read<uint32_t>());
+        bool render_with_attributes = reader.ReadBool();
+        if (!image || !reader.ok()) {
+          return false;
+        }
+        dispatcher.drawImageNine(image, center, dst, filter,
+                                 render_with_attributes);
+        break;
+      }
+      case RecordType::kDrawImageLattice: {
+        sk_sp<DlImage> image = images.Get(reader.Read<uint32_t>());
+        SkRect dst = reader.Read<SkRect>();
+        DlFilterMode filter = static_cast<DlFilterMode>(reader.Read<uint32_t>());
+        bool render_with_attributes = reader.ReadBool();
+        int32_t x_count = reader.Read<int32_t>();
+        int32_t y_count = reader.Read<int32_t>();
+        bool has_bounds = reader.ReadBool();
+        SkIRect bounds;
+        if (has_bounds) {
+          bounds = reader.Read<SkIRect>();
+        }
+        const int32_t* x_divs = static_cast<const int32_t*>(
+            reader.ReadBytes(x_count * sizeof(int32_t)));
+        const int32_t* y_divs = static_cast<const int32_t*>(
+            reader.ReadBytes(y_count * sizeof(int32_t)));
+        uint32_t cell_count = (x_count + 1) * (y_count + 1);
+        const SkCanvas::Lattice::RectType* rect_types =
+            reader.ReadBool()
+                ? static_cast<const SkCanvas::Lattice::RectType*>(
+                      reader.ReadBytes(cell_count))
+                : nullptr;
+        const SkColor* lattice_colors =
+            reader.ReadBool()
+                ? static_cast<const SkColor*>(
+                      reader.ReadBytes(cell_count * sizeof(SkColor)))
+                : nullptr;
+        if (!image || !reader.ok()) {
+          return false;
+        }
+        SkCanvas::Lattice lattice = {x_divs,
+                                     y_divs,
+                                     rect_types,
+                                     x_count,
+                                     y_count,
+                                     has_bounds ? &bounds : nullptr,
+                                     lattice_colors};
+        dispatcher.drawImageLattice(image, lattice, dst, filter,
+                                    render_with_attributes);
+        break;
+      }
+      case RecordType::kDrawAtlas: {
+        sk_sp<DlImage> atlas = images.Get(reader.Read<uint32_t>());
+        uint32_t count = reader.Read<uint32_t>();
+        DlBlendMode mode = static_cast<DlBlendMode>(reader.Read<uint32_t>());
+        DlImageSampling sampling =
+            static_cast<DlImageSampling>(reader.Read<uint32_t>());
+        bool render_with_attributes = reader.ReadBool();
+        bool has_cull_rect = reader.ReadBool();
+        SkRect cull_rect;
+        if (has_cull_rect) {
+          cull_rect = reader.Read<SkRect>();
+        }
+        bool has_colors = reader.ReadBool();
+        const SkRSXform* xform = static_cast<const SkRSXform*>(
+            reader.ReadBytes(count * sizeof(SkRSXform)));
+        const SkRect* tex =
+            static_cast<const SkRect*>(reader.ReadBytes(count * sizeof(SkRect)));
+        const DlColor* colors =
+            has_colors ? static_cast<const DlColor*>(
+                             reader.ReadBytes(count * sizeof(DlColor)))
+                       : nullptr;
+        if (!atlas || !reader.ok()) {
+          return false;
+        }
+        dispatcher.drawAtlas(atlas, xform, tex, colors, count, mode, sampling,
+                             has_cull_rect ? &cull_rect : nullptr,
+                             render_with_attributes);
+        break;
+      }
+      case RecordType::kDrawDisplayList: {
+        uint32_t byte_count = reader.Read<uint32_t>();
+        const void* bytes = reader.ReadBytes(byte_count);
+        if (bytes == nullptr) {
+          return false;
+        }
+        sk_sp<DisplayList> nested =
+            Deserialize(bytes, byte_count, image_deserializer);
+        if (!nested) {
+          return false;
+        }
+        dispatcher.drawDisplayList(nested);
+        break;
+      }
+      case RecordType::kDrawTextBlob: {
+        SkScalar x = reader.Read<SkScalar>();
+        SkScalar y = reader.Read<SkScalar>();
+        uint32_t byte_count = reader.Read<uint32_t>();
+        const void* bytes = reader.ReadBytes(byte_count);
+        if (bytes == nullptr) {
+          return false;
+        }
+        sk_sp<SkTextBlob> blob =
+            SkTextBlob::Deserialize(bytes, byte_count, SkDeserialProcs{});
+        if (!blob) {
+          return false;
+        }
+        dispatcher.drawTextBlob(blob, x, y);
+        break;
+      }
+      case RecordType::kDrawShadow: {
+        SkPath path = ReadPath(reader);
+        DlColor color(reader.Read<uint32_t>());
+        SkScalar elevation = reader.Read<SkScalar>();
+        bool transparent_occluder = reader.ReadBool();
+        SkScalar dpr = reader.Read<SkScalar>();
+        if (!reader.ok()) {
+          return false;
+        }
+        dispatcher.drawShadow(path, color, elevation, transparent_occluder,
+                              dpr);
+        break;
+      }
+      default:
+        return false;
+    }
+  }
+  return reader.ok();
+}
+
+}  // namespace flutter
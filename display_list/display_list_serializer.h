@@ -0,0 +1,107 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_SERIALIZER_H_
+#define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_SERIALIZER_H_
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/display_list/display_list_dispatcher.h"
+#include "third_party/skia/include/core/SkData.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      A hook through which the serializer externalizes the pixel
+///             data behind a |DlImage| reference.
+///
+///             The serialized format stores each distinct image exactly once
+///             in a table and refers to it by index from the drawing records.
+///             The engine does not impose an encoding; the embedder decides
+///             whether to store encoded bytes, raw pixels, or just a stable
+///             identifier that the matching |DlImageDeserializer| can resolve
+///             in the consuming process.
+class DlImageSerializer {
+ public:
+  virtual ~DlImageSerializer() = default;
+
+  /// Returns the bytes that represent |image| in the serialized stream, or
+  /// nullptr if the image cannot be externalized, which aborts the
+  /// serialization of the display list referencing it.
+  virtual sk_sp<SkData> SerializeImage(const sk_sp<DlImage>& image) = 0;
+};
+
+//------------------------------------------------------------------------------
+/// @brief      The inverse hook of |DlImageSerializer|, turning the bytes
+///             stored in the image table back into a usable |DlImage|.
+class DlImageDeserializer {
+ public:
+  virtual ~DlImageDeserializer() = default;
+
+  /// Returns the image for a table entry written by the matching
+  /// |DlImageSerializer|, or nullptr if it cannot be resolved, which aborts
+  /// the replay of the display list referencing it.
+  virtual sk_sp<DlImage> DeserializeImage(const SkData& data) = 0;
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Writes a |DisplayList| into a versioned, pointer-free binary
+///             format that can be persisted across process runs or shipped
+///             between processes.
+///
+///             The format stores a header, a table of serialized images, and
+///             a stream of tagged records mirroring the |Dispatcher| methods.
+///             Every record payload is aligned so that bulk payloads (point,
+///             vertex and gradient stop arrays) can be replayed directly out
+///             of a read-only mapping of the serialized bytes without
+///             copying.
+///
+///             Records that inherently wrap process-local Skia objects
+///             cannot be made pointer-free and cause serialization to fail:
+///             SkPicture and SkVertices references, SkBlender attributes,
+///             runtime effect color sources and the "unknown" attribute
+///             wrappers captured from bare Skia objects. Display lists
+///             recorded through |DisplayListBuilder| from the framework
+///             never contain those records.
+class DisplayListSerializer {
+ public:
+  /// Serializes |display_list|, externalizing any image references through
+  /// |image_serializer|. Returns nullptr if the list contains a record the
+  /// format cannot represent, or if it references an image and
+  /// |image_serializer| is null or fails to serialize it.
+  static sk_sp<SkData> Serialize(const sk_sp<DisplayList>& display_list,
+                                 DlImageSerializer* image_serializer = nullptr);
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Replays the bytes produced by |DisplayListSerializer|.
+///
+///             The serialized form is not hardened against hostile input;
+///             callers should only replay data that they (or a trusted
+///             process) wrote.
+class DisplayListDeserializer {
+ public:
+  /// Rebuilds a full |DisplayList| from serialized bytes, resolving image
+  /// table entries through |image_deserializer|. Returns nullptr if the
+  /// bytes are not a recognized serialization or an image cannot be
+  /// resolved.
+  static sk_sp<DisplayList> Deserialize(
+      const void* data,
+      size_t size,
+      DlImageDeserializer* image_deserializer = nullptr);
+
+  /// Replays serialized bytes directly into |dispatcher| without building
+  /// an intermediate |DisplayList|. The buffer - typically a read-only mmap
+  /// of a file written by |DisplayListSerializer| - must remain valid for
+  /// the duration of the call; bulk payloads are handed to the dispatcher
+  /// in place. Returns false if the bytes are not a recognized
+  /// serialization or an image cannot be resolved.
+  static bool Replay(const void* data,
+                     size_t size,
+                     Dispatcher& dispatcher,
+                     DlImageDeserializer* image_deserializer = nullptr);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DISPLAY_LIST_SERIALIZER_H_
@@ -0,0 +1,212 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_serializer.h"
+
+#include <cstring>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/testing/testing.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkVertices.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// Stores images as raw N32 pixels prefixed with their dimensions so the
+// tests do not depend on any codec.
+class TestImageSerializer : public DlImageSerializer {
+ public:
+  sk_sp<SkData> SerializeImage(const sk_sp<DlImage>& image) override {
+    serialize_count_++;
+    sk_sp<SkImage> sk_image = image->skia_image();
+    if (!sk_image) {
+      return nullptr;
+    }
+    SkImageInfo info =
+        SkImageInfo::MakeN32Premul(sk_image->width(), sk_image->height());
+    sk_sp<SkData> data = SkData::MakeUninitialized(2 * sizeof(int32_t) +
+                                                   info.computeMinByteSize());
+    int32_t* header = static_cast<int32_t*>(data->writable_data());
+    header[0] = sk_image->width();
+    header[1] = sk_image->height();
+    if (!sk_image->readPixels(info, header + 2, info.minRowBytes(), 0, 0)) {
+      return nullptr;
+    }
+    return data;
+  }
+
+  int serialize_count() const { return serialize_count_; }
+
+ private:
+  int serialize_count_ = 0;
+};
+
+class TestImageDeserializer : public DlImageDeserializer {
+ public:
+  sk_sp<DlImage> DeserializeImage(const SkData& data) override {
+    deserialize_count_++;
+    const int32_t* header = static_cast<const int32_t*>(data.data());
+    SkImageInfo info = SkImageInfo::MakeN32Premul(header[0], header[1]);
+    SkBitmap bitmap;
+    bitmap.allocPixels(info);
+    memcpy(bitmap.getPixels(), header + 2, info.computeMinByteSize());
+    bitmap.setImmutable();
+    return DlImage::Make(SkImage::MakeFromBitmap(bitmap));
+  }
+
+  int deserialize_count() const { return deserialize_count_; }
+
+ private:
+  int deserialize_count_ = 0;
+};
+
+sk_sp<DlImage> MakeTestImage() {
+  SkBitmap bitmap;
+  bitmap.allocPixels(SkImageInfo::MakeN32Premul(16, 16));
+  bitmap.eraseColor(SK_ColorGREEN);
+  bitmap.setImmutable();
+  return DlImage::Make(SkImage::MakeFromBitmap(bitmap));
+}
+
+}  // namespace
+
+TEST(DisplayListSerializer, RoundTripPreservesContent) {
+  DisplayListBuilder builder;
+  builder.setAntiAlias(true);
+  builder.setColor(DlColor(0xFF123456));
+  builder.setStrokeWidth(3.5f);
+  builder.drawLine({0, 0}, {100, 100});
+
+  DlColor colors[] = {DlColor::kRed(), DlColor::kBlue()};
+  float stops[] = {0.0f, 1.0f};
+  builder.setColorSource(DlColorSource::MakeLinear({0, 0}, {100, 100}, 2,
+                                                   colors, stops,
+                                                   DlTileMode::kClamp)
+                             .get());
+  builder.drawRect(SkRect::MakeLTRB(10, 10, 80, 80));
+  builder.setColorSource(nullptr);
+
+  DlBlurMaskFilter mask_filter(kNormal_SkBlurStyle, 2.0f);
+  builder.setMaskFilter(&mask_filter);
+  builder.drawCircle({50, 50}, 25);
+  builder.setMaskFilter(nullptr);
+
+  SkScalar intervals[] = {4.0f, 2.0f};
+  builder.setPathEffect(DlDashPathEffect::Make(intervals, 2, 0.5f).get());
+  builder.drawOval(SkRect::MakeLTRB(20, 20, 60, 40));
+  builder.setPathEffect(nullptr);
+
+  DlBlurImageFilter image_filter(3.0f, 3.0f, DlTileMode::kDecal);
+  builder.setImageFilter(&image_filter);
+  builder.drawRRect(
+      SkRRect::MakeRectXY(SkRect::MakeLTRB(5, 5, 55, 55), 4, 4));
+  builder.setImageFilter(nullptr);
+
+  builder.save();
+  builder.translate(10, 20);
+  builder.rotate(45);
+  builder.clipRect(SkRect::MakeLTRB(0, 0, 200, 200), SkClipOp::kIntersect,
+                   true);
+  SkPath path;
+  path.moveTo(0, 0);
+  path.cubicTo(10, 10, 20, 0, 30, 10);
+  builder.drawPath(path);
+  builder.restore();
+
+  SkRect layer_bounds = SkRect::MakeLTRB(0, 0, 100, 100);
+  builder.saveLayer(&layer_bounds, true);
+  builder.drawArc(SkRect::MakeLTRB(10, 10, 90, 90), 15, 270, false);
+  builder.restore();
+
+  SkPoint points[] = {{0, 0}, {10, 10}, {20, 0}};
+  builder.drawPoints(SkCanvas::kPolygon_PointMode, 3, points);
+  builder.drawShadow(path, DlColor::kBlack(), 4.0f, false, 1.0f);
+  auto original = builder.Build();
+
+  sk_sp<SkData> data = DisplayListSerializer::Serialize(original);
+  ASSERT_NE(data, nullptr);
+
+  auto copy =
+      DisplayListDeserializer::Deserialize(data->data(), data->size());
+  ASSERT_NE(copy, nullptr);
+  ASSERT_EQ(copy->op_count(), original->op_count());
+  ASSERT_EQ(copy->bounds(), original->bounds());
+  ASSERT_TRUE(copy->Equals(original.get()));
+}
+
+TEST(DisplayListSerializer, ImagesAreTabledOnce) {
+  auto image = MakeTestImage();
+  DisplayListBuilder builder;
+  builder.drawImage(image, {0, 0}, DlImageSampling::kLinear, false);
+  builder.drawImage(image, {20, 20}, DlImageSampling::kLinear, false);
+  builder.drawImageRect(image, SkRect::MakeLTRB(0, 0, 16, 16),
+                        SkRect::MakeLTRB(0, 0, 32, 32),
+                        DlImageSampling::kLinear, false,
+                        SkCanvas::kFast_SrcRectConstraint);
+  auto original = builder.Build();
+
+  TestImageSerializer image_serializer;
+  sk_sp<SkData> data =
+      DisplayListSerializer::Serialize(original, &image_serializer);
+  ASSERT_NE(data, nullptr);
+  // The same image was referenced three times but externalized once.
+  ASSERT_EQ(image_serializer.serialize_count(), 1);
+
+  TestImageDeserializer image_deserializer;
+  auto copy = DisplayListDeserializer::Deserialize(data->data(), data->size(),
+                                                   &image_deserializer);
+  ASSERT_NE(copy, nullptr);
+  ASSERT_EQ(copy->op_count(), original->op_count());
+  ASSERT_EQ(copy->bounds(), original->bounds());
+  // The table entry was also resolved only once on replay.
+  ASSERT_EQ(image_deserializer.deserialize_count(), 1);
+}
+
+TEST(DisplayListSerializer, ImageWithoutHookFailsSerialization) {
+  DisplayListBuilder builder;
+  builder.drawImage(MakeTestImage(), {0, 0}, DlImageSampling::kLinear, false);
+  auto display_list = builder.Build();
+
+  ASSERT_EQ(DisplayListSerializer::Serialize(display_list), nullptr);
+}
+
+TEST(DisplayListSerializer, UnrepresentableRecordsFailSerialization) {
+  SkPoint vertices[3] = {{0, 0}, {10, 0}, {5, 10}};
+  DisplayListBuilder builder;
+  builder.drawSkVertices(
+      SkVertices::MakeCopy(SkVertices::kTriangles_VertexMode, 3, vertices,
+                           nullptr, nullptr),
+      SkBlendMode::kSrcOver);
+  auto display_list = builder.Build();
+
+  ASSERT_EQ(DisplayListSerializer::Serialize(display_list), nullptr);
+}
+
+TEST(DisplayListSerializer, RejectsUnrecognizedBytes) {
+  DisplayListBuilder builder;
+  builder.drawRect(SkRect::MakeLTRB(10, 10, 20, 20));
+  sk_sp<SkData> data = DisplayListSerializer::Serialize(builder.Build());
+  ASSERT_NE(data, nullptr);
+
+  ASSERT_EQ(DisplayListDeserializer::Deserialize(nullptr, 0), nullptr);
+
+  // A corrupted signature is rejected outright.
+  sk_sp<SkData> bad_signature = SkData::MakeWithCopy(data->data(), data->size());
+  static_cast<uint8_t*>(bad_signature->writable_data())[0] ^= 0xFF;
+  ASSERT_EQ(DisplayListDeserializer::Deserialize(bad_signature->data(),
+                                                 bad_signature->size()),
+            nullptr);
+
+  // Truncation inside the record stream is caught by the reader.
+  ASSERT_EQ(
+      DisplayListDeserializer::Deserialize(data->data(), data->size() - 4),
+      nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
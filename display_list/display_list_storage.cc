@@ -0,0 +1,69 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_storage.h"
+
+#include <mutex>
+
+namespace flutter {
+
+namespace {
+
+// The pool is shared across threads rather than kept thread-local because
+// the builder that allocates chunks runs on the UI thread while the last
+// reference to a DisplayList is routinely dropped on the raster thread;
+// a per-thread pool would fill up where nothing records and stay empty
+// where everything does. The lock is uncontended in practice - a frame
+// touches it a handful of times, once per chunk.
+std::mutex& PoolMutex() {
+  static std::mutex* mutex = new std::mutex();
+  return *mutex;
+}
+
+std::vector<DisplayListStorage::Chunk::Buffer>& Pool() {
+  static auto* pool = new std::vector<DisplayListStorage::Chunk::Buffer>();
+  return *pool;
+}
+
+}  // namespace
+
+DisplayListStorage::~DisplayListStorage() {
+  for (Chunk& chunk : chunks_) {
+    if (chunk.capacity_ == kChunkSize) {
+      RecyclePooledBuffer(std::move(chunk.data_));
+    }
+  }
+}
+
+DisplayListStorage::Chunk::Buffer DisplayListStorage::ClaimPooledBuffer() {
+  {
+    std::scoped_lock lock(PoolMutex());
+    if (!Pool().empty()) {
+      Chunk::Buffer buffer = std::move(Pool().back());
+      Pool().pop_back();
+      return buffer;
+    }
+  }
+  return Chunk::Buffer(static_cast<uint8_t*>(sk_malloc_throw(kChunkSize)));
+}
+
+void DisplayListStorage::RecyclePooledBuffer(Chunk::Buffer buffer) {
+  std::scoped_lock lock(PoolMutex());
+  if (Pool().size() < kMaxPooledChunks) {
+    Pool().push_back(std::move(buffer));
+  }
+  // Otherwise the buffer is freed as it goes out of scope.
+}
+
+size_t DisplayListStorage::PooledChunkCount() {
+  std::scoped_lock lock(PoolMutex());
+  return Pool().size();
+}
+
+void DisplayListStorage::DrainPoolForTesting() {
+  std::scoped_lock lock(PoolMutex());
+  Pool().clear();
+}
+
+}  // namespace flutter
@@ -0,0 +1,168 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_STORAGE_H_
+#define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_STORAGE_H_
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "flutter/display_list/types.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+// The backing store for the op records of a DisplayList.
+//
+// Ops are recorded into fixed-size chunks that are never reallocated, so
+// recording cost stays proportional to the bytes recorded (no doubling
+// copies of already-recorded ops) and pointers to recorded ops remain
+// stable for the lifetime of the storage. Ops never straddle a chunk
+// boundary; an op larger than the standard chunk size is placed in a
+// dedicated chunk of exactly its size.
+//
+// Because animating frames record display lists of near-identical size
+// every frame, the standard-size chunk buffers are recycled through a
+// process-wide pool: they are returned when the storage is destroyed
+// (typically when a frame's Picture is disposed) and claimed by the next
+// recording instead of hitting the allocator again. Oversized chunks are
+// rare and are not pooled.
+class DisplayListStorage {
+ public:
+  // The allocation granularity for op storage. Recording that outgrows the
+  // current chunk starts a new one rather than copying what was already
+  // recorded.
+  static constexpr size_t kChunkSize = 4096;
+
+  // The maximum number of standard-size chunk buffers retained for reuse;
+  // buffers released beyond this bound are freed normally.
+  static constexpr size_t kMaxPooledChunks = 64;
+
+  // A contiguous run of op records. The ops in [begin, end) can be
+  // traversed with the usual DLOp size walk.
+  class Chunk {
+   public:
+    uint8_t* begin() const { return data_.get(); }
+    uint8_t* end() const { return data_.get() + used_; }
+    size_t used() const { return used_; }
+
+    struct SkFreeDeleter {
+      void operator()(uint8_t* p) { sk_free(p); }
+    };
+    using Buffer = std::unique_ptr<uint8_t, SkFreeDeleter>;
+
+   private:
+    friend class DisplayListStorage;
+
+    explicit Chunk(size_t capacity)
+        : Chunk(Buffer(static_cast<uint8_t*>(sk_malloc_throw(capacity))),
+                capacity) {}
+
+    Chunk(Buffer buffer, size_t capacity)
+        : data_(std::move(buffer)), capacity_(capacity) {
+      // Zero the chunk up front so that alignment padding within op
+      // records is deterministic, keeping the bulk memcmp used by
+      // DisplayList::Equals valid. Recycled buffers still hold the ops
+      // of a previous recording and need this as much as fresh ones.
+      memset(data_.get(), 0, capacity);
+    }
+
+    Buffer data_;
+    size_t used_ = 0;
+    size_t capacity_ = 0;
+    // Logical offset of the chunk's first byte within the storage.
+    size_t offset_ = 0;
+  };
+
+  DisplayListStorage() = default;
+
+  DisplayListStorage(DisplayListStorage&& other)
+      : chunks_(std::move(other.chunks_)), used_(other.used_) {
+    other.chunks_.clear();
+    other.used_ = 0;
+  }
+
+  ~DisplayListStorage();
+
+  // Allocates |size| zeroed bytes for an op record and returns their
+  // address. The returned pointer remains valid until the storage is
+  // destroyed.
+  uint8_t* Allocate(size_t size) {
+    if (chunks_.empty() ||
+        chunks_.back().used_ + size > chunks_.back().capacity_) {
+      size_t capacity = std::max(size, kChunkSize);
+      Chunk chunk = capacity == kChunkSize
+                        ? Chunk(ClaimPooledBuffer(), kChunkSize)
+                        : Chunk(capacity);
+      chunk.offset_ = used_;
+      chunks_.push_back(std::move(chunk));
+    }
+    Chunk& chunk = chunks_.back();
+    uint8_t* ptr = chunk.data_.get() + chunk.used_;
+    chunk.used_ += size;
+    used_ += size;
+    return ptr;
+  }
+
+  // Grows the most recent allocation in place by |size| zeroed bytes so
+  // that the op it holds can be rewritten into a larger fused form.
+  // Returns false without changing anything if the bytes do not fit in
+  // the chunk holding that allocation.
+  bool ExtendLast(size_t size) {
+    if (chunks_.empty() ||
+        chunks_.back().used_ + size > chunks_.back().capacity_) {
+      return false;
+    }
+    chunks_.back().used_ += size;
+    used_ += size;
+    return true;
+  }
+
+  // Returns the address of the record byte at the given logical offset.
+  // The offset must fall within the used bytes of the storage.
+  uint8_t* At(size_t offset) const {
+    FML_DCHECK(offset < used_);
+    for (const Chunk& chunk : chunks_) {
+      if (offset - chunk.offset_ < chunk.used_) {
+        return chunk.data_.get() + (offset - chunk.offset_);
+      }
+    }
+    FML_DCHECK(false);
+    return nullptr;
+  }
+
+  const std::vector<Chunk>& chunks() const { return chunks_; }
+
+  // Total op record bytes over all chunks; allocation slack is not counted.
+  size_t used() const { return used_; }
+
+  // The number of chunk buffers currently waiting in the recycling pool.
+  // Exposed so tests can observe the recycling behavior.
+  static size_t PooledChunkCount();
+
+  // Frees all pooled chunk buffers. Used by tests to establish a known
+  // pool state; production code has no reason to call this.
+  static void DrainPoolForTesting();
+
+ private:
+  // Returns a recycled standard-size buffer, or a freshly allocated one if
+  // the pool is empty.
+  static Chunk::Buffer ClaimPooledBuffer();
+
+  // Offers a standard-size buffer back to the pool; frees it if the pool
+  // is at capacity.
+  static void RecyclePooledBuffer(Chunk::Buffer buffer);
+
+  std::vector<Chunk> chunks_;
+  size_t used_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DisplayListStorage);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DISPLAY_LIST_STORAGE_H_
@@ -138,20 +138,21 @@ std::vector<DisplayListInvocationGroup> CreateAllAttributesOps() {
        {
            {0, 96, 0, 0,
             [](DisplayListBuilder& b) { b.setColorSource(&kTestSource1); }},
-           // stop_count * (sizeof(float) + sizeof(uint32_t)) = 80
-           {0, 80 + 6 * 4, 0, 0,
+           // Gradient payloads are interned; the op holds a shared
+           // reference rather than an embedded copy of the stop arrays.
+           {0, 24, 0, 0,
             [](DisplayListBuilder& b) {
               b.setColorSource(kTestSource2.get());
             }},
-           {0, 80 + 6 * 4, 0, 0,
+           {0, 24, 0, 0,
             [](DisplayListBuilder& b) {
               b.setColorSource(kTestSource3.get());
             }},
-           {0, 88 + 6 * 4, 0, 0,
+           {0, 24, 0, 0,
             [](DisplayListBuilder& b) {
               b.setColorSource(kTestSource4.get());
             }},
-           {0, 80 + 6 * 4, 0, 0,
+           {0, 24, 0, 0,
             [](DisplayListBuilder& b) {
               b.setColorSource(kTestSource5.get());
             }},
@@ -304,7 +305,7 @@ std::vector<DisplayListInvocationGroup> CreateAllSaveRestoreOps() {
   return {
       {"Save(Layer)+Restore",
        {
-           {5, 104, 5, 104,
+           {5, 88, 5, 88,
             [](DisplayListBuilder& b) {
               b.saveLayer(nullptr, SaveLayerOptions::kNoAttributes,
                           &kTestCFImageFilter1);
@@ -320,7 +321,7 @@ std::vector<DisplayListInvocationGroup> CreateAllSaveRestoreOps() {
            // attributes to be distributed to the children. To prevent those
            // cases we include at least one clip operation and 2 overlapping
            // rendering primitives between each save/restore pair.
-           {5, 88, 5, 88,
+           {5, 72, 5, 72,
             [](DisplayListBuilder& b) {
               b.save();
               b.clipRect({0, 0, 25, 25}, SkClipOp::kIntersect, true);
@@ -328,7 +329,7 @@ std::vector<DisplayListInvocationGroup> CreateAllSaveRestoreOps() {
               b.drawRect({10, 10, 20, 20});
               b.restore();
             }},
-           {5, 88, 5, 88,
+           {5, 72, 5, 72,
             [](DisplayListBuilder& b) {
               b.saveLayer(nullptr, false);
               b.clipRect({0, 0, 25, 25}, SkClipOp::kIntersect, true);
@@ -336,7 +337,7 @@ std::vector<DisplayListInvocationGroup> CreateAllSaveRestoreOps() {
               b.drawRect({10, 10, 20, 20});
               b.restore();
             }},
-           {5, 88, 5, 88,
+           {5, 72, 5, 72,
             [](DisplayListBuilder& b) {
               b.saveLayer(nullptr, true);
               b.clipRect({0, 0, 25, 25}, SkClipOp::kIntersect, true);
@@ -344,7 +345,7 @@ std::vector<DisplayListInvocationGroup> CreateAllSaveRestoreOps() {
               b.drawRect({10, 10, 20, 20});
               b.restore();
             }},
-           {5, 104, 5, 104,
+           {5, 88, 5, 88,
             [](DisplayListBuilder& b) {
               b.saveLayer(&kTestBounds, false);
               b.clipRect({0, 0, 25, 25}, SkClipOp::kIntersect, true);
@@ -352,7 +353,7 @@ std::vector<DisplayListInvocationGroup> CreateAllSaveRestoreOps() {
               b.drawRect({10, 10, 20, 20});
               b.restore();
             }},
-           {5, 104, 5, 104,
+           {5, 88, 5, 88,
             [](DisplayListBuilder& b) {
               b.saveLayer(&kTestBounds, true);
               b.clipRect({0, 0, 25, 25}, SkClipOp::kIntersect, true);
@@ -369,7 +370,7 @@ std::vector<DisplayListInvocationGroup> CreateAllSaveRestoreOps() {
            //   b.drawRect({10, 10, 20, 20});
            //   b.restore();
            // }},
-           {5, 104, 5, 104,
+           {5, 88, 5, 88,
             [](DisplayListBuilder& b) {
               b.saveLayer(nullptr, SaveLayerOptions::kWithAttributes,
                           &kTestCFImageFilter1);
@@ -378,7 +379,7 @@ std::vector<DisplayListInvocationGroup> CreateAllSaveRestoreOps() {
               b.drawRect({10, 10, 20, 20});
               b.restore();
             }},
-           {5, 120, 5, 120,
+           {5, 104, 5, 104,
             [](DisplayListBuilder& b) {
               b.saveLayer(&kTestBounds, SaveLayerOptions::kNoAttributes,
                           &kTestCFImageFilter1);
@@ -387,7 +388,7 @@ std::vector<DisplayListInvocationGroup> CreateAllSaveRestoreOps() {
               b.drawRect({10, 10, 20, 20});
               b.restore();
             }},
-           {5, 120, 5, 120,
+           {5, 104, 5, 104,
             [](DisplayListBuilder& b) {
               b.saveLayer(&kTestBounds, SaveLayerOptions::kWithAttributes,
                           &kTestCFImageFilter1);
@@ -603,38 +604,38 @@ std::vector<DisplayListInvocationGroup> CreateAllRenderingOps() {
        }},
       {"DrawRect",
        {
-           {1, 24, 1, 24,
+           {1, 16, 1, 16,
             [](DisplayListBuilder& b) {
               b.drawRect({0, 0, 10, 10});
             }},
-           {1, 24, 1, 24,
+           {1, 16, 1, 16,
             [](DisplayListBuilder& b) {
               b.drawRect({0, 1, 10, 10});
             }},
-           {1, 24, 1, 24,
+           {1, 16, 1, 16,
             [](DisplayListBuilder& b) {
               b.drawRect({0, 0, 20, 10});
             }},
-           {1, 24, 1, 24,
+           {1, 16, 1, 16,
             [](DisplayListBuilder& b) {
               b.drawRect({0, 0, 10, 20});
             }},
        }},
       {"DrawOval",
        {
-           {1, 24, 1, 24,
+           {1, 16, 1, 16,
             [](DisplayListBuilder& b) {
               b.drawOval({0, 0, 10, 10});
             }},
-           {1, 24, 1, 24,
+           {1, 16, 1, 16,
             [](DisplayListBuilder& b) {
               b.drawOval({0, 1, 10, 10});
             }},
-           {1, 24, 1, 24,
+           {1, 16, 1, 16,
             [](DisplayListBuilder& b) {
               b.drawOval({0, 0, 20, 10});
             }},
-           {1, 24, 1, 24,
+           {1, 16, 1, 16,
             [](DisplayListBuilder& b) {
               b.drawOval({0, 0, 10, 20});
             }},
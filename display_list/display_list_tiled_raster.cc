@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_tiled_raster.h"
+
+#include <algorithm>
+
+#include "flutter/display_list/display_list_canvas_dispatcher.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+
+#include "third_party/skia/include/core/SkCanvas.h"
+
+namespace flutter {
+
+void DisplayListTiledRaster::Rasterize(const sk_sp<DisplayList>& display_list,
+                                       const SkPixmap& pixmap,
+                                       fml::BasicTaskRunner* worker_runner,
+                                       int tile_size) {
+  FML_DCHECK(tile_size > 0);
+  if (!display_list || pixmap.width() <= 0 || pixmap.height() <= 0) {
+    return;
+  }
+  int columns = (pixmap.width() + tile_size - 1) / tile_size;
+  int rows = (pixmap.height() + tile_size - 1) / tile_size;
+  if (worker_runner == nullptr || columns * rows <= 1) {
+    std::unique_ptr<SkCanvas> canvas = SkCanvas::MakeRasterDirect(
+        pixmap.info(), pixmap.writable_addr(), pixmap.rowBytes());
+    display_list->RenderTo(canvas.get());
+    return;
+  }
+
+  // Warm the lazily computed bounds and R-Tree on the calling thread so
+  // the per-tile culled dispatches below only read shared state.
+  display_list->bounds();
+  display_list->rtree();
+
+  fml::CountDownLatch latch(columns * rows);
+  for (int row = 0; row < rows; row++) {
+    for (int column = 0; column < columns; column++) {
+      SkIRect tile = SkIRect::MakeXYWH(
+          column * tile_size, row * tile_size,
+          std::min(tile_size, pixmap.width() - column * tile_size),
+          std::min(tile_size, pixmap.height() - row * tile_size));
+      worker_runner->PostTask([display_list, pixmap, tile, &latch]() {
+        // A canvas directly over the tile's subregion of the shared
+        // pixels; tiles never overlap so the workers write disjoint
+        // memory.
+        std::unique_ptr<SkCanvas> canvas = SkCanvas::MakeRasterDirect(
+            pixmap.info().makeDimensions(tile.size()),
+            pixmap.writable_addr(tile.x(), tile.y()), pixmap.rowBytes());
+        canvas->translate(-tile.x(), -tile.y());
+        DisplayListCanvasDispatcher dispatcher(canvas.get());
+        display_list->Dispatch(dispatcher, SkRect::Make(tile));
+        latch.CountDown();
+      });
+    }
+  }
+  latch.Wait();
+}
+
+}  // namespace flutter
@@ -0,0 +1,44 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_TILED_RASTER_H_
+#define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_TILED_RASTER_H_
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/fml/task_runner.h"
+
+#include "third_party/skia/include/core/SkPixmap.h"
+
+namespace flutter {
+
+// Rasterizes a DisplayList into CPU pixels by splitting the target into
+// tiles and replaying each tile on the concurrent worker pool, using the
+// list's R-Tree index to replay only the ops that intersect each tile.
+// The tiles write to disjoint regions of the shared pixel buffer, so no
+// compositing pass or per-tile allocation is needed.
+//
+// Software rendering otherwise rasterizes the whole list on one thread,
+// which leaves the other cores idle in headless and VM deployments that
+// have no GPU to lean on.
+class DisplayListTiledRaster {
+ public:
+  static constexpr int kDefaultTileSize = 256;
+
+  // Replays |display_list| into |pixmap|, which must remain valid for the
+  // duration of the call. Tiles are posted to |worker_runner| and the
+  // calling thread blocks until all of them complete; when the runner is
+  // null or the target fits in a single tile the list is replayed
+  // directly on the calling thread.
+  //
+  // The caller is responsible for clearing the pixels first; the replay
+  // only draws what the list draws.
+  static void Rasterize(const sk_sp<DisplayList>& display_list,
+                        const SkPixmap& pixmap,
+                        fml::BasicTaskRunner* worker_runner,
+                        int tile_size = kDefaultTileSize);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DISPLAY_LIST_TILED_RASTER_H_
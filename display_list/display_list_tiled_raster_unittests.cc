@@ -0,0 +1,93 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_tiled_raster.h"
+
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "gtest/gtest.h"
+
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkSurface.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+sk_sp<DisplayList> MakeTestDisplayList() {
+  DisplayListBuilder builder;
+  builder.setColor(SK_ColorRED);
+  builder.drawRect(SkRect::MakeLTRB(10, 10, 120, 90));
+  builder.setColor(SK_ColorGREEN);
+  // Crosses multiple tile boundaries at the 64 pixel tile size used by
+  // the tests below.
+  builder.drawRect(SkRect::MakeLTRB(50, 40, 190, 140));
+  builder.setColor(SK_ColorBLUE);
+  builder.drawCircle({100, 75}, 30);
+  return builder.Build();
+}
+
+SkBitmap MakeReferenceBitmap(const sk_sp<DisplayList>& display_list,
+                             const SkImageInfo& info) {
+  sk_sp<SkSurface> surface = SkSurface::MakeRaster(info);
+  surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+  display_list->RenderTo(surface->getCanvas());
+  SkBitmap reference;
+  reference.allocPixels(info);
+  surface->readPixels(reference, 0, 0);
+  return reference;
+}
+
+bool BitmapsEqual(const SkBitmap& a, const SkBitmap& b) {
+  if (a.info() != b.info()) {
+    return false;
+  }
+  for (int y = 0; y < a.height(); y++) {
+    if (memcmp(a.getAddr32(0, y), b.getAddr32(0, y),
+               a.width() * sizeof(uint32_t)) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(DisplayListTiledRaster, MatchesSingleThreadedRendering) {
+  sk_sp<DisplayList> display_list = MakeTestDisplayList();
+  SkImageInfo info = SkImageInfo::MakeN32Premul(200, 150);
+  SkBitmap reference = MakeReferenceBitmap(display_list, info);
+
+  auto loop = fml::ConcurrentMessageLoop::Create(4);
+  SkBitmap tiled;
+  tiled.allocPixels(info);
+  tiled.eraseColor(SK_ColorTRANSPARENT);
+  SkPixmap pixmap;
+  ASSERT_TRUE(tiled.peekPixels(&pixmap));
+  DisplayListTiledRaster::Rasterize(display_list, pixmap,
+                                    loop->GetTaskRunner().get(),
+                                    /*tile_size=*/64);
+
+  ASSERT_TRUE(BitmapsEqual(tiled, reference));
+}
+
+TEST(DisplayListTiledRaster, NullWorkerRendersSerially) {
+  sk_sp<DisplayList> display_list = MakeTestDisplayList();
+  SkImageInfo info = SkImageInfo::MakeN32Premul(200, 150);
+  SkBitmap reference = MakeReferenceBitmap(display_list, info);
+
+  SkBitmap serial;
+  serial.allocPixels(info);
+  serial.eraseColor(SK_ColorTRANSPARENT);
+  SkPixmap pixmap;
+  ASSERT_TRUE(serial.peekPixels(&pixmap));
+  DisplayListTiledRaster::Rasterize(display_list, pixmap, nullptr,
+                                    /*tile_size=*/64);
+
+  ASSERT_TRUE(BitmapsEqual(serial, reference));
+}
+
+}  // namespace testing
+}  // namespace flutter
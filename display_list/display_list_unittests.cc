@@ -11,6 +11,7 @@
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/display_list_blend_mode.h"
 #include "flutter/display_list/display_list_builder.h"
+#include "flutter/display_list/display_list_builder_multiplexer.h"
 #include "flutter/display_list/display_list_canvas_recorder.h"
 #include "flutter/display_list/display_list_paint.h"
 #include "flutter/display_list/display_list_rtree.h"
@@ -90,6 +91,383 @@ TEST(DisplayList, SingleOpDisplayListsRecapturedAreEqual) {
   }
 }
 
+TEST(DisplayList, LargeDisplayListsSpanStorageChunks) {
+  // Record enough ops to span many storage chunks and verify that equality
+  // and recapture behave the same as for a single-chunk list.
+  auto build_large = [](SkScalar offset) {
+    DisplayListBuilder builder;
+    for (int i = 0; i < 2000; i++) {
+      builder.drawRect(SkRect::MakeXYWH(offset + i, i, 10, 10));
+    }
+    return builder.Build();
+  };
+  sk_sp<DisplayList> dl = build_large(0);
+  ASSERT_GT(dl->bytes(false), 4u * DisplayListStorage::kChunkSize);
+  ASSERT_EQ(dl->op_count(false), 2000u);
+
+  ASSERT_TRUE(dl->Equals(*build_large(0)));
+  ASSERT_FALSE(dl->Equals(*build_large(1)));
+
+  // Recapturing through a dispatch walks every chunk.
+  DisplayListBuilder copy_builder;
+  dl->Dispatch(copy_builder);
+  sk_sp<DisplayList> copy = copy_builder.Build();
+  ASSERT_EQ(copy->bytes(false), dl->bytes(false));
+  ASSERT_TRUE(copy->Equals(*dl));
+}
+
+TEST(DisplayList, OpLargerThanStorageChunkIsRecorded) {
+  // A single op whose payload exceeds the standard chunk size is placed in
+  // a dedicated chunk of exactly its size.
+  auto build_points = [](int count) {
+    std::vector<SkPoint> points;
+    points.reserve(count);
+    for (int i = 0; i < count; i++) {
+      points.push_back(SkPoint::Make(i, i));
+    }
+    DisplayListBuilder builder;
+    builder.drawPoints(SkCanvas::kPoints_PointMode, count, points.data());
+    return builder.Build();
+  };
+  int count = DisplayListStorage::kChunkSize / sizeof(SkPoint) + 100;
+  sk_sp<DisplayList> dl = build_points(count);
+  ASSERT_GT(dl->bytes(false), DisplayListStorage::kChunkSize);
+  ASSERT_EQ(dl->op_count(false), 1u);
+  ASSERT_TRUE(dl->Equals(*build_points(count)));
+  ASSERT_FALSE(dl->Equals(*build_points(count - 1)));
+}
+
+TEST(DisplayList, CompactRectOpsAreSelectedTransparently) {
+  // Integral coordinates within int16 range record in the 16 byte
+  // compact form instead of the 24 byte full-width form.
+  DisplayListBuilder compact;
+  compact.drawRect(SkRect::MakeLTRB(0, 0, 10, 10));
+  compact.drawOval(SkRect::MakeLTRB(0, 0, 10, 10));
+  sk_sp<DisplayList> compact_dl = compact.Build();
+  ASSERT_EQ(compact_dl->bytes(false), sizeof(DisplayList) + 2u * 16u);
+
+  // Fractional coordinates cannot quantize and stay full width.
+  DisplayListBuilder fractional;
+  fractional.drawRect(SkRect::MakeLTRB(0, 0, 10.5f, 10));
+  fractional.drawOval(SkRect::MakeLTRB(0, 0, 10.5f, 10));
+  ASSERT_EQ(fractional.Build()->bytes(false), sizeof(DisplayList) + 2u * 24u);
+
+  // So do coordinates beyond the int16 range.
+  DisplayListBuilder out_of_range;
+  out_of_range.drawRect(SkRect::MakeLTRB(0, 0, 40000, 10));
+  ASSERT_EQ(out_of_range.Build()->bytes(false), sizeof(DisplayList) + 24u);
+
+  // Dispatch replays the full-width rect and recapturing reproduces the
+  // compact encoding.
+  DisplayListBuilder copy;
+  compact_dl->Dispatch(copy);
+  ASSERT_TRUE(copy.Build()->Equals(*compact_dl));
+}
+
+TEST(DisplayList, SetColorDrawRectPairsAreFused) {
+  DisplayListBuilder builder;
+  builder.setColor(SK_ColorGREEN);
+  builder.drawRect(SkRect::MakeLTRB(0, 0, 10.5f, 10));
+  sk_sp<DisplayList> dl = builder.Build();
+
+  // One fused 24 byte record instead of an 8 byte color op followed by a
+  // 24 byte rect op. Only the draw counts toward the op count.
+  ASSERT_EQ(dl->bytes(false), sizeof(DisplayList) + 24u);
+  ASSERT_EQ(dl->op_count(false), 1u);
+
+  // Replay produces the same calls as the unfused sequence, including
+  // the color state left behind for later ops.
+  DisplayListBuilder copy;
+  dl->Dispatch(copy);
+  ASSERT_TRUE(copy.Build()->Equals(*dl));
+}
+
+TEST(DisplayList, CulledDispatchPreservesFusedColorState) {
+  DisplayListBuilder builder;
+  builder.setColor(SK_ColorRED);
+  // Fused with the color change above, and outside the cull rect below.
+  builder.drawRect(SkRect::MakeLTRB(90, 90, 100, 100));
+  builder.drawRect(SkRect::MakeLTRB(0, 0, 10, 10));
+  sk_sp<DisplayList> dl = builder.Build();
+
+  DisplayListBuilder captured;
+  dl->Dispatch(captured, SkRect::MakeLTRB(0, 0, 20, 20));
+
+  // The culled fused op must still leave the red color behind for the
+  // surviving draw.
+  DisplayListBuilder reference;
+  reference.setColor(SK_ColorRED);
+  reference.drawRect(SkRect::MakeLTRB(0, 0, 10, 10));
+  ASSERT_TRUE(captured.Build()->Equals(*reference.Build()));
+}
+
+TEST(DisplayList, BuilderTracksRenderOpCount) {
+  DisplayListBuilder builder;
+  ASSERT_EQ(builder.render_op_count(), 0);
+
+  // Attribute, transform and layer structure records do not count.
+  builder.setColor(SK_ColorRED);
+  builder.save();
+  builder.translate(10, 10);
+  ASSERT_EQ(builder.render_op_count(), 0);
+
+  builder.drawRect(SkRect::MakeLTRB(0, 0, 10, 10));
+  ASSERT_EQ(builder.render_op_count(), 1);
+  builder.drawCircle({5, 5}, 5);
+  builder.restore();
+  ASSERT_EQ(builder.render_op_count(), 2);
+
+  // A fused color+rect record still counts as one draw.
+  DisplayListBuilder fused;
+  fused.setColor(SK_ColorGREEN);
+  fused.drawRect(SkRect::MakeLTRB(0, 0, 10, 10));
+  ASSERT_EQ(fused.render_op_count(), 1);
+}
+
+TEST(DisplayList, RepeatedGradientColorSourcesAreInterned) {
+  auto build = [](int count, const DlColorSource* source) {
+    DisplayListBuilder builder;
+    for (int i = 0; i < count; i++) {
+      builder.setColorSource(source);
+      builder.drawRect(SkRect::MakeXYWH(i * 10, 0, 10, 10));
+      builder.setColorSource(nullptr);
+    }
+    return builder.Build();
+  };
+  sk_sp<DisplayList> one = build(1, kTestSource2.get());
+  sk_sp<DisplayList> many = build(100, kTestSource2.get());
+  // Every additional reference to the gradient costs one shared op, not
+  // another embedded copy of the payload, which alone would exceed
+  // 80 bytes per reference for this gradient's stop arrays.
+  ASSERT_LE(many->bytes(false) - one->bytes(false), 99u * 64);
+
+  // Interned payloads still compare deeply between lists.
+  ASSERT_TRUE(many->Equals(*build(100, kTestSource2.get())));
+  ASSERT_FALSE(many->Equals(*build(100, kTestSource3.get())));
+
+  // Recapturing through a dispatch re-interns the shared sources.
+  DisplayListBuilder copy_builder;
+  many->Dispatch(copy_builder);
+  ASSERT_TRUE(copy_builder.Build()->Equals(*many));
+}
+
+TEST(DisplayList, ConsecutiveTranslatesAreMergedWhileRecording) {
+  DisplayListBuilder builder;
+  builder.translate(10, 20);
+  builder.translate(5, -5);
+  builder.drawRect(SkRect::MakeWH(10, 10));
+  sk_sp<DisplayList> dl = builder.Build();
+
+  DisplayListBuilder reference;
+  reference.translate(15, 15);
+  reference.drawRect(SkRect::MakeWH(10, 10));
+  ASSERT_TRUE(dl->Equals(*reference.Build()));
+}
+
+TEST(DisplayList, ConsecutiveScalesAreMergedWhileRecording) {
+  DisplayListBuilder builder;
+  builder.scale(2, 2);
+  builder.scale(3, 0.5);
+  builder.drawRect(SkRect::MakeWH(10, 10));
+  sk_sp<DisplayList> dl = builder.Build();
+
+  DisplayListBuilder reference;
+  reference.scale(6, 1);
+  reference.drawRect(SkRect::MakeWH(10, 10));
+  ASSERT_TRUE(dl->Equals(*reference.Build()));
+}
+
+TEST(DisplayList, TransformMergesDoNotCrossOtherOps) {
+  // A translate separated from the previous translate by any other op
+  // must be recorded separately so replay order is preserved.
+  DisplayListBuilder builder;
+  builder.translate(10, 10);
+  builder.save();
+  builder.translate(5, 5);
+  builder.drawRect(SkRect::MakeWH(10, 10));
+  builder.restore();
+  sk_sp<DisplayList> dl = builder.Build();
+  // Translate, Save, Translate, DrawRect, Restore.
+  ASSERT_EQ(dl->op_count(), 5u);
+}
+
+TEST(DisplayList, ClipThatCannotTightenClipIsElided) {
+  DisplayListBuilder builder(SkRect::MakeWH(100, 100));
+  builder.clipRect(SkRect::MakeWH(50, 50), SkClipOp::kIntersect, false);
+  // This clip fully contains the current clip and so has no effect.
+  builder.clipRect(SkRect::MakeWH(80, 80), SkClipOp::kIntersect, false);
+  builder.drawRect(SkRect::MakeWH(10, 10));
+  sk_sp<DisplayList> dl = builder.Build();
+
+  DisplayListBuilder reference(SkRect::MakeWH(100, 100));
+  reference.clipRect(SkRect::MakeWH(50, 50), SkClipOp::kIntersect, false);
+  reference.drawRect(SkRect::MakeWH(10, 10));
+  ASSERT_TRUE(dl->Equals(*reference.Build()));
+}
+
+TEST(DisplayList, ClipElisionIsDisabledUnderRotation) {
+  // Under a rotated transform the mapped rect is only a loose bounds of
+  // the true clip region, so the clip must still be recorded even when
+  // that bounds contains the current clip.
+  DisplayListBuilder builder(SkRect::MakeWH(100, 100));
+  builder.clipRect(SkRect::MakeWH(50, 50), SkClipOp::kIntersect, false);
+  builder.rotate(45);
+  builder.clipRect(SkRect::MakeLTRB(-100, -100, 200, 200),
+                   SkClipOp::kIntersect, false);
+  builder.drawRect(SkRect::MakeWH(10, 10));
+  // ClipRect, Rotate, ClipRect, DrawRect.
+  ASSERT_EQ(builder.Build()->op_count(), 4u);
+}
+
+TEST(DisplayList, DigestMatchesForIdenticalContent) {
+  auto build = []() {
+    DisplayListBuilder builder;
+    builder.setColor(SK_ColorRED);
+    builder.drawRect(SkRect::MakeWH(50, 50));
+    builder.drawCircle({25, 25}, 10);
+    return builder.Build();
+  };
+  sk_sp<DisplayList> dl1 = build();
+  sk_sp<DisplayList> dl2 = build();
+  ASSERT_EQ(dl1->digest(), dl2->digest());
+  ASSERT_TRUE(dl1->Equals(*dl2));
+}
+
+TEST(DisplayList, DigestDiffersForDifferentContent) {
+  DisplayListBuilder builder1;
+  builder1.drawRect(SkRect::MakeWH(50, 50));
+  DisplayListBuilder builder2;
+  builder2.drawRect(SkRect::MakeWH(50, 51));
+  sk_sp<DisplayList> dl1 = builder1.Build();
+  sk_sp<DisplayList> dl2 = builder2.Build();
+  ASSERT_NE(dl1->digest(), dl2->digest());
+  ASSERT_FALSE(dl1->Equals(*dl2));
+}
+
+TEST(DisplayList, EqualsFallsBackWhenSharedAttributesDiffer) {
+  // Ops holding shared attribute references embed pointer values, so
+  // two builds referencing separately allocated but identical gradients
+  // produce different digests and must still compare equal via the
+  // op-wise fallback.
+  auto build = []() {
+    DisplayListBuilder builder;
+    builder.setColorSource(kTestSource2.get());
+    builder.drawRect(SkRect::MakeWH(50, 50));
+    return builder.Build();
+  };
+  sk_sp<DisplayList> dl1 = build();
+  sk_sp<DisplayList> dl2 = build();
+  ASSERT_NE(dl1->digest(), dl2->digest());
+  ASSERT_TRUE(dl1->Equals(*dl2));
+}
+
+TEST(DisplayList, CulledDispatchReplaysOnlyIntersectingDraws) {
+  DisplayListBuilder builder;
+  builder.drawRect(SkRect::MakeLTRB(0, 0, 10, 10));
+  builder.drawRect(SkRect::MakeLTRB(90, 0, 100, 10));
+  builder.drawRect(SkRect::MakeLTRB(0, 90, 10, 100));
+  builder.drawRect(SkRect::MakeLTRB(90, 90, 100, 100));
+  sk_sp<DisplayList> dl = builder.Build();
+
+  DisplayListBuilder captured;
+  dl->Dispatch(captured, SkRect::MakeLTRB(0, 0, 20, 20));
+
+  DisplayListBuilder reference;
+  reference.drawRect(SkRect::MakeLTRB(0, 0, 10, 10));
+  ASSERT_TRUE(captured.Build()->Equals(*reference.Build()));
+}
+
+TEST(DisplayList, CulledDispatchReplaysStateOps) {
+  DisplayListBuilder builder;
+  builder.setColor(SK_ColorRED);
+  builder.translate(5, 5);
+  builder.drawRect(SkRect::MakeLTRB(0, 0, 10, 10));
+  builder.drawRect(SkRect::MakeLTRB(90, 90, 100, 100));
+  sk_sp<DisplayList> dl = builder.Build();
+
+  DisplayListBuilder captured;
+  dl->Dispatch(captured, SkRect::MakeLTRB(0, 0, 20, 20));
+
+  // The attribute and transform ops survive culling so the remaining
+  // draw replays with correct state.
+  DisplayListBuilder reference;
+  reference.setColor(SK_ColorRED);
+  reference.translate(5, 5);
+  reference.drawRect(SkRect::MakeLTRB(0, 0, 10, 10));
+  ASSERT_TRUE(captured.Build()->Equals(*reference.Build()));
+}
+
+TEST(DisplayList, CulledDispatchCoveringBoundsReplaysEverything) {
+  DisplayListBuilder builder;
+  builder.drawRect(SkRect::MakeLTRB(0, 0, 10, 10));
+  builder.drawRect(SkRect::MakeLTRB(90, 90, 100, 100));
+  sk_sp<DisplayList> dl = builder.Build();
+
+  DisplayListBuilder captured;
+  dl->Dispatch(captured, SkRect::MakeLTRB(0, 0, 100, 100));
+  ASSERT_TRUE(captured.Build()->Equals(*dl));
+}
+
+TEST(DisplayList, StorageChunksAreRecycledAcrossLists) {
+  DisplayListStorage::DrainPoolForTesting();
+  {
+    DisplayListBuilder builder;
+    // Enough ops to span several storage chunks.
+    for (int i = 0; i < 500; i++) {
+      builder.drawRect(SkRect::MakeXYWH(i, i, 10, 10));
+    }
+    sk_sp<DisplayList> dl = builder.Build();
+    ASSERT_EQ(DisplayListStorage::PooledChunkCount(), 0u);
+  }
+  // Destroying the list returned its chunks to the pool.
+  size_t pooled = DisplayListStorage::PooledChunkCount();
+  ASSERT_GE(pooled, 2u);
+
+  DisplayListBuilder builder;
+  for (int i = 0; i < 500; i++) {
+    builder.drawRect(SkRect::MakeXYWH(i, i, 10, 10));
+  }
+  sk_sp<DisplayList> dl = builder.Build();
+  // The new recording claimed its chunks from the pool instead of the
+  // allocator and still produced the expected contents.
+  ASSERT_LT(DisplayListStorage::PooledChunkCount(), pooled);
+  ASSERT_EQ(dl->op_count(), 500u);
+}
+
+TEST(DisplayList, RecycledChunksAreZeroedForEquality) {
+  auto build = []() {
+    DisplayListBuilder builder;
+    builder.setAntiAlias(true);
+    builder.setStrokeWidth(3.0f);
+    for (int i = 0; i < 300; i++) {
+      builder.drawLine(SkPoint::Make(i, 0), SkPoint::Make(0, i));
+    }
+    return builder.Build();
+  };
+  sk_sp<DisplayList> first = build();
+  auto digest = first->digest();
+  // Destroy the first list so the second recording reuses its chunks; a
+  // recycled chunk that retained the previous recording's bytes in its
+  // op padding would break the digest and Equals fast paths.
+  first = nullptr;
+  sk_sp<DisplayList> second = build();
+  ASSERT_EQ(second->digest(), digest);
+}
+
+TEST(DisplayList, StorageRecyclingPoolIsBounded) {
+  DisplayListStorage::DrainPoolForTesting();
+  {
+    DisplayListBuilder builder;
+    // Far more chunks than the pool retains.
+    for (int i = 0; i < 20000; i++) {
+      builder.drawRect(SkRect::MakeXYWH(i, i, 10, 10));
+    }
+    sk_sp<DisplayList> dl = builder.Build();
+  }
+  ASSERT_EQ(DisplayListStorage::PooledChunkCount(),
+            DisplayListStorage::kMaxPooledChunks);
+}
+
 TEST(DisplayList, SingleOpDisplayListsRecapturedViaSkCanvasAreEqual) {
   for (auto& group : allGroups) {
     for (size_t i = 0; i < group.variants.size(); i++) {
@@ -2231,5 +2609,52 @@ TEST(DisplayList, RTreeOfClippedSaveLayerFilterScene) {
   test_rtree(rtree, {19, 19, 51, 51}, rects, {0, 1});
 }
 
+TEST(DisplayList, MultiplexerSharesRecordedOps) {
+  DisplayListBuilder builder1;
+  DisplayListBuilder builder2;
+  DisplayListBuilderMultiplexer multiplexer;
+  multiplexer.addBuilder(&builder1);
+  multiplexer.addBuilder(&builder2);
+
+  multiplexer.saveLayer(nullptr, nullptr);
+  multiplexer.sharedBuilder().setColor(DlColor::kBlue());
+  multiplexer.sharedBuilder().drawRect({10, 10, 20, 20});
+  multiplexer.sharedBuilder().drawRect({30, 30, 40, 40});
+  multiplexer.restore();
+  multiplexer.flush();
+
+  auto display_list1 = builder1.Build();
+  auto display_list2 = builder2.Build();
+
+  // Both builders saw identical content.
+  ASSERT_TRUE(DisplayListsEQ_Verbose(display_list1, display_list2));
+  ASSERT_EQ(display_list1->bounds(), SkRect::MakeLTRB(10, 10, 40, 40));
+
+  // The draw content was encoded once and referenced, not copied: each
+  // builder recorded only the saveLayer/restore pair and a single
+  // drawDisplayList op between them. The nested count makes the
+  // drawDisplayList op transparent and counts the two rects instead.
+  ASSERT_EQ(display_list1->op_count(), 3u);
+  ASSERT_EQ(display_list1->op_count(true), 4u);
+}
+
+TEST(DisplayList, MultiplexerDoesNotDeliverOpsRecordedBeforeAddBuilder) {
+  DisplayListBuilder builder1;
+  DisplayListBuilder builder2;
+  DisplayListBuilderMultiplexer multiplexer;
+  multiplexer.addBuilder(&builder1);
+
+  multiplexer.sharedBuilder().drawRect({10, 10, 20, 20});
+  multiplexer.addBuilder(&builder2);
+  multiplexer.sharedBuilder().drawRect({30, 30, 40, 40});
+  multiplexer.flush();
+
+  auto display_list1 = builder1.Build();
+  auto display_list2 = builder2.Build();
+
+  ASSERT_EQ(display_list1->bounds(), SkRect::MakeLTRB(10, 10, 40, 40));
+  ASSERT_EQ(display_list2->bounds(), SkRect::MakeLTRB(30, 30, 40, 40));
+}
+
 }  // namespace testing
 }  // namespace flutter
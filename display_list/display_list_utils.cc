@@ -8,6 +8,15 @@
 #include <optional>
 #include <type_traits>
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DL_BOUNDS_USE_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define DL_BOUNDS_USE_NEON 1
+#include <arm_neon.h>
+#endif
+
 #include "flutter/display_list/display_list_blend_mode.h"
 #include "flutter/display_list/display_list_canvas_dispatcher.h"
 #include "flutter/fml/logging.h"
@@ -325,9 +334,202 @@ SkRect RectBoundsAccumulator::AccumulationRect::bounds() const {
              : SkRect::MakeEmpty();
 }
 
+namespace {
+
+// Forms the result rect from a finished min/max accumulation under the
+// same rule as AccumulationRect::bounds(): a single point yields a
+// located zero-area rect, no accumulated points yields an empty rect.
+SkRect MakeBoundsResult(SkScalar min_x,
+                        SkScalar min_y,
+                        SkScalar max_x,
+                        SkScalar max_y) {
+  return (max_x >= min_x && max_y >= min_y)
+             ? SkRect::MakeLTRB(min_x, min_y, max_x, max_y)
+             : SkRect::MakeEmpty();
+}
+
+// Accumulates one point with the same per-coordinate NaN-ignoring
+// comparisons as AccumulationRect::accumulate. Used for the scalar tail
+// of the vectorized loops.
+void AccumulateScalar(SkScalar x,
+                      SkScalar y,
+                      SkScalar& min_x,
+                      SkScalar& min_y,
+                      SkScalar& max_x,
+                      SkScalar& max_y) {
+  if (min_x > x) {
+    min_x = x;
+  }
+  if (min_y > y) {
+    min_y = y;
+  }
+  if (max_x < x) {
+    max_x = x;
+  }
+  if (max_y < y) {
+    max_y = y;
+  }
+}
+
+}  // namespace
+
+SkRect ComputePointBounds(const SkPoint points[], size_t count) {
+  SkScalar min_x = std::numeric_limits<SkScalar>::infinity();
+  SkScalar min_y = std::numeric_limits<SkScalar>::infinity();
+  SkScalar max_x = -std::numeric_limits<SkScalar>::infinity();
+  SkScalar max_y = -std::numeric_limits<SkScalar>::infinity();
+#if defined(DL_BOUNDS_USE_SSE2)
+  const float* coords = reinterpret_cast<const float*>(points);
+  __m128 min4 = _mm_set1_ps(std::numeric_limits<float>::infinity());
+  __m128 max4 = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+  size_t pairs = count / 2;
+  for (size_t i = 0; i < pairs; i++) {
+    // Two points per register: [x0, y0, x1, y1]. Placing the data in the
+    // first operand makes MINPS/MAXPS return the accumulator lane for NaN
+    // coordinates, matching the scalar accumulator which ignores them.
+    __m128 v = _mm_loadu_ps(coords + i * 4);
+    min4 = _mm_min_ps(v, min4);
+    max4 = _mm_max_ps(v, max4);
+  }
+  // Fold the two point lanes together; x lanes are {0, 2}, y lanes {1, 3}.
+  // The accumulators are NaN-free by now so operand order no longer matters.
+  min4 = _mm_min_ps(min4, _mm_movehl_ps(min4, min4));
+  max4 = _mm_max_ps(max4, _mm_movehl_ps(max4, max4));
+  float min_lanes[4];
+  float max_lanes[4];
+  _mm_storeu_ps(min_lanes, min4);
+  _mm_storeu_ps(max_lanes, max4);
+  min_x = min_lanes[0];
+  min_y = min_lanes[1];
+  max_x = max_lanes[0];
+  max_y = max_lanes[1];
+  size_t i = pairs * 2;
+#elif defined(DL_BOUNDS_USE_NEON)
+  const float* coords = reinterpret_cast<const float*>(points);
+  float32x4_t min4 = vdupq_n_f32(std::numeric_limits<float>::infinity());
+  float32x4_t max4 = vdupq_n_f32(-std::numeric_limits<float>::infinity());
+  size_t pairs = count / 2;
+  for (size_t i = 0; i < pairs; i++) {
+    // Two points per register: [x0, y0, x1, y1]. NEON min/max propagate
+    // NaN, so lanes with NaN coordinates are masked back to the
+    // accumulator value to match the scalar accumulator which ignores
+    // them.
+    float32x4_t v = vld1q_f32(coords + i * 4);
+    uint32x4_t ordered = vceqq_f32(v, v);
+    min4 = vbslq_f32(ordered, vminq_f32(v, min4), min4);
+    max4 = vbslq_f32(ordered, vmaxq_f32(v, max4), max4);
+  }
+  // Fold the two point lanes together; x lanes are {0, 2}, y lanes {1, 3}.
+  float32x2_t min2 = vmin_f32(vget_low_f32(min4), vget_high_f32(min4));
+  float32x2_t max2 = vmax_f32(vget_low_f32(max4), vget_high_f32(max4));
+  min_x = vget_lane_f32(min2, 0);
+  min_y = vget_lane_f32(min2, 1);
+  max_x = vget_lane_f32(max2, 0);
+  max_y = vget_lane_f32(max2, 1);
+  size_t i = pairs * 2;
+#else
+  size_t i = 0;
+#endif
+  for (; i < count; i++) {
+    AccumulateScalar(points[i].fX, points[i].fY,  //
+                     min_x, min_y, max_x, max_y);
+  }
+  return MakeBoundsResult(min_x, min_y, max_x, max_y);
+}
+
+SkRect ComputeAtlasBounds(const SkRSXform xform[],
+                          const SkRect tex[],
+                          int count) {
+  // Each sprite covers the quad of its tex rect's dimensions placed by
+  // its transform (see SkRSXform::toQuad):
+  //   xs = tx + {0, w*cos, w*cos - h*sin, -h*sin}
+  //   ys = ty + {0, w*sin, w*sin + h*cos,  h*cos}
+#if defined(DL_BOUNDS_USE_SSE2)
+  __m128 min_xs = _mm_set1_ps(std::numeric_limits<float>::infinity());
+  __m128 min_ys = min_xs;
+  __m128 max_xs = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+  __m128 max_ys = max_xs;
+  for (int i = 0; i < count; i++) {
+    float wc = tex[i].width() * xform[i].fSCos;
+    float ws = tex[i].width() * xform[i].fSSin;
+    float hc = tex[i].height() * xform[i].fSCos;
+    float hs = tex[i].height() * xform[i].fSSin;
+    __m128 xs = _mm_add_ps(_mm_set1_ps(xform[i].fTx),
+                           _mm_setr_ps(0.0f, wc, wc - hs, -hs));
+    __m128 ys = _mm_add_ps(_mm_set1_ps(xform[i].fTy),
+                           _mm_setr_ps(0.0f, ws, ws + hc, hc));
+    // Data-first operand order ignores NaN corners, as in the scalar
+    // accumulator.
+    min_xs = _mm_min_ps(xs, min_xs);
+    min_ys = _mm_min_ps(ys, min_ys);
+    max_xs = _mm_max_ps(xs, max_xs);
+    max_ys = _mm_max_ps(ys, max_ys);
+  }
+  // Reduce each 4-lane accumulator to a scalar; the accumulators are
+  // NaN-free by now so operand order no longer matters.
+  auto reduce_min = [](__m128 v) {
+    v = _mm_min_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_min_ss(v, _mm_shuffle_ps(v, v, 1));
+    return _mm_cvtss_f32(v);
+  };
+  auto reduce_max = [](__m128 v) {
+    v = _mm_max_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_max_ss(v, _mm_shuffle_ps(v, v, 1));
+    return _mm_cvtss_f32(v);
+  };
+  return MakeBoundsResult(reduce_min(min_xs), reduce_min(min_ys),
+                          reduce_max(max_xs), reduce_max(max_ys));
+#elif defined(DL_BOUNDS_USE_NEON)
+  float32x4_t min_xs = vdupq_n_f32(std::numeric_limits<float>::infinity());
+  float32x4_t min_ys = min_xs;
+  float32x4_t max_xs = vdupq_n_f32(-std::numeric_limits<float>::infinity());
+  float32x4_t max_ys = max_xs;
+  for (int i = 0; i < count; i++) {
+    float wc = tex[i].width() * xform[i].fSCos;
+    float ws = tex[i].width() * xform[i].fSSin;
+    float hc = tex[i].height() * xform[i].fSCos;
+    float hs = tex[i].height() * xform[i].fSSin;
+    const float x_lanes[4] = {0.0f, wc, wc - hs, -hs};
+    const float y_lanes[4] = {0.0f, ws, ws + hc, hc};
+    float32x4_t xs = vaddq_f32(vdupq_n_f32(xform[i].fTx), vld1q_f32(x_lanes));
+    float32x4_t ys = vaddq_f32(vdupq_n_f32(xform[i].fTy), vld1q_f32(y_lanes));
+    // NEON min/max propagate NaN, so NaN corners are masked back to the
+    // accumulator value, as in the scalar accumulator.
+    uint32x4_t xs_ordered = vceqq_f32(xs, xs);
+    uint32x4_t ys_ordered = vceqq_f32(ys, ys);
+    min_xs = vbslq_f32(xs_ordered, vminq_f32(xs, min_xs), min_xs);
+    min_ys = vbslq_f32(ys_ordered, vminq_f32(ys, min_ys), min_ys);
+    max_xs = vbslq_f32(xs_ordered, vmaxq_f32(xs, max_xs), max_xs);
+    max_ys = vbslq_f32(ys_ordered, vmaxq_f32(ys, max_ys), max_ys);
+  }
+  auto reduce_min = [](float32x4_t v) {
+    float32x2_t v2 = vpmin_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpmin_f32(v2, v2), 0);
+  };
+  auto reduce_max = [](float32x4_t v) {
+    float32x2_t v2 = vpmax_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpmax_f32(v2, v2), 0);
+  };
+  return MakeBoundsResult(reduce_min(min_xs), reduce_min(min_ys),
+                          reduce_max(max_xs), reduce_max(max_ys));
+#else
+  SkPoint quad[4];
+  RectBoundsAccumulator atlas_bounds;
+  for (int i = 0; i < count; i++) {
+    const SkRect& src = tex[i];
+    xform[i].toQuad(src.width(), src.height(), quad);
+    for (int j = 0; j < 4; j++) {
+      atlas_bounds.accumulate(quad[j]);
+    }
+  }
+  return atlas_bounds.bounds();
+#endif
+}
+
 void RTreeBoundsAccumulator::accumulate(const SkRect& r) {
   if (r.fLeft < r.fRight && r.fTop < r.fBottom) {
     rects_.push_back(r);
+    source_identifiers_.push_back(source_identifier_);
   }
 }
 bool RTreeBoundsAccumulator::is_empty() const {
@@ -363,10 +565,12 @@ bool RTreeBoundsAccumulator::restore(
       success = false;
     }
     if (clip == nullptr || original.intersect(*clip)) {
+      source_identifiers_[previous_size] = source_identifiers_[i];
       rects_[previous_size++] = original;
     }
   }
   rects_.resize(previous_size);
+  source_identifiers_.resize(previous_size);
   return success;
 }
 sk_sp<DlRTree> RTreeBoundsAccumulator::rtree() const {
@@ -559,11 +763,7 @@ void DisplayListBoundsCalculator::drawPoints(SkCanvas::PointMode mode,
                                              uint32_t count,
                                              const SkPoint pts[]) {
   if (count > 0) {
-    RectBoundsAccumulator pt_bounds;
-    for (size_t i = 0; i < count; i++) {
-      pt_bounds.accumulate(pts[i]);
-    }
-    SkRect point_bounds = pt_bounds.bounds();
+    SkRect point_bounds = ComputePointBounds(pts, count);
     switch (mode) {
       case SkCanvas::kPoints_PointMode:
         AccumulateOpBounds(point_bounds, kDrawPointsAsPointsFlags);
@@ -639,20 +839,12 @@ void DisplayListBoundsCalculator::drawAtlas(const sk_sp<DlImage> atlas,
                                             DlImageSampling sampling,
                                             const SkRect* cullRect,
                                             bool render_with_attributes) {
-  SkPoint quad[4];
-  RectBoundsAccumulator atlas_bounds;
-  for (int i = 0; i < count; i++) {
-    const SkRect& src = tex[i];
-    xform[i].toQuad(src.width(), src.height(), quad);
-    for (int j = 0; j < 4; j++) {
-      atlas_bounds.accumulate(quad[j]);
-    }
-  }
-  if (atlas_bounds.is_not_empty()) {
+  SkRect atlas_bounds = ComputeAtlasBounds(xform, tex, count);
+  if (!atlas_bounds.isEmpty()) {
     DisplayListAttributeFlags flags = render_with_attributes  //
                                           ? kDrawAtlasWithPaintFlags
                                           : kDrawAtlasFlags;
-    AccumulateOpBounds(atlas_bounds.bounds(), flags);
+    AccumulateOpBounds(atlas_bounds, flags);
   }
 }
 void DisplayListBoundsCalculator::drawPicture(const sk_sp<SkPicture> picture,
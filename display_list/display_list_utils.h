@@ -337,6 +337,26 @@ class ClipBoundsDispatchHelper : public virtual Dispatcher,
   void intersect(const SkRect& clipBounds, bool is_aa);
 };
 
+/// Computes the tight bounds of |count| points in one batched pass.
+///
+/// Semantically equivalent to feeding every point through a
+/// |RectBoundsAccumulator| - non-finite coordinates are ignored per
+/// coordinate and a single point yields a located zero-area rect - but
+/// processes the array with SIMD min/max on platforms that support it.
+/// Used by the bulk record paths (drawPoints, drawVertices) where the
+/// per-point scalar loop is a visible share of bounds computation time.
+SkRect ComputePointBounds(const SkPoint points[], size_t count);
+
+/// Computes the bounds of |count| atlas sprites, each being the quad of
+/// |tex[i]|'s dimensions placed by |xform[i]|, in one batched pass.
+///
+/// Semantically equivalent to expanding each transform with
+/// |SkRSXform::toQuad| and accumulating the four corners, but computes
+/// and min/maxes the corners with SIMD on platforms that support it.
+SkRect ComputeAtlasBounds(const SkRSXform xform[],
+                          const SkRect tex[],
+                          int count);
+
 class BoundsAccumulator {
  public:
   /// function definition for modifying the bounds of a rectangle
@@ -453,10 +473,25 @@ class RTreeBoundsAccumulator final : public virtual BoundsAccumulator {
       std::function<bool(const SkRect& original, SkRect& modified)> map,
       const SkRect* clip = nullptr) override;
 
+  // Rects accumulated after this call are tagged with |identifier|.
+  // DisplayList uses this to associate each rect inserted into the
+  // R-Tree with the storage offset of the op that produced it.
+  void set_source_identifier(size_t identifier) {
+    source_identifier_ = identifier;
+  }
+
+  // The identifier recorded for each accumulated rect, in the same
+  // order the rects are inserted into the tree returned by |rtree|.
+  const std::vector<size_t>& source_identifiers() const {
+    return source_identifiers_;
+  }
+
   sk_sp<DlRTree> rtree() const;
 
  private:
   std::vector<SkRect> rects_;
+  std::vector<size_t> source_identifiers_;
+  size_t source_identifier_ = 0;
   std::vector<size_t> saved_offsets_;
 };
 
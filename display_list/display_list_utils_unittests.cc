@@ -2,8 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <limits>
+
 #include "flutter/display_list/display_list_utils.h"
 #include "gtest/gtest.h"
+#include "third_party/skia/include/core/SkRSXform.h"
 
 namespace flutter {
 namespace testing {
@@ -37,5 +40,67 @@ TEST(DisplayListUtils, OverRestore) {
   helper.restore();
 }
 
+TEST(DisplayListUtils, ComputePointBoundsMatchesAccumulator) {
+  const SkPoint points[] = {
+      {10, 20},  {-5, 3},   {7.5f, -2.25f}, {100, 50},  {0, 0},
+      {-40, 90}, {12, -60}, {3, 3},         {25, 25.5f},
+  };
+  const size_t count = sizeof(points) / sizeof(points[0]);
+  for (size_t n = 0; n <= count; n++) {
+    RectBoundsAccumulator accumulator;
+    for (size_t i = 0; i < n; i++) {
+      accumulator.accumulate(points[i]);
+    }
+    EXPECT_EQ(ComputePointBounds(points, n), accumulator.bounds())
+        << "point count: " << n;
+  }
+}
+
+TEST(DisplayListUtils, ComputePointBoundsIgnoresNonFiniteCoordinates) {
+  const SkScalar nan = std::numeric_limits<SkScalar>::quiet_NaN();
+  const SkPoint points[] = {
+      {10, 20}, {nan, 5}, {-5, nan}, {nan, nan}, {30, -8},
+  };
+  // A NaN coordinate is skipped per coordinate, not per point, just as in
+  // RectBoundsAccumulator: {nan, 5} still contributes y == 5.
+  EXPECT_EQ(ComputePointBounds(points, 5), SkRect::MakeLTRB(-5, -8, 30, 20));
+}
+
+TEST(DisplayListUtils, ComputePointBoundsDegenerateCases) {
+  const SkPoint point = {15, -7};
+  // No points yields an empty rect, but a single point yields a located
+  // zero-area rect so that stroke padding can inflate it.
+  EXPECT_EQ(ComputePointBounds(&point, 0), SkRect::MakeEmpty());
+  EXPECT_EQ(ComputePointBounds(&point, 1), SkRect::MakeLTRB(15, -7, 15, -7));
+}
+
+TEST(DisplayListUtils, ComputeAtlasBoundsMatchesQuadAccumulation) {
+  const SkRSXform xform[] = {
+      SkRSXform::Make(1, 0, 10, 20),         // identity placement
+      SkRSXform::Make(0, 1, -5, 3),          // 90 degree rotation
+      SkRSXform::Make(0.5f, -0.25f, 40, 7),  // scaled rotation
+      SkRSXform::Make(-2, 1.5f, 0, -12),     // flipped and scaled
+  };
+  const SkRect tex[] = {
+      SkRect::MakeWH(16, 16),
+      SkRect::MakeWH(32, 8),
+      SkRect::MakeXYWH(5, 5, 10, 24),
+      SkRect::MakeWH(7, 7),
+  };
+  const int count = sizeof(xform) / sizeof(xform[0]);
+  for (int n = 0; n <= count; n++) {
+    SkPoint quad[4];
+    RectBoundsAccumulator accumulator;
+    for (int i = 0; i < n; i++) {
+      xform[i].toQuad(tex[i].width(), tex[i].height(), quad);
+      for (int j = 0; j < 4; j++) {
+        accumulator.accumulate(quad[j]);
+      }
+    }
+    EXPECT_EQ(ComputeAtlasBounds(xform, tex, n), accumulator.bounds())
+        << "sprite count: " << n;
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
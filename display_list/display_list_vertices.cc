@@ -86,11 +86,7 @@ size_t DlVertices::size() const {
 }
 
 static SkRect compute_bounds(const SkPoint* points, int count) {
-  RectBoundsAccumulator accumulator;
-  for (int i = 0; i < count; i++) {
-    accumulator.accumulate(points[i]);
-  }
-  return accumulator.bounds();
+  return ComputePointBounds(points, count);
 }
 
 DlVertices::DlVertices(DlVertexMode mode,
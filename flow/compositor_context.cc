@@ -22,6 +22,8 @@ std::optional<SkRect> FrameDamage::ComputeClipRect(
                         prev_layer_tree_ ? prev_layer_tree_->paint_region_map()
                                          : empty_paint_region_map,
                         has_raster_cache);
+    context.SetConcurrentTaskRunner(concurrent_task_runner_);
+    context.SetTextureRegistry(texture_registry_);
     context.PushCullRect(SkRect::MakeIWH(layer_tree.frame_size().width(),
                                          layer_tree.frame_size().height()));
     {
@@ -122,6 +124,9 @@ RasterStatus CompositorContext::ScopedFrame::Raster(
     FrameDamage* frame_damage) {
   TRACE_EVENT0("flutter", "CompositorContext::ScopedFrame::Raster");
 
+  if (frame_damage) {
+    frame_damage->SetTextureRegistry(context_.texture_registry().get());
+  }
   std::optional<SkRect> clip_rect =
       frame_damage
           ? frame_damage->ComputeClipRect(layer_tree, !ignore_raster_cache)
@@ -76,6 +76,20 @@ class FrameDamage {
     vertical_clip_alignment_ = vertical;
   }
 
+  // Sets the task runner on which independent layer subtree diffs are
+  // performed concurrently. If not set, the diff runs entirely on the
+  // calling thread.
+  void SetConcurrentTaskRunner(fml::BasicTaskRunner* concurrent_task_runner) {
+    concurrent_task_runner_ = concurrent_task_runner;
+  }
+
+  // Sets the texture registry so that texture layers whose texture has not
+  // received a new frame since the previous diff do not contribute damage.
+  // If not set, texture layers are always repainted.
+  void SetTextureRegistry(TextureRegistry* texture_registry) {
+    texture_registry_ = texture_registry;
+  }
+
   // Calculates clip rect for current rasterization. This is diff of layer tree
   // and previous layer tree + any additional provided damage.
   // If previous layer tree is not specified, clip rect will be nullopt,
@@ -94,12 +108,19 @@ class FrameDamage {
     return damage_ ? std::make_optional(damage_->buffer_damage) : std::nullopt;
   }
 
+  // See Damage::frame_damage_rects.
+  std::vector<SkIRect> GetFrameDamageRects() const {
+    return damage_ ? damage_->frame_damage_rects : std::vector<SkIRect>();
+  }
+
  private:
   SkIRect additional_damage_ = SkIRect::MakeEmpty();
   std::optional<Damage> damage_;
   const LayerTree* prev_layer_tree_ = nullptr;
   int vertical_clip_alignment_ = 1;
   int horizontal_clip_alignment_ = 1;
+  fml::BasicTaskRunner* concurrent_task_runner_ = nullptr;
+  TextureRegistry* texture_registry_ = nullptr;
 };
 
 class CompositorContext {
@@ -186,12 +207,23 @@ class CompositorContext {
 
   LayerSnapshotStore& snapshot_store() { return layer_snapshot_store_; }
 
+  // Sets the task runner used to preroll independent layer subtrees
+  // concurrently. If not set, preroll runs entirely on the raster thread.
+  void SetPrerollTaskRunner(fml::BasicTaskRunner* preroll_task_runner) {
+    preroll_task_runner_ = preroll_task_runner;
+  }
+
+  fml::BasicTaskRunner* preroll_task_runner() const {
+    return preroll_task_runner_;
+  }
+
  private:
   RasterCache raster_cache_;
   std::shared_ptr<TextureRegistry> texture_registry_;
   Stopwatch raster_time_;
   Stopwatch ui_time_;
   LayerSnapshotStore layer_snapshot_store_;
+  fml::BasicTaskRunner* preroll_task_runner_ = nullptr;
 
   /// Only used by default constructor of `CompositorContext`.
   FixedRefreshRateUpdater fixed_refresh_rate_updater_;
@@ -3,10 +3,54 @@
 // found in the LICENSE file.
 
 #include "flutter/flow/diff_context.h"
+
+#include <limits>
+
 #include "flutter/flow/layers/layer.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 
 namespace flutter {
 
+namespace {
+
+// Accumulates |rect| into |rects| while keeping at most |max_rects| entries.
+// Overlapping entries are joined outright since their union costs few extra
+// pixels; once the list is full the new rect is joined into the entry whose
+// bounding box grows by the least area.
+void AccumulateDamageRect(std::vector<SkRect>& rects,
+                          size_t max_rects,
+                          const SkRect& rect) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  for (auto& entry : rects) {
+    if (entry.intersects(rect)) {
+      entry.join(rect);
+      return;
+    }
+  }
+  if (rects.size() < max_rects) {
+    rects.push_back(rect);
+    return;
+  }
+  size_t best_index = 0;
+  SkScalar least_waste = std::numeric_limits<SkScalar>::max();
+  for (size_t i = 0; i < rects.size(); ++i) {
+    SkRect joined = rects[i];
+    joined.join(rect);
+    SkScalar waste = joined.width() * joined.height() -
+                     rects[i].width() * rects[i].height() -
+                     rect.width() * rect.height();
+    if (waste < least_waste) {
+      least_waste = waste;
+      best_index = i;
+    }
+  }
+  rects[best_index].join(rect);
+}
+
+}  // namespace
+
 DiffContext::DiffContext(SkISize frame_size,
                          double frame_device_pixel_ratio,
                          PaintRegionMap& this_frame_paint_region_map,
@@ -19,9 +63,97 @@ DiffContext::DiffContext(SkISize frame_size,
       last_frame_paint_region_map_(last_frame_paint_region_map),
       has_raster_cache_(has_raster_cache) {}
 
+DiffContext::DiffContext(SkISize frame_size,
+                         double frame_device_pixel_ratio,
+                         const PaintRegionMap& last_frame_paint_region_map,
+                         bool has_raster_cache)
+    : rects_(std::make_shared<std::vector<SkRect>>()),
+      frame_size_(frame_size),
+      frame_device_pixel_ratio_(frame_device_pixel_ratio),
+      this_frame_paint_region_map_(child_paint_region_map_storage_),
+      last_frame_paint_region_map_(last_frame_paint_region_map),
+      has_raster_cache_(has_raster_cache) {}
+
+std::unique_ptr<DiffContext> DiffContext::CreateChildContext() const {
+  std::unique_ptr<DiffContext> child(
+      new DiffContext(frame_size_, frame_device_pixel_ratio_,
+                      last_frame_paint_region_map_, has_raster_cache_));
+  child->state_ = state_;
+  child->state_.rect_index_ = 0;
+  child->state_.has_filter_bounds_adjustment = false;
+  child->state_.has_texture = false;
+  child->filter_bounds_adjustment_stack_ = filter_bounds_adjustment_stack_;
+  // Registry lookups during diffing are read-only, so sharing the registry
+  // with concurrent children is safe.
+  child->texture_registry_ = texture_registry_;
+  return child;
+}
+
+void DiffContext::MergeChildContext(DiffContext& child) {
+  size_t rect_base = rects_->size();
+  rects_->insert(rects_->end(), child.rects_->begin(), child.rects_->end());
+  // The copied rects mirror regions captured against the child's storage
+  // (and readback positions rebased below); none of them may be compacted.
+  compaction_floor_ = rects_->size();
+  for (const auto& readback : child.readbacks_) {
+    readbacks_.push_back(
+        Readback{rect_base + readback.position, readback.rect});
+  }
+  for (const auto& rect : child.damage_rects_) {
+    AddDamage(rect);
+  }
+  if (child.state_.has_texture) {
+    MarkSubtreeHasTextureLayer();
+  }
+  // Paint regions recorded by the child keep referencing (and retaining) the
+  // child's rect storage, so they can be moved to the parent map as-is.
+  for (auto& region : child.child_paint_region_map_storage_) {
+    this_frame_paint_region_map_[region.first] = std::move(region.second);
+  }
+  statistics_.Merge(child.statistics_);
+}
+
+void DiffContext::DiffSubtrees(const std::vector<SubtreeDiffJob>& jobs) {
+  if (concurrent_task_runner_ == nullptr ||
+      jobs.size() < kMinSubtreesForConcurrentDiff) {
+    for (const auto& job : jobs) {
+      job(this);
+    }
+    return;
+  }
+
+  std::vector<std::unique_ptr<DiffContext>> child_contexts;
+  child_contexts.reserve(jobs.size());
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    child_contexts.push_back(CreateChildContext());
+  }
+
+  fml::CountDownLatch latch(jobs.size() - 1);
+  for (size_t i = 1; i < jobs.size(); ++i) {
+    concurrent_task_runner_->PostTask([&jobs, &child_contexts, &latch, i] {
+      jobs[i](child_contexts[i].get());
+      latch.CountDown();
+    });
+  }
+  // Diff the first subtree on the calling thread instead of idling on the
+  // latch.
+  jobs[0](child_contexts[0].get());
+  latch.Wait();
+
+  // Merge in job order so the result is indistinguishable from a serial
+  // diff.
+  for (auto& child_context : child_contexts) {
+    MergeChildContext(*child_context);
+  }
+}
+
 void DiffContext::BeginSubtree() {
   state_stack_.push_back(state_);
   state_.rect_index_ = rects_->size();
+  // Rects recorded before this point belong to ancestor or sibling scopes;
+  // compacting this subtree's rects into them would make them invisible to
+  // CurrentSubtreeRegion.
+  compaction_floor_ = rects_->size();
   state_.has_filter_bounds_adjustment = false;
   state_.has_texture = false;
   if (state_.transform_override) {
@@ -100,17 +232,48 @@ Damage DiffContext::ComputeDamage(const SkIRect& accumulated_buffer_damage,
   SkRect buffer_damage = SkRect::Make(accumulated_buffer_damage);
   buffer_damage.join(damage_);
   SkRect frame_damage(damage_);
+  std::vector<SkRect> frame_damage_rects = damage_rects_;
 
+  // Coalesce overlapping readback regions first. Sibling backdrop filters
+  // stacked over one background register a readback rect each; merging them
+  // treats the shared backdrop source as a single region instead of
+  // expanding the damage through each sibling's rect separately.
+  std::vector<SkRect> readback_rects;
   for (const auto& r : readbacks_) {
     SkRect rect = SkRect::Make(r.rect);
-    if (rect.intersects(frame_damage)) {
-      frame_damage.join(rect);
-    }
-    if (rect.intersects(buffer_damage)) {
-      buffer_damage.join(rect);
-    }
+    bool merged;
+    do {
+      merged = false;
+      for (auto it = readback_rects.begin(); it != readback_rects.end(); it++) {
+        if (rect.intersects(*it)) {
+          rect.join(*it);
+          readback_rects.erase(it);
+          merged = true;
+          break;
+        }
+      }
+    } while (merged);
+    readback_rects.push_back(rect);
   }
 
+  // A readback joined into the damage can newly overlap a region examined
+  // earlier, so iterate to a fixed point.
+  bool changed;
+  do {
+    changed = false;
+    for (const auto& rect : readback_rects) {
+      if (rect.intersects(frame_damage) && !frame_damage.contains(rect)) {
+        frame_damage.join(rect);
+        AccumulateDamageRect(frame_damage_rects, kMaxDamageRects, rect);
+        changed = true;
+      }
+      if (rect.intersects(buffer_damage) && !buffer_damage.contains(rect)) {
+        buffer_damage.join(rect);
+        changed = true;
+      }
+    }
+  } while (changed);
+
   Damage res;
   buffer_damage.roundOut(&res.buffer_damage);
   frame_damage.roundOut(&res.frame_damage);
@@ -125,6 +288,20 @@ Damage DiffContext::ComputeDamage(const SkIRect& accumulated_buffer_damage,
     AlignRect(res.frame_damage, horizontal_clip_alignment,
               vertical_clip_alignment);
   }
+
+  res.frame_damage_rects.reserve(frame_damage_rects.size());
+  for (const auto& rect : frame_damage_rects) {
+    SkIRect damage_rect;
+    rect.roundOut(&damage_rect);
+    if (!damage_rect.intersect(frame_clip)) {
+      continue;
+    }
+    if (horizontal_clip_alignment > 1 || vertical_clip_alignment > 1) {
+      AlignRect(damage_rect, horizontal_clip_alignment,
+                vertical_clip_alignment);
+    }
+    res.frame_damage_rects.push_back(damage_rect);
+  }
   return res;
 }
 
@@ -170,13 +347,54 @@ void DiffContext::AddLayerBounds(const SkRect& rect) {
                           ? ApplyFilterBoundsAdjustment(
                                 state_.transform_override->mapRect(rect))
                           : transformed_rect;
-    rects_->push_back(paint_rect);
+    AddRect(paint_rect);
     if (IsSubtreeDirty()) {
       AddDamage(paint_rect);
     }
   }
 }
 
+void DiffContext::AddRect(const SkRect& rect) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  FML_DCHECK(compaction_floor_ <= rects_->size());
+  SkScalar rect_area = rect.width() * rect.height();
+  // Join the rect into an entry of the open span when the union wastes
+  // little area; heavily animated screens otherwise accumulate thousands of
+  // overlapping rects that every ancestor region has to carry.
+  for (size_t i = compaction_floor_; i < rects_->size(); ++i) {
+    SkRect joined = (*rects_)[i];
+    joined.join(rect);
+    SkScalar joined_area = joined.width() * joined.height();
+    SkScalar waste = joined_area -
+                     (*rects_)[i].width() * (*rects_)[i].height() - rect_area;
+    if (waste <= kPaintRegionJoinWasteFactor * joined_area) {
+      (*rects_)[i] = joined;
+      return;
+    }
+  }
+  if (rects_->size() - compaction_floor_ >= kMaxOpenPaintRegionRects) {
+    // The open span is at its limit; fold the rect into the entry whose
+    // bounding box grows the least, mirroring AccumulateDamageRect.
+    size_t best_index = compaction_floor_;
+    SkScalar least_waste = std::numeric_limits<SkScalar>::max();
+    for (size_t i = compaction_floor_; i < rects_->size(); ++i) {
+      SkRect joined = (*rects_)[i];
+      joined.join(rect);
+      SkScalar waste = joined.width() * joined.height() -
+                       (*rects_)[i].width() * (*rects_)[i].height();
+      if (waste < least_waste) {
+        least_waste = waste;
+        best_index = i;
+      }
+    }
+    (*rects_)[best_index].join(rect);
+    return;
+  }
+  rects_->push_back(rect);
+}
+
 void DiffContext::MarkSubtreeHasTextureLayer() {
   // Set the has_texture flag on current state and all parent states. That
   // way we'll know that we can't skip diff for retained layers because
@@ -192,7 +410,12 @@ void DiffContext::AddExistingPaintRegion(const PaintRegion& region) {
   // dirty, so we know, for example, that the inherited transforms must match
   FML_DCHECK(!IsSubtreeDirty());
   if (region.is_valid()) {
-    rects_->insert(rects_->end(), region.begin(), region.end());
+    // Feed the rects through AddRect instead of copying them verbatim; this
+    // re-compacts retained regions as ancestors re-accumulate them, which is
+    // what keeps the shared rect storage from growing with tree depth.
+    for (const auto& rect : region) {
+      AddRect(rect);
+    }
   }
 }
 
@@ -200,8 +423,11 @@ void DiffContext::AddReadbackRegion(const SkIRect& rect) {
   Readback readback;
   readback.rect = rect;
   readback.position = rects_->size();
-  // Push empty rect as a placeholder for position in current subtree
+  // Push empty rect as a placeholder for position in current subtree. The
+  // placeholder is referenced by position, so it must never become a
+  // compaction target.
   rects_->push_back(SkRect::MakeEmpty());
+  compaction_floor_ = rects_->size();
   readbacks_.push_back(readback);
 }
 
@@ -209,6 +435,9 @@ PaintRegion DiffContext::CurrentSubtreeRegion() const {
   bool has_readback = std::any_of(
       readbacks_.begin(), readbacks_.end(),
       [&](const Readback& r) { return r.position >= state_.rect_index_; });
+  // The returned region references the current span of rects_; freeze it so
+  // later compaction can not grow rects the region was captured with.
+  compaction_floor_ = rects_->size();
   return PaintRegion(rects_, state_.rect_index_, rects_->size(), has_readback,
                      state_.has_texture);
 }
@@ -216,12 +445,13 @@ PaintRegion DiffContext::CurrentSubtreeRegion() const {
 void DiffContext::AddDamage(const PaintRegion& damage) {
   FML_DCHECK(damage.is_valid());
   for (const auto& r : damage) {
-    damage_.join(r);
+    AddDamage(r);
   }
 }
 
 void DiffContext::AddDamage(const SkRect& rect) {
   damage_.join(rect);
+  AccumulateDamageRect(damage_rects_, kMaxDamageRects, rect);
 }
 
 void DiffContext::SetLayerPaintRegion(const Layer* layer,
@@ -7,17 +7,20 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <optional>
 #include <vector>
 #include "flutter/flow/paint_region.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/task_runner.h"
 #include "third_party/skia/include/core/SkMatrix.h"
 #include "third_party/skia/include/core/SkRect.h"
 
 namespace flutter {
 
 class Layer;
+class TextureRegistry;
 
 // Represents area that needs to be updated in front buffer (frame_damage) and
 // area that is going to be painted to in back buffer (buffer_damage).
@@ -34,6 +37,13 @@ struct Damage {
   // upfront may be useful for tile based GPUs.
   // Corresponds to "buffer damage" from EGL_KHR_partial_update.
   SkIRect buffer_damage;
+
+  // The frame damage broken into a bounded number of rectangles whose union
+  // covers every changed area; frame_damage is their bounding rectangle.
+  // Backends that can present a list of damage rectangles (i.e.
+  // EGL_KHR_swap_buffers_with_damage) can use this to avoid recomposing the
+  // unchanged area between distant small changes.
+  std::vector<SkIRect> frame_damage_rects;
 };
 
 // Layer Unique Id to PaintRegion
@@ -162,6 +172,39 @@ class DiffContext {
   // cached.
   bool has_raster_cache() const { return has_raster_cache_; }
 
+  // Sets the task runner used by DiffSubtrees to fan independent subtree
+  // diffs out to concurrent workers. When unset (the default) all subtrees
+  // are diffed serially on the calling thread.
+  void SetConcurrentTaskRunner(fml::BasicTaskRunner* concurrent_task_runner) {
+    concurrent_task_runner_ = concurrent_task_runner;
+  }
+
+  fml::BasicTaskRunner* concurrent_task_runner() const {
+    return concurrent_task_runner_;
+  }
+
+  // Sets the texture registry consulted during diffing. TextureLayer uses it
+  // to look up the frame generation of its texture so that a texture whose
+  // producer has not published a new frame does not dirty the subtree. When
+  // unset (the default) texture layers are always treated as dirty.
+  void SetTextureRegistry(TextureRegistry* texture_registry) {
+    texture_registry_ = texture_registry;
+  }
+
+  TextureRegistry* texture_registry() const { return texture_registry_; }
+
+  // A single subtree diff; receives the context against which the subtree
+  // must be diffed.
+  using SubtreeDiffJob = std::function<void(DiffContext*)>;
+
+  // Runs the given subtree diff jobs and merges their results in job order,
+  // so the outcome is indistinguishable from running them serially against
+  // this context. With a concurrent task runner set and enough jobs to make
+  // the fan-out worthwhile, each job runs against its own child context on
+  // the worker pool; otherwise the jobs simply run in place. The jobs must
+  // not share mutable state other than the context they are given.
+  void DiffSubtrees(const std::vector<SubtreeDiffJob>& jobs);
+
   class Statistics {
    public:
     // Picture replaced by different picture
@@ -183,6 +226,18 @@ class DiffContext {
       ++different_instance_but_equal_pictures_;
     };
 
+    // Accumulates the statistics gathered by a child context during
+    // concurrent subtree diffing.
+    void Merge(const Statistics& other) {
+      new_pictures_ += other.new_pictures_;
+      pictures_too_complex_to_compare_ +=
+          other.pictures_too_complex_to_compare_;
+      same_instance_pictures_ += other.same_instance_pictures_;
+      deep_compare_pictures_ += other.deep_compare_pictures_;
+      different_instance_but_equal_pictures_ +=
+          other.different_instance_but_equal_pictures_;
+    }
+
     // Logs the statistics to trace counter
     void LogStatistics();
 
@@ -197,6 +252,31 @@ class DiffContext {
   Statistics& statistics() { return statistics_; }
 
  private:
+  // Constructs a child context for CreateChildContext. The child accumulates
+  // paint regions into its own map storage, which MergeChildContext folds
+  // back into the parent map.
+  DiffContext(SkISize frame_size,
+              double frame_device_pixel_ratio,
+              const PaintRegionMap& last_frame_paint_region_map,
+              bool has_raster_cache);
+
+  // Creates a context that can diff a subtree on another thread as if the
+  // subtree were diffed in place: the child starts out with this context's
+  // current transform, cull rect and dirty flag but writes to its own rect
+  // and damage storage. The concurrent task runner deliberately does not
+  // propagate to the child, so nested containers diff serially; pool workers
+  // blocking on a nested fan-out queued behind them could deadlock the pool.
+  std::unique_ptr<DiffContext> CreateChildContext() const;
+
+  // Folds the rects, damage, readbacks, paint regions, texture flag and
+  // statistics accumulated by a child context back into this context.
+  void MergeChildContext(DiffContext& child);
+
+  // Minimum number of jobs before DiffSubtrees fans out to the concurrent
+  // task runner; below this the context setup and merge overhead outweighs
+  // the parallelism gains.
+  static constexpr size_t kMinSubtreesForConcurrentDiff = 4;
+
   struct State {
     State();
 
@@ -224,6 +304,11 @@ class DiffContext {
   };
 
   std::shared_ptr<std::vector<SkRect>> rects_;
+  // First index of rects_ that is not yet referenced by a captured paint
+  // region (or by a sibling scope) and is therefore a valid compaction
+  // target. Bumped when subtrees begin and when regions are captured;
+  // mutable because capturing a region is a const operation.
+  mutable size_t compaction_floor_ = 0;
   State state_;
   SkISize frame_size_;
   double frame_device_pixel_ratio_;
@@ -234,11 +319,42 @@ class DiffContext {
   // Rect must be in device coordinates.
   SkRect ApplyFilterBoundsAdjustment(SkRect rect) const;
 
+  // Maximum number of rectangles the damage is tracked as before additions
+  // are merged into the entry whose bounding box grows the least. Keeps the
+  // accumulation cost bounded on screens with many small changes while still
+  // separating distant changes for multi-rect presentation.
+  static constexpr size_t kMaxDamageRects = 8;
+
+  // Incremental paint region compaction: a rect appended to the shared rect
+  // storage is joined into an entry recorded since the last captured region
+  // when the union wastes at most this fraction of its own area (overlap
+  // counts as negative waste).
+  static constexpr SkScalar kPaintRegionJoinWasteFactor = 0.25f;
+
+  // Maximum number of rects the open (not yet captured) span of the shared
+  // rect storage may hold before further rects are folded into the entry
+  // whose bounding box grows the least. Bounds per-region rect counts no
+  // matter how many paint rects a subtree accumulates.
+  static constexpr size_t kMaxOpenPaintRegionRects = 32;
+
+  // Appends |rect| to the shared rect storage, compacting it into an
+  // existing entry where the join policy above allows. Only entries at or
+  // past compaction_floor_ may be modified; everything before it is
+  // referenced by already captured paint regions and must stay unchanged.
+  void AddRect(const SkRect& rect);
+
   SkRect damage_ = SkRect::MakeEmpty();
+  std::vector<SkRect> damage_rects_;
+
+  // Backing storage for this_frame_paint_region_map_ in child contexts;
+  // unused (empty) in contexts created through the public constructor.
+  PaintRegionMap child_paint_region_map_storage_;
 
   PaintRegionMap& this_frame_paint_region_map_;
   const PaintRegionMap& last_frame_paint_region_map_;
   bool has_raster_cache_;
+  fml::BasicTaskRunner* concurrent_task_runner_ = nullptr;
+  TextureRegistry* texture_registry_ = nullptr;
 
   void AddDamage(const SkRect& rect);
 
@@ -32,5 +32,55 @@ TEST_F(DiffContextTest, ClipAlignment) {
   EXPECT_EQ(damage.buffer_damage, SkIRect::MakeLTRB(16, 16, 64, 64));
 }
 
+TEST_F(DiffContextTest, PaintRegionCompaction) {
+  PaintRegionMap this_frame;
+  PaintRegionMap last_frame;
+  DiffContext context(SkISize::Make(1000, 1000), 1, this_frame, last_frame,
+                      false);
+
+  // Overlapping bounds within one subtree are joined into a single rect.
+  context.BeginSubtree();
+  context.AddLayerBounds(SkRect::MakeLTRB(0, 0, 20, 20));
+  context.AddLayerBounds(SkRect::MakeLTRB(10, 10, 30, 30));
+  auto region = context.CurrentSubtreeRegion();
+  EXPECT_EQ(std::distance(region.begin(), region.end()), 1);
+  EXPECT_EQ(region.ComputeBounds(), SkRect::MakeLTRB(0, 0, 30, 30));
+  context.EndSubtree();
+
+  // Distant bounds whose union would waste most of its area stay separate.
+  context.BeginSubtree();
+  context.AddLayerBounds(SkRect::MakeLTRB(0, 0, 10, 10));
+  context.AddLayerBounds(SkRect::MakeLTRB(900, 900, 910, 910));
+  auto distant_region = context.CurrentSubtreeRegion();
+  EXPECT_EQ(std::distance(distant_region.begin(), distant_region.end()), 2);
+  context.EndSubtree();
+
+  // A captured region must not grow when later subtrees add overlapping
+  // bounds.
+  context.BeginSubtree();
+  context.AddLayerBounds(SkRect::MakeLTRB(0, 0, 40, 40));
+  context.EndSubtree();
+  EXPECT_EQ(region.ComputeBounds(), SkRect::MakeLTRB(0, 0, 30, 30));
+}
+
+TEST_F(DiffContextTest, PaintRegionRectCountIsBounded) {
+  PaintRegionMap this_frame;
+  PaintRegionMap last_frame;
+  DiffContext context(SkISize::Make(1000, 1000), 1, this_frame, last_frame,
+                      false);
+
+  // Far more distant rects than the open span may hold; once the limit is
+  // reached additions are folded into the entry that grows the least.
+  context.BeginSubtree();
+  for (int i = 0; i < 100; ++i) {
+    context.AddLayerBounds(SkRect::MakeXYWH(i * 500, i * 500, 10, 10));
+  }
+  auto region = context.CurrentSubtreeRegion();
+  EXPECT_LE(std::distance(region.begin(), region.end()), 32);
+  EXPECT_EQ(region.ComputeBounds(),
+            SkRect::MakeLTRB(0, 0, 99 * 500 + 10, 99 * 500 + 10));
+  context.EndSubtree();
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -75,66 +75,73 @@ void ExternalViewEmbedder::SubmitFrame(GrDirectContext* context,
 };
 
 void MutatorsStack::PushClipRect(const SkRect& rect) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(rect);
-  vector_.push_back(element);
+  MutableVector().emplace_back(rect);
 };
 
 void MutatorsStack::PushClipRRect(const SkRRect& rrect) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(rrect);
-  vector_.push_back(element);
+  MutableVector().emplace_back(rrect);
 };
 
 void MutatorsStack::PushClipPath(const SkPath& path) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(path);
-  vector_.push_back(element);
+  MutableVector().emplace_back(path);
 };
 
 void MutatorsStack::PushTransform(const SkMatrix& matrix) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(matrix);
-  vector_.push_back(element);
+  MutableVector().emplace_back(matrix);
 };
 
 void MutatorsStack::PushOpacity(const int& alpha) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(alpha);
-  vector_.push_back(element);
+  MutableVector().emplace_back(alpha);
 };
 
 void MutatorsStack::PushBackdropFilter(
     const std::shared_ptr<const DlImageFilter>& filter) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(filter);
-  vector_.push_back(element);
+  MutableVector().emplace_back(filter);
 };
 
 void MutatorsStack::Pop() {
-  vector_.pop_back();
+  MutableVector().pop_back();
 };
 
 void MutatorsStack::PopTo(size_t stack_count) {
-  while (vector_.size() > stack_count) {
+  while (this->stack_count() > stack_count) {
     Pop();
   }
 }
 
-const std::vector<std::shared_ptr<Mutator>>::const_reverse_iterator
-MutatorsStack::Top() const {
-  return vector_.rend();
+const std::vector<Mutator>::const_reverse_iterator MutatorsStack::Top() const {
+  return GetVector().rend();
 };
 
-const std::vector<std::shared_ptr<Mutator>>::const_reverse_iterator
-MutatorsStack::Bottom() const {
-  return vector_.rbegin();
+const std::vector<Mutator>::const_reverse_iterator MutatorsStack::Bottom()
+    const {
+  return GetVector().rbegin();
 };
 
-const std::vector<std::shared_ptr<Mutator>>::const_iterator
-MutatorsStack::Begin() const {
-  return vector_.begin();
+const std::vector<Mutator>::const_iterator MutatorsStack::Begin() const {
+  return GetVector().begin();
 };
 
-const std::vector<std::shared_ptr<Mutator>>::const_iterator MutatorsStack::End()
-    const {
-  return vector_.end();
+const std::vector<Mutator>::const_iterator MutatorsStack::End() const {
+  return GetVector().end();
 };
 
+std::vector<Mutator>& MutatorsStack::MutableVector() {
+  if (vector_ == nullptr) {
+    vector_ = std::make_shared<std::vector<Mutator>>();
+  } else if (vector_.use_count() > 1) {
+    // The vector is shared with a copy of this stack; mutate a clone so the
+    // copy keeps observing the mutators it was taken with.
+    vector_ = std::make_shared<std::vector<Mutator>>(*vector_);
+  }
+  return *vector_;
+}
+
+const std::vector<Mutator>& MutatorsStack::GetVector() const {
+  static const std::vector<Mutator> kEmptyMutatorVector;
+  return vector_ == nullptr ? kEmptyMutatorVector : *vector_;
+}
+
 bool ExternalViewEmbedder::SupportsDynamicThreadMerging() {
   return false;
 }
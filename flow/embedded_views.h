@@ -109,7 +109,7 @@ class Mutator {
 
   bool operator!=(const Mutator& other) const { return !operator==(other); }
 
-  bool IsClipType() {
+  bool IsClipType() const {
     return type_ == kClipRect || type_ == kClipRRect || type_ == kClipPath;
   }
 
@@ -145,6 +145,12 @@ class Mutator {
 // For example consider the following stack: [T1, T2, T3], where T1 is the top
 // of the stack and T3 is the bottom of the stack. Applying this mutators stack
 // to a platform view P1 will result in T1(T2(T3(P1))).
+//
+// The mutators are stored by value in a shared vector so that copying the
+// stack (one copy per platform view per frame, into EmbeddedViewParams) only
+// retains a reference to the vector. Mutating operations clone the vector
+// first when it is shared (copy-on-write), so copies never observe later
+// mutations of the stack they were taken from.
 class MutatorsStack {
  public:
   MutatorsStack() = default;
@@ -164,46 +170,30 @@ class MutatorsStack {
 
   // Returns a reverse iterator pointing to the top of the stack, which is the
   // mutator that is furtherest from the leaf node.
-  const std::vector<std::shared_ptr<Mutator>>::const_reverse_iterator Top()
-      const;
+  const std::vector<Mutator>::const_reverse_iterator Top() const;
   // Returns a reverse iterator pointing to the bottom of the stack, which is
   // the mutator that is closeset from the leaf node.
-  const std::vector<std::shared_ptr<Mutator>>::const_reverse_iterator Bottom()
-      const;
+  const std::vector<Mutator>::const_reverse_iterator Bottom() const;
 
   // Returns an iterator pointing to the beginning of the mutator vector, which
   // is the mutator that is furtherest from the leaf node.
-  const std::vector<std::shared_ptr<Mutator>>::const_iterator Begin() const;
+  const std::vector<Mutator>::const_iterator Begin() const;
 
   // Returns an iterator pointing to the end of the mutator vector, which is the
   // mutator that is closest from the leaf node.
-  const std::vector<std::shared_ptr<Mutator>>::const_iterator End() const;
+  const std::vector<Mutator>::const_iterator End() const;
 
-  bool is_empty() const { return vector_.empty(); }
-  size_t stack_count() const { return vector_.size(); }
+  bool is_empty() const { return vector_ == nullptr || vector_->empty(); }
+  size_t stack_count() const {
+    return vector_ == nullptr ? 0 : vector_->size();
+  }
 
   bool operator==(const MutatorsStack& other) const {
-    if (vector_.size() != other.vector_.size()) {
-      return false;
-    }
-    for (size_t i = 0; i < vector_.size(); i++) {
-      if (*vector_[i] != *other.vector_[i]) {
-        return false;
-      }
-    }
-    return true;
+    return GetVector() == other.GetVector();
   }
 
   bool operator==(const std::vector<Mutator>& other) const {
-    if (vector_.size() != other.size()) {
-      return false;
-    }
-    for (size_t i = 0; i < vector_.size(); i++) {
-      if (*vector_[i] != other[i]) {
-        return false;
-      }
-    }
-    return true;
+    return GetVector() == other;
   }
 
   bool operator!=(const MutatorsStack& other) const {
@@ -215,7 +205,15 @@ class MutatorsStack {
   }
 
  private:
-  std::vector<std::shared_ptr<Mutator>> vector_;
+  // Returns the mutator vector, cloning it first if it is shared with copies
+  // of this stack.
+  std::vector<Mutator>& MutableVector();
+
+  // Returns the mutator vector, or an empty vector when nothing has been
+  // pushed yet.
+  const std::vector<Mutator>& GetVector() const;
+
+  std::shared_ptr<std::vector<Mutator>> vector_;
 };  // MutatorsStack
 
 class EmbeddedViewParams {
@@ -67,6 +67,42 @@ fml::TimePoint FrameTimingsRecorder::GetRasterEndWallTime() const {
   return raster_end_wall_time_;
 }
 
+fml::TimePoint FrameTimingsRecorder::GetBufferAcquireStartTime() const {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ >= State::kRasterEnd);
+  return buffer_acquire_start_;
+}
+
+fml::TimePoint FrameTimingsRecorder::GetBufferAcquireEndTime() const {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ >= State::kRasterEnd);
+  return buffer_acquire_end_;
+}
+
+fml::TimePoint FrameTimingsRecorder::GetRasterEncodeEndTime() const {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ >= State::kRasterEnd);
+  return raster_encode_end_;
+}
+
+fml::TimePoint FrameTimingsRecorder::GetPresentStartTime() const {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ >= State::kRasterEnd);
+  return present_start_;
+}
+
+fml::TimePoint FrameTimingsRecorder::GetPresentEndTime() const {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ >= State::kRasterEnd);
+  return present_end_;
+}
+
+fml::TimePoint FrameTimingsRecorder::GetGpuWorkEndTime() const {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ >= State::kRasterEnd);
+  return gpu_work_end_;
+}
+
 fml::TimeDelta FrameTimingsRecorder::GetBuildDuration() const {
   std::scoped_lock state_lock(state_mutex_);
   FML_DCHECK(state_ >= State::kBuildEnd);
@@ -131,6 +167,43 @@ void FrameTimingsRecorder::RecordRasterStart(fml::TimePoint raster_start) {
   raster_start_ = raster_start;
 }
 
+void FrameTimingsRecorder::RecordBufferAcquireStart(
+    fml::TimePoint acquire_start) {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ >= State::kBuildEnd && state_ < State::kRasterEnd);
+  buffer_acquire_start_ = acquire_start;
+}
+
+void FrameTimingsRecorder::RecordBufferAcquireEnd(fml::TimePoint acquire_end) {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ >= State::kBuildEnd && state_ < State::kRasterEnd);
+  buffer_acquire_end_ = acquire_end;
+}
+
+void FrameTimingsRecorder::RecordRasterEncodeEnd(fml::TimePoint encode_end) {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ == State::kRasterStart);
+  raster_encode_end_ = encode_end;
+}
+
+void FrameTimingsRecorder::RecordPresentStart(fml::TimePoint present_start) {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ == State::kRasterStart);
+  present_start_ = present_start;
+}
+
+void FrameTimingsRecorder::RecordPresentEnd(fml::TimePoint present_end) {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ == State::kRasterStart);
+  present_end_ = present_end;
+}
+
+void FrameTimingsRecorder::RecordGpuWorkEnd(fml::TimePoint gpu_work_end) {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ == State::kRasterStart);
+  gpu_work_end_ = gpu_work_end;
+}
+
 FrameTiming FrameTimingsRecorder::RecordRasterEnd(const RasterCache* cache) {
   std::scoped_lock state_lock(state_mutex_);
   FML_DCHECK(state_ == State::kRasterStart);
@@ -148,12 +221,38 @@ FrameTiming FrameTimingsRecorder::RecordRasterEnd(const RasterCache* cache) {
     layer_cache_count_ = layer_cache_bytes_ = picture_cache_count_ =
         picture_cache_bytes_ = 0;
   }
+  // Resolve the optional surface phases so the derived durations degrade to
+  // zero when a phase was never observed.
+  if (buffer_acquire_start_ == fml::TimePoint()) {
+    buffer_acquire_start_ = raster_start_;
+  }
+  if (buffer_acquire_end_ == fml::TimePoint()) {
+    buffer_acquire_end_ = buffer_acquire_start_;
+  }
+  if (raster_encode_end_ == fml::TimePoint()) {
+    raster_encode_end_ = raster_end_;
+  }
+  if (present_start_ == fml::TimePoint()) {
+    present_start_ = raster_end_;
+  }
+  if (present_end_ == fml::TimePoint()) {
+    present_end_ = raster_end_;
+  }
+  if (gpu_work_end_ == fml::TimePoint()) {
+    gpu_work_end_ = raster_end_;
+  }
   timing_.Set(FrameTiming::kVsyncStart, vsync_start_);
   timing_.Set(FrameTiming::kBuildStart, build_start_);
   timing_.Set(FrameTiming::kBuildFinish, build_end_);
   timing_.Set(FrameTiming::kRasterStart, raster_start_);
   timing_.Set(FrameTiming::kRasterFinish, raster_end_);
   timing_.Set(FrameTiming::kRasterFinishWallTime, raster_end_wall_time_);
+  timing_.Set(FrameTiming::kBufferAcquireStart, buffer_acquire_start_);
+  timing_.Set(FrameTiming::kBufferAcquireFinish, buffer_acquire_end_);
+  timing_.Set(FrameTiming::kRasterEncodeFinish, raster_encode_end_);
+  timing_.Set(FrameTiming::kPresentStart, present_start_);
+  timing_.Set(FrameTiming::kPresentFinish, present_end_);
+  timing_.Set(FrameTiming::kGpuWorkFinish, gpu_work_end_);
   timing_.SetFrameNumber(GetFrameNumber());
   timing_.SetRasterCacheStatistics(layer_cache_count_, layer_cache_bytes_,
                                    picture_cache_count_, picture_cache_bytes_);
@@ -194,6 +293,12 @@ std::unique_ptr<FrameTimingsRecorder> FrameTimingsRecorder::CloneUntil(
   if (state >= State::kRasterEnd) {
     recorder->raster_end_ = raster_end_;
     recorder->raster_end_wall_time_ = raster_end_wall_time_;
+    recorder->buffer_acquire_start_ = buffer_acquire_start_;
+    recorder->buffer_acquire_end_ = buffer_acquire_end_;
+    recorder->raster_encode_end_ = raster_encode_end_;
+    recorder->present_start_ = present_start_;
+    recorder->present_end_ = present_end_;
+    recorder->gpu_work_end_ = gpu_work_end_;
     recorder->layer_cache_count_ = layer_cache_count_;
     recorder->layer_cache_bytes_ = layer_cache_bytes_;
     recorder->picture_cache_count_ = picture_cache_count_;
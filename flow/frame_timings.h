@@ -68,6 +68,39 @@ class FrameTimingsRecorder {
   /// Timestamp of when the frame rasterization is complete in wall-time.
   fml::TimePoint GetRasterEndWallTime() const;
 
+  /// Timestamp of when the wait to acquire the surface's drawable or
+  /// framebuffer started.
+  ///
+  /// Frames that never recorded an acquisition report the raster start time,
+  /// yielding a zero wait.
+  fml::TimePoint GetBufferAcquireStartTime() const;
+
+  /// Timestamp of when the surface's drawable or framebuffer was acquired.
+  fml::TimePoint GetBufferAcquireEndTime() const;
+
+  /// Timestamp of when encoding the frame's drawing commands finished,
+  /// before the flush/submit and present.
+  ///
+  /// Frames that never recorded an encode end report the raster end time.
+  fml::TimePoint GetRasterEncodeEndTime() const;
+
+  /// Timestamp of when the present/swap of the frame began.
+  ///
+  /// Frames that never recorded a present report the raster end time.
+  fml::TimePoint GetPresentStartTime() const;
+
+  /// Timestamp of when the present/swap call returned.
+  ///
+  /// When the present is deferred to a separate thread the return time is
+  /// unknown to this recorder and the raster end time is reported instead.
+  fml::TimePoint GetPresentEndTime() const;
+
+  /// Timestamp of when the GPU finished executing the frame's work.
+  ///
+  /// Backends without fence or timestamp plumbing leave this unset and the
+  /// raster end time is reported instead.
+  fml::TimePoint GetGpuWorkEndTime() const;
+
   /// Duration of the frame build time.
   fml::TimeDelta GetBuildDuration() const;
 
@@ -95,6 +128,32 @@ class FrameTimingsRecorder {
   /// Records a raster start event.
   void RecordRasterStart(fml::TimePoint raster_start);
 
+  /// Records the start of the wait to acquire the surface's drawable or
+  /// framebuffer.
+  ///
+  /// Unlike the state-advancing events above, the surface events below are
+  /// optional: a recorder that never observes them substitutes the raster
+  /// start/end timestamps when the summary is built so the derived durations
+  /// degrade to zero rather than garbage.
+  void RecordBufferAcquireStart(fml::TimePoint acquire_start);
+
+  /// Records the end of the drawable/framebuffer acquisition wait.
+  void RecordBufferAcquireEnd(fml::TimePoint acquire_end);
+
+  /// Records when encoding the frame's drawing commands finished, separating
+  /// pure rasterization work from the subsequent flush/submit and present.
+  void RecordRasterEncodeEnd(fml::TimePoint encode_end);
+
+  /// Records when the present/swap of the frame began.
+  void RecordPresentStart(fml::TimePoint present_start);
+
+  /// Records when the present/swap call returned.
+  void RecordPresentEnd(fml::TimePoint present_end);
+
+  /// Records when the GPU finished executing the frame's work, as reported
+  /// by a backend fence or timestamp query.
+  void RecordGpuWorkEnd(fml::TimePoint gpu_work_end);
+
   /// Clones the recorder until (and including) the specified state.
   std::unique_ptr<FrameTimingsRecorder> CloneUntil(State state);
 
@@ -130,6 +189,15 @@ class FrameTimingsRecorder {
   fml::TimePoint raster_end_;
   fml::TimePoint raster_end_wall_time_;
 
+  // Optional surface phases. Unset (default constructed) values are
+  // substituted with the raster start/end timestamps in `RecordRasterEnd`.
+  fml::TimePoint buffer_acquire_start_;
+  fml::TimePoint buffer_acquire_end_;
+  fml::TimePoint raster_encode_end_;
+  fml::TimePoint present_start_;
+  fml::TimePoint present_end_;
+  fml::TimePoint gpu_work_end_;
+
   size_t layer_cache_count_;
   size_t layer_cache_bytes_;
   size_t picture_cache_count_;
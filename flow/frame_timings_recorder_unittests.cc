@@ -122,6 +122,73 @@ TEST(FrameTimingsRecorderTest, RecordRasterTimesWithCache) {
   ASSERT_EQ(recorder->GetPictureCacheBytes(), picture_bytes);
 }
 
+TEST(FrameTimingsRecorderTest, RecordSurfacePhases) {
+  auto recorder = std::make_unique<FrameTimingsRecorder>();
+
+  const auto st = fml::TimePoint::Now();
+  const auto en = st + fml::TimeDelta::FromMillisecondsF(16);
+  recorder->RecordVsync(st, en);
+  recorder->RecordBuildStart(fml::TimePoint::Now());
+  recorder->RecordBuildEnd(fml::TimePoint::Now());
+
+  const auto acquire_start = fml::TimePoint::Now();
+  const auto acquire_end = acquire_start + fml::TimeDelta::FromMilliseconds(1);
+  recorder->RecordBufferAcquireStart(acquire_start);
+  recorder->RecordBufferAcquireEnd(acquire_end);
+
+  const auto raster_start = fml::TimePoint::Now();
+  recorder->RecordRasterStart(raster_start);
+
+  const auto encode_end = raster_start + fml::TimeDelta::FromMilliseconds(2);
+  const auto present_start = encode_end + fml::TimeDelta::FromMilliseconds(1);
+  const auto present_end = present_start + fml::TimeDelta::FromMilliseconds(3);
+  const auto gpu_work_end = present_end + fml::TimeDelta::FromMilliseconds(4);
+  recorder->RecordRasterEncodeEnd(encode_end);
+  recorder->RecordPresentStart(present_start);
+  recorder->RecordPresentEnd(present_end);
+  recorder->RecordGpuWorkEnd(gpu_work_end);
+
+  const auto timing = recorder->RecordRasterEnd();
+
+  ASSERT_EQ(acquire_start, recorder->GetBufferAcquireStartTime());
+  ASSERT_EQ(acquire_end, recorder->GetBufferAcquireEndTime());
+  ASSERT_EQ(encode_end, recorder->GetRasterEncodeEndTime());
+  ASSERT_EQ(present_start, recorder->GetPresentStartTime());
+  ASSERT_EQ(present_end, recorder->GetPresentEndTime());
+  ASSERT_EQ(gpu_work_end, recorder->GetGpuWorkEndTime());
+
+  ASSERT_EQ(acquire_start, timing.Get(FrameTiming::kBufferAcquireStart));
+  ASSERT_EQ(acquire_end, timing.Get(FrameTiming::kBufferAcquireFinish));
+  ASSERT_EQ(encode_end, timing.Get(FrameTiming::kRasterEncodeFinish));
+  ASSERT_EQ(present_start, timing.Get(FrameTiming::kPresentStart));
+  ASSERT_EQ(present_end, timing.Get(FrameTiming::kPresentFinish));
+  ASSERT_EQ(gpu_work_end, timing.Get(FrameTiming::kGpuWorkFinish));
+}
+
+TEST(FrameTimingsRecorderTest, SurfacePhasesDefaultWhenUnrecorded) {
+  auto recorder = std::make_unique<FrameTimingsRecorder>();
+
+  const auto st = fml::TimePoint::Now();
+  const auto en = st + fml::TimeDelta::FromMillisecondsF(16);
+  recorder->RecordVsync(st, en);
+  recorder->RecordBuildStart(fml::TimePoint::Now());
+  recorder->RecordBuildEnd(fml::TimePoint::Now());
+  recorder->RecordRasterStart(fml::TimePoint::Now());
+  const auto timing = recorder->RecordRasterEnd();
+
+  // Unrecorded phases snap to the raster start/end so the derived durations
+  // degrade to zero.
+  const auto raster_start = recorder->GetRasterStartTime();
+  const auto raster_end = recorder->GetRasterEndTime();
+  ASSERT_EQ(raster_start, recorder->GetBufferAcquireStartTime());
+  ASSERT_EQ(raster_start, recorder->GetBufferAcquireEndTime());
+  ASSERT_EQ(raster_end, recorder->GetRasterEncodeEndTime());
+  ASSERT_EQ(raster_end, recorder->GetPresentStartTime());
+  ASSERT_EQ(raster_end, recorder->GetPresentEndTime());
+  ASSERT_EQ(raster_end, recorder->GetGpuWorkEndTime());
+  ASSERT_EQ(raster_end, timing.Get(FrameTiming::kGpuWorkFinish));
+}
+
 // Windows and Fuchsia don't allow testing with killed by signal.
 #if !defined(OS_FUCHSIA) && !defined(FML_OS_WIN) && \
     (FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_DEBUG)
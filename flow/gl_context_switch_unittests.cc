@@ -25,5 +25,78 @@ TEST(GLContextSwitchTest, SwitchKeepsContextCurrentWhileInScope) {
   ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), -1);
 }
 
+TEST(GLContextSwitchTest, NestedSwitchToSameContextIsSkipped) {
+  TestSwitchableGLContext::ResetSetCurrentCount();
+  {
+    auto outer_switch =
+        GLContextSwitch(std::make_unique<TestSwitchableGLContext>(7));
+    ASSERT_EQ(TestSwitchableGLContext::GetSetCurrentCount(), 1);
+    {
+      auto inner_switch =
+          GLContextSwitch(std::make_unique<TestSwitchableGLContext>(7));
+      ASSERT_TRUE(inner_switch.GetResult());
+      ASSERT_EQ(TestSwitchableGLContext::GetSetCurrentCount(), 1);
+    }
+    // The inner scope neither set nor removed the current context.
+    ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 7);
+  }
+  ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), -1);
+}
+
+TEST(GLContextSwitchTest, NestedSwitchToDifferentContextIsNotSkipped) {
+  TestSwitchableGLContext::ResetSetCurrentCount();
+  {
+    auto outer_switch =
+        GLContextSwitch(std::make_unique<TestSwitchableGLContext>(1));
+    {
+      auto inner_switch =
+          GLContextSwitch(std::make_unique<TestSwitchableGLContext>(2));
+      ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 2);
+    }
+    ASSERT_EQ(TestSwitchableGLContext::GetSetCurrentCount(), 2);
+  }
+}
+
+TEST(GLContextSwitchTest, BatchKeepsContextCurrentAcrossSwitches) {
+  TestSwitchableGLContext::ResetSetCurrentCount();
+  {
+    GLContextSwitchBatch batch;
+    {
+      auto context_switch =
+          GLContextSwitch(std::make_unique<TestSwitchableGLContext>(3));
+      ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 3);
+    }
+    // The restore is deferred to the end of the batch.
+    ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 3);
+    {
+      auto context_switch =
+          GLContextSwitch(std::make_unique<TestSwitchableGLContext>(3));
+      ASSERT_TRUE(context_switch.GetResult());
+    }
+    // The second switch found the context already current.
+    ASSERT_EQ(TestSwitchableGLContext::GetSetCurrentCount(), 1);
+  }
+  ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), -1);
+}
+
+TEST(GLContextSwitchTest, BatchRestoresBeforeSwitchingToOtherContext) {
+  TestSwitchableGLContext::ResetSetCurrentCount();
+  {
+    GLContextSwitchBatch batch;
+    {
+      auto context_switch =
+          GLContextSwitch(std::make_unique<TestSwitchableGLContext>(4));
+    }
+    ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 4);
+    {
+      auto context_switch =
+          GLContextSwitch(std::make_unique<TestSwitchableGLContext>(5));
+      ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 5);
+    }
+    ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 5);
+  }
+  ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), -1);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -11,15 +11,15 @@
 
 namespace flutter {
 
-static const size_t kMaxSamples = 120;
 static const size_t kMaxFrameMarkers = 8;
 
 Stopwatch::Stopwatch(const RefreshRateUpdater& updater)
     : refresh_rate_updater_(updater),
       start_(fml::TimePoint::Now()),
       current_sample_(0) {
-  const fml::TimeDelta delta = fml::TimeDelta::Zero();
-  laps_.resize(kMaxSamples, delta);
+  for (auto& lap : laps_) {
+    lap.store(0, std::memory_order_relaxed);
+  }
   cache_dirty_ = true;
   prev_drawn_sample_index_ = 0;
 }
@@ -36,20 +36,31 @@ FixedRefreshRateUpdater::FixedRefreshRateUpdater(
 
 void Stopwatch::Start() {
   start_ = fml::TimePoint::Now();
-  current_sample_ = (current_sample_ + 1) % kMaxSamples;
+  size_t current = current_sample_.load(std::memory_order_relaxed);
+  current_sample_.store((current + 1) % kMaxSamples, std::memory_order_relaxed);
 }
 
 void Stopwatch::Stop() {
-  laps_[current_sample_] = fml::TimePoint::Now() - start_;
+  size_t current = current_sample_.load(std::memory_order_relaxed);
+  laps_[current].store((fml::TimePoint::Now() - start_).ToMicroseconds(),
+                       std::memory_order_relaxed);
 }
 
 void Stopwatch::SetLapTime(const fml::TimeDelta& delta) {
-  current_sample_ = (current_sample_ + 1) % kMaxSamples;
-  laps_[current_sample_] = delta;
+  size_t current = current_sample_.load(std::memory_order_relaxed);
+  current = (current + 1) % kMaxSamples;
+  current_sample_.store(current, std::memory_order_relaxed);
+  laps_[current].store(delta.ToMicroseconds(), std::memory_order_relaxed);
+}
+
+fml::TimeDelta Stopwatch::GetLap(size_t index) const {
+  return fml::TimeDelta::FromMicroseconds(
+      laps_[index].load(std::memory_order_relaxed));
 }
 
-const fml::TimeDelta& Stopwatch::LastLap() const {
-  return laps_[(current_sample_ - 1) % kMaxSamples];
+fml::TimeDelta Stopwatch::LastLap() const {
+  size_t current = current_sample_.load(std::memory_order_relaxed);
+  return GetLap((current + kMaxSamples - 1) % kMaxSamples);
 }
 
 double Stopwatch::UnitFrameInterval(double raster_time_ms) const {
@@ -68,8 +79,9 @@ double Stopwatch::UnitHeight(double raster_time_ms,
 fml::TimeDelta Stopwatch::MaxDelta() const {
   fml::TimeDelta max_delta;
   for (size_t i = 0; i < kMaxSamples; i++) {
-    if (laps_[i] > max_delta) {
-      max_delta = laps_[i];
+    fml::TimeDelta lap = GetLap(i);
+    if (lap > max_delta) {
+      max_delta = lap;
     }
   }
   return max_delta;
@@ -78,11 +90,35 @@ fml::TimeDelta Stopwatch::MaxDelta() const {
 fml::TimeDelta Stopwatch::AverageDelta() const {
   fml::TimeDelta sum;  // default to 0
   for (size_t i = 0; i < kMaxSamples; i++) {
-    sum = sum + laps_[i];
+    sum = sum + GetLap(i);
   }
   return sum / kMaxSamples;
 }
 
+Stopwatch::Statistics Stopwatch::GetStatistics() const {
+  std::array<int64_t, kMaxSamples> samples;
+  int64_t sum = 0;
+  int64_t max = 0;
+  for (size_t i = 0; i < kMaxSamples; i++) {
+    samples[i] = laps_[i].load(std::memory_order_relaxed);
+    sum += samples[i];
+    max = std::max(max, samples[i]);
+  }
+  std::sort(samples.begin(), samples.end());
+  // Nearest-rank percentile over the full window.
+  auto percentile = [&samples](size_t percent) {
+    return fml::TimeDelta::FromMicroseconds(
+        samples[(percent * kMaxSamples - 1) / 100]);
+  };
+  return {
+      .average = fml::TimeDelta::FromMicroseconds(sum / kMaxSamples),
+      .max = fml::TimeDelta::FromMicroseconds(max),
+      .p50 = percentile(50),
+      .p90 = percentile(90),
+      .p99 = percentile(99),
+  };
+}
+
 // Initialize the SkSurface for drawing into. Draws the base background and any
 // timing data from before the initial Visualize() call.
 void Stopwatch::InitVisualizeSurface(const SkRect& rect) const {
@@ -127,7 +163,7 @@ void Stopwatch::InitVisualizeSurface(const SkRect& rect) const {
   SkPath path;
   path.setIsVolatile(true);
   path.moveTo(x, height);
-  path.lineTo(x, y + height * (1.0 - UnitHeight(laps_[0].ToMillisecondsF(),
+  path.lineTo(x, y + height * (1.0 - UnitHeight(GetLap(0).ToMillisecondsF(),
                                                 max_unit_interval)));
   double unit_x;
   double unit_next_x = 0.0;
@@ -135,14 +171,14 @@ void Stopwatch::InitVisualizeSurface(const SkRect& rect) const {
     unit_x = unit_next_x;
     unit_next_x = (static_cast<double>(i + 1) / kMaxSamples);
     const double sample_y =
-        y + height * (1.0 - UnitHeight(laps_[i].ToMillisecondsF(),
+        y + height * (1.0 - UnitHeight(GetLap(i).ToMillisecondsF(),
                                        max_unit_interval));
     path.lineTo(x + width * unit_x, sample_y);
     path.lineTo(x + width * unit_next_x, sample_y);
   }
   path.lineTo(
       width,
-      y + height * (1.0 - UnitHeight(laps_[kMaxSamples - 1].ToMillisecondsF(),
+      y + height * (1.0 - UnitHeight(GetLap(kMaxSamples - 1).ToMillisecondsF(),
                                      max_unit_interval)));
   path.lineTo(width, height);
   path.close();
@@ -172,6 +208,7 @@ void Stopwatch::Visualize(SkCanvas* canvas, const SkRect& rect) const {
   const double max_unit_interval = UnitFrameInterval(max_interval);
 
   const double sample_unit_width = (1.0 / kMaxSamples);
+  const size_t current_sample = current_sample_.load(std::memory_order_relaxed);
 
   // Draw vertical replacement bar to erase old/stale pixels.
   paint.setColor(0x99FFFFFF);
@@ -189,8 +226,8 @@ void Stopwatch::Visualize(SkCanvas* canvas, const SkRect& rect) const {
   const auto bar_rect = SkRect::MakeLTRB(
       sample_x,
       y + height * (1.0 -
-                    UnitHeight(laps_[current_sample_ == 0 ? kMaxSamples - 1
-                                                          : current_sample_ - 1]
+                    UnitHeight(GetLap(current_sample == 0 ? kMaxSamples - 1
+                                                          : current_sample - 1)
                                    .ToMillisecondsF(),
                                max_unit_interval)),
       sample_x + width * sample_unit_width, height);
@@ -234,11 +271,11 @@ void Stopwatch::Visualize(SkCanvas* canvas, const SkRect& rect) const {
     // within budget
     paint.setColor(SK_ColorGREEN);
   }
-  sample_x = x + width * (static_cast<double>(current_sample_) / kMaxSamples);
+  sample_x = x + width * (static_cast<double>(current_sample) / kMaxSamples);
   const auto marker_rect = SkRect::MakeLTRB(
       sample_x, y, sample_x + width * sample_unit_width, height);
   cache_canvas->drawRect(marker_rect, paint);
-  prev_drawn_sample_index_ = current_sample_;
+  prev_drawn_sample_index_ = current_sample;
 
   // Draw the cached surface onto the output canvas.
   visualize_cache_surface_->draw(canvas, rect.x(), rect.y());
@@ -5,7 +5,8 @@
 #ifndef FLUTTER_FLOW_INSTRUMENTATION_H_
 #define FLUTTER_FLOW_INSTRUMENTATION_H_
 
-#include <vector>
+#include <array>
+#include <atomic>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/time/time_delta.h"
@@ -16,6 +17,9 @@ namespace flutter {
 
 class Stopwatch {
  public:
+  /// Number of laps retained in the rolling sample window.
+  static constexpr size_t kMaxSamples = 120;
+
   /// The refresh rate interface for `Stopwatch`.
   class RefreshRateUpdater {
    public:
@@ -28,14 +32,33 @@ class Stopwatch {
   /// everytime when `GetFrameBudget()` is called.
   explicit Stopwatch(const RefreshRateUpdater& updater);
 
+  /// Aggregate statistics over the lap window, computed on demand by
+  /// `GetStatistics`.
+  struct Statistics {
+    fml::TimeDelta average;
+    fml::TimeDelta max;
+    fml::TimeDelta p50;
+    fml::TimeDelta p90;
+    fml::TimeDelta p99;
+  };
+
   ~Stopwatch();
 
-  const fml::TimeDelta& LastLap() const;
+  fml::TimeDelta LastLap() const;
 
   fml::TimeDelta MaxDelta() const;
 
   fml::TimeDelta AverageDelta() const;
 
+  /// Computes the rolling frame-time statistics over the lap window.
+  ///
+  /// Unlike the visualization this may be called from any thread: laps are
+  /// kept in a ring buffer of atomics, so a concurrent `Start`, `Stop` or
+  /// `SetLapTime` on the owning thread at worst leaves one stale sample in
+  /// the snapshot. Laps not yet recorded count as zero, matching the
+  /// treatment in `AverageDelta` and `MaxDelta`.
+  Statistics GetStatistics() const;
+
   void InitVisualizeSurface(const SkRect& rect) const;
 
   void Visualize(SkCanvas* canvas, const SkRect& rect) const;
@@ -53,10 +76,16 @@ class Stopwatch {
   inline double UnitFrameInterval(double time_ms) const;
   inline double UnitHeight(double time_ms, double max_height) const;
 
+  // Returns the lap stored at |index| in the ring buffer.
+  fml::TimeDelta GetLap(size_t index) const;
+
   const RefreshRateUpdater& refresh_rate_updater_;
   fml::TimePoint start_;
-  std::vector<fml::TimeDelta> laps_;
-  size_t current_sample_;
+  // Lap durations in microseconds. Written by the owning thread only, but
+  // read by any thread; the per-sample atomics rule out torn reads and no
+  // further ordering is needed for aggregate statistics.
+  std::array<std::atomic<int64_t>, kMaxSamples> laps_;
+  std::atomic<size_t> current_sample_;
 
   // Mutable data cache for performance optimization of the graphs. Prevents
   // expensive redrawing of old data.
@@ -42,5 +42,31 @@ TEST(Instrumentation, GetFrameBudgetFromUpdaterTest) {
   EXPECT_EQ(frame_budget_90fps, actual_frame_budget);
 }
 
+TEST(Instrumentation, GetStatisticsPercentiles) {
+  FixedRefreshRateStopwatch stopwatch;
+  // Fill the whole sample window with 1ms..120ms laps.
+  for (size_t i = 1; i <= Stopwatch::kMaxSamples; i++) {
+    stopwatch.SetLapTime(fml::TimeDelta::FromMilliseconds(i));
+  }
+  Stopwatch::Statistics stats = stopwatch.GetStatistics();
+  EXPECT_EQ(stats.p50, fml::TimeDelta::FromMilliseconds(60));
+  EXPECT_EQ(stats.p90, fml::TimeDelta::FromMilliseconds(108));
+  EXPECT_EQ(stats.p99, fml::TimeDelta::FromMilliseconds(119));
+  EXPECT_EQ(stats.max, fml::TimeDelta::FromMilliseconds(120));
+  EXPECT_EQ(stats.average, fml::TimeDelta::FromMicroseconds(60500));
+}
+
+TEST(Instrumentation, LastLapWrapsAroundTheRing) {
+  FixedRefreshRateStopwatch stopwatch;
+  // LastLap reports the lap before the in-progress sample slot. After
+  // exactly kMaxSamples laps the current slot has wrapped back to zero, so
+  // the previous lap lives at the far end of the ring.
+  for (size_t i = 1; i <= Stopwatch::kMaxSamples; i++) {
+    stopwatch.SetLapTime(fml::TimeDelta::FromMilliseconds(i));
+  }
+  EXPECT_EQ(stopwatch.LastLap(),
+            fml::TimeDelta::FromMilliseconds(Stopwatch::kMaxSamples - 1));
+}
+
 }  // namespace testing
 }  // namespace flutter
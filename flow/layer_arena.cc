@@ -0,0 +1,42 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layer_arena.h"
+
+#include <algorithm>
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+LayerArena::LayerArena() = default;
+
+LayerArena::~LayerArena() = default;
+
+void* LayerArena::Allocate(size_t size, size_t alignment) {
+  FML_DCHECK(alignment <= alignof(std::max_align_t));
+  size_t padding =
+      (alignment - reinterpret_cast<uintptr_t>(cursor_) % alignment) %
+      alignment;
+  if (cursor_ == nullptr || size + padding > remaining_) {
+    // Arrays of uint8_t from operator new[] are suitably aligned for any
+    // object that fits in them. Requests larger than the default slab get a
+    // dedicated slab of their own.
+    size_t slab_size = std::max(kSlabSize, size + alignment);
+    slabs_.push_back(std::make_unique<uint8_t[]>(slab_size));
+    bytes_reserved_ += slab_size;
+    cursor_ = slabs_.back().get();
+    remaining_ = slab_size;
+    padding = (alignment - reinterpret_cast<uintptr_t>(cursor_) % alignment) %
+              alignment;
+    FML_DCHECK(size + padding <= remaining_);
+  }
+  cursor_ += padding;
+  remaining_ -= padding + size;
+  void* result = cursor_;
+  cursor_ += size;
+  return result;
+}
+
+}  // namespace flutter
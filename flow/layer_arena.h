@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_LAYER_ARENA_H_
+#define FLUTTER_FLOW_LAYER_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+// An arena that services the layer allocations of a single scene build from
+// contiguous slabs.
+//
+// Layers built for one frame are allocated together and mostly die together
+// when the layer tree is discarded, but retained layers may be handed to a
+// later scene and outlive the frame. The arena therefore hands out memory
+// through std::allocate_shared: the layer and its control block are placed
+// together in the current slab, every control block shares ownership of the
+// arena, and the slabs are returned wholesale once the arena and the last
+// layer allocated from it are gone. Individual deallocations are no-ops.
+//
+// Allocation happens on the UI thread during scene building; releasing the
+// last reference (and thereby the slabs) may happen on any thread.
+class LayerArena : public std::enable_shared_from_this<LayerArena> {
+ public:
+  LayerArena();
+  ~LayerArena();
+
+  // Allocator whose storage comes from the arena's slabs and whose copies
+  // (held by shared_ptr control blocks) share ownership of the arena.
+  template <typename T>
+  class Allocator {
+   public:
+    using value_type = T;
+
+    explicit Allocator(std::shared_ptr<LayerArena> arena)
+        : arena_(std::move(arena)) {}
+
+    template <typename U>
+    Allocator(const Allocator<U>& other) : arena_(other.arena_) {}
+
+    T* allocate(size_t n) {
+      return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, size_t n) {
+      // Memory is reclaimed when the last allocator copy releases the arena.
+    }
+
+    template <typename U>
+    bool operator==(const Allocator<U>& other) const {
+      return arena_ == other.arena_;
+    }
+
+    template <typename U>
+    bool operator!=(const Allocator<U>& other) const {
+      return arena_ != other.arena_;
+    }
+
+   private:
+    template <typename U>
+    friend class Allocator;
+
+    std::shared_ptr<LayerArena> arena_;
+  };
+
+  // Creates an object of type T placed in the arena together with its
+  // shared_ptr control block. The arena must itself be owned by a
+  // shared_ptr.
+  template <typename T, typename... Args>
+  std::shared_ptr<T> Make(Args&&... args) {
+    return std::allocate_shared<T>(Allocator<T>(shared_from_this()),
+                                   std::forward<Args>(args)...);
+  }
+
+  // Total bytes currently reserved by the arena's slabs.
+  size_t bytes_reserved() const { return bytes_reserved_; }
+
+ private:
+  // Returns |size| bytes aligned to |alignment|, starting a new slab when
+  // the current one cannot fit the request.
+  void* Allocate(size_t size, size_t alignment);
+
+  // Default slab size; kept small so a retained layer pinning the arena it
+  // was born in does not hold on to an excessive amount of memory.
+  static constexpr size_t kSlabSize = 16384;
+
+  std::vector<std::unique_ptr<uint8_t[]>> slabs_;
+  uint8_t* cursor_ = nullptr;
+  size_t remaining_ = 0;
+  size_t bytes_reserved_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(LayerArena);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_LAYER_ARENA_H_
@@ -0,0 +1,61 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layer_arena.h"
+
+#include <array>
+
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+struct Tracked {
+  explicit Tracked(int* counter) : counter(counter) { (*counter)++; }
+  ~Tracked() { (*counter)--; }
+  int* counter;
+  char payload[64];
+};
+
+}  // namespace
+
+TEST(LayerArena, ObjectsOutliveTheBuilderReference) {
+  int alive = 0;
+  std::shared_ptr<Tracked> object;
+  {
+    auto arena = std::make_shared<LayerArena>();
+    object = arena->Make<Tracked>(&alive);
+    EXPECT_EQ(alive, 1);
+  }
+  // The control block keeps the arena (and its slabs) alive.
+  EXPECT_EQ(alive, 1);
+  object.reset();
+  EXPECT_EQ(alive, 0);
+}
+
+TEST(LayerArena, AllocationsShareSlabs) {
+  auto arena = std::make_shared<LayerArena>();
+  int alive = 0;
+  std::vector<std::shared_ptr<Tracked>> objects;
+  for (int i = 0; i < 100; i++) {
+    objects.push_back(arena->Make<Tracked>(&alive));
+  }
+  EXPECT_EQ(alive, 100);
+  // 100 objects of ~80 bytes plus their control blocks fit in one slab.
+  EXPECT_EQ(arena->bytes_reserved(), 16384u);
+  objects.clear();
+  EXPECT_EQ(alive, 0);
+}
+
+TEST(LayerArena, OversizedAllocationGetsDedicatedSlab) {
+  auto arena = std::make_shared<LayerArena>();
+  auto big = arena->Make<std::array<uint8_t, 32768>>();
+  EXPECT_NE(big, nullptr);
+  EXPECT_GE(arena->bytes_reserved(), 32768u);
+}
+
+}  // namespace testing
+}  // namespace flutter
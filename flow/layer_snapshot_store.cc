@@ -4,6 +4,7 @@
 
 #include "flutter/flow/layer_snapshot_store.h"
 
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
 
@@ -18,6 +19,22 @@ LayerSnapshotData::LayerSnapshotData(int64_t layer_unique_id,
       snapshot_(snapshot),
       bounds_(bounds) {}
 
+LayerSnapshotData::LayerSnapshotData(int64_t layer_unique_id,
+                                     const fml::TimeDelta& duration,
+                                     const sk_sp<SkImage>& raster_image,
+                                     const SkRect& bounds)
+    : layer_unique_id_(layer_unique_id),
+      duration_(duration),
+      raster_image_(raster_image),
+      bounds_(bounds) {}
+
+void LayerSnapshotData::EncodeSnapshot() const {
+  if (snapshot_ || !raster_image_) {
+    return;
+  }
+  snapshot_ = raster_image_->encodeToData();
+}
+
 void LayerSnapshotStore::Clear() {
   layer_snapshots_.clear();
 }
@@ -26,4 +43,21 @@ void LayerSnapshotStore::Add(const LayerSnapshotData& data) {
   layer_snapshots_.push_back(data);
 }
 
+void LayerSnapshotStore::EncodeSnapshots(fml::BasicTaskRunner* worker) {
+  if (worker == nullptr || layer_snapshots_.empty()) {
+    for (auto& snapshot : layer_snapshots_) {
+      snapshot.EncodeSnapshot();
+    }
+    return;
+  }
+  fml::CountDownLatch latch(layer_snapshots_.size());
+  for (auto& snapshot : layer_snapshots_) {
+    worker->PostTask([&snapshot, &latch]() {
+      snapshot.EncodeSnapshot();
+      latch.CountDown();
+    });
+  }
+  latch.Wait();
+}
+
 }  // namespace flutter
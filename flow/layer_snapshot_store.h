@@ -8,8 +8,10 @@
 #include <vector>
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/task_runner.h"
 #include "flutter/fml/time/time_delta.h"
 
+#include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkImageEncoder.h"
 #include "third_party/skia/include/core/SkPictureRecorder.h"
 #include "third_party/skia/include/core/SkSerialProcs.h"
@@ -28,20 +30,38 @@ class LayerSnapshotData {
                     const sk_sp<SkData>& snapshot,
                     const SkRect& bounds);
 
+  /// Variant that retains the unencoded raster image. The PNG encode is
+  /// deferred to |EncodeSnapshot| (typically run on a worker) so capturing
+  /// snapshots does not slow down the rasterization being measured.
+  LayerSnapshotData(int64_t layer_unique_id,
+                    const fml::TimeDelta& duration,
+                    const sk_sp<SkImage>& raster_image,
+                    const SkRect& bounds);
+
   ~LayerSnapshotData() = default;
 
   int64_t GetLayerUniqueId() const { return layer_unique_id_; }
 
   fml::TimeDelta GetDuration() const { return duration_; }
 
-  sk_sp<SkData> GetSnapshot() const { return snapshot_; }
+  /// Encodes the retained raster image as PNG if that has not happened yet.
+  /// The raster image is immutable and CPU backed, so this may run on any
+  /// thread as long as no other thread touches this snapshot concurrently.
+  void EncodeSnapshot() const;
+
+  /// Returns the PNG encoded snapshot, encoding it in place if necessary.
+  sk_sp<SkData> GetSnapshot() const {
+    EncodeSnapshot();
+    return snapshot_;
+  }
 
   SkRect GetBounds() const { return bounds_; }
 
  private:
   const int64_t layer_unique_id_;
   const fml::TimeDelta duration_;
-  const sk_sp<SkData> snapshot_;
+  mutable sk_sp<SkData> snapshot_;
+  const sk_sp<SkImage> raster_image_;
   const SkRect bounds_;
 };
 
@@ -64,6 +84,11 @@ class LayerSnapshotStore {
   // Returns the number of snapshots collected.
   size_t Size() const { return layer_snapshots_.size(); }
 
+  /// Encodes any snapshots still holding unencoded raster images. With a
+  /// |worker| the encodes are fanned out to it and this call blocks until
+  /// they complete; without one they run in place.
+  void EncodeSnapshots(fml::BasicTaskRunner* worker = nullptr);
+
   // make this class iterable
   Snapshots::iterator begin() { return layer_snapshots_.begin(); }
   Snapshots::iterator end() { return layer_snapshots_.end(); }
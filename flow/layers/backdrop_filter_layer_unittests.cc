@@ -416,5 +416,46 @@ TEST_F(BackdropLayerDiffTest, BackdropLayerInvalidTransform) {
   EXPECT_EQ(damage.frame_damage, SkIRect::MakeWH(100, 100));
 }
 
+TEST_F(BackdropLayerDiffTest, SiblingBackdropLayersShareBackdropRegion) {
+  auto filter = DlBlurImageFilter(10, 10, DlTileMode::kClamp);
+
+  {
+    // tests later assume 30px readback area, fail early if that's not the case
+    SkIRect readback;
+    EXPECT_EQ(filter.get_input_device_bounds(SkIRect::MakeWH(10, 10),
+                                             SkMatrix::I(), readback),
+              &readback);
+    EXPECT_EQ(readback, SkIRect::MakeLTRB(-30, -30, 40, 40));
+  }
+
+  // Two sibling panels whose readback regions overlap; together they read
+  // back one backdrop region spanning (70, 70, 280, 180).
+  auto clip1 = std::make_shared<ClipRectLayer>(
+      SkRect::MakeLTRB(100, 100, 150, 150), Clip::hardEdge);
+  clip1->Add(std::make_shared<BackdropFilterLayer>(filter.shared(),
+                                                   DlBlendMode::kSrcOver));
+  auto clip2 = std::make_shared<ClipRectLayer>(
+      SkRect::MakeLTRB(200, 100, 250, 150), Clip::hardEdge);
+  clip2->Add(std::make_shared<BackdropFilterLayer>(filter.shared(),
+                                                   DlBlendMode::kSrcOver));
+
+  MockLayerTree l1(SkISize::Make(500, 500));
+  l1.root()->Add(clip1);
+  l1.root()->Add(clip2);
+  DiffLayerTree(l1, MockLayerTree(SkISize::Make(500, 500)));
+
+  // New content overlaps only the second panel's readback; the damage must
+  // propagate through the shared backdrop region to the first panel as well,
+  // even though the first panel registered its readback earlier.
+  MockLayerTree l2(SkISize::Make(500, 500));
+  l2.root()->Add(clip1);
+  l2.root()->Add(clip2);
+  auto path = SkPath().addRect(SkRect::MakeLTRB(260, 60, 270, 75));
+  l2.root()->Add(std::make_shared<MockLayer>(path));
+
+  auto damage = DiffLayerTree(l2, l1);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(70, 60, 280, 180));
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -4,10 +4,50 @@
 
 #include "flutter/flow/layers/container_layer.h"
 
+#include <memory>
 #include <optional>
 
+#include "flutter/fml/synchronization/count_down_latch.h"
+
 namespace flutter {
 
+namespace {
+
+// Owns the per-child state referenced by the PrerollContext handed to a
+// worker during concurrent preroll. The state stack is seeded with the cull
+// rect and transform the parent preroll has accumulated so far, so the child
+// observes the same state it would in the serial loop.
+struct ChildPrerollState {
+  explicit ChildPrerollState(const PrerollContext& parent)
+      : context{
+            // clang-format off
+            .raster_cache             = parent.raster_cache,
+            .gr_context               = parent.gr_context,
+            .view_embedder            = parent.view_embedder,
+            .state_stack              = state_stack,
+            .dst_color_space          = parent.dst_color_space,
+            .surface_needs_readback   = false,
+            .raster_time              = parent.raster_time,
+            .ui_time                  = parent.ui_time,
+            .texture_registry         = parent.texture_registry,
+            .frame_device_pixel_ratio = parent.frame_device_pixel_ratio,
+            .raster_cached_entries    = &raster_cache_items,
+            .display_list_enabled     = parent.display_list_enabled,
+            // clang-format on
+        } {
+    state_stack.set_initial_state(parent.state_stack.device_cull_rect(),
+                                  parent.state_stack.transform_4x4());
+    state_stack.set_delegate(&mutators_stack);
+  }
+
+  LayerStateStack state_stack;
+  MutatorsStack mutators_stack;
+  std::vector<RasterCacheItem*> raster_cache_items;
+  PrerollContext context;
+};
+
+}  // namespace
+
 ContainerLayer::ContainerLayer() : child_paint_bounds_(SkRect::MakeEmpty()) {}
 
 void ContainerLayer::Diff(DiffContext* context, const Layer* old_layer) {
@@ -26,9 +66,27 @@ void ContainerLayer::PreservePaintRegion(DiffContext* context) {
 
 void ContainerLayer::DiffChildren(DiffContext* context,
                                   const ContainerLayer* old_layer) {
+  // With a concurrent task runner on the context, full child diffs are
+  // collected as jobs and handed to DiffContext::DiffSubtrees, which fans
+  // them out to the worker pool and merges the resulting paint regions in
+  // child order. Retained children are still handled in place since reusing
+  // their previous paint region is cheap.
+  const bool defer_subtree_jobs = context->concurrent_task_runner() != nullptr;
+  std::vector<DiffContext::SubtreeDiffJob> jobs;
+
   if (context->IsSubtreeDirty()) {
-    for (auto& layer : layers_) {
-      layer->Diff(context, nullptr);
+    if (defer_subtree_jobs) {
+      jobs.reserve(layers_.size());
+      for (auto& layer : layers_) {
+        jobs.push_back([layer](DiffContext* diff_context) {
+          layer->Diff(diff_context, nullptr);
+        });
+      }
+      context->DiffSubtrees(jobs);
+    } else {
+      for (auto& layer : layers_) {
+        layer->Diff(context, nullptr);
+      }
     }
     return;
   }
@@ -64,18 +122,42 @@ void ContainerLayer::DiffChildren(DiffContext* context,
     --old_children_bottom;
   }
 
-  // old layers that don't match
-  for (int i = old_children_top; i <= old_children_bottom; ++i) {
-    auto layer = prev_layers[i];
-    context->AddDamage(context->GetOldLayerPaintRegion(layer.get()));
-  }
+  // In-order match of the mismatched middle. A child that merely shifted
+  // within the sibling list (because a sibling was inserted or removed) is
+  // paired with the old child it replaces instead of being re-diffed as
+  // brand new; retained subtrees among them reuse their previous paint
+  // region wholesale. Matching strictly in order keeps the relative paint
+  // order of surviving children intact, so any order change still involves
+  // an unmatched child whose full region becomes damage.
+  int old_children_index = old_children_top;
 
   for (int i = 0; i < static_cast<int>(layers_.size()); ++i) {
+    auto layer = layers_[i];
+    std::shared_ptr<Layer> prev_layer;
     if (i < new_children_top || i > new_children_bottom) {
       int i_prev =
           i < new_children_top ? i : prev_layers.size() - (layers_.size() - i);
-      auto layer = layers_[i];
-      auto prev_layer = prev_layers[i_prev];
+      prev_layer = prev_layers[i_prev];
+    } else {
+      // Look ahead in the remaining old children for the first one this
+      // child replaces. Old children between the current position and the
+      // match were removed; their regions become damage.
+      int match = -1;
+      for (int j = old_children_index; j <= old_children_bottom; ++j) {
+        if (layer->IsReplacing(context, prev_layers[j].get())) {
+          match = j;
+          break;
+        }
+      }
+      if (match != -1) {
+        for (; old_children_index < match; ++old_children_index) {
+          context->AddDamage(context->GetOldLayerPaintRegion(
+              prev_layers[old_children_index].get()));
+        }
+        prev_layer = prev_layers[old_children_index++];
+      }
+    }
+    if (prev_layer) {
       auto paint_region = context->GetOldLayerPaintRegion(prev_layer.get());
       if (layer == prev_layer && !paint_region.has_readback() &&
           !paint_region.has_texture()) {
@@ -91,16 +173,36 @@ void ContainerLayer::DiffChildren(DiffContext* context,
         // associate their paint region with current layer tree so that we can
         // retrieve it in next frame diff
         layer->PreservePaintRegion(context);
+      } else if (defer_subtree_jobs) {
+        jobs.push_back([layer, prev_layer](DiffContext* diff_context) {
+          layer->Diff(diff_context, prev_layer.get());
+        });
       } else {
         layer->Diff(context, prev_layer.get());
       }
     } else {
-      DiffContext::AutoSubtreeRestore subtree(context);
-      context->MarkSubtreeDirty();
-      auto layer = layers_[i];
-      layer->Diff(context, nullptr);
+      if (defer_subtree_jobs) {
+        jobs.push_back([layer](DiffContext* diff_context) {
+          DiffContext::AutoSubtreeRestore subtree(diff_context);
+          diff_context->MarkSubtreeDirty();
+          layer->Diff(diff_context, nullptr);
+        });
+      } else {
+        DiffContext::AutoSubtreeRestore subtree(context);
+        context->MarkSubtreeDirty();
+        layer->Diff(context, nullptr);
+      }
     }
   }
+
+  // Old children in the middle that never found a match are removed.
+  for (; old_children_index <= old_children_bottom; ++old_children_index) {
+    context->AddDamage(context->GetOldLayerPaintRegion(
+        prev_layers[old_children_index].get()));
+  }
+  if (!jobs.empty()) {
+    context->DiffSubtrees(jobs);
+  }
 }
 
 void ContainerLayer::Add(std::shared_ptr<Layer> layer) {
@@ -133,6 +235,17 @@ void ContainerLayer::PrerollChildren(PrerollContext* context,
   FML_DCHECK(!context->has_platform_view);
   FML_DCHECK(!context->has_texture_layer);
 
+  // With a concurrent task runner, each child is prerolled with its own
+  // context on the worker pool and the results are merged in child order.
+  // External view embedders record platform view mutations during preroll
+  // and are not thread safe, so fan-out is skipped when one is present.
+  if (context->concurrent_task_runner != nullptr &&
+      context->view_embedder == nullptr &&
+      layers_.size() >= kMinChildrenForConcurrentPreroll) {
+    PrerollChildrenConcurrently(context, child_paint_bounds);
+    return;
+  }
+
   bool child_has_platform_view = false;
   bool child_has_texture_layer = false;
   bool all_renderable_state_flags = LayerStateStack::kCallerCanApplyAnything;
@@ -173,6 +286,62 @@ void ContainerLayer::PrerollChildren(PrerollContext* context,
   set_child_paint_bounds(*child_paint_bounds);
 }
 
+void ContainerLayer::PrerollChildrenConcurrently(PrerollContext* context,
+                                                 SkRect* child_paint_bounds) {
+  std::vector<std::unique_ptr<ChildPrerollState>> child_states;
+  child_states.reserve(layers_.size());
+  for (size_t i = 0; i < layers_.size(); i++) {
+    child_states.push_back(std::make_unique<ChildPrerollState>(*context));
+  }
+
+  // Preroll the first child on the calling thread while the remaining
+  // children run on the worker pool.
+  fml::CountDownLatch latch(layers_.size() - 1);
+  for (size_t i = 1; i < layers_.size(); i++) {
+    context->concurrent_task_runner->PostTask(
+        [layer = layers_[i].get(), state = child_states[i].get(), &latch]() {
+          layer->Preroll(&state->context);
+          latch.CountDown();
+        });
+  }
+  layers_[0]->Preroll(&child_states[0]->context);
+  latch.Wait();
+
+  // Merge in child order, mirroring the serial loop in PrerollChildren.
+  bool child_has_platform_view = false;
+  bool child_has_texture_layer = false;
+  int all_renderable_state_flags = LayerStateStack::kCallerCanApplyAnything;
+
+  for (size_t i = 0; i < layers_.size(); i++) {
+    auto& state = *child_states[i];
+    all_renderable_state_flags &= state.context.renderable_state_flags;
+    if (safe_intersection_test(child_paint_bounds,
+                               layers_[i]->paint_bounds())) {
+      all_renderable_state_flags = 0;
+    }
+    child_paint_bounds->join(layers_[i]->paint_bounds());
+
+    child_has_platform_view =
+        child_has_platform_view || state.context.has_platform_view;
+    child_has_texture_layer =
+        child_has_texture_layer || state.context.has_texture_layer;
+    context->surface_needs_readback = context->surface_needs_readback ||
+                                      state.context.surface_needs_readback;
+    if (context->raster_cached_entries != nullptr) {
+      context->raster_cached_entries->insert(
+          context->raster_cached_entries->end(),
+          state.raster_cache_items.begin(), state.raster_cache_items.end());
+    }
+  }
+
+  context->has_platform_view = child_has_platform_view;
+  context->has_texture_layer = child_has_texture_layer;
+  context->renderable_state_flags = all_renderable_state_flags;
+  set_subtree_has_platform_view(child_has_platform_view);
+  set_children_renderable_state_flags(all_renderable_state_flags);
+  set_child_paint_bounds(*child_paint_bounds);
+}
+
 void ContainerLayer::PaintChildren(PaintContext& context) const {
   // We can no longer call FML_DCHECK here on the needs_painting(context)
   // condition as that test is only valid for the PaintContext that
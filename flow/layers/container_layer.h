@@ -48,6 +48,17 @@ class ContainerLayer : public Layer {
   void PrerollChildren(PrerollContext* context, SkRect* child_paint_bounds);
 
  private:
+  // Minimum number of children required before PrerollChildren fans the
+  // per-child preroll out to the concurrent task runner; below this the
+  // merge overhead outweighs the parallelism.
+  static constexpr size_t kMinChildrenForConcurrentPreroll = 4;
+
+  // Prerolls every child with its own PrerollContext on the concurrent task
+  // runner and merges the results back into |context| in child order,
+  // producing the same state the serial loop in PrerollChildren would.
+  void PrerollChildrenConcurrently(PrerollContext* context,
+                                   SkRect* child_paint_bounds);
+
   std::vector<std::shared_ptr<Layer>> layers_;
   SkRect child_paint_bounds_;
   int children_renderable_state_flags_ = 0;
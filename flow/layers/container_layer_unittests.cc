@@ -542,6 +542,59 @@ TEST_F(ContainerLayerTest, CollectionCacheableLayer) {
             static_cast<const unsigned long>(2));
 }
 
+TEST_F(ContainerLayerTest, ConcurrentPrerollMatchesSerial) {
+  // Executes posted subtree preroll tasks synchronously so the fan-out and
+  // merge logic runs deterministically in the test.
+  class InlineTaskRunner : public fml::BasicTaskRunner {
+   public:
+    void PostTask(fml::Closure task) override { task(); }
+  };
+
+  SkPath child_path1;
+  child_path1.addRect(5.0f, 6.0f, 20.5f, 21.5f);
+  SkPath child_path2;
+  child_path2.addRect(30.0f, 2.0f, 46.5f, 14.5f);
+  SkPath child_path3;
+  child_path3.addRect(50.0f, 30.0f, 70.0f, 40.0f);
+  SkPath child_path4;
+  child_path4.addRect(3.0f, 50.0f, 10.0f, 60.0f);
+  SkMatrix initial_transform = SkMatrix::Translate(-0.5f, -0.5f);
+
+  auto mock_layer1 = std::make_shared<MockLayer>(child_path1);
+  mock_layer1->set_fake_has_platform_view(true);
+  auto mock_layer2 = std::make_shared<MockLayer>(child_path2);
+  mock_layer2->set_fake_has_texture_layer(true);
+  auto mock_layer3 = std::make_shared<MockLayer>(child_path3);
+  auto mock_layer4 = std::make_shared<MockLayer>(child_path4);
+  auto layer = std::make_shared<ContainerLayer>();
+  layer->Add(mock_layer1);
+  layer->Add(mock_layer2);
+  layer->Add(mock_layer3);
+  layer->Add(mock_layer4);
+
+  SkRect expected_total_bounds = child_path1.getBounds();
+  expected_total_bounds.join(child_path2.getBounds());
+  expected_total_bounds.join(child_path3.getBounds());
+  expected_total_bounds.join(child_path4.getBounds());
+
+  InlineTaskRunner worker;
+  preroll_context()->state_stack.set_initial_transform(initial_transform);
+  preroll_context()->concurrent_task_runner = &worker;
+  layer->Preroll(preroll_context());
+  preroll_context()->concurrent_task_runner = nullptr;
+
+  // The merged context and layer state match what the serial loop produces.
+  EXPECT_TRUE(preroll_context()->has_platform_view);
+  EXPECT_TRUE(preroll_context()->has_texture_layer);
+  EXPECT_EQ(layer->paint_bounds(), expected_total_bounds);
+  EXPECT_EQ(layer->child_paint_bounds(), layer->paint_bounds());
+  EXPECT_TRUE(layer->subtree_has_platform_view());
+  EXPECT_EQ(mock_layer1->parent_matrix(), initial_transform);
+  EXPECT_EQ(mock_layer4->parent_matrix(), initial_transform);
+  EXPECT_EQ(mock_layer1->parent_cull_rect(), kGiantRect);
+  EXPECT_EQ(mock_layer4->parent_cull_rect(), kGiantRect);
+}
+
 using ContainerLayerDiffTest = DiffContextTest;
 
 // Insert PictureLayer amongst container layers
@@ -745,5 +798,109 @@ TEST_F(ContainerLayerDiffTest, ReplaceLayer) {
   EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(200, 0, 250, 150));
 }
 
+// A retained child that shifted within the sibling list (siblings changed on
+// both ends, so prefix/suffix trimming cannot pair it) is still matched with
+// its old counterpart and keeps its paint region instead of being re-diffed
+// as brand new.
+TEST_F(ContainerLayerDiffTest, RetainedLayerShiftedInSiblingList) {
+  auto path1 = SkPath().addRect(SkRect::MakeLTRB(0, 0, 50, 50));
+  auto path2 = SkPath().addRect(SkRect::MakeLTRB(500, 0, 550, 50));
+  auto path3 = SkPath().addRect(SkRect::MakeLTRB(100, 0, 150, 50));
+  auto path4 = SkPath().addRect(SkRect::MakeLTRB(200, 0, 250, 50));
+
+  auto c1 = CreateContainerLayer(std::make_shared<MockLayer>(path1));
+  auto c2 = CreateContainerLayer(std::make_shared<MockLayer>(path2));
+  auto c3 = CreateContainerLayer(std::make_shared<MockLayer>(path3));
+  auto c4 = CreateContainerLayer(std::make_shared<MockLayer>(path4));
+
+  MockLayerTree t1;
+  t1.root()->Add(c1);
+  t1.root()->Add(c2);
+  t1.root()->Add(c3);
+
+  auto damage = DiffLayerTree(t1, MockLayerTree());
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(0, 0, 550, 50));
+
+  // c1 and c3 disappear and c4 is new, so neither end of the child list
+  // matches; c2 survives one position earlier. Damage covers c1, c3 and c4
+  // but not the retained c2.
+  MockLayerTree t2;
+  t2.root()->Add(c4);
+  t2.root()->Add(c2);
+
+  damage = DiffLayerTree(t2, t1);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(0, 0, 250, 50));
+}
+
+// Diffing changed subtrees on the concurrent task runner must produce the
+// same damage as a serial diff and leave the paint region map usable for the
+// next frame's diff.
+TEST_F(ContainerLayerDiffTest, ConcurrentSubtreeDiff) {
+  // Runs posted tasks immediately so the fan-out in
+  // DiffContext::DiffSubtrees completes deterministically.
+  class InlineTaskRunner : public fml::BasicTaskRunner {
+   public:
+    void PostTask(fml::Closure task) override { task(); }
+  };
+  InlineTaskRunner worker;
+
+  MockLayerTree t1;
+  std::vector<std::shared_ptr<ContainerLayer>> t1_children;
+  for (int i = 0; i < 6; ++i) {
+    auto pic = CreateDisplayList(SkRect::MakeXYWH(i * 100, 0, 50, 50), 1);
+    auto child = CreateContainerLayer(CreateDisplayListLayer(pic));
+    t1_children.push_back(child);
+    t1.root()->Add(child);
+  }
+
+  auto damage = DiffLayerTree(t1, MockLayerTree(), SkIRect::MakeEmpty(), 0, 0,
+                              true, &worker);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(0, 0, 550, 50));
+
+  // Keep the first and last subtree retained and replace the independent
+  // subtrees in between.
+  MockLayerTree t2;
+  std::vector<std::shared_ptr<ContainerLayer>> t2_children;
+  t2_children.push_back(t1_children[0]);
+  for (int i = 1; i < 5; ++i) {
+    auto pic = CreateDisplayList(SkRect::MakeXYWH(i * 100, 0, 50, 50), 2);
+    t2_children.push_back(CreateContainerLayer(CreateDisplayListLayer(pic)));
+  }
+  t2_children.push_back(t1_children[5]);
+  for (auto& child : t2_children) {
+    t2.root()->Add(child);
+  }
+
+  damage = DiffLayerTree(t2, t1, SkIRect::MakeEmpty(), 0, 0, true, &worker);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(100, 0, 450, 50));
+
+  // Fully retained tree; the paint regions merged from the concurrent diff
+  // must carry over so nothing is damaged.
+  MockLayerTree t3;
+  for (auto& child : t2_children) {
+    t3.root()->Add(child);
+  }
+  damage = DiffLayerTree(t3, t2, SkIRect::MakeEmpty(), 0, 0, true, &worker);
+  EXPECT_TRUE(damage.frame_damage.isEmpty());
+}
+
+// Small changes in opposite corners must stay separate in the damage rect
+// list even though the single frame_damage bound spans nearly the whole
+// surface.
+TEST_F(ContainerLayerDiffTest, MultiRectDamage) {
+  MockLayerTree t1;
+  t1.root()->Add(CreateContainerLayer(CreateDisplayListLayer(
+      CreateDisplayList(SkRect::MakeLTRB(0, 0, 50, 50), 1))));
+  t1.root()->Add(CreateContainerLayer(CreateDisplayListLayer(
+      CreateDisplayList(SkRect::MakeLTRB(900, 900, 950, 950), 1))));
+
+  auto damage = DiffLayerTree(t1, MockLayerTree());
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(0, 0, 950, 950));
+  ASSERT_EQ(damage.frame_damage_rects.size(), 2u);
+  EXPECT_EQ(damage.frame_damage_rects[0], SkIRect::MakeLTRB(0, 0, 50, 50));
+  EXPECT_EQ(damage.frame_damage_rects[1],
+            SkIRect::MakeLTRB(900, 900, 950, 950));
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -152,9 +152,11 @@ void DisplayListLayer::Paint(PaintContext& context) const {
 
     const SkRect device_bounds =
         RasterCacheUtil::GetDeviceBounds(paint_bounds(), ctm);
-    sk_sp<SkData> raster_data = offscreen_surface->GetRasterData(true);
+    // Keep the unencoded raster image; the store compresses snapshots off
+    // the raster thread before they are served.
+    sk_sp<SkImage> raster_image = offscreen_surface->GetRasterImageSnapshot();
     LayerSnapshotData snapshot_data(unique_id(), offscreen_render_time,
-                                    raster_data, device_bounds);
+                                    raster_image, device_bounds);
     context.layer_snapshot_store->Add(snapshot_data);
   }
 
@@ -387,6 +387,12 @@ TEST_F(DisplayListLayerTest, LayerTreeSnapshotsWhenEnabled) {
 
   auto& snapshot_store = layer_snapshot_store();
   EXPECT_EQ(1u, snapshot_store.Size());
+
+  // Capture retains the raw raster image; the PNG encode happens on demand.
+  snapshot_store.EncodeSnapshots();
+  for (const LayerSnapshotData& data : snapshot_store) {
+    EXPECT_NE(data.GetSnapshot(), nullptr);
+  }
 }
 
 TEST_F(DisplayListLayerTest, NoLayerTreeSnapshotsWhenDisabledByDefault) {
@@ -21,7 +21,8 @@ static bool IsDisplayListWorthRasterizing(
     DisplayList* display_list,
     bool will_change,
     bool is_complex,
-    DisplayListComplexityCalculator* complexity_calculator) {
+    DisplayListComplexityCalculator* complexity_calculator,
+    unsigned int* complexity_score) {
   if (will_change) {
     // If the display list is going to change in the future, there is no point
     // in doing to extra work to rasterize.
@@ -37,12 +38,13 @@ static bool IsDisplayListWorthRasterizing(
 
   if (is_complex) {
     // The caller seems to have extra information about the display list and
-    // thinks the display list is always worth rasterizing.
+    // thinks the display list is always worth rasterizing. No score is
+    // computed in this case.
     return true;
   }
 
-  unsigned int complexity_score = complexity_calculator->Compute(display_list);
-  return complexity_calculator->ShouldBeCached(complexity_score);
+  *complexity_score = complexity_calculator->Compute(display_list);
+  return complexity_calculator->ShouldBeCached(*complexity_score);
 }
 
 DisplayListRasterCacheItem::DisplayListRasterCacheItem(
@@ -70,16 +72,25 @@ std::unique_ptr<DisplayListRasterCacheItem> DisplayListRasterCacheItem::Make(
 void DisplayListRasterCacheItem::PrerollSetup(PrerollContext* context,
                                               const SkMatrix& matrix) {
   cache_state_ = CacheState::kNone;
+  complexity_score_.reset();
   DisplayListComplexityCalculator* complexity_calculator =
       context->gr_context ? DisplayListComplexityCalculator::GetForBackend(
                                 context->gr_context->backend())
                           : DisplayListComplexityCalculator::GetForSoftware();
 
+  unsigned int complexity_score = 0u;
   if (!IsDisplayListWorthRasterizing(display_list_, will_change_, is_complex_,
-                                     complexity_calculator)) {
+                                     complexity_calculator,
+                                     &complexity_score)) {
     // We only deal with display lists that are worthy of rasterization.
     return;
   }
+  if (!is_complex_) {
+    // Remember the score so |PrerollFinalize| can scale the cache admission
+    // threshold by the estimated rasterization cost.
+    complexity_score_ = complexity_score;
+    complexity_calculator_ = complexity_calculator;
+  }
 
   transformation_matrix_ = matrix;
   transformation_matrix_.preTranslate(offset_.x(), offset_.y());
@@ -109,8 +120,20 @@ void DisplayListRasterCacheItem::PrerollFinalize(PrerollContext* context,
   // it great than the threshold. Otherwise we only increase the entry
   // access_count.
   bool visible = !context->state_stack.content_culled(bounds);
-  int accesses = raster_cache->MarkSeen(key_id_, matrix, visible);
-  if (!visible || accesses <= raster_cache->access_threshold()) {
+  // The key is built from |transformation_matrix_| (the same matrix the
+  // paint-stage |UpdateCacheEntry| rasterizes under) so both stages share
+  // one canonicalized key and its precomputed hash.
+  cache_key_.emplace(key_id_, transformation_matrix_);
+  int accesses = raster_cache->MarkSeen(cache_key_.value(), visible);
+  int threshold = raster_cache->access_threshold();
+  if (complexity_score_.has_value()) {
+    // Expensive display lists are admitted ahead of the default schedule:
+    // the calculator scales the threshold down as the estimated cost rises
+    // and drops it to zero above its immediate-caching cutoff.
+    threshold = complexity_calculator_->CacheAccessThreshold(
+        complexity_score_.value(), threshold);
+  }
+  if (!visible || accesses <= threshold) {
     cache_state_ = kNone;
   } else {
     context->renderable_state_flags |= LayerStateStack::kCallerCanApplyOpacity;
@@ -162,7 +185,7 @@ bool DisplayListRasterCacheItem::TryToPrepareRasterCache(
       // clang-format on
   };
   return context.raster_cache->UpdateCacheEntry(
-      GetId().value(), r_context,
+      cache_key_.value(), r_context,
       [display_list = display_list_](SkCanvas* canvas) {
         display_list->RenderTo(canvas);
       });
@@ -9,6 +9,7 @@
 #include <optional>
 
 #include "flutter/display_list/display_list.h"
+#include "flutter/display_list/display_list_complexity.h"
 #include "flutter/display_list/display_list_utils.h"
 #include "flutter/flow/embedded_views.h"
 #include "flutter/flow/raster_cache_item.h"
@@ -59,6 +60,11 @@ class DisplayListRasterCacheItem : public RasterCacheItem {
   SkPoint offset_;
   bool is_complex_;
   bool will_change_;
+  // The complexity score computed in |PrerollSetup| when one was computed
+  // (|is_complex_| display lists skip scoring). |PrerollFinalize| asks
+  // |complexity_calculator_| to scale the cache admission threshold by it.
+  std::optional<unsigned int> complexity_score_;
+  DisplayListComplexityCalculator* complexity_calculator_ = nullptr;
 };
 
 }  // namespace flutter
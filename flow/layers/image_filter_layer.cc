@@ -9,6 +9,36 @@
 
 namespace flutter {
 
+namespace {
+
+// Returns true if shifting the filter input shifts the output by the same
+// amount, i.e. the filter commutes with translation. Such filters can be
+// transformed in a translation-free canonical space and their cached output
+// re-offset at draw time. Matrix-based and unrecognized filters depend on
+// absolute position and conservatively keep the full transform.
+bool FilterCommutesWithTranslation(const DlImageFilter& filter) {
+  switch (filter.type()) {
+    case DlImageFilterType::kBlur:
+    case DlImageFilterType::kDilate:
+    case DlImageFilterType::kErode:
+    case DlImageFilterType::kColorFilter:
+      return true;
+    case DlImageFilterType::kComposeFilter: {
+      auto* compose = filter.asCompose();
+      auto outer = compose->outer();
+      auto inner = compose->inner();
+      return (!outer || FilterCommutesWithTranslation(*outer)) &&
+             (!inner || FilterCommutesWithTranslation(*inner));
+    }
+    case DlImageFilterType::kMatrix:
+    case DlImageFilterType::kLocalMatrixFilter:
+    case DlImageFilterType::kUnknown:
+      return false;
+  }
+}
+
+}  // namespace
+
 ImageFilterLayer::ImageFilterLayer(std::shared_ptr<const DlImageFilter> filter)
     : CacheableContainerLayer(
           RasterCacheUtil::kMinimumRendersBeforeCachingFilterLayer),
@@ -81,8 +111,20 @@ void ImageFilterLayer::Preroll(PrerollContext* context) {
   // So in here we reset the LayerRasterCacheItem cache state.
   layer_raster_cache_item_->MarkNotCacheChildren();
 
-  transformed_filter_ =
-      filter_->makeWithLocalMatrix(context->state_stack.transform_3x3());
+  SkMatrix filter_matrix = context->state_stack.transform_3x3();
+  if (FilterCommutesWithTranslation(*filter_)) {
+    // Transform the filter in a canonical space with the translation
+    // removed; the raster cache key ignores translation the same way, so a
+    // scrolled retained layer keeps both its cached children and its
+    // transformed filter instead of re-running the filter. The filter is
+    // only rebuilt when the scale or rotation components change.
+    filter_matrix[SkMatrix::kMTransX] = 0;
+    filter_matrix[SkMatrix::kMTransY] = 0;
+  }
+  if (!transformed_filter_ || filter_matrix != transformed_filter_matrix_) {
+    transformed_filter_ = filter_->makeWithLocalMatrix(filter_matrix);
+    transformed_filter_matrix_ = filter_matrix;
+  }
   if (transformed_filter_) {
     layer_raster_cache_item_->MarkCacheChildren();
   }
@@ -26,6 +26,10 @@ class ImageFilterLayer : public CacheableContainerLayer {
  private:
   std::shared_ptr<const DlImageFilter> filter_;
   std::shared_ptr<const DlImageFilter> transformed_filter_;
+  // The matrix |transformed_filter_| was built for. Translation-invariant
+  // filters are built against a translation-free canonical matrix so a
+  // retained layer that merely scrolls keeps its transformed filter.
+  SkMatrix transformed_filter_matrix_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ImageFilterLayer);
 };
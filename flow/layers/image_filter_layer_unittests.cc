@@ -387,6 +387,40 @@ TEST_F(ImageFilterLayerTest, CacheChildren) {
       cacheable_image_filter_item->GetId().value(), other_canvas, &paint));
 }
 
+TEST_F(ImageFilterLayerTest, CacheChildrenTranslationTolerant) {
+  // A blur commutes with translation, so scrolling the layer must reuse the
+  // cached children and only a scale or rotation change may miss the cache.
+  auto dl_image_filter =
+      std::make_shared<DlBlurImageFilter>(10, 10, DlTileMode::kClamp);
+  auto initial_transform = SkMatrix::Translate(50.0, 25.0);
+  auto scrolled_transform = SkMatrix::Translate(50.0, 125.0);
+  auto scaled_transform = SkMatrix::Scale(1.0, 2.0);
+  const SkPath child_path = SkPath().addRect(SkRect::MakeWH(5.0f, 5.0f));
+  auto mock_layer = std::make_shared<MockLayer>(child_path);
+  auto layer = std::make_shared<ImageFilterLayer>(dl_image_filter);
+  layer->Add(mock_layer);
+
+  SkCanvas scrolled_canvas;
+  scrolled_canvas.setMatrix(scrolled_transform);
+  SkCanvas scaled_canvas;
+  scaled_canvas.setMatrix(scaled_transform);
+  SkPaint paint = SkPaint();
+
+  use_mock_raster_cache();
+  const auto* cacheable_image_filter_item = layer->raster_cache_item();
+
+  preroll_context()->state_stack.set_initial_transform(initial_transform);
+  layer->Preroll(preroll_context());
+  LayerTree::TryToRasterCache(cacheable_items(), &paint_context());
+
+  EXPECT_EQ(cacheable_image_filter_item->cache_state(),
+            RasterCacheItem::CacheState::kChildren);
+  EXPECT_TRUE(raster_cache()->Draw(cacheable_image_filter_item->GetId().value(),
+                                   scrolled_canvas, &paint));
+  EXPECT_FALSE(raster_cache()->Draw(
+      cacheable_image_filter_item->GetId().value(), scaled_canvas, &paint));
+}
+
 TEST_F(ImageFilterLayerTest, CacheImageFilterLayerSelf) {
   auto dl_image_filter = std::make_shared<DlMatrixImageFilter>(
       SkMatrix(), DlImageSampling::kMipmapLinear);
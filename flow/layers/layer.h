@@ -22,6 +22,7 @@
 #include "flutter/fml/compiler_specific.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/task_runner.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkColor.h"
@@ -87,6 +88,12 @@ struct PrerollContext {
   // the embedders that must decide between creating SkPicture or
   // DisplayList objects for the inter-view slices of the layer tree.
   bool display_list_enabled = false;
+
+  // Task runner on which a ContainerLayer may preroll its independent child
+  // subtrees concurrently. The runner is not propagated to the per-subtree
+  // contexts, so only the first container that fans out does so. When null,
+  // the entire preroll runs on the calling thread.
+  fml::BasicTaskRunner* concurrent_task_runner = nullptr;
 };
 
 struct PaintContext {
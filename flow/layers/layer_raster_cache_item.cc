@@ -54,7 +54,8 @@ void LayerRasterCacheItem::PrerollFinalize(PrerollContext* context,
   if (num_cache_attempts_ >= layer_cached_threshold_) {
     // the layer can be cached
     cache_state_ = CacheState::kCurrent;
-    context->raster_cache->MarkSeen(key_id_, matrix_, true);
+    cache_key_.emplace(key_id_, matrix_);
+    context->raster_cache->MarkSeen(cache_key_.value(), true);
   } else {
     num_cache_attempts_++;
     // access current layer
@@ -68,8 +69,8 @@ void LayerRasterCacheItem::PrerollFinalize(PrerollContext* context,
                                    RasterCacheKeyType::kLayerChildren);
       }
       cache_state_ = CacheState::kChildren;
-      context->raster_cache->MarkSeen(layer_children_id_.value(), matrix_,
-                                      true);
+      cache_key_.emplace(layer_children_id_.value(), matrix_);
+      context->raster_cache->MarkSeen(cache_key_.value(), true);
     }
   }
 }
@@ -158,7 +159,7 @@ bool LayerRasterCacheItem::TryToPrepareRasterCache(const PaintContext& context,
           // clang-format on
       };
       return context.raster_cache->UpdateCacheEntry(
-          GetId().value(), r_context,
+          cache_key_.value(), r_context,
           [ctx = context, cache_state = cache_state_,
            layer = layer_](SkCanvas* canvas) {
             Rasterize(cache_state, layer, ctx, canvas);
@@ -67,6 +67,7 @@ bool LayerTree::Preroll(CompositorContext::ScopedFrame& frame,
       .frame_device_pixel_ratio      = device_pixel_ratio_,
       .raster_cached_entries         = &raster_cache_items_,
       .display_list_enabled          = frame.display_list_builder() != nullptr,
+      .concurrent_task_runner        = frame.context().preroll_task_runner(),
       // clang-format on
   };
 
@@ -74,6 +74,20 @@ sk_sp<SkData> OffscreenSurface::GetRasterData(bool compressed) const {
   return flutter::GetRasterData(offscreen_surface_, compressed);
 }
 
+sk_sp<SkImage> OffscreenSurface::GetRasterImageSnapshot() const {
+  auto potentially_gpu_snapshot = offscreen_surface_->makeImageSnapshot();
+  if (!potentially_gpu_snapshot) {
+    FML_LOG(ERROR) << "Screenshot: unable to make image screenshot";
+    return nullptr;
+  }
+  auto cpu_snapshot = potentially_gpu_snapshot->makeRasterImage();
+  if (!cpu_snapshot) {
+    FML_LOG(ERROR) << "Screenshot: unable to make raster image";
+    return nullptr;
+  }
+  return cpu_snapshot;
+}
+
 SkCanvas* OffscreenSurface::GetCanvas() const {
   return offscreen_surface_->getCanvas();
 }
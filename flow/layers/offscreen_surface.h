@@ -21,6 +21,11 @@ class OffscreenSurface {
 
   sk_sp<SkData> GetRasterData(bool compressed) const;
 
+  /// Returns an uncompressed CPU-backed snapshot of the surface. Unlike
+  /// |GetRasterData| no encoding is performed, keeping the cost on the
+  /// raster thread down to the pixel readback.
+  sk_sp<SkImage> GetRasterImageSnapshot() const;
+
   SkCanvas* GetCanvas() const;
 
   bool IsValid() const;
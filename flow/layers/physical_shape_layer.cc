@@ -5,6 +5,7 @@
 #include "flutter/flow/layers/physical_shape_layer.h"
 
 #include "flutter/display_list/display_list_canvas_dispatcher.h"
+#include "flutter/flow/layers/cacheable_layer.h"
 #include "flutter/flow/paint_utils.h"
 
 namespace flutter {
@@ -54,6 +55,19 @@ void PhysicalShapeLayer::Preroll(PrerollContext* context) {
   Layer::AutoPrerollSaveLayerState save =
       Layer::AutoPrerollSaveLayerState::Create(context, UsesSaveLayer());
 
+  if (elevation_ != 0 && context->raster_cache) {
+    if (!shadow_cache_item_ || shadow_cache_item_->device_pixel_ratio() !=
+                                   context->frame_device_pixel_ratio) {
+      shadow_cache_item_ = std::make_unique<ShadowRasterCacheItem>(
+          path_, shadow_color_, elevation_, SkColorGetA(color_) != 0xff,
+          context->frame_device_pixel_ratio);
+    }
+  } else {
+    shadow_cache_item_.reset();
+  }
+  AutoCache shadow_cache = AutoCache(shadow_cache_item_.get(), context,
+                                     context->state_stack.transform_3x3());
+
   SkRect child_paint_bounds = SkRect::MakeEmpty();
   PrerollChildren(context, &child_paint_bounds);
   context->renderable_state_flags =
@@ -81,9 +95,14 @@ void PhysicalShapeLayer::Paint(PaintContext& context) const {
   FML_DCHECK(needs_painting(context));
 
   if (elevation_ != 0) {
-    DisplayListCanvasDispatcher::DrawShadow(
-        context.canvas, path_, shadow_color_, elevation_,
-        SkColorGetA(color_) != 0xff, context.frame_device_pixel_ratio);
+    // Draw the shadow from the raster cache as a sprite when possible;
+    // otherwise evaluate it on this frame.
+    if (!(shadow_cache_item_ &&
+          shadow_cache_item_->Draw(context, /*paint=*/nullptr))) {
+      DisplayListCanvasDispatcher::DrawShadow(
+          context.canvas, path_, shadow_color_, elevation_,
+          SkColorGetA(color_) != 0xff, context.frame_device_pixel_ratio);
+    }
   }
 
   // Call drawPath without clip if possible for better performance.
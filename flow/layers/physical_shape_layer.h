@@ -6,6 +6,7 @@
 #define FLUTTER_FLOW_LAYERS_PHYSICAL_SHAPE_LAYER_H_
 
 #include "flutter/flow/layers/container_layer.h"
+#include "flutter/flow/layers/shadow_raster_cache_item.h"
 
 namespace flutter {
 
@@ -29,12 +30,20 @@ class PhysicalShapeLayer : public ContainerLayer {
 
   float elevation() const { return elevation_; }
 
+  const ShadowRasterCacheItem* shadow_cache_item() const {
+    return shadow_cache_item_.get();
+  }
+
  private:
   SkColor color_;
   SkColor shadow_color_;
   float elevation_ = 0.0f;
   SkPath path_;
   Clip clip_behavior_;
+  // Created during |Preroll| (where the device pixel ratio is known) for
+  // elevated shapes so static shadows are rendered once and then drawn
+  // from the raster cache as sprites.
+  std::unique_ptr<ShadowRasterCacheItem> shadow_cache_item_;
 };
 
 }  // namespace flutter
@@ -369,6 +369,31 @@ static bool ReadbackResult(PrerollContext* context,
   return context->surface_needs_readback;
 }
 
+TEST_F(PhysicalShapeLayerTest, ShadowIsRasterCachedWhenStable) {
+  use_mock_raster_cache();
+  SkPath layer_path;
+  layer_path.addRect(0, 0, 8, 8);
+  auto layer = std::make_shared<PhysicalShapeLayer>(SK_ColorGREEN,
+                                                    SK_ColorBLACK,
+                                                    1.0f,  // elevation
+                                                    layer_path, Clip::none);
+
+  // Preroll the layer past the cache access threshold; the shadow becomes
+  // eligible, rasterizes once and then draws as a sprite.
+  int threshold = preroll_context()->raster_cache->access_threshold();
+  for (int i = 0; i <= threshold; i++) {
+    preroll_context()->raster_cached_entries->clear();
+    layer->Preroll(preroll_context());
+    ASSERT_EQ(preroll_context()->raster_cached_entries->size(), size_t(1));
+  }
+
+  auto* cache_item = layer->shadow_cache_item();
+  ASSERT_NE(cache_item, nullptr);
+  ASSERT_EQ(cache_item->cache_state(), RasterCacheItem::kCurrent);
+  ASSERT_TRUE(cache_item->TryToPrepareRasterCache(paint_context()));
+  ASSERT_TRUE(cache_item->Draw(paint_context(), nullptr));
+}
+
 TEST_F(PhysicalShapeLayerTest, Readback) {
   PrerollContext* context = preroll_context();
   SkPath path;
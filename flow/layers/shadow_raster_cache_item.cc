@@ -0,0 +1,131 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layers/shadow_raster_cache_item.h"
+
+#include "flutter/display_list/display_list_canvas_dispatcher.h"
+#include "flutter/flow/layers/layer.h"
+#include "flutter/flow/raster_cache.h"
+#include "flutter/flow/raster_cache_key.h"
+#include "flutter/flow/raster_cache_util.h"
+#include "flutter/fml/hash_combine.h"
+
+namespace flutter {
+
+static uint64_t MakeShadowUniqueId(const SkPath& path,
+                                   SkColor shadow_color,
+                                   float elevation,
+                                   bool transparent_occluder,
+                                   float device_pixel_ratio) {
+  // The path generation id changes whenever the path's geometry does, so
+  // two frames that elevate the same (unmodified) path share an id.
+  return fml::HashCombine(path.getGenerationID(), shadow_color, elevation,
+                          transparent_occluder, device_pixel_ratio);
+}
+
+ShadowRasterCacheItem::ShadowRasterCacheItem(const SkPath& path,
+                                             SkColor shadow_color,
+                                             float elevation,
+                                             bool transparent_occluder,
+                                             float device_pixel_ratio)
+    : RasterCacheItem(
+          RasterCacheKeyID(MakeShadowUniqueId(path,
+                                              shadow_color,
+                                              elevation,
+                                              transparent_occluder,
+                                              device_pixel_ratio),
+                           RasterCacheKeyType::kShadow),
+          CacheState::kCurrent),
+      path_(path),
+      shadow_color_(shadow_color),
+      elevation_(elevation),
+      transparent_occluder_(transparent_occluder),
+      device_pixel_ratio_(device_pixel_ratio) {}
+
+void ShadowRasterCacheItem::PrerollSetup(PrerollContext* context,
+                                         const SkMatrix& matrix) {
+  cache_state_ = CacheState::kNone;
+
+  transformation_matrix_ = matrix;
+  if (!transformation_matrix_.invert(nullptr)) {
+    // The matrix was singular. No point in going further.
+    return;
+  }
+
+  bounds_ = DisplayListCanvasDispatcher::ComputeShadowBounds(
+      path_, elevation_, device_pixel_ratio_, matrix);
+  if (!RasterCacheUtil::CanRasterizeRect(bounds_)) {
+    return;
+  }
+
+  if (context->raster_cached_entries && context->raster_cache) {
+    context->raster_cached_entries->push_back(this);
+    cache_state_ = CacheState::kCurrent;
+  }
+}
+
+void ShadowRasterCacheItem::PrerollFinalize(PrerollContext* context,
+                                            const SkMatrix& matrix) {
+  if (cache_state_ == CacheState::kNone || !context->raster_cache ||
+      !context->raster_cached_entries) {
+    return;
+  }
+  auto* raster_cache = context->raster_cache;
+  bool visible = !context->state_stack.content_culled(bounds_);
+  cache_key_.emplace(key_id_, transformation_matrix_);
+  int accesses = raster_cache->MarkSeen(cache_key_.value(), visible);
+  if (!visible || accesses <= raster_cache->access_threshold()) {
+    cache_state_ = CacheState::kNone;
+  } else {
+    // The shadow is only one part of the owning layer's output, so no
+    // renderable state flags are propagated here.
+    cache_state_ = CacheState::kCurrent;
+  }
+}
+
+bool ShadowRasterCacheItem::Draw(const PaintContext& context,
+                                 const SkPaint* paint) const {
+  return Draw(context, context.canvas, paint);
+}
+
+bool ShadowRasterCacheItem::Draw(const PaintContext& context,
+                                 SkCanvas* canvas,
+                                 const SkPaint* paint) const {
+  if (!context.raster_cache || !canvas) {
+    return false;
+  }
+  if (cache_state_ == CacheState::kCurrent) {
+    return context.raster_cache->Draw(key_id_, *canvas, paint);
+  }
+  return false;
+}
+
+static const auto* flow_type = "RasterCacheFlow::Shadow";
+
+bool ShadowRasterCacheItem::TryToPrepareRasterCache(const PaintContext& context,
+                                                    bool parent_cached) const {
+  if (cache_state_ == CacheState::kNone || !context.raster_cache ||
+      parent_cached || !context.raster_cache->GenerateNewCacheInThisFrame()) {
+    return false;
+  }
+  RasterCache::Context r_context = {
+      // clang-format off
+      .gr_context         = context.gr_context,
+      .dst_color_space    = context.dst_color_space,
+      .matrix             = transformation_matrix_,
+      .logical_rect       = bounds_,
+      .flow_type          = flow_type,
+      // clang-format on
+  };
+  return context.raster_cache->UpdateCacheEntry(
+      cache_key_.value(), r_context,
+      [path = path_, color = shadow_color_, elevation = elevation_,
+       transparent_occluder = transparent_occluder_,
+       dpr = device_pixel_ratio_](SkCanvas* canvas) {
+        DisplayListCanvasDispatcher::DrawShadow(
+            canvas, path, color, elevation, transparent_occluder, dpr);
+      });
+}
+
+}  // namespace flutter
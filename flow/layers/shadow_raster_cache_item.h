@@ -0,0 +1,60 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_LAYERS_SHADOW_RASTER_CACHE_ITEM_H_
+#define FLUTTER_FLOW_LAYERS_SHADOW_RASTER_CACHE_ITEM_H_
+
+#include "flutter/flow/raster_cache_item.h"
+#include "include/core/SkColor.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkRect.h"
+
+namespace flutter {
+
+// Caches the rendered drop shadow of an elevated shape. Shadow
+// tessellation and analytic evaluation are expensive enough that static
+// elevated shapes pay a measurable per-frame raster cost; once cached the
+// shadow draws as a single textured sprite. The cache key covers the path
+// generation, the shadow parameters (color, elevation, occluder
+// translucency, device pixel ratio) and, through the entry matrix, the
+// scale the shadow was rendered at.
+class ShadowRasterCacheItem : public RasterCacheItem {
+ public:
+  ShadowRasterCacheItem(const SkPath& path,
+                        SkColor shadow_color,
+                        float elevation,
+                        bool transparent_occluder,
+                        float device_pixel_ratio);
+
+  void PrerollSetup(PrerollContext* context, const SkMatrix& matrix) override;
+
+  void PrerollFinalize(PrerollContext* context,
+                       const SkMatrix& matrix) override;
+
+  bool Draw(const PaintContext& context, const SkPaint* paint) const override;
+
+  bool Draw(const PaintContext& context,
+            SkCanvas* canvas,
+            const SkPaint* paint) const override;
+
+  bool TryToPrepareRasterCache(const PaintContext& context,
+                               bool parent_cached = false) const override;
+
+  float device_pixel_ratio() const { return device_pixel_ratio_; }
+
+ private:
+  SkPath path_;
+  SkColor shadow_color_;
+  float elevation_;
+  bool transparent_occluder_;
+  float device_pixel_ratio_;
+  SkMatrix transformation_matrix_;
+  // The shadow bounds under |transformation_matrix_|, computed in
+  // |PrerollSetup|.
+  SkRect bounds_ = SkRect::MakeEmpty();
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_LAYERS_SHADOW_RASTER_CACHE_ITEM_H_
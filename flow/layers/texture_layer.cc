@@ -21,13 +21,33 @@ TextureLayer::TextureLayer(const SkPoint& offset,
 
 void TextureLayer::Diff(DiffContext* context, const Layer* old_layer) {
   DiffContext::AutoSubtreeRestore subtree(context);
+
+  // Look up the generation of the latest frame published for this texture;
+  // zero (no registry, unregistered texture or no frame yet) means the
+  // texture content must be assumed dirty.
+  uint64_t current_generation = 0;
+  if (TextureRegistry* registry = context->texture_registry()) {
+    if (std::shared_ptr<Texture> texture = registry->GetTexture(texture_id_)) {
+      current_generation = texture->frame_generation();
+    }
+  }
+
   if (!context->IsSubtreeDirty()) {
     FML_DCHECK(old_layer);
     auto prev = old_layer->as_texture_layer();
-    // TODO(knopp) It would be nice to be able to determine that a texture is
-    // dirty
-    context->MarkSubtreeDirty(context->GetOldLayerPaintRegion(prev));
+    // Only repaint the texture when the producer has published a new frame
+    // since the previous diff. A retained subtree may diff this very
+    // instance against itself, so compare against the previous generation
+    // before updating the member below.
+    if (current_generation == 0 ||
+        current_generation != prev->frame_generation_ ||
+        texture_id_ != prev->texture_id_ || offset_ != prev->offset_ ||
+        size_ != prev->size_ || freeze_ != prev->freeze_ ||
+        sampling_ != prev->sampling_) {
+      context->MarkSubtreeDirty(context->GetOldLayerPaintRegion(prev));
+    }
   }
+  frame_generation_ = current_generation;
 
   // Make sure DiffContext knows there is a TextureLayer in this subtree.
   // This prevents ContainerLayer from skipping TextureLayer diffing when
@@ -37,6 +37,11 @@ class TextureLayer : public Layer {
   bool freeze_;
   DlImageSampling sampling_;
 
+  // Generation of the texture frame this layer was last diffed against.
+  // Zero means the generation is unknown and the layer must be treated as
+  // dirty. See Texture::frame_generation.
+  uint64_t frame_generation_ = 0;
+
   FML_DISALLOW_COPY_AND_ASSIGN(TextureLayer);
 };
 
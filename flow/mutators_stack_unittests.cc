@@ -36,11 +36,27 @@ TEST(MutatorsStack, CopyAndUpdateTheCopy) {
   ASSERT_TRUE(copy.is_empty());
   ASSERT_TRUE(!stack.is_empty());
   auto iter = stack.Bottom();
-  ASSERT_TRUE(iter->get()->GetType() == MutatorType::kClipRRect);
-  ASSERT_TRUE(iter->get()->GetRRect() == rrect);
+  ASSERT_TRUE(iter->GetType() == MutatorType::kClipRRect);
+  ASSERT_TRUE(iter->GetRRect() == rrect);
   ++iter;
-  ASSERT_TRUE(iter->get()->GetType() == MutatorType::kClipRect);
-  ASSERT_TRUE(iter->get()->GetRect() == rect);
+  ASSERT_TRUE(iter->GetType() == MutatorType::kClipRect);
+  ASSERT_TRUE(iter->GetRect() == rect);
+}
+
+TEST(MutatorsStack, CopyAndUpdateTheOriginal) {
+  MutatorsStack stack;
+  auto rect = SkRect::MakeEmpty();
+  stack.PushClipRect(rect);
+  MutatorsStack copy = MutatorsStack(stack);
+  auto rrect = SkRRect::MakeEmpty();
+  stack.PushClipRRect(rrect);
+  // The copy shares storage with the stack until one of them is mutated, so
+  // it must not observe the push above.
+  ASSERT_TRUE(copy != stack);
+  ASSERT_EQ(copy.stack_count(), static_cast<size_t>(1));
+  auto iter = copy.Bottom();
+  ASSERT_TRUE(iter->GetType() == MutatorType::kClipRect);
+  ASSERT_TRUE(iter->GetRect() == rect);
 }
 
 TEST(MutatorsStack, PushClipRect) {
@@ -48,8 +64,8 @@ TEST(MutatorsStack, PushClipRect) {
   auto rect = SkRect::MakeEmpty();
   stack.PushClipRect(rect);
   auto iter = stack.Bottom();
-  ASSERT_TRUE(iter->get()->GetType() == MutatorType::kClipRect);
-  ASSERT_TRUE(iter->get()->GetRect() == rect);
+  ASSERT_TRUE(iter->GetType() == MutatorType::kClipRect);
+  ASSERT_TRUE(iter->GetRect() == rect);
 }
 
 TEST(MutatorsStack, PushClipRRect) {
@@ -57,8 +73,8 @@ TEST(MutatorsStack, PushClipRRect) {
   auto rrect = SkRRect::MakeEmpty();
   stack.PushClipRRect(rrect);
   auto iter = stack.Bottom();
-  ASSERT_TRUE(iter->get()->GetType() == MutatorType::kClipRRect);
-  ASSERT_TRUE(iter->get()->GetRRect() == rrect);
+  ASSERT_TRUE(iter->GetType() == MutatorType::kClipRRect);
+  ASSERT_TRUE(iter->GetRRect() == rrect);
 }
 
 TEST(MutatorsStack, PushClipPath) {
@@ -66,8 +82,8 @@ TEST(MutatorsStack, PushClipPath) {
   SkPath path;
   stack.PushClipPath(path);
   auto iter = stack.Bottom();
-  ASSERT_TRUE(iter->get()->GetType() == flutter::MutatorType::kClipPath);
-  ASSERT_TRUE(iter->get()->GetPath() == path);
+  ASSERT_TRUE(iter->GetType() == flutter::MutatorType::kClipPath);
+  ASSERT_TRUE(iter->GetPath() == path);
 }
 
 TEST(MutatorsStack, PushTransform) {
@@ -76,8 +92,8 @@ TEST(MutatorsStack, PushTransform) {
   matrix.setIdentity();
   stack.PushTransform(matrix);
   auto iter = stack.Bottom();
-  ASSERT_TRUE(iter->get()->GetType() == MutatorType::kTransform);
-  ASSERT_TRUE(iter->get()->GetMatrix() == matrix);
+  ASSERT_TRUE(iter->GetType() == MutatorType::kTransform);
+  ASSERT_TRUE(iter->GetMatrix() == matrix);
 }
 
 TEST(MutatorsStack, PushOpacity) {
@@ -85,8 +101,8 @@ TEST(MutatorsStack, PushOpacity) {
   int alpha = 240;
   stack.PushOpacity(alpha);
   auto iter = stack.Bottom();
-  ASSERT_TRUE(iter->get()->GetType() == MutatorType::kOpacity);
-  ASSERT_TRUE(iter->get()->GetAlpha() == 240);
+  ASSERT_TRUE(iter->GetType() == MutatorType::kOpacity);
+  ASSERT_TRUE(iter->GetAlpha() == 240);
 }
 
 TEST(MutatorsStack, PushBackdropFilter) {
@@ -100,8 +116,8 @@ TEST(MutatorsStack, PushBackdropFilter) {
   auto iter = stack.Begin();
   int i = 0;
   while (iter != stack.End()) {
-    ASSERT_EQ(iter->get()->GetType(), MutatorType::kBackdropFilter);
-    ASSERT_EQ(iter->get()->GetFilter().asBlur()->sigma_x(), i);
+    ASSERT_EQ(iter->GetType(), MutatorType::kBackdropFilter);
+    ASSERT_EQ(iter->GetFilter().asBlur()->sigma_x(), i);
     ++iter;
     ++i;
   }
@@ -132,16 +148,16 @@ TEST(MutatorsStack, Traversal) {
   while (iter != stack.Top()) {
     switch (index) {
       case 0:
-        ASSERT_TRUE(iter->get()->GetType() == MutatorType::kClipRRect);
-        ASSERT_TRUE(iter->get()->GetRRect() == rrect);
+        ASSERT_TRUE(iter->GetType() == MutatorType::kClipRRect);
+        ASSERT_TRUE(iter->GetRRect() == rrect);
         break;
       case 1:
-        ASSERT_TRUE(iter->get()->GetType() == MutatorType::kClipRect);
-        ASSERT_TRUE(iter->get()->GetRect() == rect);
+        ASSERT_TRUE(iter->GetType() == MutatorType::kClipRect);
+        ASSERT_TRUE(iter->GetRect() == rect);
         break;
       case 2:
-        ASSERT_TRUE(iter->get()->GetType() == MutatorType::kTransform);
-        ASSERT_TRUE(iter->get()->GetMatrix() == matrix);
+        ASSERT_TRUE(iter->GetType() == MutatorType::kTransform);
+        ASSERT_TRUE(iter->GetMatrix() == matrix);
         break;
       default:
         break;
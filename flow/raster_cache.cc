@@ -4,6 +4,7 @@
 
 #include "flutter/flow/raster_cache.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
@@ -13,6 +14,7 @@
 #include "flutter/flow/paint_utils.h"
 #include "flutter/flow/raster_cache_util.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkColorSpace.h"
@@ -48,12 +50,16 @@ RasterCache::RasterCache(size_t access_threshold,
       display_list_cache_limit_per_frame_(display_list_cache_limit_per_frame),
       checkerboard_images_(false) {}
 
-/// @note Procedure doesn't copy all closures.
-std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
+namespace {
+
+// Shared by the synchronous |RasterCache::Rasterize| path and the background
+// rasterization worker, which must not reference the cache itself since a
+// worker task may outlive it.
+std::unique_ptr<RasterCacheResult> RasterizeToSurface(
     const RasterCache::Context& context,
     const std::function<void(SkCanvas*)>& draw_function,
-    const std::function<void(SkCanvas*, const SkRect& rect)>& draw_checkerboard)
-    const {
+    const std::function<void(SkCanvas*, const SkRect& rect)>& draw_checkerboard,
+    bool checkerboard_images) {
   auto matrix = RasterCacheUtil::GetIntegralTransCTM(context.matrix);
   SkRect dest_rect =
       RasterCacheUtil::GetRoundedOutDeviceBounds(context.logical_rect, matrix);
@@ -77,7 +83,7 @@ std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
   canvas->concat(matrix);
   draw_function(canvas);
 
-  if (checkerboard_images_) {
+  if (checkerboard_images) {
     draw_checkerboard(canvas, context.logical_rect);
   }
 
@@ -85,16 +91,94 @@ std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
       surface->makeImageSnapshot(), context.logical_rect, context.flow_type);
 }
 
+}  // namespace
+
+/// @note Procedure doesn't copy all closures.
+std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
+    const RasterCache::Context& context,
+    const std::function<void(SkCanvas*)>& draw_function,
+    const std::function<void(SkCanvas*, const SkRect& rect)>& draw_checkerboard)
+    const {
+  return RasterizeToSurface(context, draw_function, draw_checkerboard,
+                            checkerboard_images_);
+}
+
 bool RasterCache::UpdateCacheEntry(
     const RasterCacheKeyID& id,
     const Context& raster_cache_context,
     const std::function<void(SkCanvas*)>& render_function) const {
-  RasterCacheKey key = RasterCacheKey(id, raster_cache_context.matrix);
+  return UpdateCacheEntry(RasterCacheKey(id, raster_cache_context.matrix),
+                          raster_cache_context, render_function);
+}
+
+bool RasterCache::UpdateCacheEntry(
+    const RasterCacheKey& key,
+    const Context& raster_cache_context,
+    const std::function<void(SkCanvas*)>& render_function) const {
+  const RasterCacheKeyID& id = key.id();
   Entry& entry = cache_[key];
+  if (entry.pending) {
+    // Keep the shared state alive so resetting |entry.pending| below cannot
+    // destroy the mutex while it is held.
+    std::shared_ptr<PendingRasterization> pending = entry.pending;
+    std::scoped_lock lock(pending->mutex);
+    if (!pending->done) {
+      return false;
+    }
+    entry.image = std::move(pending->result);
+    entry.construction_time = pending->construction_time;
+    entry.pending.reset();
+    if (entry.image != nullptr) {
+      entry.last_drawn_frame = frame_number_;
+      return true;
+    }
+    // The background rasterization failed; fall through and retry inline.
+  }
   if (!entry.image) {
+    if (background_worker_ != nullptr &&
+        id.type() == RasterCacheKeyType::kDisplayList) {
+      // Display list draw operations are immutable, so |render_function| (a
+      // closure over a reference counted DisplayList) can be replayed on the
+      // worker. The context however references frame-lifetime storage and
+      // must be copied; the GrDirectContext is dropped because it cannot be
+      // used off the raster thread, forcing a software rasterization.
+      entry.pending = std::make_shared<PendingRasterization>();
+      display_list_cached_this_frame_++;
+      background_worker_->PostTask(
+          [pending = entry.pending,                                        //
+           render_function,                                                //
+           matrix = raster_cache_context.matrix,                           //
+           logical_rect = raster_cache_context.logical_rect,               //
+           color_space = sk_ref_sp(raster_cache_context.dst_color_space),  //
+           flow_type = raster_cache_context.flow_type,                     //
+           checkerboard = checkerboard_images_]() {
+            RasterCache::Context worker_context = {
+                // clang-format off
+                .gr_context      = nullptr,
+                .dst_color_space = color_space.get(),
+                .matrix          = matrix,
+                .logical_rect    = logical_rect,
+                .flow_type       = flow_type,
+                // clang-format on
+            };
+            const fml::TimePoint start = fml::TimePoint::Now();
+            auto result = RasterizeToSurface(worker_context, render_function,
+                                             DrawCheckerboard, checkerboard);
+            const fml::TimeDelta elapsed = fml::TimePoint::Now() - start;
+            std::scoped_lock lock(pending->mutex);
+            pending->result = std::move(result);
+            pending->construction_time = elapsed;
+            pending->done = true;
+          });
+      // The caller paints the item directly until the image is adopted.
+      return false;
+    }
     void (*func)(SkCanvas*, const SkRect& rect) = DrawCheckerboard;
+    const fml::TimePoint start = fml::TimePoint::Now();
     entry.image = Rasterize(raster_cache_context, render_function, func);
     if (entry.image != nullptr) {
+      entry.construction_time = fml::TimePoint::Now() - start;
+      entry.last_drawn_frame = frame_number_;
       switch (id.type()) {
         case RasterCacheKeyType::kDisplayList: {
           display_list_cached_this_frame_++;
@@ -112,7 +196,11 @@ bool RasterCache::UpdateCacheEntry(
 int RasterCache::MarkSeen(const RasterCacheKeyID& id,
                           const SkMatrix& matrix,
                           bool visible) const {
-  RasterCacheKey key = RasterCacheKey(id, matrix);
+  return MarkSeen(RasterCacheKey(id, matrix), visible);
+}
+
+int RasterCache::MarkSeen(const RasterCacheKey& key, bool visible) const {
+  std::scoped_lock lock(preroll_mutex_);
   Entry& entry = cache_[key];
   entry.encountered_this_frame = true;
   entry.visible_this_frame = visible;
@@ -125,6 +213,7 @@ int RasterCache::MarkSeen(const RasterCacheKeyID& id,
 int RasterCache::GetAccessCount(const RasterCacheKeyID& id,
                                 const SkMatrix& matrix) const {
   RasterCacheKey key = RasterCacheKey(id, matrix);
+  std::scoped_lock lock(preroll_mutex_);
   auto entry = cache_.find(key);
   if (entry != cache_.cend()) {
     return entry->second.accesses_since_visible;
@@ -135,6 +224,7 @@ int RasterCache::GetAccessCount(const RasterCacheKeyID& id,
 bool RasterCache::HasEntry(const RasterCacheKeyID& id,
                            const SkMatrix& matrix) const {
   RasterCacheKey key = RasterCacheKey(id, matrix);
+  std::scoped_lock lock(preroll_mutex_);
   if (cache_.find(key) != cache_.cend()) {
     return true;
   }
@@ -146,21 +236,31 @@ bool RasterCache::Draw(const RasterCacheKeyID& id,
                        const SkPaint* paint) const {
   auto it = cache_.find(RasterCacheKey(id, canvas.getTotalMatrix()));
   if (it == cache_.end()) {
+    draw_misses_this_frame_++;
     return false;
   }
 
   Entry& entry = it->second;
 
   if (entry.image) {
+    entry.last_drawn_frame = frame_number_;
     entry.image->draw(canvas, paint);
+    draw_hits_this_frame_++;
+    construction_time_saved_this_frame_ =
+        construction_time_saved_this_frame_ + entry.construction_time;
     return true;
   }
 
+  draw_misses_this_frame_++;
   return false;
 }
 
 void RasterCache::BeginFrame() {
+  frame_number_++;
   display_list_cached_this_frame_ = 0;
+  draw_hits_this_frame_ = 0;
+  draw_misses_this_frame_ = 0;
+  construction_time_saved_this_frame_ = fml::TimeDelta::Zero();
   picture_metrics_ = {};
   layer_metrics_ = {};
 }
@@ -198,8 +298,48 @@ void RasterCache::EvictUnusedCacheEntries() {
   }
 }
 
+void RasterCache::EnforceCacheByteBudget() {
+  if (byte_budget_ == 0) {
+    return;
+  }
+
+  size_t total_bytes = 0;
+  std::vector<RasterCacheKey::Map<Entry>::iterator> populated;
+  for (auto it = cache_.begin(); it != cache_.end(); ++it) {
+    if (it->second.image) {
+      total_bytes += it->second.image->image_bytes();
+      populated.push_back(it);
+    }
+  }
+
+  if (total_bytes <= byte_budget_) {
+    return;
+  }
+
+  // Evict in least-recently-drawn order across both the layer and display
+  // list caches until the cache fits within the budget. Evicted items are
+  // re-rasterized on demand if they become eligible again.
+  std::sort(populated.begin(), populated.end(),
+            [](const auto& a, const auto& b) {
+              return a->second.last_drawn_frame < b->second.last_drawn_frame;
+            });
+
+  for (auto it : populated) {
+    if (total_bytes <= byte_budget_) {
+      break;
+    }
+    size_t image_bytes = it->second.image->image_bytes();
+    RasterCacheMetrics& metrics = GetMetricsForKind(it->first.kind());
+    metrics.eviction_count++;
+    metrics.eviction_bytes += image_bytes;
+    total_bytes -= image_bytes;
+    cache_.erase(it);
+  }
+}
+
 void RasterCache::EndFrame() {
   UpdateMetrics();
+  EnforceCacheByteBudget();
   TraceStatsToTimeline();
 }
 
@@ -209,6 +349,62 @@ void RasterCache::Clear() {
   layer_metrics_ = {};
 }
 
+std::vector<RasterCache::TransferableEntry>
+RasterCache::ExportTransferableEntries() const {
+  std::vector<TransferableEntry> entries;
+  for (const auto& item : cache_) {
+    const Entry& entry = item.second;
+    if (!entry.image) {
+      continue;
+    }
+    const sk_sp<SkImage>& image = entry.image->image();
+    if (!image || image->isTextureBacked()) {
+      // Texture backed images are bound to the GrDirectContext that created
+      // them and cannot be drawn by another context.
+      continue;
+    }
+    entries.push_back(
+        {item.first, image, entry.image->logical_rect()});
+  }
+  return entries;
+}
+
+void RasterCache::SeedCacheEntries(
+    const std::vector<TransferableEntry>& entries) {
+  for (const auto& transferable : entries) {
+    if (!transferable.image || transferable.image->isTextureBacked()) {
+      continue;
+    }
+    Entry& entry = cache_[transferable.key];
+    if (entry.image) {
+      continue;
+    }
+    // Marked as encountered so the seed survives until the first frame's
+    // unused-entry sweep decides whether its key is actually referenced.
+    entry.encountered_this_frame = true;
+    entry.accesses_since_visible = access_threshold_;
+    entry.image = std::make_unique<RasterCacheResult>(
+        transferable.image, transferable.logical_rect, "RasterCacheSeed");
+  }
+}
+
+RasterCache::Statistics RasterCache::GetStatistics() const {
+  Statistics stats;
+  stats.layer_entry_count = GetLayerCachedEntriesCount();
+  stats.picture_entry_count = GetPictureCachedEntriesCount();
+  stats.layer_bytes = EstimateLayerCacheByteSize();
+  stats.picture_bytes = EstimatePictureCacheByteSize();
+  stats.frame_hit_count = draw_hits_this_frame_;
+  stats.frame_miss_count = draw_misses_this_frame_;
+  stats.frame_eviction_count =
+      layer_metrics_.eviction_count + picture_metrics_.eviction_count;
+  stats.frame_eviction_bytes =
+      layer_metrics_.eviction_bytes + picture_metrics_.eviction_bytes;
+  stats.frame_construction_time_saved = construction_time_saved_this_frame_;
+  stats.cache_byte_budget = byte_budget_;
+  return stats;
+}
+
 size_t RasterCache::GetCachedEntriesCount() const {
   return cache_.size();
 }
@@ -255,6 +451,12 @@ void RasterCache::TraceStatsToTimeline() const {
       "PictureCount", picture_metrics_.total_count(),                      //
       "PictureMBytes", picture_metrics_.total_bytes() / kMegaByteSizeInBytes);
 
+  FML_TRACE_COUNTER(
+      "flutter",                                                        //
+      "RasterCacheTraffic", reinterpret_cast<int64_t>(this),            //
+      "HitCount", draw_hits_this_frame_,                                //
+      "MissCount", draw_misses_this_frame_,                             //
+      "TimeSavedUs", construction_time_saved_this_frame_.ToMicroseconds());
 #endif  // !FLUTTER_RELEASE
 }
 
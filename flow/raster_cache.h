@@ -6,6 +6,7 @@
 #define FLUTTER_FLOW_RASTER_CACHE_H_
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "flutter/display_list/display_list.h"
@@ -14,6 +15,8 @@
 #include "flutter/flow/raster_cache_util.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/weak_ptr.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/trace_event.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkMatrix.h"
@@ -45,6 +48,10 @@ class RasterCacheResult {
     return image_ ? image_->imageInfo().computeMinByteSize() : 0;
   };
 
+  virtual const sk_sp<SkImage>& image() const { return image_; }
+
+  const SkRect& logical_rect() const { return logical_rect_; }
+
  private:
   sk_sp<SkImage> image_;
   SkRect logical_rect_;
@@ -154,6 +161,43 @@ class RasterCache {
 
   void Clear();
 
+  /**
+   * @brief Set the maximum number of image bytes, across both the layer and
+   * display list caches, retained after a frame ends.
+   *
+   * When the populated entries exceed the budget, `EndFrame` evicts them in
+   * least-recently-drawn order until the cache fits. The evictions are
+   * reported through the per-kind metrics and the current usage remains
+   * queryable via `EstimateLayerCacheByteSize` and
+   * `EstimatePictureCacheByteSize`. A budget of zero (the default) disables
+   * byte based eviction; the unused-entry sweep is unaffected either way.
+   */
+  void SetCacheByteBudget(size_t budget_bytes) { byte_budget_ = budget_bytes; }
+
+  size_t cache_byte_budget() const { return byte_budget_; }
+
+  /**
+   * @brief Set the task runner on which cache entries for display lists are
+   * populated in the background.
+   *
+   * When a worker is installed, a display list that becomes eligible for
+   * caching is rasterized to a software surface on the worker instead of
+   * inline on the raster thread, and the display list keeps drawing directly
+   * until the finished image is adopted on a later frame. This trades one or
+   * more frames of cache latency for the elimination of the rasterization
+   * spike on the frame that first caches a complex item.
+   *
+   * Only display list entries are populated asynchronously: their draw
+   * operations are immutable and reference counted, so they can be safely
+   * replayed off-thread, whereas layer entries reference the frame-lifetime
+   * layer tree. The worker always rasterizes in software since a
+   * GrDirectContext cannot be shared with the raster thread. Passing nullptr
+   * (the default) restores fully synchronous population.
+   */
+  void SetBackgroundRasterizationTaskRunner(fml::BasicTaskRunner* worker) {
+    background_worker_ = worker;
+  }
+
   void SetCheckboardCacheImages(bool checkerboard);
 
   const RasterCacheMetrics& picture_metrics() const { return picture_metrics_; }
@@ -225,6 +269,12 @@ class RasterCache {
                const SkMatrix& matrix,
                bool visible) const;
 
+  /**
+   * Variant of |MarkSeen| for callers that built the entry's key (and its
+   * precomputed hash) once during preroll.
+   */
+  int MarkSeen(const RasterCacheKey& key, bool visible) const;
+
   /**
    * Returns the access count (i.e. accesses_since_visible) for the given
    * entry in the cache, or -1 if no such entry exists.
@@ -236,24 +286,130 @@ class RasterCache {
       const Context& raster_cache_context,
       const std::function<void(SkCanvas*)>& render_function) const;
 
+  /**
+   * Variant of |UpdateCacheEntry| for callers that built the entry's key
+   * once during preroll. The key must have been constructed with the same
+   * matrix as |raster_cache_context.matrix|.
+   */
+  bool UpdateCacheEntry(
+      const RasterCacheKey& key,
+      const Context& raster_cache_context,
+      const std::function<void(SkCanvas*)>& render_function) const;
+
+  /**
+   * A populated cache entry exported for seeding another RasterCache, e.g.
+   * when a new shell is spawned from a warmed-up parent. Only CPU backed
+   * images are transferable: texture backed images are bound to the
+   * GrDirectContext that created them.
+   */
+  struct TransferableEntry {
+    RasterCacheKey key;
+    sk_sp<SkImage> image;
+    SkRect logical_rect;
+  };
+
+  /**
+   * @brief Export the populated entries whose images are CPU backed.
+   *
+   * The exported entries share their (immutable, reference counted) images
+   * with this cache, so exporting is cheap and does not disturb the source
+   * cache.
+   */
+  std::vector<TransferableEntry> ExportTransferableEntries() const;
+
+  /**
+   * @brief Install exported entries into this cache.
+   *
+   * Seeded entries are marked as encountered so they survive until the first
+   * frame's unused-entry sweep; entries whose keys the first frame does not
+   * reference are evicted then. Because cache keys are derived from layer and
+   * display list instance identities, seeds only produce hits when the same
+   * instances are replayed by this cache's frames. Existing populated entries
+   * are never overwritten.
+   */
+  void SeedCacheEntries(const std::vector<TransferableEntry>& entries);
+
+  /**
+   * A point-in-time summary of the cache contents and of the current frame's
+   * cache traffic, suitable for export through the service protocol or as
+   * trace counters.
+   *
+   * The frame-scoped fields are reset in `BeginFrame`, so a snapshot taken
+   * between frames (e.g. by a service protocol task on the raster task
+   * runner) describes the most recently completed frame.
+   */
+  struct Statistics {
+    size_t layer_entry_count = 0;
+    size_t picture_entry_count = 0;
+    size_t layer_bytes = 0;
+    size_t picture_bytes = 0;
+    size_t frame_hit_count = 0;
+    size_t frame_miss_count = 0;
+    size_t frame_eviction_count = 0;
+    size_t frame_eviction_bytes = 0;
+    /**
+     * Estimated rasterization work avoided this frame: the sum of the
+     * original construction times of every entry drawn from the cache.
+     * Seeded entries report a construction time of zero.
+     */
+    fml::TimeDelta frame_construction_time_saved;
+    size_t cache_byte_budget = 0;
+  };
+
+  Statistics GetStatistics() const;
+
  private:
+  // Shared between the raster thread and the background rasterization worker.
+  // The worker fills in |result| under |mutex| and the raster thread adopts
+  // it into the owning entry on a later |UpdateCacheEntry|. Held by
+  // shared_ptr so a completing worker task remains valid even if the entry
+  // was evicted in the meantime.
+  struct PendingRasterization {
+    std::mutex mutex;
+    std::unique_ptr<RasterCacheResult> result;
+    fml::TimeDelta construction_time;
+    bool done = false;
+  };
+
   struct Entry {
     bool encountered_this_frame = false;
     bool visible_this_frame = false;
     size_t accesses_since_visible = 0;
+    // The frame on which the entry's image was last drawn (or populated).
+    // Used to order evictions when the cache exceeds its byte budget.
+    size_t last_drawn_frame = 0;
+    // The time it took to rasterize the entry's image, credited to the
+    // frame's construction-time-saved statistic each time the image is
+    // drawn from the cache.
+    fml::TimeDelta construction_time;
     std::unique_ptr<RasterCacheResult> image;
+    std::shared_ptr<PendingRasterization> pending;
   };
 
   void UpdateMetrics();
 
+  void EnforceCacheByteBudget();
+
   RasterCacheMetrics& GetMetricsForKind(RasterCacheKeyKind kind);
 
   const size_t access_threshold_;
   const size_t display_list_cache_limit_per_frame_;
   mutable size_t display_list_cached_this_frame_ = 0;
+  // Per-frame traffic counters for |Draw|, reset in |BeginFrame|. Mutable
+  // for the same reason |cache_| is: |Draw| is logically const.
+  mutable size_t draw_hits_this_frame_ = 0;
+  mutable size_t draw_misses_this_frame_ = 0;
+  mutable fml::TimeDelta construction_time_saved_this_frame_;
+  size_t byte_budget_ = 0;
+  size_t frame_number_ = 0;
+  fml::BasicTaskRunner* background_worker_ = nullptr;
   RasterCacheMetrics layer_metrics_;
   RasterCacheMetrics picture_metrics_;
   mutable RasterCacheKey::Map<Entry> cache_;
+  // Guards |cache_| during the preroll phase, where MarkSeen and the entry
+  // queries may be invoked concurrently from the worker pool. All other
+  // methods run on the raster thread only.
+  mutable std::mutex preroll_mutex_;
   bool checkerboard_images_;
 
   void TraceStatsToTimeline() const;
@@ -70,6 +70,10 @@ class RasterCacheItem {
  protected:
   // The id for cache the layer self.
   RasterCacheKeyID key_id_;
+  // The entry key built once in |PrerollFinalize| so the paint-stage cache
+  // population reuses its precomputed hash instead of canonicalizing the
+  // matrix on every probe.
+  std::optional<RasterCacheKey> cache_key_;
   CacheState cache_state_ = CacheState::kNone;
   mutable SkMatrix matrix_;
   unsigned child_items_;
@@ -18,7 +18,7 @@ namespace flutter {
 
 class Layer;
 
-enum class RasterCacheKeyType { kLayer, kDisplayList, kLayerChildren };
+enum class RasterCacheKeyType { kLayer, kDisplayList, kLayerChildren, kShadow };
 
 class RasterCacheKeyID {
  public:
@@ -85,6 +85,14 @@ class RasterCacheKey {
       : id_(std::move(id)), matrix_(ctm) {
     matrix_[SkMatrix::kMTransX] = 0;
     matrix_[SkMatrix::kMTransY] = 0;
+    // The hash is computed once over the id and the canonicalized matrix so
+    // map probes neither rehash the matrix nor chain through entries that
+    // share an id but were cached under different transforms.
+    std::size_t seed = id_.GetHash();
+    for (int i = 0; i < 9; i++) {
+      fml::HashCombineSeed(seed, matrix_[i]);
+    }
+    hash_ = seed;
   }
 
   const RasterCacheKeyID& id() const { return id_; }
@@ -96,20 +104,22 @@ class RasterCacheKey {
         return RasterCacheKeyKind::kDisplayListMetrics;
       case RasterCacheKeyType::kLayer:
       case RasterCacheKeyType::kLayerChildren:
+      case RasterCacheKeyType::kShadow:
         return RasterCacheKeyKind::kLayerMetrics;
     }
   }
 
   struct Hash {
     std::size_t operator()(RasterCacheKey const& key) const {
-      return key.id_.GetHash();
+      return key.hash_;
     }
   };
 
   struct Equal {
     constexpr bool operator()(const RasterCacheKey& lhs,
                               const RasterCacheKey& rhs) const {
-      return lhs.id_ == rhs.id_ && lhs.matrix_ == rhs.matrix_;
+      return lhs.hash_ == rhs.hash_ && lhs.id_ == rhs.id_ &&
+             lhs.matrix_ == rhs.matrix_;
     }
   };
 
@@ -124,6 +134,9 @@ class RasterCacheKey {
   //   matrix_[SkMatrix::kMTransX] = SkScalarFraction(ctm.getTranslateX());
   //   matrix_[SkMatrix::kMTransY] = SkScalarFraction(ctm.getTranslateY());
   SkMatrix matrix_;
+
+  // Precomputed over |id_| and the canonicalized |matrix_| at construction.
+  std::size_t hash_;
 };
 
 }  // namespace flutter
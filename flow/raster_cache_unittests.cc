@@ -131,6 +131,256 @@ TEST(RasterCache, ThresholdIsRespectedForDisplayList) {
   ASSERT_TRUE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
 }
 
+TEST(RasterCache, CacheByteBudgetEvictsLeastRecentlyDrawn) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+  // Each sample display list rasterizes to 25600 bytes; the budget holds one
+  // cached image but not two.
+  cache.SetCacheByteBudget(30000u);
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto first_display_list = GetSampleDisplayList();
+  auto second_display_list = GetSampleDisplayList();
+
+  SkCanvas dummy_canvas;
+  SkPaint paint;
+
+  LayerStateStack state_stack;
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      state_stack, &cache, &raster_time, &ui_time);
+  PaintContextHolder paint_context_holder =
+      GetSamplePaintContextHolder(state_stack, &cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  DisplayListRasterCacheItem first_item(first_display_list.get(), SkPoint(),
+                                        true, false);
+  DisplayListRasterCacheItem second_item(second_display_list.get(), SkPoint(),
+                                         true, false);
+
+  // 1st access of the first item.
+  cache.BeginFrame();
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      first_item, preroll_context, paint_context, matrix));
+  ASSERT_FALSE(first_item.Draw(paint_context, &dummy_canvas, &paint));
+  cache.EndFrame();
+
+  // 2nd access caches and draws the first item. One image fits the budget.
+  cache.BeginFrame();
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      first_item, preroll_context, paint_context, matrix));
+  ASSERT_TRUE(first_item.Draw(paint_context, &dummy_canvas, &paint));
+  cache.EndFrame();
+  ASSERT_EQ(cache.picture_metrics().eviction_count, 0u);
+
+  // The first item draws from the cache while the second takes its first
+  // access.
+  cache.BeginFrame();
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      first_item, preroll_context, paint_context, matrix));
+  ASSERT_TRUE(first_item.Draw(paint_context, &dummy_canvas, &paint));
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      second_item, preroll_context, paint_context, matrix));
+  ASSERT_FALSE(second_item.Draw(paint_context, &dummy_canvas, &paint));
+  cache.EndFrame();
+  ASSERT_EQ(cache.picture_metrics().eviction_count, 0u);
+
+  // The second item gets cached and drawn while the first is merely seen.
+  // Both images no longer fit in the budget and the first item was drawn
+  // least recently.
+  cache.BeginFrame();
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      first_item, preroll_context, paint_context, matrix));
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      second_item, preroll_context, paint_context, matrix));
+  ASSERT_TRUE(second_item.Draw(paint_context, &dummy_canvas, &paint));
+  cache.EndFrame();
+  ASSERT_EQ(cache.picture_metrics().eviction_count, 1u);
+  ASSERT_EQ(cache.picture_metrics().eviction_bytes, 25600u);
+  ASSERT_LE(cache.EstimatePictureCacheByteSize(), 30000u);
+
+  // Only the second item's image survived the budget enforcement.
+  cache.BeginFrame();
+  ASSERT_FALSE(first_item.Draw(paint_context, &dummy_canvas, &paint));
+  ASSERT_TRUE(second_item.Draw(paint_context, &dummy_canvas, &paint));
+}
+
+TEST(RasterCache, StatisticsTrackFrameTraffic) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto display_list = GetSampleDisplayList();
+
+  SkCanvas dummy_canvas;
+  SkPaint paint;
+
+  LayerStateStack state_stack;
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      state_stack, &cache, &raster_time, &ui_time);
+  PaintContextHolder paint_context_holder =
+      GetSamplePaintContextHolder(state_stack, &cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  DisplayListRasterCacheItem display_list_item(display_list.get(), SkPoint(),
+                                               true, false);
+  RasterCacheKeyID id(display_list->unique_id(),
+                      RasterCacheKeyType::kDisplayList);
+
+  // The first access creates the entry but does not populate it; a draw
+  // attempt counts as a miss.
+  cache.BeginFrame();
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_FALSE(cache.Draw(id, dummy_canvas, &paint));
+  cache.EndFrame();
+
+  RasterCache::Statistics stats = cache.GetStatistics();
+  ASSERT_EQ(stats.frame_hit_count, 0u);
+  ASSERT_EQ(stats.frame_miss_count, 1u);
+  ASSERT_EQ(stats.picture_entry_count, 1u);
+  ASSERT_EQ(stats.picture_bytes, 0u);
+  ASSERT_EQ(stats.frame_construction_time_saved, fml::TimeDelta::Zero());
+
+  // The second access rasterizes the entry and serves it from the cache,
+  // crediting the entry's construction time to the frame.
+  cache.BeginFrame();
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_TRUE(cache.Draw(id, dummy_canvas, &paint));
+  cache.EndFrame();
+
+  stats = cache.GetStatistics();
+  ASSERT_EQ(stats.frame_hit_count, 1u);
+  ASSERT_EQ(stats.frame_miss_count, 0u);
+  ASSERT_EQ(stats.picture_entry_count, 1u);
+  ASSERT_EQ(stats.picture_bytes, cache.EstimatePictureCacheByteSize());
+  ASSERT_GT(stats.frame_construction_time_saved, fml::TimeDelta::Zero());
+
+  // The traffic counters reset at the start of the next frame.
+  cache.BeginFrame();
+  stats = cache.GetStatistics();
+  ASSERT_EQ(stats.frame_hit_count, 0u);
+  ASSERT_EQ(stats.frame_miss_count, 0u);
+  ASSERT_EQ(stats.frame_construction_time_saved, fml::TimeDelta::Zero());
+}
+
+TEST(RasterCache, TransferableEntriesSeedAnotherCache) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto display_list = GetSampleDisplayList();
+
+  SkCanvas dummy_canvas;
+  SkPaint paint;
+
+  LayerStateStack state_stack;
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      state_stack, &cache, &raster_time, &ui_time);
+  PaintContextHolder paint_context_holder =
+      GetSamplePaintContextHolder(state_stack, &cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  DisplayListRasterCacheItem display_list_item(display_list.get(), SkPoint(),
+                                               true, false);
+
+  // First access is seen only; the second access caches the item.
+  cache.BeginFrame();
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  cache.EndFrame();
+  cache.BeginFrame();
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  cache.EndFrame();
+
+  // The software-rasterized entry is transferable.
+  auto entries = cache.ExportTransferableEntries();
+  ASSERT_EQ(entries.size(), 1u);
+
+  // A fresh cache seeded with the exported entries serves the entry without
+  // ever having rasterized it, and the source cache is unaffected.
+  flutter::RasterCache spawned_cache(threshold);
+  spawned_cache.SeedCacheEntries(entries);
+
+  RasterCacheKeyID id(display_list->unique_id(),
+                      RasterCacheKeyType::kDisplayList);
+  ASSERT_TRUE(spawned_cache.HasEntry(id, matrix));
+  ASSERT_TRUE(spawned_cache.Draw(id, dummy_canvas, &paint));
+  ASSERT_EQ(cache.GetCachedEntriesCount(), 1u);
+}
+
+TEST(RasterCache, BackgroundWorkerPopulatesDisplayListEntry) {
+  // Runs posted tasks immediately so the background population is
+  // deterministically complete before the next frame.
+  class InlineTaskRunner : public fml::BasicTaskRunner {
+   public:
+    void PostTask(fml::Closure task) override { task(); }
+  };
+
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+  InlineTaskRunner worker;
+  cache.SetBackgroundRasterizationTaskRunner(&worker);
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto display_list = GetSampleDisplayList();
+
+  SkCanvas dummy_canvas;
+  SkPaint paint;
+
+  LayerStateStack state_stack;
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      state_stack, &cache, &raster_time, &ui_time);
+  PaintContextHolder paint_context_holder =
+      GetSamplePaintContextHolder(state_stack, &cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  DisplayListRasterCacheItem display_list_item(display_list.get(), SkPoint(),
+                                               true, false);
+
+  // 1st access.
+  cache.BeginFrame();
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_FALSE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
+  cache.EndFrame();
+
+  // The threshold is met, but the rasterization happens on the worker and
+  // the item keeps drawing directly while the image is in flight.
+  cache.BeginFrame();
+  ASSERT_FALSE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_FALSE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
+  cache.EndFrame();
+  ASSERT_EQ(cache.picture_metrics().total_count(), 0u);
+
+  // The finished image is adopted and the item draws from the cache.
+  cache.BeginFrame();
+  ASSERT_TRUE(RasterCacheItemPrerollAndTryToRasterCache(
+      display_list_item, preroll_context, paint_context, matrix));
+  ASSERT_TRUE(display_list_item.Draw(paint_context, &dummy_canvas, &paint));
+  cache.EndFrame();
+  ASSERT_EQ(cache.picture_metrics().total_count(), 1u);
+  ASSERT_EQ(cache.picture_metrics().total_bytes(), 25600u);
+}
+
 TEST(RasterCache, SetCheckboardCacheImages) {
   size_t threshold = 1;
   flutter::RasterCache cache(threshold);
@@ -623,19 +873,43 @@ TEST(RasterCache, RasterCacheKeyHashFunction) {
   RasterCacheKey layer_children_key(id, RasterCacheKeyType::kLayerChildren,
                                     matrix);
 
-  auto layer_cache_key_id = RasterCacheKeyID(id, RasterCacheKeyType::kLayer);
+  // The hash is precomputed over the id and the canonicalized matrix, so
+  // keys that share an id but differ in transform hash differently while
+  // keys that only differ in translation hash the same.
   auto layer_hash_code = hash_function(layer_key);
-  ASSERT_EQ(layer_hash_code, layer_cache_key_id.GetHash());
+  ASSERT_EQ(layer_hash_code,
+            hash_function(RasterCacheKey(id, RasterCacheKeyType::kLayer,
+                                         SkMatrix::Translate(100, 100))));
+  ASSERT_NE(layer_hash_code,
+            hash_function(RasterCacheKey(id, RasterCacheKeyType::kLayer,
+                                         SkMatrix::Scale(2, 2))));
 
-  auto display_list_cache_key_id =
-      RasterCacheKeyID(id, RasterCacheKeyType::kDisplayList);
   auto display_list_hash_code = hash_function(display_list_key);
-  ASSERT_EQ(display_list_hash_code, display_list_cache_key_id.GetHash());
+  ASSERT_EQ(display_list_hash_code,
+            hash_function(RasterCacheKey(id, RasterCacheKeyType::kDisplayList,
+                                         SkMatrix::Translate(100, 100))));
+  ASSERT_NE(display_list_hash_code,
+            hash_function(RasterCacheKey(id, RasterCacheKeyType::kDisplayList,
+                                         SkMatrix::Scale(2, 2))));
 
-  auto layer_children_cache_key_id =
-      RasterCacheKeyID(id, RasterCacheKeyType::kLayerChildren);
   auto layer_children_hash_code = hash_function(layer_children_key);
-  ASSERT_EQ(layer_children_hash_code, layer_children_cache_key_id.GetHash());
+  ASSERT_EQ(layer_children_hash_code,
+            hash_function(RasterCacheKey(id, RasterCacheKeyType::kLayerChildren,
+                                         SkMatrix::Translate(100, 100))));
+  ASSERT_NE(layer_hash_code, display_list_hash_code);
+}
+
+TEST(RasterCache, PrebuiltKeyMarkSeenMatchesIdProbes) {
+  RasterCache cache;
+  SkMatrix matrix = SkMatrix::Translate(10, 10);
+  RasterCacheKeyID id(5, RasterCacheKeyType::kDisplayList);
+
+  cache.BeginFrame();
+  cache.MarkSeen(RasterCacheKey(id, matrix), true);
+  ASSERT_TRUE(cache.HasEntry(id, matrix));
+  // Probes canonicalize translation away, so any translated matrix finds the
+  // entry created from the prebuilt key.
+  ASSERT_EQ(cache.GetAccessCount(id, SkMatrix::Translate(50, 50)), 1);
 }
 
 TEST(RasterCache, RasterCacheKeySameID) {
@@ -4,34 +4,185 @@
 
 #include "rtree.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <list>
 
 #include "flutter/fml/logging.h"
-#include "third_party/skia/include/core/SkBBHFactory.h"
 
 namespace flutter {
 
-RTree::RTree() : bbh_{SkRTreeFactory{}()}, all_ops_count_(0) {}
+namespace {
+
+// Maximum number of children per packed node. Keeps the tree shallow while
+// the bounds of each node stay reasonably tight.
+constexpr uint32_t kMaxChildren = 16;
+
+// Upper bound on the depth of the packed hierarchy. With |kMaxChildren|
+// entries per level this accommodates far more operations than a picture can
+// record and bounds the traversal stack that queries place on the stack.
+constexpr size_t kMaxDepth = 16;
+
+// Joins |rect| into |results|, which holds |count| mutually exclusive rects
+// and has room for |max_results| of them, and returns the new count.
+//
+// The rect is joined into the first entry it intersects with, or appended
+// when it intersects none of them. Once the buffer is full, rects that don't
+// fit are joined into the entry whose bounds grow the least, so the union of
+// the entries always covers every rect that was added.
+size_t AddNonOverlappingRect(SkRect* results,
+                             size_t count,
+                             size_t max_results,
+                             const SkRect& rect) {
+  size_t target = count;
+  for (size_t i = 0; i < count; i++) {
+    if (SkRect::Intersects(results[i], rect)) {
+      target = i;
+      break;
+    }
+  }
+  if (target == count) {
+    if (count < max_results) {
+      results[count] = rect;
+      return count + 1;
+    }
+    SkScalar least_growth = std::numeric_limits<SkScalar>::max();
+    target = 0;
+    for (size_t i = 0; i < count; i++) {
+      SkRect joined = results[i];
+      joined.join(rect);
+      SkScalar growth = joined.width() * joined.height() -
+                        results[i].width() * results[i].height();
+      if (growth < least_growth) {
+        least_growth = growth;
+        target = i;
+      }
+    }
+  }
+  results[target].join(rect);
+  // The grown entry may now intersect with other entries; keep joining until
+  // the remaining entries are mutually exclusive again.
+  bool joined = true;
+  while (joined) {
+    joined = false;
+    for (size_t i = 0; i < count; i++) {
+      for (size_t j = i + 1; j < count; j++) {
+        if (SkRect::Intersects(results[i], results[j])) {
+          results[i].join(results[j]);
+          results[j] = results[--count];
+          joined = true;
+        }
+      }
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+RTree::RTree() : all_ops_count_(0) {}
 
 void RTree::insert(const SkRect boundsArray[],
                    const SkBBoxHierarchy::Metadata metadata[],
                    int N) {
   FML_DCHECK(0 == all_ops_count_);
-  bbh_->insert(boundsArray, metadata, N);
+  op_rects_.assign(boundsArray, boundsArray + N);
+  op_is_draw_.resize(N);
   for (int i = 0; i < N; i++) {
-    if (metadata != nullptr && metadata[i].isDraw) {
-      draw_op_[i] = boundsArray[i];
-    }
+    op_is_draw_[i] = metadata != nullptr && metadata[i].isDraw;
   }
   all_ops_count_ = N;
+  bulkLoad();
 }
 
 void RTree::insert(const SkRect boundsArray[], int N) {
   insert(boundsArray, nullptr, N);
 }
 
+void RTree::bulkLoad() {
+  nodes_.clear();
+  // Leaf level: one node per operation with non-empty bounds. Operations
+  // with empty bounds can never intersect a query rect and are left out of
+  // the hierarchy.
+  for (int i = 0; i < all_ops_count_; i++) {
+    const SkRect& bounds = op_rects_[i];
+    if (bounds.isEmpty()) {
+      continue;
+    }
+    nodes_.push_back({bounds, i, 0u, 0u});
+  }
+  if (nodes_.empty()) {
+    return;
+  }
+
+  // Sort-tile-recursive ordering: slice the leaves into vertical strips by
+  // x center and order each strip by y center, so that consecutive runs of
+  // |kMaxChildren| leaves form spatially coherent parents.
+  size_t leaf_count = nodes_.size();
+  size_t parent_count = (leaf_count + kMaxChildren - 1) / kMaxChildren;
+  size_t strip_count = static_cast<size_t>(
+      std::ceil(std::sqrt(static_cast<double>(parent_count))));
+  size_t strip_size = strip_count * kMaxChildren;
+  std::sort(nodes_.begin(), nodes_.end(), [](const Node& a, const Node& b) {
+    return a.bounds.centerX() < b.bounds.centerX();
+  });
+  for (size_t start = 0; start < leaf_count; start += strip_size) {
+    auto end = nodes_.begin() + std::min(start + strip_size, leaf_count);
+    std::sort(nodes_.begin() + start, end, [](const Node& a, const Node& b) {
+      return a.bounds.centerY() < b.bounds.centerY();
+    });
+  }
+
+  // Every level shrinks by a factor of |kMaxChildren|, so the whole
+  // hierarchy fits in a single reservation.
+  nodes_.reserve(leaf_count + leaf_count / (kMaxChildren - 1) + 2);
+
+  // Build the upper levels bottom-up until a level fits in a single root,
+  // which ends up as the last node in the buffer.
+  size_t level_start = 0;
+  size_t level_count = leaf_count;
+  while (level_count > 1) {
+    size_t next_start = nodes_.size();
+    size_t level_end = level_start + level_count;
+    for (size_t first = level_start; first < level_end; first += kMaxChildren) {
+      uint32_t count = static_cast<uint32_t>(
+          std::min<size_t>(kMaxChildren, level_end - first));
+      SkRect bounds = nodes_[first].bounds;
+      for (uint32_t i = 1; i < count; i++) {
+        bounds.join(nodes_[first + i].bounds);
+      }
+      nodes_.push_back({bounds, -1, static_cast<uint32_t>(first), count});
+    }
+    level_start = next_start;
+    level_count = nodes_.size() - next_start;
+  }
+}
+
 void RTree::search(const SkRect& query, std::vector<int>* results) const {
-  bbh_->search(query, results);
+  if (nodes_.empty() || query.isEmpty()) {
+    return;
+  }
+  uint32_t stack[kMaxDepth * kMaxChildren];
+  size_t stack_size = 0;
+  stack[stack_size++] = static_cast<uint32_t>(nodes_.size() - 1);
+  while (stack_size > 0) {
+    const Node& node = nodes_[stack[--stack_size]];
+    if (!SkRect::Intersects(node.bounds, query)) {
+      continue;
+    }
+    if (node.child_count == 0) {
+      results->push_back(node.op_index);
+    } else {
+      FML_DCHECK(stack_size + node.child_count <= kMaxDepth * kMaxChildren);
+      for (uint32_t i = 0; i < node.child_count; i++) {
+        stack[stack_size++] = node.first_child + i;
+      }
+    }
+  }
+  // Bulk loading reordered the leaves, so restore the order the operations
+  // were recorded in.
+  std::sort(results->begin(), results->end());
 }
 
 std::list<SkRect> RTree::searchNonOverlappingDrawnRects(
@@ -42,12 +193,11 @@ std::list<SkRect> RTree::searchNonOverlappingDrawnRects(
 
   std::list<SkRect> final_results;
   for (int index : intermediary_results) {
-    auto draw_op = draw_op_.find(index);
     // Ignore records that don't draw anything.
-    if (draw_op == draw_op_.end()) {
+    if (!op_is_draw_[index]) {
       continue;
     }
-    auto current_record_rect = draw_op->second;
+    auto current_record_rect = op_rects_[index];
     auto replaced_existing_rect = false;
     // // If the current record rect intersects with any of the rects in the
     // // result list, then join them, and update the rect in final_results.
@@ -81,8 +231,39 @@ std::list<SkRect> RTree::searchNonOverlappingDrawnRects(
   return final_results;
 }
 
+size_t RTree::searchNonOverlappingDrawnRects(const SkRect& query,
+                                             SkRect* results,
+                                             size_t max_results) const {
+  if (nodes_.empty() || query.isEmpty() || max_results == 0) {
+    return 0;
+  }
+  size_t count = 0;
+  uint32_t stack[kMaxDepth * kMaxChildren];
+  size_t stack_size = 0;
+  stack[stack_size++] = static_cast<uint32_t>(nodes_.size() - 1);
+  while (stack_size > 0) {
+    const Node& node = nodes_[stack[--stack_size]];
+    if (!SkRect::Intersects(node.bounds, query)) {
+      continue;
+    }
+    if (node.child_count == 0) {
+      // Ignore records that don't draw anything.
+      if (op_is_draw_[node.op_index]) {
+        count = AddNonOverlappingRect(results, count, max_results, node.bounds);
+      }
+    } else {
+      FML_DCHECK(stack_size + node.child_count <= kMaxDepth * kMaxChildren);
+      for (uint32_t i = 0; i < node.child_count; i++) {
+        stack[stack_size++] = node.first_child + i;
+      }
+    }
+  }
+  return count;
+}
+
 size_t RTree::bytesUsed() const {
-  return bbh_->bytesUsed();
+  return sizeof(RTree) + nodes_.capacity() * sizeof(Node) +
+         op_rects_.capacity() * sizeof(SkRect) + op_is_draw_.capacity() / 8;
 }
 
 RTreeFactory::RTreeFactory() {
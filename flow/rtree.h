@@ -5,18 +5,23 @@
 #ifndef FLUTTER_FLOW_RTREE_H_
 #define FLUTTER_FLOW_RTREE_H_
 
+#include <cstdint>
 #include <list>
-#include <map>
+#include <vector>
 
 #include "third_party/skia/include/core/SkBBHFactory.h"
 #include "third_party/skia/include/core/SkTypes.h"
 
 namespace flutter {
 /**
- * An R-Tree implementation that forwards calls to an SkRTree.
+ * An R-Tree that bulk-loads the rects recorded for a picture into a packed
+ * hierarchy stored in a single contiguous buffer.
  *
- * This implementation provides a searchNonOverlappingDrawnRects method,
- * which can be used to query the rects for the operations recorded in the tree.
+ * The recorded operations are inserted exactly once, which allows the tree
+ * to be built bottom-up with the sort-tile-recursive algorithm instead of
+ * being assembled by repeated insertion. Queries walk a flat node array and,
+ * through the buffer based searchNonOverlappingDrawnRects overload, can run
+ * without allocating.
  */
 class RTree : public SkBBoxHierarchy {
  public:
@@ -37,14 +42,46 @@ class RTree : public SkBBoxHierarchy {
   // of each rect in the result list are mutually exclusive.
   std::list<SkRect> searchNonOverlappingDrawnRects(const SkRect& query) const;
 
+  // Variant of |searchNonOverlappingDrawnRects| that writes the joined rects
+  // into the caller provided |results| buffer of |max_results| entries and
+  // returns the number of entries written, without allocating.
+  //
+  // When the buffer is too small to keep the rects mutually exclusive, further
+  // rects are joined into the entry whose bounds grow the least, so the union
+  // of the written rects always covers every intersecting drawn rect. The
+  // order of the results is unspecified.
+  size_t searchNonOverlappingDrawnRects(const SkRect& query,
+                                        SkRect* results,
+                                        size_t max_results) const;
+
   // Insertion count (not overall node count, which may be greater).
   int getCount() const { return all_ops_count_; }
 
  private:
-  // A map containing the draw operation rects keyed off the operation index
-  // in the insert call.
-  std::map<int, SkRect> draw_op_;
-  sk_sp<SkBBoxHierarchy> bbh_;
+  // A node of the packed hierarchy. All nodes live in a single contiguous
+  // vector and the children of an internal node occupy a consecutive range,
+  // so queries walk the buffer without chasing pointers.
+  struct Node {
+    SkRect bounds;
+    // Index of the operation for leaf nodes, -1 for internal nodes.
+    int op_index;
+    // Index of the first child node; 0 for leaf nodes.
+    uint32_t first_child;
+    // Number of children; 0 for leaf nodes.
+    uint32_t child_count;
+  };
+
+  // Builds the packed hierarchy for the operations currently in |op_rects_|
+  // using sort-tile-recursive bulk loading.
+  void bulkLoad();
+
+  // The bounds of every inserted operation, indexed by operation.
+  std::vector<SkRect> op_rects_;
+  // Whether the operation at the given index draws anything.
+  std::vector<bool> op_is_draw_;
+  // The packed hierarchy; leaves first, then each upper level, with the root
+  // as the last node. Empty when no operation has non-empty bounds.
+  std::vector<Node> nodes_;
   int all_ops_count_;
 };
 
@@ -4,6 +4,9 @@
 
 #include "rtree.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "flutter/testing/testing.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkPictureRecorder.h"
@@ -231,5 +234,69 @@ TEST(RTree, searchNonOverlappingDrawnRectsJoinRectsWhenIntersectedCase3) {
   ASSERT_EQ(*hits.begin(), SkRect::MakeLTRB(50, 50, 620, 300));
 }
 
+TEST(RTree, searchNonOverlappingDrawnRectsIntoCallerBuffer) {
+  auto rtree_factory = RTreeFactory();
+  auto recorder = std::make_unique<SkPictureRecorder>();
+  auto recording_canvas =
+      recorder->beginRecording(SkRect::MakeIWH(1000, 1000), &rtree_factory);
+
+  auto rect_paint = SkPaint();
+  rect_paint.setColor(SkColors::kCyan);
+  rect_paint.setStyle(SkPaint::Style::kFill_Style);
+
+  // Given the disjoint rects A and B that intersect with the query rect,
+  // both are written to the caller provided buffer without being joined.
+  // A
+  recording_canvas->drawRect(SkRect::MakeLTRB(100, 100, 200, 200), rect_paint);
+  // B
+  recording_canvas->drawRect(SkRect::MakeLTRB(300, 100, 400, 200), rect_paint);
+
+  recorder->finishRecordingAsPicture();
+
+  SkRect hits[4];
+  auto count = rtree_factory.getInstance()->searchNonOverlappingDrawnRects(
+      SkRect::MakeLTRB(0, 0, 1000, 1050), hits, std::size(hits));
+  ASSERT_EQ(2UL, count);
+  // The result order is unspecified, so match the rects as a set.
+  for (auto& expected : {SkRect::MakeLTRB(100, 100, 200, 200),
+                         SkRect::MakeLTRB(300, 100, 400, 200)}) {
+    ASSERT_TRUE(std::count(hits, hits + count, expected) == 1);
+  }
+}
+
+TEST(RTree, searchNonOverlappingDrawnRectsJoinsWhenBufferIsFull) {
+  auto rtree_factory = RTreeFactory();
+  auto recorder = std::make_unique<SkPictureRecorder>();
+  auto recording_canvas =
+      recorder->beginRecording(SkRect::MakeIWH(2000, 1000), &rtree_factory);
+
+  auto rect_paint = SkPaint();
+  rect_paint.setColor(SkColors::kCyan);
+  rect_paint.setStyle(SkPaint::Style::kFill_Style);
+
+  // Given three disjoint rects and a buffer with room for only two,
+  // the result still covers every rect.
+  // A
+  recording_canvas->drawRect(SkRect::MakeLTRB(0, 0, 50, 50), rect_paint);
+  // B
+  recording_canvas->drawRect(SkRect::MakeLTRB(60, 0, 110, 50), rect_paint);
+  // C
+  recording_canvas->drawRect(SkRect::MakeLTRB(1000, 0, 1050, 50), rect_paint);
+
+  recorder->finishRecordingAsPicture();
+
+  SkRect hits[2];
+  auto count = rtree_factory.getInstance()->searchNonOverlappingDrawnRects(
+      SkRect::MakeLTRB(0, 0, 2000, 1000), hits, std::size(hits));
+  ASSERT_EQ(2UL, count);
+  for (auto& drawn : {SkRect::MakeLTRB(0, 0, 50, 50),
+                      SkRect::MakeLTRB(60, 0, 110, 50),
+                      SkRect::MakeLTRB(1000, 0, 1050, 50)}) {
+    ASSERT_TRUE(std::any_of(hits, hits + count, [&drawn](const SkRect& hit) {
+      return hit.contains(drawn);
+    }));
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
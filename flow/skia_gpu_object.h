@@ -5,12 +5,14 @@
 #ifndef FLUTTER_FLOW_SKIA_GPU_OBJECT_H_
 #define FLUTTER_FLOW_SKIA_GPU_OBJECT_H_
 
+#include <algorithm>
 #include <mutex>
 #include <queue>
 
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkRefCnt.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
@@ -24,24 +26,40 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
  public:
   using ResourceContext = T;
 
-  void Unref(SkRefCnt* object) {
+  // |approximate_bytes| is the caller's estimate of the GPU memory the
+  // object keeps alive; it feeds the eager-drain accounting. Zero is a valid
+  // estimate for objects without GPU backing.
+  void Unref(SkRefCnt* object, size_t approximate_bytes = 0) {
     std::scoped_lock lock(mutex_);
-    objects_.push_back(object);
-    if (!drain_pending_) {
-      drain_pending_ = true;
-      task_runner_->PostDelayedTask(
-          [strong = fml::Ref(this)]() { strong->Drain(); }, drain_delay_);
-    }
+    objects_.push_back({object, approximate_bytes});
+    held_object_bytes_ += approximate_bytes;
+    ScheduleDrainLocked();
   }
 
   void DeleteTexture(GrBackendTexture texture) {
+    // Assume 32bit depth to approximate the GPU memory the texture holds.
+    size_t approximate_bytes =
+        static_cast<size_t>(texture.width()) * texture.height() * 4;
     std::scoped_lock lock(mutex_);
     textures_.push_back(texture);
-    if (!drain_pending_) {
-      drain_pending_ = true;
-      task_runner_->PostDelayedTask(
-          [strong = fml::Ref(this)]() { strong->Drain(); }, drain_delay_);
-    }
+    held_texture_bytes_ += approximate_bytes;
+    ScheduleDrainLocked();
+  }
+
+  // Sets the approximate number of held GPU bytes above which a drain is
+  // scheduled without the usual delay. Typically derived from the GPU
+  // resource cache limit so a queue sitting on a significant fraction of the
+  // budget does not wait out its drain delay. Zero (the default) disables
+  // eager draining.
+  void SetDrainImmediatelyByteThreshold(size_t bytes) {
+    std::scoped_lock lock(mutex_);
+    drain_immediately_byte_threshold_ = bytes;
+  }
+
+  // Returns the approximate GPU bytes held by queued objects and textures.
+  size_t HeldBytes() {
+    std::scoped_lock lock(mutex_);
+    return held_object_bytes_ + held_texture_bytes_;
   }
 
   // Usually, the drain is called automatically. However, during IO manager
@@ -51,13 +69,16 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
   // after this call.
   void Drain() {
     TRACE_EVENT0("flutter", "SkiaUnrefQueue::Drain");
-    std::deque<SkRefCnt*> skia_objects;
+    std::deque<HeldObject> skia_objects;
     std::deque<GrBackendTexture> textures;
     {
       std::scoped_lock lock(mutex_);
       objects_.swap(skia_objects);
       textures_.swap(textures);
+      held_object_bytes_ = 0;
+      held_texture_bytes_ = 0;
       drain_pending_ = false;
+      eager_drain_pending_ = false;
     }
     DoDrain(skia_objects, textures, context_);
   }
@@ -67,14 +88,105 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
   }
 
  private:
+  // An object queued for unref along with the caller's estimate of the GPU
+  // memory it keeps alive.
+  struct HeldObject {
+    SkRefCnt* object;
+    size_t approximate_bytes;
+  };
+
+  // Time budget for a single automatic drain batch. A backlog larger than
+  // the budget is drained over successive task runner iterations so that a
+  // huge batch cannot stall other IO work.
+  static constexpr fml::TimeDelta kDrainBatchTimeBudget =
+      fml::TimeDelta::FromMilliseconds(2);
+
   const fml::RefPtr<fml::TaskRunner> task_runner_;
   const fml::TimeDelta drain_delay_;
   std::mutex mutex_;
-  std::deque<SkRefCnt*> objects_;
+  std::deque<HeldObject> objects_;
   std::deque<GrBackendTexture> textures_;
   bool drain_pending_;
+  bool eager_drain_pending_ = false;
+  size_t held_object_bytes_ = 0;
+  size_t held_texture_bytes_ = 0;
+  size_t drain_immediately_byte_threshold_ = 0;
   sk_sp<ResourceContext> context_;
 
+  // Schedules a batched drain if none is pending. Once the held byte
+  // estimate crosses the eager-drain threshold the drain is posted without
+  // delay, jumping ahead of any delayed drain already scheduled.
+  void ScheduleDrainLocked() {
+    bool under_pressure =
+        drain_immediately_byte_threshold_ > 0 &&
+        held_object_bytes_ + held_texture_bytes_ >=
+            drain_immediately_byte_threshold_;
+    if (under_pressure && !eager_drain_pending_) {
+      eager_drain_pending_ = true;
+      drain_pending_ = true;
+      task_runner_->PostTask(
+          [strong = fml::Ref(this)]() { strong->DrainBatch(); });
+      return;
+    }
+    if (!drain_pending_) {
+      drain_pending_ = true;
+      task_runner_->PostDelayedTask(
+          [strong = fml::Ref(this)]() { strong->DrainBatch(); }, drain_delay_);
+    }
+  }
+
+  // Unrefs queued objects until the batch time budget runs out; a remainder
+  // is handed back to the queue and drained in a follow-up task so other IO
+  // tasks can interleave. Textures are always deleted in full since they are
+  // few and individually cheap to delete.
+  void DrainBatch() {
+    TRACE_EVENT0("flutter", "SkiaUnrefQueue::Drain");
+    std::deque<HeldObject> skia_objects;
+    std::deque<GrBackendTexture> textures;
+    {
+      std::scoped_lock lock(mutex_);
+      objects_.swap(skia_objects);
+      textures_.swap(textures);
+      held_texture_bytes_ = 0;
+      drain_pending_ = false;
+      eager_drain_pending_ = false;
+    }
+    const fml::TimePoint deadline =
+        fml::TimePoint::Now() + kDrainBatchTimeBudget;
+    size_t drained_bytes = 0;
+    bool did_unref = false;
+    while (!skia_objects.empty()) {
+      HeldObject held = skia_objects.front();
+      skia_objects.pop_front();
+      held.object->unref();
+      drained_bytes += held.approximate_bytes;
+      did_unref = true;
+      if (!skia_objects.empty() && fml::TimePoint::Now() >= deadline) {
+        break;
+      }
+    }
+    if (context_) {
+      for (const GrBackendTexture& texture : textures) {
+        context_->deleteBackendTexture(texture);
+      }
+      if (did_unref) {
+        context_->performDeferredCleanup(std::chrono::milliseconds(0));
+      }
+    }
+    std::scoped_lock lock(mutex_);
+    held_object_bytes_ -= std::min(held_object_bytes_, drained_bytes);
+    if (!skia_objects.empty()) {
+      // Hand the remainder back in front of anything queued meanwhile.
+      skia_objects.insert(skia_objects.end(), objects_.begin(), objects_.end());
+      objects_.swap(skia_objects);
+      if (!drain_pending_) {
+        drain_pending_ = true;
+        task_runner_->PostTask(
+            [strong = fml::Ref(this)]() { strong->DrainBatch(); });
+      }
+    }
+  }
+
   // The `GrDirectContext* context` is only used for signaling Skia to
   // performDeferredCleanup. It can be nullptr when such signaling is not needed
   // (e.g., in unit tests).
@@ -101,11 +213,11 @@ class UnrefQueue : public fml::RefCountedThreadSafe<UnrefQueue<T>> {
   }
 
   // static
-  static void DoDrain(const std::deque<SkRefCnt*>& skia_objects,
+  static void DoDrain(const std::deque<HeldObject>& skia_objects,
                       const std::deque<GrBackendTexture>& textures,
                       sk_sp<ResourceContext> context) {
-    for (SkRefCnt* skia_object : skia_objects) {
-      skia_object->unref();
+    for (const HeldObject& held : skia_objects) {
+      held.object->unref();
     }
 
     if (context) {
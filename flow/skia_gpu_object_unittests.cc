@@ -161,5 +161,34 @@ TEST_F(SkiaGpuObjectTest, UnrefResourceContextInTaskRunnerThread) {
   ASSERT_EQ(dtor_task_queue_id, unref_task_runner()->GetTaskQueueId());
 }
 
+TEST_F(SkiaGpuObjectTest, UnrefTracksHeldBytes) {
+  // Use the delayed queue so the automatic drain does not race the
+  // accounting checks.
+  auto latch1 = std::make_shared<fml::AutoResetWaitableEvent>();
+  auto latch2 = std::make_shared<fml::AutoResetWaitableEvent>();
+  delayed_unref_queue()->Unref(new TestSkObject(latch1, nullptr), 100);
+  EXPECT_EQ(delayed_unref_queue()->HeldBytes(), 100u);
+  delayed_unref_queue()->Unref(new TestSkObject(latch2, nullptr), 50);
+  EXPECT_EQ(delayed_unref_queue()->HeldBytes(), 150u);
+  delayed_unref_queue()->Drain();
+  EXPECT_EQ(delayed_unref_queue()->HeldBytes(), 0u);
+  latch1->Wait();
+  latch2->Wait();
+}
+
+TEST_F(SkiaGpuObjectTest, EagerDrainWhenOverByteThreshold) {
+  std::shared_ptr<fml::AutoResetWaitableEvent> latch =
+      std::make_shared<fml::AutoResetWaitableEvent>();
+  fml::TaskQueueId dtor_task_queue_id(0);
+  delayed_unref_queue()->SetDrainImmediatelyByteThreshold(64);
+  // Well above the threshold; the drain must be scheduled right away
+  // instead of waiting out the three second drain delay.
+  delayed_unref_queue()->Unref(new TestSkObject(latch, &dtor_task_queue_id),
+                               128);
+  latch->Wait();
+  ASSERT_EQ(dtor_task_queue_id, unref_task_runner()->GetTaskQueueId());
+  EXPECT_EQ(delayed_unref_queue()->HeldBytes(), 0u);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -35,6 +35,18 @@ SurfaceFrame::SurfaceFrame(sk_sp<SkSurface> surface,
 }
 
 bool SurfaceFrame::Submit() {
+  if (!SubmitDeferringPresent()) {
+    return false;
+  }
+
+  if (present_callback_) {
+    return Present();
+  }
+
+  return true;
+}
+
+bool SurfaceFrame::SubmitDeferringPresent() {
   if (submitted_) {
     return false;
   }
@@ -44,6 +56,19 @@ bool SurfaceFrame::Submit() {
   return submitted_;
 }
 
+bool SurfaceFrame::Present() {
+  FML_DCHECK(present_callback_);
+  FML_DCHECK(submitted_);
+
+  if (presented_) {
+    return false;
+  }
+
+  presented_ = present_callback_(*this);
+
+  return presented_;
+}
+
 bool SurfaceFrame::IsSubmitted() const {
   return submitted_;
 }
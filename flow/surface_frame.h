@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "flutter/common/graphics/gl_context_switch.h"
 #include "flutter/display_list/display_list_canvas_recorder.h"
@@ -24,6 +25,12 @@ class SurfaceFrame {
   using SubmitCallback =
       std::function<bool(SurfaceFrame& surface_frame, SkCanvas* canvas)>;
 
+  // Invoked by |Present|, possibly on a dedicated present thread owned by the
+  // rasterizer. Surfaces whose client rendering API allows presentation off
+  // the raster thread install one; their submit callback must then restrict
+  // itself to encoding and flushing the frame's rendering work.
+  using PresentCallback = std::function<bool(SurfaceFrame& surface_frame)>;
+
   // Information about the underlying framebuffer
   struct FramebufferInfo {
     // Indicates whether or not the surface supports pixel readback as used in
@@ -75,15 +82,44 @@ class SurfaceFrame {
     // Corresponds to EGL_KHR_partial_update
     std::optional<SkIRect> buffer_damage;
 
+    // The frame damage broken into a bounded list of rectangles, for
+    // backends that can present multiple damage rectangles. Empty when no
+    // such breakdown is available; frame_damage is always their bounding
+    // rectangle.
+    std::vector<SkIRect> frame_damage_rects;
+
     // Time at which this frame is scheduled to be presented. This is a hint
     // that can be passed to the platform to drop queued frames.
     std::optional<fml::TimePoint> presentation_time;
   };
 
+  // Submits and, when a present callback is installed, presents the frame
+  // inline. Callers that want the present to run elsewhere use
+  // |SubmitDeferringPresent| followed by |Present| instead.
   bool Submit();
 
+  // Runs the submit callback only; the caller takes responsibility for
+  // invoking |Present| afterwards. Equivalent to |Submit| for frames without
+  // a present callback.
+  bool SubmitDeferringPresent();
+
+  // Runs the present callback. May only be called after a successful
+  // |SubmitDeferringPresent| and only once; the rasterizer invokes this on
+  // its present thread for frames whose surface installed a present callback.
+  bool Present();
+
   bool IsSubmitted() const;
 
+  // Install the callback that performs the swap/present for this frame,
+  // potentially off the raster thread. Must be installed before |Submit|.
+  // When no present callback is installed the submit callback is expected to
+  // present the frame itself, as it historically has.
+  void set_present_callback(const PresentCallback& present_callback) {
+    present_callback_ = present_callback;
+  }
+
+  bool SupportsThreadedPresent() const { return !!present_callback_; }
+
   sk_sp<SkSurface> SkiaSurface() const;
 
   SkCanvas* SkiaCanvas();
@@ -101,6 +137,7 @@ class SurfaceFrame {
 
  private:
   bool submitted_ = false;
+  bool presented_ = false;
 
   sk_sp<DisplayListCanvasRecorder> dl_recorder_;
   sk_sp<SkSurface> surface_;
@@ -108,6 +145,7 @@ class SurfaceFrame {
   FramebufferInfo framebuffer_info_;
   SubmitInfo submit_info_;
   SubmitCallback submit_callback_;
+  PresentCallback present_callback_;
   std::unique_ptr<GLContextResult> context_result_;
 
   bool PerformSubmit();
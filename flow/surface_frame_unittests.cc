@@ -35,4 +35,47 @@ TEST(FlowTest, SurfaceFrameDoesNotHaveEmptyCanvas) {
       frame.SkiaCanvas()->quickReject(SkRect::MakeLTRB(10, 10, 50, 50)));
 }
 
+TEST(FlowTest, SurfaceFrameSubmitPresentsInlineWithoutDeferral) {
+  int submit_count = 0;
+  int present_count = 0;
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  SurfaceFrame frame(
+      /*surface=*/nullptr, framebuffer_info,
+      /*submit_callback=*/
+      [&submit_count](const SurfaceFrame&, SkCanvas*) {
+        submit_count++;
+        return true;
+      },
+      SkISize::Make(800, 600));
+  frame.set_present_callback([&present_count](const SurfaceFrame&) {
+    present_count++;
+    return true;
+  });
+
+  // Submit presents inline for callers unaware of the split, e.g. external
+  // view embedders.
+  EXPECT_TRUE(frame.Submit());
+  EXPECT_EQ(submit_count, 1);
+  EXPECT_EQ(present_count, 1);
+}
+
+TEST(FlowTest, SurfaceFrameDeferredPresentRunsOnce) {
+  int present_count = 0;
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  SurfaceFrame frame(
+      /*surface=*/nullptr, framebuffer_info,
+      /*submit_callback=*/[](const SurfaceFrame&, SkCanvas*) { return true; },
+      SkISize::Make(800, 600));
+  frame.set_present_callback([&present_count](const SurfaceFrame&) {
+    present_count++;
+    return true;
+  });
+
+  EXPECT_TRUE(frame.SubmitDeferringPresent());
+  EXPECT_EQ(present_count, 0);
+  EXPECT_TRUE(frame.Present());
+  EXPECT_FALSE(frame.Present());
+  EXPECT_EQ(present_count, 1);
+}
+
 }  // namespace flutter
@@ -40,7 +40,9 @@ class DiffContextTest : public ThreadTest {
                        const SkIRect& additional_damage = SkIRect::MakeEmpty(),
                        int horizontal_clip_alignment = 0,
                        int vertical_alignment = 0,
-                       bool use_raster_cache = true);
+                       bool use_raster_cache = true,
+                       fml::BasicTaskRunner* concurrent_task_runner = nullptr,
+                       TextureRegistry* texture_registry = nullptr);
 
   // Create display list consisting of filled rect with given color; Being able
   // to specify different color is useful to test deep comparison of pictures
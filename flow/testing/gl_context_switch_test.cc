@@ -11,12 +11,15 @@ namespace testing {
 
 FML_THREAD_LOCAL fml::ThreadLocalUniquePtr<int> current_context;
 
+static int set_current_count = 0;
+
 TestSwitchableGLContext::TestSwitchableGLContext(int context)
     : context_(context){};
 
 TestSwitchableGLContext::~TestSwitchableGLContext() = default;
 
 bool TestSwitchableGLContext::SetCurrent() {
+  set_current_count++;
   SetCurrentContext(context_);
   return true;
 };
@@ -26,10 +29,22 @@ bool TestSwitchableGLContext::RemoveCurrent() {
   return true;
 };
 
+intptr_t TestSwitchableGLContext::GetContextKey() const {
+  return context_;
+};
+
 int TestSwitchableGLContext::GetContext() {
   return context_;
 };
 
+int TestSwitchableGLContext::GetSetCurrentCount() {
+  return set_current_count;
+};
+
+void TestSwitchableGLContext::ResetSetCurrentCount() {
+  set_current_count = 0;
+};
+
 int TestSwitchableGLContext::GetCurrentContext() {
   return *(current_context.get());
 };
@@ -23,10 +23,19 @@ class TestSwitchableGLContext : public SwitchableGLContext {
 
   bool RemoveCurrent() override;
 
+  intptr_t GetContextKey() const override;
+
   int GetContext();
 
   static int GetCurrentContext();
 
+  //------------------------------------------------------------------------------
+  /// The number of |SetCurrent| calls made on any test context, used to
+  /// verify that redundant switches are skipped.
+  static int GetSetCurrentCount();
+
+  static void ResetSetCurrentCount();
+
   //------------------------------------------------------------------------------
   /// Set the current context
   ///
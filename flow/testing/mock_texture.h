@@ -35,7 +35,7 @@ class MockTexture : public Texture {
 
   void OnGrContextCreated() override { gr_context_created_ = true; }
   void OnGrContextDestroyed() override { gr_context_destroyed_ = true; }
-  void MarkNewFrameAvailable() override {}
+  void OnNewFrameAvailable() override {}
   void OnTextureUnregistered() override { unregistered_ = true; }
 
   const std::vector<PaintCall>& paint_calls() { return paint_calls_; }
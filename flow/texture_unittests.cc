@@ -4,6 +4,8 @@
 
 #include "flutter/common/graphics/texture.h"
 
+#include <thread>
+
 #include "flutter/flow/testing/mock_texture.h"
 #include "gtest/gtest.h"
 
@@ -95,5 +97,27 @@ TEST(TextureRegistryTest, ReuseSameTextureSlot) {
   ASSERT_TRUE(mock_texture2->unregistered());
 }
 
+TEST(TextureRegistryTest, RegistrationsPublishAcrossThreads) {
+  TextureRegistry registry;
+  constexpr int kTextureCount = 100;
+
+  std::thread registrar([&registry] {
+    for (int i = 0; i < kTextureCount; i++) {
+      registry.RegisterTexture(std::make_shared<MockTexture>(i));
+    }
+  });
+
+  // Lookups racing the registrations may observe any prefix of them but
+  // must never see a torn mapping.
+  for (int i = 0; i < kTextureCount; i++) {
+    registry.GetTexture(i);
+  }
+  registrar.join();
+
+  for (int i = 0; i < kTextureCount; i++) {
+    ASSERT_NE(registry.GetTexture(i), nullptr);
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -4,6 +4,8 @@
 
 #include "flutter/fml/ascii_trie.h"
 
+#include <deque>
+
 #include "flutter/fml/logging.h"
 
 namespace fml {
@@ -32,19 +34,37 @@ TrieNodePtr MakeTrie(const std::vector<std::string>& entries) {
 }  // namespace
 
 void AsciiTrie::Fill(const std::vector<std::string>& entries) {
-  node_ = MakeTrie(entries);
-}
+  nodes_.clear();
+  edge_labels_.clear();
+  edge_targets_.clear();
 
-bool AsciiTrie::Query(TrieNode* trie, const char* query) {
-  FML_DCHECK(trie);
-  const char* char_position = query;
-  TrieNode* trie_position = trie;
-  TrieNode* child = nullptr;
-  int ch;
-  while ((ch = *char_position) && (child = trie_position->children[ch].get())) {
-    char_position++;
-    trie_position = child;
+  TrieNodePtr root = MakeTrie(entries);
+  if (!root) {
+    return;
+  }
+
+  // Flatten the pointer-linked trie breadth-first so that the nodes of each
+  // level and the edges of each node are contiguous in memory.
+  std::deque<TrieNode*> worklist = {root.get()};
+  nodes_.push_back({0, 0});
+  size_t flattened = 0;
+  while (!worklist.empty()) {
+    TrieNode* node = worklist.front();
+    worklist.pop_front();
+    const size_t node_index = flattened++;
+    const uint32_t children_start = edge_labels_.size();
+    for (int ch = 0; ch < kMaxAsciiValue; ++ch) {
+      if (node->children[ch]) {
+        edge_labels_.push_back(static_cast<char>(ch));
+        edge_targets_.push_back(nodes_.size());
+        nodes_.push_back({0, 0});
+        worklist.push_back(node->children[ch].get());
+      }
+    }
+    // Not written through a reference since the pushes above may reallocate
+    // |nodes_|.
+    nodes_[node_index].children_start = children_start;
+    nodes_[node_index].child_count = edge_labels_.size() - children_start;
   }
-  return !child && trie_position != trie;
 }
 }  // namespace fml
@@ -5,6 +5,7 @@
 #ifndef FLUTTER_FML_ASCIITRIE_H_
 #define FLUTTER_FML_ASCIITRIE_H_
 
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
@@ -12,6 +13,12 @@
 namespace fml {
 
 /// A trie for looking for ASCII prefixes.
+///
+/// The trie is stored as a flat breadth-first array of nodes whose outgoing
+/// edge labels are contiguous in memory, so a query is a handful of linear
+/// scans over adjacent bytes instead of a dependent-load chain through
+/// pointer-linked nodes. The label scan uses memchr, which is vectorized by
+/// the C library on all supported targets.
 class AsciiTrie {
  public:
   struct TrieNode;
@@ -23,17 +30,46 @@ class AsciiTrie {
   void Fill(const std::vector<std::string>& entries);
 
   /// Returns true if \p argument is prefixed by the contents of the trie.
-  inline bool Query(const char* argument) {
-    return !node_ || Query(node_.get(), argument);
+  inline bool Query(const char* argument) const {
+    if (nodes_.empty()) {
+      return true;
+    }
+    uint32_t node = 0;
+    const char* char_position = argument;
+    int ch;
+    while ((ch = *char_position)) {
+      const FlatNode& flat_node = nodes_[node];
+      const char* labels = edge_labels_.data() + flat_node.children_start;
+      const char* found = static_cast<const char*>(
+          memchr(labels, ch, flat_node.child_count));
+      if (!found) {
+        // No edge for this character: the query is prefixed by an entry iff
+        // the walk progressed past the root.
+        return node != 0;
+      }
+      node = edge_targets_[flat_node.children_start + (found - labels)];
+      char_position++;
+    }
+    return false;
   }
 
+  /// An intermediate pointer-linked node, only used while building the trie.
   struct TrieNode {
     TrieNodePtr children[kMaxAsciiValue];
   };
 
  private:
-  static bool Query(TrieNode* trie, const char* query);
-  TrieNodePtr node_;
+  /// A node in the flattened trie; its outgoing edges occupy the index range
+  /// [children_start, children_start + child_count) of |edge_labels_| and
+  /// |edge_targets_|.
+  struct FlatNode {
+    uint32_t children_start;
+    uint32_t child_count;
+  };
+
+  std::vector<FlatNode> nodes_;
+  std::vector<char> edge_labels_;
+  std::vector<uint32_t> edge_targets_;
 };
 }  // namespace fml
 
@@ -35,3 +35,22 @@ TEST(AsciiTableTest, MultipleEntries) {
   ASSERT_TRUE(trie.Query("foozzz"));
   ASSERT_TRUE(trie.Query("barzzz"));
 }
+
+TEST(AsciiTableTest, SharedPrefixes) {
+  AsciiTrie trie;
+  auto entries = std::vector<std::string>{"flutter.ui", "flutter.gpu", "dart"};
+  trie.Fill(entries);
+  ASSERT_TRUE(trie.Query("flutter.ui.frame"));
+  ASSERT_TRUE(trie.Query("flutter.gpu.raster"));
+  ASSERT_TRUE(trie.Query("dart.events"));
+  ASSERT_FALSE(trie.Query("skia.gpu"));
+}
+
+TEST(AsciiTableTest, Refill) {
+  AsciiTrie trie;
+  trie.Fill({"foo"});
+  ASSERT_TRUE(trie.Query("foobar"));
+  trie.Fill({"bar"});
+  ASSERT_TRUE(trie.Query("barzzz"));
+  ASSERT_FALSE(trie.Query("foobar"));
+}
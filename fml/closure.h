@@ -5,14 +5,142 @@
 #ifndef FLUTTER_FML_CLOSURE_H_
 #define FLUTTER_FML_CLOSURE_H_
 
+#include <cstddef>
 #include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
 
+#include "flutter/fml/logging.h"
 #include "flutter/fml/macros.h"
 
 namespace fml {
 
 using closure = std::function<void()>;
 
+//------------------------------------------------------------------------------
+/// @brief      A move-only callable of signature `void()` with inline storage
+///             for small captures.
+///
+///             Task closures posted to the engine's task runners typically
+///             capture a weak pointer plus a handful of arguments.
+///             std::function requires the callable to be copyable, which
+///             forces fml::MakeCopyable wrappers (and a shared_ptr
+///             allocation) around move-only captures, and it spills captures
+///             beyond its small implementation-defined buffer to the heap.
+///             fml::Closure never requires the callable to be copyable and
+///             keeps captures up to |kInlineCaptureSize| bytes inline,
+///             falling back to a single heap allocation for larger ones.
+///
+///             Anything invocable as `void()` converts implicitly. In
+///             particular existing fml::closure values and fml::MakeCopyable
+///             wrappers keep working unchanged; move-only captures like
+///             std::unique_ptr no longer need the wrapper at all.
+class Closure {
+ public:
+  /// Sized so that a weak pointer and a few captured arguments stay inline.
+  static constexpr size_t kInlineCaptureSize = 56;
+
+  Closure() = default;
+
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  Closure(std::nullptr_t) {}
+
+  template <typename Callable,
+            typename = std::enable_if_t<
+                !std::is_same<std::decay_t<Callable>, Closure>::value &&
+                std::is_invocable_r<void, std::decay_t<Callable>&>::value>>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  Closure(Callable&& callable) {
+    using T = std::decay_t<Callable>;
+    if constexpr (sizeof(T) <= kInlineCaptureSize &&
+                  alignof(T) <= alignof(std::max_align_t) &&
+                  std::is_nothrow_move_constructible<T>::value) {
+      new (storage_) T(std::forward<Callable>(callable));
+      ops_ = &InlineOps<T>::kOps;
+    } else {
+      *reinterpret_cast<T**>(storage_) =
+          new T(std::forward<Callable>(callable));
+      ops_ = &HeapOps<T>::kOps;
+    }
+  }
+
+  Closure(Closure&& other) noexcept { MoveFrom(std::move(other)); }
+
+  Closure& operator=(Closure&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(std::move(other));
+    }
+    return *this;
+  }
+
+  Closure& operator=(std::nullptr_t) {
+    Reset();
+    return *this;
+  }
+
+  ~Closure() { Reset(); }
+
+  explicit operator bool() const { return ops_ != nullptr; }
+
+  void operator()() const {
+    FML_DCHECK(ops_) << "Invoked an empty fml::Closure.";
+    ops_->invoke(const_cast<unsigned char*>(storage_));
+  }
+
+ private:
+  /// The manually managed vtable of the erased callable. One static instance
+  /// exists per callable type; an empty closure has no vtable at all.
+  struct Ops {
+    void (*invoke)(void* storage);
+    void (*move)(void* from, void* to);
+    void (*destroy)(void* storage);
+  };
+
+  template <typename T>
+  struct InlineOps {
+    static void Invoke(void* storage) { (*static_cast<T*>(storage))(); }
+    static void Move(void* from, void* to) {
+      new (to) T(std::move(*static_cast<T*>(from)));
+      static_cast<T*>(from)->~T();
+    }
+    static void Destroy(void* storage) { static_cast<T*>(storage)->~T(); }
+    static constexpr Ops kOps = {&Invoke, &Move, &Destroy};
+  };
+
+  template <typename T>
+  struct HeapOps {
+    static T* Get(void* storage) { return *static_cast<T**>(storage); }
+    static void Invoke(void* storage) { (*Get(storage))(); }
+    static void Move(void* from, void* to) {
+      *static_cast<T**>(to) = Get(from);
+    }
+    static void Destroy(void* storage) { delete Get(storage); }
+    static constexpr Ops kOps = {&Invoke, &Move, &Destroy};
+  };
+
+  void MoveFrom(Closure&& other) noexcept {
+    if (other.ops_) {
+      other.ops_->move(other.storage_, storage_);
+      ops_ = other.ops_;
+      other.ops_ = nullptr;
+    }
+  }
+
+  void Reset() {
+    if (ops_) {
+      ops_->destroy(storage_);
+      ops_ = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) unsigned char storage_[kInlineCaptureSize];
+  const Ops* ops_ = nullptr;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(Closure);
+};
+
 //------------------------------------------------------------------------------
 /// @brief      Wraps a closure that is invoked in the destructor unless
 ///             released by the caller.
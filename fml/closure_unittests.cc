@@ -0,0 +1,93 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/closure.h"
+
+#include <memory>
+
+#include "flutter/fml/make_copyable.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace testing {
+
+TEST(ClosureTest, InvokesCallable) {
+  int value = 0;
+  fml::Closure closure = [&value] { value = 42; };
+  ASSERT_TRUE(closure);
+  closure();
+  ASSERT_EQ(value, 42);
+}
+
+TEST(ClosureTest, DefaultAndNullptrAreEmpty) {
+  fml::Closure default_constructed;
+  ASSERT_FALSE(default_constructed);
+  fml::Closure null_constructed = nullptr;
+  ASSERT_FALSE(null_constructed);
+}
+
+TEST(ClosureTest, HoldsMoveOnlyCaptureWithoutMakeCopyable) {
+  auto captured = std::make_unique<int>(7);
+  int value = 0;
+  fml::Closure closure = [captured = std::move(captured), &value] {
+    value = *captured;
+  };
+  closure();
+  ASSERT_EQ(value, 7);
+}
+
+TEST(ClosureTest, MoveTransfersCallable) {
+  int value = 0;
+  fml::Closure closure = [&value] { value++; };
+  fml::Closure moved = std::move(closure);
+  ASSERT_FALSE(closure);  // NOLINT(bugprone-use-after-move)
+  ASSERT_TRUE(moved);
+  moved();
+  ASSERT_EQ(value, 1);
+
+  fml::Closure assigned;
+  assigned = std::move(moved);
+  assigned();
+  ASSERT_EQ(value, 2);
+}
+
+TEST(ClosureTest, LargeCapturesFallBackToTheHeap) {
+  struct {
+    char padding[fml::Closure::kInlineCaptureSize * 2] = {};
+    int value = 9;
+  } large;
+  int value = 0;
+  fml::Closure closure = [large, &value] { value = large.value; };
+  closure();
+  ASSERT_EQ(value, 9);
+}
+
+TEST(ClosureTest, DestroysCaptureWhenCleared) {
+  auto tracker = std::make_shared<int>(1);
+  ASSERT_EQ(tracker.use_count(), 1);
+  fml::Closure closure = [tracker] {};
+  ASSERT_EQ(tracker.use_count(), 2);
+  closure = nullptr;
+  ASSERT_EQ(tracker.use_count(), 1);
+  ASSERT_FALSE(closure);
+}
+
+TEST(ClosureTest, InteropsWithStdFunctionAndMakeCopyable) {
+  int value = 0;
+  fml::closure function = [&value] { value++; };
+  fml::Closure from_function = function;
+  from_function();
+  ASSERT_EQ(value, 1);
+
+  auto moved_capture = std::make_unique<int>(5);
+  fml::Closure from_copyable =
+      fml::MakeCopyable([moved_capture = std::move(moved_capture), &value] {
+        value = *moved_capture;
+      });
+  from_copyable();
+  ASSERT_EQ(value, 5);
+}
+
+}  // namespace testing
+}  // namespace fml
@@ -19,11 +19,14 @@ std::shared_ptr<ConcurrentMessageLoop> ConcurrentMessageLoop::Create(
 
 ConcurrentMessageLoop::ConcurrentMessageLoop(size_t worker_count)
     : worker_count_(std::max<size_t>(worker_count, 1ul)) {
+  for (size_t i = 0; i < worker_count_; ++i) {
+    worker_queues_.emplace_back(std::make_unique<WorkerQueue>());
+  }
   for (size_t i = 0; i < worker_count_; ++i) {
     workers_.emplace_back([i, this]() {
       fml::Thread::SetCurrentThreadName(fml::Thread::ThreadConfig(
           std::string{"io.worker." + std::to_string(i + 1)}));
-      WorkerMain();
+      WorkerMain(i);
     });
   }
 
@@ -47,48 +50,149 @@ std::shared_ptr<ConcurrentTaskRunner> ConcurrentMessageLoop::GetTaskRunner() {
   return std::make_shared<ConcurrentTaskRunner>(weak_from_this());
 }
 
-void ConcurrentMessageLoop::PostTask(const fml::closure& task) {
+std::shared_ptr<ConcurrentTaskRunner>
+ConcurrentMessageLoop::MakeClientTaskRunner() {
+  uint64_t client_id = 0;
+  {
+    std::scoped_lock lock(client_mutex_);
+    client_id = ++next_client_id_;
+  }
+  return std::make_shared<ConcurrentTaskRunner>(weak_from_this(), client_id);
+}
+
+void ConcurrentMessageLoop::PostTask(fml::Closure task) {
   if (!task) {
     return;
   }
 
-  std::unique_lock lock(tasks_mutex_);
+  {
+    std::unique_lock lock(wake_mutex_);
 
-  // Don't just drop tasks on the floor in case of shutdown.
-  if (shutdown_) {
-    FML_DLOG(WARNING)
-        << "Tried to post a task to shutdown concurrent message "
-           "loop. The task will be executed on the callers thread.";
-    lock.unlock();
-    task();
+    // Don't just drop tasks on the floor in case of shutdown.
+    if (shutdown_) {
+      FML_DLOG(WARNING)
+          << "Tried to post a task to shutdown concurrent message "
+             "loop. The task will be executed on the callers thread.";
+      lock.unlock();
+      task();
+      return;
+    }
+  }
+
+  // Distribute posts round-robin over the per-worker deques so that
+  // concurrent producers don't serialize on a single queue lock.
+  const size_t worker_index = next_worker_queue_++ % worker_count_;
+  {
+    std::scoped_lock lock(worker_queues_[worker_index]->mutex);
+    worker_queues_[worker_index]->tasks.push_back(std::move(task));
+  }
+
+  {
+    std::scoped_lock lock(wake_mutex_);
+    ++pending_task_count_;
+  }
+
+  wake_condition_.notify_one();
+}
+
+void ConcurrentMessageLoop::PostClientTask(uint64_t client_id,
+                                           fml::Closure task) {
+  if (!task) {
     return;
   }
 
-  tasks_.push(task);
+  {
+    std::unique_lock lock(wake_mutex_);
 
-  // Unlock the mutex before notifying the condition variable because that mutex
-  // has to be acquired on the other thread anyway. Waiting in this scope till
-  // it is acquired there is a pessimization.
-  lock.unlock();
+    // Don't just drop tasks on the floor in case of shutdown.
+    if (shutdown_) {
+      FML_DLOG(WARNING)
+          << "Tried to post a task to shutdown concurrent message "
+             "loop. The task will be executed on the callers thread.";
+      lock.unlock();
+      task();
+      return;
+    }
+  }
 
-  tasks_condition_.notify_one();
+  {
+    std::scoped_lock lock(client_mutex_);
+    client_queues_[client_id].push_back(std::move(task));
+  }
+
+  {
+    std::scoped_lock lock(wake_mutex_);
+    ++pending_task_count_;
+  }
+
+  wake_condition_.notify_one();
+}
+
+fml::Closure ConcurrentMessageLoop::TakeClientTask() {
+  std::scoped_lock lock(client_mutex_);
+  if (client_queues_.empty()) {
+    return nullptr;
+  }
+  // Serve the first client past the one served last, wrapping around, so
+  // every client with pending work gets a turn before any client gets two.
+  auto found = client_queues_.upper_bound(last_served_client_);
+  if (found == client_queues_.end()) {
+    found = client_queues_.begin();
+  }
+  last_served_client_ = found->first;
+  fml::Closure task = std::move(found->second.front());
+  found->second.pop_front();
+  if (found->second.empty()) {
+    client_queues_.erase(found);
+  }
+  return task;
+}
+
+fml::Closure ConcurrentMessageLoop::TakeTask(size_t worker_index) {
+  // The client fairness queues are drained ahead of the unbound worker
+  // deques.
+  if (fml::Closure client_task = TakeClientTask()) {
+    return client_task;
+  }
+  // Prefer this worker's own deque (popped from the front) for cache locality
+  // and fall back to stealing from the back of the other workers' deques.
+  for (size_t i = 0; i < worker_count_; ++i) {
+    const size_t victim_index = (worker_index + i) % worker_count_;
+    WorkerQueue& queue = *worker_queues_[victim_index];
+    std::scoped_lock lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      continue;
+    }
+    fml::Closure task;
+    if (victim_index == worker_index) {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    } else {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    }
+    return task;
+  }
+  return nullptr;
 }
 
-void ConcurrentMessageLoop::WorkerMain() {
+void ConcurrentMessageLoop::WorkerMain(size_t worker_index) {
   while (true) {
-    std::unique_lock lock(tasks_mutex_);
-    tasks_condition_.wait(lock, [&]() {
-      return !tasks_.empty() || shutdown_ || HasThreadTasksLocked();
+    std::unique_lock lock(wake_mutex_);
+    wake_condition_.wait(lock, [&]() {
+      return pending_task_count_ > 0 || shutdown_ || HasThreadTasksLocked();
     });
 
-    // Shutdown cannot be read with the task mutex unlocked.
+    // Shutdown cannot be read with the wake mutex unlocked.
     bool shutdown_now = shutdown_;
-    fml::closure task;
     std::vector<fml::closure> thread_tasks;
 
-    if (!tasks_.empty()) {
-      task = tasks_.front();
-      tasks_.pop();
+    // Claim one pending task. The claim guarantees that at least one task is
+    // resident in some worker deque for this worker to take.
+    bool task_claimed = false;
+    if (pending_task_count_ > 0) {
+      --pending_task_count_;
+      task_claimed = true;
     }
 
     if (HasThreadTasksLocked()) {
@@ -100,6 +204,17 @@ void ConcurrentMessageLoop::WorkerMain() {
     // themselves try to post more tasks to the message loop.
     lock.unlock();
 
+    fml::Closure task;
+    if (task_claimed) {
+      task = TakeTask(worker_index);
+      if (!task) {
+        // The claimed task was pushed to a deque this worker had already
+        // scanned. Return the claim and rescan on the next wake.
+        std::scoped_lock relock(wake_mutex_);
+        ++pending_task_count_;
+      }
+    }
+
     TRACE_EVENT0("flutter", "ConcurrentWorkerWake");
     // Execute the primary task we woke up for.
     if (task) {
@@ -118,9 +233,9 @@ void ConcurrentMessageLoop::WorkerMain() {
 }
 
 void ConcurrentMessageLoop::Terminate() {
-  std::scoped_lock lock(tasks_mutex_);
+  std::scoped_lock lock(wake_mutex_);
   shutdown_ = true;
-  tasks_condition_.notify_all();
+  wake_condition_.notify_all();
 }
 
 void ConcurrentMessageLoop::PostTaskToAllWorkers(const fml::closure& task) {
@@ -128,11 +243,11 @@ void ConcurrentMessageLoop::PostTaskToAllWorkers(const fml::closure& task) {
     return;
   }
 
-  std::scoped_lock lock(tasks_mutex_);
+  std::scoped_lock lock(wake_mutex_);
   for (const auto& worker_thread_id : worker_thread_ids_) {
     thread_tasks_[worker_thread_id].emplace_back(task);
   }
-  tasks_condition_.notify_all();
+  wake_condition_.notify_all();
 }
 
 bool ConcurrentMessageLoop::HasThreadTasksLocked() const {
@@ -150,17 +265,26 @@ std::vector<fml::closure> ConcurrentMessageLoop::GetThreadTasksLocked() {
 
 ConcurrentTaskRunner::ConcurrentTaskRunner(
     std::weak_ptr<ConcurrentMessageLoop> weak_loop)
-    : weak_loop_(std::move(weak_loop)) {}
+    : weak_loop_(std::move(weak_loop)), client_id_(0) {}
+
+ConcurrentTaskRunner::ConcurrentTaskRunner(
+    std::weak_ptr<ConcurrentMessageLoop> weak_loop,
+    uint64_t client_id)
+    : weak_loop_(std::move(weak_loop)), client_id_(client_id) {}
 
 ConcurrentTaskRunner::~ConcurrentTaskRunner() = default;
 
-void ConcurrentTaskRunner::PostTask(const fml::closure& task) {
+void ConcurrentTaskRunner::PostTask(fml::Closure task) {
   if (!task) {
     return;
   }
 
   if (auto loop = weak_loop_.lock()) {
-    loop->PostTask(task);
+    if (client_id_ != 0) {
+      loop->PostClientTask(client_id_, std::move(task));
+    } else {
+      loop->PostTask(std::move(task));
+    }
     return;
   }
 
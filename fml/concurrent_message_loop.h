@@ -5,9 +5,11 @@
 #ifndef FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 #define FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <map>
-#include <queue>
+#include <memory>
 #include <thread>
 
 #include "flutter/fml/closure.h"
@@ -30,6 +32,12 @@ class ConcurrentMessageLoop
 
   std::shared_ptr<ConcurrentTaskRunner> GetTaskRunner();
 
+  /// Creates a task runner bound to a dedicated fairness queue on this loop.
+  /// Tasks posted through a client runner are drained one-per-client in a
+  /// round-robin ahead of the unbound worker deques, so a client that floods
+  /// the shared pool with work cannot starve the other clients.
+  std::shared_ptr<ConcurrentTaskRunner> MakeClientTaskRunner();
+
   void Terminate();
 
   void PostTaskToAllWorkers(const fml::closure& task);
@@ -37,20 +45,43 @@ class ConcurrentMessageLoop
  private:
   friend ConcurrentTaskRunner;
 
+  /// A per-worker task deque. The owning worker pops from the front while
+  /// workers whose own deques are empty steal from the back, so a burst of
+  /// posts distributes across workers without a shared task queue lock.
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<fml::Closure> tasks;
+  };
+
   size_t worker_count_ = 0;
+  std::vector<std::unique_ptr<WorkerQueue>> worker_queues_;
   std::vector<std::thread> workers_;
-  std::mutex tasks_mutex_;
-  std::condition_variable tasks_condition_;
-  std::queue<fml::closure> tasks_;
+  std::atomic_size_t next_worker_queue_ = {0};
+  // Guards |pending_task_count_|, |thread_tasks_| and |shutdown_|. The
+  // per-worker deques are guarded by their own mutexes.
+  std::mutex wake_mutex_;
+  std::condition_variable wake_condition_;
+  size_t pending_task_count_ = 0;
   std::vector<std::thread::id> worker_thread_ids_;
   std::map<std::thread::id, std::vector<fml::closure>> thread_tasks_;
   bool shutdown_ = false;
+  // Guards the per-client fairness queues and the round-robin cursor.
+  std::mutex client_mutex_;
+  uint64_t next_client_id_ = 0;
+  uint64_t last_served_client_ = 0;
+  std::map<uint64_t, std::deque<fml::Closure>> client_queues_;
 
   explicit ConcurrentMessageLoop(size_t worker_count);
 
-  void WorkerMain();
+  void WorkerMain(size_t worker_index);
+
+  void PostTask(fml::Closure task);
 
-  void PostTask(const fml::closure& task);
+  void PostClientTask(uint64_t client_id, fml::Closure task);
+
+  fml::Closure TakeTask(size_t worker_index);
+
+  fml::Closure TakeClientTask();
 
   bool HasThreadTasksLocked() const;
 
@@ -63,14 +94,21 @@ class ConcurrentTaskRunner : public BasicTaskRunner {
  public:
   explicit ConcurrentTaskRunner(std::weak_ptr<ConcurrentMessageLoop> weak_loop);
 
+  /// A runner bound to one of the loop's client fairness queues. Created via
+  /// `ConcurrentMessageLoop::MakeClientTaskRunner`.
+  ConcurrentTaskRunner(std::weak_ptr<ConcurrentMessageLoop> weak_loop,
+                       uint64_t client_id);
+
   virtual ~ConcurrentTaskRunner();
 
-  void PostTask(const fml::closure& task) override;
+  void PostTask(fml::Closure task) override;
 
  private:
   friend ConcurrentMessageLoop;
 
   std::weak_ptr<ConcurrentMessageLoop> weak_loop_;
+  // Zero for runners that post to the unbound worker deques.
+  const uint64_t client_id_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ConcurrentTaskRunner);
 };
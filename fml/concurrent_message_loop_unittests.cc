@@ -0,0 +1,74 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#define FML_USED_ON_EMBEDDER
+
+#include <mutex>
+#include <vector>
+
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace testing {
+
+TEST(ConcurrentMessageLoop, ClientTaskRunnerExecutesTasks) {
+  auto loop = ConcurrentMessageLoop::Create(4);
+  auto runner = loop->MakeClientTaskRunner();
+
+  constexpr size_t kTaskCount = 100;
+  fml::CountDownLatch latch(kTaskCount);
+  for (size_t i = 0; i < kTaskCount; i++) {
+    runner->PostTask([&latch]() { latch.CountDown(); });
+  }
+  latch.Wait();
+}
+
+TEST(ConcurrentMessageLoop, ClientQueuesAreServedRoundRobin) {
+  // A single worker makes the drain order observable.
+  auto loop = ConcurrentMessageLoop::Create(1);
+  auto client_a = loop->MakeClientTaskRunner();
+  auto client_b = loop->MakeClientTaskRunner();
+
+  // Park the worker so the client queues fill up before anything drains.
+  fml::AutoResetWaitableEvent worker_parked;
+  fml::AutoResetWaitableEvent unblock_worker;
+  loop->GetTaskRunner()->PostTask([&worker_parked, &unblock_worker]() {
+    worker_parked.Signal();
+    unblock_worker.Wait();
+  });
+  worker_parked.Wait();
+
+  std::mutex order_mutex;
+  std::vector<char> order;
+  fml::CountDownLatch done(4);
+  auto record = [&](char tag) {
+    return [&, tag]() {
+      {
+        std::scoped_lock lock(order_mutex);
+        order.push_back(tag);
+      }
+      done.CountDown();
+    };
+  };
+
+  // Client A floods the pool before client B posts a single task.
+  client_a->PostTask(record('a'));
+  client_a->PostTask(record('a'));
+  client_a->PostTask(record('a'));
+  client_b->PostTask(record('b'));
+
+  unblock_worker.Signal();
+  done.Wait();
+
+  // The round-robin gives B its turn after A's first task rather than
+  // making it wait out A's entire backlog.
+  ASSERT_EQ(order.size(), 4u);
+  ASSERT_EQ(order[1], 'b');
+}
+
+}  // namespace testing
+}  // namespace fml
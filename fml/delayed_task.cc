@@ -9,22 +9,28 @@
 namespace fml {
 
 DelayedTask::DelayedTask(size_t order,
-                         const fml::closure& task,
+                         fml::Closure task,
                          fml::TimePoint target_time,
                          fml::TaskSourceGrade task_source_grade)
     : order_(order),
-      task_(task),
+      task_(std::move(task)),
       target_time_(target_time),
       task_source_grade_(task_source_grade) {}
 
 DelayedTask::~DelayedTask() = default;
 
-DelayedTask::DelayedTask(const DelayedTask& other) = default;
+DelayedTask::DelayedTask(DelayedTask&& other) = default;
 
-const fml::closure& DelayedTask::GetTask() const {
+DelayedTask& DelayedTask::operator=(DelayedTask&& other) = default;
+
+const fml::Closure& DelayedTask::GetTask() const {
   return task_;
 }
 
+fml::Closure DelayedTask::TakeTask() {
+  return std::move(task_);
+}
+
 fml::TimePoint DelayedTask::GetTargetTime() const {
   return target_time_;
 }
@@ -8,6 +8,7 @@
 #include <queue>
 
 #include "flutter/fml/closure.h"
+#include "flutter/fml/memory/pool_allocator.h"
 #include "flutter/fml/task_source_grade.h"
 #include "flutter/fml/time/time_point.h"
 
@@ -16,15 +17,21 @@ namespace fml {
 class DelayedTask {
  public:
   DelayedTask(size_t order,
-              const fml::closure& task,
+              fml::Closure task,
               fml::TimePoint target_time,
               fml::TaskSourceGrade task_source_grade);
 
-  DelayedTask(const DelayedTask& other);
+  DelayedTask(DelayedTask&& other);
+
+  DelayedTask& operator=(DelayedTask&& other);
 
   ~DelayedTask();
 
-  const fml::closure& GetTask() const;
+  const fml::Closure& GetTask() const;
+
+  /// Moves the task out of this entry. Used by the dispatcher when handing
+  /// the task to a loop to run; the entry is popped right after.
+  fml::Closure TakeTask();
 
   fml::TimePoint GetTargetTime() const;
 
@@ -34,14 +41,17 @@ class DelayedTask {
 
  private:
   size_t order_;
-  fml::closure task_;
+  fml::Closure task_;
   fml::TimePoint target_time_;
   fml::TaskSourceGrade task_source_grade_;
 };
 
-using DelayedTaskQueue = std::priority_queue<DelayedTask,
-                                             std::deque<DelayedTask>,
-                                             std::greater<DelayedTask>>;
+// The underlying deque recycles its buffers through a per-queue pool so that
+// steady-state task churn does not hit the global allocator.
+using DelayedTaskQueue =
+    std::priority_queue<DelayedTask,
+                        std::deque<DelayedTask, PoolAllocator<DelayedTask>>,
+                        std::greater<DelayedTask>>;
 
 }  // namespace fml
 
@@ -4,9 +4,23 @@
 
 #include "flutter/fml/file.h"
 
+#include "flutter/fml/build_config.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/unique_fd.h"
 
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#endif
+
 namespace fml {
 
 static fml::UniqueFD CreateDirectory(const fml::UniqueFD& base_directory,
@@ -99,6 +113,222 @@ fml::UniqueFD OpenDirectoryReadOnly(const fml::UniqueFD& base_directory,
   return OpenDirectory(base_directory, path, false, FilePermission::kRead);
 }
 
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+
+namespace {
+
+int IoUringSetup(unsigned int entries, struct io_uring_params* params) {
+  return syscall(__NR_io_uring_setup, entries, params);
+}
+
+int IoUringEnter(int ring_fd,
+                 unsigned int to_submit,
+                 unsigned int min_complete,
+                 unsigned int flags) {
+  return syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags,
+                 nullptr, 0);
+}
+
+/// A minimal single-shot io_uring: enough ring to submit a batch of OPENAT
+/// requests and reap their completions, without a liburing dependency. The
+/// ring is created per batch and torn down afterwards; setup is a single
+/// syscall, which is in the noise against the opens it batches.
+class ScopedIoUring {
+ public:
+  explicit ScopedIoUring(unsigned int entries) {
+    std::memset(&params_, 0, sizeof(params_));
+    ring_fd_ = IoUringSetup(entries, &params_);
+    if (ring_fd_ < 0) {
+      return;
+    }
+    sq_ring_size_ = params_.sq_off.array + params_.sq_entries * sizeof(__u32);
+    cq_ring_size_ =
+        params_.cq_off.cqes + params_.cq_entries * sizeof(io_uring_cqe);
+    sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    cq_ring_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+    sqes_size_ = params_.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+    if (sq_ring_ == MAP_FAILED || cq_ring_ == MAP_FAILED ||
+        sqes_ == MAP_FAILED) {
+      Close();
+    }
+  }
+
+  ~ScopedIoUring() { Close(); }
+
+  bool IsValid() const { return ring_fd_ >= 0; }
+
+  unsigned int Entries() const { return params_.sq_entries; }
+
+  /// Queues an OPENAT for |path| relative to |dir_fd| with |user_data| echoed
+  /// back in the matching completion. The caller must not queue more entries
+  /// than \p Entries() before submitting.
+  void QueueOpenAt(int dir_fd, const char* path, uint64_t user_data) {
+    auto* sq_tail = Pointer<std::atomic<unsigned int>>(
+        sq_ring_, params_.sq_off.tail);
+    auto* sq_mask = Pointer<unsigned int>(sq_ring_, params_.sq_off.ring_mask);
+    auto* sq_array = Pointer<__u32>(sq_ring_, params_.sq_off.array);
+
+    const unsigned int tail = sq_tail->load(std::memory_order_relaxed);
+    const unsigned int index = tail & *sq_mask;
+    auto* sqe = &static_cast<io_uring_sqe*>(sqes_)[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_OPENAT;
+    sqe->fd = dir_fd;
+    sqe->addr = reinterpret_cast<uint64_t>(path);
+    sqe->open_flags = O_RDONLY | O_CLOEXEC;
+    sqe->user_data = user_data;
+    sq_array[index] = index;
+    sq_tail->store(tail + 1, std::memory_order_release);
+    queued_++;
+  }
+
+  /// Submits the queued entries, waits for all of their completions and calls
+  /// |completion| with each (user_data, res) pair. Returns false if the
+  /// submission itself failed.
+  bool SubmitAndWait(
+      const std::function<void(uint64_t user_data, int32_t res)>& completion) {
+    unsigned int pending = queued_;
+    queued_ = 0;
+    if (IoUringEnter(ring_fd_, pending, pending, IORING_ENTER_GETEVENTS) < 0) {
+      return false;
+    }
+    auto* cq_head = Pointer<std::atomic<unsigned int>>(
+        cq_ring_, params_.cq_off.head);
+    auto* cq_tail = Pointer<std::atomic<unsigned int>>(
+        cq_ring_, params_.cq_off.tail);
+    auto* cq_mask = Pointer<unsigned int>(cq_ring_, params_.cq_off.ring_mask);
+    auto* cqes = Pointer<io_uring_cqe>(cq_ring_, params_.cq_off.cqes);
+    while (pending > 0) {
+      unsigned int head = cq_head->load(std::memory_order_relaxed);
+      if (head == cq_tail->load(std::memory_order_acquire)) {
+        // Completions can trickle in if the enter call was interrupted.
+        if (IoUringEnter(ring_fd_, 0, pending, IORING_ENTER_GETEVENTS) < 0 &&
+            errno != EINTR) {
+          return false;
+        }
+        continue;
+      }
+      const io_uring_cqe& cqe = cqes[head & *cq_mask];
+      completion(cqe.user_data, cqe.res);
+      cq_head->store(head + 1, std::memory_order_release);
+      pending--;
+    }
+    return true;
+  }
+
+ private:
+  template <typename T>
+  static T* Pointer(void* ring, unsigned int offset) {
+    return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+  }
+
+  void Close() {
+    if (sq_ring_ != MAP_FAILED) {
+      ::munmap(sq_ring_, sq_ring_size_);
+      sq_ring_ = MAP_FAILED;
+    }
+    if (cq_ring_ != MAP_FAILED) {
+      ::munmap(cq_ring_, cq_ring_size_);
+      cq_ring_ = MAP_FAILED;
+    }
+    if (sqes_ != MAP_FAILED) {
+      ::munmap(sqes_, sqes_size_);
+      sqes_ = MAP_FAILED;
+    }
+    if (ring_fd_ >= 0) {
+      ::close(ring_fd_);
+      ring_fd_ = -1;
+    }
+  }
+
+  io_uring_params params_;
+  int ring_fd_ = -1;
+  void* sq_ring_ = MAP_FAILED;
+  void* cq_ring_ = MAP_FAILED;
+  void* sqes_ = MAP_FAILED;
+  size_t sq_ring_size_ = 0;
+  size_t cq_ring_size_ = 0;
+  size_t sqes_size_ = 0;
+  unsigned int queued_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ScopedIoUring);
+};
+
+// Opens the paths as one or more io_uring batches. Returns false when
+// io_uring (or the OPENAT opcode) is unavailable, in which case nothing has
+// been opened and the caller should open sequentially.
+bool OpenFilesReadOnlyWithIoUring(const fml::UniqueFD& base_directory,
+                                  const std::vector<std::string>& paths,
+                                  std::vector<fml::UniqueFD>& descriptors) {
+  // Once the kernel (or the seccomp policy) has refused, don't retry the
+  // setup syscall on every batch.
+  static std::atomic<bool> io_uring_unavailable(false);
+  if (io_uring_unavailable.load(std::memory_order_relaxed)) {
+    return false;
+  }
+
+  ScopedIoUring ring(std::min<size_t>(paths.size(), 128u));
+  if (!ring.IsValid()) {
+    io_uring_unavailable.store(true, std::memory_order_relaxed);
+    return false;
+  }
+
+  bool op_unsupported = false;
+  for (size_t begin = 0; begin < paths.size();) {
+    const size_t count = std::min<size_t>(paths.size() - begin,
+                                          ring.Entries());
+    for (size_t i = 0; i < count; i++) {
+      ring.QueueOpenAt(base_directory.get(), paths[begin + i].c_str(),
+                       begin + i);
+    }
+    const bool submitted =
+        ring.SubmitAndWait([&](uint64_t user_data, int32_t res) {
+          if (res >= 0) {
+            descriptors[user_data].reset(res);
+          } else if (res == -EINVAL) {
+            // Kernel predates IORING_OP_OPENAT (5.6).
+            op_unsupported = true;
+          }
+        });
+    if (!submitted || op_unsupported) {
+      io_uring_unavailable.store(true, std::memory_order_relaxed);
+      for (auto& descriptor : descriptors) {
+        descriptor.reset();
+      }
+      return false;
+    }
+    begin += count;
+  }
+  return true;
+}
+
+}  // namespace
+
+#endif  // defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+
+std::vector<fml::UniqueFD> OpenFilesReadOnly(
+    const fml::UniqueFD& base_directory,
+    const std::vector<std::string>& relative_paths) {
+  std::vector<fml::UniqueFD> descriptors(relative_paths.size());
+  if (relative_paths.empty()) {
+    return descriptors;
+  }
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+  if (OpenFilesReadOnlyWithIoUring(base_directory, relative_paths,
+                                   descriptors)) {
+    return descriptors;
+  }
+#endif
+  for (size_t i = 0; i < relative_paths.size(); i++) {
+    descriptors[i] = OpenFileReadOnly(base_directory, relative_paths[i].c_str());
+  }
+  return descriptors;
+}
+
 bool RemoveFilesInDirectory(const fml::UniqueFD& directory) {
   fml::FileVisitor recursive_cleanup = [&recursive_cleanup](
                                            const fml::UniqueFD& directory,
@@ -47,6 +47,17 @@ fml::UniqueFD OpenFile(const fml::UniqueFD& base_directory,
 fml::UniqueFD OpenFileReadOnly(const fml::UniqueFD& base_directory,
                                const char* path);
 
+/// Opens every path in `relative_paths` read-only, relative to
+/// `base_directory`. The result always has one entry per input path in input
+/// order; the entry for a path that could not be opened is an invalid
+/// descriptor. On Linux and Android the opens are submitted to the kernel as
+/// one io_uring batch when the running kernel supports it, so opening N files
+/// costs a few syscalls instead of N; elsewhere (and when io_uring is
+/// unavailable) the paths are opened sequentially.
+std::vector<fml::UniqueFD> OpenFilesReadOnly(
+    const fml::UniqueFD& base_directory,
+    const std::vector<std::string>& relative_paths);
+
 fml::UniqueFD OpenDirectory(const char* path,
                             bool create_if_necessary,
                             FilePermission permission);
@@ -233,6 +233,32 @@ TEST(FileTest, CanStopVisitEarly) {
   ASSERT_TRUE(fml::UnlinkDirectory(dir.fd(), "a"));
 }
 
+TEST(FileTest, CanOpenFilesInBatch) {
+  fml::ScopedTemporaryDirectory dir;
+
+  for (const auto& name : {"file_a", "file_b", "file_c"}) {
+    auto fd =
+        fml::OpenFile(dir.fd(), name, true, fml::FilePermission::kReadWrite);
+    ASSERT_TRUE(fd.is_valid());
+    ASSERT_TRUE(WriteStringToFile(fd, name));
+  }
+
+  auto descriptors = fml::OpenFilesReadOnly(
+      dir.fd(), {"file_a", "does_not_exist", "file_b", "file_c"});
+  ASSERT_EQ(descriptors.size(), 4u);
+  ASSERT_TRUE(descriptors[0].is_valid());
+  ASSERT_FALSE(descriptors[1].is_valid());
+  ASSERT_TRUE(descriptors[2].is_valid());
+  ASSERT_TRUE(descriptors[3].is_valid());
+  ASSERT_EQ(ReadStringFromFile(descriptors[0]), "file_a");
+  ASSERT_EQ(ReadStringFromFile(descriptors[2]), "file_b");
+  ASSERT_EQ(ReadStringFromFile(descriptors[3]), "file_c");
+
+  for (const auto& name : {"file_a", "file_b", "file_c"}) {
+    ASSERT_TRUE(fml::UnlinkFile(dir.fd(), name));
+  }
+}
+
 TEST(FileTest, AtomicWriteTest) {
   fml::ScopedTemporaryDirectory dir;
 
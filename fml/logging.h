@@ -5,6 +5,8 @@
 #ifndef FLUTTER_FML_LOGGING_H_
 #define FLUTTER_FML_LOGGING_H_
 
+#include <atomic>
+#include <cstdint>
 #include <sstream>
 
 #include "flutter/fml/log_level.h"
@@ -59,20 +61,48 @@ bool ShouldCreateLogMessage(LogSeverity severity);
       : ::fml::LogMessageVoidify() &       \
             ::fml::LogMessage(::fml::LOG_FATAL, 0, 0, nullptr).stream()
 
-#define FML_LOG_IS_ON(severity) \
-  (::fml::ShouldCreateLogMessage(::fml::LOG_##severity))
+// The minimum severity compiled into the binary. Invocations below this
+// level fold to nothing: the level check becomes a constant false, so the
+// message expression is never evaluated and the optimizer removes the call
+// site entirely. Embedders can define FML_MIN_LOG_LEVEL=1 (LOG_WARNING) in
+// release builds to strip INFO and verbose logging from hot paths.
+#ifndef FML_MIN_LOG_LEVEL
+#define FML_MIN_LOG_LEVEL 0
+#endif
+
+static_assert(FML_MIN_LOG_LEVEL <= ::fml::LOG_FATAL,
+              "FML_MIN_LOG_LEVEL must not strip fatal logging.");
+
+#define FML_LOG_IS_ON(severity)                    \
+  (::fml::LOG_##severity >= (FML_MIN_LOG_LEVEL) && \
+   ::fml::ShouldCreateLogMessage(::fml::LOG_##severity))
 
 #define FML_LOG(severity) \
   FML_LAZY_STREAM(FML_LOG_STREAM(severity), FML_LOG_IS_ON(severity))
 
+// Logs on the 1st and every subsequent |n|th invocation of this call site
+// that passes the level check. Intended for diagnostics that sit in
+// per-frame code: the cost is a single relaxed increment when the level is
+// enabled and nothing at all when it is not.
+#define FML_LOG_EVERY_N(severity, n)                                       \
+  FML_LAZY_STREAM(FML_LOG_STREAM(severity),                                \
+                  FML_LOG_IS_ON(severity) && [](uint64_t every_n) {        \
+                    static ::std::atomic<uint64_t> count{0};               \
+                    return count.fetch_add(                                \
+                               1, ::std::memory_order_relaxed) %           \
+                               every_n ==                                  \
+                           0;                                              \
+                  }((n)))
+
 #define FML_CHECK(condition)                                              \
   FML_LAZY_STREAM(                                                        \
       ::fml::LogMessage(::fml::LOG_FATAL, __FILE__, __LINE__, #condition) \
           .stream(),                                                      \
       !(condition))
 
-#define FML_VLOG_IS_ON(verbose_level) \
-  ((verbose_level) <= ::fml::GetVlogVerbosity())
+#define FML_VLOG_IS_ON(verbose_level)        \
+  ((FML_MIN_LOG_LEVEL) <= ::fml::LOG_INFO && \
+   (verbose_level) <= ::fml::GetVlogVerbosity())
 
 // The VLOG macros log with negative verbosities.
 #define FML_VLOG_STREAM(verbose_level) \
@@ -39,6 +39,20 @@ TEST(LoggingTest, UnreachableKillProcessWithMacro) {
   ASSERT_DEATH({ FML_UNREACHABLE(); }, "");
 }
 
+TEST(LoggingTest, LogEveryNEvaluatesMessageOnlyWhenLogging) {
+  int evaluations = 0;
+  auto message = [&evaluations]() {
+    ++evaluations;
+    return "rate limited";
+  };
+  for (int i = 0; i < 10; i++) {
+    FML_LOG_EVERY_N(INFO, 5) << message();
+  }
+  // Only the 1st and 6th iterations log; the message expression must not be
+  // evaluated for the suppressed ones.
+  EXPECT_EQ(evaluations, 2);
+}
+
 #if defined(OS_FUCHSIA)
 
 struct LogPacket {
@@ -9,8 +9,70 @@
 #include <memory>
 #include <sstream>
 
+#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/task_runner.h"
+
 namespace fml {
 
+// Mapping
+
+bool Mapping::AdviseRange(ResidencyHint hint,
+                          size_t offset,
+                          size_t length) const {
+  return false;
+}
+
+void PrefetchMapping(BasicTaskRunner* worker,
+                     std::shared_ptr<const Mapping> mapping,
+                     size_t offset,
+                     size_t length) {
+  if (worker == nullptr || !mapping || mapping->GetMapping() == nullptr ||
+      offset >= mapping->GetSize()) {
+    return;
+  }
+  if (length == 0 || offset + length > mapping->GetSize()) {
+    length = mapping->GetSize() - offset;
+  }
+  worker->PostTask([mapping = std::move(mapping), offset, length]() {
+    // The hint alone may be enough for the OS to start read-ahead; walking
+    // one byte per page guarantees residency even where the hint is a no-op.
+    mapping->Advise(Mapping::ResidencyHint::kWillNeed, offset, length);
+    constexpr size_t kPageSize = 4096;
+    const uint8_t* page = mapping->GetMapping() + offset;
+    const uint8_t* end = page + length;
+    for (; page < end; page += kPageSize) {
+      [[maybe_unused]] volatile uint8_t byte = *page;
+    }
+  });
+}
+
+void CreateFileMappingsAsync(BasicTaskRunner* worker,
+                             const fml::UniqueFD& base_directory,
+                             std::vector<std::string> relative_paths,
+                             FileMappingsCallback callback) {
+  FML_DCHECK(worker != nullptr);
+  FML_DCHECK(callback != nullptr);
+  // The caller's descriptor may be gone by the time the task runs.
+  fml::UniqueFD directory = fml::Duplicate(base_directory.get());
+  worker->PostTask(fml::MakeCopyable(
+      [directory = std::move(directory), paths = std::move(relative_paths),
+       callback = std::move(callback)]() mutable {
+        std::vector<std::unique_ptr<FileMapping>> mappings;
+        mappings.reserve(paths.size());
+        for (const auto& descriptor : OpenFilesReadOnly(directory, paths)) {
+          std::unique_ptr<FileMapping> mapping;
+          if (descriptor.is_valid()) {
+            mapping = std::make_unique<FileMapping>(descriptor);
+            if (!mapping->IsValid()) {
+              mapping = nullptr;
+            }
+          }
+          mappings.push_back(std::move(mapping));
+        }
+        callback(std::move(mappings));
+      }));
+}
+
 // FileMapping
 
 uint8_t* FileMapping::GetMutableMapping() {
@@ -18,6 +18,8 @@
 
 namespace fml {
 
+class BasicTaskRunner;
+
 class Mapping {
  public:
   Mapping();
@@ -32,10 +34,65 @@ class Mapping {
   // Generally true for file-mapped memory and false for anonymous memory.
   virtual bool IsDontNeedSafe() const = 0;
 
+  /// madvise-style residency hints for the pages backing a mapping.
+  enum class ResidencyHint {
+    /// The range will be needed soon; the OS may read it ahead.
+    kWillNeed,
+    /// The range will be read once from start to end; aggressive read-ahead
+    /// and early page reclaim are appropriate.
+    kSequential,
+    /// The range is not needed for the foreseeable future and its pages may
+    /// be reclaimed. Only honored when \p IsDontNeedSafe returns true.
+    kDontNeed,
+  };
+
+  /// Advises the OS of the expected paging behavior of the byte range
+  /// [offset, offset + length) of the mapping. A zero \p length covers the
+  /// remainder of the mapping. Returns \p true if the hint was applied.
+  /// Mappings that are not backed by the pager (e.g. heap-backed data) ignore
+  /// hints.
+  bool Advise(ResidencyHint hint, size_t offset = 0, size_t length = 0) const {
+    return AdviseRange(hint, offset, length);
+  }
+
+ protected:
+  /// The backend for \p Advise. The base implementation is a no-op that
+  /// returns \p false.
+  virtual bool AdviseRange(ResidencyHint hint,
+                           size_t offset,
+                           size_t length) const;
+
  private:
   FML_DISALLOW_COPY_AND_ASSIGN(Mapping);
 };
 
+/// Asynchronously warms the byte range [offset, offset + length) of a mapping
+/// by applying \p Mapping::ResidencyHint::kWillNeed and touching one byte per
+/// page on \p worker (typically a \p fml::ConcurrentTaskRunner), so that the
+/// first real use of the mapping does not stall on page faults. A zero
+/// \p length covers the remainder of the mapping. The mapping is kept alive
+/// by the posted task until the walk completes.
+void PrefetchMapping(BasicTaskRunner* worker,
+                     std::shared_ptr<const Mapping> mapping,
+                     size_t offset = 0,
+                     size_t length = 0);
+
+class FileMapping;
+
+using FileMappingsCallback =
+    std::function<void(std::vector<std::unique_ptr<FileMapping>>)>;
+
+/// Asynchronously opens and maps every path in \p relative_paths (relative to
+/// \p base_directory, which is duplicated for the posted task) on \p worker
+/// and invokes \p callback on the worker thread with one entry per path, null
+/// for paths that could not be opened or mapped. The opens go through
+/// \p fml::OpenFilesReadOnly, so on kernels with io_uring a batch of N assets
+/// costs a few syscalls instead of N sequential opens on the calling thread.
+void CreateFileMappingsAsync(BasicTaskRunner* worker,
+                             const fml::UniqueFD& base_directory,
+                             std::vector<std::string> relative_paths,
+                             FileMappingsCallback callback);
+
 class FileMapping final : public Mapping {
  public:
   enum class Protection {
@@ -76,6 +133,12 @@ class FileMapping final : public Mapping {
 
   bool IsValid() const;
 
+ protected:
+  // |Mapping|
+  bool AdviseRange(ResidencyHint hint,
+                   size_t offset,
+                   size_t length) const override;
+
  private:
   bool valid_ = false;
   size_t size_ = 0;
@@ -67,4 +67,32 @@ TEST(MallocMapping, CopySizeZero) {
   ASSERT_EQ(0u, mapping.GetSize());
 }
 
+TEST(MallocMapping, AdviseIsANoOp) {
+  size_t length = 10;
+  MallocMapping mapping(reinterpret_cast<uint8_t*>(malloc(length)), length);
+  // Heap-backed mappings are not backed by the pager and ignore hints.
+  ASSERT_FALSE(mapping.Advise(Mapping::ResidencyHint::kWillNeed));
+  ASSERT_FALSE(mapping.Advise(Mapping::ResidencyHint::kDontNeed));
+}
+
+#if !FML_OS_WIN
+TEST(FileMapping, AdviseResidencyHints) {
+  fml::ScopedTemporaryDirectory dir;
+  auto fd = fml::OpenFile(dir.fd(), "advisable", true,
+                          fml::FilePermission::kReadWrite);
+  ASSERT_TRUE(fd.is_valid());
+  ASSERT_TRUE(fml::TruncateFile(fd, 4096 * 4));
+
+  FileMapping mapping(fd);
+  ASSERT_NE(nullptr, mapping.GetMapping());
+  ASSERT_TRUE(mapping.Advise(Mapping::ResidencyHint::kWillNeed));
+  ASSERT_TRUE(mapping.Advise(Mapping::ResidencyHint::kSequential));
+  // An unaligned sub-range is aligned down to a page boundary internally.
+  ASSERT_TRUE(mapping.Advise(Mapping::ResidencyHint::kWillNeed, 100, 4096));
+  // Out-of-bounds ranges are rejected.
+  ASSERT_FALSE(
+      mapping.Advise(Mapping::ResidencyHint::kWillNeed, mapping.GetSize(), 1));
+}
+#endif  // !FML_OS_WIN
+
 }  // namespace fml
@@ -0,0 +1,107 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_MEMORY_POOL_ALLOCATOR_H_
+#define FLUTTER_FML_MEMORY_POOL_ALLOCATOR_H_
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace fml {
+
+namespace internal {
+
+// The backing store shared by all rebound copies of a PoolAllocator.
+// Deallocated blocks are parked on per-size free lists and recycled by later
+// allocations of the same size instead of going back to the global allocator.
+class PoolAllocatorState {
+ public:
+  PoolAllocatorState() = default;
+
+  ~PoolAllocatorState() {
+    for (auto& [size, blocks] : free_lists_) {
+      for (void* block : blocks) {
+        ::operator delete(block);
+      }
+    }
+  }
+
+  void* Allocate(size_t size) {
+    auto found = free_lists_.find(size);
+    if (found != free_lists_.end() && !found->second.empty()) {
+      void* block = found->second.back();
+      found->second.pop_back();
+      return block;
+    }
+    return ::operator new(size);
+  }
+
+  void Deallocate(void* block, size_t size) {
+    free_lists_[size].push_back(block);
+  }
+
+ private:
+  std::map<size_t, std::vector<void*>> free_lists_;
+
+  PoolAllocatorState(const PoolAllocatorState&) = delete;
+  PoolAllocatorState& operator=(const PoolAllocatorState&) = delete;
+};
+
+}  // namespace internal
+
+/// A std-compatible allocator that recycles freed blocks on per-size free
+/// lists instead of returning them to the global allocator. Intended for
+/// containers with steady-state churn (e.g. the per-queue task heaps in
+/// \p fml::MessageLoopTaskQueues) where buffers of the same size are released
+/// and re-requested thousands of times per second.
+///
+/// Copies and rebound copies of an allocator share one pool, as required for
+/// container internals. The pool itself is not thread safe; it inherits
+/// whatever external synchronization guards the owning container.
+template <typename T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+
+  PoolAllocator() : state_(std::make_shared<internal::PoolAllocatorState>()) {}
+
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U>& other)  // NOLINT(google-explicit-constructor)
+      : state_(other.state()) {}
+
+  PoolAllocator(const PoolAllocator&) = default;
+  PoolAllocator& operator=(const PoolAllocator&) = default;
+
+  T* allocate(size_t count) {
+    return static_cast<T*>(state_->Allocate(count * sizeof(T)));
+  }
+
+  void deallocate(T* block, size_t count) {
+    state_->Deallocate(block, count * sizeof(T));
+  }
+
+  const std::shared_ptr<internal::PoolAllocatorState>& state() const {
+    return state_;
+  }
+
+ private:
+  std::shared_ptr<internal::PoolAllocatorState> state_;
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T>& lhs, const PoolAllocator<U>& rhs) {
+  return lhs.state() == rhs.state();
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T>& lhs, const PoolAllocator<U>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_MEMORY_POOL_ALLOCATOR_H_
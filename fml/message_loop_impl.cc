@@ -7,6 +7,7 @@
 #include "flutter/fml/message_loop_impl.h"
 
 #include <algorithm>
+#include <iterator>
 #include <vector>
 
 #include "flutter/fml/build_config.h"
@@ -53,15 +54,32 @@ MessageLoopImpl::~MessageLoopImpl() {
   task_queue_->Dispose(queue_id_);
 }
 
-void MessageLoopImpl::PostTask(const fml::closure& task,
-                               fml::TimePoint target_time) {
-  FML_DCHECK(task != nullptr);
+void MessageLoopImpl::PostTask(fml::Closure task,
+                               fml::TimePoint target_time,
+                               fml::TaskSourceGrade task_source_grade) {
+  FML_DCHECK(task);
   if (terminated_) {
     // If the message loop has already been terminated, PostTask should destruct
     // |task| synchronously within this function.
     return;
   }
-  task_queue_->RegisterTask(queue_id_, task, target_time);
+  task_queue_->RegisterTask(queue_id_, std::move(task), target_time,
+                            task_source_grade);
+}
+
+void MessageLoopImpl::PostTasks(std::vector<fml::Closure> tasks,
+                                fml::TimePoint target_time) {
+#ifndef NDEBUG
+  for (const auto& task : tasks) {
+    FML_DCHECK(task);
+  }
+#endif
+  if (terminated_) {
+    // If the message loop has already been terminated, PostTasks should
+    // destruct the |tasks| synchronously within this function.
+    return;
+  }
+  task_queue_->RegisterTasks(queue_id_, std::move(tasks), target_time);
 }
 
 void MessageLoopImpl::AddTaskObserver(intptr_t key,
@@ -117,22 +135,51 @@ void MessageLoopImpl::DoTerminate() {
 
 void MessageLoopImpl::FlushTasks(FlushType type) {
   const auto now = fml::TimePoint::Now();
-  fml::closure invocation;
-  do {
-    invocation = task_queue_->GetNextTaskToRun(queue_id_, now);
+
+  if (type == FlushType::kSingle) {
+    fml::Closure invocation = task_queue_->GetNextTaskToRun(queue_id_, now);
     if (!invocation) {
-      break;
+      return;
     }
     invocation();
-    std::vector<fml::closure> observers =
-        task_queue_->GetObserversToNotify(queue_id_);
-    for (const auto& observer : observers) {
+    for (const auto& observer : task_queue_->GetObserversToNotify(queue_id_)) {
       observer();
     }
-    if (type == FlushType::kSingle) {
-      break;
+    return;
+  }
+
+  // Swap the entire ready batch out under one lock acquisition and run it
+  // locally. The outer loop picks up tasks that the batch itself posted with
+  // target times at or before |now|, matching the one-at-a-time drain.
+  while (true) {
+    const uint32_t topology_version = task_queue_->GetMergeTopologyVersion();
+    std::vector<fml::Closure> invocations =
+        task_queue_->TakeExpiredTasksToRun(queue_id_, now);
+    if (invocations.empty()) {
+      return;
+    }
+    for (size_t i = 0; i < invocations.size(); i++) {
+      invocations[i]();
+      for (const auto& observer :
+           task_queue_->GetObserversToNotify(queue_id_)) {
+        observer();
+      }
+      if (i + 1 < invocations.size() &&
+          task_queue_->GetMergeTopologyVersion() != topology_version) {
+        // The task merged or unmerged queues, so the rest of the batch may
+        // belong to another thread now. Hand it back to the dispatcher, which
+        // routes it through the new topology; if this queue was subsumed the
+        // owning loop picks the tasks up, otherwise the outer loop re-takes
+        // them here.
+        task_queue_->RegisterTasks(
+            queue_id_,
+            {std::make_move_iterator(invocations.begin() + i + 1),
+             std::make_move_iterator(invocations.end())},
+            now);
+        break;
+      }
     }
-  } while (invocation);
+  }
 }
 
 void MessageLoopImpl::RunExpiredTasksNow() {
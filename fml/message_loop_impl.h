@@ -39,7 +39,13 @@ class MessageLoopImpl : public Wakeable,
 
   virtual void Terminate() = 0;
 
-  void PostTask(const fml::closure& task, fml::TimePoint target_time);
+  void PostTask(fml::Closure task,
+                fml::TimePoint target_time,
+                fml::TaskSourceGrade task_source_grade =
+                    fml::TaskSourceGrade::kUnspecified);
+
+  void PostTasks(std::vector<fml::Closure> tasks,
+                 fml::TimePoint target_time);
 
   void AddTaskObserver(intptr_t key, const fml::closure& callback);
 
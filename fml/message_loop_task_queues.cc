@@ -21,6 +21,28 @@ const size_t TaskQueueId::kUnmerged = ULONG_MAX;
 
 namespace {
 
+std::atomic<bool> gTaskQueueMetricsEnabled(false);
+
+// Maps a latency onto its power-of-two microsecond bucket, clamping both
+// tails into the first and last buckets.
+size_t LatencyBucketIndex(fml::TimeDelta latency) {
+  int64_t micros = latency.ToMicroseconds();
+  size_t index = 0;
+  while (micros > 1 && index < TaskQueueMetrics::kLatencyBucketCount - 1) {
+    micros >>= 1;
+    index++;
+  }
+  return index;
+}
+
+// Lock-free maximum update for the queue depth high-water mark.
+void UpdateHighWatermark(std::atomic<size_t>& high_watermark, size_t depth) {
+  size_t current = high_watermark.load(std::memory_order_relaxed);
+  while (depth > current && !high_watermark.compare_exchange_weak(
+                                current, depth, std::memory_order_relaxed)) {
+  }
+}
+
 // iOS prior to version 9 prevents c++11 thread_local and __thread specifier,
 // having us resort to boxed enum containers.
 class TaskSourceGradeHolder {
@@ -42,21 +64,88 @@ TaskQueueEntry::TaskQueueEntry(TaskQueueId created_for_arg)
   task_source = std::make_unique<TaskSource>(created_for);
 }
 
+void TaskQueueEntry::Recycle(TaskQueueId created_for_arg) {
+  FML_DCHECK(owner_of.empty());
+  wakeable = nullptr;
+  task_observers.clear();
+  subsumed_by = _kUnmerged;
+  created_for = created_for_arg;
+  task_source = std::make_unique<TaskSource>(created_for_arg);
+  wake_up_slack = fml::TimeDelta::Zero();
+  wake_armed = false;
+  metrics_counters.Reset();
+}
+
+void TaskQueueEntry::MetricsCounters::Reset() {
+  depth_high_watermark.store(0, std::memory_order_relaxed);
+  wake_up_count.store(0, std::memory_order_relaxed);
+  tasks_run_count.store(0, std::memory_order_relaxed);
+  for (auto& bucket : latency_buckets) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+}
+
+// Locks the per-queue mutexes of every queue in the merge group that contains
+// |queue_id|, in ascending TaskQueueId order to avoid lock inversion. The
+// caller must hold |entries_mutex_| (shared or exclusive) for the lifetime of
+// the runner so the merge topology cannot change while the group is locked.
+class MessageLoopTaskQueues::MergedQueuesRunner {
+ public:
+  MergedQueuesRunner(const MessageLoopTaskQueues& task_queues,
+                     TaskQueueId queue_id)
+      : entries_(task_queues.queue_entries_) {
+    TaskQueueId owner = queue_id;
+    const auto& entry = entries_.at(queue_id);
+    if (entry->subsumed_by != _kUnmerged) {
+      owner = entry->subsumed_by;
+    }
+    queue_ids_.push_back(owner);
+    for (const TaskQueueId& subsumed : entries_.at(owner)->owner_of) {
+      queue_ids_.push_back(subsumed);
+    }
+    std::sort(queue_ids_.begin(), queue_ids_.end());
+    for (const TaskQueueId& id : queue_ids_) {
+      entries_.at(id)->queue_mutex.lock();
+    }
+  }
+
+  ~MergedQueuesRunner() {
+    for (auto it = queue_ids_.rbegin(); it != queue_ids_.rend(); ++it) {
+      entries_.at(*it)->queue_mutex.unlock();
+    }
+  }
+
+ private:
+  const std::map<TaskQueueId, std::unique_ptr<TaskQueueEntry>>& entries_;
+  std::vector<TaskQueueId> queue_ids_;
+
+  FML_DISALLOW_COPY_ASSIGN_AND_MOVE(MergedQueuesRunner);
+};
+
 MessageLoopTaskQueues* MessageLoopTaskQueues::GetInstance() {
   static MessageLoopTaskQueues* instance = new MessageLoopTaskQueues;
   return instance;
 }
 
 TaskQueueId MessageLoopTaskQueues::CreateTaskQueue() {
-  std::lock_guard guard(queue_mutex_);
+  fml::UniqueLock lock(*entries_mutex_);
   TaskQueueId loop_id = TaskQueueId(task_queue_id_counter_);
   ++task_queue_id_counter_;
-  queue_entries_[loop_id] = std::make_unique<TaskQueueEntry>(loop_id);
+  if (!recycled_queue_entries_.empty()) {
+    auto entry = std::move(recycled_queue_entries_.back());
+    recycled_queue_entries_.pop_back();
+    entry->Recycle(loop_id);
+    queue_entries_[loop_id] = std::move(entry);
+  } else {
+    queue_entries_[loop_id] = std::make_unique<TaskQueueEntry>(loop_id);
+  }
   return loop_id;
 }
 
 MessageLoopTaskQueues::MessageLoopTaskQueues()
-    : task_queue_id_counter_(0), order_(0) {
+    : entries_mutex_(fml::SharedMutex::Create()),
+      task_queue_id_counter_(0),
+      order_(0) {
   tls_task_source_grade.reset(
       new TaskSourceGradeHolder{TaskSourceGrade::kUnspecified});
 }
@@ -64,19 +153,33 @@ MessageLoopTaskQueues::MessageLoopTaskQueues()
 MessageLoopTaskQueues::~MessageLoopTaskQueues() = default;
 
 void MessageLoopTaskQueues::Dispose(TaskQueueId queue_id) {
-  std::lock_guard guard(queue_mutex_);
+  fml::UniqueLock lock(*entries_mutex_);
   const auto& queue_entry = queue_entries_.at(queue_id);
   FML_DCHECK(queue_entry->subsumed_by == _kUnmerged);
   auto& subsumed_set = queue_entry->owner_of;
   for (auto& subsumed : subsumed_set) {
-    queue_entries_.erase(subsumed);
+    auto found = queue_entries_.find(subsumed);
+    RecycleEntryUnlocked(found->second);
+    queue_entries_.erase(found);
   }
   // Erase owner queue_id at last to avoid &subsumed_set from being invalid
-  queue_entries_.erase(queue_id);
+  auto found = queue_entries_.find(queue_id);
+  RecycleEntryUnlocked(found->second);
+  queue_entries_.erase(found);
+}
+
+// Parks a disposed entry on the recycle list for reuse by CreateTaskQueue.
+// The task source is dropped eagerly so that any pending task closures are
+// destructed at disposal time rather than at reuse time.
+void MessageLoopTaskQueues::RecycleEntryUnlocked(
+    std::unique_ptr<TaskQueueEntry>& entry) {
+  entry->owner_of.clear();
+  entry->task_source.reset();
+  recycled_queue_entries_.push_back(std::move(entry));
 }
 
 void MessageLoopTaskQueues::DisposeTasks(TaskQueueId queue_id) {
-  std::lock_guard guard(queue_mutex_);
+  fml::UniqueLock lock(*entries_mutex_);
   const auto& queue_entry = queue_entries_.at(queue_id);
   FML_DCHECK(queue_entry->subsumed_by == _kUnmerged);
   auto& subsumed_set = queue_entry->owner_of;
@@ -92,14 +195,50 @@ TaskSourceGrade MessageLoopTaskQueues::GetCurrentTaskSourceGrade() {
 
 void MessageLoopTaskQueues::RegisterTask(
     TaskQueueId queue_id,
-    const fml::closure& task,
+    fml::Closure task,
     fml::TimePoint target_time,
     fml::TaskSourceGrade task_source_grade) {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*entries_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
   size_t order = order_++;
   const auto& queue_entry = queue_entries_.at(queue_id);
   queue_entry->task_source->RegisterTask(
-      {order, task, target_time, task_source_grade});
+      {order, std::move(task), target_time, task_source_grade});
+  if (gTaskQueueMetricsEnabled.load(std::memory_order_relaxed)) {
+    UpdateHighWatermark(queue_entry->metrics_counters.depth_high_watermark,
+                        queue_entry->task_source->GetNumPendingTasks());
+  }
+  TaskQueueId loop_to_wake = queue_id;
+  if (queue_entry->subsumed_by != _kUnmerged) {
+    loop_to_wake = queue_entry->subsumed_by;
+  }
+
+  // This can happen when the secondary tasks are paused.
+  if (HasPendingTasksUnlocked(loop_to_wake)) {
+    WakeUpUnlocked(loop_to_wake, GetNextWakeTimeUnlocked(loop_to_wake));
+  }
+}
+
+void MessageLoopTaskQueues::RegisterTasks(
+    TaskQueueId queue_id,
+    std::vector<fml::Closure> tasks,
+    fml::TimePoint target_time,
+    fml::TaskSourceGrade task_source_grade) {
+  if (tasks.empty()) {
+    return;
+  }
+  fml::SharedLock lock(*entries_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  for (auto& task : tasks) {
+    size_t order = order_++;
+    queue_entry->task_source->RegisterTask(
+        {order, std::move(task), target_time, task_source_grade});
+  }
+  if (gTaskQueueMetricsEnabled.load(std::memory_order_relaxed)) {
+    UpdateHighWatermark(queue_entry->metrics_counters.depth_high_watermark,
+                        queue_entry->task_source->GetNumPendingTasks());
+  }
   TaskQueueId loop_to_wake = queue_id;
   if (queue_entry->subsumed_by != _kUnmerged) {
     loop_to_wake = queue_entry->subsumed_by;
@@ -112,17 +251,23 @@ void MessageLoopTaskQueues::RegisterTask(
 }
 
 bool MessageLoopTaskQueues::HasPendingTasks(TaskQueueId queue_id) const {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*entries_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
   return HasPendingTasksUnlocked(queue_id);
 }
 
-fml::closure MessageLoopTaskQueues::GetNextTaskToRun(TaskQueueId queue_id,
+fml::Closure MessageLoopTaskQueues::GetNextTaskToRun(TaskQueueId queue_id,
                                                      fml::TimePoint from_time) {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*entries_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
   if (!HasPendingTasksUnlocked(queue_id)) {
     return nullptr;
   }
-  TaskSource::TopTask top = PeekNextTaskUnlocked(queue_id);
+  TaskSource::TopTask top = PeekNextTaskUnlocked(queue_id, from_time);
+
+  // The loop is awake and draining: any previously armed wake is stale, so
+  // re-arm unconditionally below.
+  queue_entries_.at(queue_id)->wake_armed = false;
 
   if (!HasPendingTasksUnlocked(queue_id)) {
     WakeUpUnlocked(queue_id, fml::TimePoint::Max());
@@ -133,23 +278,98 @@ fml::closure MessageLoopTaskQueues::GetNextTaskToRun(TaskQueueId queue_id,
   if (top.task.GetTargetTime() > from_time) {
     return nullptr;
   }
-  fml::closure invocation = top.task.GetTask();
+  // The task heaps order entries by target time, order and grade only, so
+  // moving the task out from under the const top reference cannot disturb
+  // the heap invariant. The entry is popped right after.
+  fml::Closure invocation = const_cast<DelayedTask&>(top.task).TakeTask();
   queue_entries_.at(top.task_queue_id)
       ->task_source->PopTask(top.task.GetTaskSourceGrade());
+  if (gTaskQueueMetricsEnabled.load(std::memory_order_relaxed)) {
+    RecordTaskRunMetricsUnlocked(top.task_queue_id,
+                                 from_time - top.task.GetTargetTime());
+  }
   const auto task_source_grade = top.task.GetTaskSourceGrade();
   tls_task_source_grade.reset(new TaskSourceGradeHolder{task_source_grade});
   return invocation;
 }
 
+std::vector<fml::Closure> MessageLoopTaskQueues::TakeExpiredTasksToRun(
+    TaskQueueId queue_id,
+    fml::TimePoint from_time) {
+  fml::SharedLock lock(*entries_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
+  std::vector<fml::Closure> invocations;
+
+  while (HasPendingTasksUnlocked(queue_id)) {
+    TaskSource::TopTask top = PeekNextTaskUnlocked(queue_id, from_time);
+    if (top.task.GetTargetTime() > from_time) {
+      break;
+    }
+    // The task source grade is thread local state: restore it immediately
+    // before each invocation runs, exactly as GetNextTaskToRun does when
+    // handing tasks out one at a time. Moving the task out from under the
+    // const top reference is safe because the heaps order entries by target
+    // time, order and grade only; the entry is popped right below.
+    invocations.push_back(
+        [invocation = const_cast<DelayedTask&>(top.task).TakeTask(),
+         task_source_grade = top.task.GetTaskSourceGrade()]() {
+          tls_task_source_grade.reset(
+              new TaskSourceGradeHolder{task_source_grade});
+          invocation();
+        });
+    queue_entries_.at(top.task_queue_id)
+        ->task_source->PopTask(top.task.GetTaskSourceGrade());
+    if (gTaskQueueMetricsEnabled.load(std::memory_order_relaxed)) {
+      RecordTaskRunMetricsUnlocked(top.task_queue_id,
+                                   from_time - top.task.GetTargetTime());
+    }
+  }
+
+  // The loop is awake and draining: any previously armed wake is stale, so
+  // re-arm unconditionally.
+  queue_entries_.at(queue_id)->wake_armed = false;
+  if (HasPendingTasksUnlocked(queue_id)) {
+    WakeUpUnlocked(queue_id, GetNextWakeTimeUnlocked(queue_id));
+  } else {
+    WakeUpUnlocked(queue_id, fml::TimePoint::Max());
+  }
+
+  return invocations;
+}
+
 void MessageLoopTaskQueues::WakeUpUnlocked(TaskQueueId queue_id,
                                            fml::TimePoint time) const {
-  if (queue_entries_.at(queue_id)->wakeable) {
-    queue_entries_.at(queue_id)->wakeable->WakeUp(time);
+  const auto& entry = queue_entries_.at(queue_id);
+  if (!entry->wakeable) {
+    return;
+  }
+  if (time == fml::TimePoint::Max()) {
+    entry->wake_armed = false;
+    entry->wakeable->WakeUp(time);
+    return;
   }
+  // Coalesce: while a wake is armed at |armed_wake_time|, requests at or after
+  // |armed_wake_time - wake_up_slack| are elided. The armed timer fires at
+  // most |wake_up_slack| after the requested time, and the drain re-arms
+  // (see GetNextTaskToRun and TakeExpiredTasksToRun), so no wake is ever
+  // lost. Queues that have not opted into a slack window get a wake per
+  // request.
+  if (entry->wake_up_slack > fml::TimeDelta::Zero() && entry->wake_armed &&
+      time >= entry->armed_wake_time - entry->wake_up_slack) {
+    return;
+  }
+  entry->wake_armed = true;
+  entry->armed_wake_time = time;
+  if (gTaskQueueMetricsEnabled.load(std::memory_order_relaxed)) {
+    entry->metrics_counters.wake_up_count.fetch_add(1,
+                                                    std::memory_order_relaxed);
+  }
+  entry->wakeable->WakeUp(time);
 }
 
 size_t MessageLoopTaskQueues::GetNumPendingTasks(TaskQueueId queue_id) const {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*entries_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
   const auto& queue_entry = queue_entries_.at(queue_id);
   if (queue_entry->subsumed_by != _kUnmerged) {
     return 0;
@@ -169,20 +389,25 @@ size_t MessageLoopTaskQueues::GetNumPendingTasks(TaskQueueId queue_id) const {
 void MessageLoopTaskQueues::AddTaskObserver(TaskQueueId queue_id,
                                             intptr_t key,
                                             const fml::closure& callback) {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*entries_mutex_);
   FML_DCHECK(callback != nullptr) << "Observer callback must be non-null.";
-  queue_entries_.at(queue_id)->task_observers[key] = callback;
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  std::lock_guard guard(queue_entry->queue_mutex);
+  queue_entry->task_observers[key] = callback;
 }
 
 void MessageLoopTaskQueues::RemoveTaskObserver(TaskQueueId queue_id,
                                                intptr_t key) {
-  std::lock_guard guard(queue_mutex_);
-  queue_entries_.at(queue_id)->task_observers.erase(key);
+  fml::SharedLock lock(*entries_mutex_);
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  std::lock_guard guard(queue_entry->queue_mutex);
+  queue_entry->task_observers.erase(key);
 }
 
 std::vector<fml::closure> MessageLoopTaskQueues::GetObserversToNotify(
     TaskQueueId queue_id) const {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*entries_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
   std::vector<fml::closure> observers;
 
   if (queue_entries_.at(queue_id)->subsumed_by != _kUnmerged) {
@@ -205,17 +430,27 @@ std::vector<fml::closure> MessageLoopTaskQueues::GetObserversToNotify(
 
 void MessageLoopTaskQueues::SetWakeable(TaskQueueId queue_id,
                                         fml::Wakeable* wakeable) {
-  std::lock_guard guard(queue_mutex_);
-  FML_CHECK(!queue_entries_.at(queue_id)->wakeable)
-      << "Wakeable can only be set once.";
-  queue_entries_.at(queue_id)->wakeable = wakeable;
+  fml::SharedLock lock(*entries_mutex_);
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  std::lock_guard guard(queue_entry->queue_mutex);
+  FML_CHECK(!queue_entry->wakeable) << "Wakeable can only be set once.";
+  queue_entry->wakeable = wakeable;
+}
+
+void MessageLoopTaskQueues::SetWakeUpSlack(TaskQueueId queue_id,
+                                           fml::TimeDelta slack) {
+  fml::SharedLock lock(*entries_mutex_);
+  FML_DCHECK(slack >= fml::TimeDelta::Zero());
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  std::lock_guard guard(queue_entry->queue_mutex);
+  queue_entry->wake_up_slack = slack;
 }
 
 bool MessageLoopTaskQueues::Merge(TaskQueueId owner, TaskQueueId subsumed) {
   if (owner == subsumed) {
     return true;
   }
-  std::lock_guard guard(queue_mutex_);
+  fml::UniqueLock lock(*entries_mutex_);
   auto& owner_entry = queue_entries_.at(owner);
   auto& subsumed_entry = queue_entries_.at(subsumed);
   auto& subsumed_set = owner_entry->owner_of;
@@ -254,6 +489,7 @@ bool MessageLoopTaskQueues::Merge(TaskQueueId owner, TaskQueueId subsumed) {
   // All checking is OK, set merged state.
   owner_entry->owner_of.insert(subsumed);
   subsumed_entry->subsumed_by = owner;
+  merge_topology_version_.fetch_add(1, std::memory_order_relaxed);
 
   if (HasPendingTasksUnlocked(owner)) {
     WakeUpUnlocked(owner, GetNextWakeTimeUnlocked(owner));
@@ -263,7 +499,7 @@ bool MessageLoopTaskQueues::Merge(TaskQueueId owner, TaskQueueId subsumed) {
 }
 
 bool MessageLoopTaskQueues::Unmerge(TaskQueueId owner, TaskQueueId subsumed) {
-  std::lock_guard guard(queue_mutex_);
+  fml::UniqueLock lock(*entries_mutex_);
   const auto& owner_entry = queue_entries_.at(owner);
   if (owner_entry->owner_of.empty()) {
     FML_LOG(WARNING)
@@ -293,6 +529,7 @@ bool MessageLoopTaskQueues::Unmerge(TaskQueueId owner, TaskQueueId subsumed) {
 
   queue_entries_.at(subsumed)->subsumed_by = _kUnmerged;
   owner_entry->owner_of.erase(subsumed);
+  merge_topology_version_.fetch_add(1, std::memory_order_relaxed);
 
   if (HasPendingTasksUnlocked(owner)) {
     WakeUpUnlocked(owner, GetNextWakeTimeUnlocked(owner));
@@ -307,7 +544,7 @@ bool MessageLoopTaskQueues::Unmerge(TaskQueueId owner, TaskQueueId subsumed) {
 
 bool MessageLoopTaskQueues::Owns(TaskQueueId owner,
                                  TaskQueueId subsumed) const {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*entries_mutex_);
   if (owner == _kUnmerged || subsumed == _kUnmerged) {
     return false;
   }
@@ -317,17 +554,56 @@ bool MessageLoopTaskQueues::Owns(TaskQueueId owner,
 
 std::set<TaskQueueId> MessageLoopTaskQueues::GetSubsumedTaskQueueId(
     TaskQueueId owner) const {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*entries_mutex_);
   return queue_entries_.at(owner)->owner_of;
 }
 
+void MessageLoopTaskQueues::SetMetricsEnabled(bool enabled) {
+  gTaskQueueMetricsEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool MessageLoopTaskQueues::GetMetricsEnabled() {
+  return gTaskQueueMetricsEnabled.load(std::memory_order_relaxed);
+}
+
+void MessageLoopTaskQueues::RecordTaskRunMetricsUnlocked(
+    TaskQueueId queue_id,
+    fml::TimeDelta latency) const {
+  auto& counters = queue_entries_.at(queue_id)->metrics_counters;
+  counters.tasks_run_count.fetch_add(1, std::memory_order_relaxed);
+  counters.latency_buckets[LatencyBucketIndex(latency)].fetch_add(
+      1, std::memory_order_relaxed);
+}
+
+TaskQueueMetrics MessageLoopTaskQueues::GetMetrics(TaskQueueId queue_id) const {
+  fml::SharedLock lock(*entries_mutex_);
+  const auto& counters = queue_entries_.at(queue_id)->metrics_counters;
+  TaskQueueMetrics metrics;
+  metrics.depth_high_watermark =
+      counters.depth_high_watermark.load(std::memory_order_relaxed);
+  metrics.wake_up_count = counters.wake_up_count.load(std::memory_order_relaxed);
+  metrics.tasks_run_count =
+      counters.tasks_run_count.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < TaskQueueMetrics::kLatencyBucketCount; i++) {
+    metrics.latency_buckets[i] =
+        counters.latency_buckets[i].load(std::memory_order_relaxed);
+  }
+  return metrics;
+}
+
+uint32_t MessageLoopTaskQueues::GetMergeTopologyVersion() const {
+  return merge_topology_version_.load(std::memory_order_relaxed);
+}
+
 void MessageLoopTaskQueues::PauseSecondarySource(TaskQueueId queue_id) {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*entries_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
   queue_entries_.at(queue_id)->task_source->PauseSecondary();
 }
 
 void MessageLoopTaskQueues::ResumeSecondarySource(TaskQueueId queue_id) {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*entries_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
   queue_entries_.at(queue_id)->task_source->ResumeSecondary();
   // Schedule a wake as needed.
   if (HasPendingTasksUnlocked(queue_id)) {
@@ -358,26 +634,32 @@ bool MessageLoopTaskQueues::HasPendingTasksUnlocked(
 
 fml::TimePoint MessageLoopTaskQueues::GetNextWakeTimeUnlocked(
     TaskQueueId queue_id) const {
-  return PeekNextTaskUnlocked(queue_id).task.GetTargetTime();
+  // Nothing is due at the beginning of time, so the peek degenerates to the
+  // earliest target time, which is what the wake-up must be armed for.
+  return PeekNextTaskUnlocked(queue_id, fml::TimePoint::Min())
+      .task.GetTargetTime();
 }
 
 TaskSource::TopTask MessageLoopTaskQueues::PeekNextTaskUnlocked(
-    TaskQueueId owner) const {
+    TaskQueueId owner,
+    fml::TimePoint from_time) const {
   FML_DCHECK(HasPendingTasksUnlocked(owner));
   const auto& entry = queue_entries_.at(owner);
   if (entry->owner_of.empty()) {
     FML_CHECK(!entry->task_source->IsEmpty());
-    return entry->task_source->Top();
+    return entry->task_source->Top(from_time);
   }
 
   // Use optional for the memory of TopTask object.
   std::optional<TaskSource::TopTask> top_task;
 
   std::function<void(const TaskSource*)> top_task_updater =
-      [&top_task](const TaskSource* source) {
+      [&top_task, from_time](const TaskSource* source) {
         if (source && !source->IsEmpty()) {
-          TaskSource::TopTask other_task = source->Top();
-          if (!top_task.has_value() || top_task->task > other_task.task) {
+          TaskSource::TopTask other_task = source->Top(from_time);
+          if (!top_task.has_value() ||
+              TaskSource::RunsBefore(other_task.task, top_task->task,
+                                     from_time)) {
             top_task.emplace(other_task);
           }
         }
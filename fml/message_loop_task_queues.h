@@ -5,6 +5,7 @@
 #ifndef FLUTTER_FML_MESSAGE_LOOP_TASK_QUEUES_H_
 #define FLUTTER_FML_MESSAGE_LOOP_TASK_QUEUES_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -24,6 +25,24 @@ namespace fml {
 
 static const TaskQueueId _kUnmerged = TaskQueueId(TaskQueueId::kUnmerged);
 
+/// Snapshot of the runtime metrics recorded for one TaskQueue while metrics
+/// collection is enabled via \p MessageLoopTaskQueues::SetMetricsEnabled.
+/// \see MessageLoopTaskQueues::GetMetrics
+struct TaskQueueMetrics {
+  /// Number of power-of-two latency buckets. Bucket \p i counts tasks whose
+  /// enqueue-to-run latency fell in [2^i, 2^(i+1)) microseconds, with the
+  /// first and last buckets absorbing the tails.
+  static constexpr size_t kLatencyBucketCount = 16;
+
+  /// The largest number of tasks that were pending on the queue at once.
+  size_t depth_high_watermark = 0;
+  /// Number of timed wake-ups forwarded to the queue's wakeable.
+  uint64_t wake_up_count = 0;
+  /// Number of tasks handed out to run.
+  uint64_t tasks_run_count = 0;
+  uint64_t latency_buckets[kLatencyBucketCount] = {};
+};
+
 /// A collection of tasks and observers associated with one TaskQueue.
 ///
 /// Often a TaskQueue has a one-to-one relationship with a fml::MessageLoop,
@@ -36,6 +55,21 @@ class TaskQueueEntry {
   TaskObservers task_observers;
   std::unique_ptr<TaskSource> task_source;
 
+  /// Guards |task_source|, |task_observers| and |wakeable|. Taken in ascending
+  /// TaskQueueId order across a merge group by
+  /// \p MessageLoopTaskQueues::MergedQueuesRunner so that posting to one queue
+  /// never contends with unrelated queues.
+  std::mutex queue_mutex;
+
+  /// Wake coalescing state, guarded by |queue_mutex| (or the exclusive
+  /// structure lock). A wake request is skipped when a wake is already armed
+  /// within |wake_up_slack| of the requested time, so a burst of delayed tasks
+  /// with nearby deadlines arms the platform timer once.
+  /// \see MessageLoopTaskQueues::SetWakeUpSlack
+  fml::TimeDelta wake_up_slack = fml::TimeDelta::Zero();
+  bool wake_armed = false;
+  fml::TimePoint armed_wake_time;
+
   /// Set of the TaskQueueIds which is owned by this TaskQueue. If the set is
   /// empty, this TaskQueue does not own any other TaskQueues.
   std::set<TaskQueueId> owner_of;
@@ -44,10 +78,29 @@ class TaskQueueEntry {
   /// it indicates that this TaskQueue is not owned by any other TaskQueue.
   TaskQueueId subsumed_by;
 
+  /// Lock-free metrics counters for this queue, touched by the dispatch hot
+  /// paths only while metrics collection is enabled.
+  /// \see MessageLoopTaskQueues::SetMetricsEnabled
+  struct MetricsCounters {
+    std::atomic<size_t> depth_high_watermark{0};
+    std::atomic<uint64_t> wake_up_count{0};
+    std::atomic<uint64_t> tasks_run_count{0};
+    std::atomic<uint64_t> latency_buckets[TaskQueueMetrics::kLatencyBucketCount] =
+        {};
+
+    void Reset();
+  };
+  MetricsCounters metrics_counters;
+
   TaskQueueId created_for;
 
   explicit TaskQueueEntry(TaskQueueId created_for);
 
+  /// Resets this entry for reuse by a newly created TaskQueue. Entries are
+  /// recycled by \p MessageLoopTaskQueues across queue disposal and creation
+  /// instead of going back to the heap.
+  void Recycle(TaskQueueId created_for);
+
  private:
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(TaskQueueEntry);
 };
@@ -78,14 +131,30 @@ class MessageLoopTaskQueues {
   // Tasks methods.
 
   void RegisterTask(TaskQueueId queue_id,
-                    const fml::closure& task,
+                    fml::Closure task,
                     fml::TimePoint target_time,
                     fml::TaskSourceGrade task_source_grade =
                         fml::TaskSourceGrade::kUnspecified);
 
+  /// Registers a batch of tasks under a single acquisition of the queue locks
+  /// and with a single wake of the loop, so a burst of N posts costs one
+  /// wakeup instead of N.
+  void RegisterTasks(TaskQueueId queue_id,
+                     std::vector<fml::Closure> tasks,
+                     fml::TimePoint target_time,
+                     fml::TaskSourceGrade task_source_grade =
+                         fml::TaskSourceGrade::kUnspecified);
+
   bool HasPendingTasks(TaskQueueId queue_id) const;
 
-  fml::closure GetNextTaskToRun(TaskQueueId queue_id, fml::TimePoint from_time);
+  fml::Closure GetNextTaskToRun(TaskQueueId queue_id, fml::TimePoint from_time);
+
+  /// Pops every task whose target time is at or before \p from_time under a
+  /// single acquisition of the queue locks and returns their invocations in
+  /// run order, so a loop can drain a ready batch locally instead of paying
+  /// one lock round-trip per task.
+  std::vector<fml::Closure> TakeExpiredTasksToRun(TaskQueueId queue_id,
+                                                  fml::TimePoint from_time);
 
   size_t GetNumPendingTasks(TaskQueueId queue_id) const;
 
@@ -105,6 +174,13 @@ class MessageLoopTaskQueues {
 
   void SetWakeable(TaskQueueId queue_id, fml::Wakeable* wakeable);
 
+  /// Sets the slack window for wake coalescing on \p queue_id. While a wake is
+  /// armed at time T, further wake requests for times in
+  /// [T - slack, infinity) are elided rather than re-arming the platform
+  /// timer; the corresponding tasks run at most \p slack late. The default is
+  /// zero, which disables coalescing so that every request arms the timer.
+  void SetWakeUpSlack(TaskQueueId queue_id, fml::TimeDelta slack);
+
   // Invariants for merge and un-merge
   //  1. RegisterTask will always submit to the queue_id that is passed
   //     to it. It is not aware of whether a queue is merged or not. Same with
@@ -137,6 +213,26 @@ class MessageLoopTaskQueues {
 
   void ResumeSecondarySource(TaskQueueId queue_id);
 
+  // Metrics methods.
+
+  /// Enables or disables metrics collection process-wide. Collection is off
+  /// by default; while off the dispatch hot paths skip all counter updates.
+  static void SetMetricsEnabled(bool enabled);
+
+  static bool GetMetricsEnabled();
+
+  /// Returns a snapshot of the metrics counters of \p queue_id. Counters are
+  /// cumulative since collection was enabled; taking a snapshot does not
+  /// reset them.
+  TaskQueueMetrics GetMetrics(TaskQueueId queue_id) const;
+
+  // Returns a counter that is incremented every time the merge topology
+  // changes (\p Merge or \p Unmerge succeeds). A loop that drained a batch of
+  // tasks compares this before and after each invocation: when it changes,
+  // the rest of the batch must be handed back to the dispatcher so it runs
+  // with the new thread affinity.
+  uint32_t GetMergeTopologyVersion() const;
+
  private:
   class MergedQueuesRunner;
 
@@ -148,17 +244,34 @@ class MessageLoopTaskQueues {
 
   bool HasPendingTasksUnlocked(TaskQueueId queue_id) const;
 
-  TaskSource::TopTask PeekNextTaskUnlocked(TaskQueueId owner) const;
+  TaskSource::TopTask PeekNextTaskUnlocked(TaskQueueId owner,
+                                           fml::TimePoint from_time) const;
+
+  void RecordTaskRunMetricsUnlocked(TaskQueueId queue_id,
+                                    fml::TimeDelta latency) const;
+
+  void RecycleEntryUnlocked(std::unique_ptr<TaskQueueEntry>& entry);
 
   fml::TimePoint GetNextWakeTimeUnlocked(TaskQueueId queue_id) const;
 
-  mutable std::mutex queue_mutex_;
+  // Guards the structure of |queue_entries_|: queue creation and disposal as
+  // well as the merge topology (|TaskQueueEntry::owner_of| and
+  // |TaskQueueEntry::subsumed_by|). Task registration and dispatch only take
+  // this in shared (read) mode and then lock the per-queue mutexes of the
+  // affected merge group, so unrelated queues do not serialize on a global
+  // lock.
+  mutable std::unique_ptr<fml::SharedMutex> entries_mutex_;
   std::map<TaskQueueId, std::unique_ptr<TaskQueueEntry>> queue_entries_;
+  // Disposed entries waiting to be recycled by CreateTaskQueue. Guarded by
+  // |entries_mutex_| held exclusively.
+  std::vector<std::unique_ptr<TaskQueueEntry>> recycled_queue_entries_;
 
   size_t task_queue_id_counter_;
 
   std::atomic_int order_;
 
+  std::atomic_uint32_t merge_topology_version_{0};
+
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(MessageLoopTaskQueues);
 };
 
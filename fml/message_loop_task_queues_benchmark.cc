@@ -4,18 +4,21 @@
 
 #include "flutter/fml/message_loop_task_queues.h"
 
+#include <algorithm>
 #include <cassert>
 #include <string>
 #include <thread>
 #include <vector>
 
 #include "flutter/benchmarking/benchmarking.h"
+#include "flutter/benchmarking/perf_counters.h"
 #include "flutter/fml/synchronization/count_down_latch.h"
 
 namespace fml {
 namespace benchmarking {
 
 static void BM_RegisterAndGetTasks(benchmark::State& state) {  // NOLINT
+  ::benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
 
@@ -66,5 +69,206 @@ static void BM_RegisterAndGetTasks(benchmark::State& state) {  // NOLINT
 
 BENCHMARK(BM_RegisterAndGetTasks);
 
+namespace {
+
+// Spawns |producer_count| threads that each register |tasks_per_producer|
+// no-op tasks against |queue_id| after a common barrier, maximizing
+// cross-thread contention on the queue locks. The wall time of each
+// individual RegisterTask call, in nanoseconds, is appended to
+// |latencies_ns|.
+void RunContendingProducers(fml::MessageLoopTaskQueues* task_queues,
+                            TaskQueueId queue_id,
+                            size_t producer_count,
+                            size_t tasks_per_producer,
+                            std::vector<int64_t>* latencies_ns) {
+  std::vector<std::vector<int64_t>> per_thread(producer_count);
+  std::vector<std::thread> producers;
+  CountDownLatch ready(producer_count);
+  const fml::TimePoint past = fml::TimePoint::Now();
+  for (size_t i = 0; i < producer_count; i++) {
+    producers.emplace_back([&, i]() {
+      auto& samples = per_thread[i];
+      samples.reserve(tasks_per_producer);
+      ready.CountDown();
+      ready.Wait();
+      for (size_t j = 0; j < tasks_per_producer; j++) {
+        const auto enqueue_start = fml::TimePoint::Now();
+        task_queues->RegisterTask(
+            queue_id, [] {}, past);
+        samples.push_back(
+            (fml::TimePoint::Now() - enqueue_start).ToNanoseconds());
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  for (const auto& samples : per_thread) {
+    latencies_ns->insert(latencies_ns->end(), samples.begin(), samples.end());
+  }
+}
+
+int64_t PercentileNs(std::vector<int64_t>& samples, double percentile) {
+  if (samples.empty()) {
+    return 0;
+  }
+  std::sort(samples.begin(), samples.end());
+  const size_t index = static_cast<size_t>(
+      percentile * static_cast<double>(samples.size() - 1));
+  return samples[index];
+}
+
+}  // namespace
+
+// Measures enqueue cost under cross-thread contention: N producers posting
+// to a single consumer queue. Reports the median and tail enqueue latency
+// in addition to the aggregate throughput.
+static void BM_MultiProducerEnqueue(benchmark::State& state) {  // NOLINT
+  auto task_queues = fml::MessageLoopTaskQueues::GetInstance();
+  const size_t producer_count = state.range(0);
+  const size_t tasks_per_producer = state.range(1);
+  const auto queue_id = task_queues->CreateTaskQueue();
+
+  std::vector<int64_t> latencies_ns;
+  ::benchmarking::ScopedPerfCounters perf(state);
+  while (state.KeepRunning()) {
+    RunContendingProducers(task_queues, queue_id, producer_count,
+                           tasks_per_producer, &latencies_ns);
+    state.PauseTiming();
+    task_queues->DisposeTasks(queue_id);
+    state.ResumeTiming();
+  }
+  perf.StopAndReport();
+  state.SetItemsProcessed(state.iterations() * producer_count *
+                          tasks_per_producer);
+  state.counters["EnqueueP50Ns"] = PercentileNs(latencies_ns, 0.5);
+  state.counters["EnqueueP99Ns"] = PercentileNs(latencies_ns, 0.99);
+  task_queues->Dispose(queue_id);
+}
+
+// Measures how fast a single consumer can drain a queue that N producers
+// filled, using the batched TakeExpiredTasksToRun path the message loop
+// uses.
+static void BM_MultiProducerDrain(benchmark::State& state) {  // NOLINT
+  auto task_queues = fml::MessageLoopTaskQueues::GetInstance();
+  const size_t producer_count = state.range(0);
+  const size_t tasks_per_producer = state.range(1);
+  const auto queue_id = task_queues->CreateTaskQueue();
+
+  std::vector<int64_t> latencies_ns;
+  ::benchmarking::ScopedPerfCounters perf(state);
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    RunContendingProducers(task_queues, queue_id, producer_count,
+                           tasks_per_producer, &latencies_ns);
+    state.ResumeTiming();
+    size_t drained = 0;
+    while (task_queues->HasPendingTasks(queue_id)) {
+      auto invocations =
+          task_queues->TakeExpiredTasksToRun(queue_id, fml::TimePoint::Now());
+      for (const auto& invocation : invocations) {
+        invocation();
+        drained++;
+      }
+    }
+    assert(drained == producer_count * tasks_per_producer);
+  }
+  perf.StopAndReport();
+  state.SetItemsProcessed(state.iterations() * producer_count *
+                          tasks_per_producer);
+  task_queues->Dispose(queue_id);
+}
+
+// Same contention scenario as BM_MultiProducerEnqueue but with the target
+// queue subsumed by another queue, as happens when the platform and raster
+// threads are merged. Producers post to the subsumed queue and the drain
+// happens through the owner.
+static void BM_MergedQueueMultiProducerEnqueue(
+    benchmark::State& state) {  // NOLINT
+  auto task_queues = fml::MessageLoopTaskQueues::GetInstance();
+  const size_t producer_count = state.range(0);
+  const size_t tasks_per_producer = state.range(1);
+  const auto owner_id = task_queues->CreateTaskQueue();
+  const auto subsumed_id = task_queues->CreateTaskQueue();
+  const bool merged = task_queues->Merge(owner_id, subsumed_id);
+  assert(merged);
+  (void)merged;
+
+  std::vector<int64_t> latencies_ns;
+  ::benchmarking::ScopedPerfCounters perf(state);
+  while (state.KeepRunning()) {
+    RunContendingProducers(task_queues, subsumed_id, producer_count,
+                           tasks_per_producer, &latencies_ns);
+    size_t drained = 0;
+    while (task_queues->HasPendingTasks(owner_id)) {
+      auto invocations =
+          task_queues->TakeExpiredTasksToRun(owner_id, fml::TimePoint::Now());
+      for (const auto& invocation : invocations) {
+        invocation();
+        drained++;
+      }
+    }
+    assert(drained == producer_count * tasks_per_producer);
+  }
+  perf.StopAndReport();
+  state.SetItemsProcessed(state.iterations() * producer_count *
+                          tasks_per_producer);
+  state.counters["EnqueueP50Ns"] = PercentileNs(latencies_ns, 0.5);
+  state.counters["EnqueueP99Ns"] = PercentileNs(latencies_ns, 0.99);
+  task_queues->Unmerge(owner_id, subsumed_id);
+  task_queues->Dispose(subsumed_id);
+  task_queues->Dispose(owner_id);
+}
+
+// Measures the observer notification storm the loop pays after every task
+// when many observers are installed.
+static void BM_ObserverNotification(benchmark::State& state) {  // NOLINT
+  auto task_queues = fml::MessageLoopTaskQueues::GetInstance();
+  const size_t observer_count = state.range(0);
+  const auto queue_id = task_queues->CreateTaskQueue();
+
+  size_t notifications = 0;
+  for (size_t i = 0; i < observer_count; i++) {
+    task_queues->AddTaskObserver(queue_id, static_cast<intptr_t>(i + 1),
+                                 [&notifications] { notifications++; });
+  }
+
+  ::benchmarking::ScopedPerfCounters perf(state);
+  while (state.KeepRunning()) {
+    for (const auto& observer : task_queues->GetObserversToNotify(queue_id)) {
+      observer();
+    }
+  }
+  perf.StopAndReport();
+  state.SetItemsProcessed(state.iterations() * observer_count);
+  benchmark::DoNotOptimize(notifications);
+
+  for (size_t i = 0; i < observer_count; i++) {
+    task_queues->RemoveTaskObserver(queue_id, static_cast<intptr_t>(i + 1));
+  }
+  task_queues->Dispose(queue_id);
+}
+
+BENCHMARK(BM_MultiProducerEnqueue)
+    ->Args({1, 1000})
+    ->Args({2, 1000})
+    ->Args({4, 1000})
+    ->Args({8, 1000})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_MultiProducerDrain)
+    ->Args({1, 1000})
+    ->Args({4, 1000})
+    ->Args({8, 1000})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_MergedQueueMultiProducerEnqueue)
+    ->Args({1, 1000})
+    ->Args({4, 1000})
+    ->Args({8, 1000})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_ObserverNotification)->Arg(1)->Arg(16)->Arg(128);
+
 }  // namespace benchmarking
 }  // namespace fml
@@ -63,6 +63,31 @@ TEST(MessageLoopTaskQueue, RegisterTwoTasksAndCount) {
   ASSERT_TRUE(task_queue->GetNumPendingTasks(queue_id) == 2);
 }
 
+TEST(MessageLoopTaskQueue, RegisterTaskBatchCountsAndWakesOnce) {
+  const auto time = fml::TimePoint::Max();
+
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+  size_t wake_count = 0;
+  auto wakeable = std::make_unique<TestWakeable>(
+      [&](fml::TimePoint wake_time) { wake_count++; });
+  task_queue->SetWakeable(queue_id, wakeable.get());
+
+  std::vector<fml::Closure> tasks;
+  for (int i = 0; i < 3; i++) {
+    tasks.push_back([] {});
+  }
+  task_queue->RegisterTasks(queue_id, std::move(tasks), time);
+  ASSERT_TRUE(task_queue->HasPendingTasks(queue_id));
+  ASSERT_EQ(task_queue->GetNumPendingTasks(queue_id), 3u);
+  ASSERT_EQ(wake_count, 1u);
+
+  // An empty batch is a no-op and doesn't wake the loop.
+  task_queue->RegisterTasks(queue_id, {}, time);
+  ASSERT_EQ(task_queue->GetNumPendingTasks(queue_id), 3u);
+  ASSERT_EQ(wake_count, 1u);
+}
+
 TEST(MessageLoopTaskQueue, RegisterTasksOnMergedQueuesAndCount) {
   auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
   auto platform_queue = task_queue->CreateTaskQueue();
@@ -108,7 +133,7 @@ TEST(MessageLoopTaskQueue, PreserveTaskOrdering) {
   const auto now = ChronoTicksSinceEpoch();
   int expected_value = 1;
   while (true) {
-    fml::closure invocation = task_queue->GetNextTaskToRun(queue_id, now);
+    fml::Closure invocation = task_queue->GetNextTaskToRun(queue_id, now);
     if (!invocation) {
       break;
     }
@@ -148,7 +173,7 @@ TEST(MessageLoopTaskQueue, RegisterTasksOnMergedQueuesPreserveTaskOrdering) {
   // "test_val = 1" in platform_queue
   // "test_val = 2" in raster2_queue
   while (true) {
-    fml::closure invocation = task_queue->GetNextTaskToRun(platform_queue, now);
+    fml::Closure invocation = task_queue->GetNextTaskToRun(platform_queue, now);
     if (!invocation) {
       break;
     }
@@ -191,7 +216,7 @@ TEST(MessageLoopTaskQueue, UnmergeRespectTheOriginalTaskOrderingInQueues) {
   // "test_val = 1" in platform_queue
   // "test_val = 2" in raster_queue (running on platform)
   for (int i = 0; i < 3; i++) {
-    fml::closure invocation = task_queue->GetNextTaskToRun(platform_queue, now);
+    fml::Closure invocation = task_queue->GetNextTaskToRun(platform_queue, now);
     ASSERT_FALSE(!invocation);
     invocation();
     ASSERT_TRUE(test_val == i);
@@ -210,7 +235,7 @@ TEST(MessageLoopTaskQueue, UnmergeRespectTheOriginalTaskOrderingInQueues) {
   // platform_queue has 1 task left: "test_val = 4"
   {
     ASSERT_TRUE(task_queue->GetNumPendingTasks(platform_queue) == 1);
-    fml::closure invocation = task_queue->GetNextTaskToRun(platform_queue, now);
+    fml::Closure invocation = task_queue->GetNextTaskToRun(platform_queue, now);
     ASSERT_FALSE(!invocation);
     invocation();
     ASSERT_TRUE(test_val == 4);
@@ -220,14 +245,14 @@ TEST(MessageLoopTaskQueue, UnmergeRespectTheOriginalTaskOrderingInQueues) {
   // raster_queue has 2 tasks left: "test_val = 3" and "test_val = 5"
   {
     ASSERT_TRUE(task_queue->GetNumPendingTasks(raster_queue) == 2);
-    fml::closure invocation = task_queue->GetNextTaskToRun(raster_queue, now);
+    fml::Closure invocation = task_queue->GetNextTaskToRun(raster_queue, now);
     ASSERT_FALSE(!invocation);
     invocation();
     ASSERT_TRUE(test_val == 3);
   }
   {
     ASSERT_TRUE(task_queue->GetNumPendingTasks(raster_queue) == 1);
-    fml::closure invocation = task_queue->GetNextTaskToRun(raster_queue, now);
+    fml::Closure invocation = task_queue->GetNextTaskToRun(raster_queue, now);
     ASSERT_FALSE(!invocation);
     invocation();
     ASSERT_TRUE(test_val == 5);
@@ -304,6 +329,56 @@ TEST(MessageLoopTaskQueue, WokenUpWithNewerTime) {
   latch.Wait();
 }
 
+TEST(MessageLoopTaskQueue, WakeUpCoalescedWithinSlack) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+
+  int num_wakes = 0;
+  auto wakeable = std::make_unique<TestWakeable>(
+      [&num_wakes](fml::TimePoint wake_time) { ++num_wakes; });
+  task_queue->SetWakeable(queue_id, wakeable.get());
+  task_queue->SetWakeUpSlack(queue_id, fml::TimeDelta::FromMilliseconds(2));
+
+  const auto now = ChronoTicksSinceEpoch();
+  task_queue->RegisterTask(
+      queue_id, []() {}, now + fml::TimeDelta::FromMilliseconds(10));
+  // Both of these fall within the slack window of the armed wake: elided.
+  task_queue->RegisterTask(
+      queue_id, []() {}, now + fml::TimeDelta::FromMilliseconds(9));
+  task_queue->RegisterTask(
+      queue_id, []() {}, now + fml::TimeDelta::FromMilliseconds(11));
+  ASSERT_EQ(num_wakes, 1);
+
+  // An earlier deadline outside the slack window re-arms the timer.
+  task_queue->RegisterTask(
+      queue_id, []() {}, now);
+  ASSERT_EQ(num_wakes, 2);
+}
+
+TEST(MessageLoopTaskQueue, TakeExpiredTasksDrainsBatchInOrder) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+
+  std::vector<int> order;
+  const auto now = ChronoTicksSinceEpoch();
+  for (int i = 0; i < 3; i++) {
+    task_queue->RegisterTask(
+        queue_id, [i, &order]() { order.push_back(i); }, now);
+  }
+  task_queue->RegisterTask(
+      queue_id, []() {}, now + fml::TimeDelta::FromSeconds(10));
+
+  auto invocations =
+      task_queue->TakeExpiredTasksToRun(queue_id, ChronoTicksSinceEpoch());
+  ASSERT_EQ(invocations.size(), 3u);
+  for (const auto& invocation : invocations) {
+    invocation();
+  }
+  ASSERT_EQ(order, (std::vector<int>{0, 1, 2}));
+  // The delayed task stays queued for a later drain.
+  ASSERT_EQ(task_queue->GetNumPendingTasks(queue_id), 1u);
+}
+
 TEST(MessageLoopTaskQueue, NotifyObserversWhileCreatingQueues) {
   auto task_queues = fml::MessageLoopTaskQueues::GetInstance();
   fml::TaskQueueId queue_id = task_queues->CreateTaskQueue();
@@ -413,6 +488,50 @@ TEST(MessageLoopTaskQueue, ConcurrentQueueAndTaskCreatingCounts) {
   ASSERT_EQ(pending_tasks, kThreadCount * kThreadTaskCount);
 }
 
+//------------------------------------------------------------------------------
+/// Verifies that tasks can be posted concurrently to the queues of a merge
+/// group while an unrelated queue is also being posted to.
+///
+TEST(MessageLoopTaskQueue, ConcurrentTaskCreatingOnMergedQueues) {
+  auto task_queues = fml::MessageLoopTaskQueues::GetInstance();
+
+  constexpr size_t kThreadTaskCount = 500;
+
+  auto owner_queue = task_queues->CreateTaskQueue();
+  auto subsumed_queue = task_queues->CreateTaskQueue();
+  auto independent_queue = task_queues->CreateTaskQueue();
+
+  ASSERT_TRUE(task_queues->Merge(owner_queue, subsumed_queue));
+
+  fml::CountDownLatch tasks_posted_latch(3);
+
+  auto thread_main = [&](TaskQueueId queue_id) {
+    for (size_t i = 0; i < kThreadTaskCount; i++) {
+      // The timepoint doesn't matter as the queue is never going to be drained.
+      task_queues->RegisterTask(
+          queue_id, []() {}, ChronoTicksSinceEpoch());
+    }
+
+    tasks_posted_latch.CountDown();
+  };
+
+  std::thread owner_thread(thread_main, owner_queue);
+  std::thread subsumed_thread(thread_main, subsumed_queue);
+  std::thread independent_thread(thread_main, independent_queue);
+
+  owner_thread.join();
+  subsumed_thread.join();
+  independent_thread.join();
+
+  // The owner queue accounts for its own and the subsumed queue's tasks.
+  ASSERT_EQ(task_queues->GetNumPendingTasks(owner_queue), 2 * kThreadTaskCount);
+  ASSERT_EQ(task_queues->GetNumPendingTasks(subsumed_queue), 0u);
+  ASSERT_EQ(task_queues->GetNumPendingTasks(independent_queue),
+            kThreadTaskCount);
+
+  ASSERT_TRUE(task_queues->Unmerge(owner_queue, subsumed_queue));
+}
+
 TEST(MessageLoopTaskQueue, RegisterTaskWakesUpOwnerQueue) {
   auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
   auto platform_queue = task_queue->CreateTaskQueue();
@@ -451,5 +570,61 @@ TEST(MessageLoopTaskQueue, RegisterTaskWakesUpOwnerQueue) {
   ASSERT_EQ(time1, wakes[2]);
 }
 
+TEST(MessageLoopTaskQueue, UserInteractionTasksRunBeforeDueDefaultTasks) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+
+  const auto begin = ChronoTicksSinceEpoch();
+  int order = 0;
+  int unspecified_ran_at = 0;
+  int interaction_ran_at = 0;
+  task_queue->RegisterTask(
+      queue_id, [&] { unspecified_ran_at = ++order; }, begin);
+  task_queue->RegisterTask(
+      queue_id, [&] { interaction_ran_at = ++order; }, begin,
+      fml::TaskSourceGrade::kUserInteraction);
+
+  const auto now = begin + fml::TimeDelta::FromMilliseconds(1);
+  for (int i = 0; i < 2; i++) {
+    auto invocation = task_queue->GetNextTaskToRun(queue_id, now);
+    ASSERT_TRUE(invocation);
+    invocation();
+  }
+
+  // The user interaction task was registered second but runs first.
+  ASSERT_EQ(interaction_ran_at, 1);
+  ASSERT_EQ(unspecified_ran_at, 2);
+}
+
+TEST(MessageLoopTaskQueue, MetricsRecordDepthAndTaskRuns) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+
+  fml::MessageLoopTaskQueues::SetMetricsEnabled(true);
+
+  const auto begin = ChronoTicksSinceEpoch();
+  for (int i = 0; i < 3; i++) {
+    task_queue->RegisterTask(
+        queue_id, []() {}, begin);
+  }
+
+  const auto now = begin + fml::TimeDelta::FromMilliseconds(1);
+  auto invocations = task_queue->TakeExpiredTasksToRun(queue_id, now);
+  ASSERT_EQ(invocations.size(), 3u);
+
+  auto metrics = task_queue->GetMetrics(queue_id);
+  ASSERT_EQ(metrics.depth_high_watermark, 3u);
+  ASSERT_EQ(metrics.tasks_run_count, 3u);
+
+  uint64_t bucketed = 0;
+  for (uint64_t count : metrics.latency_buckets) {
+    bucketed += count;
+  }
+  ASSERT_EQ(bucketed, 3u);
+
+  // Collection is a process-wide switch; turn it back off for other tests.
+  fml::MessageLoopTaskQueues::SetMetricsEnabled(false);
+}
+
 }  // namespace testing
 }  // namespace fml
@@ -103,6 +103,39 @@ bool FileMapping::IsDontNeedSafe() const {
   return mutable_mapping_ == nullptr;
 }
 
+bool FileMapping::AdviseRange(ResidencyHint hint,
+                              size_t offset,
+                              size_t length) const {
+  if (mapping_ == nullptr || size_ == 0 || offset >= size_) {
+    return false;
+  }
+  if (length == 0 || offset + length > size_) {
+    length = size_ - offset;
+  }
+
+  int advice = 0;
+  switch (hint) {
+    case ResidencyHint::kWillNeed:
+      advice = MADV_WILLNEED;
+      break;
+    case ResidencyHint::kSequential:
+      advice = MADV_SEQUENTIAL;
+      break;
+    case ResidencyHint::kDontNeed:
+      if (!IsDontNeedSafe()) {
+        return false;
+      }
+      advice = MADV_DONTNEED;
+      break;
+  }
+
+  // madvise requires a page-aligned starting address.
+  const size_t page_size = ::sysconf(_SC_PAGESIZE);
+  const size_t aligned_offset = offset & ~(page_size - 1);
+  return ::madvise(mapping_ + aligned_offset,
+                   length + (offset - aligned_offset), advice) == 0;
+}
+
 bool FileMapping::IsValid() const {
   return valid_;
 }
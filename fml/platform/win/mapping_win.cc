@@ -119,6 +119,15 @@ bool FileMapping::IsDontNeedSafe() const {
   return mutable_mapping_ == nullptr;
 }
 
+bool FileMapping::AdviseRange(ResidencyHint hint,
+                              size_t offset,
+                              size_t length) const {
+  // There is no madvise equivalent that is safe to use on all supported
+  // Windows versions. Callers fall back to eagerly touching pages via
+  // fml::PrefetchMapping.
+  return false;
+}
+
 bool FileMapping::IsValid() const {
   return valid_;
 }
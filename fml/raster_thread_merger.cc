@@ -12,6 +12,21 @@
 
 namespace fml {
 
+void RasterThreadMergerPolicy::SetHysteresisWindow(fml::TimeDelta window) {
+  hysteresis_window_ = window;
+}
+
+void RasterThreadMergerPolicy::RecordMergeActivity(fml::TimePoint time) {
+  last_merge_activity_ = time;
+}
+
+bool RasterThreadMergerPolicy::ShouldDeferDecrement(fml::TimePoint time) const {
+  if (hysteresis_window_ == fml::TimeDelta::Zero()) {
+    return false;
+  }
+  return time - last_merge_activity_ < hysteresis_window_;
+}
+
 RasterThreadMerger::RasterThreadMerger(fml::TaskQueueId platform_queue_id,
                                        fml::TaskQueueId gpu_queue_id)
     : RasterThreadMerger(
@@ -61,6 +76,8 @@ void RasterThreadMerger::MergeWithLease(size_t lease_term) {
   }
   FML_DCHECK(lease_term > 0) << "lease_term should be positive.";
 
+  policy_.RecordMergeActivity(fml::TimePoint::Now());
+
   if (IsMergedUnSafe()) {
     merged_condition_.notify_one();
     return;
@@ -112,9 +129,15 @@ void RasterThreadMerger::ExtendLeaseTo(size_t lease_term) {
   if (!IsEnabledUnSafe()) {
     return;
   }
+  policy_.RecordMergeActivity(fml::TimePoint::Now());
   shared_merger_->ExtendLeaseTo(this, lease_term);
 }
 
+void RasterThreadMerger::SetMergeHysteresis(fml::TimeDelta window) {
+  std::scoped_lock lock(mutex_);
+  policy_.SetHysteresisWindow(window);
+}
+
 bool RasterThreadMerger::IsMerged() {
   std::scoped_lock lock(mutex_);
   return IsMergedUnSafe();
@@ -167,6 +190,12 @@ RasterThreadStatus RasterThreadMerger::DecrementLease() {
   if (!IsEnabledUnSafe()) {
     return RasterThreadStatus::kRemainsMerged;
   }
+  if (policy_.ShouldDeferDecrement(fml::TimePoint::Now())) {
+    // A platform view was displayed inside the hysteresis window: hold the
+    // lease so a short visibility gap does not unmerge the threads only to
+    // re-merge them moments later.
+    return RasterThreadStatus::kRemainsMerged;
+  }
   bool unmerged_after_decrement = shared_merger_->DecrementLease(this);
   if (unmerged_after_decrement) {
     if (merge_unmerge_callback_ != nullptr) {
@@ -12,6 +12,8 @@
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/message_loop_task_queues.h"
 #include "flutter/fml/shared_thread_merger.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
 
 namespace fml {
 
@@ -23,6 +25,37 @@ enum class RasterThreadStatus {
   kUnmergedNow
 };
 
+/// Hysteresis policy used by |RasterThreadMerger| to damp thread
+/// configuration changes driven by platform view visibility.
+///
+/// Every |MergeWithLease| and |ExtendLeaseTo| call is recorded as evidence
+/// that a platform view was displayed recently. While that activity falls
+/// inside the hysteresis window, lease decrements are deferred so a platform
+/// view that disappears for a short gap (e.g. momentarily scrolled
+/// off-screen) does not unmerge the threads only to re-merge them a few
+/// frames later, costing janky frames on both transitions. A zero window
+/// (the default) disables the hysteresis and preserves plain lease counting.
+class RasterThreadMergerPolicy {
+ public:
+  RasterThreadMergerPolicy() = default;
+
+  /// Sets the window during which lease decrements are deferred after the
+  /// last recorded merge activity.
+  void SetHysteresisWindow(fml::TimeDelta window);
+
+  /// Records that a platform view was displayed at |time|, i.e. that a merge
+  /// was requested or an existing lease was extended.
+  void RecordMergeActivity(fml::TimePoint time);
+
+  /// Returns true if a lease decrement at |time| should be deferred because
+  /// merge activity was seen within the hysteresis window.
+  bool ShouldDeferDecrement(fml::TimePoint time) const;
+
+ private:
+  fml::TimeDelta hysteresis_window_ = fml::TimeDelta::Zero();
+  fml::TimePoint last_merge_activity_;
+};
+
 /// This class is a client and proxy between the rasterizer and
 /// |SharedThreadMerger|. The multiple |RasterThreadMerger| instances with same
 /// owner_queue_id and same subsumed_queue_id share the same
@@ -113,6 +146,14 @@ class RasterThreadMerger
   // the next task from a different thread.
   void SetMergeUnmergeCallback(const fml::closure& callback);
 
+  // Sets the hysteresis window of the adaptive merge policy. While merge
+  // activity (|MergeWithLease| or |ExtendLeaseTo|) has been seen within the
+  // window, |DecrementLease| keeps the threads merged instead of counting the
+  // lease down, so short platform view visibility gaps do not thrash the
+  // thread configuration. A zero window (the default) disables the
+  // hysteresis.
+  void SetMergeHysteresis(fml::TimeDelta window);
+
  private:
   fml::TaskQueueId platform_queue_id_;
   fml::TaskQueueId gpu_queue_id_;
@@ -127,6 +168,8 @@ class RasterThreadMerger
   std::condition_variable merged_condition_;
   std::mutex mutex_;
   fml::closure merge_unmerge_callback_;
+  // Guarded by |mutex_|.
+  RasterThreadMergerPolicy policy_;
 
   bool IsMergedUnSafe() const;
 
@@ -657,5 +657,36 @@ TEST(RasterThreadMerger,
   ASSERT_FALSE(merger_from_3_to_1->IsMerged());
 }
 
+TEST(RasterThreadMerger, HysteresisKeepsThreadsMergedAcrossShortGaps) {
+  TaskQueueWrapper queue1;
+  TaskQueueWrapper queue2;
+  fml::TaskQueueId qid1 = queue1.GetTaskQueueId();
+  fml::TaskQueueId qid2 = queue2.GetTaskQueueId();
+  const auto raster_thread_merger =
+      fml::MakeRefCounted<fml::RasterThreadMerger>(qid1, qid2);
+  const size_t kNumFramesMerged = 2;
+
+  raster_thread_merger->SetMergeHysteresis(fml::TimeDelta::FromSeconds(3600));
+  raster_thread_merger->MergeWithLease(kNumFramesMerged);
+
+  // The platform view just went away, but the merge activity is still inside
+  // the hysteresis window: decrements hold the lease instead of counting it
+  // down.
+  for (size_t i = 0; i < kNumFramesMerged * 2; i++) {
+    ASSERT_EQ(raster_thread_merger->DecrementLease(),
+              fml::RasterThreadStatus::kRemainsMerged);
+    ASSERT_TRUE(raster_thread_merger->IsMerged());
+  }
+
+  // Once the window has passed (simulated by disabling the hysteresis), the
+  // lease counts down and the threads unmerge as before.
+  raster_thread_merger->SetMergeHysteresis(fml::TimeDelta::Zero());
+  for (size_t i = 0; i < kNumFramesMerged; i++) {
+    ASSERT_TRUE(raster_thread_merger->IsMerged());
+    raster_thread_merger->DecrementLease();
+  }
+  ASSERT_FALSE(raster_thread_merger->IsMerged());
+}
+
 }  // namespace testing
 }  // namespace fml
@@ -4,24 +4,177 @@
 
 #include "flutter/fml/string_conversion.h"
 
-#include <codecvt>
-#include <locale>
 #include <sstream>
 #include <string>
 
 #include "flutter/fml/build_config.h"
 
-#if defined(FML_OS_WIN)
-// TODO(naifu): https://github.com/flutter/flutter/issues/98074
-// Eliminate this workaround for a link error on Windows when the underlying
-// bug is fixed.
-std::locale::id std::codecvt<char16_t, char, _Mbstatet>::id;
-#endif  // defined(FML_OS_WIN)
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FML_STRING_CONVERSION_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define FML_STRING_CONVERSION_NEON 1
+#include <arm_neon.h>
+#endif
 
 namespace fml {
 
-using Utf16StringConverter =
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t>;
+namespace {
+
+constexpr char32_t kReplacementCharacter = 0xfffd;
+
+// Returns the length of the leading run of ASCII bytes. The bulk of the
+// strings that cross the embedder boundary (method channel names, JSON
+// payloads) are pure ASCII, so the scan is vectorized 16 bytes at a time
+// where SSE2 or NEON is available.
+size_t AsciiRunLength(const char* data, size_t length) {
+  size_t i = 0;
+#if FML_STRING_CONVERSION_SSE2
+  for (; i + 16 <= length; i += 16) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    if (_mm_movemask_epi8(chunk) != 0) {
+      break;
+    }
+  }
+#elif FML_STRING_CONVERSION_NEON
+  for (; i + 16 <= length; i += 16) {
+    uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+    if (vmaxvq_u8(chunk) >= 0x80) {
+      break;
+    }
+  }
+#endif
+  for (; i < length && static_cast<unsigned char>(data[i]) < 0x80; i++) {
+  }
+  return i;
+}
+
+// As above, for UTF-16 code units.
+size_t AsciiRunLength(const char16_t* data, size_t length) {
+  size_t i = 0;
+#if FML_STRING_CONVERSION_SSE2
+  const __m128i ascii_max = _mm_set1_epi16(0x7f);
+  for (; i + 8 <= length; i += 8) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    // Saturating subtraction leaves zero exactly for units <= 0x7f.
+    __m128i above = _mm_subs_epu16(chunk, ascii_max);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(above, _mm_setzero_si128())) !=
+        0xffff) {
+      break;
+    }
+  }
+#elif FML_STRING_CONVERSION_NEON
+  for (; i + 8 <= length; i += 8) {
+    uint16x8_t chunk = vld1q_u16(reinterpret_cast<const uint16_t*>(data + i));
+    if (vmaxvq_u16(chunk) >= 0x80) {
+      break;
+    }
+  }
+#endif
+  for (; i < length && data[i] < 0x80; i++) {
+  }
+  return i;
+}
+
+// Decodes the UTF-8 sequence starting at |*index|, advancing |*index| past
+// the consumed bytes. Ill-formed sequences (truncated, overlong, surrogate
+// or out-of-range values) decode to U+FFFD.
+char32_t DecodeUtf8(const std::string_view string, size_t* index) {
+  const auto* bytes = reinterpret_cast<const unsigned char*>(string.data());
+  size_t i = *index;
+  unsigned char lead = bytes[i++];
+  char32_t code_point;
+  char32_t minimum;
+  size_t trailing;
+  if (lead < 0x80) {
+    code_point = lead;
+    minimum = 0;
+    trailing = 0;
+  } else if ((lead & 0xe0) == 0xc0) {
+    code_point = lead & 0x1f;
+    minimum = 0x80;
+    trailing = 1;
+  } else if ((lead & 0xf0) == 0xe0) {
+    code_point = lead & 0x0f;
+    minimum = 0x800;
+    trailing = 2;
+  } else if ((lead & 0xf8) == 0xf0) {
+    code_point = lead & 0x07;
+    minimum = 0x10000;
+    trailing = 3;
+  } else {
+    *index = i;
+    return kReplacementCharacter;
+  }
+  for (; trailing > 0; trailing--) {
+    if (i >= string.size() || (bytes[i] & 0xc0) != 0x80) {
+      *index = i;
+      return kReplacementCharacter;
+    }
+    code_point = (code_point << 6) | (bytes[i++] & 0x3f);
+  }
+  *index = i;
+  if (code_point < minimum || code_point > 0x10ffff ||
+      (code_point >= 0xd800 && code_point <= 0xdfff)) {
+    return kReplacementCharacter;
+  }
+  return code_point;
+}
+
+// Decodes the UTF-16 sequence starting at |*index|, advancing |*index| past
+// the consumed code units. Unpaired surrogates decode to U+FFFD.
+char32_t DecodeUtf16(const std::u16string_view string, size_t* index) {
+  size_t i = *index;
+  char16_t lead = string[i++];
+  if (lead >= 0xd800 && lead <= 0xdbff) {
+    if (i < string.size() && string[i] >= 0xdc00 && string[i] <= 0xdfff) {
+      char16_t trail = string[i++];
+      *index = i;
+      return 0x10000 + ((static_cast<char32_t>(lead) - 0xd800) << 10) +
+             (trail - 0xdc00);
+    }
+    *index = i;
+    return kReplacementCharacter;
+  }
+  *index = i;
+  if (lead >= 0xdc00 && lead <= 0xdfff) {
+    return kReplacementCharacter;
+  }
+  return lead;
+}
+
+void EncodeUtf8(char32_t code_point, std::string* output) {
+  if (code_point < 0x80) {
+    output->push_back(static_cast<char>(code_point));
+  } else if (code_point < 0x800) {
+    output->push_back(static_cast<char>(0xc0 | (code_point >> 6)));
+    output->push_back(static_cast<char>(0x80 | (code_point & 0x3f)));
+  } else if (code_point < 0x10000) {
+    output->push_back(static_cast<char>(0xe0 | (code_point >> 12)));
+    output->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3f)));
+    output->push_back(static_cast<char>(0x80 | (code_point & 0x3f)));
+  } else {
+    output->push_back(static_cast<char>(0xf0 | (code_point >> 18)));
+    output->push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3f)));
+    output->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3f)));
+    output->push_back(static_cast<char>(0x80 | (code_point & 0x3f)));
+  }
+}
+
+void EncodeUtf16(char32_t code_point, std::u16string* output) {
+  if (code_point < 0x10000) {
+    output->push_back(static_cast<char16_t>(code_point));
+  } else {
+    code_point -= 0x10000;
+    output->push_back(static_cast<char16_t>(0xd800 + (code_point >> 10)));
+    output->push_back(static_cast<char16_t>(0xdc00 + (code_point & 0x3ff)));
+  }
+}
+
+}  // namespace
 
 std::string Join(const std::vector<std::string>& vec, const char* delim) {
   std::stringstream res;
@@ -34,14 +187,46 @@ std::string Join(const std::vector<std::string>& vec, const char* delim) {
   return res.str();
 }
 
+void Utf16ToUtf8(const std::u16string_view string, std::string* output) {
+  output->reserve(output->size() + string.size());
+  size_t i = 0;
+  while (i < string.size()) {
+    size_t run = AsciiRunLength(string.data() + i, string.size() - i);
+    if (run > 0) {
+      output->insert(output->end(), string.begin() + i,
+                     string.begin() + i + run);
+      i += run;
+      continue;
+    }
+    EncodeUtf8(DecodeUtf16(string, &i), output);
+  }
+}
+
+void Utf8ToUtf16(const std::string_view string, std::u16string* output) {
+  output->reserve(output->size() + string.size());
+  size_t i = 0;
+  while (i < string.size()) {
+    size_t run = AsciiRunLength(string.data() + i, string.size() - i);
+    if (run > 0) {
+      output->insert(output->end(), string.begin() + i,
+                     string.begin() + i + run);
+      i += run;
+      continue;
+    }
+    EncodeUtf16(DecodeUtf8(string, &i), output);
+  }
+}
+
 std::string Utf16ToUtf8(const std::u16string_view string) {
-  Utf16StringConverter converter;
-  return converter.to_bytes(string.data());
+  std::string result;
+  Utf16ToUtf8(string, &result);
+  return result;
 }
 
 std::u16string Utf8ToUtf16(const std::string_view string) {
-  Utf16StringConverter converter;
-  return converter.from_bytes(string.data());
+  std::u16string result;
+  Utf8ToUtf16(string, &result);
+  return result;
 }
 
 }  // namespace fml
@@ -19,6 +19,16 @@ std::string Utf16ToUtf8(const std::u16string_view string);
 // Returns a UTF-16 encoded equivalent of a UTF-8 encoded input string.
 std::u16string Utf8ToUtf16(const std::string_view string);
 
+// Converts a UTF-16 encoded input string to UTF-8, appending the result to
+// |output|. Lets callers reuse a buffer across conversions instead of paying
+// for a string allocation per call.
+void Utf16ToUtf8(const std::u16string_view string, std::string* output);
+
+// Converts a UTF-8 encoded input string to UTF-16, appending the result to
+// |output|. Lets callers reuse a buffer across conversions instead of paying
+// for a string allocation per call.
+void Utf8ToUtf16(const std::string_view string, std::u16string* output);
+
 }  // namespace fml
 
 #endif  // FLUTTER_FML_STRING_CONVERSION_H_
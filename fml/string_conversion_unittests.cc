@@ -33,5 +33,45 @@ TEST(StringConversion, Utf16ToUtf8Unicode) {
   EXPECT_EQ(Utf16ToUtf8(u"\x2603"), "\xe2\x98\x83");
 }
 
+TEST(StringConversion, Utf8ToUtf16SurrogatePair) {
+  // U+1F600 requires a surrogate pair in UTF-16.
+  EXPECT_EQ(Utf8ToUtf16("\xf0\x9f\x98\x80"), u"\xd83d\xde00");
+}
+
+TEST(StringConversion, Utf16ToUtf8SurrogatePair) {
+  EXPECT_EQ(Utf16ToUtf8(u"\xd83d\xde00"), "\xf0\x9f\x98\x80");
+}
+
+TEST(StringConversion, RoundTripsLongMixedString) {
+  // Long enough that the vectorized ASCII scan is exercised, with non-ASCII
+  // code points interrupting the runs at unaligned offsets.
+  std::string utf8;
+  for (int i = 0; i < 100; i++) {
+    utf8 += "0123456789abcdefghijklmnopqrstuvwxyz";
+    utf8 += "\xe2\x98\x83";
+    utf8 += "\xf0\x9f\x98\x80";
+  }
+  EXPECT_EQ(Utf16ToUtf8(Utf8ToUtf16(utf8)), utf8);
+}
+
+TEST(StringConversion, Utf8ToUtf16InvalidSequenceIsReplaced) {
+  // A lone continuation byte decodes to U+FFFD.
+  EXPECT_EQ(Utf8ToUtf16("a\x80z"), u"a\xfffdz");
+}
+
+TEST(StringConversion, Utf16ToUtf8UnpairedSurrogateIsReplaced) {
+  EXPECT_EQ(Utf16ToUtf8(u"a\xd800z"), "a\xef\xbf\xbdz");
+}
+
+TEST(StringConversion, ConversionIntoExistingBufferAppends) {
+  std::string utf8 = "abc";
+  Utf16ToUtf8(u"\x2603", &utf8);
+  EXPECT_EQ(utf8, "abc\xe2\x98\x83");
+
+  std::u16string utf16 = u"abc";
+  Utf8ToUtf16("\xe2\x98\x83", &utf16);
+  EXPECT_EQ(utf16, u"abc\x2603");
+}
+
 }  // namespace testing
 }  // namespace fml
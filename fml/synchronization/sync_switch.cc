@@ -20,20 +20,61 @@ SyncSwitch::Handlers& SyncSwitch::Handlers::SetIfFalse(
 
 SyncSwitch::SyncSwitch(bool value)
     : mutex_(std::unique_ptr<fml::SharedMutex>(fml::SharedMutex::Create())),
-      value_(value) {}
+      value_(value),
+      active_readers_(0),
+      writer_pending_(false) {}
 
 void SyncSwitch::Execute(const SyncSwitch::Handlers& handlers) const {
-  fml::SharedLock lock(*mutex_);
-  if (value_) {
+  // Register on the fast path first, then check for a pending writer. The
+  // seq_cst ordering of the increment and the flag accesses guarantees that
+  // either the writer observes this reader and waits for it to drain, or
+  // this reader observes the writer and diverts to the mutex.
+  active_readers_.fetch_add(1, std::memory_order_seq_cst);
+  if (writer_pending_.load(std::memory_order_seq_cst)) {
+    // A SetSwitch is in flight. Back out of the fast path and serialize
+    // against the transition on the mutex instead.
+    FinishRead();
+    fml::SharedLock lock(*mutex_);
+    if (value_.load(std::memory_order_relaxed)) {
+      handlers.true_handler();
+    } else {
+      handlers.false_handler();
+    }
+    return;
+  }
+  // The handler runs without holding any lock; SetSwitch cannot return until
+  // FinishRead below because this reader is counted.
+  if (value_.load(std::memory_order_seq_cst)) {
     handlers.true_handler();
   } else {
     handlers.false_handler();
   }
+  FinishRead();
+}
+
+void SyncSwitch::FinishRead() const {
+  if (active_readers_.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+      writer_pending_.load(std::memory_order_seq_cst)) {
+    {
+      // Taken and released empty so the notification cannot slip between the
+      // writer's predicate check and it blocking on the condition variable.
+      std::scoped_lock lock(drain_mutex_);
+    }
+    drain_condition_.notify_all();
+  }
 }
 
 void SyncSwitch::SetSwitch(bool value) {
   fml::UniqueLock lock(*mutex_);
-  value_ = value;
+  writer_pending_.store(true, std::memory_order_seq_cst);
+  {
+    std::unique_lock drain_lock(drain_mutex_);
+    drain_condition_.wait(drain_lock, [this] {
+      return active_readers_.load(std::memory_order_seq_cst) == 0;
+    });
+  }
+  value_.store(value, std::memory_order_seq_cst);
+  writer_pending_.store(false, std::memory_order_seq_cst);
 }
 
 }  // namespace fml
@@ -5,9 +5,12 @@
 #ifndef FLUTTER_FML_SYNCHRONIZATION_SYNC_SWITCH_H_
 #define FLUTTER_FML_SYNCHRONIZATION_SYNC_SWITCH_H_
 
+#include <atomic>
+#include <condition_variable>
 #include <forward_list>
 #include <functional>
 #include <memory>
+#include <mutex>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/synchronization/shared_mutex.h"
@@ -17,8 +20,16 @@ namespace fml {
 /// A threadsafe structure that allows you to switch between 2 different
 /// execution paths.
 ///
-/// Execution and setting the switch is exclusive, i.e. only one will happen
-/// at a time.
+/// Execution and setting the switch is exclusive, i.e. |SetSwitch| does not
+/// return while any handler that observed the previous value is still
+/// running.
+///
+/// Reads are lock-free: |Execute| registers itself with an atomic reader
+/// count, loads the value with a single atomic load and runs the handler
+/// without holding any lock, so per-frame consumers on the raster and IO
+/// threads never contend with each other. Only a rare |Execute| that lands
+/// in the middle of a |SetSwitch| takes the mutex, where it blocks until the
+/// transition completes.
 class SyncSwitch {
  public:
   /// Represents the 2 code paths available when calling |SyncSwitch::Execute|.
@@ -48,14 +59,29 @@ class SyncSwitch {
 
   /// Set the value of the SyncSwitch.
   ///
-  /// This can be called on any thread.
+  /// This can be called on any thread. Blocks until every in-flight
+  /// |Execute| handler has finished, so on return no caller is still acting
+  /// on the previous value.
   ///
   /// @param[in]  value  New value for the |SyncSwitch|.
   void SetSwitch(bool value);
 
  private:
+  /// Decrements |active_readers_| and wakes a pending |SetSwitch| once the
+  /// last reader drains.
+  void FinishRead() const;
+
+  /// Serializes writers against each other and against the readers that
+  /// diverted off the fast path.
   mutable std::unique_ptr<fml::SharedMutex> mutex_;
-  bool value_;
+  std::atomic<bool> value_;
+  /// Number of |Execute| calls on the lock-free fast path.
+  mutable std::atomic<int64_t> active_readers_;
+  /// True while a |SetSwitch| is waiting for the fast-path readers to drain;
+  /// readers that observe it divert to |mutex_|.
+  mutable std::atomic<bool> writer_pending_;
+  mutable std::mutex drain_mutex_;
+  mutable std::condition_variable drain_condition_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(SyncSwitch);
 };
@@ -4,8 +4,10 @@
 
 #include "flutter/fml/synchronization/sync_switch.h"
 
+#include <atomic>
 #include <thread>
 
+#include "flutter/fml/synchronization/waitable_event.h"
 #include "gtest/gtest.h"
 
 using fml::SyncSwitch;
@@ -57,3 +59,35 @@ TEST(SyncSwitchTest, SharedLock) {
   EXPECT_TRUE(switch_value1);
   EXPECT_TRUE(switch_value2);
 }
+
+TEST(SyncSwitchTest, SetSwitchWaitsForInFlightExecutions) {
+  SyncSwitch sync_switch;
+  fml::AutoResetWaitableEvent handler_started;
+  fml::AutoResetWaitableEvent handler_may_finish;
+  std::atomic<bool> handler_done(false);
+
+  std::thread executor([&] {
+    sync_switch.Execute(SyncSwitch::Handlers().SetIfFalse([&] {
+      handler_started.Signal();
+      handler_may_finish.Wait();
+      handler_done = true;
+    }));
+  });
+
+  handler_started.Wait();
+  std::thread setter([&] {
+    sync_switch.SetSwitch(true);
+    // The handler observed the old value; it must have finished before
+    // SetSwitch returned.
+    EXPECT_TRUE(handler_done.load());
+  });
+
+  handler_may_finish.Signal();
+  executor.join();
+  setter.join();
+
+  bool switch_value = false;
+  sync_switch.Execute(
+      SyncSwitch::Handlers().SetIfTrue([&] { switch_value = true; }));
+  EXPECT_TRUE(switch_value);
+}
@@ -11,8 +11,44 @@
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
 
+#if FML_WAITABLE_EVENT_HAS_FUTEX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace fml {
 
+namespace {
+
+// How many times |TryConsumeSignal()| polls the signaled state before giving
+// up and letting the caller park. Roughly tuned so that the spin covers a few
+// microseconds on current hardware: long enough to catch a sub-10µs handoff,
+// short enough to not matter when the wait turns out to be long.
+constexpr uint32_t kSpinIterations = 1000u;
+
+// Tells the processor (not the scheduler) that we are in a spin-wait loop, to
+// reduce power and let a hyper-threaded sibling make progress.
+inline void SpinWaitRelax() {
+#if defined(FML_ARCH_CPU_X86_FAMILY)
+  __builtin_ia32_pause();
+#elif defined(FML_ARCH_CPU_ARM_FAMILY)
+  asm volatile("yield");
+#endif
+}
+
+#if FML_WAITABLE_EVENT_HAS_FUTEX
+int Futex(std::atomic<uint32_t>* word,
+          int op,
+          uint32_t value,
+          const struct timespec* timeout) {
+  return syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), op, value,
+                 timeout, nullptr, 0);
+}
+#endif
+
+}  // namespace
+
 // Waits with a timeout on |condition()|. Returns true on timeout, or false if
 // |condition()| ever returns true. |condition()| should have no side effects
 // (and will always be called with |*mutex| held).
@@ -58,30 +94,135 @@ bool WaitWithTimeoutImpl(std::unique_lock<std::mutex>* locker,
 
 // AutoResetWaitableEvent ------------------------------------------------------
 
+bool AutoResetWaitableEvent::TryConsumeSignal() {
+#if FML_WAITABLE_EVENT_HAS_FUTEX
+  for (uint32_t i = 0u; i < kSpinIterations; i++) {
+    uint32_t expected = 1u;
+    if (state_.compare_exchange_weak(expected, 0u, std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+      return true;
+    }
+    SpinWaitRelax();
+  }
+#else
+  for (uint32_t i = 0u; i < kSpinIterations; i++) {
+    if (signaled_.load(std::memory_order_relaxed) &&
+        signaled_.exchange(false, std::memory_order_acquire)) {
+      return true;
+    }
+    SpinWaitRelax();
+  }
+#endif
+  return false;
+}
+
+#if FML_WAITABLE_EVENT_HAS_FUTEX
+
+void AutoResetWaitableEvent::Signal() {
+  // The exchange and the load below are sequentially consistent: either this
+  // thread observes the waiter's increment of |waiters_| and issues the wake,
+  // or the waiter's in-kernel recheck of the futex word observes the 1 and
+  // refuses to sleep. An uncontended signal/wait handoff is then a pair of
+  // atomic operations with no syscall at all.
+  state_.exchange(1u);
+  if (waiters_.load() > 0u) {
+    Futex(&state_, FUTEX_WAKE_PRIVATE, 1u, nullptr);
+  }
+}
+
+void AutoResetWaitableEvent::Reset() {
+  uint32_t expected = 1u;
+  state_.compare_exchange_strong(expected, 0u, std::memory_order_relaxed,
+                                 std::memory_order_relaxed);
+}
+
+void AutoResetWaitableEvent::Wait() {
+  if (TryConsumeSignal()) {
+    return;
+  }
+
+  waiters_.fetch_add(1u);
+  while (true) {
+    uint32_t expected = 1u;
+    if (state_.compare_exchange_strong(expected, 0u,
+                                       std::memory_order_acquire)) {
+      break;
+    }
+    // The kernel rechecks the futex word before sleeping, so a concurrent
+    // |Signal()| between the check above and this call is not lost.
+    Futex(&state_, FUTEX_WAIT_PRIVATE, 0u, nullptr);
+  }
+  waiters_.fetch_sub(1u);
+}
+
+bool AutoResetWaitableEvent::WaitWithTimeout(TimeDelta timeout) {
+  if (TryConsumeSignal()) {
+    return false;
+  }
+
+  TimePoint start = TimePoint::Now();
+  waiters_.fetch_add(1u);
+  while (true) {
+    uint32_t expected = 1u;
+    if (state_.compare_exchange_strong(expected, 0u,
+                                       std::memory_order_acquire)) {
+      waiters_.fetch_sub(1u);
+      return false;
+    }
+
+    TimePoint now = TimePoint::Now();
+    FML_DCHECK(now >= start);
+    TimeDelta elapsed = now - start;
+    if (elapsed >= timeout) {
+      waiters_.fetch_sub(1u);
+      return true;
+    }
+
+    struct timespec wait_timespec = (timeout - elapsed).ToTimespec();
+    // Timeouts and spurious wakeups are both handled by re-reading the state
+    // and the clock above.
+    Futex(&state_, FUTEX_WAIT_PRIVATE, 0u, &wait_timespec);
+  }
+}
+
+bool AutoResetWaitableEvent::IsSignaledForTest() {
+  return state_.load(std::memory_order_acquire) == 1u;
+}
+
+#else  // !FML_WAITABLE_EVENT_HAS_FUTEX
+
 void AutoResetWaitableEvent::Signal() {
   std::scoped_lock locker(mutex_);
-  signaled_ = true;
+  signaled_.store(true, std::memory_order_release);
   cv_.notify_one();
 }
 
 void AutoResetWaitableEvent::Reset() {
   std::scoped_lock locker(mutex_);
-  signaled_ = false;
+  signaled_.store(false, std::memory_order_relaxed);
 }
 
 void AutoResetWaitableEvent::Wait() {
+  if (TryConsumeSignal()) {
+    return;
+  }
+
   std::unique_lock<std::mutex> locker(mutex_);
-  while (!signaled_) {
+  // |exchange| rather than a plain check so that a signal is consumed exactly
+  // once even when racing against a spinning waiter.
+  while (!signaled_.exchange(false, std::memory_order_acquire)) {
     cv_.wait(locker);
   }
-  signaled_ = false;
 }
 
 bool AutoResetWaitableEvent::WaitWithTimeout(TimeDelta timeout) {
+  if (TryConsumeSignal()) {
+    return false;
+  }
+
   std::unique_lock<std::mutex> locker(mutex_);
 
-  if (signaled_) {
-    signaled_ = false;
+  if (signaled_.exchange(false, std::memory_order_acquire)) {
     return false;
   }
 
@@ -96,8 +237,8 @@ bool AutoResetWaitableEvent::WaitWithTimeout(TimeDelta timeout) {
     }
 
     // We may have been awoken.
-    if (signaled_) {
-      break;
+    if (signaled_.exchange(false, std::memory_order_acquire)) {
+      return false;
     }
 
     // Or the wakeup may have been spurious.
@@ -112,16 +253,15 @@ bool AutoResetWaitableEvent::WaitWithTimeout(TimeDelta timeout) {
     // Otherwise, recalculate the amount that we have left to wait.
     wait_remaining = timeout - elapsed;
   }
-
-  signaled_ = false;
-  return false;
 }
 
 bool AutoResetWaitableEvent::IsSignaledForTest() {
   std::scoped_lock locker(mutex_);
-  return signaled_;
+  return signaled_.load(std::memory_order_relaxed);
 }
 
+#endif  // FML_WAITABLE_EVENT_HAS_FUTEX
+
 // ManualResetWaitableEvent ----------------------------------------------------
 
 void ManualResetWaitableEvent::Signal() {
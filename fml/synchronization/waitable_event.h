@@ -10,12 +10,24 @@
 #ifndef FLUTTER_FML_SYNCHRONIZATION_WAITABLE_EVENT_H_
 #define FLUTTER_FML_SYNCHRONIZATION_WAITABLE_EVENT_H_
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
 
+#include "flutter/fml/build_config.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/time/time_delta.h"
 
+// On Linux and Android, |AutoResetWaitableEvent| is implemented directly on a
+// futex word instead of a mutex + condition variable pair, so an uncontended
+// signal/wait handoff needs no kernel transition at all.
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+#define FML_WAITABLE_EVENT_HAS_FUTEX 1
+#else
+#define FML_WAITABLE_EVENT_HAS_FUTEX 0
+#endif
+
 namespace fml {
 
 // AutoResetWaitableEvent ------------------------------------------------------
@@ -25,6 +37,11 @@ namespace fml {
 // to Windows's auto-reset Event, which is also imitated by Chromium's
 // auto-reset |base::WaitableEvent|. However, there are some limitations -- see
 // |Signal()|.) This class is thread-safe.
+//
+// |Wait()| spins for a short, bounded amount of time before parking the
+// calling thread, so handoffs where the signal arrives within a few
+// microseconds (e.g. per-frame rendezvous between the UI and raster threads)
+// avoid the scheduler entirely.
 class AutoResetWaitableEvent final {
  public:
   AutoResetWaitableEvent() {}
@@ -62,11 +79,25 @@ class AutoResetWaitableEvent final {
   bool IsSignaledForTest();
 
  private:
+  // Attempts to consume a pending signal without blocking, spinning for a
+  // short, bounded amount of time. Returns true if a signal was consumed.
+  bool TryConsumeSignal();
+
+#if FML_WAITABLE_EVENT_HAS_FUTEX
+  // The futex word. 0: unsignaled, 1: signaled.
+  std::atomic<uint32_t> state_{0u};
+  // The number of threads parked (or about to park) on |state_|, so that
+  // |Signal()| only makes the FUTEX_WAKE syscall when somebody may actually
+  // be asleep.
+  std::atomic<uint32_t> waiters_{0u};
+#else
   std::condition_variable cv_;
   std::mutex mutex_;
 
-  // True if this event is in the signaled state.
-  bool signaled_ = false;
+  // True if this event is in the signaled state. Atomic so that the spin in
+  // |TryConsumeSignal()| can consume a signal without taking |mutex_|.
+  std::atomic<bool> signaled_{false};
+#endif
 
   FML_DISALLOW_COPY_AND_ASSIGN(AutoResetWaitableEvent);
 };
@@ -128,6 +128,30 @@ TEST(AutoResetWaitableEventTest, MultipleWaiters) {
   }
 }
 
+// Repeated fast handoffs between two threads, mostly consumed by the bounded
+// spin before either side parks.
+TEST(AutoResetWaitableEventTest, PingPongHandoff) {
+  AutoResetWaitableEvent ping;
+  AutoResetWaitableEvent pong;
+  constexpr size_t kIterations = 10000u;
+
+  std::thread thread([&ping, &pong]() {
+    for (size_t i = 0u; i < kIterations; i++) {
+      ping.Wait();
+      pong.Signal();
+    }
+  });
+
+  for (size_t i = 0u; i < kIterations; i++) {
+    ping.Signal();
+    pong.Wait();
+  }
+
+  thread.join();
+  EXPECT_FALSE(ping.IsSignaledForTest());
+  EXPECT_FALSE(pong.IsSignaledForTest());
+}
+
 // ManualResetWaitableEvent ----------------------------------------------------
 
 TEST(ManualResetWaitableEventTest, Basic) {
@@ -21,18 +21,32 @@ TaskRunner::TaskRunner(fml::RefPtr<MessageLoopImpl> loop)
 
 TaskRunner::~TaskRunner() = default;
 
-void TaskRunner::PostTask(const fml::closure& task) {
-  loop_->PostTask(task, fml::TimePoint::Now());
+void TaskRunner::PostTask(fml::Closure task) {
+  loop_->PostTask(std::move(task), fml::TimePoint::Now());
 }
 
-void TaskRunner::PostTaskForTime(const fml::closure& task,
+void TaskRunner::PostTaskWithGrade(fml::Closure task,
+                                   fml::TaskSourceGrade grade) {
+  if (!loop_) {
+    // Subclasses that dispatch without a message loop (e.g. embedder-supplied
+    // runners) fall back to their default posting path and drop the grade.
+    PostTask(std::move(task));
+    return;
+  }
+  loop_->PostTask(std::move(task), fml::TimePoint::Now(), grade);
+}
+
+void TaskRunner::PostTasks(std::vector<fml::Closure> tasks) {
+  loop_->PostTasks(std::move(tasks), fml::TimePoint::Now());
+}
+
+void TaskRunner::PostTaskForTime(fml::Closure task,
                                  fml::TimePoint target_time) {
-  loop_->PostTask(task, target_time);
+  loop_->PostTask(std::move(task), target_time);
 }
 
-void TaskRunner::PostDelayedTask(const fml::closure& task,
-                                 fml::TimeDelta delay) {
-  loop_->PostTask(task, fml::TimePoint::Now() + delay);
+void TaskRunner::PostDelayedTask(fml::Closure task, fml::TimeDelta delay) {
+  loop_->PostTask(std::move(task), fml::TimePoint::Now() + delay);
 }
 
 TaskQueueId TaskRunner::GetTaskQueueId() {
@@ -53,12 +67,12 @@ bool TaskRunner::RunsTasksOnCurrentThread() {
 }
 
 void TaskRunner::RunNowOrPostTask(const fml::RefPtr<fml::TaskRunner>& runner,
-                                  const fml::closure& task) {
+                                  fml::Closure task) {
   FML_DCHECK(runner);
   if (runner->RunsTasksOnCurrentThread()) {
     task();
   } else {
-    runner->PostTask(task);
+    runner->PostTask(std::move(task));
   }
 }
 
@@ -10,6 +10,7 @@
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/memory/ref_ptr.h"
 #include "flutter/fml/message_loop_task_queues.h"
+#include "flutter/fml/task_source_grade.h"
 #include "flutter/fml/time/time_point.h"
 
 namespace fml {
@@ -20,8 +21,9 @@ class MessageLoopImpl;
 class BasicTaskRunner {
  public:
   /// Schedules \p task to be executed on the TaskRunner's associated event
-  /// loop.
-  virtual void PostTask(const fml::closure& task) = 0;
+  /// loop. Anything invocable as `void()` converts to \p fml::Closure,
+  /// including move-only callables that std::function cannot hold.
+  virtual void PostTask(fml::Closure task) = 0;
 };
 
 /// The object for scheduling tasks on a \p fml::MessageLoop.
@@ -36,10 +38,23 @@ class TaskRunner : public fml::RefCountedThreadSafe<TaskRunner>,
  public:
   virtual ~TaskRunner();
 
-  virtual void PostTask(const fml::closure& task) override;
+  virtual void PostTask(fml::Closure task) override;
 
-  virtual void PostTaskForTime(const fml::closure& task,
-                               fml::TimePoint target_time);
+  /// Schedules \p task like \p PostTask, tagged with the given
+  /// \p TaskSourceGrade. A due \p TaskSourceGrade::kUserInteraction task runs
+  /// ahead of due lower grade work on the loop regardless of posting order,
+  /// so frame-critical work (pointer dispatch, vsync callbacks) is not stuck
+  /// behind housekeeping.
+  virtual void PostTaskWithGrade(fml::Closure task, fml::TaskSourceGrade grade);
+
+  /// Schedules a batch of tasks in submission order under a single
+  /// acquisition of the task queue lock and a single wake of the underlying
+  /// message loop. Prefer this over N individual \p PostTask calls when
+  /// posting a burst of small closures (e.g. per-frame pointer events or
+  /// channel messages).
+  virtual void PostTasks(std::vector<fml::Closure> tasks);
+
+  virtual void PostTaskForTime(fml::Closure task, fml::TimePoint target_time);
 
   /// Schedules a task to be run on the MessageLoop after the time \p delay has
   /// passed.
@@ -47,7 +62,7 @@ class TaskRunner : public fml::RefCountedThreadSafe<TaskRunner>,
   /// executed so that the actual execution time is: now + delay +
   /// message_loop_latency, where message_loop_latency is undefined and could be
   /// tens of milliseconds.
-  virtual void PostDelayedTask(const fml::closure& task, fml::TimeDelta delay);
+  virtual void PostDelayedTask(fml::Closure task, fml::TimeDelta delay);
 
   /// Returns \p true when the current executing thread's TaskRunner matches
   /// this instance.
@@ -60,7 +75,7 @@ class TaskRunner : public fml::RefCountedThreadSafe<TaskRunner>,
   /// Executes the \p task directly if the TaskRunner \p runner is the
   /// TaskRunner associated with the current executing thread.
   static void RunNowOrPostTask(const fml::RefPtr<fml::TaskRunner>& runner,
-                               const fml::closure& task);
+                               fml::Closure task);
 
  protected:
   explicit TaskRunner(fml::RefPtr<MessageLoopImpl> loop);
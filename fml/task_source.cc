@@ -8,6 +8,24 @@
 
 namespace fml {
 
+namespace {
+
+// Maps a `TaskSourceGrade` onto a scheduling priority. Higher values run
+// first when multiple tasks are due at the same time.
+int GradePriority(TaskSourceGrade grade) {
+  switch (grade) {
+    case TaskSourceGrade::kUserInteraction:
+      return 2;
+    case TaskSourceGrade::kUnspecified:
+      return 1;
+    case TaskSourceGrade::kDartMicroTasks:
+      return 0;
+  }
+  return 0;
+}
+
+}  // namespace
+
 TaskSource::TaskSource(TaskQueueId task_queue_id)
     : task_queue_id_(task_queue_id) {}
 
@@ -16,20 +34,21 @@ TaskSource::~TaskSource() {
 }
 
 void TaskSource::ShutDown() {
+  user_interaction_task_queue_ = {};
   primary_task_queue_ = {};
   secondary_task_queue_ = {};
 }
 
-void TaskSource::RegisterTask(const DelayedTask& task) {
+void TaskSource::RegisterTask(DelayedTask task) {
   switch (task.GetTaskSourceGrade()) {
     case TaskSourceGrade::kUserInteraction:
-      primary_task_queue_.push(task);
+      user_interaction_task_queue_.push(std::move(task));
       break;
     case TaskSourceGrade::kUnspecified:
-      primary_task_queue_.push(task);
+      primary_task_queue_.push(std::move(task));
       break;
     case TaskSourceGrade::kDartMicroTasks:
-      secondary_task_queue_.push(task);
+      secondary_task_queue_.push(std::move(task));
       break;
   }
 }
@@ -37,7 +56,7 @@ void TaskSource::RegisterTask(const DelayedTask& task) {
 void TaskSource::PopTask(TaskSourceGrade grade) {
   switch (grade) {
     case TaskSourceGrade::kUserInteraction:
-      primary_task_queue_.pop();
+      user_interaction_task_queue_.pop();
       break;
     case TaskSourceGrade::kUnspecified:
       primary_task_queue_.pop();
@@ -49,7 +68,8 @@ void TaskSource::PopTask(TaskSourceGrade grade) {
 }
 
 size_t TaskSource::GetNumPendingTasks() const {
-  size_t size = primary_task_queue_.size();
+  size_t size =
+      user_interaction_task_queue_.size() + primary_task_queue_.size();
   if (secondary_pause_requests_ == 0) {
     size += secondary_task_queue_.size();
   }
@@ -60,35 +80,52 @@ bool TaskSource::IsEmpty() const {
   return GetNumPendingTasks() == 0;
 }
 
+bool TaskSource::RunsBefore(const DelayedTask& candidate,
+                            const DelayedTask& current,
+                            fml::TimePoint from_time) {
+  const bool candidate_due = candidate.GetTargetTime() <= from_time;
+  const bool current_due = current.GetTargetTime() <= from_time;
+  if (candidate_due != current_due) {
+    return candidate_due;
+  }
+  if (candidate_due) {
+    const int candidate_priority =
+        GradePriority(candidate.GetTaskSourceGrade());
+    const int current_priority = GradePriority(current.GetTaskSourceGrade());
+    if (candidate_priority != current_priority) {
+      return candidate_priority > current_priority;
+    }
+  }
+  return current > candidate;
+}
+
 TaskSource::TopTask TaskSource::Top() const {
+  // Nothing is due at the beginning of time, so the selection falls through
+  // to the earliest target time across the heaps.
+  return Top(fml::TimePoint::Min());
+}
+
+TaskSource::TopTask TaskSource::Top(fml::TimePoint from_time) const {
   FML_CHECK(!IsEmpty());
-  if (secondary_pause_requests_ > 0 || secondary_task_queue_.empty()) {
-    const auto& primary_top = primary_task_queue_.top();
-    return {
-        .task_queue_id = task_queue_id_,
-        .task = primary_top,
-    };
-  } else if (primary_task_queue_.empty()) {
-    const auto& secondary_top = secondary_task_queue_.top();
-    return {
-        .task_queue_id = task_queue_id_,
-        .task = secondary_top,
-    };
-  } else {
-    const auto& primary_top = primary_task_queue_.top();
-    const auto& secondary_top = secondary_task_queue_.top();
-    if (primary_top > secondary_top) {
-      return {
-          .task_queue_id = task_queue_id_,
-          .task = secondary_top,
-      };
-    } else {
-      return {
-          .task_queue_id = task_queue_id_,
-          .task = primary_top,
-      };
+  const DelayedTaskQueue* heaps[] = {
+      &user_interaction_task_queue_,
+      &primary_task_queue_,
+      secondary_pause_requests_ == 0 ? &secondary_task_queue_ : nullptr,
+  };
+  const DelayedTask* top = nullptr;
+  for (const DelayedTaskQueue* heap : heaps) {
+    if (heap == nullptr || heap->empty()) {
+      continue;
+    }
+    if (top == nullptr || RunsBefore(heap->top(), *top, from_time)) {
+      top = &heap->top();
     }
   }
+  FML_CHECK(top != nullptr);
+  return {
+      .task_queue_id = task_queue_id_,
+      .task = *top,
+  };
 }
 
 void TaskSource::PauseSecondary() {
@@ -15,10 +15,10 @@ class MessageLoopTaskQueues;
 
 /**
  * A Source of tasks for the `MessageLoopTaskQueues` task dispatcher. This is a
- * wrapper around a primary and secondary task heap with the difference between
- * them being that the secondary task heap can be paused and resumed by the task
- * dispatcher. `TaskSourceGrade` determines what task heap the task is assigned
- * to.
+ * wrapper around one task heap per `TaskSourceGrade`: a user interaction heap,
+ * a primary heap for unspecified grade work, and a secondary task heap that
+ * can be paused and resumed by the task dispatcher. `TaskSourceGrade`
+ * determines what task heap the task is assigned to.
  *
  * Registering Tasks
  * -----------------
@@ -49,7 +49,7 @@ class TaskSource {
 
   /// Adds a task to the corresponding task heap as dictated by the
   /// `TaskSourceGrade` of the `DelayedTask`.
-  void RegisterTask(const DelayedTask& task);
+  void RegisterTask(DelayedTask task);
 
   /// Pops the task heap corresponding to the `TaskSourceGrade`.
   void PopTask(TaskSourceGrade grade);
@@ -65,6 +65,22 @@ class TaskSource {
   /// the secondary heap has been paused or not.
   TopTask Top() const;
 
+  /// Returns the task that should run next given the current time
+  /// `from_time`: among the tasks that are due (target time at or before
+  /// `from_time`) the one with the highest `TaskSourceGrade` wins, with ties
+  /// broken by target time and registration order. When no task is due yet,
+  /// this returns the task with the earliest target time so that callers can
+  /// compute the next wake-up. Takes into account whether the secondary heap
+  /// has been paused or not.
+  TopTask Top(fml::TimePoint from_time) const;
+
+  /// Returns true if `candidate` should run before `current` at `from_time`,
+  /// applying the same policy as `Top(fml::TimePoint)`. Used by the task
+  /// dispatcher to pick between the tops of merged task sources.
+  static bool RunsBefore(const DelayedTask& candidate,
+                         const DelayedTask& current,
+                         fml::TimePoint from_time);
+
   /// Pause providing tasks from secondary task heap.
   void PauseSecondary();
 
@@ -73,6 +89,7 @@ class TaskSource {
 
  private:
   const fml::TaskQueueId task_queue_id_;
+  fml::DelayedTaskQueue user_interaction_task_queue_;
   fml::DelayedTaskQueue primary_task_queue_;
   fml::DelayedTaskQueue secondary_task_queue_;
   int secondary_pause_requests_ = 0;
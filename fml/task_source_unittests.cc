@@ -97,5 +97,36 @@ TEST(TaskSourceTests, OrderingMultiTaskHeapsSecondaryPaused) {
   ASSERT_EQ(value, 1);
 }
 
+TEST(TaskSourceTests, UserInteractionPreemptsDueDefaultGradeTasks) {
+  TaskSource task_source = TaskSource(TaskQueueId(1));
+  auto time_stamp = ChronoTicksSinceEpoch();
+  int value = 0;
+  task_source.RegisterTask(
+      {1, [&] { value = 1; }, time_stamp, TaskSourceGrade::kUnspecified});
+  task_source.RegisterTask({2, [&] { value = 7; },
+                            time_stamp + fml::TimeDelta::FromMilliseconds(1),
+                            TaskSourceGrade::kUserInteraction});
+
+  // Before either task is due, selection falls back to target time so the
+  // next wake-up can be computed.
+  auto upcoming =
+      task_source.Top(time_stamp - fml::TimeDelta::FromMilliseconds(1));
+  ASSERT_EQ(upcoming.task.GetTaskSourceGrade(),
+            TaskSourceGrade::kUnspecified);
+
+  // Once both are due, the user interaction task runs first even though it
+  // was registered later with a later target time.
+  auto now = time_stamp + fml::TimeDelta::FromMilliseconds(2);
+  auto top_task = task_source.Top(now);
+  top_task.task.GetTask()();
+  task_source.PopTask(top_task.task.GetTaskSourceGrade());
+  ASSERT_EQ(value, 7);
+
+  auto second_task = task_source.Top(now);
+  second_task.task.GetTask()();
+  task_source.PopTask(second_task.task.GetTaskSourceGrade());
+  ASSERT_EQ(value, 1);
+}
+
 }  // namespace testing
 }  // namespace fml
@@ -6,9 +6,11 @@
 
 #include "flutter/fml/thread.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/message_loop.h"
@@ -22,6 +24,11 @@
 #include <pthread.h>
 #endif
 
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+#include <sched.h>
+#include <cstdio>
+#endif
+
 namespace fml {
 
 #if defined(FML_OS_WIN)
@@ -67,6 +74,73 @@ void Thread::SetCurrentThreadName(const Thread::ThreadConfig& config) {
   SetThreadName(config.name);
 }
 
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+// Reads the maximum clock frequency of a core in kHz as reported by cpufreq,
+// or -1 when the sysfs entry is unavailable.
+static long ReadCoreMaxFrequency(size_t core) {
+  char path[128];
+  snprintf(path, sizeof(path),
+           "/sys/devices/system/cpu/cpu%zu/cpufreq/cpuinfo_max_freq", core);
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    return -1;
+  }
+  long frequency = -1;
+  if (fscanf(file, "%ld", &frequency) != 1) {
+    frequency = -1;
+  }
+  fclose(file);
+  return frequency;
+}
+#endif
+
+bool Thread::TrySetCurrentThreadAffinity(Thread::CoreAffinity affinity) {
+  if (affinity == CoreAffinity::kNoPreference) {
+    return false;
+  }
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+  const size_t core_count = std::thread::hardware_concurrency();
+  if (core_count == 0 || core_count > CPU_SETSIZE) {
+    return false;
+  }
+
+  // Classify cores by their maximum frequency: the fastest cores are the
+  // performance cluster, everything slower is the efficiency cluster.
+  std::vector<long> frequencies(core_count, -1);
+  long max_frequency = -1;
+  for (size_t core = 0; core < core_count; core++) {
+    frequencies[core] = ReadCoreMaxFrequency(core);
+    max_frequency = std::max(max_frequency, frequencies[core]);
+  }
+  if (max_frequency <= 0) {
+    return false;
+  }
+
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  size_t matched_cores = 0;
+  for (size_t core = 0; core < core_count; core++) {
+    if (frequencies[core] < 0) {
+      continue;
+    }
+    const bool is_performance_core = frequencies[core] == max_frequency;
+    if ((affinity == CoreAffinity::kPerformance) == is_performance_core) {
+      CPU_SET(core, &cpu_set);
+      matched_cores++;
+    }
+  }
+
+  // A homogeneous processor has no cluster to prefer: every core matches
+  // the performance class and none match the efficiency class.
+  if (matched_cores == 0 || matched_cores == core_count) {
+    return false;
+  }
+  return sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+#else
+  return false;
+#endif
+}
+
 Thread::Thread(const std::string& name)
     : Thread(Thread::SetCurrentThreadName, ThreadConfig(name)) {}
 
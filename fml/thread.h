@@ -30,10 +30,27 @@ class Thread {
     RASTER,
   };
 
+  /// Valid values for the CPU core class a thread prefers to be scheduled on.
+  /// On heterogeneous (big.LITTLE) processors the scheduler may otherwise
+  /// migrate frame-critical threads onto efficiency cores.
+  enum class CoreAffinity : int {
+    /// Let the scheduler pick any core.
+    kNoPreference,
+    /// Prefer the high-frequency (performance) cores.
+    kPerformance,
+    /// Prefer the low-power (efficiency) cores.
+    kEfficiency,
+  };
+
   /// The ThreadConfig is the thread info include thread name, thread priority.
   struct ThreadConfig {
+    ThreadConfig(const std::string& name,
+                 ThreadPriority priority,
+                 CoreAffinity affinity)
+        : name(name), priority(priority), affinity(affinity) {}
+
     ThreadConfig(const std::string& name, ThreadPriority priority)
-        : name(name), priority(priority) {}
+        : ThreadConfig(name, priority, CoreAffinity::kNoPreference) {}
 
     explicit ThreadConfig(const std::string& name)
         : ThreadConfig(name, ThreadPriority::NORMAL) {}
@@ -42,6 +59,7 @@ class Thread {
 
     std::string name;
     ThreadPriority priority;
+    CoreAffinity affinity;
   };
 
   using ThreadConfigSetter = std::function<void(const ThreadConfig&)>;
@@ -59,6 +77,13 @@ class Thread {
 
   static void SetCurrentThreadName(const ThreadConfig& config);
 
+  /// Pin the calling thread to the cores of the given class. Intended for use
+  /// by |ThreadConfigSetter|s on platforms whose scheduler does not already
+  /// honor thread priorities with core placement. Returns false when the
+  /// affinity could not be applied: the platform has no affinity API, the
+  /// processor is homogeneous, or the request was |kNoPreference|.
+  static bool TrySetCurrentThreadAffinity(CoreAffinity affinity);
+
  private:
   std::unique_ptr<std::thread> thread_;
 
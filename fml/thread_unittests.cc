@@ -29,6 +29,11 @@ TEST(Thread, CanStartAndEndWithExplicitJoin) {
   thread.Join();
 }
 
+TEST(Thread, NoPreferenceAffinityIsANoOp) {
+  ASSERT_FALSE(fml::Thread::TrySetCurrentThreadAffinity(
+      fml::Thread::CoreAffinity::kNoPreference));
+}
+
 TEST(Thread, HasARunningMessageLoop) {
   fml::Thread thread;
   bool done = false;
@@ -0,0 +1,195 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/time/fast_clock.h"
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "flutter/fml/build_config.h"
+
+#if !defined(OS_FUCHSIA)
+#if defined(FML_ARCH_CPU_X86_64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#define FML_FAST_CLOCK_SUPPORTED 1
+#elif defined(FML_ARCH_CPU_ARM64) && !defined(_MSC_VER)
+#define FML_FAST_CLOCK_SUPPORTED 1
+#endif
+#endif  // !defined(OS_FUCHSIA)
+
+#if !defined(FML_FAST_CLOCK_SUPPORTED)
+#define FML_FAST_CLOCK_SUPPORTED 0
+#endif
+
+namespace fml {
+
+#if FML_FAST_CLOCK_SUPPORTED
+
+namespace {
+
+// The hardware counter, mapped onto the monotonic timebase as
+//   nanos = base_nanos + (ticks - base_ticks) * nanos_per_tick.
+struct CalibratedCounter {
+  uint64_t base_ticks = 0;
+  int64_t base_nanos = 0;
+  double nanos_per_tick = 0.0;
+  bool valid = false;
+};
+
+int64_t MonotonicNanosNow() {
+  // The same timebase the default TimePoint::Now() reports.
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+#if defined(FML_ARCH_CPU_X86_64)
+
+uint64_t ReadCounter() {
+#if defined(_MSC_VER)
+  return __rdtsc();
+#else
+  return __builtin_ia32_rdtsc();
+#endif
+}
+
+bool CounterIsInvariant() {
+  // CPUID.80000007H:EDX[8] advertises an invariant TSC: constant rate across
+  // frequency scaling and deep sleep states. Without it the TSC cannot back a
+  // monotonic clock.
+#if defined(_MSC_VER)
+  int registers[4] = {0, 0, 0, 0};
+  __cpuid(registers, 0x80000000);
+  if (static_cast<uint32_t>(registers[0]) < 0x80000007u) {
+    return false;
+  }
+  __cpuid(registers, 0x80000007);
+  return (registers[3] & (1 << 8)) != 0;
+#else
+  unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) {
+    return false;
+  }
+  return (edx & (1u << 8)) != 0;
+#endif
+}
+
+// Pairs a monotonic timestamp with a counter read, keeping the attempt with
+// the narrowest bracketing window so scheduling noise does not skew the pair.
+void SampleCounter(int64_t* nanos, uint64_t* ticks) {
+  uint64_t best_width = UINT64_MAX;
+  for (int i = 0; i < 5; i++) {
+    const uint64_t before = ReadCounter();
+    const int64_t now = MonotonicNanosNow();
+    const uint64_t after = ReadCounter();
+    if (after - before < best_width) {
+      best_width = after - before;
+      *nanos = now;
+      *ticks = before + (after - before) / 2;
+    }
+  }
+}
+
+CalibratedCounter Calibrate() {
+  CalibratedCounter result;
+  int64_t nanos_begin = 0, nanos_end = 0;
+  uint64_t ticks_begin = 0, ticks_end = 0;
+  SampleCounter(&nanos_begin, &ticks_begin);
+  // Long enough that sampling jitter amounts to well under a part in ten
+  // thousand of the measured frequency, short enough to hide in startup.
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  SampleCounter(&nanos_end, &ticks_end);
+  if (nanos_end <= nanos_begin || ticks_end <= ticks_begin) {
+    return result;
+  }
+  result.base_ticks = ticks_end;
+  result.base_nanos = nanos_end;
+  result.nanos_per_tick = static_cast<double>(nanos_end - nanos_begin) /
+                          static_cast<double>(ticks_end - ticks_begin);
+  result.valid = true;
+  return result;
+}
+
+#else  // defined(FML_ARCH_CPU_ARM64)
+
+uint64_t ReadCounter() {
+  uint64_t value;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+  return value;
+}
+
+bool CounterIsInvariant() {
+  // The generic timer counter is architecturally required to run at a
+  // constant rate.
+  return true;
+}
+
+CalibratedCounter Calibrate() {
+  CalibratedCounter result;
+  // The counter frequency is published by the hardware, so only the offset to
+  // the monotonic timebase needs to be measured.
+  uint64_t frequency;
+  asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+  if (frequency == 0) {
+    return result;
+  }
+  result.base_ticks = ReadCounter();
+  result.base_nanos = MonotonicNanosNow();
+  result.nanos_per_tick = 1e9 / static_cast<double>(frequency);
+  result.valid = true;
+  return result;
+}
+
+#endif
+
+const CalibratedCounter& GetCalibration() {
+  static const CalibratedCounter calibration = Calibrate();
+  return calibration;
+}
+
+TimePoint FastClockNow() {
+  const CalibratedCounter& counter = GetCalibration();
+  const uint64_t elapsed_ticks = ReadCounter() - counter.base_ticks;
+  return TimePoint::FromTicks(
+      counter.base_nanos +
+      static_cast<int64_t>(static_cast<double>(elapsed_ticks) *
+                           counter.nanos_per_tick));
+}
+
+}  // namespace
+
+TimePoint::ClockSource GetFastClockSource() {
+  if (!CounterIsInvariant()) {
+    return nullptr;
+  }
+  // Calibrate eagerly so the first read through the source is already fast.
+  if (!GetCalibration().valid) {
+    return nullptr;
+  }
+  return &FastClockNow;
+}
+
+#else  // FML_FAST_CLOCK_SUPPORTED
+
+TimePoint::ClockSource GetFastClockSource() {
+  return nullptr;
+}
+
+#endif  // FML_FAST_CLOCK_SUPPORTED
+
+bool InstallFastClockSource() {
+  TimePoint::ClockSource source = GetFastClockSource();
+  if (source == nullptr) {
+    return false;
+  }
+  TimePoint::SetClockSource(source);
+  return true;
+}
+
+}  // namespace fml
@@ -0,0 +1,31 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_TIME_FAST_CLOCK_H_
+#define FLUTTER_FML_TIME_FAST_CLOCK_H_
+
+#include "flutter/fml/time/time_point.h"
+
+namespace fml {
+
+/// Returns a clock source backed by the processor's constant-rate counter
+/// (rdtsc on x86-64, cntvct_el0 on arm64), calibrated once against the
+/// monotonic timebase used by fml::TimePoint::Now(). Reading it is a couple
+/// of instructions instead of a clock_gettime round-trip, which matters for
+/// instrumentation that records many timestamps per frame.
+///
+/// Returns nullptr when the processor does not advertise an invariant counter
+/// or when calibration fails, in which case callers should stay on the
+/// default clock.
+TimePoint::ClockSource GetFastClockSource();
+
+/// Installs the fast clock (when supported) as the clock source consulted by
+/// fml::TimePoint::Now(). Intended to be called once during engine startup,
+/// before the first timestamps are recorded. Returns true if the fast clock
+/// was installed.
+bool InstallFastClockSource();
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_TIME_FAST_CLOCK_H_
@@ -0,0 +1,42 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/time/fast_clock.h"
+
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace {
+
+TEST(FastClock, IsMonotonic) {
+  auto source = GetFastClockSource();
+  if (source == nullptr) {
+    // Unsupported processor: nothing to check.
+    return;
+  }
+  TimePoint last = source();
+  for (int i = 0; i < 100000; i++) {
+    const TimePoint now = source();
+    ASSERT_GE(now, last);
+    last = now;
+  }
+}
+
+TEST(FastClock, TracksTheMonotonicTimebase) {
+  auto source = GetFastClockSource();
+  if (source == nullptr) {
+    return;
+  }
+  // The fast clock is calibrated against TimePoint::Now()'s timebase, so the
+  // two must agree to well under the cross-clock sampling noise.
+  const TimeDelta delta = source() - TimePoint::Now();
+  const TimeDelta magnitude =
+      delta < TimeDelta::Zero() ? TimeDelta::Zero() - delta : delta;
+  EXPECT_LT(magnitude, TimeDelta::FromMilliseconds(10));
+}
+
+}  // namespace
+}  // namespace fml
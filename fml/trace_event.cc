@@ -5,12 +5,20 @@
 #include "flutter/fml/trace_event.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "flutter/fml/ascii_trie.h"
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/thread_local.h"
 
 namespace fml {
 namespace tracing {
@@ -27,6 +35,165 @@ AsciiTrie gAllowlist;
 std::atomic<TimelineEventHandler> gTimelineEventHandler;
 std::atomic<TimelineMicrosSource> gTimelineMicrosSource = DefaultMicrosSource;
 
+/// A zero-argument event parked in a ring buffer until the drainer thread
+/// forwards it to the timeline event handler. The label must be a string
+/// literal.
+struct BufferedTraceEvent {
+  const char* label;
+  int64_t timestamp0;
+  int64_t timestamp1_or_async_id;
+  Dart_Timeline_Event_Type type;
+};
+
+/// A fixed-size single-producer single-consumer lock-free ring buffer. The
+/// producer is the instrumented thread, the consumer is the drainer thread.
+/// Events pushed while the buffer is full are dropped.
+class TraceEventRingBuffer {
+ public:
+  static constexpr size_t kCapacity = 4096;  // Must be a power of two.
+
+  bool TryPush(const BufferedTraceEvent& event) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    const size_t tail = tail_.load(std::memory_order_acquire);
+    if (head - tail >= kCapacity) {
+      return false;
+    }
+    events_[head & (kCapacity - 1)] = event;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  void Drain(TimelineEventHandler handler) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    const size_t head = head_.load(std::memory_order_acquire);
+    while (tail != head) {
+      const BufferedTraceEvent& event = events_[tail & (kCapacity - 1)];
+      if (handler && gAllowlist.Query(event.label)) {
+        handler(event.label, event.timestamp0, event.timestamp1_or_async_id,
+                event.type, 0, nullptr, nullptr);
+      }
+      ++tail;
+      tail_.store(tail, std::memory_order_release);
+    }
+  }
+
+ private:
+  std::array<BufferedTraceEvent, kCapacity> events_;
+  std::atomic<size_t> head_ = {0};
+  std::atomic<size_t> tail_ = {0};
+};
+
+/// Owns the registry of per-thread ring buffers and the drainer thread that
+/// periodically flushes them to the timeline event handler.
+class TraceEventBufferController {
+ public:
+  static TraceEventBufferController* GetInstance() {
+    static TraceEventBufferController* instance =
+        new TraceEventBufferController();
+    return instance;
+  }
+
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  void Enable() {
+    std::scoped_lock lock(control_mutex_);
+    if (enabled_.load(std::memory_order_relaxed)) {
+      return;
+    }
+    enabled_.store(true, std::memory_order_relaxed);
+    drainer_ = std::thread([this]() { DrainerMain(); });
+  }
+
+  void Disable() {
+    std::scoped_lock lock(control_mutex_);
+    if (!enabled_.load(std::memory_order_relaxed)) {
+      return;
+    }
+    {
+      std::scoped_lock drain_lock(drain_mutex_);
+      enabled_.store(false, std::memory_order_relaxed);
+    }
+    drain_condition_.notify_one();
+    drainer_.join();
+    // Flush anything recorded between the last drainer pass and now.
+    DrainAll();
+  }
+
+  bool Record(const char* label,
+              int64_t timestamp0,
+              int64_t timestamp1_or_async_id,
+              Dart_Timeline_Event_Type type) {
+    return ThreadBuffer()->TryPush(
+        {label, timestamp0, timestamp1_or_async_id, type});
+  }
+
+  // Holds the calling thread's ring buffer; the registry keeps the buffer
+  // alive after thread exit so the drainer never sees a dangling pointer.
+  class ThreadBufferHolder {
+   public:
+    explicit ThreadBufferHolder(std::shared_ptr<TraceEventRingBuffer> buffer)
+        : buffer_(std::move(buffer)) {}
+    TraceEventRingBuffer* get() const { return buffer_.get(); }
+
+   private:
+    std::shared_ptr<TraceEventRingBuffer> buffer_;
+  };
+
+ private:
+  TraceEventBufferController() = default;
+
+  TraceEventRingBuffer* ThreadBuffer();
+
+  void DrainAll() {
+    TimelineEventHandler handler =
+        gTimelineEventHandler.load(std::memory_order_relaxed);
+    std::vector<std::shared_ptr<TraceEventRingBuffer>> buffers;
+    {
+      std::scoped_lock lock(buffers_mutex_);
+      buffers = buffers_;
+    }
+    for (const auto& buffer : buffers) {
+      buffer->Drain(handler);
+    }
+  }
+
+  void DrainerMain() {
+    std::unique_lock lock(drain_mutex_);
+    while (enabled_.load(std::memory_order_relaxed)) {
+      drain_condition_.wait_for(lock, std::chrono::milliseconds(1));
+      DrainAll();
+    }
+  }
+
+  std::mutex control_mutex_;
+  std::mutex drain_mutex_;
+  std::condition_variable drain_condition_;
+  std::mutex buffers_mutex_;
+  std::vector<std::shared_ptr<TraceEventRingBuffer>> buffers_;
+  std::atomic_bool enabled_ = {false};
+  std::thread drainer_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(TraceEventBufferController);
+};
+
+FML_THREAD_LOCAL
+ThreadLocalUniquePtr<TraceEventBufferController::ThreadBufferHolder>
+    tls_trace_event_buffer;
+
+TraceEventRingBuffer* TraceEventBufferController::ThreadBuffer() {
+  ThreadBufferHolder* holder = tls_trace_event_buffer.get();
+  if (holder == nullptr) {
+    auto buffer = std::make_shared<TraceEventRingBuffer>();
+    {
+      std::scoped_lock lock(buffers_mutex_);
+      buffers_.push_back(buffer);
+    }
+    holder = new ThreadBufferHolder(std::move(buffer));
+    tls_trace_event_buffer.reset(holder);
+  }
+  return holder->get();
+}
+
 inline void FlutterTimelineEvent(const char* label,
                                  int64_t timestamp0,
                                  int64_t timestamp1_or_async_id,
@@ -36,7 +203,19 @@ inline void FlutterTimelineEvent(const char* label,
                                  const char** argument_values) {
   TimelineEventHandler handler =
       gTimelineEventHandler.load(std::memory_order_relaxed);
-  if (handler && gAllowlist.Query(label)) {
+  if (!handler) {
+    return;
+  }
+  if (argument_count == 0) {
+    TraceEventBufferController* buffer =
+        TraceEventBufferController::GetInstance();
+    if (buffer->IsEnabled() &&
+        buffer->Record(label, timestamp0, timestamp1_or_async_id, type)) {
+      // The allowlist is consulted by the drainer thread instead.
+      return;
+    }
+  }
+  if (gAllowlist.Query(label)) {
     handler(label, timestamp0, timestamp1_or_async_id, type, argument_count,
             argument_names, argument_values);
   }
@@ -56,6 +235,18 @@ bool TraceHasTimelineEventHandler() {
       gTimelineEventHandler.load(std::memory_order_relaxed));
 }
 
+void TraceEnableTimelineBuffering() {
+  TraceEventBufferController::GetInstance()->Enable();
+}
+
+void TraceDisableTimelineBuffering() {
+  TraceEventBufferController::GetInstance()->Disable();
+}
+
+bool TraceTimelineBufferingEnabled() {
+  return TraceEventBufferController::GetInstance()->IsEnabled();
+}
+
 int64_t TraceGetTimelineMicros() {
   return gTimelineMicrosSource.load()();
 }
@@ -320,6 +511,14 @@ bool TraceHasTimelineEventHandler() {
   return false;
 }
 
+void TraceEnableTimelineBuffering() {}
+
+void TraceDisableTimelineBuffering() {}
+
+bool TraceTimelineBufferingEnabled() {
+  return false;
+}
+
 int64_t TraceGetTimelineMicros() {
   return -1;
 }
@@ -161,6 +161,22 @@ void TraceSetTimelineEventHandler(TimelineEventHandler handler);
 
 bool TraceHasTimelineEventHandler();
 
+/// Enables buffered tracing: zero-argument trace events are recorded into
+/// per-thread fixed-size lock-free ring buffers and flushed to the timeline
+/// event handler by a background drainer thread, so instrumented hot paths
+/// pay a near-zero per-event cost. Events carrying arguments keep taking the
+/// synchronous path since argument values may not outlive the call. Buffered
+/// mode relies on event labels being string literals (which the TRACE_EVENT
+/// macros guarantee). If a ring buffer fills before the drainer catches up,
+/// newer events in that buffer are dropped.
+void TraceEnableTimelineBuffering();
+
+/// Disables buffered tracing, joins the drainer thread and flushes all
+/// outstanding buffered events to the timeline event handler.
+void TraceDisableTimelineBuffering();
+
+bool TraceTimelineBufferingEnabled();
+
 void TraceSetTimelineMicrosSource(TimelineMicrosSource source);
 
 int64_t TraceGetTimelineMicros();
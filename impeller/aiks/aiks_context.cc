@@ -20,6 +20,11 @@ AiksContext::AiksContext(std::shared_ptr<Context> context)
   }
 
   is_valid_ = true;
+
+  // Kick off compilation of the common pipeline variants now so that the
+  // first frame to use one does not stall on a backend PSO compilation.
+  content_context_->PrewarmPipelineVariants(
+      ContentContext::DefaultPrewarmVariants());
 }
 
 AiksContext::~AiksContext() = default;
@@ -32,6 +37,10 @@ std::shared_ptr<Context> AiksContext::GetContext() const {
   return context_;
 }
 
+PictureSnapshotCache& AiksContext::GetPictureSnapshotCache() {
+  return picture_snapshot_cache_;
+}
+
 bool AiksContext::Render(const Picture& picture, RenderTarget& render_target) {
   if (!IsValid()) {
     return false;
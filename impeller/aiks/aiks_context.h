@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "flutter/fml/macros.h"
+#include "impeller/aiks/picture_snapshot_cache.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/renderer/context.h"
 #include "impeller/renderer/render_target.h"
@@ -28,9 +29,14 @@ class AiksContext {
 
   bool Render(const Picture& picture, RenderTarget& render_target);
 
+  /// The cache of snapshots for pictures that are drawn repeatedly. See
+  /// PictureSnapshotCache.
+  PictureSnapshotCache& GetPictureSnapshotCache();
+
  private:
   std::shared_ptr<Context> context_;
   std::unique_ptr<ContentContext> content_context_;
+  PictureSnapshotCache picture_snapshot_cache_;
   bool is_valid_ = false;
 
   FML_DISALLOW_COPY_AND_ASSIGN(AiksContext);
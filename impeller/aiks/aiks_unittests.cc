@@ -12,6 +12,7 @@
 #include "impeller/aiks/aiks_playground.h"
 #include "impeller/aiks/canvas.h"
 #include "impeller/aiks/image.h"
+#include "impeller/aiks/paint_pass_delegate.h"
 #include "impeller/entity/contents/tiled_texture_contents.h"
 #include "impeller/geometry/color.h"
 #include "impeller/geometry/geometry_unittests.h"
@@ -1077,6 +1078,17 @@ TEST_P(AiksTest, CanRenderTextFrame) {
   ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
 }
 
+TEST_P(AiksTest, CanRenderScaledTextFrame) {
+  Canvas canvas;
+  // Scaled text takes the signed distance field path so that scale
+  // animations never re-rasterize the glyph atlas.
+  canvas.Scale(Vector2{1.6, 1.6});
+  ASSERT_TRUE(RenderTextInCanvas(
+      GetContext(), canvas, "the quick brown fox jumped over the lazy dog!.?",
+      "Roboto-Regular.ttf"));
+  ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
+}
+
 TEST_P(AiksTest, CanRenderItalicizedText) {
   Canvas canvas;
   ASSERT_TRUE(RenderTextInCanvas(
@@ -1661,5 +1673,115 @@ TEST_P(AiksTest, SaveLayerFiltersScaleWithTransform) {
   ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
 }
 
+TEST(AiksPaintPassDelegateTest, NoOpLayerPaintsCollapseIntoParentPass) {
+  auto can_collapse = [](const Paint& paint) {
+    return PaintPassDelegate(paint, std::nullopt).CanCollapseIntoParentPass();
+  };
+
+  // A paint that renders the subpass texture unmodified doesn't need the
+  // offscreen round trip.
+  ASSERT_TRUE(can_collapse(Paint{}));
+
+  Paint alpha_paint;
+  alpha_paint.color = Color::White().WithAlpha(0.5);
+  ASSERT_FALSE(can_collapse(alpha_paint));
+
+  Paint blend_paint;
+  blend_paint.blend_mode = BlendMode::kMultiply;
+  ASSERT_FALSE(can_collapse(blend_paint));
+
+  Paint color_filter_paint;
+  color_filter_paint.color_filter = [](FilterInput::Ref input) {
+    return ColorFilterContents::MakeBlend(BlendMode::kColorBurn,
+                                          {std::move(input)}, Color::Red());
+  };
+  ASSERT_FALSE(can_collapse(color_filter_paint));
+
+  Paint mask_blur_paint;
+  mask_blur_paint.mask_blur_descriptor = Paint::MaskBlurDescriptor{
+      .style = FilterContents::BlurStyle::kNormal,
+      .sigma = Sigma{2},
+  };
+  ASSERT_FALSE(can_collapse(mask_blur_paint));
+}
+
+static size_t CountEntities(const Picture& picture) {
+  size_t entity_count = 0u;
+  picture.pass->IterateAllEntities([&entity_count](Entity&) {
+    entity_count++;
+    return true;
+  });
+  return entity_count;
+}
+
+TEST(AiksCanvasTest, DrawsOutsideIntersectClipsAreCulledAtRecordTime) {
+  Canvas canvas;
+  canvas.ClipPath(
+      PathBuilder{}.AddRect(Rect::MakeXYWH(0, 0, 100, 100)).TakePath());
+  // Misses the clip entirely and must not record an entity.
+  canvas.DrawRect(Rect::MakeXYWH(500, 500, 10, 10), Paint{});
+  // Overlaps the clip and must survive.
+  canvas.DrawRect(Rect::MakeXYWH(10, 10, 10, 10), Paint{});
+  // The clip entity plus the one visible rect.
+  ASSERT_EQ(CountEntities(canvas.EndRecordingAsPicture()), 2u);
+}
+
+TEST(AiksCanvasTest, RestoreDiscardsCullBoundsFromRestoredClips) {
+  Canvas canvas;
+  canvas.Save();
+  canvas.ClipPath(
+      PathBuilder{}.AddRect(Rect::MakeXYWH(0, 0, 100, 100)).TakePath());
+  canvas.Restore();
+  // The clip no longer applies, so nothing may be rejected.
+  canvas.DrawRect(Rect::MakeXYWH(500, 500, 10, 10), Paint{});
+  // The clip entity, its restore entity and the rect.
+  ASSERT_EQ(CountEntities(canvas.EndRecordingAsPicture()), 3u);
+}
+
+TEST(AiksCanvasTest, DrawsWithCoverageExpandingPaintsAreNotCulled) {
+  Canvas canvas;
+  canvas.ClipPath(
+      PathBuilder{}.AddRect(Rect::MakeXYWH(0, 0, 100, 100)).TakePath());
+  // A mask blurred draw can bleed back into the clip, so it survives even
+  // though its geometry misses the cull bounds.
+  Paint blur_paint;
+  blur_paint.mask_blur_descriptor = Paint::MaskBlurDescriptor{
+      .style = FilterContents::BlurStyle::kNormal,
+      .sigma = Sigma{200},
+  };
+  canvas.DrawPath(
+      PathBuilder{}.AddRect(Rect::MakeXYWH(120, 120, 10, 10)).TakePath(),
+      blur_paint);
+  ASSERT_EQ(CountEntities(canvas.EndRecordingAsPicture()), 2u);
+}
+
+TEST_P(AiksTest, PictureSnapshotCacheAdmitsAfterRepeatedAccesses) {
+  Canvas canvas;
+  Paint paint;
+  paint.color = Color::Red();
+  canvas.DrawRect(Rect::MakeXYWH(10, 10, 100, 100), paint);
+  auto picture = canvas.EndRecordingAsPicture();
+
+  AiksContext context(GetContext());
+  auto& cache = context.GetPictureSnapshotCache();
+  constexpr uint64_t kPictureId = 1;
+
+  // The first accesses below the admission threshold render nothing.
+  ASSERT_FALSE(cache.Get(context, picture, kPictureId).has_value());
+  ASSERT_FALSE(cache.Get(context, picture, kPictureId).has_value());
+
+  auto snapshot = cache.Get(context, picture, kPictureId);
+  ASSERT_TRUE(snapshot.has_value());
+  ASSERT_NE(snapshot->texture, nullptr);
+  // The snapshot was rendered from a clone; the caller's picture is intact.
+  ASSERT_NE(picture.pass, nullptr);
+
+  // Entries are swept once they go a frame without being requested.
+  cache.SweepAfterFrame();
+  ASSERT_EQ(cache.GetCachedEntryCount(), 1u);
+  cache.SweepAfterFrame();
+  ASSERT_EQ(cache.GetCachedEntryCount(), 0u);
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -52,6 +52,7 @@ void Canvas::Save(
     std::optional<EntityPass::BackdropFilterProc> backdrop_filter) {
   auto entry = CanvasStackEntry{};
   entry.xformation = xformation_stack_.back().xformation;
+  entry.cull_rect = xformation_stack_.back().cull_rect;
   entry.stencil_depth = xformation_stack_.back().stencil_depth;
   if (create_subpass) {
     entry.is_subpass = true;
@@ -137,7 +138,41 @@ void Canvas::RestoreToCount(size_t count) {
   }
 }
 
+bool Canvas::ShouldCull(const std::optional<Rect>& bounds,
+                        const Paint& paint) const {
+  const auto& cull_rect = xformation_stack_.back().cull_rect;
+  if (!cull_rect.has_value() || !bounds.has_value()) {
+    return false;
+  }
+  // Image filters and mask blurs can paint well outside the geometry, so
+  // draws that use them are never rejected at record time.
+  if (paint.image_filter.has_value() ||
+      paint.mask_blur_descriptor.has_value()) {
+    return false;
+  }
+  auto coverage = bounds.value();
+  if (paint.style == Paint::Style::kStroke) {
+    // Strokes extend half the stroke width beyond the path bounds on every
+    // side. The padding is applied in local space, where the width is
+    // defined, and rounded up to cover hairlines.
+    auto pad = std::max(paint.stroke_width / 2.0f, 1.0f);
+    coverage = Rect::MakeXYWH(coverage.origin.x - pad,          //
+                              coverage.origin.y - pad,          //
+                              coverage.size.width + 2.0f * pad,  //
+                              coverage.size.height + 2.0f * pad);
+  }
+  // The intersect clips that produced the cull bounds prevent anything from
+  // rendering outside them, so blend modes don't need consideration here.
+  return cull_rect->size.IsEmpty() ||
+         !cull_rect->IntersectsWithRect(
+             coverage.TransformBounds(GetCurrentTransformation()));
+}
+
 void Canvas::DrawPath(const Path& path, const Paint& paint) {
+  if (ShouldCull(path.GetBoundingBox(), paint)) {
+    return;
+  }
+
   Entity entity;
   entity.SetTransformation(GetCurrentTransformation());
   entity.SetStencilDepth(GetStencilDepth());
@@ -188,6 +223,10 @@ bool Canvas::AttemptDrawBlurredRRect(const Rect& rect,
 }
 
 void Canvas::DrawRect(Rect rect, Paint paint) {
+  if (ShouldCull(rect, paint)) {
+    return;
+  }
+
   if (AttemptDrawBlurredRRect(rect, 0, paint)) {
     return;
   }
@@ -206,14 +245,40 @@ void Canvas::DrawRRect(Rect rect, Scalar corner_radius, Paint paint) {
   if (AttemptDrawBlurredRRect(rect, corner_radius, paint)) {
     return;
   }
-  DrawPath(PathBuilder{}.AddRoundedRect(rect, corner_radius).TakePath(), paint);
+  DrawPath(PathBuilder{}
+               .SetConvexity(Path::Convexity::kConvex)
+               .AddRoundedRect(rect, corner_radius)
+               .TakePath(),
+           paint);
 }
 
 void Canvas::DrawCircle(Point center, Scalar radius, const Paint& paint) {
-  DrawPath(PathBuilder{}.AddCircle(center, radius).TakePath(), paint);
+  DrawPath(PathBuilder{}
+               .SetConvexity(Path::Convexity::kConvex)
+               .AddCircle(center, radius)
+               .TakePath(),
+           paint);
 }
 
 void Canvas::ClipPath(const Path& path, Entity::ClipOperation clip_op) {
+  if (clip_op == Entity::ClipOperation::kIntersect) {
+    // Intersect clips can only shrink coverage; fold their device space
+    // bounds into the cull bounds so later draws that miss them entirely
+    // can be dropped at record time. Difference clips are ignored since
+    // they never reduce the reachable area to a single rectangle.
+    if (auto bounds = path.GetBoundingBox(); bounds.has_value()) {
+      auto device_bounds =
+          bounds->TransformBounds(GetCurrentTransformation());
+      auto& cull_rect = xformation_stack_.back().cull_rect;
+      if (cull_rect.has_value()) {
+        // An empty intersection means every subsequent draw is culled.
+        cull_rect = cull_rect->Intersection(device_bounds).value_or(Rect{});
+      } else {
+        cull_rect = device_bounds;
+      }
+    }
+  }
+
   auto contents = std::make_shared<ClipContents>();
   contents->SetGeometry(Geometry::MakeFillPath(path));
   contents->SetClipOperation(clip_op);
@@ -285,6 +350,10 @@ void Canvas::DrawImageRect(const std::shared_ptr<Image>& image,
     return;
   }
 
+  if (ShouldCull(dest, paint)) {
+    return;
+  }
+
   auto contents = TextureContents::MakeRect(dest);
   contents->SetTexture(image->GetTexture());
   contents->SetSourceRect(source);
@@ -364,6 +433,10 @@ void Canvas::DrawTextFrame(const TextFrame& text_frame,
 void Canvas::DrawVertices(const Vertices& vertices,
                           BlendMode blend_mode,
                           Paint paint) {
+  if (ShouldCull(vertices.GetBoundingBox(), paint)) {
+    return;
+  }
+
   auto geometry = Geometry::MakeVertices(vertices);
 
   Entity entity;
@@ -132,6 +132,8 @@ class Canvas {
 
   void RestoreClip();
 
+  bool ShouldCull(const std::optional<Rect>& bounds, const Paint& paint) const;
+
   bool AttemptDrawBlurredRRect(const Rect& rect,
                                Scalar corner_radius,
                                Paint& paint);
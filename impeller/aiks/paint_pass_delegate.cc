@@ -28,7 +28,21 @@ bool PaintPassDelegate::CanElide() {
 
 // |EntityPassDelgate|
 bool PaintPassDelegate::CanCollapseIntoParentPass() {
-  return false;
+  // A subpass is only semantically required when the paint does something
+  // to the layer's composited contents as a whole. A paint that would
+  // render the subpass texture unmodified — full opacity, a source-over
+  // blend, and no filters — can instead have the layer's entities drawn
+  // directly into the parent pass, skipping the offscreen texture, its
+  // MSAA resolve, and the copy back.
+  //
+  // Layers with partial opacity cannot be collapsed this way: applying
+  // the opacity to each child draw individually is only equivalent when
+  // the children don't overlap, which isn't known here.
+  return paint_.color.IsOpaque() &&
+         paint_.blend_mode == BlendMode::kSourceOver &&
+         !paint_.image_filter.has_value() &&
+         !paint_.color_filter.has_value() &&
+         !paint_.mask_blur_descriptor.has_value();
 }
 
 // |EntityPassDelgate|
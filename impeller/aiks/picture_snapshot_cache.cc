@@ -0,0 +1,60 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/aiks/picture_snapshot_cache.h"
+
+#include "impeller/aiks/picture.h"
+
+namespace impeller {
+
+PictureSnapshotCache::PictureSnapshotCache(size_t access_threshold)
+    : access_threshold_(access_threshold) {}
+
+PictureSnapshotCache::~PictureSnapshotCache() = default;
+
+std::optional<Snapshot> PictureSnapshotCache::Get(AiksContext& context,
+                                                  const Picture& picture,
+                                                  uint64_t picture_id) {
+  auto& entry = entries_[picture_id];
+  entry.used_this_frame = true;
+  entry.accesses_since_visible++;
+
+  if (entry.snapshot.has_value()) {
+    return entry.snapshot;
+  }
+
+  // A zero threshold disables caching, mirroring the flow-level cache.
+  if (access_threshold_ == 0 ||
+      entry.accesses_since_visible < access_threshold_) {
+    return std::nullopt;
+  }
+
+  if (!picture.pass) {
+    return std::nullopt;
+  }
+
+  // Snapshotting rebases the entity transforms onto the coverage origin, so
+  // render a clone and leave the caller's picture untouched.
+  Picture copy;
+  copy.pass = picture.pass->Clone();
+  entry.snapshot = copy.Snapshot(context);
+  return entry.snapshot;
+}
+
+void PictureSnapshotCache::SweepAfterFrame() {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (!it->second.used_this_frame) {
+      it = entries_.erase(it);
+    } else {
+      it->second.used_this_frame = false;
+      ++it;
+    }
+  }
+}
+
+size_t PictureSnapshotCache::GetCachedEntryCount() const {
+  return entries_.size();
+}
+
+}  // namespace impeller
@@ -0,0 +1,64 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+
+#include "flutter/fml/macros.h"
+#include "impeller/renderer/snapshot.h"
+
+namespace impeller {
+
+class AiksContext;
+struct Picture;
+
+/// A cache of rendered picture snapshots, Impeller's analogue of the
+/// flow-level raster cache. Stable pictures render their entity pass tree
+/// once to an offscreen texture; subsequent frames draw the snapshot as a
+/// single textured quad instead of replaying every entity.
+class PictureSnapshotCache {
+ public:
+  /// The number of times a picture must be requested before a snapshot is
+  /// rendered and admitted. Matches the flow-level raster cache default.
+  static constexpr size_t kDefaultAccessThreshold = 3u;
+
+  explicit PictureSnapshotCache(
+      size_t access_threshold = kDefaultAccessThreshold);
+
+  ~PictureSnapshotCache();
+
+  /// Returns the cached snapshot for |picture_id|, rendering and admitting
+  /// one once the picture has been requested |access_threshold| times.
+  /// Returns std::nullopt while the picture is not yet admitted (callers
+  /// render the entity tree directly in that case) or if it cannot be
+  /// snapshotted. The caller's picture is left untouched; the snapshot is
+  /// rendered from a clone of its entity pass.
+  std::optional<Snapshot> Get(AiksContext& context,
+                              const Picture& picture,
+                              uint64_t picture_id);
+
+  /// Drops entries that were not requested since the previous sweep. Called
+  /// once per frame so snapshots of pictures that left the scene release
+  /// their textures.
+  void SweepAfterFrame();
+
+  size_t GetCachedEntryCount() const;
+
+ private:
+  struct Entry {
+    size_t accesses_since_visible = 0;
+    bool used_this_frame = false;
+    std::optional<Snapshot> snapshot;
+  };
+
+  const size_t access_threshold_;
+  std::map<uint64_t, Entry> entries_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PictureSnapshotCache);
+};
+
+}  // namespace impeller
@@ -26,6 +26,23 @@ bool Archive::IsValid() const {
   return database_->IsValid();
 }
 
+bool Archive::WriteBatch(const std::function<bool(Archive&)>& batch_writes) {
+  if (!IsValid() || !batch_writes) {
+    return false;
+  }
+
+  auto transaction = database_->CreateTransaction(transaction_count_);
+
+  // The nested writes see a non-zero transaction count and join this
+  // transaction instead of opening (and committing) their own.
+  if (!batch_writes(*this)) {
+    return false;
+  }
+
+  transaction.MarkWritesAsReadyForCommit();
+  return true;
+}
+
 std::optional<int64_t /* row id */> Archive::ArchiveInstance(
     const ArchiveDef& definition,
     const Archivable& archivable) {
@@ -42,7 +59,7 @@ std::optional<int64_t /* row id */> Archive::ArchiveInstance(
     return std::nullopt;
   }
 
-  auto statement = registration->CreateInsertStatement();
+  auto& statement = registration->GetInsertStatement();
 
   if (!statement.IsValid() || !statement.Reset()) {
     /*
@@ -122,7 +139,7 @@ size_t Archive::UnarchiveInstances(const ArchiveDef& definition,
 
   const bool isQueryingSingle = primary_key.has_value();
 
-  auto statement = registration->CreateQueryStatement(isQueryingSingle);
+  auto& statement = registration->GetQueryStatement(isQueryingSingle);
 
   if (!statement.IsValid() || !statement.Reset()) {
     return 0;
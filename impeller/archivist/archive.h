@@ -41,6 +41,19 @@ class Archive {
     return UnarchiveInstance(def, name, archivable);
   }
 
+  //----------------------------------------------------------------------------
+  /// @brief      Group many writes into a single transaction. Each write
+  ///             performed by the callback joins the enclosing transaction
+  ///             instead of committing (and syncing the log) on its own,
+  ///             which is dramatically cheaper when persisting many items
+  ///             at once. If the callback returns false, every write made
+  ///             within it is rolled back.
+  ///
+  /// @return     If the batch was committed.
+  ///
+  [[nodiscard]] bool WriteBatch(
+      const std::function<bool(Archive&)>& batch_writes);
+
   using UnarchiveStep = std::function<bool(ArchiveLocation&)>;
 
   template <class T,
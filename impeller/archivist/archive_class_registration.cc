@@ -83,6 +83,24 @@ bool ArchiveClassRegistration::CreateTable() {
   return statement.Execute() == ArchiveStatement::Result::kDone;
 }
 
+ArchiveStatement& ArchiveClassRegistration::GetInsertStatement() const {
+  if (!insert_statement_) {
+    insert_statement_ =
+        std::make_unique<ArchiveStatement>(CreateInsertStatement());
+  }
+  return *insert_statement_;
+}
+
+ArchiveStatement& ArchiveClassRegistration::GetQueryStatement(
+    bool single) const {
+  auto& statement = single ? single_query_statement_ : all_query_statement_;
+  if (!statement) {
+    statement =
+        std::make_unique<ArchiveStatement>(CreateQueryStatement(single));
+  }
+  return *statement;
+}
+
 ArchiveStatement ArchiveClassRegistration::CreateQueryStatement(
     bool single) const {
   std::stringstream stream;
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <map>
+#include <memory>
 #include <optional>
 
 #include "flutter/fml/macros.h"
@@ -23,9 +24,19 @@ class ArchiveClassRegistration {
 
   size_t GetMemberCount() const;
 
-  ArchiveStatement CreateInsertStatement() const;
+  //----------------------------------------------------------------------------
+  /// @brief      Get the insert statement for this class. The statement is
+  ///             prepared on first use and cached for the lifetime of the
+  ///             registration; callers must |Reset| it before binding new
+  ///             values.
+  ///
+  ArchiveStatement& GetInsertStatement() const;
 
-  ArchiveStatement CreateQueryStatement(bool single) const;
+  //----------------------------------------------------------------------------
+  /// @brief      Get the query statement for this class, prepared on first
+  ///             use and cached like the insert statement.
+  ///
+  ArchiveStatement& GetQueryStatement(bool single) const;
 
  private:
   using MemberColumnMap = std::map<std::string, size_t>;
@@ -39,8 +50,15 @@ class ArchiveClassRegistration {
   ArchiveDatabase& database_;
   const ArchiveDef definition_;
   MemberColumnMap column_map_;
+  mutable std::unique_ptr<ArchiveStatement> insert_statement_;
+  mutable std::unique_ptr<ArchiveStatement> single_query_statement_;
+  mutable std::unique_ptr<ArchiveStatement> all_query_statement_;
   bool is_valid_ = false;
 
+  ArchiveStatement CreateInsertStatement() const;
+
+  ArchiveStatement CreateQueryStatement(bool single) const;
+
   FML_DISALLOW_COPY_AND_ASSIGN(ArchiveClassRegistration);
 };
 
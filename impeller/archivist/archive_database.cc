@@ -30,6 +30,19 @@ struct ArchiveDatabase::Handle {
       return;
     }
 
+    // Write-ahead logging trades the full fsync per transaction of rollback
+    // journaling for a single append to the log, and lets readers proceed
+    // while a writer is active. Synchronous NORMAL is durable enough for
+    // cache and calibration data: a power loss can drop the most recent
+    // transactions but can never corrupt the database.
+    ::sqlite3_exec(db, "PRAGMA journal_mode=WAL;", nullptr, nullptr, nullptr);
+    ::sqlite3_exec(db, "PRAGMA synchronous=NORMAL;", nullptr, nullptr, nullptr);
+    // Serve reads from pages mapped directly from the database file rather
+    // than copies in the connection's page cache. In-memory databases (as
+    // used by the test fixtures) ignore this.
+    ::sqlite3_exec(db, "PRAGMA mmap_size=268435456;", nullptr, nullptr,
+                   nullptr);
+
     handle_ = db;
   }
 
@@ -19,6 +19,8 @@ namespace impeller {
 ///
 class ArchiveStatement {
  public:
+  ArchiveStatement(ArchiveStatement&& other);
+
   ~ArchiveStatement();
 
   bool IsValid() const;
@@ -196,5 +196,48 @@ TEST_F(ArchiveTest, CanReadWriteVectorOfArchivables) {
   ASSERT_TRUE(read_success);
 }
 
+TEST_F(ArchiveTest, CanWriteBatchInSingleTransaction) {
+  Archive archive(GetArchiveFileName().c_str());
+  ASSERT_TRUE(archive.IsValid());
+
+  std::vector<uint64_t> keys;
+  ASSERT_TRUE(archive.WriteBatch([&keys](Archive& archive) {
+    for (size_t i = 0; i < 100u; i++) {
+      Sample sample(i + 2000);
+      keys.push_back(sample.GetPrimaryKey().value());
+      if (!archive.Write(sample)) {
+        return false;
+      }
+    }
+    return true;
+  }));
+
+  for (size_t i = 0; i < keys.size(); i++) {
+    Sample sample;
+    ASSERT_TRUE(archive.Read(keys[i], sample));
+    ASSERT_EQ(sample.GetSomeData(), i + 2000);
+  }
+}
+
+TEST_F(ArchiveTest, FailedBatchWritesAreRolledBack) {
+  Archive archive(GetArchiveFileName().c_str());
+  ASSERT_TRUE(archive.IsValid());
+
+  std::optional<uint64_t> key;
+  ASSERT_FALSE(archive.WriteBatch([&key](Archive& archive) {
+    Sample sample(1979);
+    key = sample.GetPrimaryKey();
+    if (!archive.Write(sample)) {
+      return false;
+    }
+    // Something else in the batch went wrong; nothing may be committed.
+    return false;
+  }));
+
+  ASSERT_TRUE(key.has_value());
+  Sample sample;
+  ASSERT_FALSE(archive.Read(key.value(), sample));
+}
+
 }  // namespace testing
 }  // namespace impeller
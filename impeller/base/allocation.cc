@@ -39,6 +39,10 @@ bool Allocation::Truncate(size_t length, bool npot) {
   return true;
 }
 
+void Allocation::Rewind() {
+  length_ = 0u;
+}
+
 uint32_t Allocation::NextPowerOfTwoSize(uint32_t x) {
   if (x == 0) {
     return 1;
@@ -26,6 +26,12 @@ class Allocation {
 
   [[nodiscard]] bool Truncate(size_t length, bool npot = true);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Resets the length to zero without releasing the reserved
+  ///             allocation so the storage can be reused.
+  ///
+  void Rewind();
+
   static uint32_t NextPowerOfTwoSize(uint32_t x);
 
  private:
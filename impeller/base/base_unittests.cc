@@ -2,8 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
+
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/testing/testing.h"
 #include "impeller/base/thread.h"
+#include "impeller/base/work_queue_common.h"
 
 namespace impeller {
 namespace testing {
@@ -68,5 +72,48 @@ TEST(ThreadTest, CanCreateRWMutexLock) {
   // f.mtx.UnlockReader(); <--- Static analysis error.
 }
 
+TEST(WorkQueueTest, ExecutesAllPostedTasks) {
+  auto queue = WorkQueueCommon::Create();
+  constexpr size_t task_count = 64u;
+  std::atomic_size_t executions = {0u};
+  fml::CountDownLatch latch(task_count);
+  auto task = [&executions, &latch]() {
+    executions++;
+    latch.CountDown();
+  };
+  // Mix unhinted posts with both priority classes across several affinity
+  // hints; every task must run exactly once regardless of which worker
+  // queue it lands on or which worker steals it.
+  for (size_t i = 0u; i < task_count; i++) {
+    switch (i % 3u) {
+      case 0u:
+        queue->PostTask(task);
+        break;
+      case 1u:
+        queue->PostTask(task, WorkQueuePriority::kFrameCritical, i);
+        break;
+      default:
+        queue->PostTask(task, WorkQueuePriority::kBackground, i);
+        break;
+    }
+  }
+  latch.Wait();
+  ASSERT_EQ(executions, task_count);
+}
+
+TEST(WorkQueueTest, DrainsQueuedTasksOnTermination) {
+  std::atomic_size_t executions = {0u};
+  constexpr size_t task_count = 16u;
+  {
+    auto queue = WorkQueueCommon::Create();
+    for (size_t i = 0u; i < task_count; i++) {
+      queue->PostTask([&executions]() { executions++; },
+                      WorkQueuePriority::kBackground, i);
+    }
+  }
+  // The destructor joins the workers only after every queue is empty.
+  ASSERT_EQ(executions, task_count);
+}
+
 }  // namespace testing
 }  // namespace impeller
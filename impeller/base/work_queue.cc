@@ -10,4 +10,10 @@ WorkQueue::WorkQueue() = default;
 
 WorkQueue::~WorkQueue() = default;
 
+void WorkQueue::PostTask(fml::closure task,
+                         WorkQueuePriority priority,
+                         uint64_t affinity_hint) {
+  PostTask(std::move(task));
+}
+
 }  // namespace impeller
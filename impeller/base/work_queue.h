@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "flutter/fml/closure.h"
@@ -11,12 +12,36 @@
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// @brief      The scheduling class of a task posted to a work queue.
+///
+enum class WorkQueuePriority {
+  /// Work a frame is (or will shortly be) waiting on. Runs before any
+  /// background work.
+  kFrameCritical,
+  /// Work that only improves future frames, such as pipeline warmup,
+  /// texture uploads ahead of first use, or speculative tessellation.
+  kBackground,
+};
+
 class WorkQueue : public std::enable_shared_from_this<WorkQueue> {
  public:
   virtual ~WorkQueue();
 
   virtual void PostTask(fml::closure task) = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Post a task with a scheduling priority and an affinity
+  ///             hint. Tasks posted with the same hint are queued to the
+  ///             same worker where possible, keeping related jobs (and
+  ///             their warmed caches) together. The hint is advisory only;
+  ///             idle workers steal tasks regardless. The default
+  ///             implementation ignores both hints.
+  ///
+  virtual void PostTask(fml::closure task,
+                        WorkQueuePriority priority,
+                        uint64_t affinity_hint);
+
  protected:
   WorkQueue();
 
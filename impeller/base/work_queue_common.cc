@@ -4,22 +4,121 @@
 
 #include "impeller/base/work_queue_common.h"
 
+#include <algorithm>
+
+#include "flutter/fml/thread.h"
+#include "impeller/base/strings.h"
+
 namespace impeller {
 
 std::shared_ptr<WorkQueueCommon> WorkQueueCommon::Create() {
   return std::shared_ptr<WorkQueueCommon>(new WorkQueueCommon());
 }
 
-WorkQueueCommon::WorkQueueCommon()
-    : loop_(fml::ConcurrentMessageLoop::Create(2u)) {}
+WorkQueueCommon::WorkQueueCommon() {
+  const auto worker_count = std::clamp<size_t>(
+      std::thread::hardware_concurrency() / 2u, 2u, 4u);
+  for (size_t i = 0u; i < worker_count; i++) {
+    workers_.emplace_back(std::make_unique<Worker>());
+  }
+  // The workers may begin stealing immediately, so all of them are created
+  // only once the worker vector is complete.
+  for (size_t i = 0u; i < worker_count; i++) {
+    workers_[i]->thread = std::thread([this, i]() { WorkerMain(i); });
+  }
+}
 
 WorkQueueCommon::~WorkQueueCommon() {
-  loop_->Terminate();
+  {
+    std::scoped_lock lock(wakeup_mutex_);
+    terminated_ = true;
+  }
+  wakeup_cv_.notify_all();
+  for (auto& worker : workers_) {
+    worker->thread.join();
+  }
+}
+
+void WorkQueueCommon::WorkerMain(size_t worker_index) {
+  fml::Thread::SetCurrentThreadName(
+      fml::Thread::ThreadConfig(SPrintF("impeller.wq.%zu", worker_index)));
+  while (true) {
+    if (auto task = TakeNextTask(worker_index)) {
+      task();
+      continue;
+    }
+    std::unique_lock lock(wakeup_mutex_);
+    wakeup_cv_.wait(lock, [this]() {
+      return terminated_ || pending_task_count_ > 0u;
+    });
+    if (terminated_ && pending_task_count_ == 0u) {
+      // Termination drains: queued tasks keep workers looping above until
+      // every queue in the pool is empty.
+      return;
+    }
+  }
+}
+
+fml::closure WorkQueueCommon::TakeNextTask(size_t worker_index) {
+  const auto worker_count = workers_.size();
+  // Local frame-critical work first, then frame-critical work stolen from a
+  // peer, and only then the same sweep over background work.
+  for (auto priority :
+       {WorkQueuePriority::kFrameCritical, WorkQueuePriority::kBackground}) {
+    for (size_t i = 0u; i < worker_count; i++) {
+      auto& worker = *workers_[(worker_index + i) % worker_count];
+      std::scoped_lock lock(worker.mutex);
+      auto& tasks = priority == WorkQueuePriority::kFrameCritical
+                        ? worker.frame_critical_tasks
+                        : worker.background_tasks;
+      if (tasks.empty()) {
+        continue;
+      }
+      fml::closure task;
+      if (i == 0u) {
+        task = std::move(tasks.front());
+        tasks.pop_front();
+      } else {
+        // Steal from the back to leave the peer the tasks it queued first.
+        task = std::move(tasks.back());
+        tasks.pop_back();
+      }
+      pending_task_count_.fetch_sub(1u);
+      return task;
+    }
+  }
+  return nullptr;
 }
 
 // |WorkQueue|
 void WorkQueueCommon::PostTask(fml::closure task) {
-  loop_->GetTaskRunner()->PostTask(task);
+  // Unhinted posts round-robin across workers so they spread evenly.
+  PostTask(std::move(task), WorkQueuePriority::kBackground,
+           round_robin_.fetch_add(1u));
+}
+
+// |WorkQueue|
+void WorkQueueCommon::PostTask(fml::closure task,
+                               WorkQueuePriority priority,
+                               uint64_t affinity_hint) {
+  if (!task) {
+    return;
+  }
+  auto& worker = *workers_[affinity_hint % workers_.size()];
+  {
+    std::scoped_lock lock(worker.mutex);
+    auto& tasks = priority == WorkQueuePriority::kFrameCritical
+                      ? worker.frame_critical_tasks
+                      : worker.background_tasks;
+    tasks.emplace_back(std::move(task));
+  }
+  pending_task_count_.fetch_add(1u);
+  {
+    // Taking and dropping the wakeup lock orders this notification after
+    // any in-flight predicate check, preventing a missed wakeup.
+    std::scoped_lock lock(wakeup_mutex_);
+  }
+  wakeup_cv_.notify_one();
 }
 
 }  // namespace impeller
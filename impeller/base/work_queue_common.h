@@ -4,14 +4,29 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
-#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "impeller/base/work_queue.h"
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// @brief      A work-stealing pool of renderer background workers. Each
+///             worker owns a pair of local task queues, one per priority
+///             class; a task's affinity hint selects the worker whose
+///             queues it lands on. Workers drain their own frame-critical
+///             queue first, then steal frame-critical work from their
+///             peers, and only then fall back to background work in the
+///             same order. An idle worker therefore never sleeps while any
+///             queue in the pool has work.
+///
 class WorkQueueCommon : public WorkQueue {
  public:
   static std::shared_ptr<WorkQueueCommon> Create();
@@ -20,13 +35,37 @@ class WorkQueueCommon : public WorkQueue {
   ~WorkQueueCommon();
 
  private:
-  std::shared_ptr<fml::ConcurrentMessageLoop> loop_;
+  struct Worker {
+    std::mutex mutex;
+    // Both deques are guarded by |mutex|. Owners pop from the front and
+    // thieves pop from the back.
+    std::deque<fml::closure> frame_critical_tasks;
+    std::deque<fml::closure> background_tasks;
+    std::thread thread;
+  };
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::mutex wakeup_mutex_;
+  std::condition_variable wakeup_cv_;
+  std::atomic_size_t pending_task_count_ = {0u};
+  std::atomic_uint64_t round_robin_ = {0u};
+  // Guarded by |wakeup_mutex_|.
+  bool terminated_ = false;
 
   WorkQueueCommon();
 
+  void WorkerMain(size_t worker_index);
+
+  fml::closure TakeNextTask(size_t worker_index);
+
   // |WorkQueue|
   void PostTask(fml::closure task) override;
 
+  // |WorkQueue|
+  void PostTask(fml::closure task,
+                WorkQueuePriority priority,
+                uint64_t affinity_hint) override;
+
   FML_DISALLOW_COPY_AND_ASSIGN(WorkQueueCommon);
 };
 
@@ -25,6 +25,18 @@ constexpr BlobShaderType ToShaderType(fb::Stage stage) {
   FML_UNREACHABLE();
 }
 
+constexpr fb::Stage ToStage(BlobShaderType type) {
+  switch (type) {
+    case BlobShaderType::kVertex:
+      return fb::Stage::kVertex;
+    case BlobShaderType::kFragment:
+      return fb::Stage::kFragment;
+    case BlobShaderType::kCompute:
+      return fb::Stage::kCompute;
+  }
+  FML_UNREACHABLE();
+}
+
 BlobLibrary::BlobLibrary(std::shared_ptr<fml::Mapping> payload)
     : payload_(std::move(payload)) {
   if (!payload_ || payload_->GetMapping() == nullptr) {
@@ -37,25 +49,11 @@ BlobLibrary::BlobLibrary(std::shared_ptr<fml::Mapping> payload)
     return;
   }
 
-  auto blob_library = fb::GetBlobLibrary(payload_->GetMapping());
-  if (!blob_library) {
+  blob_library_ = fb::GetBlobLibrary(payload_->GetMapping());
+  if (!blob_library_) {
     return;
   }
 
-  if (auto items = blob_library->items()) {
-    for (auto i = items->begin(), end = items->end(); i != end; i++) {
-      BlobKey key;
-      key.name = i->name()->str();
-      key.type = ToShaderType(i->stage());
-      blobs_[key] = std::make_shared<fml::NonOwnedMapping>(
-          i->mapping()->Data(), i->mapping()->size(),
-          [payload = payload_](auto, auto) {
-            // The pointers are into the base payload. Instead of copying the
-            // data, just hold onto the payload.
-          });
-    }
-  }
-
   is_valid_ = true;
 }
 
@@ -68,16 +66,58 @@ bool BlobLibrary::IsValid() const {
 }
 
 size_t BlobLibrary::GetShaderCount() const {
-  return blobs_.size();
+  if (!is_valid_ || !blob_library_->items()) {
+    return 0u;
+  }
+  return blob_library_->items()->size();
+}
+
+static std::shared_ptr<fml::Mapping> CreateBlobMapping(
+    const fb::Blob* blob,
+    const std::shared_ptr<fml::Mapping>& payload) {
+  if (!blob || !blob->mapping()) {
+    return nullptr;
+  }
+  return std::make_shared<fml::NonOwnedMapping>(blob->mapping()->Data(),
+                                                blob->mapping()->size(),
+                                                [payload](auto, auto) {
+                                                  // The pointers are into the
+                                                  // base payload. Instead of
+                                                  // copying the data, just
+                                                  // hold onto the payload.
+                                                });
 }
 
 std::shared_ptr<fml::Mapping> BlobLibrary::GetMapping(BlobShaderType type,
                                                       std::string name) const {
-  BlobKey key;
-  key.type = type;
-  key.name = std::move(name);
-  auto found = blobs_.find(key);
-  return found == blobs_.end() ? nullptr : found->second;
+  if (!is_valid_ || !blob_library_->items()) {
+    return nullptr;
+  }
+
+  auto items = blob_library_->items();
+
+  auto matches = [&](const fb::Blob* blob) {
+    return blob != nullptr && blob->stage() == ToStage(type) &&
+           blob->name() != nullptr && name == blob->name()->c_str();
+  };
+
+  // Writers sort blobs by hash, so the common case is a binary search
+  // directly against the memory mapped item vector.
+  const fb::Blob* found = items->LookupByKey(BlobHash(type, name.c_str()));
+  if (matches(found)) {
+    return CreateBlobMapping(found, payload_);
+  }
+
+  // Libraries written before hashes were introduced (or, vanishingly
+  // unlikely, a hash collision) fall back to a linear scan.
+  for (size_t i = 0u, count = items->size(); i < count; i++) {
+    auto blob = items->Get(i);
+    if (matches(blob)) {
+      return CreateBlobMapping(blob, payload_);
+    }
+  }
+
+  return nullptr;
 }
 
 size_t BlobLibrary::IterateAllBlobs(
@@ -85,13 +125,19 @@ size_t BlobLibrary::IterateAllBlobs(
                              const std::string& name,
                              const std::shared_ptr<fml::Mapping>& mapping)>&
         callback) const {
-  if (!IsValid() || !callback) {
+  if (!IsValid() || !callback || !blob_library_->items()) {
     return 0u;
   }
   size_t count = 0u;
-  for (const auto& blob : blobs_) {
+  auto items = blob_library_->items();
+  for (size_t i = 0u, item_count = items->size(); i < item_count; i++) {
+    auto blob = items->Get(i);
+    auto mapping = CreateBlobMapping(blob, payload_);
+    if (!mapping || blob->name() == nullptr) {
+      continue;
+    }
     count++;
-    if (!callback(blob.first.type, blob.first.name, blob.second)) {
+    if (!callback(ToShaderType(blob->stage()), blob->name()->str(), mapping)) {
       break;
     }
   }
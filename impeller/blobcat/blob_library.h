@@ -4,17 +4,20 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
-#include <type_traits>
-#include <unordered_map>
+#include <string>
 
-#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/mapping.h"
 #include "impeller/blobcat/blob_types.h"
 
 namespace impeller {
 
+namespace fb {
+struct BlobLibrary;
+}  // namespace fb
+
 class BlobLibrary {
  public:
   explicit BlobLibrary(std::shared_ptr<fml::Mapping> payload);
@@ -37,32 +40,10 @@ class BlobLibrary {
       const;
 
  private:
-  struct BlobKey {
-    BlobShaderType type = BlobShaderType::kFragment;
-    std::string name;
-
-    struct Hash {
-      size_t operator()(const BlobKey& key) const {
-        return fml::HashCombine(
-            static_cast<std::underlying_type_t<decltype(key.type)>>(key.type),
-            key.name);
-      }
-    };
-
-    struct Equal {
-      bool operator()(const BlobKey& lhs, const BlobKey& rhs) const {
-        return lhs.type == rhs.type && lhs.name == rhs.name;
-      }
-    };
-  };
-
-  using Blobs = std::unordered_map<BlobKey,
-                                   std::shared_ptr<fml::Mapping>,
-                                   BlobKey::Hash,
-                                   BlobKey::Equal>;
-
   std::shared_ptr<fml::Mapping> payload_;
-  Blobs blobs_;
+  // Lookups binary search the memory mapped item vector by blob hash; no
+  // per-blob work happens until a shader is first requested.
+  const fb::BlobLibrary* blob_library_ = nullptr;
   bool is_valid_ = false;
 
   FML_DISALLOW_COPY_AND_ASSIGN(BlobLibrary);
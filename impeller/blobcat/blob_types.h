@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace impeller {
 
 enum class BlobShaderType {
@@ -12,4 +14,19 @@ enum class BlobShaderType {
   kCompute,
 };
 
+//------------------------------------------------------------------------------
+/// @brief      The stable (FNV-1a) hash of a blob's name and shader stage
+///             stored in the blob library. Writers sort blobs by this hash so
+///             libraries can binary search the memory mapped payload directly
+///             without constructing a lookup table at load.
+///
+constexpr uint64_t BlobHash(BlobShaderType type, const char* name) {
+  uint64_t hash = 0xcbf29ce484222325u;
+  while (*name != '\0') {
+    hash = (hash ^ static_cast<uint8_t>(*name++)) * 0x100000001b3u;
+  }
+  hash = (hash ^ static_cast<uint64_t>(type)) * 0x100000001b3u;
+  return hash;
+}
+
 }  // namespace impeller
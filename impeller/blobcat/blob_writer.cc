@@ -4,6 +4,7 @@
 
 #include "impeller/blobcat/blob_writer.h"
 
+#include <algorithm>
 #include <array>
 #include <filesystem>
 #include <optional>
@@ -105,10 +106,16 @@ std::shared_ptr<fml::Mapping> BlobWriter::CreateMapping() const {
     auto desc = std::make_unique<fb::BlobT>();
     desc->name = blob_description.name;
     desc->stage = ToStage(blob_description.type);
+    desc->hash = BlobHash(blob_description.type, blob_description.name.c_str());
     desc->mapping = {mapping->GetMapping(),
                      mapping->GetMapping() + mapping->GetSize()};
     blobs.items.emplace_back(std::move(desc));
   }
+  // Sort by hash so libraries can binary search the item vector in place.
+  std::sort(blobs.items.begin(), blobs.items.end(),
+            [](const auto& lhs, const auto& rhs) {  //
+              return lhs->hash < rhs->hash;
+            });
   auto builder = std::make_shared<flatbuffers::FlatBufferBuilder>();
   builder->Finish(fb::BlobLibrary::Pack(*builder.get(), &blobs),
                   fb::BlobLibraryIdentifier());
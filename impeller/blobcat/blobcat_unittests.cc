@@ -51,6 +51,24 @@ TEST(BlobTest, CanReadAndWriteBlobs) {
   auto hello_vtx = library.GetMapping(BlobShaderType::kVertex, "Hello");
   ASSERT_NE(hello_vtx, nullptr);
   ASSERT_EQ(CreateStringFromMapping(*hello_vtx), "World");
+
+  // Unknown name.
+  ASSERT_EQ(library.GetMapping(BlobShaderType::kVertex, "Quux"), nullptr);
+
+  // Every blob must be found regardless of where it lands in the
+  // hash-sorted item vector.
+  auto foo_frag = library.GetMapping(BlobShaderType::kFragment, "Foo");
+  ASSERT_NE(foo_frag, nullptr);
+  ASSERT_EQ(CreateStringFromMapping(*foo_frag), "Bar");
+  auto baz_vtx = library.GetMapping(BlobShaderType::kVertex, "Baz");
+  ASSERT_NE(baz_vtx, nullptr);
+  ASSERT_EQ(CreateStringFromMapping(*baz_vtx), "Bang");
+  auto ping_vtx = library.GetMapping(BlobShaderType::kVertex, "Ping");
+  ASSERT_NE(ping_vtx, nullptr);
+  ASSERT_EQ(CreateStringFromMapping(*ping_vtx), "Pong");
+  auto pang_frag = library.GetMapping(BlobShaderType::kFragment, "Pang");
+  ASSERT_NE(pang_frag, nullptr);
+  ASSERT_EQ(CreateStringFromMapping(*pang_frag), "World");
 }
 
 }  // namespace testing
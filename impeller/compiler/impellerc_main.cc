@@ -2,8 +2,13 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
 #include <filesystem>
+#include <mutex>
+#include <sstream>
 #include <system_error>
+#include <thread>
+#include <vector>
 
 #include "flutter/fml/backtrace.h"
 #include "flutter/fml/command_line.h"
@@ -36,24 +41,16 @@ static bool SetPermissiveAccess(const std::filesystem::path& p) {
   return true;
 }
 
-bool Main(const fml::CommandLine& command_line) {
-  fml::InstallCrashHandler();
-  if (command_line.HasOption("help")) {
-    Switches::PrintHelp(std::cout);
-    return true;
-  }
-
-  Switches switches(command_line);
-  if (!switches.AreValid(std::cerr)) {
-    std::cerr << "Invalid flags specified." << std::endl;
-    Switches::PrintHelp(std::cerr);
-    return false;
-  }
-
+//------------------------------------------------------------------------------
+/// @brief      Run a single compilation described by already validated
+///             switches. Diagnostics go to `error_stream` so concurrent batch
+///             entries do not interleave their output.
+///
+static bool Compile(const Switches& switches, std::ostream& error_stream) {
   auto source_file_mapping =
       fml::FileMapping::CreateReadOnly(switches.source_file_name);
   if (!source_file_mapping) {
-    std::cerr << "Could not open input file." << std::endl;
+    error_stream << "Could not open input file." << std::endl;
     return false;
   }
 
@@ -83,8 +80,8 @@ bool Main(const fml::CommandLine& command_line) {
 
   Compiler compiler(*source_file_mapping, options, reflector_options);
   if (!compiler.IsValid()) {
-    std::cerr << "Compilation failed." << std::endl;
-    std::cerr << compiler.GetErrorMessages() << std::endl;
+    error_stream << "Compilation failed." << std::endl;
+    error_stream << compiler.GetErrorMessages() << std::endl;
     return false;
   }
 
@@ -94,7 +91,7 @@ bool Main(const fml::CommandLine& command_line) {
           *switches.working_directory,
           reinterpret_cast<const char*>(spriv_file_name.u8string().c_str()),
           *compiler.GetSPIRVAssembly())) {
-    std::cerr << "Could not write file to " << switches.spirv_file_name
+    error_stream << "Could not write file to " << switches.spirv_file_name
               << std::endl;
     return false;
   }
@@ -106,17 +103,17 @@ bool Main(const fml::CommandLine& command_line) {
     if (is_runtime_stage_data) {
       auto reflector = compiler.GetReflector();
       if (reflector == nullptr) {
-        std::cerr << "Could not create reflector." << std::endl;
+        error_stream << "Could not create reflector." << std::endl;
         return false;
       }
       auto stage_data = reflector->GetRuntimeStageData();
       if (!stage_data) {
-        std::cerr << "Runtime stage information was nil." << std::endl;
+        error_stream << "Runtime stage information was nil." << std::endl;
         return false;
       }
       auto stage_data_mapping = stage_data->CreateMapping();
       if (!stage_data_mapping) {
-        std::cerr << "Runtime stage data could not be created." << std::endl;
+        error_stream << "Runtime stage data could not be created." << std::endl;
         return false;
       }
       if (!fml::WriteAtomically(*switches.working_directory,  //
@@ -124,7 +121,7 @@ bool Main(const fml::CommandLine& command_line) {
                                     sl_file_name.u8string().c_str()),  //
                                 *stage_data_mapping                    //
                                 )) {
-        std::cerr << "Could not write file to " << switches.sl_file_name
+        error_stream << "Could not write file to " << switches.sl_file_name
                   << std::endl;
         return false;
       }
@@ -138,7 +135,7 @@ bool Main(const fml::CommandLine& command_line) {
               *switches.working_directory,
               reinterpret_cast<const char*>(sl_file_name.u8string().c_str()),
               *compiler.GetSLShaderSource())) {
-        std::cerr << "Could not write file to " << switches.sl_file_name
+        error_stream << "Could not write file to " << switches.sl_file_name
                   << std::endl;
         return false;
       }
@@ -154,7 +151,7 @@ bool Main(const fml::CommandLine& command_line) {
               reinterpret_cast<const char*>(
                   reflection_json_name.u8string().c_str()),
               *compiler.GetReflector()->GetReflectionJSON())) {
-        std::cerr << "Could not write reflection json to "
+        error_stream << "Could not write reflection json to "
                   << switches.reflection_json_name << std::endl;
         return false;
       }
@@ -169,7 +166,7 @@ bool Main(const fml::CommandLine& command_line) {
               reinterpret_cast<const char*>(
                   reflection_header_name.u8string().c_str()),
               *compiler.GetReflector()->GetReflectionHeader())) {
-        std::cerr << "Could not write reflection header to "
+        error_stream << "Could not write reflection header to "
                   << switches.reflection_header_name << std::endl;
         return false;
       }
@@ -183,7 +180,7 @@ bool Main(const fml::CommandLine& command_line) {
                                 reinterpret_cast<const char*>(
                                     reflection_cc_name.u8string().c_str()),
                                 *compiler.GetReflector()->GetReflectionCC())) {
-        std::cerr << "Could not write reflection CC to "
+        error_stream << "Could not write reflection CC to "
                   << switches.reflection_cc_name << std::endl;
         return false;
       }
@@ -213,7 +210,7 @@ bool Main(const fml::CommandLine& command_line) {
             *switches.working_directory,
             reinterpret_cast<const char*>(depfile_path.u8string().c_str()),
             *compiler.CreateDepfileContents({result_file}))) {
-      std::cerr << "Could not write depfile to " << switches.depfile_path
+      error_stream << "Could not write depfile to " << switches.depfile_path
                 << std::endl;
       return false;
     }
@@ -222,6 +219,117 @@ bool Main(const fml::CommandLine& command_line) {
   return true;
 }
 
+static std::vector<std::string> TokenizeBatchLine(const std::string& line) {
+  std::vector<std::string> arguments;
+  std::istringstream stream(line);
+  std::string argument;
+  while (stream >> argument) {
+    arguments.emplace_back(std::move(argument));
+  }
+  return arguments;
+}
+
+//------------------------------------------------------------------------------
+/// @brief      Compile every entry of a batch file concurrently. Each
+///             non-empty line that doesn't start with '#' holds the switches
+///             of one ordinary impellerc invocation. A single process
+///             compiling all shader/backend combinations amortizes process
+///             launches and shares the include file cache across entries.
+///
+static bool RunBatchMode(const std::string& batch_file_path) {
+  auto batch_mapping = fml::FileMapping::CreateReadOnly(batch_file_path);
+  if (!batch_mapping || batch_mapping->GetMapping() == nullptr) {
+    std::cerr << "Could not open batch file '" << batch_file_path << "'."
+              << std::endl;
+    return false;
+  }
+
+  std::vector<std::vector<std::string>> entries;
+  std::istringstream batch_stream(std::string(
+      reinterpret_cast<const char*>(batch_mapping->GetMapping()),
+      batch_mapping->GetSize()));
+  std::string line;
+  while (std::getline(batch_stream, line)) {
+    auto arguments = TokenizeBatchLine(line);
+    if (arguments.empty() || arguments.front().front() == '#') {
+      continue;
+    }
+    entries.emplace_back(std::move(arguments));
+  }
+
+  if (entries.empty()) {
+    return true;
+  }
+
+  std::atomic_size_t next_entry{0u};
+  std::atomic_bool success{true};
+  std::mutex log_mutex;
+
+  auto worker_main = [&]() {
+    while (true) {
+      auto entry_index = next_entry.fetch_add(1u);
+      if (entry_index >= entries.size()) {
+        break;
+      }
+      const auto& arguments = entries[entry_index];
+      auto command_line = fml::CommandLineFromIteratorsWithArgv0(
+          "impellerc", arguments.begin(), arguments.end());
+
+      std::stringstream error_stream;
+      Switches switches(command_line);
+      bool entry_success = switches.AreValid(error_stream);
+      if (entry_success) {
+        entry_success = Compile(switches, error_stream);
+      } else {
+        error_stream << "Invalid flags specified." << std::endl;
+      }
+
+      if (!entry_success) {
+        success = false;
+        std::lock_guard<std::mutex> lock(log_mutex);
+        std::cerr << "Batch entry " << entry_index + 1u << " ('"
+                  << arguments.front() << " ...') failed:" << std::endl
+                  << error_stream.str();
+      }
+    }
+  };
+
+  auto worker_count = std::min<size_t>(
+      std::max(1u, std::thread::hardware_concurrency()), entries.size());
+  std::vector<std::thread> workers;
+  workers.reserve(worker_count);
+  for (size_t i = 0u; i < worker_count; i++) {
+    workers.emplace_back(worker_main);
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  return success;
+}
+
+bool Main(const fml::CommandLine& command_line) {
+  fml::InstallCrashHandler();
+  if (command_line.HasOption("help")) {
+    Switches::PrintHelp(std::cout);
+    return true;
+  }
+
+  std::string batch_file_path;
+  if (command_line.GetOptionValue("batch", &batch_file_path)) {
+    return RunBatchMode(batch_file_path);
+  }
+
+  Switches switches(command_line);
+  if (!switches.AreValid(std::cerr)) {
+    std::cerr << "Invalid flags specified." << std::endl;
+    Switches::PrintHelp(std::cerr);
+    return false;
+  }
+
+  return Compile(switches, std::cerr);
+}
+
 }  // namespace compiler
 }  // namespace impeller
 
@@ -5,6 +5,8 @@
 #include "impeller/compiler/includer.h"
 
 #include <cstring>
+#include <map>
+#include <mutex>
 
 #include "flutter/fml/paths.h"
 
@@ -21,7 +23,19 @@ Includer::Includer(std::shared_ptr<fml::UniqueFD> working_directory,
 // |shaderc::CompileOptions::IncluderInterface|
 Includer::~Includer() = default;
 
-std::unique_ptr<fml::FileMapping> Includer::TryOpenMapping(
+namespace {
+// Include contents are immutable for the lifetime of the process, so map
+// them once and share the mapping across every compilation in a batch
+// invocation. Only named include directories participate; the working
+// directory may differ between batch entries and is always re-read.
+std::mutex include_cache_mutex;
+std::map<std::string, std::shared_ptr<const fml::Mapping>>& IncludeCache() {
+  static std::map<std::string, std::shared_ptr<const fml::Mapping>> cache;
+  return cache;
+}
+}  // namespace
+
+std::shared_ptr<const fml::Mapping> Includer::TryOpenMapping(
     const IncludeDir& dir,
     const char* requested_source) {
   if (!dir.dir || !dir.dir->is_valid()) {
@@ -37,17 +51,35 @@ std::unique_ptr<fml::FileMapping> Includer::TryOpenMapping(
     return nullptr;
   }
 
-  auto mapping = fml::FileMapping::CreateReadOnly(*dir.dir, requested_source);
-  if (!mapping || !mapping->IsValid()) {
+  const bool cacheable = dir.name != ".";
+  auto include_path = fml::paths::JoinPaths({dir.name, requested_source});
+
+  if (cacheable) {
+    std::lock_guard<std::mutex> lock(include_cache_mutex);
+    auto found = IncludeCache().find(include_path);
+    if (found != IncludeCache().end()) {
+      on_file_included_(include_path);
+      return found->second;
+    }
+  }
+
+  std::shared_ptr<const fml::Mapping> mapping =
+      fml::FileMapping::CreateReadOnly(*dir.dir, requested_source);
+  if (!mapping || mapping->GetMapping() == nullptr) {
     return nullptr;
   }
 
-  on_file_included_(fml::paths::JoinPaths({dir.name, requested_source}));
+  if (cacheable) {
+    std::lock_guard<std::mutex> lock(include_cache_mutex);
+    IncludeCache()[include_path] = mapping;
+  }
+
+  on_file_included_(include_path);
 
   return mapping;
 }
 
-std::unique_ptr<fml::FileMapping> Includer::FindFirstMapping(
+std::shared_ptr<const fml::Mapping> Includer::FindFirstMapping(
     const char* requested_source) {
   // Always try the working directory first no matter what the include
   // directories are.
@@ -60,6 +60,10 @@ void Switches::PrintHelp(std::ostream& stream) {
   stream << "[optional,multiple] --include=<include_directory>" << std::endl;
   stream << "[optional,multiple] --define=<define>" << std::endl;
   stream << "[optional] --depfile=<depfile_path>" << std::endl;
+  stream << "[optional] --batch=<batch_file> (each non-empty, non-'#' line "
+            "holds the switches of one invocation; entries are compiled "
+            "concurrently and all other switches are ignored)"
+         << std::endl;
 }
 
 Switches::Switches() = default;
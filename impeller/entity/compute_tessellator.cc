@@ -0,0 +1,211 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/compute_tessellator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/entity/path_polyline.comp.h"
+#include "impeller/renderer/allocator.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/compute_command.h"
+#include "impeller/renderer/compute_pass.h"
+#include "impeller/renderer/context.h"
+#include "impeller/renderer/device_buffer.h"
+#include "impeller/renderer/host_buffer.h"
+
+namespace impeller {
+
+namespace {
+
+// Must match the header layout consumed by path_polyline.comp.
+struct ComponentHeader {
+  uint32_t type = 0u;  // 1: linear, 2: quadratic, 3: cubic.
+  uint32_t first_point = 0u;
+  uint32_t point_count = 0u;
+  uint32_t padding = 0u;
+};
+
+constexpr uint32_t kQuadraticSubdivisions = 16u;
+constexpr uint32_t kCubicSubdivisions = 24u;
+
+struct PackedPath {
+  std::vector<ComponentHeader> headers;
+  // Four packed control points (two Vector4s) per component.
+  std::vector<Vector4> control_points;
+  uint32_t point_count = 0u;
+};
+
+std::optional<PackedPath> PackPathComponents(const Path& path) {
+  PackedPath packed;
+  uint32_t next_point = 1u;  // Point 0 is the start of the first component.
+  bool seen_draw = false;
+  bool seen_trailing_contour = false;
+  bool failed = false;
+
+  path.EnumerateComponents(
+      [&](size_t, const LinearPathComponent& linear) {
+        failed |= seen_trailing_contour;
+        seen_draw = true;
+        packed.headers.push_back({1u, next_point, 1u, 0u});
+        packed.control_points.emplace_back(linear.p1.x, linear.p1.y,
+                                           linear.p2.x, linear.p2.y);
+        packed.control_points.emplace_back(0, 0, 0, 0);
+        next_point += 1u;
+      },
+      [&](size_t, const QuadraticPathComponent& quad) {
+        failed |= seen_trailing_contour;
+        seen_draw = true;
+        packed.headers.push_back({2u, next_point, kQuadraticSubdivisions, 0u});
+        packed.control_points.emplace_back(quad.p1.x, quad.p1.y, quad.cp.x,
+                                           quad.cp.y);
+        packed.control_points.emplace_back(quad.p2.x, quad.p2.y, 0, 0);
+        next_point += kQuadraticSubdivisions;
+      },
+      [&](size_t, const CubicPathComponent& cubic) {
+        failed |= seen_trailing_contour;
+        seen_draw = true;
+        packed.headers.push_back({3u, next_point, kCubicSubdivisions, 0u});
+        packed.control_points.emplace_back(cubic.p1.x, cubic.p1.y, cubic.cp1.x,
+                                           cubic.cp1.y);
+        packed.control_points.emplace_back(cubic.cp2.x, cubic.cp2.y,
+                                           cubic.p2.x, cubic.p2.y);
+        next_point += kCubicSubdivisions;
+      },
+      [&](size_t, const ContourComponent&) {
+        // Fan triangulation is only valid for a single contour. Contours
+        // are fine before any drawing components (the builder emits one up
+        // front) and after all of them (closing the path), but a contour
+        // break in the middle means multiple contours.
+        if (seen_draw) {
+          seen_trailing_contour = true;
+        }
+      });
+
+  if (failed) {
+    return std::nullopt;
+  }
+  packed.point_count = next_point;
+  return packed;
+}
+
+}  // namespace
+
+bool ComputeTessellator::CanTessellate(const ContentContext& renderer,
+                                       const Path& path) {
+  auto context = renderer.GetContext();
+  if (!context || !context->SupportsCompute()) {
+    return false;
+  }
+  if (!path.IsConvex()) {
+    return false;
+  }
+  return path.GetComponentCount() >= kMinComponentCount;
+}
+
+std::optional<GeometryResult> ComputeTessellator::Tessellate(
+    const ContentContext& renderer,
+    const Path& path,
+    HostBuffer& transients) {
+  using CS = PathPolylineComputeShader;
+
+  auto context = renderer.GetContext();
+  auto pipeline = renderer.GetPathPolylineComputePipeline();
+  if (!context || !pipeline) {
+    return std::nullopt;
+  }
+
+  auto packed = PackPathComponents(path);
+  if (!packed.has_value() || packed->point_count < 3u ||
+      packed->point_count > std::numeric_limits<uint16_t>::max()) {
+    return std::nullopt;
+  }
+
+  // The polyline lands directly in device memory; the host never reads it.
+  DeviceBufferDescriptor polyline_desc;
+  polyline_desc.storage_mode = StorageMode::kDevicePrivate;
+  polyline_desc.size = packed->point_count * sizeof(Point);
+  auto polyline_buffer =
+      context->GetResourceAllocator()->CreateBuffer(polyline_desc);
+  if (!polyline_buffer) {
+    return std::nullopt;
+  }
+  polyline_buffer->SetLabel("Compute Tessellation Polyline");
+
+  auto cmd_buffer = context->CreateCommandBuffer();
+  if (!cmd_buffer) {
+    return std::nullopt;
+  }
+  auto compute_pass = cmd_buffer->CreateComputePass();
+  if (!compute_pass || !compute_pass->IsValid()) {
+    return std::nullopt;
+  }
+
+  const auto component_count = packed->headers.size();
+  compute_pass->SetGridSize(ISize(component_count, 1));
+  compute_pass->SetThreadGroupSize(
+      ISize(std::min<size_t>(component_count, 64u), 1));
+
+  ComputeCommand cmd;
+  cmd.label = "Path Polyline";
+  cmd.pipeline = pipeline;
+
+  auto& host = compute_pass->GetTransientsBuffer();
+
+  CS::Config config;
+  config.component_count = static_cast<uint32_t>(component_count);
+  CS::BindConfig(cmd, host.EmplaceUniform(config));
+  CS::BindHeaders(
+      cmd, host.Emplace(packed->headers.data(),
+                        packed->headers.size() * sizeof(ComponentHeader),
+                        alignof(ComponentHeader)));
+  CS::BindControlPoints(
+      cmd, host.Emplace(packed->control_points.data(),
+                        packed->control_points.size() * sizeof(Vector4),
+                        alignof(Vector4)));
+  CS::BindPolyline(cmd, polyline_buffer->AsBufferView());
+
+  if (!compute_pass->AddCommand(std::move(cmd))) {
+    return std::nullopt;
+  }
+  if (!compute_pass->EncodeCommands()) {
+    return std::nullopt;
+  }
+  // Command buffers on the context's queue execute in submission order, so
+  // the polyline is written before any subsequently submitted render pass
+  // consumes it. No host side synchronization is needed.
+  if (!cmd_buffer->SubmitCommands()) {
+    return std::nullopt;
+  }
+
+  // The fan indices depend only on the point count, so the host emits them
+  // while the GPU flattens the path.
+  std::vector<uint16_t> indices;
+  indices.reserve((packed->point_count - 2u) * 3u);
+  for (uint32_t i = 1u; i + 1u < packed->point_count; i++) {
+    indices.push_back(0u);
+    indices.push_back(static_cast<uint16_t>(i));
+    indices.push_back(static_cast<uint16_t>(i + 1u));
+  }
+
+  VertexBuffer vertex_buffer;
+  vertex_buffer.vertex_buffer = polyline_buffer->AsBufferView();
+  vertex_buffer.index_buffer =
+      transients.Emplace(indices.data(), indices.size() * sizeof(uint16_t),
+                         alignof(uint16_t));
+  vertex_buffer.index_count = indices.size();
+  vertex_buffer.index_type = IndexType::k16bit;
+
+  return GeometryResult{
+      .type = PrimitiveType::kTriangle,
+      .vertex_buffer = vertex_buffer,
+      .prevent_overdraw = false,
+  };
+}
+
+}  // namespace impeller
@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <optional>
+
+#include "flutter/fml/macros.h"
+#include "impeller/entity/geometry.h"
+#include "impeller/geometry/path.h"
+
+namespace impeller {
+
+class ContentContext;
+class HostBuffer;
+
+//------------------------------------------------------------------------------
+/// @brief      Tessellates convex filled paths on the GPU.
+///
+///             A compute dispatch flattens the packed path components into a
+///             polyline that lands directly in device memory, and the
+///             polyline is drawn as a triangle fan. This sidesteps the CPU
+///             flattening and libtess2 triangulation entirely for large
+///             convex paths on backends with compute support.
+///
+class ComputeTessellator {
+ public:
+  /// Below this component count, CPU tessellation finishes faster than a
+  /// compute dispatch round trip costs.
+  static constexpr size_t kMinComponentCount = 16u;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether `path` is eligible for GPU tessellation: the
+  ///             backend supports compute, the path is declared convex (fan
+  ///             triangulation is invalid for concave paths), and the path
+  ///             is large enough to be worth a dispatch.
+  ///
+  static bool CanTessellate(const ContentContext& renderer, const Path& path);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Flatten `path` into a device memory polyline with a compute
+  ///             dispatch and return it as a triangle fan. Returns
+  ///             std::nullopt on failure so callers can fall back to CPU
+  ///             tessellation.
+  ///
+  /// @param[in]  renderer    The content context.
+  /// @param[in]  path        The path. Must be convex.
+  /// @param[in]  transients  The transients buffer of the render pass that
+  ///                         will consume the result; receives the fan
+  ///                         indices.
+  ///
+  static std::optional<GeometryResult> Tessellate(
+      const ContentContext& renderer,
+      const Path& path,
+      HostBuffer& transients);
+
+ private:
+  ComputeTessellator() = delete;
+};
+
+}  // namespace impeller
@@ -24,6 +24,11 @@ ClipContents::~ClipContents() = default;
 
 void ClipContents::SetGeometry(std::unique_ptr<Geometry> geometry) {
   geometry_ = std::move(geometry);
+  if (geometry_) {
+    // Clips encode their own stencil state; the geometry must not write
+    // winding counts into the stencil buffer behind their back.
+    geometry_->SetAllowsStencilCover(false);
+  }
 }
 
 void ClipContents::SetClipOperation(Entity::ClipOperation clip_op) {
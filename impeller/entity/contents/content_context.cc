@@ -4,13 +4,21 @@
 
 #include "impeller/entity/contents/content_context.h"
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 
+#include "flutter/fml/mapping.h"
+#include "impeller/entity/contents/gradient_texture_cache.h"
 #include "impeller/entity/entity.h"
+#include "impeller/entity/path_polyline.comp.h"
 #include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/compute_pipeline_builder.h"
 #include "impeller/renderer/formats.h"
 #include "impeller/renderer/render_pass.h"
 #include "impeller/renderer/render_target.h"
+#include "impeller/renderer/texture.h"
+#include "impeller/tessellator/tessellation_cache.h"
 #include "impeller/tessellator/tessellator.h"
 
 namespace impeller {
@@ -125,7 +133,13 @@ void ContentContextOptions::ApplyToPipelineDescriptor(
         desc.GetFrontStencilAttachmentDescriptor().value();
     stencil.stencil_compare = stencil_compare;
     stencil.depth_stencil_pass = stencil_operation;
-    desc.SetStencilAttachmentDescriptors(stencil);
+    if (back_stencil_operation.has_value()) {
+      StencilAttachmentDescriptor back_stencil = stencil;
+      back_stencil.depth_stencil_pass = back_stencil_operation.value();
+      desc.SetStencilAttachmentDescriptors(stencil, back_stencil);
+    } else {
+      desc.SetStencilAttachmentDescriptors(stencil);
+    }
   }
 }
 
@@ -144,7 +158,8 @@ static std::unique_ptr<PipelineT> CreateDefaultPipeline(
 ContentContext::ContentContext(std::shared_ptr<Context> context)
     : context_(std::move(context)),
       tessellator_(std::make_shared<Tessellator>()),
-      glyph_atlas_context_(std::make_shared<GlyphAtlasContext>()) {
+      tessellation_cache_(std::make_shared<TessellationCache>()),
+      gradient_texture_cache_(std::make_shared<GradientTextureCache>()) {
   if (!context_ || !context_->IsValid()) {
     return;
   }
@@ -292,13 +307,144 @@ std::shared_ptr<Tessellator> ContentContext::GetTessellator() const {
   return tessellator_;
 }
 
-std::shared_ptr<GlyphAtlasContext> ContentContext::GetGlyphAtlasContext()
+std::shared_ptr<TessellationCache> ContentContext::GetTessellationCache()
     const {
-  return glyph_atlas_context_;
+  return tessellation_cache_;
+}
+
+std::shared_ptr<GradientTextureCache> ContentContext::GetGradientTextureCache()
+    const {
+  return gradient_texture_cache_;
+}
+
+std::shared_ptr<Texture> ContentContext::GetRRectBlurProfileTexture() const {
+  if (rrect_blur_profile_texture_) {
+    return rrect_blur_profile_texture_;
+  }
+
+  // The shadow mask used to be evaluated per fragment as a logistic sigmoid
+  // of the normalized rrect distance. Bake the same profile into a small
+  // lookup texture so the fragment shader trades the transcendental for a
+  // single texture fetch.
+  constexpr uint32_t kProfileWidth = 64u;
+  std::vector<uint8_t> profile_bytes;
+  profile_bytes.reserve(kProfileWidth * 4u);
+  for (uint32_t i = 0u; i < kProfileWidth; i++) {
+    Scalar x =
+        static_cast<Scalar>(i) / static_cast<Scalar>(kProfileWidth - 1u) *
+            2.0f -
+        1.0f;
+    // Simple logistic sigmoid with a domain of [-1, 1] and range of [0, 1].
+    Scalar mask = 1.03731472073f / (1.0f + std::exp(-4.0f * x)) -
+                  0.0186573603638f;
+    auto byte = static_cast<uint8_t>(
+        std::round(std::clamp(mask, 0.0f, 1.0f) * 255.0f));
+    for (auto component = 0u; component < 4u; component++) {
+      profile_bytes.push_back(byte);
+    }
+  }
+
+  TextureDescriptor texture_descriptor;
+  texture_descriptor.storage_mode = StorageMode::kHostVisible;
+  texture_descriptor.format = PixelFormat::kR8G8B8A8UNormInt;
+  texture_descriptor.size = {kProfileWidth, 1};
+  auto texture =
+      context_->GetResourceAllocator()->CreateTexture(texture_descriptor);
+  if (!texture) {
+    return nullptr;
+  }
+  if (!texture->SetContents(
+          std::make_shared<fml::DataMapping>(std::move(profile_bytes)))) {
+    return nullptr;
+  }
+  texture->SetLabel("RRect Blur Profile");
+  rrect_blur_profile_texture_ = std::move(texture);
+  return rrect_blur_profile_texture_;
+}
+
+std::shared_ptr<Pipeline<ComputePipelineDescriptor>>
+ContentContext::GetPathPolylineComputePipeline() const {
+  if (path_polyline_compute_pipeline_) {
+    return path_polyline_compute_pipeline_;
+  }
+  if (!context_ || !context_->SupportsCompute()) {
+    return nullptr;
+  }
+  auto desc = ComputePipelineBuilder<
+      PathPolylineComputeShader>::MakeDefaultPipelineDescriptor(*context_);
+  if (!desc.has_value()) {
+    return nullptr;
+  }
+  path_polyline_compute_pipeline_ =
+      context_->GetPipelineLibrary()->GetPipeline(desc).get();
+  return path_polyline_compute_pipeline_;
+}
+
+std::shared_ptr<GlyphAtlasContext> ContentContext::GetGlyphAtlasContext(
+    GlyphAtlas::Type type) const {
+  auto& atlas_context = glyph_atlas_contexts_[type];
+  if (!atlas_context) {
+    atlas_context = std::make_shared<GlyphAtlasContext>();
+  }
+  return atlas_context;
+}
+
+std::shared_ptr<Pipeline<PipelineDescriptor>>
+ContentContext::GetCachedRuntimeEffectPipeline(
+    const std::string& unique_entrypoint_name,
+    const ContentContextOptions& options,
+    const std::function<std::shared_ptr<Pipeline<PipelineDescriptor>>()>&
+        create_callback) const {
+  RuntimeEffectPipelineKey key{unique_entrypoint_name, options};
+  auto found = runtime_effect_pipelines_.find(key);
+  if (found != runtime_effect_pipelines_.end()) {
+    return found->second;
+  }
+  auto pipeline = create_callback();
+  if (pipeline) {
+    runtime_effect_pipelines_[std::move(key)] = pipeline;
+  }
+  return pipeline;
 }
 
 std::shared_ptr<Context> ContentContext::GetContext() const {
   return context_;
 }
 
+std::vector<ContentContextOptions> ContentContext::DefaultPrewarmVariants() {
+  std::vector<ContentContextOptions> variants;
+  for (auto sample_count : {SampleCount::kCount1, SampleCount::kCount4}) {
+    for (auto blend_mode :
+         {BlendMode::kSource, BlendMode::kSourceOver, BlendMode::kPlus}) {
+      ContentContextOptions opts;
+      opts.sample_count = sample_count;
+      opts.blend_mode = blend_mode;
+      variants.push_back(opts);
+    }
+  }
+  return variants;
+}
+
+void ContentContext::PrewarmPipelineVariants(
+    const std::vector<ContentContextOptions>& variants) const {
+  if (!IsValid()) {
+    return;
+  }
+  for (const auto& opts : variants) {
+    // The pipeline families that virtually every scene uses in its first
+    // frames: solid color, textured and blended content, text, vertices,
+    // and clipping. The rarer families (advanced blends, filters) are
+    // left to build on demand rather than paying for every variant of
+    // every family up front.
+    PrewarmVariant(solid_fill_pipelines_, opts);
+    PrewarmVariant(texture_pipelines_, opts);
+    PrewarmVariant(tiled_texture_pipelines_, opts);
+    PrewarmVariant(texture_blend_pipelines_, opts);
+    PrewarmVariant(glyph_atlas_pipelines_, opts);
+    PrewarmVariant(geometry_position_pipelines_, opts);
+    PrewarmVariant(geometry_color_pipelines_, opts);
+    PrewarmVariant(clip_pipelines_, opts);
+  }
+}
+
 }  // namespace impeller
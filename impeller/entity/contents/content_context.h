@@ -5,7 +5,10 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
@@ -166,11 +169,16 @@ struct ContentContextOptions {
   BlendMode blend_mode = BlendMode::kSourceOver;
   CompareFunction stencil_compare = CompareFunction::kEqual;
   StencilOperation stencil_operation = StencilOperation::kKeep;
+  /// When set, back facing primitives use this stencil operation instead of
+  /// `stencil_operation`. Used to accumulate winding counts for the
+  /// stencil-then-cover fill strategy.
+  std::optional<StencilOperation> back_stencil_operation;
 
   struct Hash {
     constexpr std::size_t operator()(const ContentContextOptions& o) const {
-      return fml::HashCombine(o.sample_count, o.blend_mode, o.stencil_compare,
-                              o.stencil_operation);
+      return fml::HashCombine(
+          o.sample_count, o.blend_mode, o.stencil_compare, o.stencil_operation,
+          o.back_stencil_operation.value_or(o.stencil_operation));
     }
   };
 
@@ -180,13 +188,16 @@ struct ContentContextOptions {
       return lhs.sample_count == rhs.sample_count &&
              lhs.blend_mode == rhs.blend_mode &&
              lhs.stencil_compare == rhs.stencil_compare &&
-             lhs.stencil_operation == rhs.stencil_operation;
+             lhs.stencil_operation == rhs.stencil_operation &&
+             lhs.back_stencil_operation == rhs.back_stencil_operation;
     }
   };
 
   void ApplyToPipelineDescriptor(PipelineDescriptor& desc) const;
 };
 
+class GradientTextureCache;
+class TessellationCache;
 class Tessellator;
 
 class ContentContext {
@@ -199,6 +210,18 @@ class ContentContext {
 
   std::shared_ptr<Tessellator> GetTessellator() const;
 
+  std::shared_ptr<TessellationCache> GetTessellationCache() const;
+
+  std::shared_ptr<GradientTextureCache> GetGradientTextureCache() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The compute pipeline that flattens path components into a
+  ///             device memory polyline. Lazily created; returns nullptr on
+  ///             backends without compute support.
+  ///
+  std::shared_ptr<Pipeline<ComputePipelineDescriptor>>
+  GetPathPolylineComputePipeline() const;
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetLinearGradientFillPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(linear_gradient_fill_pipelines_, opts);
@@ -378,7 +401,20 @@ class ContentContext {
 
   std::shared_ptr<Context> GetContext() const;
 
-  std::shared_ptr<GlyphAtlasContext> GetGlyphAtlasContext() const;
+  /// @brief  A 1D lookup texture encoding the rrect shadow blur profile for
+  ///         normalized distances in [-1, 1]. The profile is normalized by
+  ///         the blur radius, so a single lazily created texture is shared
+  ///         by every shadow rendered with this context regardless of corner
+  ///         radius or sigma.
+  std::shared_ptr<Texture> GetRRectBlurProfileTexture() const;
+
+  /// @brief  The long lived glyph atlas context for atlases of the given
+  ///         type. The context persists for the lifetime of the AiksContext
+  ///         that owns this content context, so pictures rendered back to
+  ///         back (and successive frames of static text) append to one
+  ///         cached atlas instead of regenerating their glyph runs.
+  std::shared_ptr<GlyphAtlasContext> GetGlyphAtlasContext(
+      GlyphAtlas::Type type) const;
 
   using SubpassCallback =
       std::function<bool(const ContentContext&, RenderPass&)>;
@@ -389,6 +425,36 @@ class ContentContext {
       ISize texture_size,
       const SubpassCallback& subpass_callback) const;
 
+  /// @brief  Runtime effect pipelines (dart:ui FragmentPrograms) aren't known
+  ///         at startup and so can't join the prebuilt variants maps. They
+  ///         are instead cached here keyed by the stage's unique entrypoint
+  ///         name plus the variant options, so an animating custom-shader
+  ///         widget rebinds a cached pipeline instead of building a fresh
+  ///         descriptor and pipeline state object every frame.
+  ///         `create_callback` is invoked only on a cache miss and must
+  ///         return the pipeline to cache (or nullptr, which is not cached).
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetCachedRuntimeEffectPipeline(
+      const std::string& unique_entrypoint_name,
+      const ContentContextOptions& options,
+      const std::function<std::shared_ptr<Pipeline<PipelineDescriptor>>()>&
+          create_callback) const;
+
+  /// @brief  The variant descriptors prewarmed by default during setup:
+  ///         the common sample counts crossed with the pipeline blend
+  ///         modes that virtually every scene hits in its first frames.
+  static std::vector<ContentContextOptions> DefaultPrewarmVariants();
+
+  /// @brief  Kicks off construction of the pipeline state objects for the
+  ///         given variant descriptors across the commonly used pipeline
+  ///         families without waiting for the backends to finish building
+  ///         them. Variants already in the cache are skipped. A later
+  ///         pipeline request with the same options picks up the
+  ///         prewarmed pipeline (waiting briefly on its future if it is
+  ///         still building) instead of stalling mid-frame on a backend
+  ///         PSO compilation.
+  void PrewarmPipelineVariants(
+      const std::vector<ContentContextOptions>& variants) const;
+
  private:
   std::shared_ptr<Context> context_;
 
@@ -468,9 +534,66 @@ class ContentContext {
     return variant_pipeline;
   }
 
+  template <class TypedPipeline>
+  void PrewarmVariant(Variants<TypedPipeline>& container,
+                      ContentContextOptions opts) const {
+    if (container.find(opts) != container.end()) {
+      return;
+    }
+
+    auto prototype = container.find({});
+
+    // The prototype must always be initialized in the constructor.
+    FML_CHECK(prototype != container.end());
+
+    auto variant_future = prototype->second->WaitAndGet()->CreateVariant(
+        [opts, variants_count = container.size()](PipelineDescriptor& desc) {
+          opts.ApplyToPipelineDescriptor(desc);
+          desc.SetLabel(
+              SPrintF("%s V#%zu", desc.GetLabel().c_str(), variants_count));
+        });
+    // Unlike GetPipeline, cache the in-flight variant without waiting for
+    // the backend to finish building it. The descriptor callback may run
+    // after this method returns, so |opts| is captured by value above.
+    container[opts] = std::make_unique<TypedPipeline>(std::move(variant_future));
+  }
+
   bool is_valid_ = false;
   std::shared_ptr<Tessellator> tessellator_;
-  std::shared_ptr<GlyphAtlasContext> glyph_atlas_context_;
+  std::shared_ptr<TessellationCache> tessellation_cache_;
+  std::shared_ptr<GradientTextureCache> gradient_texture_cache_;
+  mutable std::shared_ptr<Pipeline<ComputePipelineDescriptor>>
+      path_polyline_compute_pipeline_;
+  mutable std::shared_ptr<Texture> rrect_blur_profile_texture_;
+  mutable std::unordered_map<GlyphAtlas::Type,
+                             std::shared_ptr<GlyphAtlasContext>>
+      glyph_atlas_contexts_;
+
+  struct RuntimeEffectPipelineKey {
+    std::string unique_entrypoint_name;
+    ContentContextOptions options;
+
+    struct Hash {
+      std::size_t operator()(const RuntimeEffectPipelineKey& key) const {
+        return fml::HashCombine(key.unique_entrypoint_name,
+                                ContentContextOptions::Hash{}(key.options));
+      }
+    };
+
+    struct Equal {
+      bool operator()(const RuntimeEffectPipelineKey& lhs,
+                      const RuntimeEffectPipelineKey& rhs) const {
+        return lhs.unique_entrypoint_name == rhs.unique_entrypoint_name &&
+               ContentContextOptions::Equal{}(lhs.options, rhs.options);
+      }
+    };
+  };
+
+  mutable std::unordered_map<RuntimeEffectPipelineKey,
+                             std::shared_ptr<Pipeline<PipelineDescriptor>>,
+                             RuntimeEffectPipelineKey::Hash,
+                             RuntimeEffectPipelineKey::Equal>
+      runtime_effect_pipelines_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ContentContext);
 };
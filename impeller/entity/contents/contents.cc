@@ -84,4 +84,16 @@ bool Contents::ShouldRender(const Entity& entity,
   return stencil_coverage->IntersectsWithRect(coverage.value());
 }
 
+bool Contents::IsOpaque() const {
+  return false;
+}
+
+bool Contents::CoversArea(const Entity& entity, const Rect& rect) const {
+  return false;
+}
+
+const SolidColorContents* Contents::AsSolidColor() const {
+  return nullptr;
+}
+
 }  // namespace impeller
@@ -18,6 +18,7 @@ namespace impeller {
 class ContentContext;
 struct ContentContextOptions;
 class Entity;
+class SolidColorContents;
 class Surface;
 class RenderPass;
 
@@ -65,6 +66,22 @@ class Contents {
   virtual bool ShouldRender(const Entity& entity,
                             const std::optional<Rect>& stencil_coverage) const;
 
+  /// @brief Whether every pixel this contents fills is fully opaque.
+  ///        Conservative: implementations return false when unsure.
+  virtual bool IsOpaque() const;
+
+  /// @brief Whether this contents fills every pixel of `rect` when drawn
+  ///        with the given entity's transform, i.e. whether its geometry
+  ///        leaves no gaps there. Together with |IsOpaque|, this lets the
+  ///        entity pass cull draws that are entirely hidden behind this
+  ///        one. Conservative: implementations return false when unsure.
+  virtual bool CoversArea(const Entity& entity, const Rect& rect) const;
+
+  /// @brief If this contents is a |SolidColorContents|, return it. RTTI is
+  ///        unavailable, so contents that participate in draw batching
+  ///        identify themselves explicitly.
+  virtual const SolidColorContents* AsSolidColor() const;
+
  protected:
 
  private:
@@ -23,6 +23,95 @@
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// @brief      Bring a snapshot down to `scale_factor` times its resolution
+///             with successive halvings, each a linearly filtered blit.
+///
+///             Stepping down by at most a factor of two per pass keeps every
+///             blit within the reconstruction window of bilinear filtering,
+///             so no texels are skipped on the way down. The snapshot
+///             transform is adjusted so the result covers the same area.
+///
+static std::optional<Snapshot> DownsampleSnapshot(
+    const ContentContext& renderer,
+    Snapshot snapshot,
+    Scalar scale_factor) {
+  using VS = TexturePipeline::VertexShader;
+  using FS = TexturePipeline::FragmentShader;
+
+  while (scale_factor < 1.0f - kEhCloseEnough) {
+    Scalar step_scale = std::max(scale_factor, 0.5f);
+    auto source_size = snapshot.texture->GetSize();
+    auto target_size =
+        ISize(std::max<int64_t>(1, std::round(source_size.width * step_scale)),
+              std::max<int64_t>(
+                  1, std::round(source_size.height * step_scale)));
+    if (target_size == source_size) {
+      break;
+    }
+
+    ContentContext::SubpassCallback callback = [&](const ContentContext&
+                                                       renderer,
+                                                   RenderPass& pass) {
+      auto& host_buffer = pass.GetTransientsBuffer();
+
+      VertexBufferBuilder<VS::PerVertexData> vtx_builder;
+      vtx_builder.AddVertices({
+          {Point(0, 0), Point(0, 0)},
+          {Point(1, 0), Point(1, 0)},
+          {Point(1, 1), Point(1, 1)},
+          {Point(0, 0), Point(0, 0)},
+          {Point(1, 1), Point(1, 1)},
+          {Point(0, 1), Point(0, 1)},
+      });
+
+      VS::VertInfo vert_info;
+      vert_info.mvp = Matrix::MakeOrthographic(ISize(1, 1));
+
+      FS::FragInfo frag_info;
+      frag_info.texture_sampler_y_coord_scale =
+          snapshot.texture->GetYCoordScale();
+      frag_info.alpha = 1.0;
+
+      Command cmd;
+      cmd.label = "Gaussian Blur Downsample";
+      auto options = OptionsFromPass(pass);
+      options.blend_mode = BlendMode::kSource;
+      cmd.pipeline = renderer.GetTexturePipeline(options);
+      cmd.BindVertices(vtx_builder.CreateVertexBuffer(host_buffer));
+
+      SamplerDescriptor sampler_desc;
+      sampler_desc.min_filter = MinMagFilter::kLinear;
+      sampler_desc.mag_filter = MinMagFilter::kLinear;
+      FS::BindTextureSampler(
+          cmd, snapshot.texture,
+          renderer.GetContext()->GetSamplerLibrary()->GetSampler(sampler_desc));
+      VS::BindVertInfo(cmd, host_buffer.EmplaceUniform(vert_info));
+      FS::BindFragInfo(cmd, host_buffer.EmplaceUniform(frag_info));
+
+      return pass.AddCommand(cmd);
+    };
+
+    auto out_texture = renderer.MakeSubpass(target_size, callback);
+    if (!out_texture) {
+      return std::nullopt;
+    }
+    out_texture->SetLabel("Gaussian Blur Downsample Texture");
+
+    snapshot.transform =
+        snapshot.transform *
+        Matrix::MakeScale(Vector2(source_size) / Vector2(target_size));
+    snapshot.texture = std::move(out_texture);
+    scale_factor /= step_scale;
+  }
+
+  SamplerDescriptor sampler_desc;
+  sampler_desc.min_filter = MinMagFilter::kLinear;
+  sampler_desc.mag_filter = MinMagFilter::kLinear;
+  snapshot.sampler_descriptor = sampler_desc;
+  return snapshot;
+}
+
 DirectionalGaussianBlurFilterContents::DirectionalGaussianBlurFilterContents() =
     default;
 
@@ -123,6 +212,26 @@ std::optional<Snapshot> DirectionalGaussianBlurFilterContents::RenderFilter(
     return input_snapshot.value();  // No blur to render.
   }
 
+  // The scale at which the blur pass renders and samples. Halving the
+  // resolution while the kernel radius shrinks proportionally bounds the tap
+  // count per fragment regardless of sigma, and linear upsampling of the
+  // result hides the lost frequencies under the blur itself.
+  auto scale_curve = [](Scalar radius) {
+    const Scalar d = 4.0;
+    return std::min(1.0, d / (std::max(1.0f, radius) + d - 1.0));
+  };
+  Vector2 scale;
+  scale.x = scale_curve(transformed_blur_radius_length);
+
+  // Bring the input down to the resolution the blur taps at with successive
+  // halvings so the kernel reads one texel per tap.
+  auto downsampled_input =
+      DownsampleSnapshot(renderer, input_snapshot.value(), scale.x);
+  if (!downsampled_input.has_value()) {
+    return std::nullopt;
+  }
+  input_snapshot = downsampled_input;
+
   // A matrix that rotates the snapshot space such that the blur direction is
   // +X.
   auto texture_rotate = Matrix::MakeRotationZ(
@@ -190,7 +299,10 @@ std::optional<Snapshot> DirectionalGaussianBlurFilterContents::RenderFilter(
     frag_info.alpha_mask_sampler_y_coord_scale =
         source_snapshot->texture->GetYCoordScale();
 
-    auto r = Radius{transformed_blur_radius_length};
+    // The kernel is expressed in the downsampled space: the radius shrinks
+    // by the downsample factor while each tap strides one downsampled texel,
+    // so the tap count stays small and fixed no matter the sigma.
+    auto r = Radius{transformed_blur_radius_length * scale.x};
     frag_info.blur_sigma = Sigma{r}.sigma;
     frag_info.blur_radius = r.radius;
 
@@ -202,7 +314,8 @@ std::optional<Snapshot> DirectionalGaussianBlurFilterContents::RenderFilter(
     frag_info.src_factor = src_color_factor_;
     frag_info.inner_blur_factor = inner_blur_factor_;
     frag_info.outer_blur_factor = outer_blur_factor_;
-    frag_info.texture_size = Point(input_snapshot->GetCoverage().value().size);
+    frag_info.texture_size =
+        Point(input_snapshot->GetCoverage().value().size) * scale.x;
 
     Command cmd;
     cmd.label = SPrintF("Gaussian Blur Filter (Radius=%.2f)",
@@ -226,14 +339,7 @@ std::optional<Snapshot> DirectionalGaussianBlurFilterContents::RenderFilter(
     return pass.AddCommand(cmd);
   };
 
-  Vector2 scale;
-  auto scale_curve = [](Scalar radius) {
-    const Scalar d = 4.0;
-    return std::min(1.0, d / (std::max(1.0f, radius) + d - 1.0));
-  };
   {
-    scale.x = scale_curve(transformed_blur_radius_length);
-
     Scalar y_radius = std::abs(pass_transform.GetDirectionScale(Vector2(
         0, source_override_ ? Radius{secondary_blur_sigma_}.radius : 1)));
     scale.y = scale_curve(y_radius);
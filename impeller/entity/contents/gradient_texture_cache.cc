@@ -0,0 +1,60 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/gradient_texture_cache.h"
+
+#include "flutter/fml/hash_combine.h"
+#include "impeller/entity/contents/gradient_generator.h"
+
+namespace impeller {
+
+GradientTextureCache::GradientTextureCache() = default;
+
+GradientTextureCache::~GradientTextureCache() = default;
+
+static uint64_t HashGradient(const std::vector<Color>& colors,
+                             const std::vector<Scalar>& stops) {
+  std::size_t hash = fml::HashCombine(colors.size(), stops.size());
+  for (const auto& color : colors) {
+    fml::HashCombineSeed(hash, color.red, color.green, color.blue, color.alpha);
+  }
+  for (auto stop : stops) {
+    fml::HashCombineSeed(hash, stop);
+  }
+  return hash;
+}
+
+std::shared_ptr<Texture> GradientTextureCache::GetOrCreateTexture(
+    const std::vector<Color>& colors,
+    const std::vector<Scalar>& stops,
+    const std::shared_ptr<Context>& context) {
+  auto key = HashGradient(colors, stops);
+  auto found = entries_.find(key);
+  if (found != entries_.end()) {
+    auto entry = found->second;
+    if (entry->colors == colors && entry->stops == stops) {
+      lru_.splice(lru_.begin(), lru_, entry);
+      return entry->texture;
+    }
+    // A hash collision with different stop data. Evict the old entry and
+    // fall through to create a texture for the new gradient.
+    lru_.erase(entry);
+    entries_.erase(found);
+  }
+
+  auto texture = CreateGradientTexture(colors, stops, context);
+  if (!texture) {
+    return nullptr;
+  }
+
+  lru_.push_front(Entry{key, colors, stops, texture});
+  entries_[key] = lru_.begin();
+  while (lru_.size() > kMaxEntries) {
+    entries_.erase(lru_.back().key);
+    lru_.pop_back();
+  }
+  return texture;
+}
+
+}  // namespace impeller
@@ -0,0 +1,65 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "impeller/geometry/color.h"
+#include "impeller/geometry/scalar.h"
+
+namespace impeller {
+
+class Context;
+class Texture;
+
+//------------------------------------------------------------------------------
+/// @brief      A cache of gradient lookup textures keyed by their color and
+///             stop data.
+///
+///             Identical gradients used by different widgets (a theme's
+///             standard gradients, for instance) upload their lookup texture
+///             once per context lifetime instead of once per contents. The
+///             least recently used entry is evicted once the cache is full.
+///
+class GradientTextureCache {
+ public:
+  GradientTextureCache();
+
+  ~GradientTextureCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      The lookup texture for the gradient described by the given
+  ///             colors and stops, created and uploaded on the first request
+  ///             and served from the cache thereafter.
+  ///
+  std::shared_ptr<Texture> GetOrCreateTexture(
+      const std::vector<Color>& colors,
+      const std::vector<Scalar>& stops,
+      const std::shared_ptr<Context>& context);
+
+ private:
+  // Lookup textures are at most 4KB each, so this bounds the cache at half a
+  // megabyte while comfortably covering a theme's worth of gradients.
+  static constexpr size_t kMaxEntries = 128u;
+
+  struct Entry {
+    uint64_t key;
+    std::vector<Color> colors;
+    std::vector<Scalar> stops;
+    std::shared_ptr<Texture> texture;
+  };
+
+  // Most recently used entries are at the front.
+  std::list<Entry> lru_;
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> entries_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(GradientTextureCache);
+};
+
+}  // namespace impeller
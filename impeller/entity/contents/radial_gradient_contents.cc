@@ -7,7 +7,7 @@
 #include "flutter/fml/logging.h"
 #include "impeller/entity/contents/clip_contents.h"
 #include "impeller/entity/contents/content_context.h"
-#include "impeller/entity/contents/gradient_generator.h"
+#include "impeller/entity/contents/gradient_texture_cache.h"
 #include "impeller/entity/entity.h"
 #include "impeller/entity/geometry.h"
 #include "impeller/renderer/render_pass.h"
@@ -50,8 +50,8 @@ bool RadialGradientContents::Render(const ContentContext& renderer,
   using VS = RadialGradientFillPipeline::VertexShader;
   using FS = RadialGradientFillPipeline::FragmentShader;
 
-  auto gradient_texture =
-      CreateGradientTexture(colors_, stops_, renderer.GetContext());
+  auto gradient_texture = renderer.GetGradientTextureCache()->GetOrCreateTexture(
+      colors_, stops_, renderer.GetContext());
   if (gradient_texture == nullptr) {
     return false;
   }
@@ -81,6 +81,9 @@ bool RadialGradientContents::Render(const ContentContext& renderer,
   if (geometry_result.prevent_overdraw) {
     options.stencil_compare = CompareFunction::kEqual;
     options.stencil_operation = StencilOperation::kIncrementClamp;
+  } else if (geometry_result.stencil_cover) {
+    options.stencil_compare = CompareFunction::kNotEqual;
+    options.stencil_operation = StencilOperation::kSetToReferenceValue;
   }
   cmd.pipeline = renderer.GetRadialGradientFillPipeline(options);
 
@@ -10,6 +10,7 @@
 #include "impeller/geometry/path.h"
 #include "impeller/geometry/path_builder.h"
 #include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/sampler_library.h"
 #include "impeller/renderer/vertex_buffer_builder.h"
 #include "impeller/tessellator/tessellator.h"
 
@@ -57,6 +58,11 @@ bool RRectShadowContents::Render(const ContentContext& renderer,
   using VS = RRectBlurPipeline::VertexShader;
   using FS = RRectBlurPipeline::FragmentShader;
 
+  auto blur_profile = renderer.GetRRectBlurProfileTexture();
+  if (!blur_profile) {
+    return false;
+  }
+
   VertexBufferBuilder<VS::PerVertexData> vtx_builder;
 
   auto blur_radius = Radius{sigma_}.radius;
@@ -101,6 +107,13 @@ bool RRectShadowContents::Render(const ContentContext& renderer,
                                         positive_rect.size.height / 2.0f));
   FS::BindFragInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frag_info));
 
+  SamplerDescriptor sampler_desc;
+  sampler_desc.min_filter = MinMagFilter::kLinear;
+  sampler_desc.mag_filter = MinMagFilter::kLinear;
+  FS::BindBlurProfile(
+      cmd, std::move(blur_profile),
+      renderer.GetContext()->GetSamplerLibrary()->GetSampler(sampler_desc));
+
   if (!pass.AddCommand(std::move(cmd))) {
     return false;
   }
@@ -93,29 +93,40 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
   ///
 
   using VS = PositionNoColorVertexShader;
-  PipelineDescriptor desc;
-  desc.SetLabel("Runtime Stage");
-  desc.AddStageEntrypoint(
-      library->GetFunction(VS::kEntrypointName, ShaderStage::kVertex));
-  desc.AddStageEntrypoint(library->GetFunction(runtime_stage_->GetEntrypoint(),
-                                               ShaderStage::kFragment));
-  auto vertex_descriptor = std::make_shared<VertexDescriptor>();
-  if (!vertex_descriptor->SetStageInputs(VS::kAllShaderStageInputs)) {
-    VALIDATION_LOG << "Failed to set stage inputs for runtime effect pipeline.";
-  }
-  desc.SetVertexDescriptor(std::move(vertex_descriptor));
-  desc.SetColorAttachmentDescriptor(0u, {.format = PixelFormat::kDefaultColor});
-  desc.SetStencilAttachmentDescriptors({});
-  desc.SetStencilPixelFormat(PixelFormat::kDefaultStencil);
 
   auto options = OptionsFromPassAndEntity(pass, entity);
   if (geometry_result.prevent_overdraw) {
     options.stencil_compare = CompareFunction::kEqual;
     options.stencil_operation = StencilOperation::kIncrementClamp;
+  } else if (geometry_result.stencil_cover) {
+    options.stencil_compare = CompareFunction::kNotEqual;
+    options.stencil_operation = StencilOperation::kSetToReferenceValue;
   }
-  options.ApplyToPipelineDescriptor(desc);
 
-  auto pipeline = context->GetPipelineLibrary()->GetPipeline(desc).get();
+  // The descriptor is only built (and the backend pipeline state object only
+  // created) the first time a given runtime stage draws with a given set of
+  // variant options. Subsequent frames rebind the cached pipeline.
+  auto pipeline = renderer.GetCachedRuntimeEffectPipeline(
+      runtime_stage_->GetEntrypoint(), options, [&]() {
+        PipelineDescriptor desc;
+        desc.SetLabel("Runtime Stage");
+        desc.AddStageEntrypoint(
+            library->GetFunction(VS::kEntrypointName, ShaderStage::kVertex));
+        desc.AddStageEntrypoint(library->GetFunction(
+            runtime_stage_->GetEntrypoint(), ShaderStage::kFragment));
+        auto vertex_descriptor = std::make_shared<VertexDescriptor>();
+        if (!vertex_descriptor->SetStageInputs(VS::kAllShaderStageInputs)) {
+          VALIDATION_LOG
+              << "Failed to set stage inputs for runtime effect pipeline.";
+        }
+        desc.SetVertexDescriptor(std::move(vertex_descriptor));
+        desc.SetColorAttachmentDescriptor(
+            0u, {.format = PixelFormat::kDefaultColor});
+        desc.SetStencilAttachmentDescriptors({});
+        desc.SetStencilPixelFormat(PixelFormat::kDefaultStencil);
+        options.ApplyToPipelineDescriptor(desc);
+        return context->GetPipelineLibrary()->GetPipeline(desc).get();
+      });
   if (!pipeline) {
     VALIDATION_LOG << "Failed to get or create runtime effect pipeline.";
     return false;
@@ -9,6 +9,7 @@
 #include "impeller/entity/entity.h"
 #include "impeller/geometry/path.h"
 #include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/vertex_buffer_builder.h"
 
 namespace impeller {
 
@@ -28,6 +29,14 @@ void SolidColorContents::SetGeometry(std::unique_ptr<Geometry> geometry) {
   geometry_ = std::move(geometry);
 }
 
+const Geometry* SolidColorContents::GetGeometry() const {
+  return geometry_.get();
+}
+
+const SolidColorContents* SolidColorContents::AsSolidColor() const {
+  return this;
+}
+
 std::optional<Rect> SolidColorContents::GetCoverage(
     const Entity& entity) const {
   if (color_.IsTransparent()) {
@@ -39,6 +48,16 @@ std::optional<Rect> SolidColorContents::GetCoverage(
   return geometry_->GetCoverage(entity.GetTransformation());
 };
 
+bool SolidColorContents::IsOpaque() const {
+  return color_.IsOpaque();
+}
+
+bool SolidColorContents::CoversArea(const Entity& entity,
+                                    const Rect& rect) const {
+  return geometry_ != nullptr &&
+         geometry_->CoversArea(entity.GetTransformation(), rect);
+}
+
 bool SolidColorContents::ShouldRender(
     const Entity& entity,
     const std::optional<Rect>& stencil_coverage) const {
@@ -64,6 +83,9 @@ bool SolidColorContents::Render(const ContentContext& renderer,
   if (geometry_result.prevent_overdraw) {
     options.stencil_compare = CompareFunction::kEqual;
     options.stencil_operation = StencilOperation::kIncrementClamp;
+  } else if (geometry_result.stencil_cover) {
+    options.stencil_compare = CompareFunction::kNotEqual;
+    options.stencil_operation = StencilOperation::kSetToReferenceValue;
   }
 
   cmd.pipeline = renderer.GetSolidFillPipeline(options);
@@ -97,4 +119,108 @@ std::unique_ptr<SolidColorContents> SolidColorContents::Make(const Path& path,
   return contents;
 }
 
+BatchedSolidColorContents::BatchedSolidColorContents() = default;
+
+BatchedSolidColorContents::~BatchedSolidColorContents() = default;
+
+const SolidColorContents* BatchedSolidColorContents::AsBatchableSolidColor(
+    const Entity& entity) {
+  if (entity.GetBlendMode() > Entity::kLastPipelineBlendMode) {
+    return nullptr;
+  }
+  // Transforms are applied on the CPU, which is only exact for transforms
+  // that map the rect to a parallelogram.
+  if (!entity.GetTransformation().IsAffine()) {
+    return nullptr;
+  }
+  auto contents = entity.GetContents();
+  if (!contents) {
+    return nullptr;
+  }
+  auto solid = contents->AsSolidColor();
+  if (!solid || !solid->GetGeometry() ||
+      !solid->GetGeometry()->AsRect().has_value()) {
+    return nullptr;
+  }
+  return solid;
+}
+
+void BatchedSolidColorContents::AddRect(Rect rect,
+                                        const Matrix& transform,
+                                        Color color) {
+  entries_.push_back({rect, transform, color});
+}
+
+std::optional<Rect> BatchedSolidColorContents::GetCoverage(
+    const Entity& entity) const {
+  std::optional<Rect> result;
+  for (const auto& entry : entries_) {
+    if (entry.color.IsTransparent()) {
+      continue;
+    }
+    auto bounds = entry.rect.TransformBounds(entity.GetTransformation() *
+                                             entry.transform);
+    result = result.has_value() ? result->Union(bounds) : bounds;
+  }
+  return result;
+}
+
+bool BatchedSolidColorContents::IsOpaque() const {
+  for (const auto& entry : entries_) {
+    if (!entry.color.IsOpaque()) {
+      return false;
+    }
+  }
+  return !entries_.empty();
+}
+
+bool BatchedSolidColorContents::CoversArea(const Entity& entity,
+                                           const Rect& rect) const {
+  for (const auto& entry : entries_) {
+    auto transform = entity.GetTransformation() * entry.transform;
+    if (transform.IsAffine() && transform.IsAligned() &&
+        entry.rect.TransformBounds(transform).Contains(rect)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BatchedSolidColorContents::Render(const ContentContext& renderer,
+                                       const Entity& entity,
+                                       RenderPass& pass) const {
+  using VS = GeometryColorPipeline::VertexShader;
+
+  if (entries_.empty()) {
+    return true;
+  }
+
+  Command cmd;
+  cmd.label = "Batched Solid Color";
+  cmd.stencil_reference = entity.GetStencilDepth();
+  cmd.pipeline =
+      renderer.GetGeometryColorPipeline(OptionsFromPassAndEntity(pass, entity));
+  cmd.primitive_type = PrimitiveType::kTriangle;
+
+  VertexBufferBuilder<VS::PerVertexData> vtx_builder;
+  vtx_builder.Reserve(entries_.size() * 6);
+  for (const auto& entry : entries_) {
+    auto points = entry.rect.GetTransformedPoints(entry.transform);
+    auto color = entry.color.Premultiply();
+    // |Rect::GetPoints| orders the corners top left, top right, bottom left,
+    // bottom right.
+    for (auto index : {0, 1, 2, 1, 3, 2}) {
+      vtx_builder.AppendVertex({.position = points[index], .color = color});
+    }
+  }
+  cmd.BindVertices(vtx_builder.CreateVertexBuffer(pass.GetTransientsBuffer()));
+
+  VS::VertInfo vert_info;
+  vert_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                  entity.GetTransformation();
+  VS::BindVertInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(vert_info));
+
+  return pass.AddCommand(std::move(cmd));
+}
+
 }  // namespace impeller
@@ -31,6 +31,8 @@ class SolidColorContents final : public Contents {
 
   void SetGeometry(std::unique_ptr<Geometry> geometry);
 
+  const Geometry* GetGeometry() const;
+
   void SetColor(Color color);
 
   const Color& GetColor() const;
@@ -38,6 +40,15 @@ class SolidColorContents final : public Contents {
   // |Contents|
   std::optional<Rect> GetCoverage(const Entity& entity) const override;
 
+  // |Contents|
+  bool IsOpaque() const override;
+
+  // |Contents|
+  bool CoversArea(const Entity& entity, const Rect& rect) const override;
+
+  // |Contents|
+  const SolidColorContents* AsSolidColor() const override;
+
   // |Contents|
   bool ShouldRender(const Entity& entity,
                     const std::optional<Rect>& stencil_coverage) const override;
@@ -55,4 +66,48 @@ class SolidColorContents final : public Contents {
   FML_DISALLOW_COPY_AND_ASSIGN(SolidColorContents);
 };
 
+/// @brief Renders a run of solid color rect draws that were recorded as
+///        separate entities with a single per-vertex color draw call. Each
+///        entity's transform is baked into the vertex positions, so draws
+///        with differing (affine) transforms still batch. Runs are formed
+///        by |EntityPass::AddEntity|.
+class BatchedSolidColorContents final : public Contents {
+ public:
+  BatchedSolidColorContents();
+
+  ~BatchedSolidColorContents() override;
+
+  /// @brief If `entity` is a draw a batch could absorb — a solid color
+  ///        rect with an affine transform and a pipeline blend mode —
+  ///        return its contents.
+  static const SolidColorContents* AsBatchableSolidColor(const Entity& entity);
+
+  void AddRect(Rect rect, const Matrix& transform, Color color);
+
+  // |Contents|
+  std::optional<Rect> GetCoverage(const Entity& entity) const override;
+
+  // |Contents|
+  bool IsOpaque() const override;
+
+  // |Contents|
+  bool CoversArea(const Entity& entity, const Rect& rect) const override;
+
+  // |Contents|
+  bool Render(const ContentContext& renderer,
+              const Entity& entity,
+              RenderPass& pass) const override;
+
+ private:
+  struct BatchEntry {
+    Rect rect;
+    Matrix transform;
+    Color color;
+  };
+
+  std::vector<BatchEntry> entries_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(BatchedSolidColorContents);
+};
+
 }  // namespace impeller
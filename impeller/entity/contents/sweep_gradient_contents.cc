@@ -7,7 +7,7 @@
 #include "flutter/fml/logging.h"
 #include "impeller/entity/contents/clip_contents.h"
 #include "impeller/entity/contents/content_context.h"
-#include "impeller/entity/contents/gradient_generator.h"
+#include "impeller/entity/contents/gradient_texture_cache.h"
 #include "impeller/entity/entity.h"
 #include "impeller/renderer/render_pass.h"
 #include "impeller/renderer/sampler_library.h"
@@ -55,8 +55,8 @@ bool SweepGradientContents::Render(const ContentContext& renderer,
   using VS = SweepGradientFillPipeline::VertexShader;
   using FS = SweepGradientFillPipeline::FragmentShader;
 
-  auto gradient_texture =
-      CreateGradientTexture(colors_, stops_, renderer.GetContext());
+  auto gradient_texture = renderer.GetGradientTextureCache()->GetOrCreateTexture(
+      colors_, stops_, renderer.GetContext());
   if (gradient_texture == nullptr) {
     return false;
   }
@@ -87,6 +87,9 @@ bool SweepGradientContents::Render(const ContentContext& renderer,
   if (geometry_result.prevent_overdraw) {
     options.stencil_compare = CompareFunction::kEqual;
     options.stencil_operation = StencilOperation::kIncrementClamp;
+  } else if (geometry_result.stencil_cover) {
+    options.stencil_compare = CompareFunction::kNotEqual;
+    options.stencil_operation = StencilOperation::kSetToReferenceValue;
   }
   cmd.pipeline = renderer.GetSweepGradientFillPipeline(options);
 
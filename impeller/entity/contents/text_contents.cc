@@ -174,12 +174,27 @@ static bool CommonRender(
   return true;
 }
 
+bool TextContents::ShouldUseSdf(const Entity& entity) const {
+  // Color glyphs cannot be represented as a single channel distance field.
+  if (lazy_atlas_ == nullptr || lazy_atlas_->HasColor()) {
+    return false;
+  }
+  // Bitmap glyphs are rasterized at the frame's own scale, so any additional
+  // scale from the current transform would resample the bitmaps and (during
+  // scale animations) re-rasterize the atlas every time the frame is laid
+  // out at a new size. The distance field atlas is rendered once and stays
+  // crisp across a wide range of scales.
+  constexpr Scalar kScaleTolerance = 1e-3;
+  auto scale = entity.GetTransformation().GetMaxBasisLength();
+  return Absolute(scale - 1) > kScaleTolerance;
+}
+
 bool TextContents::RenderSdf(const ContentContext& renderer,
                              const Entity& entity,
                              RenderPass& pass) const {
-  auto atlas =
-      ResolveAtlas(GlyphAtlas::Type::kSignedDistanceField,
-                   renderer.GetGlyphAtlasContext(), renderer.GetContext());
+  auto type = GlyphAtlas::Type::kSignedDistanceField;
+  auto atlas = ResolveAtlas(type, renderer.GetGlyphAtlasContext(type),
+                            renderer.GetContext());
 
   if (!atlas || !atlas->IsValid()) {
     VALIDATION_LOG << "Cannot render glyphs without prepared atlas.";
@@ -205,16 +220,22 @@ bool TextContents::Render(const ContentContext& renderer,
     return true;
   }
 
+  if (ShouldUseSdf(entity)) {
+    return RenderSdf(renderer, entity, pass);
+  }
+
   // This TextContents may be for a frame that doesn't have color, but the
   // lazy atlas for this scene already does have color.
   // Benchmarks currently show that creating two atlases per pass regresses
-  // render time. This should get re-evaluated if we start caching atlases
-  // between frames or get significantly faster at creating atlases, because
-  // we're potentially trading memory for time here.
+  // render time. Atlases are now cached across frames on the content
+  // context, so this should get re-evaluated if we get significantly faster
+  // at creating atlases, because we're potentially trading memory for time
+  // here.
+  auto type = lazy_atlas_->HasColor() ? GlyphAtlas::Type::kColorBitmap
+                                      : GlyphAtlas::Type::kAlphaBitmap;
   auto atlas =
-      ResolveAtlas(lazy_atlas_->HasColor() ? GlyphAtlas::Type::kColorBitmap
-                                           : GlyphAtlas::Type::kAlphaBitmap,
-                   renderer.GetGlyphAtlasContext(), renderer.GetContext());
+      ResolveAtlas(type, renderer.GetGlyphAtlasContext(type),
+                   renderer.GetContext());
 
   if (!atlas || !atlas->IsValid()) {
     VALIDATION_LOG << "Cannot render glyphs without prepared atlas.";
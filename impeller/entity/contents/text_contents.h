@@ -50,6 +50,13 @@ class TextContents final : public Contents {
   Color color_;
   mutable std::shared_ptr<LazyGlyphAtlas> lazy_atlas_;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the frame should render via the signed distance
+  ///             field atlas. Scaled (non color) text does, so that scale
+  ///             animations never re-rasterize the glyphs.
+  ///
+  bool ShouldUseSdf(const Entity& entity) const;
+
   std::shared_ptr<GlyphAtlas> ResolveAtlas(
       GlyphAtlas::Type type,
       std::shared_ptr<GlyphAtlasContext> atlas_context,
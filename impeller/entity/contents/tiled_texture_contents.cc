@@ -76,6 +76,9 @@ bool TiledTextureContents::Render(const ContentContext& renderer,
   if (geometry_result.prevent_overdraw) {
     options.stencil_compare = CompareFunction::kEqual;
     options.stencil_operation = StencilOperation::kIncrementClamp;
+  } else if (geometry_result.stencil_cover) {
+    options.stencil_compare = CompareFunction::kNotEqual;
+    options.stencil_operation = StencilOperation::kSetToReferenceValue;
   }
   cmd.pipeline = renderer.GetTiledTexturePipeline(options);
 
@@ -48,6 +48,19 @@ bool Entity::ShouldRender(const std::optional<Rect>& stencil_coverage) const {
   return contents_->ShouldRender(*this, stencil_coverage);
 }
 
+bool Entity::ObscuresArea(const Rect& rect) const {
+  if (!contents_) {
+    return false;
+  }
+  // Only blend modes that replace the destination with the unmodified source
+  // color guarantee that prior draws cannot show through.
+  if (blend_mode_ != BlendMode::kSource &&
+      blend_mode_ != BlendMode::kSourceOver) {
+    return false;
+  }
+  return contents_->IsOpaque() && contents_->CoversArea(*this, rect);
+}
+
 void Entity::SetContents(std::shared_ptr<Contents> contents) {
   contents_ = std::move(contents);
 }
@@ -64,6 +64,11 @@ class Entity {
 
   bool ShouldRender(const std::optional<Rect>& stencil_coverage) const;
 
+  /// @brief Whether this entity, drawn as-is, leaves every pixel of `rect`
+  ///        fully opaque with its own contents, hiding anything drawn there
+  ///        earlier. Conservative: false when unsure.
+  bool ObscuresArea(const Rect& rect) const;
+
   void SetContents(std::shared_ptr<Contents> contents);
 
   const std::shared_ptr<Contents>& GetContents() const;
@@ -0,0 +1,156 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Benchmarks for the CPU side of the entity layer: pass construction
+// (including solid color batching), coverage computation and the per-entity
+// stencil coverage bookkeeping performed while encoding. Everything here
+// runs without a GPU context so the costs measured are pure encode-side
+// work.
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/benchmarking/perf_counters.h"
+
+#include "impeller/entity/contents/clip_contents.h"
+#include "impeller/entity/contents/solid_color_contents.h"
+#include "impeller/entity/entity.h"
+#include "impeller/entity/entity_pass.h"
+#include "impeller/entity/geometry.h"
+#include "impeller/geometry/color.h"
+#include "impeller/geometry/path_builder.h"
+
+namespace impeller {
+
+namespace {
+
+Entity CreateSolidRectEntity(size_t index) {
+  auto contents = std::make_shared<SolidColorContents>();
+  contents->SetColor(index % 2 == 0 ? Color::CornflowerBlue() : Color::Red());
+  contents->SetGeometry(Geometry::MakeRect(
+      Rect::MakeXYWH(static_cast<Scalar>(index % 100),
+                     static_cast<Scalar>(index % 53), 100, 100)));
+  Entity entity;
+  entity.SetTransformation(
+      Matrix::MakeTranslation({static_cast<Scalar>(index % 7), 0, 0}));
+  entity.SetContents(std::move(contents));
+  return entity;
+}
+
+Entity CreateClipEntity(size_t index) {
+  PathBuilder builder;
+  builder.AddRoundedRect(
+      Rect::MakeXYWH(static_cast<Scalar>(index % 31),
+                     static_cast<Scalar>(index % 17), 200, 150),
+      10);
+  auto contents = std::make_shared<ClipContents>();
+  contents->SetGeometry(Geometry::MakeFillPath(builder.TakePath()));
+  Entity entity;
+  entity.SetContents(std::move(contents));
+  return entity;
+}
+
+std::unique_ptr<EntityPass> CreateFlatPass(size_t entity_count) {
+  auto pass = std::make_unique<EntityPass>();
+  for (size_t i = 0; i < entity_count; i++) {
+    pass->AddEntity(CreateSolidRectEntity(i));
+  }
+  return pass;
+}
+
+std::unique_ptr<EntityPass> CreateNestedPass(size_t depth,
+                                             size_t entities_per_pass) {
+  auto root = std::make_unique<EntityPass>();
+  EntityPass* current = root.get();
+  for (size_t level = 0; level < depth; level++) {
+    for (size_t i = 0; i < entities_per_pass; i++) {
+      current->AddEntity(CreateSolidRectEntity(level * entities_per_pass + i));
+    }
+    current = current->AddSubpass(std::make_unique<EntityPass>());
+  }
+  current->AddEntity(CreateSolidRectEntity(0));
+  return root;
+}
+
+}  // namespace
+
+// Measures the cost of recording entities into a pass, including the solid
+// color rect batching performed by |EntityPass::AddEntity|.
+static void BM_EntityPassAddEntities(benchmark::State& state) {
+  const size_t entity_count = state.range(0);
+  benchmarking::ScopedPerfCounters perf(state);
+  while (state.KeepRunning()) {
+    auto pass = CreateFlatPass(entity_count);
+    benchmark::DoNotOptimize(pass);
+  }
+  state.counters["EntityCount"] = entity_count;
+}
+
+// Measures coverage union computation over a flat pass, the dominant cost of
+// sizing subpass render targets.
+static void BM_EntityPassElementsCoverage(benchmark::State& state) {
+  const size_t entity_count = state.range(0);
+  auto pass = CreateFlatPass(entity_count);
+  benchmarking::ScopedPerfCounters perf(state);
+  while (state.KeepRunning()) {
+    auto coverage = pass->GetElementsCoverage(std::nullopt);
+    benchmark::DoNotOptimize(coverage);
+  }
+}
+
+// Measures recursive coverage computation through a chain of nested
+// subpasses.
+static void BM_EntityPassSubpassCoverage(benchmark::State& state) {
+  const size_t depth = state.range(0);
+  auto pass = CreateNestedPass(depth, /*entities_per_pass=*/8);
+  benchmarking::ScopedPerfCounters perf(state);
+  while (state.KeepRunning()) {
+    auto coverage = pass->GetElementsCoverage(std::nullopt);
+    benchmark::DoNotOptimize(coverage);
+  }
+}
+
+// Measures the per-entity stencil coverage bookkeeping the encoder performs,
+// with a clip entity interleaved every eight draws.
+static void BM_EntityClipCoverage(benchmark::State& state) {
+  const size_t entity_count = state.range(0);
+  std::vector<Entity> entities;
+  entities.reserve(entity_count);
+  uint32_t stencil_depth = 0u;
+  for (size_t i = 0; i < entity_count; i++) {
+    if (i % 8 == 7) {
+      auto clip = CreateClipEntity(i);
+      clip.SetStencilDepth(stencil_depth++);
+      entities.emplace_back(std::move(clip));
+    } else {
+      auto draw = CreateSolidRectEntity(i);
+      draw.SetStencilDepth(stencil_depth);
+      entities.emplace_back(std::move(draw));
+    }
+  }
+
+  benchmarking::ScopedPerfCounters perf(state);
+  while (state.KeepRunning()) {
+    std::optional<Rect> stencil_coverage = Rect::MakeXYWH(0, 0, 1024, 768);
+    size_t rendered = 0u;
+    for (const auto& entity : entities) {
+      auto result = entity.GetStencilCoverage(stencil_coverage);
+      if (result.coverage.has_value()) {
+        stencil_coverage = result.coverage;
+      }
+      if (entity.ShouldRender(stencil_coverage)) {
+        rendered++;
+      }
+    }
+    benchmark::DoNotOptimize(rendered);
+  }
+}
+
+BENCHMARK(BM_EntityPassAddEntities)->Arg(16)->Arg(256)->Arg(4096);
+
+BENCHMARK(BM_EntityPassElementsCoverage)->Arg(16)->Arg(256)->Arg(4096);
+
+BENCHMARK(BM_EntityPassSubpassCoverage)->Arg(1)->Arg(8)->Arg(32);
+
+BENCHMARK(BM_EntityClipCoverage)->Arg(64)->Arg(1024);
+
+}  // namespace impeller
@@ -15,6 +15,7 @@
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/contents/filters/color_filter_contents.h"
 #include "impeller/entity/contents/filters/inputs/filter_input.h"
+#include "impeller/entity/contents/solid_color_contents.h"
 #include "impeller/entity/contents/texture_contents.h"
 #include "impeller/entity/entity.h"
 #include "impeller/entity/inline_pass_context.h"
@@ -44,11 +45,55 @@ void EntityPass::AddEntity(Entity entity) {
     reads_from_pass_texture_ += 1;
   }
 
+  //----------------------------------------------------------------------------
+  /// Merge runs of solid color rect draws (the most common content by far)
+  /// into a single per-vertex color draw call instead of recording one
+  /// entity and draw per rect.
+
+  if (auto solid = BatchedSolidColorContents::AsBatchableSolidColor(entity)) {
+    auto rect = solid->GetGeometry()->AsRect().value();
+    if ((batch_ != nullptr || batch_candidate_) &&
+        batch_blend_mode_ == entity.GetBlendMode() &&
+        batch_stencil_depth_ == entity.GetStencilDepth()) {
+      if (batch_ == nullptr) {
+        // A second compatible draw arrived; convert the candidate recorded
+        // by the previous call into a batch.
+        auto& previous = std::get<Entity>(elements_.back());
+        auto previous_solid =
+            BatchedSolidColorContents::AsBatchableSolidColor(previous);
+        auto batch = std::make_shared<BatchedSolidColorContents>();
+        batch->AddRect(previous_solid->GetGeometry()->AsRect().value(),
+                       previous.GetTransformation(),
+                       previous_solid->GetColor());
+        batch_ = batch.get();
+        previous.SetContents(std::move(batch));
+        previous.SetTransformation({});
+      }
+      batch_->AddRect(rect, entity.GetTransformation(), solid->GetColor());
+      return;
+    }
+    // Not compatible with the current run; this draw starts a new one.
+    batch_ = nullptr;
+    batch_candidate_ = true;
+    batch_blend_mode_ = entity.GetBlendMode();
+    batch_stencil_depth_ = entity.GetStencilDepth();
+    elements_.emplace_back(std::move(entity));
+    return;
+  }
+
+  batch_ = nullptr;
+  batch_candidate_ = false;
   elements_.emplace_back(std::move(entity));
 }
 
+size_t EntityPass::GetElementCount() const {
+  return elements_.size();
+}
+
 void EntityPass::SetElements(std::vector<Element> elements) {
   elements_ = std::move(elements);
+  batch_ = nullptr;
+  batch_candidate_ = false;
 }
 
 size_t EntityPass::GetSubpassesDepth() const {
@@ -138,6 +183,10 @@ EntityPass* EntityPass::AddSubpass(std::unique_ptr<EntityPass> pass) {
     reads_from_pass_texture_ += 1;
   }
 
+  // A subpass interleaves with draw order, so it ends any batchable run.
+  batch_ = nullptr;
+  batch_candidate_ = false;
+
   auto subpass_pointer = pass.get();
   elements_.emplace_back(std::move(pass));
   return subpass_pointer;
@@ -274,7 +323,15 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
       return EntityPass::EntityResult::Skip();
     }
 
-    std::shared_ptr<Contents> backdrop_filter_contents = nullptr;
+    auto subpass_coverage =
+        GetSubpassCoverage(*subpass, Rect::MakeSize(root_pass_size));
+
+    // The global space region the subpass elements cover, used to clamp the
+    // backdrop filter below. Captured before the backdrop coverage is unioned
+    // in since the clamp must not feed back into itself.
+    auto subpass_elements_coverage = subpass_coverage;
+
+    std::shared_ptr<FilterContents> backdrop_filter_contents = nullptr;
     if (subpass->backdrop_filter_proc_.has_value()) {
       auto texture = pass_context.GetTexture();
       // Render the backdrop texture before any of the pass elements.
@@ -282,14 +339,24 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
       backdrop_filter_contents =
           proc(FilterInput::Make(std::move(texture)), subpass->xformation_);
 
+      // Clamp the filter evaluation to the region the subpass elements
+      // actually cover; the filter expands its backdrop read by its own
+      // kernel apron internally. Without this, a backdrop filtered strip
+      // pays for filtering the entire pass texture. The crop is expressed
+      // in this pass texture's local space, matching the identity entity
+      // used for the coverage query below.
+      if (backdrop_filter_contents && subpass_elements_coverage.has_value() &&
+          !subpass->cover_whole_screen_) {
+        auto local_crop = subpass_elements_coverage.value();
+        local_crop.origin -= position;
+        backdrop_filter_contents->SetCoverageCrop(local_crop);
+      }
+
       // The subpass will need to read from the current pass texture when
       // rendering the backdrop, so if there's an active pass, end it prior to
       // rendering the subpass.
       pass_context.EndPass();
     }
-
-    auto subpass_coverage =
-        GetSubpassCoverage(*subpass, Rect::MakeSize(root_pass_size));
     if (subpass->cover_whole_screen_) {
       subpass_coverage = Rect(
           position, Size(pass_context.GetRenderTarget().GetRenderTargetSize()));
@@ -353,6 +420,16 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
       return EntityPass::EntityResult::Failure();
     }
 
+    // The backdrop entity is rendered inside the subpass, where the filter's
+    // coverage lands in the subpass target's local space. Move the crop into
+    // that space now that the subpass origin is final.
+    if (backdrop_filter_contents && subpass_elements_coverage.has_value() &&
+        !subpass->cover_whole_screen_) {
+      auto local_crop = subpass_elements_coverage.value();
+      local_crop.origin -= subpass_coverage->origin;
+      backdrop_filter_contents->SetCoverageCrop(local_crop);
+    }
+
     // Stencil textures aren't shared between EntityPasses (as much of the
     // time they are transient).
     if (!subpass->OnRender(renderer, root_pass_size, subpass_target,
@@ -489,7 +566,42 @@ bool EntityPass::OnRender(
     render_element(backdrop_entity);
   }
 
-  for (const auto& element : elements_) {
+  //--------------------------------------------------------------------------
+  /// Find the last whole-pass occluder, if any.
+  ///
+  /// There is no depth attachment to reject fragments hidden behind later
+  /// draws in hardware, so elements that are entirely obscured by a later
+  /// opaque draw covering the full render target are culled up front
+  /// instead. Only unclipped draws qualify as occluders, and only passes
+  /// that render at the render target origin without a backdrop filter are
+  /// scanned, since an occluder must cover the entire target to be safe.
+
+  size_t first_unobscured_element = 0u;
+  if (position.IsZero() && !backdrop_filter_proc_.has_value()) {
+    auto pass_coverage = Rect::MakeSize(render_target.GetRenderTargetSize());
+    for (size_t i = 0; i < elements_.size(); i++) {
+      auto entity = std::get_if<Entity>(&elements_[i]);
+      if (entity && entity->GetStencilDepth() == stencil_depth_floor &&
+          entity->ObscuresArea(pass_coverage)) {
+        first_unobscured_element = i;
+      }
+    }
+  }
+
+  for (size_t element_i = 0; element_i < elements_.size(); element_i++) {
+    const auto& element = elements_[element_i];
+
+    if (element_i < first_unobscured_element) {
+      // This element is entirely hidden behind a later opaque draw. Clip ops
+      // and subpasses still render because later elements may depend on the
+      // stencil state they produce, but plain draws are skipped.
+      auto entity = std::get_if<Entity>(&element);
+      if (entity && entity->GetStencilCoverage(std::nullopt).type ==
+                        Contents::StencilCoverage::Type::kNone) {
+        continue;
+      }
+    }
+
     EntityResult result =
         GetEntityForElement(element, renderer, pass_context, root_pass_size,
                             position, pass_depth, stencil_depth_floor);
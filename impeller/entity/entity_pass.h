@@ -20,6 +20,7 @@
 
 namespace impeller {
 
+class BatchedSolidColorContents;
 class ContentContext;
 
 class EntityPass {
@@ -41,6 +42,8 @@ class EntityPass {
 
   void AddEntity(Entity entity);
 
+  size_t GetElementCount() const;
+
   void SetElements(std::vector<Element> elements);
 
   const std::shared_ptr<LazyGlyphAtlas>& GetLazyGlyphAtlas() const;
@@ -113,6 +116,16 @@ class EntityPass {
 
   std::vector<Element> elements_;
 
+  /// Solid color rect batching state. When the last element added is a
+  /// batchable solid color rect draw (see |AddEntity|), `batch_candidate_`
+  /// is true; once a second compatible draw arrives, the candidate is
+  /// converted into a |BatchedSolidColorContents| pointed to by `batch_`
+  /// and further compatible draws are absorbed into it.
+  BatchedSolidColorContents* batch_ = nullptr;
+  bool batch_candidate_ = false;
+  BlendMode batch_blend_mode_ = BlendMode::kSourceOver;
+  uint32_t batch_stencil_depth_ = 0u;
+
   EntityPass* superpass_ = nullptr;
   Matrix xformation_;
   size_t stencil_depth_ = 0u;
@@ -138,6 +151,9 @@ class EntityPass {
 
 struct CanvasStackEntry {
   Matrix xformation;
+  // The device space bounds that intersect clips have reduced coverage to.
+  // Draws that miss these bounds entirely can be rejected at record time.
+  std::optional<Rect> cull_rect;
   size_t stencil_depth = 0u;
   bool is_subpass = false;
   bool contains_clips = false;
@@ -2068,5 +2068,143 @@ TEST_P(EntityTest, RuntimeEffect) {
   ASSERT_TRUE(OpenPlaygroundHere(callback));
 }
 
+TEST_P(EntityTest, GeometryCoversArea) {
+  auto rect = Geometry::MakeRect(Rect::MakeLTRB(0, 0, 100, 100));
+  ASSERT_TRUE(rect->CoversArea({}, Rect::MakeLTRB(0, 0, 100, 100)));
+  ASSERT_TRUE(rect->CoversArea({}, Rect::MakeLTRB(10, 10, 90, 90)));
+  ASSERT_FALSE(rect->CoversArea({}, Rect::MakeLTRB(-1, 0, 100, 100)));
+  ASSERT_TRUE(rect->CoversArea({}, Rect{}));
+
+  // Translation and axis-aligned scale preserve coverage, but rotation does
+  // not because the transformed bounds are no longer exact.
+  ASSERT_TRUE(rect->CoversArea(Matrix::MakeTranslation({10, 10, 0}),
+                               Rect::MakeLTRB(10, 10, 110, 110)));
+  ASSERT_TRUE(rect->CoversArea(Matrix::MakeScale({2, 2, 1}),
+                               Rect::MakeLTRB(0, 0, 200, 200)));
+  ASSERT_FALSE(rect->CoversArea(Matrix::MakeRotationZ(Degrees(45)),
+                                Rect::MakeLTRB(-1, -1, 1, 1)));
+
+  auto cover = Geometry::MakeCover();
+  ASSERT_TRUE(cover->CoversArea({}, Rect::MakeLTRB(0, 0, 1000, 1000)));
+  ASSERT_TRUE(cover->CoversArea(Matrix::MakeRotationZ(Degrees(45)), Rect{}));
+
+  auto fill = Geometry::MakeFillPath(
+      PathBuilder{}.AddRect(Rect::MakeLTRB(0, 0, 100, 100)).TakePath());
+  ASSERT_FALSE(fill->CoversArea({}, Rect{}));
+}
+
+TEST_P(EntityTest, SolidColorContentsIsOpaque) {
+  SolidColorContents contents;
+  contents.SetColor(Color::CornflowerBlue());
+  ASSERT_TRUE(contents.IsOpaque());
+  contents.SetColor(Color::CornflowerBlue().WithAlpha(0.5));
+  ASSERT_FALSE(contents.IsOpaque());
+}
+
+TEST_P(EntityTest, ObscuresArea) {
+  auto make_entity = [](Color color, BlendMode blend_mode) {
+    auto contents = std::make_shared<SolidColorContents>();
+    contents->SetGeometry(Geometry::MakeRect(Rect::MakeLTRB(0, 0, 100, 100)));
+    contents->SetColor(color);
+    Entity entity;
+    entity.SetContents(std::move(contents));
+    entity.SetBlendMode(blend_mode);
+    return entity;
+  };
+
+  auto opaque = make_entity(Color::CornflowerBlue(), BlendMode::kSourceOver);
+  ASSERT_TRUE(opaque.ObscuresArea(Rect::MakeLTRB(0, 0, 100, 100)));
+  ASSERT_TRUE(opaque.ObscuresArea(Rect::MakeLTRB(25, 25, 75, 75)));
+  ASSERT_FALSE(opaque.ObscuresArea(Rect::MakeLTRB(0, 0, 101, 100)));
+
+  // Translucent colors and blend modes that mix with or expose the
+  // destination never obscure.
+  auto translucent = make_entity(Color::CornflowerBlue().WithAlpha(0.5),
+                                 BlendMode::kSourceOver);
+  ASSERT_FALSE(translucent.ObscuresArea(Rect::MakeLTRB(25, 25, 75, 75)));
+  auto multiply = make_entity(Color::CornflowerBlue(), BlendMode::kMultiply);
+  ASSERT_FALSE(multiply.ObscuresArea(Rect::MakeLTRB(25, 25, 75, 75)));
+
+  Entity empty;
+  ASSERT_FALSE(empty.ObscuresArea(Rect{}));
+}
+
+TEST_P(EntityTest, SolidColorRectDrawsBatch) {
+  auto make_rect_entity = [](Rect rect, Color color,
+                             BlendMode blend_mode = BlendMode::kSourceOver,
+                             uint32_t stencil_depth = 0u) {
+    auto contents = std::make_shared<SolidColorContents>();
+    contents->SetGeometry(Geometry::MakeRect(rect));
+    contents->SetColor(color);
+    Entity entity;
+    entity.SetContents(std::move(contents));
+    entity.SetBlendMode(blend_mode);
+    entity.SetStencilDepth(stencil_depth);
+    return entity;
+  };
+
+  EntityPass pass;
+
+  // Consecutive compatible rect draws collapse into one element.
+  pass.AddEntity(make_rect_entity(Rect::MakeLTRB(0, 0, 10, 10), Color::Red()));
+  pass.AddEntity(
+      make_rect_entity(Rect::MakeLTRB(20, 20, 30, 30), Color::Green()));
+  pass.AddEntity(
+      make_rect_entity(Rect::MakeLTRB(40, 40, 50, 50), Color::Blue()));
+  ASSERT_EQ(pass.GetElementCount(), 1u);
+
+  auto coverage = pass.GetElementsCoverage(std::nullopt);
+  ASSERT_TRUE(coverage.has_value());
+  ASSERT_RECT_NEAR(coverage.value(), Rect::MakeLTRB(0, 0, 50, 50));
+
+  // A different blend mode is still batchable but starts a new run.
+  pass.AddEntity(make_rect_entity(Rect::MakeLTRB(0, 0, 10, 10), Color::Red(),
+                                  BlendMode::kMultiply));
+  ASSERT_EQ(pass.GetElementCount(), 2u);
+
+  // A different stencil depth also starts a new run.
+  pass.AddEntity(make_rect_entity(Rect::MakeLTRB(0, 0, 10, 10), Color::Red(),
+                                  BlendMode::kMultiply, 1u));
+  ASSERT_EQ(pass.GetElementCount(), 3u);
+
+  // Non-rect geometry isn't batchable and ends the run.
+  Entity path_entity;
+  {
+    auto contents = std::make_shared<SolidColorContents>();
+    contents->SetGeometry(Geometry::MakeFillPath(
+        PathBuilder{}.AddCircle({5, 5}, 5).TakePath()));
+    contents->SetColor(Color::White());
+    path_entity.SetContents(std::move(contents));
+  }
+  pass.AddEntity(path_entity);
+  pass.AddEntity(make_rect_entity(Rect::MakeLTRB(0, 0, 10, 10), Color::Red()));
+  pass.AddEntity(
+      make_rect_entity(Rect::MakeLTRB(10, 0, 20, 10), Color::Blue()));
+  ASSERT_EQ(pass.GetElementCount(), 6u);
+}
+
+TEST_P(EntityTest, BatchedSolidColorContentsClassifiers) {
+  Entity entity;
+
+  BatchedSolidColorContents batch;
+  ASSERT_FALSE(batch.GetCoverage(entity).has_value());
+  ASSERT_FALSE(batch.IsOpaque());
+
+  batch.AddRect(Rect::MakeLTRB(0, 0, 100, 100), Matrix(),
+                Color::CornflowerBlue());
+  batch.AddRect(Rect::MakeLTRB(0, 0, 10, 10),
+                Matrix::MakeTranslation({100, 0, 0}), Color::Red());
+  auto coverage = batch.GetCoverage(entity);
+  ASSERT_TRUE(coverage.has_value());
+  ASSERT_RECT_NEAR(coverage.value(), Rect::MakeLTRB(0, 0, 110, 100));
+  ASSERT_TRUE(batch.IsOpaque());
+  ASSERT_TRUE(batch.CoversArea(entity, Rect::MakeLTRB(25, 25, 75, 75)));
+  ASSERT_FALSE(batch.CoversArea(entity, Rect::MakeLTRB(0, 0, 110, 100)));
+
+  batch.AddRect(Rect::MakeLTRB(0, 0, 10, 10), Matrix(),
+                Color::Red().WithAlpha(0.5));
+  ASSERT_FALSE(batch.IsOpaque());
+}
+
 }  // namespace testing
 }  // namespace impeller
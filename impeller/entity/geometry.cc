@@ -3,11 +3,13 @@
 // found in the LICENSE file.
 
 #include "impeller/entity/geometry.h"
+#include "impeller/entity/compute_tessellator.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/position_color.vert.h"
 #include "impeller/geometry/path_builder.h"
 #include "impeller/renderer/device_buffer.h"
 #include "impeller/renderer/render_pass.h"
+#include "impeller/tessellator/tessellation_cache.h"
 #include "impeller/tessellator/tessellator.h"
 
 namespace impeller {
@@ -47,6 +49,16 @@ std::unique_ptr<Geometry> Geometry::MakeRect(Rect rect) {
   return std::make_unique<RectGeometry>(rect);
 }
 
+std::optional<Rect> Geometry::AsRect() const {
+  return std::nullopt;
+}
+
+bool Geometry::CoversArea(const Matrix& transform, const Rect& rect) const {
+  return false;
+}
+
+void Geometry::SetAllowsStencilCover(bool allows_stencil_cover) {}
+
 /////// Vertices Geometry ///////
 
 VerticesGeometry::VerticesGeometry(const Vertices& vertices)
@@ -199,28 +211,177 @@ FillPathGeometry::FillPathGeometry(const Path& path) : path_(path) {}
 
 FillPathGeometry::~FillPathGeometry() = default;
 
+void FillPathGeometry::SetAllowsStencilCover(bool allows_stencil_cover) {
+  allows_stencil_cover_ = allows_stencil_cover;
+}
+
+bool FillPathGeometry::ShouldUseStencilCover(const Entity& entity) const {
+  if (!allows_stencil_cover_) {
+    return false;
+  }
+  // The winding counts are accumulated in the same stencil buffer that holds
+  // the clip depths, so the strategy is only safe when no clips are active
+  // and the entire stencil buffer is known to be zero.
+  if (entity.GetStencilDepth() != 0u) {
+    return false;
+  }
+  auto fill_type = path_.GetFillType();
+  if (fill_type != FillType::kNonZero && fill_type != FillType::kOdd) {
+    return false;
+  }
+  return path_.GetComponentCount() >= kMinStencilCoverComponentCount;
+}
+
+std::optional<GeometryResult> FillPathGeometry::GetStencilCoverBuffer(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass) {
+  using VS = ClipPipeline::VertexShader;
+  using FS = ClipPipeline::FragmentShader;
+
+  auto bounds = path_.GetBoundingBox();
+  if (!bounds.has_value() || bounds->IsEmpty()) {
+    return std::nullopt;
+  }
+
+  auto polyline = path_.CreatePolyline();
+  if (polyline.points.size() < 3u) {
+    return std::nullopt;
+  }
+
+  // Fan every contour around one shared origin point. Triangles that land
+  // outside the path cancel out of the winding counts, so the origin can be
+  // arbitrary.
+  VertexBufferBuilder<VS::PerVertexData> vtx_builder;
+  auto origin = polyline.points.front();
+  for (size_t contour_i = 0; contour_i < polyline.contours.size();
+       contour_i++) {
+    auto [start, end] = polyline.GetContourPointBounds(contour_i);
+    for (size_t i = start; i + 1 < end; i++) {
+      vtx_builder.AddVertices(
+          {{origin}, {polyline.points[i]}, {polyline.points[i + 1]}});
+    }
+  }
+  if (!vtx_builder.HasVertices()) {
+    return std::nullopt;
+  }
+
+  Command cmd;
+  cmd.label = "Stencil Fill";
+  cmd.primitive_type = PrimitiveType::kTriangle;
+  cmd.stencil_reference = entity.GetStencilDepth();
+
+  auto options = OptionsFromPassAndEntity(pass, entity);
+  options.stencil_compare = CompareFunction::kAlways;
+  if (path_.GetFillType() == FillType::kNonZero) {
+    // Front facing triangles increment and back facing triangles decrement,
+    // so every pixel ends up holding its winding count (modulo 256).
+    options.stencil_operation = StencilOperation::kIncrementWrap;
+    options.back_stencil_operation = StencilOperation::kDecrementWrap;
+  } else {
+    // Even-odd: every covering triangle toggles the pixel.
+    options.stencil_operation = StencilOperation::kInvert;
+  }
+  cmd.pipeline = renderer.GetClipPipeline(options);
+  cmd.BindVertices(vtx_builder.CreateVertexBuffer(pass.GetTransientsBuffer()));
+
+  VS::VertInfo info;
+  info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+             entity.GetTransformation();
+  VS::BindVertInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(info));
+
+  FS::FragInfo frag_info;
+  // Color writes are disabled in the clip pipeline.
+  frag_info.color = Color::SkyBlue();
+  FS::BindFragInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frag_info));
+
+  if (!pass.AddCommand(std::move(cmd))) {
+    return std::nullopt;
+  }
+
+  // The cover is the path's bounding rect. The consuming contents draws it
+  // with the stencil configuration described on GeometryResult, which also
+  // resets the winding counts back to zero.
+  auto points = bounds->GetPoints();
+  auto cover_vertices =
+      VertexBufferBuilder<VS::PerVertexData>{}
+          .AddVertices({{points[0]}, {points[1]}, {points[2]}, {points[3]}})
+          .CreateVertexBuffer(pass.GetTransientsBuffer());
+
+  return GeometryResult{
+      .type = PrimitiveType::kTriangleStrip,
+      .vertex_buffer = cover_vertices,
+      .prevent_overdraw = false,
+      .stencil_cover = true,
+  };
+}
+
 GeometryResult FillPathGeometry::GetPositionBuffer(
     const ContentContext& renderer,
     const Entity& entity,
     RenderPass& pass) {
-  VertexBuffer vertex_buffer;
   auto& host_buffer = pass.GetTransientsBuffer();
-  auto tesselation_result = renderer.GetTessellator()->Tessellate(
-      path_.GetFillType(), path_.CreatePolyline(),
-      [&vertex_buffer, &host_buffer](
-          const float* vertices, size_t vertices_count, const uint16_t* indices,
-          size_t indices_count) {
-        vertex_buffer.vertex_buffer = host_buffer.Emplace(
-            vertices, vertices_count * sizeof(float), alignof(float));
-        vertex_buffer.index_buffer = host_buffer.Emplace(
-            indices, indices_count * sizeof(uint16_t), alignof(uint16_t));
-        vertex_buffer.index_count = indices_count;
-        vertex_buffer.index_type = IndexType::k16bit;
-        return true;
-      });
-  if (tesselation_result != Tessellator::Result::kSuccess) {
-    return {};
+
+  // Large convex paths can be flattened on the GPU where the backend has
+  // compute support. Failures fall through to CPU tessellation.
+  if (ComputeTessellator::CanTessellate(renderer, path_)) {
+    auto compute_result =
+        ComputeTessellator::Tessellate(renderer, path_, host_buffer);
+    if (compute_result.has_value()) {
+      return compute_result.value();
+    }
+  }
+
+  // Complex paths skip tessellation entirely: a triangle fan accumulates
+  // winding counts in the stencil buffer and the returned cover rect is only
+  // drawn where those counts mark the path interior. This flattens the worst
+  // case for paths that mutate every frame and would otherwise retessellate.
+  if (ShouldUseStencilCover(entity)) {
+    auto stencil_cover_result = GetStencilCoverBuffer(renderer, entity, pass);
+    if (stencil_cover_result.has_value()) {
+      return stencil_cover_result.value();
+    }
   }
+
+  // Consult the tessellation cache first so that static paths are only
+  // tessellated once per scale bucket rather than once per frame.
+  auto cache = renderer.GetTessellationCache();
+  auto scale_bucket = TessellationCache::ScaleBucket(
+      entity.GetTransformation().GetMaxBasisLength());
+  std::shared_ptr<const TessellationCache::Mesh> mesh;
+  if (cache) {
+    mesh = cache->Get(path_.GetGenerationID(), scale_bucket);
+  }
+
+  if (!mesh) {
+    auto new_mesh = std::make_shared<TessellationCache::Mesh>();
+    auto tesselation_result = renderer.GetTessellator()->Tessellate(
+        path_.GetFillType(), path_.CreatePolyline(),
+        [&new_mesh](const float* vertices, size_t vertices_count,
+                    const uint16_t* indices, size_t indices_count) {
+          new_mesh->vertices.assign(vertices, vertices + vertices_count);
+          new_mesh->indices.assign(indices, indices + indices_count);
+          return true;
+        });
+    if (tesselation_result != Tessellator::Result::kSuccess) {
+      return {};
+    }
+    if (cache) {
+      cache->Put(path_.GetGenerationID(), scale_bucket, new_mesh);
+    }
+    mesh = std::move(new_mesh);
+  }
+
+  VertexBuffer vertex_buffer;
+  vertex_buffer.vertex_buffer = host_buffer.Emplace(
+      mesh->vertices.data(), mesh->vertices.size() * sizeof(float),
+      alignof(float));
+  vertex_buffer.index_buffer = host_buffer.Emplace(
+      mesh->indices.data(), mesh->indices.size() * sizeof(uint16_t),
+      alignof(uint16_t));
+  vertex_buffer.index_count = mesh->indices.size();
+  vertex_buffer.index_type = IndexType::k16bit;
+
   return GeometryResult{
       .type = PrimitiveType::kTriangle,
       .vertex_buffer = vertex_buffer,
@@ -647,6 +808,11 @@ std::optional<Rect> CoverGeometry::GetCoverage(const Matrix& transform) const {
   return Rect::MakeMaximum();
 }
 
+bool CoverGeometry::CoversArea(const Matrix& transform,
+                               const Rect& rect) const {
+  return true;
+}
+
 /////// Rect Geometry ///////
 
 RectGeometry::RectGeometry(Rect rect) : rect_(rect) {}
@@ -680,4 +846,18 @@ std::optional<Rect> RectGeometry::GetCoverage(const Matrix& transform) const {
   return rect_.TransformBounds(transform);
 }
 
+bool RectGeometry::CoversArea(const Matrix& transform,
+                              const Rect& rect) const {
+  // The transformed bounds are only an exact description of the filled
+  // region when the transform keeps the rect axis aligned.
+  if (!transform.IsAffine() || !transform.IsAligned()) {
+    return false;
+  }
+  return rect_.TransformBounds(transform).Contains(rect);
+}
+
+std::optional<Rect> RectGeometry::AsRect() const {
+  return rect_;
+}
+
 }  // namespace impeller
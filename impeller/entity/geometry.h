@@ -22,6 +22,12 @@ struct GeometryResult {
   PrimitiveType type;
   VertexBuffer vertex_buffer;
   bool prevent_overdraw;
+  /// When true, the geometry has already marked the interior of the shape in
+  /// the stencil buffer and the vertex buffer is a cover that must only be
+  /// drawn where the stencil is nonzero (compare kNotEqual against the
+  /// entity's stencil depth, resetting covered pixels with
+  /// kSetToReferenceValue).
+  bool stencil_cover = false;
 };
 
 enum GeometryVertexType {
@@ -73,6 +79,23 @@ class Geometry {
   virtual GeometryVertexType GetVertexType() const = 0;
 
   virtual std::optional<Rect> GetCoverage(const Matrix& transform) const = 0;
+
+  /// @brief Whether the geometry, drawn with the given transform, fills
+  ///        every pixel of `rect` with no gaps. Implementations are free
+  ///        to conservatively return false when unsure; false negatives
+  ///        only cost occlusion culling opportunities.
+  virtual bool CoversArea(const Matrix& transform, const Rect& rect) const;
+
+  /// @brief If this geometry is an axis aligned rectangle, return it. Used
+  ///        to recognize draws that can be merged into a batched rect draw.
+  virtual std::optional<Rect> AsRect() const;
+
+  /// @brief Permit or forbid the stencil-then-cover fill strategy for this
+  ///        geometry. Consumers that encode their own stencil state (clips)
+  ///        must forbid it so that the geometry never writes winding counts
+  ///        into the stencil buffer. No-op for geometries that never use the
+  ///        strategy.
+  virtual void SetAllowsStencilCover(bool allows_stencil_cover);
 };
 
 /// @brief A geometry that is created from a vertices object.
@@ -112,10 +135,18 @@ class VerticesGeometry : public Geometry {
 /// @brief A geometry that is created from a filled path object.
 class FillPathGeometry : public Geometry {
  public:
+  /// Paths with at least this many components skip tessellation in favor of
+  /// the stencil-then-cover strategy. Below it, libtess2 output (which
+  /// renders in a single pass with no overdraw) is cheaper.
+  static constexpr size_t kMinStencilCoverComponentCount = 128u;
+
   explicit FillPathGeometry(const Path& path);
 
   ~FillPathGeometry();
 
+  // |Geometry|
+  void SetAllowsStencilCover(bool allows_stencil_cover) override;
+
  private:
   // |Geometry|
   GeometryResult GetPositionBuffer(const ContentContext& renderer,
@@ -128,7 +159,15 @@ class FillPathGeometry : public Geometry {
   // |Geometry|
   std::optional<Rect> GetCoverage(const Matrix& transform) const override;
 
+  bool ShouldUseStencilCover(const Entity& entity) const;
+
+  std::optional<GeometryResult> GetStencilCoverBuffer(
+      const ContentContext& renderer,
+      const Entity& entity,
+      RenderPass& pass);
+
   Path path_;
+  bool allows_stencil_cover_ = true;
 
   FML_DISALLOW_COPY_AND_ASSIGN(FillPathGeometry);
 };
@@ -226,6 +265,9 @@ class CoverGeometry : public Geometry {
   // |Geometry|
   std::optional<Rect> GetCoverage(const Matrix& transform) const override;
 
+  // |Geometry|
+  bool CoversArea(const Matrix& transform, const Rect& rect) const override;
+
   FML_DISALLOW_COPY_AND_ASSIGN(CoverGeometry);
 };
 
@@ -247,6 +289,12 @@ class RectGeometry : public Geometry {
   // |Geometry|
   std::optional<Rect> GetCoverage(const Matrix& transform) const override;
 
+  // |Geometry|
+  bool CoversArea(const Matrix& transform, const Rect& rect) const override;
+
+  // |Geometry|
+  std::optional<Rect> AsRect() const override;
+
   Rect rect_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(RectGeometry);
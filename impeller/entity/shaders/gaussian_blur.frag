@@ -4,14 +4,13 @@
 
 // 1D (directional) gaussian blur.
 //
+// The host downsamples the input and renders this pass at a reduced
+// resolution for large radii, handing in a proportionally reduced sigma and
+// radius, so the tap count below stays small regardless of the blur size.
+//
 // Paths for future optimization:
 //   * Remove the uv bounds multiplier in SampleColor by adding optional
 //     support for SamplerAddressMode::ClampToBorder in the texture sampler.
-//   * Render both blur passes into a smaller texture than the source image
-//     (~1/radius size).
-//   * If doing the small texture render optimization, cache misses can be
-//     reduced in the first pass by sampling the source textures with a mip
-//     level of log2(min_radius).
 
 #include <impeller/constants.glsl>
 #include <impeller/gaussian.glsl>
@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+// The shadow mask for normalized rrect distances in [-1, 1], precomputed on
+// the host. See `ContentContext::GetRRectBlurProfileTexture`.
+uniform sampler2D blur_profile;
+
 uniform FragInfo {
   vec4 color;
   float blur_radius;
@@ -14,11 +18,6 @@ in vec2 v_position;
 
 out vec4 frag_color;
 
-// Simple logistic sigmoid with a domain of [-1, 1] and range of [0, 1].
-float Sigmoid(float x) {
-  return 1.03731472073 / (1 + exp(-4 * x)) - 0.0186573603638;
-}
-
 float RRectDistance(vec2 sample_position, vec2 rect_size, float corner_radius) {
   vec2 space = abs(sample_position) - rect_size + corner_radius;
   return length(max(space, 0.0)) + min(max(space.x, space.y), 0.0) -
@@ -29,6 +28,7 @@ void main() {
   vec2 center = v_position - frag_info.rect_size / 2.0;
   float dist =
       RRectDistance(center, frag_info.rect_size / 2.0, frag_info.corner_radius);
-  float shadow_mask = Sigmoid(-dist / frag_info.blur_radius);
+  float t = clamp(-dist / frag_info.blur_radius * 0.5 + 0.5, 0.0, 1.0);
+  float shadow_mask = texture(blur_profile, vec2(t, 0.5)).r;
   frag_color = frag_info.color * shadow_mask;
 }
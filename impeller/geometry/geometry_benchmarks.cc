@@ -3,7 +3,9 @@
 // found in the LICENSE file.
 
 #include "flutter/benchmarking/benchmarking.h"
+#include "flutter/benchmarking/perf_counters.h"
 
+#include "impeller/geometry/matrix.h"
 #include "impeller/geometry/path.h"
 #include "impeller/geometry/path_builder.h"
 #include "impeller/tessellator/tessellator.h"
@@ -28,6 +30,7 @@ static void BM_Polyline(benchmark::State& state, Args&&... args) {
 
   size_t point_count = 0u;
   size_t single_point_count = 0u;
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     auto polyline = path.CreatePolyline();
     single_point_count = polyline.points.size();
@@ -43,6 +46,27 @@ static void BM_Polyline(benchmark::State& state, Args&&... args) {
   state.counters["TotalPointCount"] = point_count;
 }
 
+static void BM_TransformPoints(benchmark::State& state) {
+  auto matrix = Matrix::MakeTranslation({10, 20, 0}) *
+                Matrix::MakeRotationZ(Radians{0.4f}) *
+                Matrix::MakeScale({2.0, 2.0, 1.0});
+
+  std::vector<Point> points;
+  points.reserve(4096u);
+  for (size_t i = 0; i < 4096u; i++) {
+    points.emplace_back(static_cast<Scalar>(i % 100),
+                        static_cast<Scalar>(i % 173));
+  }
+
+  benchmarking::ScopedPerfCounters perf(state);
+  while (state.KeepRunning()) {
+    matrix.TransformPoints(points.data(), points.size());
+  }
+  state.counters["PointCount"] = points.size();
+}
+
+BENCHMARK(BM_TransformPoints);
+
 BENCHMARK_CAPTURE(BM_Polyline, cubic_polyline, CreateCubic(), false);
 BENCHMARK_CAPTURE(BM_Polyline, cubic_polyline_tess, CreateCubic(), true);
 BENCHMARK_CAPTURE(BM_Polyline, quad_polyline, CreateQuadratic(), false);
@@ -300,6 +300,52 @@ TEST(GeometryTest, MatrixTransformDirection) {
   }
 }
 
+TEST(GeometryTest, MatrixTransformPoints) {
+  // Affine transforms take the batched path; use enough points to cover the
+  // vectorized body plus a scalar remainder.
+  {
+    auto matrix = Matrix::MakeTranslation({100, 200, 0}) *
+                  Matrix::MakeRotationZ(Radians{kPiOver2}) *
+                  Matrix::MakeScale({2.0, 2.0, 2.0});
+
+    std::vector<Point> points;
+    for (size_t i = 0; i < 7; i++) {
+      points.emplace_back(static_cast<Scalar>(i) * 3 + 1,
+                          static_cast<Scalar>(i) * 5 - 2);
+    }
+    auto expected = points;
+    for (auto& point : expected) {
+      point = matrix * point;
+    }
+
+    matrix.TransformPoints(points.data(), points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+      ASSERT_POINT_NEAR(points[i], expected[i]);
+    }
+  }
+
+  // Perspective transforms fall back to the per-point path.
+  {
+    // clang-format off
+    auto matrix = Matrix(1,  0,  0, 0.001,
+                         0,  1,  0, 0.002,
+                         0,  0,  1, 0,
+                         10, 20, 0, 1);
+    // clang-format on
+
+    std::vector<Point> points = {Point(1, 2), Point(-3, 4), Point(5, -6)};
+    auto expected = points;
+    for (auto& point : expected) {
+      point = matrix * point;
+    }
+
+    matrix.TransformPoints(points.data(), points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+      ASSERT_POINT_NEAR(points[i], expected[i]);
+    }
+  }
+}
+
 TEST(GeometryTest, MatrixGetMaxBasisLength) {
   {
     auto m = Matrix::MakeScale({3, 1, 1});
@@ -490,6 +536,31 @@ TEST(GeometryTest, EmptyPath) {
   ASSERT_TRUE(polyline.contours.empty());
 }
 
+TEST(GeometryTest, PathPolylineBufferReuseAndCaching) {
+  auto path = PathBuilder{}
+                  .MoveTo({10, 10})
+                  .QuadraticCurveTo({100, 100}, {200, 10})
+                  .TakePath();
+
+  auto expected = path.CreatePolyline();
+  ASSERT_FALSE(expected.points.empty());
+
+  // The caller-owned buffer overload produces the same flattening and reuses
+  // the buffer's storage.
+  Path::Polyline polyline;
+  path.CreatePolyline(kDefaultCurveTolerance, polyline);
+  ASSERT_EQ(polyline.points, expected.points);
+  auto capacity = polyline.points.capacity();
+  path.CreatePolyline(kDefaultCurveTolerance, polyline);
+  ASSERT_EQ(polyline.points, expected.points);
+  ASSERT_EQ(polyline.points.capacity(), capacity);
+
+  // Mutating the path invalidates cached flattenings.
+  path.AddLinearComponent({200, 10}, {300, 10});
+  auto mutated = path.CreatePolyline();
+  ASSERT_GT(mutated.points.size(), expected.points.size());
+}
+
 TEST(GeometryTest, SimplePath) {
   Path path;
 
@@ -1600,6 +1671,21 @@ TEST(GeometryTest, PathPolylineDuplicatesAreRemovedForSameContour) {
   ASSERT_EQ(polyline.points[6], Point(0, 100));
 }
 
+TEST(GeometryTest, PathConvexityDeclaration) {
+  // Paths are not convex unless the builder declares them so.
+  Path default_path = PathBuilder{}.AddRect(Rect(0, 0, 100, 100)).TakePath();
+  ASSERT_FALSE(default_path.IsConvex());
+
+  Path convex_path = PathBuilder{}
+                         .SetConvexity(Path::Convexity::kConvex)
+                         .AddRect(Rect(0, 0, 100, 100))
+                         .TakePath();
+  ASSERT_TRUE(convex_path.IsConvex());
+
+  convex_path.SetConvexity(Path::Convexity::kUnknown);
+  ASSERT_FALSE(convex_path.IsConvex());
+}
+
 TEST(GeometryTest, VerticesConstructorAndGetters) {
   std::vector<Point> points = {Point(1, 2), Point(2, 3), Point(3, 4)};
   std::vector<uint16_t> indices = {0, 1, 2};
@@ -7,6 +7,14 @@
 #include <climits>
 #include <sstream>
 
+#include "flutter/fml/build_config.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(FML_ARCH_CPU_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+
 namespace impeller {
 
 Matrix::Matrix(const MatrixDecomposition& d) : Matrix() {
@@ -94,6 +102,57 @@ Matrix Matrix::operator+(const Matrix& o) const {
   );
 }
 
+static_assert(sizeof(Point) == 2 * sizeof(Scalar),
+              "The batch transform loads points as packed coordinate pairs.");
+
+void Matrix::TransformPoints(Point* points, size_t count) const {
+  // The perspective terms force a per-point divide, so only affine
+  // transforms take the batched path.
+  const bool is_affine = m[3] == 0 && m[7] == 0 && m[15] == 1;
+  size_t i = 0u;
+
+  if (is_affine) {
+#if defined(__ARM_NEON)
+    // Deinterleaved loads process four points per iteration.
+    for (; i + 4 <= count; i += 4) {
+      float32x4x2_t xy = vld2q_f32(reinterpret_cast<const float*>(points + i));
+      float32x4_t x_out =
+          vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[12]), xy.val[0], m[0]),
+                      xy.val[1], m[4]);
+      float32x4_t y_out =
+          vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[13]), xy.val[0], m[1]),
+                      xy.val[1], m[5]);
+      float32x4x2_t out = {{x_out, y_out}};
+      vst2q_f32(reinterpret_cast<float*>(points + i), out);
+    }
+#elif defined(FML_ARCH_CPU_X86_FAMILY)
+    // Two interleaved points per 128 bit register.
+    __m128 x_coefficients = _mm_set_ps(m[1], m[0], m[1], m[0]);
+    __m128 y_coefficients = _mm_set_ps(m[5], m[4], m[5], m[4]);
+    __m128 translation = _mm_set_ps(m[13], m[12], m[13], m[12]);
+    for (; i + 2 <= count; i += 2) {
+      __m128 xy = _mm_loadu_ps(reinterpret_cast<const float*>(points + i));
+      __m128 xs = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(2, 2, 0, 0));
+      __m128 ys = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(3, 3, 1, 1));
+      __m128 out = _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(xs, x_coefficients),
+                     _mm_mul_ps(ys, y_coefficients)),
+          translation);
+      _mm_storeu_ps(reinterpret_cast<float*>(points + i), out);
+    }
+#endif
+    for (; i < count; i++) {
+      points[i] = Point(points[i].x * m[0] + points[i].y * m[4] + m[12],
+                        points[i].x * m[1] + points[i].y * m[5] + m[13]);
+    }
+    return;
+  }
+
+  for (; i < count; i++) {
+    points[i] = *this * points[i];
+  }
+}
+
 Matrix Matrix::Invert() const {
   Matrix tmp{
       m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] +
@@ -400,6 +400,14 @@ struct Matrix {
     return Vector2(v.x * m[0] + v.y * m[4], v.x * m[1] + v.y * m[5]);
   }
 
+  //----------------------------------------------------------------------------
+  /// @brief      Transform a contiguous run of points by this matrix in
+  ///             place. Equivalent to applying `operator*(const Point&)` to
+  ///             every point, but batched: affine transforms take a
+  ///             vectorized fast path on platforms with SIMD support.
+  ///
+  void TransformPoints(Point* points, size_t count) const;
+
   template <class T>
   static constexpr Matrix MakeOrthographic(TSize<T> size) {
     // Per assumptions about NDC documented above.
@@ -4,18 +4,37 @@
 
 #include "impeller/geometry/path.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
 #include <optional>
 
 #include "impeller/geometry/path_component.h"
 
 namespace impeller {
 
+static uint64_t NextPathGenerationID() {
+  static std::atomic<uint64_t> sLastGenerationID;
+  return ++sLastGenerationID;
+}
+
 Path::Path() {
   AddContourComponent({});
 };
 
 Path::~Path() = default;
 
+uint64_t Path::GetGenerationID() const {
+  return generation_id_;
+}
+
+void Path::UpdateGenerationID() {
+  generation_id_ = NextPathGenerationID();
+  // Detach from any cache shared with unmutated copies; they keep theirs.
+  polyline_cache_.reset();
+}
+
 std::tuple<size_t, size_t> Path::Polyline::GetContourPointBounds(
     size_t contour_index) const {
   if (contour_index >= contours.size()) {
@@ -34,27 +53,39 @@ size_t Path::GetComponentCount() const {
 
 void Path::SetFillType(FillType fill) {
   fill_ = fill;
+  UpdateGenerationID();
 }
 
 FillType Path::GetFillType() const {
   return fill_;
 }
 
+void Path::SetConvexity(Convexity value) {
+  convexity_ = value;
+}
+
+bool Path::IsConvex() const {
+  return convexity_ == Convexity::kConvex;
+}
+
 Path& Path::AddLinearComponent(Point p1, Point p2) {
   linears_.emplace_back(p1, p2);
   components_.emplace_back(ComponentType::kLinear, linears_.size() - 1);
+  UpdateGenerationID();
   return *this;
 }
 
 Path& Path::AddQuadraticComponent(Point p1, Point cp, Point p2) {
   quads_.emplace_back(p1, cp, p2);
   components_.emplace_back(ComponentType::kQuadratic, quads_.size() - 1);
+  UpdateGenerationID();
   return *this;
 }
 
 Path& Path::AddCubicComponent(Point p1, Point cp1, Point cp2, Point p2) {
   cubics_.emplace_back(p1, cp1, cp2, p2);
   components_.emplace_back(ComponentType::kCubic, cubics_.size() - 1);
+  UpdateGenerationID();
   return *this;
 }
 
@@ -67,11 +98,13 @@ Path& Path::AddContourComponent(Point destination, bool is_closed) {
     contours_.emplace_back(ContourComponent(destination, is_closed));
     components_.emplace_back(ComponentType::kContour, contours_.size() - 1);
   }
+  UpdateGenerationID();
   return *this;
 }
 
 void Path::SetContourClosed(bool is_closed) {
   contours_.back().is_closed = is_closed;
+  UpdateGenerationID();
 }
 
 void Path::EnumerateComponents(
@@ -175,6 +208,7 @@ bool Path::UpdateLinearComponentAtIndex(size_t index,
   }
 
   linears_[components_[index].index] = linear;
+  UpdateGenerationID();
   return true;
 }
 
@@ -190,6 +224,7 @@ bool Path::UpdateQuadraticComponentAtIndex(
   }
 
   quads_[components_[index].index] = quadratic;
+  UpdateGenerationID();
   return true;
 }
 
@@ -204,6 +239,7 @@ bool Path::UpdateCubicComponentAtIndex(size_t index,
   }
 
   cubics_[components_[index].index] = cubic;
+  UpdateGenerationID();
   return true;
 }
 
@@ -218,12 +254,64 @@ bool Path::UpdateContourComponentAtIndex(size_t index,
   }
 
   contours_[components_[index].index] = move;
+  UpdateGenerationID();
   return true;
 }
 
+// Tolerances within the same power-of-two bucket share cached flattening
+// results.
+static int32_t PolylineToleranceBucket(Scalar tolerance) {
+  if (tolerance <= 0.0f) {
+    return std::numeric_limits<int32_t>::min();
+  }
+  return std::ilogbf(tolerance);
+}
+
 Path::Polyline Path::CreatePolyline(Scalar tolerance) const {
   Polyline polyline;
+  CreatePolyline(tolerance, polyline);
+  return polyline;
+}
+
+void Path::CreatePolyline(Scalar tolerance, Polyline& polyline) const {
+  polyline.points.clear();
+  polyline.contours.clear();
+
+  auto bucket = PolylineToleranceBucket(tolerance);
+  if (polyline_cache_) {
+    for (const auto& entry : *polyline_cache_) {
+      if (entry.generation_id == generation_id_ &&
+          entry.tolerance_bucket == bucket) {
+        // Vector copy assignment reuses the caller's existing capacity.
+        polyline.points = entry.polyline->points;
+        polyline.contours = entry.polyline->contours;
+        return;
+      }
+    }
+  }
 
+  FlattenIntoPolyline(tolerance, polyline);
+
+  if (!polyline_cache_) {
+    polyline_cache_ = std::make_shared<std::vector<PolylineCacheEntry>>();
+  }
+  // Entries for older generations of this path can no longer be hit.
+  auto& cache = *polyline_cache_;
+  cache.erase(std::remove_if(cache.begin(), cache.end(),
+                             [this](const PolylineCacheEntry& entry) {
+                               return entry.generation_id != generation_id_;
+                             }),
+              cache.end());
+  if (cache.size() >= kMaxPolylineCacheEntries) {
+    cache.erase(cache.begin());
+  }
+  cache.push_back(PolylineCacheEntry{
+      .generation_id = generation_id_,
+      .tolerance_bucket = bucket,
+      .polyline = std::make_shared<const Polyline>(polyline)});
+}
+
+void Path::FlattenIntoPolyline(Scalar tolerance, Polyline& polyline) const {
   std::optional<Point> previous_contour_point;
   auto collect_points = [&polyline, &previous_contour_point](
                             const std::vector<Point>& collection) {
@@ -269,7 +357,6 @@ Path::Polyline Path::CreatePolyline(Scalar tolerance) const {
         break;
     }
   }
-  return polyline;
 }
 
 std::optional<Rect> Path::GetBoundingBox() const {
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <set>
 #include <tuple>
@@ -43,6 +45,11 @@ class Path {
     kContour,
   };
 
+  enum class Convexity {
+    kUnknown,
+    kConvex,
+  };
+
   struct PolylineContour {
     /// Index that denotes the first point of this contour.
     size_t start_index;
@@ -73,10 +80,24 @@ class Path {
 
   size_t GetComponentCount() const;
 
+  /// @brief Get an id that uniquely identifies the current contents of this
+  ///        path. The id changes whenever the path is mutated, so it can be
+  ///        used to key caches of data derived from the path, such as
+  ///        tessellation results. Copies share the id until either copy is
+  ///        mutated.
+  uint64_t GetGenerationID() const;
+
   void SetFillType(FillType fill);
 
   FillType GetFillType() const;
 
+  /// @brief Mark whether this path is known to be convex. Paths are not
+  ///        analyzed for convexity; builders of known-convex shapes declare
+  ///        it so renderers can pick cheaper triangulation strategies.
+  void SetConvexity(Convexity value);
+
+  bool IsConvex() const;
+
   Path& AddLinearComponent(Point p1, Point p2);
 
   Path& AddQuadraticComponent(Point p1, Point cp, Point p2);
@@ -119,6 +140,11 @@ class Path {
 
   Polyline CreatePolyline(Scalar tolerance = kDefaultCurveTolerance) const;
 
+  /// @brief Flatten the path into the caller-owned |polyline|, which is
+  ///        cleared first. Reusing one polyline across calls avoids
+  ///        reallocating point storage for paths flattened every frame.
+  void CreatePolyline(Scalar tolerance, Polyline& polyline) const;
+
   std::optional<Rect> GetBoundingBox() const;
 
   std::optional<Rect> GetTransformedBoundingBox(const Matrix& transform) const;
@@ -136,7 +162,25 @@ class Path {
         : type(a_type), index(a_index) {}
   };
 
+  void UpdateGenerationID();
+
+  void FlattenIntoPolyline(Scalar tolerance, Polyline& polyline) const;
+
+  // Flattening results are cached per generation and tolerance bucket so
+  // unmodified paths are not re-subdivided on every frame. Copies share the
+  // cache through the shared pointer; entries from older generations are
+  // evicted lazily. Access is not synchronized, matching the rest of Path.
+  struct PolylineCacheEntry {
+    uint64_t generation_id = 0u;
+    int32_t tolerance_bucket = 0;
+    std::shared_ptr<const Polyline> polyline;
+  };
+  static constexpr size_t kMaxPolylineCacheEntries = 4u;
+  mutable std::shared_ptr<std::vector<PolylineCacheEntry>> polyline_cache_;
+
+  uint64_t generation_id_ = 0u;
   FillType fill_ = FillType::kNonZero;
+  Convexity convexity_ = Convexity::kUnknown;
   std::vector<ComponentIndexPair> components_;
   std::vector<LinearPathComponent> linears_;
   std::vector<QuadraticPathComponent> quads_;
@@ -24,6 +24,11 @@ Path PathBuilder::TakePath(FillType fill) {
   return path;
 }
 
+PathBuilder& PathBuilder::SetConvexity(Path::Convexity value) {
+  prototype_.SetConvexity(value);
+  return *this;
+}
+
 PathBuilder& PathBuilder::MoveTo(Point point, bool relative) {
   current_ = relative ? current_ + point : point;
   subpath_start_ = current_;
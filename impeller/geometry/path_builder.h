@@ -31,6 +31,11 @@ class PathBuilder {
 
   const Path& GetCurrentPath() const;
 
+  /// @brief Declare whether the path under construction is convex. Convexity
+  ///        is not verified, so only mark shapes that are convex by
+  ///        construction.
+  PathBuilder& SetConvexity(Path::Convexity value);
+
   PathBuilder& MoveTo(Point point, bool relative = false);
 
   PathBuilder& Close();
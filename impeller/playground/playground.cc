@@ -3,6 +3,8 @@
 // found in the LICENSE file.
 
 #include <array>
+#include <cstdlib>
+#include <fstream>
 #include <memory>
 #include <optional>
 #include <sstream>
@@ -15,6 +17,7 @@
 #include "third_party/glfw/include/GLFW/glfw3.h"
 
 #include "flutter/fml/paths.h"
+#include "flutter/fml/time/time_point.h"
 #include "impeller/base/validation.h"
 #include "impeller/image/compressed_image.h"
 #include "impeller/playground/imgui/imgui_impl_impeller.h"
@@ -23,8 +26,11 @@
 #include "impeller/renderer/allocator.h"
 #include "impeller/renderer/context.h"
 #include "impeller/renderer/formats.h"
+#include "impeller/renderer/gpu_tracer.h"
 #include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/render_target.h"
 #include "impeller/renderer/renderer.h"
+#include "impeller/renderer/texture_decoder.h"
 #include "third_party/imgui/backends/imgui_impl_glfw.h"
 #include "third_party/imgui/imgui.h"
 
@@ -133,6 +139,99 @@ bool Playground::ShouldOpenNewPlaygrounds() {
   return gShouldOpenNewPlaygrounds;
 }
 
+bool Playground::IsBenchmarkModeEnabled() {
+  return std::getenv("IMPELLER_PLAYGROUND_BENCHMARK") != nullptr;
+}
+
+static size_t BenchmarkFrameCount() {
+  constexpr size_t kDefaultBenchmarkFrameCount = 60u;
+  const char* value = std::getenv("IMPELLER_PLAYGROUND_BENCHMARK");
+  if (value == nullptr) {
+    return kDefaultBenchmarkFrameCount;
+  }
+  const auto frames = ::strtoul(value, nullptr, 10);
+  return frames > 0 ? frames : kDefaultBenchmarkFrameCount;
+}
+
+static void EmitBenchmarkRecord(const std::string& record) {
+  const char* path = std::getenv("IMPELLER_PLAYGROUND_BENCHMARK_OUT");
+  if (path != nullptr) {
+    std::ofstream file(path, std::ios::app);
+    if (file.is_open()) {
+      file << record << std::endl;
+      return;
+    }
+    FML_LOG(ERROR) << "Could not open benchmark output file: " << path;
+  }
+  FML_LOG(IMPORTANT) << record;
+}
+
+std::string Playground::GetBenchmarkLabel() const {
+  return GetWindowTitle();
+}
+
+bool Playground::RunHeadlessBenchmark(
+    const Renderer::RenderCallback& render_callback) {
+  if (!renderer_ || !renderer_->IsValid()) {
+    return false;
+  }
+
+  const auto context = renderer_->GetContext();
+  const auto frame_count = BenchmarkFrameCount();
+
+  auto tracer = context->GetGPUTracer();
+  if (tracer) {
+    tracer->ResetStats();
+  }
+  const auto allocator = context->GetResourceAllocator();
+  const size_t transient_bytes_baseline =
+      allocator ? allocator->GetTransientBytesAllocated() : 0u;
+
+  // One single-sample offscreen target with color and stencil attachments is
+  // reused for every frame, standing in for the window surface. Each frame
+  // gets its own copy since callbacks may reconfigure attachments.
+  const auto render_target = RenderTarget::CreateOffscreen(
+      *context, GetWindowSize(), "PlaygroundBenchmark");
+  if (!render_target.IsValid()) {
+    VALIDATION_LOG << "Could not create offscreen benchmark render target.";
+    return false;
+  }
+
+  int64_t cpu_encode_nanos = 0;
+  for (size_t frame = 0u; frame < frame_count; frame++) {
+    RenderTarget target = render_target;
+    const auto frame_start = fml::TimePoint::Now();
+    if (!render_callback(target)) {
+      VALIDATION_LOG << "Benchmark render callback failed at frame " << frame
+                     << ".";
+      return false;
+    }
+    cpu_encode_nanos += (fml::TimePoint::Now() - frame_start).ToNanoseconds();
+  }
+
+  // GPU pass timings land asynchronously and are polled as later passes are
+  // encoded, so the last frame or two may not be reflected in the stats.
+  // With dozens of frames per fixture the averages are still stable enough
+  // for trend tracking.
+  const auto stats = tracer ? tracer->GetStats() : GPUTracerStats{};
+  const size_t transient_bytes_allocated =
+      (allocator ? allocator->GetTransientBytesAllocated() : 0u) -
+      transient_bytes_baseline;
+
+  std::stringstream record;
+  record << "{\"label\":\"" << GetBenchmarkLabel() << "\""
+         << ",\"frames\":" << frame_count  //
+         << ",\"avg_cpu_encode_ms\":"
+         << static_cast<double>(cpu_encode_nanos) / frame_count / 1e6
+         << ",\"avg_gpu_pass_ms_per_frame\":"
+         << static_cast<double>(stats.total_pass_nanos) / frame_count / 1e6
+         << ",\"traced_pass_count\":" << stats.traced_pass_count
+         << ",\"transient_bytes_allocated\":" << transient_bytes_allocated
+         << "}";
+  EmitBenchmarkRecord(record.str());
+  return true;
+}
+
 static void PlaygroundKeyCallback(GLFWwindow* window,
                                   int key,
                                   int scancode,
@@ -164,11 +263,18 @@ void Playground::SetCursorPosition(Point pos) {
 
 bool Playground::OpenPlaygroundHere(
     const Renderer::RenderCallback& render_callback) {
-  if (!is_enabled()) {
+  if (!render_callback) {
     return true;
   }
 
-  if (!render_callback) {
+  // Benchmark mode renders offscreen and never opens a window, so it also
+  // works in configurations where the interactive playground is compiled
+  // out.
+  if (IsBenchmarkModeEnabled()) {
+    return RunHeadlessBenchmark(render_callback);
+  }
+
+  if (!is_enabled()) {
     return true;
   }
 
@@ -371,33 +477,23 @@ std::optional<DecompressedImage> Playground::LoadFixtureImageRGBA(
 std::shared_ptr<Texture> Playground::CreateTextureForFixture(
     const char* fixture_name,
     bool enable_mipmapping) const {
-  auto image = LoadFixtureImageRGBA(fixture_name);
-  if (!image.has_value()) {
-    return nullptr;
-  }
-
-  auto texture_descriptor = TextureDescriptor{};
-  texture_descriptor.storage_mode = StorageMode::kHostVisible;
-  texture_descriptor.format = PixelFormat::kR8G8B8A8UNormInt;
-  texture_descriptor.size = image->GetSize();
-  texture_descriptor.mip_count =
-      enable_mipmapping ? image->GetSize().MipCount() : 1u;
-
-  auto texture = renderer_->GetContext()->GetResourceAllocator()->CreateTexture(
-      texture_descriptor);
-  if (!texture) {
-    VALIDATION_LOG << "Could not allocate texture for fixture " << fixture_name;
-    return nullptr;
-  }
-  texture->SetLabel(fixture_name);
+  return CreateTextureForFixtureAsync(fixture_name, enable_mipmapping).get();
+}
 
-  auto uploaded = texture->SetContents(image->GetAllocation());
-  if (!uploaded) {
-    VALIDATION_LOG << "Could not upload texture to device memory for fixture "
-                   << fixture_name;
-    return nullptr;
+std::shared_future<std::shared_ptr<Texture>>
+Playground::CreateTextureForFixtureAsync(const char* fixture_name,
+                                         bool enable_mipmapping) const {
+  std::shared_ptr<Context> context;
+  std::shared_ptr<fml::Mapping> mapping;
+  if (renderer_ && fixture_name != nullptr) {
+    context = renderer_->GetContext();
+    mapping = OpenAssetAsMapping(fixture_name);
   }
-  return texture;
+  // The decoder tolerates null arguments and resolves the future with a null
+  // texture, which is exactly what the sync variant used to return on a
+  // missing fixture.
+  return DecodeTextureAsync(std::move(context), std::move(mapping),
+                            enable_mipmapping, fixture_name ? fixture_name : "");
 }
 
 std::shared_ptr<Texture> Playground::CreateTextureCubeForFixture(
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 
 #include "flutter/fml/closure.h"
@@ -38,6 +39,18 @@ class Playground {
 
   static bool ShouldOpenNewPlaygrounds();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Whether headless benchmark mode was requested by setting the
+  ///             IMPELLER_PLAYGROUND_BENCHMARK environment variable. In this
+  ///             mode OpenPlaygroundHere renders the fixture offscreen for a
+  ///             fixed number of frames (the variable's value, or 60) instead
+  ///             of opening a window, and appends a JSON record with CPU
+  ///             encode time, GPU pass timings and transient allocation bytes
+  ///             to the file named by IMPELLER_PLAYGROUND_BENCHMARK_OUT (or
+  ///             the log when unset) for trend tracking.
+  ///
+  static bool IsBenchmarkModeEnabled();
+
   void SetupWindow(PlaygroundBackend backend);
 
   void TeardownWindow();
@@ -61,6 +74,10 @@ class Playground {
       const char* fixture_name,
       bool enable_mipmapping = false) const;
 
+  std::shared_future<std::shared_ptr<Texture>> CreateTextureForFixtureAsync(
+      const char* fixture_name,
+      bool enable_mipmapping = false) const;
+
   std::shared_ptr<Texture> CreateTextureCubeForFixture(
       std::array<const char*, 6> fixture_names) const;
 
@@ -71,6 +88,13 @@ class Playground {
 
   virtual std::string GetWindowTitle() const = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The label used for this fixture's record in benchmark mode.
+  ///             Defaults to the window title; tests override this with the
+  ///             current test name.
+  ///
+  virtual std::string GetBenchmarkLabel() const;
+
  private:
 #if IMPELLER_ENABLE_PLAYGROUND
   static const bool is_enabled_ = true;
@@ -89,6 +113,8 @@ class Playground {
 
   void SetWindowSize(ISize size);
 
+  bool RunHeadlessBenchmark(const Renderer::RenderCallback& render_callback);
+
   FML_DISALLOW_COPY_AND_ASSIGN(Playground);
 };
 
@@ -63,6 +63,13 @@ std::string PlaygroundTest::GetWindowTitle() const {
   return FormatWindowTitle(flutter::testing::GetCurrentTestName());
 }
 
+// |Playground|
+std::string PlaygroundTest::GetBenchmarkLabel() const {
+  // The full gtest name already carries the backend as the instantiation
+  // suffix, so records from different backends trend separately.
+  return flutter::testing::GetCurrentTestName();
+}
+
 Scalar PlaygroundTest::GetSecondsElapsed() const {
   return (fml::TimePoint::Now().ToEpochDelta() - start_time_).ToSecondsF();
 }
@@ -35,6 +35,9 @@ class PlaygroundTest : public Playground,
   // |Playground|
   std::string GetWindowTitle() const override;
 
+  // |Playground|
+  std::string GetBenchmarkLabel() const override;
+
   /// @brief Get the amount of time elapsed from the start of the playground
   ///        test's execution.
   Scalar GetSecondsElapsed() const;
@@ -7,9 +7,20 @@
 #include "impeller/base/validation.h"
 #include "impeller/renderer/device_buffer.h"
 #include "impeller/renderer/range.h"
+#include "impeller/renderer/texture.h"
 
 namespace impeller {
 
+// The maximum number of bytes worth of textures retained by the transient
+// texture pool. Keeps a handful of full screen attachments around without
+// letting a scene with many differently sized save layers hoard memory.
+static constexpr size_t kTransientTexturePoolByteBudget = 64u * 1024u * 1024u;
+
+static size_t TransientTextureByteSize(const TextureDescriptor& desc) {
+  return desc.GetByteSizeOfBaseMipLevel() *
+         static_cast<size_t>(desc.sample_count);
+}
+
 Allocator::Allocator() = default;
 
 Allocator::~Allocator() = default;
@@ -62,4 +73,63 @@ uint16_t Allocator::MinimumBytesPerRow(PixelFormat format) const {
   return BytesPerPixelForPixelFormat(format);
 }
 
+std::shared_ptr<Texture> Allocator::CreateTransientTexture(
+    const TextureDescriptor& desc) {
+  std::shared_ptr<Texture> texture;
+  {
+    Lock lock(transient_pool_mutex_);
+    auto found = transient_pool_.find(desc);
+    if (found != transient_pool_.end() && !found->second.empty()) {
+      texture = std::move(found->second.back());
+      found->second.pop_back();
+      transient_pool_bytes_ -= TransientTextureByteSize(desc);
+    }
+  }
+
+  if (!texture) {
+    texture = CreateTexture(desc);
+    if (texture) {
+      Lock lock(transient_pool_mutex_);
+      transient_bytes_allocated_ += TransientTextureByteSize(desc);
+    }
+  }
+  if (!texture) {
+    return nullptr;
+  }
+
+  // Return the texture to the pool when the last reference to it is dropped.
+  // Command buffers are serialized on a single queue, so any new contents
+  // rendered into a recycled texture are written strictly after the passes
+  // that read its previous contents. The allocator is held weakly so an
+  // outstanding transient texture doesn't keep it alive.
+  std::weak_ptr<Allocator> weak_allocator = weak_from_this();
+  return std::shared_ptr<Texture>(
+      texture.get(), [weak_allocator, texture](Texture*) mutable {
+        if (auto allocator = weak_allocator.lock()) {
+          allocator->RecycleTransientTexture(std::move(texture));
+        } else {
+          texture.reset();
+        }
+      });
+}
+
+void Allocator::RecycleTransientTexture(std::shared_ptr<Texture> texture) {
+  if (!texture) {
+    return;
+  }
+  const auto& desc = texture->GetTextureDescriptor();
+  const auto byte_size = TransientTextureByteSize(desc);
+  Lock lock(transient_pool_mutex_);
+  if (transient_pool_bytes_ + byte_size > kTransientTexturePoolByteBudget) {
+    return;
+  }
+  transient_pool_bytes_ += byte_size;
+  transient_pool_[desc].emplace_back(std::move(texture));
+}
+
+size_t Allocator::GetTransientBytesAllocated() const {
+  Lock lock(transient_pool_mutex_);
+  return transient_bytes_allocated_;
+}
+
 }  // namespace impeller
@@ -5,9 +5,13 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/mapping.h"
+#include "impeller/base/thread.h"
 #include "impeller/renderer/device_buffer_descriptor.h"
 #include "impeller/renderer/texture_descriptor.h"
 
@@ -20,7 +24,7 @@ class Texture;
 //------------------------------------------------------------------------------
 /// @brief      An object that allocates device memory.
 ///
-class Allocator {
+class Allocator : public std::enable_shared_from_this<Allocator> {
  public:
   virtual ~Allocator();
 
@@ -31,6 +35,32 @@ class Allocator {
 
   std::shared_ptr<Texture> CreateTexture(const TextureDescriptor& desc);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Create a texture for transient use, such as a render target
+  ///             attachment that only lives for a single frame. A pooled
+  ///             texture with a matching descriptor is recycled when one is
+  ///             available, so steady-state frames allocate no new render
+  ///             target textures. The texture returns to the pool when the
+  ///             last reference to it is dropped.
+  ///
+  std::shared_ptr<Texture> CreateTransientTexture(
+      const TextureDescriptor& desc);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Return a transient texture to the pool for later reuse. The
+  ///             texture is dropped instead if pooling it would exceed the
+  ///             pool byte budget.
+  ///
+  void RecycleTransientTexture(std::shared_ptr<Texture> texture);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Total bytes of transient textures newly allocated over the
+  ///             allocator's lifetime, i.e. pool misses. Steady-state frames
+  ///             should not grow this number; benchmarks watch its delta as a
+  ///             proxy for per-frame transient allocation churn.
+  ///
+  size_t GetTransientBytesAllocated() const;
+
   //------------------------------------------------------------------------------
   /// @brief      Minimum value for `row_bytes` on a Texture. The row
   ///             bytes parameter of that method must be aligned to this value.
@@ -55,6 +85,29 @@ class Allocator {
       const TextureDescriptor& desc) = 0;
 
  private:
+  struct TextureDescriptorHash {
+    std::size_t operator()(const TextureDescriptor& desc) const {
+      return fml::HashCombine(desc.storage_mode,       //
+                              desc.type,               //
+                              desc.format,             //
+                              desc.size.width,         //
+                              desc.size.height,        //
+                              desc.mip_count,          //
+                              desc.usage,              //
+                              desc.sample_count        //
+      );
+    }
+  };
+
+  mutable Mutex transient_pool_mutex_;
+  std::unordered_map<TextureDescriptor,
+                     std::vector<std::shared_ptr<Texture>>,
+                     TextureDescriptorHash>
+      transient_pool_ IPLR_GUARDED_BY(transient_pool_mutex_);
+  size_t transient_pool_bytes_ IPLR_GUARDED_BY(transient_pool_mutex_) = 0u;
+  size_t transient_bytes_allocated_ IPLR_GUARDED_BY(transient_pool_mutex_) =
+      0u;
+
   FML_DISALLOW_COPY_AND_ASSIGN(Allocator);
 };
 
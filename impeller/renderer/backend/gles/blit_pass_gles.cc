@@ -20,8 +20,10 @@
 
 namespace impeller {
 
-BlitPassGLES::BlitPassGLES(ReactorGLES::Ref reactor)
+BlitPassGLES::BlitPassGLES(ReactorGLES::Ref reactor,
+                           std::shared_ptr<GPUTracerGLES> tracer)
     : reactor_(std::move(reactor)),
+      tracer_(std::move(tracer)),
       is_valid_(reactor_ && reactor_->IsValid()) {}
 
 // |BlitPass|
@@ -41,7 +43,8 @@ void BlitPassGLES::OnSetLabel(std::string label) {
     const std::shared_ptr<Allocator>& transients_allocator,
     const ReactorGLES& reactor,
     const std::vector<std::unique_ptr<BlitEncodeGLES>>& commands,
-    const std::string& label) {
+    const std::string& label,
+    const std::shared_ptr<GPUTracerGLES>& tracer) {
   TRACE_EVENT0("impeller", __FUNCTION__);
 
   if (commands.empty()) {
@@ -50,6 +53,15 @@ void BlitPassGLES::OnSetLabel(std::string label) {
 
   const auto& gl = reactor.GetProcTable();
 
+  fml::ScopedCleanupClosure end_pass_timing([&gl, &tracer]() {
+    if (tracer) {
+      tracer->MarkPassEnd(gl);
+    }
+  });
+  if (tracer) {
+    tracer->MarkPassBegin(gl, label);
+  }
+
   fml::ScopedCleanupClosure pop_pass_debug_marker(
       [&gl]() { gl.PopDebugGroup(); });
   if (!label.empty()) {
@@ -87,9 +99,10 @@ bool BlitPassGLES::EncodeCommands(
   }
 
   return reactor_->AddOperation([transients_allocator, &commands = commands_,
-                                 label = label_](const auto& reactor) {
-    auto result =
-        EncodeCommandsInReactor(transients_allocator, reactor, commands, label);
+                                 label = label_,
+                                 tracer = tracer_](const auto& reactor) {
+    auto result = EncodeCommandsInReactor(transients_allocator, reactor,
+                                          commands, label, tracer);
     FML_CHECK(result) << "Must be able to encode GL commands without error.";
   });
 }
@@ -8,6 +8,7 @@
 #include "flutter/impeller/renderer/backend/gles/reactor_gles.h"
 #include "flutter/impeller/renderer/blit_pass.h"
 #include "impeller/renderer/backend/gles/blit_command_gles.h"
+#include "impeller/renderer/backend/gles/gpu_tracer_gles.h"
 
 namespace impeller {
 
@@ -21,10 +22,11 @@ class BlitPassGLES final : public BlitPass {
 
   std::vector<std::unique_ptr<BlitEncodeGLES>> commands_;
   ReactorGLES::Ref reactor_;
+  std::shared_ptr<GPUTracerGLES> tracer_;
   std::string label_;
   bool is_valid_ = false;
 
-  explicit BlitPassGLES(ReactorGLES::Ref reactor);
+  BlitPassGLES(ReactorGLES::Ref reactor, std::shared_ptr<GPUTracerGLES> tracer);
 
   // |BlitPass|
   bool IsValid() const override;
@@ -6,6 +6,7 @@
 
 #include "impeller/base/config.h"
 #include "impeller/renderer/backend/gles/blit_pass_gles.h"
+#include "impeller/renderer/backend/gles/context_gles.h"
 #include "impeller/renderer/backend/gles/render_pass_gles.h"
 
 namespace impeller {
@@ -57,7 +58,10 @@ std::shared_ptr<BlitPass> CommandBufferGLES::OnCreateBlitPass() const {
   if (!IsValid()) {
     return nullptr;
   }
-  auto pass = std::shared_ptr<BlitPassGLES>(new BlitPassGLES(reactor_));
+  auto context = context_.lock();
+  auto pass = std::shared_ptr<BlitPassGLES>(new BlitPassGLES(
+      reactor_,
+      context ? ContextGLES::Cast(*context).GetGPUTracerGLES() : nullptr));
   if (!pass->IsValid()) {
     return nullptr;
   }
@@ -26,6 +26,11 @@ ContextGLES::ContextGLES(std::unique_ptr<ProcTableGLES> gl,
     return;
   }
 
+  // Create the GPU tracer used to bracket passes with timer queries.
+  {
+    gpu_tracer_ = std::make_shared<GPUTracerGLES>();
+  }
+
   // Create the shader library.
   {
     auto library = std::shared_ptr<ShaderLibraryGLES>(
@@ -77,6 +82,14 @@ const ReactorGLES::Ref& ContextGLES::GetReactor() const {
   return reactor_;
 }
 
+std::shared_ptr<GPUTracer> ContextGLES::GetGPUTracer() const {
+  return gpu_tracer_;
+}
+
+const std::shared_ptr<GPUTracerGLES>& ContextGLES::GetGPUTracerGLES() const {
+  return gpu_tracer_;
+}
+
 std::optional<ReactorGLES::WorkerID> ContextGLES::AddReactorWorker(
     const std::shared_ptr<ReactorGLES::Worker>& worker) {
   if (!IsValid()) {
@@ -8,6 +8,7 @@
 #include "impeller/base/backend_cast.h"
 #include "impeller/renderer/backend/gles/allocator_gles.h"
 #include "impeller/renderer/backend/gles/command_buffer_gles.h"
+#include "impeller/renderer/backend/gles/gpu_tracer_gles.h"
 #include "impeller/renderer/backend/gles/pipeline_library_gles.h"
 #include "impeller/renderer/backend/gles/reactor_gles.h"
 #include "impeller/renderer/backend/gles/sampler_library_gles.h"
@@ -28,6 +29,11 @@ class ContextGLES final : public Context,
 
   const ReactorGLES::Ref& GetReactor() const;
 
+  // |Context|
+  std::shared_ptr<GPUTracer> GetGPUTracer() const override;
+
+  const std::shared_ptr<GPUTracerGLES>& GetGPUTracerGLES() const;
+
   std::optional<ReactorGLES::WorkerID> AddReactorWorker(
       const std::shared_ptr<ReactorGLES::Worker>& worker);
 
@@ -35,6 +41,7 @@ class ContextGLES final : public Context,
 
  private:
   ReactorGLES::Ref reactor_;
+  std::shared_ptr<GPUTracerGLES> gpu_tracer_;
   std::shared_ptr<ShaderLibraryGLES> shader_library_;
   std::shared_ptr<PipelineLibraryGLES> pipeline_library_;
   std::shared_ptr<SamplerLibraryGLES> sampler_library_;
@@ -4,6 +4,7 @@
 
 #include "impeller/renderer/backend/gles/device_buffer_gles.h"
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 
@@ -52,6 +53,13 @@ bool DeviceBufferGLES::OnCopyHostBuffer(const uint8_t* source,
 
   std::memmove(backing_store_->GetBuffer() + offset,
                source + source_range.offset, source_range.length);
+  if (generation_ == upload_generation_) {
+    dirty_begin_ = offset;
+    dirty_end_ = offset + source_range.length;
+  } else {
+    dirty_begin_ = std::min(dirty_begin_, offset);
+    dirty_end_ = std::max(dirty_end_, offset + source_range.length);
+  }
   ++generation_;
 
   return true;
@@ -83,10 +91,22 @@ bool DeviceBufferGLES::BindAndUploadDataIfNecessary(BindingType type) const {
   gl.BindBuffer(target_type, buffer.value());
 
   if (upload_generation_ != generation_) {
-    TRACE_EVENT1("impeller", "BufferData", "Bytes",
-                 std::to_string(backing_store_->GetLength()).c_str());
-    gl.BufferData(target_type, backing_store_->GetLength(),
-                  backing_store_->GetBuffer(), GL_STATIC_DRAW);
+    if (buffer_allocated_ && dirty_end_ > dirty_begin_ &&
+        dirty_end_ <= backing_store_->GetLength()) {
+      // The buffer object already has storage for the full backing store;
+      // only transfer the range the host actually wrote since the last
+      // upload.
+      TRACE_EVENT1("impeller", "BufferSubData", "Bytes",
+                   std::to_string(dirty_end_ - dirty_begin_).c_str());
+      gl.BufferSubData(target_type, dirty_begin_, dirty_end_ - dirty_begin_,
+                       backing_store_->GetBuffer() + dirty_begin_);
+    } else {
+      TRACE_EVENT1("impeller", "BufferData", "Bytes",
+                   std::to_string(backing_store_->GetLength()).c_str());
+      gl.BufferData(target_type, backing_store_->GetLength(),
+                    backing_store_->GetBuffer(), GL_STATIC_DRAW);
+      buffer_allocated_ = true;
+    }
     upload_generation_ = generation_;
   }
 
@@ -40,6 +40,12 @@ class DeviceBufferGLES final
   mutable std::shared_ptr<Allocation> backing_store_;
   mutable uint32_t generation_ = 0;
   mutable uint32_t upload_generation_ = 0;
+  // Whether the GL buffer object has storage for the full backing store.
+  mutable bool buffer_allocated_ = false;
+  // The coalesced extent of host writes since the last upload. Uploads only
+  // transfer this range once the buffer object has storage.
+  mutable size_t dirty_begin_ = 0u;
+  mutable size_t dirty_end_ = 0u;
 
   // |DeviceBuffer|
   uint8_t* OnGetContents() const override;
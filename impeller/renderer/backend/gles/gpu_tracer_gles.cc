@@ -0,0 +1,84 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/gles/gpu_tracer_gles.h"
+
+#include "flutter/fml/trace_event.h"
+
+namespace impeller {
+
+GPUTracerGLES::GPUTracerGLES() = default;
+
+GPUTracerGLES::~GPUTracerGLES() = default;
+
+void GPUTracerGLES::MarkPassBegin(const ProcTableGLES& gl,
+                                  const std::string& label) {
+  // The timer query procs reset together when GL_EXT_disjoint_timer_query is
+  // absent, so checking one covers them all.
+  if (!gl.GenQueriesEXT.IsAvailable() || pass_active_) {
+    return;
+  }
+
+  ProcessPendingTraces(gl);
+
+  GLuint query = GL_NONE;
+  gl.GenQueriesEXT(1u, &query);
+  if (query == GL_NONE) {
+    return;
+  }
+
+  gl.BeginQueryEXT(GL_TIME_ELAPSED_EXT, query);
+  pending_traces_.push_back(
+      PendingTrace{query, label.empty() ? "UnlabeledPass" : label});
+  pass_active_ = true;
+}
+
+void GPUTracerGLES::MarkPassEnd(const ProcTableGLES& gl) {
+  if (!pass_active_) {
+    return;
+  }
+  gl.EndQueryEXT(GL_TIME_ELAPSED_EXT);
+  pass_active_ = false;
+}
+
+void GPUTracerGLES::ProcessPendingTraces(const ProcTableGLES& gl) {
+  // Queries complete in submission order. Stop at the first one whose result
+  // hasn't landed yet; it (and everything after it) is polled again before
+  // the next pass.
+  while (!pending_traces_.empty()) {
+    auto& trace = pending_traces_.front();
+    GLuint available = GL_FALSE;
+    gl.GetQueryObjectuivEXT(trace.query, GL_QUERY_RESULT_AVAILABLE_EXT,
+                            &available);
+    if (available != GL_TRUE) {
+      break;
+    }
+    GLuint64 duration_nanos = 0u;
+    gl.GetQueryObjectui64vEXT(trace.query, GL_QUERY_RESULT_EXT,
+                              &duration_nanos);
+    FML_TRACE_COUNTER("impeller", "GPUPassTime",
+                      trace_counter_++,     // Trace Counter ID
+                      trace.label.c_str(),  // Pass label
+                      static_cast<int64_t>(duration_nanos / 1000u)  // Micros
+    );
+    traced_pass_count_.fetch_add(1u, std::memory_order_relaxed);
+    total_pass_nanos_.fetch_add(duration_nanos, std::memory_order_relaxed);
+    gl.DeleteQueriesEXT(1u, &trace.query);
+    pending_traces_.erase(pending_traces_.begin());
+  }
+}
+
+GPUTracerStats GPUTracerGLES::GetStats() const {
+  GPUTracerStats stats;
+  stats.traced_pass_count = traced_pass_count_.load(std::memory_order_relaxed);
+  stats.total_pass_nanos = total_pass_nanos_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void GPUTracerGLES::ResetStats() {
+  traced_pass_count_.store(0u, std::memory_order_relaxed);
+  total_pass_nanos_.store(0u, std::memory_order_relaxed);
+}
+
+}  // namespace impeller
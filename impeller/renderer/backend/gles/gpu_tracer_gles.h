@@ -0,0 +1,74 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "impeller/renderer/backend/gles/proc_table_gles.h"
+#include "impeller/renderer/gpu_tracer.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Brackets each render and blit pass encoded on the reactor
+///             worker with a GL_EXT_disjoint_timer_query elapsed-time query.
+///             Query results land asynchronously and are polled before the
+///             next pass begins timing, then reported as timeline counters.
+///             This gives per-pass GPU time in traces instead of inferring
+///             device load from frame deltas.
+///
+///             All methods must be called on the reactor worker with a
+///             current context. Every method is a no-op when the timer query
+///             extension is absent.
+///
+class GPUTracerGLES final : public GPUTracer {
+ public:
+  GPUTracerGLES();
+
+  // |GPUTracer|
+  ~GPUTracerGLES() override;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Begin timing a pass. Elapsed-time queries cannot nest, so
+  ///             this is a no-op if another pass is already being timed.
+  ///
+  void MarkPassBegin(const ProcTableGLES& gl, const std::string& label);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Finish timing the pass begun with |MarkPassBegin|.
+  ///
+  void MarkPassEnd(const ProcTableGLES& gl);
+
+  // |GPUTracer|
+  GPUTracerStats GetStats() const override;
+
+  // |GPUTracer|
+  void ResetStats() override;
+
+ private:
+  struct PendingTrace {
+    GLuint query = GL_NONE;
+    std::string label;
+  };
+
+  // Queries whose results have not landed yet, in submission order.
+  std::vector<PendingTrace> pending_traces_;
+  bool pass_active_ = false;
+  int64_t trace_counter_ = 0;
+
+  // Aggregates are atomic because they are read (and reset) from threads
+  // other than the reactor worker that records them.
+  std::atomic<uint64_t> traced_pass_count_ = 0u;
+  std::atomic<uint64_t> total_pass_nanos_ = 0u;
+
+  void ProcessPendingTraces(const ProcTableGLES& gl);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(GPUTracerGLES);
+};
+
+}  // namespace impeller
@@ -111,6 +111,19 @@ ProcTableGLES::ProcTableGLES(Resolver resolver) {
     DiscardFramebufferEXT.Reset();
   }
 
+  if (!description_->HasExtension("GL_OES_EGL_image")) {
+    EGLImageTargetTexture2DOES.Reset();
+  }
+
+  if (!description_->HasExtension("GL_EXT_disjoint_timer_query")) {
+    BeginQueryEXT.Reset();
+    DeleteQueriesEXT.Reset();
+    EndQueryEXT.Reset();
+    GenQueriesEXT.Reset();
+    GetQueryObjectui64vEXT.Reset();
+    GetQueryObjectuivEXT.Reset();
+  }
+
   capabilities_ = std::make_unique<CapabilitiesGLES>(*this);
 
   is_valid_ = true;
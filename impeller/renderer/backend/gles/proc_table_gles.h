@@ -94,6 +94,7 @@ struct GLProc {
   PROC(BlendEquationSeparate);               \
   PROC(BlendFuncSeparate);                   \
   PROC(BufferData);                          \
+  PROC(BufferSubData);                       \
   PROC(CheckFramebufferStatus);              \
   PROC(Clear);                               \
   PROC(ClearColor);                          \
@@ -167,7 +168,14 @@ struct GLProc {
 #define FOR_EACH_IMPELLER_GLES3_PROC(PROC) PROC(BlitFramebuffer);
 
 #define FOR_EACH_IMPELLER_EXT_PROC(PROC) \
+  PROC(BeginQueryEXT);                   \
+  PROC(DeleteQueriesEXT);                \
   PROC(DiscardFramebufferEXT);           \
+  PROC(EGLImageTargetTexture2DOES);      \
+  PROC(EndQueryEXT);                     \
+  PROC(GenQueriesEXT);                   \
+  PROC(GetQueryObjectui64vEXT);          \
+  PROC(GetQueryObjectuivEXT);            \
   PROC(PushDebugGroupKHR);               \
   PROC(PopDebugGroupKHR);                \
   PROC(ObjectLabelKHR);
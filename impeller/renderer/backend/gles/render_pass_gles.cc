@@ -5,12 +5,17 @@
 #include "impeller/renderer/backend/gles/render_pass_gles.h"
 
 #include <algorithm>
+#include <array>
+#include <map>
+#include <optional>
 
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/config.h"
 #include "impeller/base/validation.h"
+#include "impeller/renderer/backend/gles/context_gles.h"
 #include "impeller/renderer/backend/gles/device_buffer_gles.h"
 #include "impeller/renderer/backend/gles/formats_gles.h"
+#include "impeller/renderer/backend/gles/gpu_tracer_gles.h"
 #include "impeller/renderer/backend/gles/pipeline_gles.h"
 #include "impeller/renderer/backend/gles/texture_gles.h"
 
@@ -36,14 +41,142 @@ void RenderPassGLES::OnSetLabel(std::string label) {
   label_ = std::move(label);
 }
 
-void ConfigureBlending(const ProcTableGLES& gl,
+//------------------------------------------------------------------------------
+/// @brief      Tracks the GL state configured per command and skips the
+///             driver calls when consecutive commands ask for values that
+///             are already set. The cache only lives for a single pass
+///             encoding since other reactor operations and the embedder may
+///             touch the context between passes.
+///
+struct PassBindingsCache {
+  explicit PassBindingsCache(const ProcTableGLES& gl) : gl_(gl) {}
+
+  const ProcTableGLES& GetProcTable() const { return gl_; }
+
+  void SetEnabled(GLenum capability, bool enabled) {
+    auto found = capabilities_.find(capability);
+    if (found != capabilities_.end() && found->second == enabled) {
+      return;
+    }
+    if (enabled) {
+      gl_.Enable(capability);
+    } else {
+      gl_.Disable(capability);
+    }
+    capabilities_[capability] = enabled;
+  }
+
+  void SetViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    const std::array<GLint, 4> viewport = {x, y, width, height};
+    if (viewport_ == viewport) {
+      return;
+    }
+    gl_.Viewport(x, y, width, height);
+    viewport_ = viewport;
+  }
+
+  void SetDepthRange(Scalar z_near, Scalar z_far) {
+    const std::array<Scalar, 2> range = {z_near, z_far};
+    if (depth_range_ == range) {
+      return;
+    }
+    gl_.DepthRangef(z_near, z_far);
+    depth_range_ = range;
+  }
+
+  void SetScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    const std::array<GLint, 4> scissor = {x, y, width, height};
+    if (scissor_ == scissor) {
+      return;
+    }
+    gl_.Scissor(x, y, width, height);
+    scissor_ = scissor;
+  }
+
+  void SetCullMode(CullMode mode) {
+    switch (mode) {
+      case CullMode::kNone:
+        SetEnabled(GL_CULL_FACE, false);
+        break;
+      case CullMode::kFrontFace:
+        SetEnabled(GL_CULL_FACE, true);
+        SetCullFace(GL_FRONT);
+        break;
+      case CullMode::kBackFace:
+        SetEnabled(GL_CULL_FACE, true);
+        SetCullFace(GL_BACK);
+        break;
+    }
+  }
+
+  void SetFrontFace(GLenum winding) {
+    if (front_face_ == winding) {
+      return;
+    }
+    gl_.FrontFace(winding);
+    front_face_ = winding;
+  }
+
+  /// @return If the blend configuration changed and must be (re)applied.
+  bool SetBlendDescriptor(const ColorAttachmentDescriptor& color) {
+    if (blend_descriptor_ == color) {
+      return false;
+    }
+    blend_descriptor_ = color;
+    return true;
+  }
+
+  /// @return If the stencil configuration changed and must be (re)applied.
+  bool SetStencilDescriptors(
+      const std::optional<StencilAttachmentDescriptor>& front,
+      const std::optional<StencilAttachmentDescriptor>& back,
+      uint32_t stencil_reference) {
+    if (stencil_configured_ && front_stencil_ == front &&
+        back_stencil_ == back && stencil_reference_ == stencil_reference) {
+      return false;
+    }
+    stencil_configured_ = true;
+    front_stencil_ = front;
+    back_stencil_ = back;
+    stencil_reference_ = stencil_reference;
+    return true;
+  }
+
+ private:
+  const ProcTableGLES& gl_;
+  std::map<GLenum, bool> capabilities_;
+  std::optional<std::array<GLint, 4>> viewport_;
+  std::optional<std::array<GLint, 4>> scissor_;
+  std::optional<std::array<Scalar, 2>> depth_range_;
+  std::optional<GLenum> cull_face_;
+  std::optional<GLenum> front_face_;
+  std::optional<ColorAttachmentDescriptor> blend_descriptor_;
+  std::optional<StencilAttachmentDescriptor> front_stencil_;
+  std::optional<StencilAttachmentDescriptor> back_stencil_;
+  uint32_t stencil_reference_ = 0u;
+  bool stencil_configured_ = false;
+
+  void SetCullFace(GLenum face) {
+    if (cull_face_ == face) {
+      return;
+    }
+    gl_.CullFace(face);
+    cull_face_ = face;
+  }
+};
+
+void ConfigureBlending(PassBindingsCache& bindings,
                        const ColorAttachmentDescriptor* color) {
+  const auto& gl = bindings.GetProcTable();
   if (!color->blending_enabled) {
-    gl.Disable(GL_BLEND);
+    bindings.SetEnabled(GL_BLEND, false);
     return;
   }
 
-  gl.Enable(GL_BLEND);
+  bindings.SetEnabled(GL_BLEND, true);
+  if (!bindings.SetBlendDescriptor(*color)) {
+    return;
+  }
   gl.BlendFuncSeparate(
       ToBlendFactor(color->src_color_blend_factor),  // src color
       ToBlendFactor(color->dst_color_blend_factor),  // dst color
@@ -89,17 +222,21 @@ void ConfigureStencil(GLenum face,
   gl.StencilMaskSeparate(face, stencil.write_mask);
 }
 
-void ConfigureStencil(const ProcTableGLES& gl,
+void ConfigureStencil(PassBindingsCache& bindings,
                       const PipelineDescriptor& pipeline,
                       uint32_t stencil_reference) {
   if (!pipeline.HasStencilAttachmentDescriptors()) {
-    gl.Disable(GL_STENCIL_TEST);
+    bindings.SetEnabled(GL_STENCIL_TEST, false);
     return;
   }
 
-  gl.Enable(GL_STENCIL_TEST);
+  bindings.SetEnabled(GL_STENCIL_TEST, true);
   const auto& front = pipeline.GetFrontStencilAttachmentDescriptor();
   const auto& back = pipeline.GetBackStencilAttachmentDescriptor();
+  if (!bindings.SetStencilDescriptors(front, back, stencil_reference)) {
+    return;
+  }
+  const auto& gl = bindings.GetProcTable();
   if (front == back) {
     ConfigureStencil(GL_FRONT_AND_BACK, gl, *front, stencil_reference);
   } else if (front.has_value()) {
@@ -141,7 +278,8 @@ struct RenderPassData {
     const RenderPassData& pass_data,
     const std::shared_ptr<Allocator>& transients_allocator,
     const ReactorGLES& reactor,
-    const std::vector<Command>& commands) {
+    const std::vector<Command>& commands,
+    const std::shared_ptr<GPUTracerGLES>& tracer) {
   TRACE_EVENT0("impeller", __FUNCTION__);
 
   if (commands.empty()) {
@@ -150,6 +288,15 @@ struct RenderPassData {
 
   const auto& gl = reactor.GetProcTable();
 
+  fml::ScopedCleanupClosure end_pass_timing([&gl, &tracer]() {
+    if (tracer) {
+      tracer->MarkPassEnd(gl);
+    }
+  });
+  if (tracer) {
+    tracer->MarkPassBegin(gl, pass_data.label);
+  }
+
   fml::ScopedCleanupClosure pop_pass_debug_marker(
       [&gl]() { gl.PopDebugGroup(); });
   if (!pass_data.label.empty()) {
@@ -222,15 +369,20 @@ struct RenderPassData {
     clear_bits |= GL_STENCIL_BUFFER_BIT;
   }
 
-  gl.Disable(GL_SCISSOR_TEST);
-  gl.Disable(GL_DEPTH_TEST);
-  gl.Disable(GL_STENCIL_TEST);
-  gl.Disable(GL_CULL_FACE);
-  gl.Disable(GL_BLEND);
+  PassBindingsCache pass_bindings(gl);
+  pass_bindings.SetEnabled(GL_SCISSOR_TEST, false);
+  pass_bindings.SetEnabled(GL_DEPTH_TEST, false);
+  pass_bindings.SetEnabled(GL_STENCIL_TEST, false);
+  pass_bindings.SetEnabled(GL_CULL_FACE, false);
+  pass_bindings.SetEnabled(GL_BLEND, false);
   gl.ColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 
   gl.Clear(clear_bits);
 
+  const PipelineGLES* bound_pipeline = nullptr;
+  std::optional<DepthAttachmentDescriptor> bound_depth;
+  bool depth_configured = false;
+
   for (const auto& command : commands) {
     if (command.instance_count != 1u) {
       VALIDATION_LOG << "GLES backend does not support instanced rendering.";
@@ -263,24 +415,29 @@ struct RenderPassData {
     //--------------------------------------------------------------------------
     /// Configure blending.
     ///
-    ConfigureBlending(gl, color_attachment);
+    ConfigureBlending(pass_bindings, color_attachment);
 
     //--------------------------------------------------------------------------
     /// Setup stencil.
     ///
-    ConfigureStencil(gl, pipeline.GetDescriptor(), command.stencil_reference);
+    ConfigureStencil(pass_bindings, pipeline.GetDescriptor(),
+                     command.stencil_reference);
 
     //--------------------------------------------------------------------------
     /// Configure depth.
     ///
     if (auto depth =
             pipeline.GetDescriptor().GetDepthStencilAttachmentDescriptor();
-        depth.has_value()) {
-      gl.Enable(GL_DEPTH_TEST);
-      gl.DepthFunc(ToCompareFunction(depth->depth_compare));
-      gl.DepthMask(depth->depth_write_enabled ? GL_TRUE : GL_FALSE);
-    } else {
-      gl.Disable(GL_DEPTH_TEST);
+        !depth_configured || depth != bound_depth) {
+      depth_configured = true;
+      bound_depth = depth;
+      if (depth.has_value()) {
+        pass_bindings.SetEnabled(GL_DEPTH_TEST, true);
+        gl.DepthFunc(ToCompareFunction(depth->depth_compare));
+        gl.DepthMask(depth->depth_write_enabled ? GL_TRUE : GL_FALSE);
+      } else {
+        pass_bindings.SetEnabled(GL_DEPTH_TEST, false);
+      }
     }
 
     // Both the viewport and scissor are specified in framebuffer coordinates.
@@ -292,14 +449,15 @@ struct RenderPassData {
     /// Setup the viewport.
     ///
     const auto& viewport = command.viewport.value_or(pass_data.viewport);
-    gl.Viewport(viewport.rect.origin.x,  // x
-                target_size.height - viewport.rect.origin.y -
-                    viewport.rect.size.height,  // y
-                viewport.rect.size.width,       // width
-                viewport.rect.size.height       // height
+    pass_bindings.SetViewport(viewport.rect.origin.x,  // x
+                              target_size.height - viewport.rect.origin.y -
+                                  viewport.rect.size.height,  // y
+                              viewport.rect.size.width,       // width
+                              viewport.rect.size.height       // height
     );
     if (pass_data.depth_attachment) {
-      gl.DepthRangef(viewport.depth_range.z_near, viewport.depth_range.z_far);
+      pass_bindings.SetDepthRange(viewport.depth_range.z_near,
+                                  viewport.depth_range.z_far);
     }
 
     //--------------------------------------------------------------------------
@@ -307,42 +465,31 @@ struct RenderPassData {
     ///
     if (command.scissor.has_value()) {
       const auto& scissor = command.scissor.value();
-      gl.Enable(GL_SCISSOR_TEST);
-      gl.Scissor(
+      pass_bindings.SetEnabled(GL_SCISSOR_TEST, true);
+      pass_bindings.SetScissor(
           scissor.origin.x,                                             // x
           target_size.height - scissor.origin.y - scissor.size.height,  // y
           scissor.size.width,                                           // width
           scissor.size.height  // height
       );
     } else {
-      gl.Disable(GL_SCISSOR_TEST);
+      pass_bindings.SetEnabled(GL_SCISSOR_TEST, false);
     }
 
     //--------------------------------------------------------------------------
     /// Setup culling.
     ///
-    switch (pipeline.GetDescriptor().GetCullMode()) {
-      case CullMode::kNone:
-        gl.Disable(GL_CULL_FACE);
-        break;
-      case CullMode::kFrontFace:
-        gl.Enable(GL_CULL_FACE);
-        gl.CullFace(GL_FRONT);
-        break;
-      case CullMode::kBackFace:
-        gl.Enable(GL_CULL_FACE);
-        gl.CullFace(GL_BACK);
-        break;
-    }
+    pass_bindings.SetCullMode(pipeline.GetDescriptor().GetCullMode());
+
     //--------------------------------------------------------------------------
     /// Setup winding order.
     ///
     switch (pipeline.GetDescriptor().GetWindingOrder()) {
       case WindingOrder::kClockwise:
-        gl.FrontFace(GL_CW);
+        pass_bindings.SetFrontFace(GL_CW);
         break;
       case WindingOrder::kCounterClockwise:
-        gl.FrontFace(GL_CCW);
+        pass_bindings.SetFrontFace(GL_CCW);
         break;
     }
 
@@ -383,10 +530,15 @@ struct RenderPassData {
     }
 
     //--------------------------------------------------------------------------
-    /// Bind the pipeline program.
+    /// Bind the pipeline program. Consecutive commands using the same
+    /// pipeline keep the program bound; the new binding replaces the old
+    /// one so no intermediate unbind is necessary.
     ///
-    if (!pipeline.BindProgram()) {
-      return false;
+    if (bound_pipeline != &pipeline) {
+      if (!pipeline.BindProgram()) {
+        return false;
+      }
+      bound_pipeline = &pipeline;
     }
 
     //--------------------------------------------------------------------------
@@ -424,13 +576,13 @@ struct RenderPassData {
     if (!vertex_desc_gles->UnbindVertexAttributes(gl)) {
       return false;
     }
+  }
 
-    //--------------------------------------------------------------------------
-    /// Unbind the program pipeline.
-    ///
-    if (!pipeline.UnbindProgram()) {
-      return false;
-    }
+  //----------------------------------------------------------------------------
+  /// Unbind the last program pipeline.
+  ///
+  if (bound_pipeline != nullptr && !bound_pipeline->UnbindProgram()) {
+    return false;
   }
 
   if (gl.DiscardFramebufferEXT.IsAvailable()) {
@@ -508,13 +660,16 @@ bool RenderPassGLES::OnEncodeCommands(const Context& context) const {
         CanDiscardAttachmentWhenDone(stencil0->store_action);
   }
 
-  return reactor_->AddOperation([pass_data,
-                                 allocator = context.GetResourceAllocator(),
-                                 commands = commands_](const auto& reactor) {
-    auto result =
-        EncodeCommandsInReactor(*pass_data, allocator, reactor, commands);
-    FML_CHECK(result) << "Must be able to encode GL commands without error.";
-  });
+  return reactor_->AddOperation(
+      [pass_data, allocator = context.GetResourceAllocator(),
+       commands = commands_,
+       tracer = ContextGLES::Cast(context).GetGPUTracerGLES()](
+          const auto& reactor) {
+        auto result = EncodeCommandsInReactor(*pass_data, allocator, reactor,
+                                              commands, tracer);
+        FML_CHECK(result)
+            << "Must be able to encode GL commands without error.";
+      });
 }
 
 }  // namespace impeller
@@ -247,4 +247,8 @@ bool ContextMTL::SupportsOffscreenMSAA() const {
   return true;
 }
 
+bool ContextMTL::SupportsCompute() const {
+  return true;
+}
+
 }  // namespace impeller
@@ -38,8 +38,14 @@ class RenderPassMTL final : public RenderPass {
   // |RenderPass|
   bool OnEncodeCommands(const Context& context) const override;
 
+  bool ShouldEncodeInParallel(const Context& context) const;
+
+  bool EncodeCommandsParallel(const Context& context) const;
+
   bool EncodeCommands(const std::shared_ptr<Allocator>& transients_allocator,
-                      id<MTLRenderCommandEncoder> pass) const;
+                      id<MTLRenderCommandEncoder> pass,
+                      size_t from_index,
+                      size_t to_index) const;
 
   FML_DISALLOW_COPY_AND_ASSIGN(RenderPassMTL);
 };
@@ -4,10 +4,15 @@
 
 #include "impeller/renderer/backend/metal/render_pass_mtl.h"
 
+#include <algorithm>
+#include <atomic>
+
 #include "flutter/fml/closure.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/backend_cast.h"
+#include "impeller/base/work_queue.h"
 #include "impeller/renderer/backend/metal/device_buffer_mtl.h"
 #include "impeller/renderer/backend/metal/formats_mtl.h"
 #include "impeller/renderer/backend/metal/pipeline_mtl.h"
@@ -19,6 +24,14 @@
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// Sub-encoders of a parallel render command encoder have a fixed setup cost
+/// and re-specify all pass state. Only passes with enough commands for several
+/// full chunks come out ahead when encoded in parallel.
+///
+static constexpr size_t kMinCommandsPerParallelEncoder = 64u;
+static constexpr size_t kMaxParallelEncoders = 4u;
+
 static bool ConfigureResolveTextureAttachment(
     const Attachment& desc,
     MTLRenderPassAttachmentDescriptor* attachment) {
@@ -160,6 +173,11 @@ bool RenderPassMTL::OnEncodeCommands(const Context& context) const {
   if (!IsValid()) {
     return false;
   }
+
+  if (ShouldEncodeInParallel(context)) {
+    return EncodeCommandsParallel(context);
+  }
+
   auto render_command_encoder =
       [buffer_ renderCommandEncoderWithDescriptor:desc_];
 
@@ -176,7 +194,129 @@ bool RenderPassMTL::OnEncodeCommands(const Context& context) const {
   fml::ScopedCleanupClosure auto_end(
       [render_command_encoder]() { [render_command_encoder endEncoding]; });
 
-  return EncodeCommands(context.GetResourceAllocator(), render_command_encoder);
+  return EncodeCommands(context.GetResourceAllocator(), render_command_encoder,
+                        0u, commands_.size());
+}
+
+bool RenderPassMTL::ShouldEncodeInParallel(const Context& context) const {
+  if (!context.GetWorkQueue()) {
+    return false;
+  }
+  return commands_.size() >= 2u * kMinCommandsPerParallelEncoder;
+}
+
+//------------------------------------------------------------------------------
+/// @brief      Resolves the device buffers backing all transient buffers
+///             referenced by the given commands.
+///
+///             Transient (host) buffers lazily create and fill their device
+///             counterparts on first resolution, which is unsafe to do
+///             concurrently. Resolving them on the calling thread up front
+///             means the parallel encoding workers only ever observe the
+///             cached device buffers.
+///
+static bool ResolveTransientBuffers(const std::vector<Command>& commands,
+                                    Allocator& allocator) {
+  auto resolve_bindings = [&allocator](const Bindings& bindings) -> bool {
+    for (const auto& buffer : bindings.buffers) {
+      const auto& view = buffer.second.resource;
+      if (!view.buffer || !view.buffer->GetDeviceBuffer(allocator)) {
+        return false;
+      }
+    }
+    return true;
+  };
+  for (const auto& command : commands) {
+    if (!resolve_bindings(command.vertex_bindings) ||
+        !resolve_bindings(command.fragment_bindings)) {
+      return false;
+    }
+    if (command.index_buffer.buffer &&
+        !command.index_buffer.buffer->GetDeviceBuffer(allocator)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool RenderPassMTL::EncodeCommandsParallel(const Context& context) const {
+  TRACE_EVENT0("impeller", "RenderPassMTL::EncodeCommandsParallel");
+
+  auto allocator = context.GetResourceAllocator();
+  if (!ResolveTransientBuffers(commands_, *allocator)) {
+    return false;
+  }
+
+  auto parallel_encoder =
+      [buffer_ parallelRenderCommandEncoderWithDescriptor:desc_];
+
+  if (!parallel_encoder) {
+    return false;
+  }
+
+  if (!label_.empty()) {
+    [parallel_encoder setLabel:@(label_.c_str())];
+  }
+
+  // Success or failure, the pass must end. The buffer can only process one pass
+  // at a time.
+  fml::ScopedCleanupClosure auto_end(
+      [parallel_encoder]() { [parallel_encoder endEncoding]; });
+
+  const size_t encoder_count =
+      std::min(commands_.size() / kMinCommandsPerParallelEncoder,
+               kMaxParallelEncoders);
+  const size_t commands_per_encoder =
+      (commands_.size() + encoder_count - 1u) / encoder_count;
+
+  // Sub-encoders execute in the order in which they were created from the
+  // parallel encoder, not the order in which the workers finish encoding into
+  // them. The final commit remains ordered.
+  std::vector<id<MTLRenderCommandEncoder>> encoders;
+  for (size_t i = 0u; i < encoder_count; i++) {
+    auto encoder = [parallel_encoder renderCommandEncoder];
+    if (!encoder) {
+      // The parallel encoder cannot end while sub-encoders are outstanding.
+      for (const auto& created : encoders) {
+        [created endEncoding];
+      }
+      return false;
+    }
+    encoders.push_back(encoder);
+  }
+
+  const auto& work_queue = context.GetWorkQueue();
+  std::atomic_bool success = true;
+  fml::CountDownLatch latch(encoder_count - 1u);
+  for (size_t i = 1u; i < encoder_count; i++) {
+    const size_t from_index = i * commands_per_encoder;
+    const size_t to_index =
+        std::min(from_index + commands_per_encoder, commands_.size());
+    auto encoder = encoders[i];
+    // Blocking on the latch below keeps this pass (and the commands being
+    // encoded) alive until all workers are done with it.
+    work_queue->PostTask(
+        [this, allocator, encoder, from_index, to_index, &success, &latch]() {
+          if (!EncodeCommands(allocator, encoder, from_index, to_index)) {
+            success = false;
+          }
+          [encoder endEncoding];
+          latch.CountDown();
+        },
+        WorkQueuePriority::kFrameCritical, i);
+  }
+
+  // Encode the first chunk on the calling thread instead of idling on the
+  // workers.
+  if (!EncodeCommands(allocator, encoders[0], 0u,
+                      std::min(commands_per_encoder, commands_.size()))) {
+    success = false;
+  }
+  [encoders[0] endEncoding];
+
+  latch.Wait();
+
+  return success;
 }
 
 //-----------------------------------------------------------------------------
@@ -399,7 +539,9 @@ static bool Bind(PassBindingsCache& pass,
 }
 
 bool RenderPassMTL::EncodeCommands(const std::shared_ptr<Allocator>& allocator,
-                                   id<MTLRenderCommandEncoder> encoder) const {
+                                   id<MTLRenderCommandEncoder> encoder,
+                                   size_t from_index,
+                                   size_t to_index) const {
   PassBindingsCache pass_bindings(encoder);
   auto bind_stage_resources = [&allocator, &pass_bindings](
                                   const Bindings& bindings,
@@ -428,7 +570,9 @@ bool RenderPassMTL::EncodeCommands(const std::shared_ptr<Allocator>& allocator,
   const auto target_sample_count = render_target_.GetSampleCount();
 
   fml::closure pop_debug_marker = [encoder]() { [encoder popDebugGroup]; };
-  for (const auto& command : commands_) {
+  for (size_t command_index = from_index; command_index < to_index;
+       command_index++) {
+    const auto& command = commands_[command_index];
     if (command.index_count == 0u) {
       continue;
     }
@@ -32,7 +32,7 @@ class SurfaceMTL final : public Surface {
   ///
   /// @return     A pointer to the wrapped surface or null.
   ///
-  static std::unique_ptr<Surface> WrapCurrentMetalLayerDrawable(
+  static std::unique_ptr<SurfaceMTL> WrapCurrentMetalLayerDrawable(
       const std::shared_ptr<Context>& context,
       CAMetalLayer* layer);
 #pragma GCC diagnostic pop
@@ -40,6 +40,13 @@ class SurfaceMTL final : public Surface {
   // |Surface|
   ~SurfaceMTL() override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The drawable this surface will present. Allows callers to
+  ///             observe the drawable's presentation, for example to pace
+  ///             drawable acquisition.
+  ///
+  id<MTLDrawable> drawable() const { return drawable_; }
+
  private:
   id<MTLDrawable> drawable_ = nil;
 
@@ -4,10 +4,11 @@
 
 #pragma once
 
-#include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "flutter/fml/logging.h"
 #include "flutter/fml/macros.h"
@@ -40,12 +41,66 @@ using BufferResource = Resource<BufferView>;
 using TextureResource = Resource<std::shared_ptr<const Texture>>;
 using SamplerResource = Resource<std::shared_ptr<const Sampler>>;
 
+//------------------------------------------------------------------------------
+/// @brief      A flat table of resources indexed by binding slot.
+///
+///             Commands bind only a handful of resources each, so a linear
+///             scan over a packed vector is cheaper than a node based map
+///             both when recording commands and when iterating their
+///             bindings during encoding.
+///
+template <class T>
+class BindingTable {
+ public:
+  using Entry = std::pair<size_t, T>;
+  using const_iterator = typename std::vector<Entry>::const_iterator;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The resource bound to the given slot. Inserts a default
+  ///             constructed entry if the slot is unbound.
+  ///
+  T& operator[](size_t slot) {
+    for (auto& entry : entries_) {
+      if (entry.first == slot) {
+        return entry.second;
+      }
+    }
+    entries_.emplace_back(slot, T{});
+    return entries_.back().second;
+  }
+
+  const_iterator find(size_t slot) const {
+    auto it = entries_.begin();
+    while (it != entries_.end() && it->first != slot) {
+      ++it;
+    }
+    return it;
+  }
+
+  const T& at(size_t slot) const {
+    auto found = find(slot);
+    FML_CHECK(found != entries_.end());
+    return found->second;
+  }
+
+  const_iterator begin() const { return entries_.begin(); }
+
+  const_iterator end() const { return entries_.end(); }
+
+  bool empty() const { return entries_.empty(); }
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  std::vector<Entry> entries_;
+};
+
 struct Bindings {
-  std::map<size_t, ShaderUniformSlot> uniforms;
-  std::map<size_t, SampledImageSlot> sampled_images;
-  std::map<size_t, BufferResource> buffers;
-  std::map<size_t, TextureResource> textures;
-  std::map<size_t, SamplerResource> samplers;
+  BindingTable<ShaderUniformSlot> uniforms;
+  BindingTable<SampledImageSlot> sampled_images;
+  BindingTable<BufferResource> buffers;
+  BindingTable<TextureResource> textures;
+  BindingTable<SamplerResource> samplers;
 };
 
 //------------------------------------------------------------------------------
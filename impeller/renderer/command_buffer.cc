@@ -6,6 +6,7 @@
 
 #include "flutter/fml/trace_event.h"
 #include "impeller/renderer/compute_pass.h"
+#include "impeller/renderer/context.h"
 #include "impeller/renderer/render_pass.h"
 #include "impeller/renderer/render_target.h"
 
@@ -25,7 +26,24 @@ bool CommandBuffer::SubmitCommands(const CompletionCallback& callback) {
     }
     return false;
   }
-  return OnSubmitCommands(callback);
+  if (transients_buffers_.empty()) {
+    return OnSubmitCommands(callback);
+  }
+  // Recycle the transients buffers of the encoded passes through the context
+  // once the GPU has consumed their contents, so that acquiring a transients
+  // buffer in a later frame is allocation free.
+  return OnSubmitCommands(
+      [callback, context = context_,
+       transients_buffers = std::move(transients_buffers_)](Status status) {
+        if (auto strong_context = context.lock()) {
+          for (const auto& buffer : transients_buffers) {
+            strong_context->RecycleTransientsBuffer(buffer);
+          }
+        }
+        if (callback) {
+          callback(status);
+        }
+      });
 }
 
 bool CommandBuffer::SubmitCommands() {
@@ -37,6 +55,7 @@ std::shared_ptr<RenderPass> CommandBuffer::CreateRenderPass(
   auto pass = OnCreateRenderPass(render_target);
   if (pass && pass->IsValid()) {
     pass->SetLabel("RenderPass");
+    transients_buffers_.emplace_back(pass->GetSharedTransientsBuffer());
     return pass;
   }
   return nullptr;
@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "impeller/renderer/blit_pass.h"
@@ -15,6 +16,7 @@ namespace impeller {
 
 class ComputePass;
 class Context;
+class HostBuffer;
 class RenderPass;
 class RenderTarget;
 
@@ -105,6 +107,11 @@ class CommandBuffer {
   virtual std::shared_ptr<ComputePass> OnCreateComputePass() const = 0;
 
  private:
+  // The transients buffers of the render passes encoded into this command
+  // buffer, retained so they can be recycled through the context once the
+  // GPU has consumed their contents.
+  std::vector<std::shared_ptr<HostBuffer>> transients_buffers_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(CommandBuffer);
 };
 
@@ -4,8 +4,15 @@
 
 #include "impeller/renderer/context.h"
 
+#include "impeller/renderer/host_buffer.h"
+
 namespace impeller {
 
+// The pool never needs to hold more buffers than the maximum number of
+// passes encoded concurrently; this bounds the memory retained if a scene
+// briefly spikes in subpass count.
+static constexpr size_t kMaxPooledTransientsBuffers = 8u;
+
 Context::~Context() = default;
 
 Context::Context() = default;
@@ -14,8 +21,40 @@ bool Context::HasThreadingRestrictions() const {
   return false;
 }
 
+bool Context::SupportsCompute() const {
+  return false;
+}
+
 std::shared_ptr<GPUTracer> Context::GetGPUTracer() const {
   return nullptr;
 }
 
+std::shared_ptr<HostBuffer> Context::AcquireTransientsBuffer() const {
+  std::shared_ptr<HostBuffer> buffer;
+  {
+    Lock lock(transients_pool_mutex_);
+    if (!transients_pool_.empty()) {
+      buffer = std::move(transients_pool_.back());
+      transients_pool_.pop_back();
+    }
+  }
+  if (!buffer) {
+    return HostBuffer::Create();
+  }
+  buffer->Reset();
+  return buffer;
+}
+
+void Context::RecycleTransientsBuffer(
+    std::shared_ptr<HostBuffer> buffer) const {
+  if (!buffer) {
+    return;
+  }
+  Lock lock(transients_pool_mutex_);
+  if (transients_pool_.size() >= kMaxPooledTransientsBuffers) {
+    return;
+  }
+  transients_pool_.emplace_back(std::move(buffer));
+}
+
 }  // namespace impeller
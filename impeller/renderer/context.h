@@ -6,8 +6,10 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "flutter/fml/macros.h"
+#include "impeller/base/thread.h"
 
 namespace impeller {
 
@@ -17,6 +19,7 @@ class CommandBuffer;
 class PipelineLibrary;
 class Allocator;
 class GPUTracer;
+class HostBuffer;
 class WorkQueue;
 
 class Context : public std::enable_shared_from_this<Context> {
@@ -49,10 +52,36 @@ class Context : public std::enable_shared_from_this<Context> {
 
   virtual bool SupportsOffscreenMSAA() const = 0;
 
+  //----------------------------------------------------------------------------
+  /// @return     Whether this context can encode compute passes. Defaults to
+  ///             false; backends with working compute support override this.
+  ///
+  virtual bool SupportsCompute() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Acquire a transients buffer for staging uniform and vertex
+  ///             data, recycled from a pool of buffers whose previous
+  ///             contents have already been consumed by the GPU. Render
+  ///             passes stage through these buffers so that steady-state
+  ///             frames perform no staging allocations.
+  ///
+  std::shared_ptr<HostBuffer> AcquireTransientsBuffer() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Return a transients buffer to the pool. Only call this once
+  ///             the command buffer that consumed the buffer's contents has
+  ///             completed.
+  ///
+  void RecycleTransientsBuffer(std::shared_ptr<HostBuffer> buffer) const;
+
  protected:
   Context();
 
  private:
+  mutable Mutex transients_pool_mutex_;
+  mutable std::vector<std::shared_ptr<HostBuffer>> transients_pool_
+      IPLR_GUARDED_BY(transients_pool_mutex_);
+
   FML_DISALLOW_COPY_AND_ASSIGN(Context);
 };
 
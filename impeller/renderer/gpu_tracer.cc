@@ -18,4 +18,10 @@ bool GPUTracer::StopCapturingFrame() {
   return false;
 }
 
+GPUTracerStats GPUTracer::GetStats() const {
+  return {};
+}
+
+void GPUTracer::ResetStats() {}
+
 }  // namespace impeller
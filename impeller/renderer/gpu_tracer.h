@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#pragma once
+
+#include <cstdint>
+
 #include "flutter/fml/macros.h"
 
 namespace impeller {
@@ -18,6 +22,17 @@ struct GPUTracerConfiguration {
   bool mtl_frame_capture_save_trace_as_document = false;
 };
 
+//------------------------------------------------------------------------------
+/// @brief      Aggregate statistics for the passes a tracer has timed since
+///             the last call to |GPUTracer::ResetStats|.
+///
+struct GPUTracerStats {
+  /// The number of passes whose GPU timings have landed.
+  uint64_t traced_pass_count = 0u;
+  /// The total GPU time spent in those passes.
+  uint64_t total_pass_nanos = 0u;
+};
+
 //------------------------------------------------------------------------------
 /// @brief      A GPU tracer to trace gpu workflow during rendering.
 ///
@@ -25,6 +40,18 @@ class GPUTracer {
  public:
   virtual ~GPUTracer();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Aggregate pass timings collected since the last call to
+  ///             |ResetStats|. Backends without pass timing support return
+  ///             zeroed stats. Safe to call from any thread.
+  ///
+  virtual GPUTracerStats GetStats() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Reset the aggregate pass timing statistics.
+  ///
+  virtual void ResetStats();
+
   //----------------------------------------------------------------------------
   /// @brief      Start capturing frame. This method should only be called when
   ///             developing.
@@ -27,6 +27,12 @@ void HostBuffer::SetLabel(std::string label) {
   label_ = std::move(label);
 }
 
+void HostBuffer::Reset() {
+  Rewind();
+  generation_++;
+  segment_index_ = (segment_index_ + 1u) % kDeviceBufferRingDepth;
+}
+
 BufferView HostBuffer::Emplace(const void* buffer,
                                size_t length,
                                size_t align) {
@@ -58,17 +64,29 @@ BufferView HostBuffer::Emplace(const void* buffer, size_t length) {
 
 std::shared_ptr<const DeviceBuffer> HostBuffer::GetDeviceBuffer(
     Allocator& allocator) const {
-  if (generation_ == device_buffer_generation_) {
-    return device_buffer_;
+  auto& segment = segments_[segment_index_];
+  if (segment.buffer && segment.generation == generation_) {
+    return segment.buffer;
+  }
+  const auto length = GetLength();
+  if (!segment.buffer || segment.capacity < length) {
+    DeviceBufferDescriptor desc;
+    desc.size = Allocation::NextPowerOfTwoSize(static_cast<uint32_t>(length));
+    desc.storage_mode = StorageMode::kHostVisible;
+    auto new_buffer = allocator.CreateBuffer(desc);
+    if (!new_buffer) {
+      return nullptr;
+    }
+    segment.buffer = std::move(new_buffer);
+    segment.capacity = desc.size;
   }
-  auto new_buffer = allocator.CreateBufferWithCopy(GetBuffer(), GetLength());
-  if (!new_buffer) {
+  if (length > 0u &&
+      !segment.buffer->CopyHostBuffer(GetBuffer(), Range{0, length})) {
     return nullptr;
   }
-  new_buffer->SetLabel(label_);
-  device_buffer_generation_ = generation_;
-  device_buffer_ = std::move(new_buffer);
-  return device_buffer_;
+  segment.buffer->SetLabel(label_);
+  segment.generation = generation_;
+  return segment.buffer;
 }
 
 }  // namespace impeller
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -17,6 +18,16 @@
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// @brief      A transient allocator for uniform and vertex staging data.
+///
+///             Emplace calls hand out offsets into a contiguous host
+///             allocation. The device buffer backing those offsets is one
+///             segment of a small ring: `Reset` rewinds the write cursor and
+///             rotates to the next segment, so a host buffer recycled once
+///             per frame never rewrites a segment that an earlier frame
+///             still in flight may be reading from.
+///
 class HostBuffer final : public std::enable_shared_from_this<HostBuffer>,
                          public Allocation,
                          public Buffer {
@@ -28,6 +39,15 @@ class HostBuffer final : public std::enable_shared_from_this<HostBuffer>,
 
   void SetLabel(std::string label);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Rewind the write cursor so the buffer can be reused, keeping
+  ///             the reserved host allocation and rotating to the next device
+  ///             buffer segment in the ring. Callers must ensure that the
+  ///             command buffers referencing the previous contents have
+  ///             already been submitted.
+  ///
+  void Reset();
+
   //----------------------------------------------------------------------------
   /// @brief      Emplace uniform data onto the host buffer. Ensure that backend
   ///             specific uniform alignment requirements are respected.
@@ -96,8 +116,21 @@ class HostBuffer final : public std::enable_shared_from_this<HostBuffer>,
                                    size_t align);
 
  private:
-  mutable std::shared_ptr<DeviceBuffer> device_buffer_;
-  mutable size_t device_buffer_generation_ = 0u;
+  //----------------------------------------------------------------------------
+  /// The number of device buffer segments rotated through by `Reset`. This
+  /// matches the default maximum number of frames in flight so that by the
+  /// time a segment is rewritten, the GPU has consumed its previous contents.
+  ///
+  static constexpr size_t kDeviceBufferRingDepth = 3u;
+
+  struct DeviceBufferSegment {
+    std::shared_ptr<DeviceBuffer> buffer;
+    size_t capacity = 0u;
+    size_t generation = 0u;
+  };
+
+  mutable std::array<DeviceBufferSegment, kDeviceBufferRingDepth> segments_;
+  size_t segment_index_ = 0u;
   size_t generation_ = 1u;
   std::string label_;
 
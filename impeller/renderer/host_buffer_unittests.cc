@@ -75,5 +75,31 @@ TEST(HostBufferTest, CanEmplaceWithAlignment) {
   }
 }
 
+TEST(HostBufferTest, ResetRewindsWithoutReleasingReservation) {
+  struct Length2 {
+    uint8_t pad[2];
+  };
+
+  auto buffer = HostBuffer::Create();
+
+  for (size_t i = 0; i < 12500; i++) {
+    auto view = buffer->Emplace(Length2{});
+    ASSERT_TRUE(view);
+  }
+
+  const auto reserved = buffer->GetReservedLength();
+  ASSERT_GT(reserved, 0u);
+
+  buffer->Reset();
+
+  // The write cursor rewinds but the reservation is retained for reuse.
+  ASSERT_EQ(buffer->GetLength(), 0u);
+  ASSERT_EQ(buffer->GetReservedLength(), reserved);
+
+  auto view = buffer->Emplace(Length2{});
+  ASSERT_TRUE(view);
+  ASSERT_EQ(view.range, Range(0u, 2u));
+}
+
 }  // namespace  testing
 }  // namespace impeller
@@ -0,0 +1,116 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/pipeline_cache.h"
+
+#include <utility>
+
+#include "impeller/base/strings.h"
+#include "impeller/blobcat/blob_writer.h"
+
+namespace impeller {
+
+// The blobcat stage tag carries no meaning for pipeline blobs, but it is
+// part of the library key and so has to be stable.
+constexpr BlobShaderType kPipelineBlobType = BlobShaderType::kFragment;
+
+static std::string CacheKeyForHash(std::size_t descriptor_hash) {
+  return SPrintF("pipeline_%zx", descriptor_hash);
+}
+
+PipelineCache::PipelineCache(std::shared_ptr<fml::Mapping> payload) {
+  if (!payload) {
+    return;
+  }
+  auto library = std::make_unique<BlobLibrary>(std::move(payload));
+  if (!library->IsValid()) {
+    // An unreadable payload (corrupt file, older format) just means a
+    // cold cache; pipelines will compile and repopulate it.
+    return;
+  }
+  library_ = std::move(library);
+}
+
+PipelineCache::~PipelineCache() = default;
+
+std::shared_ptr<fml::Mapping> PipelineCache::GetPipelineBlob(
+    const PipelineDescriptor& descriptor) const {
+  return GetBlob(descriptor.GetHash());
+}
+
+std::shared_ptr<fml::Mapping> PipelineCache::GetPipelineBlob(
+    const ComputePipelineDescriptor& descriptor) const {
+  return GetBlob(descriptor.GetHash());
+}
+
+void PipelineCache::StorePipelineBlob(const PipelineDescriptor& descriptor,
+                                      std::shared_ptr<fml::Mapping> blob) {
+  StoreBlob(descriptor.GetHash(), std::move(blob));
+}
+
+void PipelineCache::StorePipelineBlob(
+    const ComputePipelineDescriptor& descriptor,
+    std::shared_ptr<fml::Mapping> blob) {
+  StoreBlob(descriptor.GetHash(), std::move(blob));
+}
+
+std::shared_ptr<fml::Mapping> PipelineCache::GetBlob(
+    std::size_t descriptor_hash) const {
+  auto key = CacheKeyForHash(descriptor_hash);
+  {
+    std::scoped_lock lock(fresh_blobs_mutex_);
+    auto found = fresh_blobs_.find(key);
+    if (found != fresh_blobs_.end()) {
+      return found->second;
+    }
+  }
+  if (library_) {
+    return library_->GetMapping(kPipelineBlobType, std::move(key));
+  }
+  return nullptr;
+}
+
+void PipelineCache::StoreBlob(std::size_t descriptor_hash,
+                              std::shared_ptr<fml::Mapping> blob) {
+  if (!blob || blob->GetMapping() == nullptr) {
+    return;
+  }
+  auto key = CacheKeyForHash(descriptor_hash);
+  if (library_ && library_->GetMapping(kPipelineBlobType, key)) {
+    return;
+  }
+  std::scoped_lock lock(fresh_blobs_mutex_);
+  fresh_blobs_[std::move(key)] = std::move(blob);
+}
+
+bool PipelineCache::IsDirty() const {
+  std::scoped_lock lock(fresh_blobs_mutex_);
+  return !fresh_blobs_.empty();
+}
+
+size_t PipelineCache::GetBlobCount() const {
+  std::scoped_lock lock(fresh_blobs_mutex_);
+  return fresh_blobs_.size() + (library_ ? library_->GetShaderCount() : 0u);
+}
+
+std::shared_ptr<fml::Mapping> PipelineCache::CreateMapping() const {
+  BlobWriter writer;
+  if (library_) {
+    library_->IterateAllBlobs([&writer](auto type, const auto& name,
+                                        const auto& mapping) {
+      return writer.AddBlob(type, name, mapping);
+    });
+  }
+  {
+    std::scoped_lock lock(fresh_blobs_mutex_);
+    for (const auto& blob : fresh_blobs_) {
+      if (!writer.AddBlob(kPipelineBlobType, blob.first, blob.second)) {
+        return nullptr;
+      }
+    }
+  }
+  return writer.CreateMapping();
+}
+
+}  // namespace impeller
@@ -0,0 +1,84 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+#include "impeller/blobcat/blob_library.h"
+#include "impeller/renderer/compute_pipeline_descriptor.h"
+#include "impeller/renderer/pipeline_descriptor.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      An on-disk cache of backend pipeline state blobs (Metal
+///             binary archives, GL program binaries, Vulkan pipeline cache
+///             data) keyed by pipeline descriptor hash.
+///
+///             The persisted payload is a blobcat library that the embedder
+///             maps from disk (typically via an fml::FileMapping, so loads
+///             are mmap reads rather than copies) and hands to the cache at
+///             startup. Backend pipeline libraries consult the cache before
+///             compiling a pipeline and offer freshly compiled blobs back
+///             to it; the embedder periodically persists the updated
+///             payload obtained from CreateMapping so second launches skip
+///             the compilations entirely.
+///
+///             All methods are safe to call from multiple threads; backends
+///             compile pipelines on their worker pools.
+class PipelineCache {
+ public:
+  /// Constructs a cache over a previously persisted payload. A null or
+  /// unrecognized payload yields a valid but initially empty cache.
+  explicit PipelineCache(std::shared_ptr<fml::Mapping> payload = nullptr);
+
+  ~PipelineCache();
+
+  /// The backend blob previously stored for the descriptor, or nullptr if
+  /// the pipeline has to be compiled from scratch.
+  std::shared_ptr<fml::Mapping> GetPipelineBlob(
+      const PipelineDescriptor& descriptor) const;
+
+  std::shared_ptr<fml::Mapping> GetPipelineBlob(
+      const ComputePipelineDescriptor& descriptor) const;
+
+  /// Offers a freshly compiled backend blob for the descriptor. Blobs for
+  /// descriptors already present in the persisted payload are ignored.
+  void StorePipelineBlob(const PipelineDescriptor& descriptor,
+                         std::shared_ptr<fml::Mapping> blob);
+
+  void StorePipelineBlob(const ComputePipelineDescriptor& descriptor,
+                         std::shared_ptr<fml::Mapping> blob);
+
+  /// Whether blobs have been stored since the persisted payload was
+  /// loaded; when true, the embedder should persist CreateMapping again.
+  bool IsDirty() const;
+
+  /// The number of blobs available, persisted and freshly stored.
+  size_t GetBlobCount() const;
+
+  /// Serializes the persisted and freshly stored blobs into a payload
+  /// suitable for writing to disk and handing to a future PipelineCache.
+  std::shared_ptr<fml::Mapping> CreateMapping() const;
+
+ private:
+  std::shared_ptr<fml::Mapping> GetBlob(std::size_t descriptor_hash) const;
+
+  void StoreBlob(std::size_t descriptor_hash,
+                 std::shared_ptr<fml::Mapping> blob);
+
+  std::unique_ptr<BlobLibrary> library_;
+  mutable std::mutex fresh_blobs_mutex_;
+  std::unordered_map<std::string, std::shared_ptr<fml::Mapping>> fresh_blobs_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PipelineCache);
+};
+
+}  // namespace impeller
@@ -0,0 +1,83 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "flutter/fml/mapping.h"
+#include "flutter/testing/testing.h"
+#include "impeller/renderer/pipeline_cache.h"
+
+namespace impeller {
+namespace testing {
+
+static std::shared_ptr<fml::Mapping> CreateMappingFromString(
+    std::string p_string) {
+  auto string = std::make_shared<std::string>(std::move(p_string));
+  return std::make_shared<fml::NonOwnedMapping>(
+      reinterpret_cast<const uint8_t*>(string->data()), string->size(),
+      [string](auto, auto) {});
+}
+
+static std::string CreateStringFromMapping(const fml::Mapping& mapping) {
+  return std::string{reinterpret_cast<const char*>(mapping.GetMapping()),
+                     mapping.GetSize()};
+}
+
+TEST(PipelineCacheTest, EmptyCacheMissesAndIsClean) {
+  PipelineCache cache;
+  PipelineDescriptor desc;
+  ASSERT_EQ(cache.GetPipelineBlob(desc), nullptr);
+  ASSERT_FALSE(cache.IsDirty());
+  ASSERT_EQ(cache.GetBlobCount(), 0u);
+}
+
+TEST(PipelineCacheTest, StoredBlobsRoundTripThroughPersistence) {
+  PipelineDescriptor desc1;
+  desc1.SetLabel("Pipeline One");
+  PipelineDescriptor desc2;
+  desc2.SetLabel("Pipeline Two").SetSampleCount(SampleCount::kCount4);
+
+  PipelineCache cache;
+  cache.StorePipelineBlob(desc1, CreateMappingFromString("PSO One"));
+  cache.StorePipelineBlob(desc2, CreateMappingFromString("PSO Two"));
+  ASSERT_TRUE(cache.IsDirty());
+  ASSERT_EQ(cache.GetBlobCount(), 2u);
+
+  auto blob = cache.GetPipelineBlob(desc1);
+  ASSERT_NE(blob, nullptr);
+  ASSERT_EQ(CreateStringFromMapping(*blob), "PSO One");
+
+  // Reload the serialized payload as a second launch would.
+  auto payload = cache.CreateMapping();
+  ASSERT_NE(payload, nullptr);
+  PipelineCache reloaded(payload);
+  ASSERT_FALSE(reloaded.IsDirty());
+  ASSERT_EQ(reloaded.GetBlobCount(), 2u);
+
+  auto reloaded_blob1 = reloaded.GetPipelineBlob(desc1);
+  auto reloaded_blob2 = reloaded.GetPipelineBlob(desc2);
+  ASSERT_NE(reloaded_blob1, nullptr);
+  ASSERT_NE(reloaded_blob2, nullptr);
+  ASSERT_EQ(CreateStringFromMapping(*reloaded_blob1), "PSO One");
+  ASSERT_EQ(CreateStringFromMapping(*reloaded_blob2), "PSO Two");
+
+  // Offering a blob for an already-persisted descriptor is a no-op.
+  reloaded.StorePipelineBlob(desc1, CreateMappingFromString("Stale"));
+  ASSERT_FALSE(reloaded.IsDirty());
+}
+
+TEST(PipelineCacheTest, UnrecognizedPayloadYieldsEmptyCache) {
+  PipelineCache cache(CreateMappingFromString("not a blob library"));
+  PipelineDescriptor desc;
+  ASSERT_EQ(cache.GetPipelineBlob(desc), nullptr);
+  ASSERT_EQ(cache.GetBlobCount(), 0u);
+
+  // A cold cache still accepts and serves fresh blobs.
+  cache.StorePipelineBlob(desc, CreateMappingFromString("PSO"));
+  ASSERT_TRUE(cache.IsDirty());
+  ASSERT_NE(cache.GetPipelineBlob(desc), nullptr);
+}
+
+}  // namespace testing
+}  // namespace impeller
@@ -4,12 +4,22 @@
 
 #include "impeller/renderer/pipeline_library.h"
 
+#include "impeller/renderer/pipeline_cache.h"
+
 namespace impeller {
 
 PipelineLibrary::PipelineLibrary() = default;
 
 PipelineLibrary::~PipelineLibrary() = default;
 
+void PipelineLibrary::SetCache(std::shared_ptr<PipelineCache> cache) {
+  cache_ = std::move(cache);
+}
+
+const std::shared_ptr<PipelineCache>& PipelineLibrary::GetCache() const {
+  return cache_;
+}
+
 PipelineFuture<PipelineDescriptor> PipelineLibrary::GetPipeline(
     std::optional<PipelineDescriptor> descriptor) {
   if (descriptor.has_value()) {
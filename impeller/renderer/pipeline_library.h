@@ -14,11 +14,20 @@
 namespace impeller {
 
 class Context;
+class PipelineCache;
 
 class PipelineLibrary : public std::enable_shared_from_this<PipelineLibrary> {
  public:
   virtual ~PipelineLibrary();
 
+  /// Assigns the persistent cache that backend implementations consult
+  /// before compiling a pipeline and offer freshly compiled backend blobs
+  /// back to. May be nullptr (the default), in which case every pipeline
+  /// is compiled from scratch.
+  void SetCache(std::shared_ptr<PipelineCache> cache);
+
+  const std::shared_ptr<PipelineCache>& GetCache() const;
+
   PipelineFuture<PipelineDescriptor> GetPipeline(
       std::optional<PipelineDescriptor> descriptor);
 
@@ -37,6 +46,8 @@ class PipelineLibrary : public std::enable_shared_from_this<PipelineLibrary> {
   PipelineLibrary();
 
  private:
+  std::shared_ptr<PipelineCache> cache_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(PipelineLibrary);
 };
 
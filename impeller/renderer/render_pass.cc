@@ -4,13 +4,25 @@
 
 #include "impeller/renderer/render_pass.h"
 
+#include <algorithm>
+#include <utility>
+
+#include "impeller/renderer/context.h"
+#include "impeller/renderer/host_buffer.h"
+
 namespace impeller {
 
 RenderPass::RenderPass(std::weak_ptr<const Context> context,
                        const RenderTarget& target)
-    : context_(std::move(context)),
-      render_target_(target),
-      transients_buffer_(HostBuffer::Create()) {}
+    : context_(std::move(context)), render_target_(target) {
+  // Stage through a recycled transients buffer where possible so that
+  // steady-state frames don't allocate fresh staging storage per pass.
+  if (auto strong_context = context_.lock()) {
+    transients_buffer_ = strong_context->AcquireTransientsBuffer();
+  } else {
+    transients_buffer_ = HostBuffer::Create();
+  }
+}
 
 RenderPass::~RenderPass() = default;
 
@@ -26,6 +38,11 @@ HostBuffer& RenderPass::GetTransientsBuffer() {
   return *transients_buffer_;
 }
 
+const std::shared_ptr<HostBuffer>& RenderPass::GetSharedTransientsBuffer()
+    const {
+  return transients_buffer_;
+}
+
 void RenderPass::SetLabel(std::string label) {
   if (label.empty()) {
     return;
@@ -65,12 +82,74 @@ bool RenderPass::AddCommand(Command command) {
   return true;
 }
 
-bool RenderPass::EncodeCommands() const {
+static bool LeavesStencilUntouched(const Command& command) {
+  auto stencil_is_read_only =
+      [](const std::optional<StencilAttachmentDescriptor>& stencil) {
+        return !stencil.has_value() ||
+               (stencil->stencil_failure == StencilOperation::kKeep &&
+                stencil->depth_failure == StencilOperation::kKeep &&
+                stencil->depth_stencil_pass == StencilOperation::kKeep);
+      };
+  const auto& desc = command.pipeline->GetDescriptor();
+  return stencil_is_read_only(desc.GetFrontStencilAttachmentDescriptor()) &&
+         stencil_is_read_only(desc.GetBackStencilAttachmentDescriptor());
+}
+
+static bool HaveCompatibleBlends(const Command& a, const Command& b) {
+  const auto* blend_a =
+      a.pipeline->GetDescriptor().GetColorAttachmentDescriptor(0u);
+  const auto* blend_b =
+      b.pipeline->GetDescriptor().GetColorAttachmentDescriptor(0u);
+  if (blend_a == nullptr || blend_b == nullptr) {
+    return false;
+  }
+  return *blend_a == *blend_b;
+}
+
+static std::pair<const void*, const void*> CommandSortKey(
+    const Command& command) {
+  const void* texture = nullptr;
+  if (!command.fragment_bindings.textures.empty()) {
+    texture =
+        command.fragment_bindings.textures.begin()->second.resource.get();
+  }
+  return std::make_pair(command.pipeline.get(), texture);
+}
+
+void RenderPass::SortCommandsForEncoding() {
+  auto range_begin = commands_.begin();
+  while (range_begin != commands_.end()) {
+    if (!range_begin->pipeline || !LeavesStencilUntouched(*range_begin)) {
+      ++range_begin;
+      continue;
+    }
+    // Grow the span for as long as the commands are blend compatible: no
+    // command in the span writes the stencil buffer, all commands test
+    // against the same stencil reference, and all share one blend
+    // configuration. Stencil-writing commands (clips and overdraw
+    // prevention) act as reorder barriers.
+    auto range_end = std::next(range_begin);
+    while (range_end != commands_.end() && range_end->pipeline &&
+           LeavesStencilUntouched(*range_end) &&
+           range_end->stencil_reference == range_begin->stencil_reference &&
+           HaveCompatibleBlends(*range_begin, *range_end)) {
+      ++range_end;
+    }
+    std::stable_sort(range_begin, range_end,
+                     [](const Command& a, const Command& b) {
+                       return CommandSortKey(a) < CommandSortKey(b);
+                     });
+    range_begin = range_end;
+  }
+}
+
+bool RenderPass::EncodeCommands() {
   auto context = context_.lock();
   // The context could have been collected in the meantime.
   if (!context) {
     return false;
   }
+  SortCommandsForEncoding();
   return OnEncodeCommands(*context);
 }
 
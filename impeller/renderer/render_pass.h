@@ -37,6 +37,13 @@ class RenderPass {
 
   HostBuffer& GetTransientsBuffer();
 
+  //----------------------------------------------------------------------------
+  /// @brief      The transients buffer as a reference-counted handle. The
+  ///             command buffer retains this so the buffer can be recycled
+  ///             once the GPU has consumed its contents.
+  ///
+  const std::shared_ptr<HostBuffer>& GetSharedTransientsBuffer() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Record a command for subsequent encoding to the underlying
   ///             command buffer. No work is encoded into the command buffer at
@@ -51,10 +58,14 @@ class RenderPass {
   //----------------------------------------------------------------------------
   /// @brief      Encode the recorded commands to the underlying command buffer.
   ///
+  ///             Before encoding, commands within blend-compatible spans are
+  ///             stable sorted by pipeline and texture bindings to minimize
+  ///             backend state changes.
+  ///
   /// @return     If the commands were encoded to the underlying command
   ///             buffer.
   ///
-  bool EncodeCommands() const;
+  bool EncodeCommands();
 
  protected:
   const std::weak_ptr<const Context> context_;
@@ -69,6 +80,15 @@ class RenderPass {
   virtual bool OnEncodeCommands(const Context& context) const = 0;
 
  private:
+  //----------------------------------------------------------------------------
+  /// @brief      Stable sort eligible spans of recorded commands by pipeline
+  ///             and first sampled texture so backend encoders see fewer
+  ///             state changes. Only commands that leave the stencil buffer
+  ///             untouched and share a stencil reference and blend
+  ///             configuration are reordered relative to one another.
+  ///
+  void SortCommandsForEncoding();
+
   FML_DISALLOW_COPY_AND_ASSIGN(RenderPass);
 };
 
@@ -208,7 +208,7 @@ RenderTarget RenderTarget::CreateOffscreen(const Context& context,
   color0.clear_color = Color::BlackTransparent();
   color0.load_action = color_load_action;
   color0.store_action = color_store_action;
-  color0.texture = context.GetResourceAllocator()->CreateTexture(color_tex0);
+  color0.texture = context.GetResourceAllocator()->CreateTransientTexture(color_tex0);
 
   if (!color0.texture) {
     return {};
@@ -221,7 +221,7 @@ RenderTarget RenderTarget::CreateOffscreen(const Context& context,
   stencil0.store_action = stencil_store_action;
   stencil0.clear_stencil = 0u;
   stencil0.texture =
-      context.GetResourceAllocator()->CreateTexture(stencil_tex0);
+      context.GetResourceAllocator()->CreateTransientTexture(stencil_tex0);
 
   if (!stencil0.texture) {
     return {};
@@ -262,7 +262,7 @@ RenderTarget RenderTarget::CreateOffscreenMSAA(
   color0_tex_desc.usage = static_cast<uint64_t>(TextureUsage::kRenderTarget);
 
   auto color0_msaa_tex =
-      context.GetResourceAllocator()->CreateTexture(color0_tex_desc);
+      context.GetResourceAllocator()->CreateTransientTexture(color0_tex_desc);
   if (!color0_msaa_tex) {
     VALIDATION_LOG << "Could not create multisample color texture.";
     return {};
@@ -281,7 +281,7 @@ RenderTarget RenderTarget::CreateOffscreenMSAA(
       static_cast<uint64_t>(TextureUsage::kShaderRead);
 
   auto color0_resolve_tex =
-      context.GetResourceAllocator()->CreateTexture(color0_resolve_tex_desc);
+      context.GetResourceAllocator()->CreateTransientTexture(color0_resolve_tex_desc);
   if (!color0_resolve_tex) {
     VALIDATION_LOG << "Could not create color texture.";
     return {};
@@ -313,7 +313,7 @@ RenderTarget RenderTarget::CreateOffscreenMSAA(
   stencil0.store_action = stencil_store_action;
   stencil0.clear_stencil = 0u;
   stencil0.texture =
-      context.GetResourceAllocator()->CreateTexture(stencil_tex0);
+      context.GetResourceAllocator()->CreateTransientTexture(stencil_tex0);
 
   if (!stencil0.texture) {
     return {};
@@ -24,6 +24,7 @@
 #include "impeller/image/compressed_image.h"
 #include "impeller/image/decompressed_image.h"
 #include "impeller/playground/playground_test.h"
+#include "impeller/renderer/allocator.h"
 #include "impeller/renderer/command.h"
 #include "impeller/renderer/command_buffer.h"
 #include "impeller/renderer/formats.h"
@@ -902,5 +903,34 @@ TEST_P(RendererTest, VertexBufferBuilder) {
   ASSERT_EQ(vertex_builder.GetVertexCount(), 4u);
 }
 
+TEST_P(RendererTest, TransientTexturesAreRecycled) {
+  auto allocator = GetContext()->GetResourceAllocator();
+  ASSERT_TRUE(allocator);
+
+  TextureDescriptor desc;
+  desc.storage_mode = StorageMode::kDevicePrivate;
+  desc.format = PixelFormat::kDefaultColor;
+  desc.size = {256, 256};
+  desc.usage = static_cast<uint64_t>(TextureUsage::kRenderTarget) |
+               static_cast<uint64_t>(TextureUsage::kShaderRead);
+
+  auto texture = allocator->CreateTransientTexture(desc);
+  ASSERT_TRUE(texture);
+  auto texture_ptr = texture.get();
+
+  // Dropping the last reference returns the texture to the pool, and a
+  // subsequent request with the same descriptor reuses it.
+  texture.reset();
+  auto recycled = allocator->CreateTransientTexture(desc);
+  ASSERT_TRUE(recycled);
+  ASSERT_EQ(recycled.get(), texture_ptr);
+
+  // A different descriptor gets a different texture.
+  desc.size = {128, 128};
+  auto other = allocator->CreateTransientTexture(desc);
+  ASSERT_TRUE(other);
+  ASSERT_NE(other.get(), texture_ptr);
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -0,0 +1,129 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/texture_decoder.h"
+
+#include <cstdint>
+#include <utility>
+
+#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
+#include "impeller/base/validation.h"
+#include "impeller/base/work_queue.h"
+#include "impeller/image/compressed_image.h"
+#include "impeller/image/decompressed_image.h"
+#include "impeller/renderer/allocator.h"
+#include "impeller/renderer/blit_pass.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/texture_descriptor.h"
+
+namespace impeller {
+
+static std::shared_ptr<Texture> DecodeAndUploadTexture(
+    const std::shared_ptr<Context>& context,
+    const std::shared_ptr<const fml::Mapping>& compressed_data,
+    bool generate_mipmaps,
+    const std::string& label) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+
+  auto compressed = CompressedImage::Create(compressed_data);
+  if (!compressed) {
+    VALIDATION_LOG << "Could not create compressed image.";
+    return nullptr;
+  }
+  // Everything is converted to RGBA as that format is known to be supported
+  // everywhere.
+  auto image = compressed->Decode().ConvertToRGBA();
+  if (!image.IsValid()) {
+    VALIDATION_LOG << "Could not decode compressed image.";
+    return nullptr;
+  }
+
+  // Stage the decoded pixels in a host visible texture.
+  TextureDescriptor staging_desc;
+  staging_desc.storage_mode = StorageMode::kHostVisible;
+  staging_desc.format = PixelFormat::kR8G8B8A8UNormInt;
+  staging_desc.size = image.GetSize();
+  staging_desc.mip_count = 1u;
+  auto staging = context->GetResourceAllocator()->CreateTexture(staging_desc);
+  if (!staging || !staging->SetContents(image.GetAllocation())) {
+    VALIDATION_LOG << "Could not stage decoded image.";
+    return nullptr;
+  }
+
+  if (context->HasThreadingRestrictions()) {
+    // The backend can only encode on its own thread, so the blit below can't
+    // be recorded from this worker. The host visible texture is usable for
+    // sampling as-is.
+    staging->SetLabel(label);
+    return staging;
+  }
+
+  TextureDescriptor device_desc = staging_desc;
+  device_desc.storage_mode = StorageMode::kDevicePrivate;
+  device_desc.mip_count = generate_mipmaps ? image.GetSize().MipCount() : 1u;
+  auto device_texture =
+      context->GetResourceAllocator()->CreateTexture(device_desc);
+  if (!device_texture) {
+    VALIDATION_LOG << "Could not create device texture for decoded image.";
+    return nullptr;
+  }
+  device_texture->SetLabel(label);
+
+  auto buffer = context->CreateCommandBuffer();
+  if (!buffer) {
+    return nullptr;
+  }
+  auto blit_pass = buffer->CreateBlitPass();
+  if (!blit_pass) {
+    return nullptr;
+  }
+  if (!blit_pass->AddCopy(staging, device_texture)) {
+    return nullptr;
+  }
+  if (device_desc.mip_count > 1u &&
+      !blit_pass->GenerateMipmap(device_texture, label)) {
+    return nullptr;
+  }
+  if (!blit_pass->EncodeCommands(context->GetResourceAllocator()) ||
+      !buffer->SubmitCommands()) {
+    VALIDATION_LOG << "Could not upload decoded image to device memory.";
+    return nullptr;
+  }
+
+  return device_texture;
+}
+
+std::shared_future<std::shared_ptr<Texture>> DecodeTextureAsync(
+    std::shared_ptr<Context> context,
+    std::shared_ptr<const fml::Mapping> compressed_data,
+    bool generate_mipmaps,
+    std::string label) {
+  std::promise<std::shared_ptr<Texture>> promise;
+  auto future = promise.get_future().share();
+
+  auto work_queue = context ? context->GetWorkQueue() : nullptr;
+  if (!work_queue || !compressed_data) {
+    promise.set_value(nullptr);
+    return future;
+  }
+
+  // Decodes for the same data land on the same worker via the affinity hint,
+  // so a fixture requested twice doesn't occupy two workers.
+  work_queue->PostTask(
+      fml::MakeCopyable([promise = std::move(promise),  //
+                         context = std::move(context),  //
+                         compressed_data,               //
+                         generate_mipmaps,              //
+                         label = std::move(label)]() mutable {
+        promise.set_value(DecodeAndUploadTexture(context, compressed_data,
+                                                 generate_mipmaps, label));
+      }),
+      WorkQueuePriority::kBackground,
+      reinterpret_cast<uintptr_t>(compressed_data.get()));
+
+  return future;
+}
+
+}  // namespace impeller
@@ -0,0 +1,36 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <future>
+#include <memory>
+#include <string>
+
+#include "flutter/fml/mapping.h"
+#include "impeller/renderer/context.h"
+#include "impeller/renderer/texture.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Decode a compressed image on the context's work queue and
+///             upload it into a device texture without blocking the calling
+///             thread. The decoded pixels are staged through a host visible
+///             texture and blit into a device private texture, with mipmap
+///             generation recorded on the GPU when requested. On backends
+///             with threading restrictions (GLES), encoding can't happen on
+///             the worker; the host visible staging texture is returned
+///             directly and mipmap generation is skipped.
+///
+/// @return     A future that resolves to the texture, or nullptr if decoding
+///             or the upload failed.
+///
+std::shared_future<std::shared_ptr<Texture>> DecodeTextureAsync(
+    std::shared_ptr<Context> context,
+    std::shared_ptr<const fml::Mapping> compressed_data,
+    bool generate_mipmaps = false,
+    std::string label = "");
+
+}  // namespace impeller
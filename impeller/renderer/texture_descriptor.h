@@ -51,6 +51,20 @@ struct TextureDescriptor {
            mip_count >= 1u &&                  //
            SamplingOptionsAreValid();
   }
+
+  constexpr bool operator==(const TextureDescriptor& other) const {
+    return size == other.size &&                  //
+           storage_mode == other.storage_mode &&  //
+           format == other.format &&              //
+           usage == other.usage &&                //
+           sample_count == other.sample_count &&  //
+           type == other.type &&                  //
+           mip_count == other.mip_count;
+  }
+
+  constexpr bool operator!=(const TextureDescriptor& other) const {
+    return !(*this == other);
+  }
 };
 
 }  // namespace impeller
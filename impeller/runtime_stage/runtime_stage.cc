@@ -64,35 +64,24 @@ RuntimeStage::RuntimeStage(std::shared_ptr<fml::Mapping> payload)
   if (payload_ == nullptr || !payload_->GetMapping()) {
     return;
   }
-  if (!fb::RuntimeStageBufferHasIdentifier(payload_->GetMapping())) {
+  // Verify the payload once up front. All later accesses reference the
+  // memory mapped buffer in place without further checks or copies.
+  flatbuffers::Verifier verifier(payload_->GetMapping(), payload_->GetSize());
+  if (!fb::VerifyRuntimeStageBuffer(verifier)) {
     return;
   }
-  auto runtime_stage = fb::GetRuntimeStage(payload_->GetMapping());
-  if (!runtime_stage) {
+  runtime_stage_ = fb::GetRuntimeStage(payload_->GetMapping());
+  if (!runtime_stage_ || !runtime_stage_->entrypoint() ||
+      !runtime_stage_->shader()) {
     return;
   }
 
-  stage_ = ToShaderStage(runtime_stage->stage());
-  entrypoint_ = runtime_stage->entrypoint()->str();
-
-  auto* uniforms = runtime_stage->uniforms();
-  if (uniforms) {
-    for (auto i = uniforms->begin(), end = uniforms->end(); i != end; i++) {
-      RuntimeUniformDescription desc;
-      desc.name = i->name()->str();
-      desc.location = i->location();
-      desc.type = ToType(i->type());
-      desc.dimensions = RuntimeUniformDimensions{
-          static_cast<size_t>(i->rows()), static_cast<size_t>(i->columns())};
-      desc.bit_width = i->bit_width();
-      desc.array_elements = i->array_elements();
-      uniforms_.emplace_back(std::move(desc));
-    }
-  }
+  stage_ = ToShaderStage(runtime_stage_->stage());
+  entrypoint_ = runtime_stage_->entrypoint()->str();
 
   code_mapping_ = std::make_shared<fml::NonOwnedMapping>(
-      runtime_stage->shader()->data(),     //
-      runtime_stage->shader()->size(),     //
+      runtime_stage_->shader()->data(),    //
+      runtime_stage_->shader()->size(),    //
       [payload = payload_](auto, auto) {}  //
   );
 
@@ -111,13 +100,38 @@ const std::shared_ptr<fml::Mapping>& RuntimeStage::GetCodeMapping() const {
   return code_mapping_;
 }
 
+void RuntimeStage::ParseUniformsIfNecessary() const {
+  if (uniforms_parsed_ || runtime_stage_ == nullptr) {
+    return;
+  }
+  uniforms_parsed_ = true;
+
+  auto* uniforms = runtime_stage_->uniforms();
+  if (!uniforms) {
+    return;
+  }
+  for (auto i = uniforms->begin(), end = uniforms->end(); i != end; i++) {
+    RuntimeUniformDescription desc;
+    desc.name = i->name()->str();
+    desc.location = i->location();
+    desc.type = ToType(i->type());
+    desc.dimensions = RuntimeUniformDimensions{
+        static_cast<size_t>(i->rows()), static_cast<size_t>(i->columns())};
+    desc.bit_width = i->bit_width();
+    desc.array_elements = i->array_elements();
+    uniforms_.emplace_back(std::move(desc));
+  }
+}
+
 const std::vector<RuntimeUniformDescription>& RuntimeStage::GetUniforms()
     const {
+  ParseUniformsIfNecessary();
   return uniforms_;
 }
 
 const RuntimeUniformDescription* RuntimeStage::GetUniform(
     const std::string& name) const {
+  ParseUniformsIfNecessary();
   for (const auto& uniform : uniforms_) {
     if (uniform.name == name) {
       return &uniform;
@@ -14,6 +14,10 @@
 
 namespace impeller {
 
+namespace fb {
+struct RuntimeStage;
+}  // namespace fb
+
 class RuntimeStage {
  public:
   explicit RuntimeStage(std::shared_ptr<fml::Mapping> payload);
@@ -37,11 +41,19 @@ class RuntimeStage {
  private:
   RuntimeShaderStage stage_ = RuntimeShaderStage::kVertex;
   std::shared_ptr<fml::Mapping> payload_;
+  // Points into |payload_|. The buffer is verified once during construction
+  // so accesses through this pointer need no further checks.
+  const fb::RuntimeStage* runtime_stage_ = nullptr;
   std::string entrypoint_;
   std::shared_ptr<fml::Mapping> code_mapping_;
-  std::vector<RuntimeUniformDescription> uniforms_;
+  // Uniform metadata is parsed out of the mapped buffer on first request
+  // rather than during construction.
+  mutable std::vector<RuntimeUniformDescription> uniforms_;
+  mutable bool uniforms_parsed_ = false;
   bool is_valid_ = false;
 
+  void ParseUniformsIfNecessary() const;
+
   FML_DISALLOW_COPY_AND_ASSIGN(RuntimeStage);
 };
 
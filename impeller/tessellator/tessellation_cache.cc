@@ -0,0 +1,75 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/tessellator/tessellation_cache.h"
+
+#include <cmath>
+
+namespace impeller {
+
+size_t TessellationCache::Mesh::GetByteSize() const {
+  return vertices.size() * sizeof(float) + indices.size() * sizeof(uint16_t);
+}
+
+TessellationCache::TessellationCache(size_t byte_budget)
+    : byte_budget_(byte_budget) {}
+
+TessellationCache::~TessellationCache() = default;
+
+int32_t TessellationCache::ScaleBucket(Scalar scale) {
+  if (!(scale > 0.0f)) {
+    // Degenerate and non-finite scales share a bucket; the draws they belong
+    // to don't produce meaningful output anyway.
+    return 0;
+  }
+  return static_cast<int32_t>(std::ceil(std::log2(scale)));
+}
+
+std::shared_ptr<const TessellationCache::Mesh> TessellationCache::Get(
+    uint64_t path_generation,
+    int32_t scale_bucket) {
+  auto found = entries_.find({path_generation, scale_bucket});
+  if (found == entries_.end()) {
+    return nullptr;
+  }
+  lru_.splice(lru_.begin(), lru_, found->second);
+  return found->second->mesh;
+}
+
+void TessellationCache::Put(uint64_t path_generation,
+                            int32_t scale_bucket,
+                            std::shared_ptr<const Mesh> mesh) {
+  if (!mesh) {
+    return;
+  }
+  auto mesh_bytes = mesh->GetByteSize();
+  if (mesh_bytes > byte_budget_) {
+    return;
+  }
+  CacheKey key = {path_generation, scale_bucket};
+  auto found = entries_.find(key);
+  if (found != entries_.end()) {
+    byte_size_ -= found->second->mesh->GetByteSize();
+    lru_.erase(found->second);
+    entries_.erase(found);
+  }
+  while (!lru_.empty() && byte_size_ + mesh_bytes > byte_budget_) {
+    byte_size_ -= lru_.back().mesh->GetByteSize();
+    entries_.erase(lru_.back().key);
+    lru_.pop_back();
+  }
+  lru_.push_front({key, std::move(mesh)});
+  entries_[key] = lru_.begin();
+  byte_size_ += mesh_bytes;
+}
+
+size_t TessellationCache::GetByteSize() const {
+  return byte_size_;
+}
+
+size_t TessellationCache::GetEntryCount() const {
+  return lru_.size();
+}
+
+}  // namespace impeller
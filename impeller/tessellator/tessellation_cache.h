@@ -0,0 +1,104 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "impeller/geometry/scalar.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      A byte budgeted LRU cache of CPU tessellation results.
+///
+///             Entries are keyed on the generation id of the source path plus
+///             a quantized scale, so a static path is tessellated once per
+///             scale bucket instead of once per frame. The cached triangle
+///             mesh is copied into the transient buffer of whichever render
+///             pass consumes it.
+///
+class TessellationCache {
+ public:
+  /// A tessellated triangle mesh: interleaved x/y vertex positions and
+  /// 16 bit triangle indices into them.
+  struct Mesh {
+    std::vector<float> vertices;
+    std::vector<uint16_t> indices;
+
+    size_t GetByteSize() const;
+  };
+
+  static constexpr size_t kDefaultByteBudget = 8u * 1024u * 1024u;
+
+  explicit TessellationCache(size_t byte_budget = kDefaultByteBudget);
+
+  ~TessellationCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Quantize a transform scale to a power-of-two bucket so that
+  ///             nearby scales share cache entries.
+  ///
+  static int32_t ScaleBucket(Scalar scale);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Look up the mesh for a path generation and scale bucket,
+  ///             marking the entry as most recently used on a hit.
+  ///
+  std::shared_ptr<const Mesh> Get(uint64_t path_generation,
+                                  int32_t scale_bucket);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Insert a mesh, evicting least recently used entries as
+  ///             needed to stay within the byte budget. Meshes larger than
+  ///             the entire budget are not cached.
+  ///
+  void Put(uint64_t path_generation,
+           int32_t scale_bucket,
+           std::shared_ptr<const Mesh> mesh);
+
+  size_t GetByteSize() const;
+
+  size_t GetEntryCount() const;
+
+ private:
+  struct CacheKey {
+    uint64_t path_generation = 0u;
+    int32_t scale_bucket = 0;
+
+    bool operator==(const CacheKey& o) const {
+      return path_generation == o.path_generation &&
+             scale_bucket == o.scale_bucket;
+    }
+  };
+
+  struct CacheKeyHash {
+    std::size_t operator()(const CacheKey& key) const {
+      return std::hash<uint64_t>{}(key.path_generation) ^
+             (std::hash<int32_t>{}(key.scale_bucket) << 1u);
+    }
+  };
+
+  struct CacheEntry {
+    CacheKey key;
+    std::shared_ptr<const Mesh> mesh;
+  };
+
+  using EntryList = std::list<CacheEntry>;
+
+  const size_t byte_budget_;
+  size_t byte_size_ = 0u;
+  // Most recently used entries are at the front.
+  EntryList lru_;
+  std::unordered_map<CacheKey, EntryList::iterator, CacheKeyHash> entries_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(TessellationCache);
+};
+
+}  // namespace impeller
@@ -5,6 +5,7 @@
 #include "flutter/testing/testing.h"
 #include "gtest/gtest.h"
 #include "impeller/geometry/path_builder.h"
+#include "impeller/tessellator/tessellation_cache.h"
 #include "impeller/tessellator/tessellator.h"
 
 namespace impeller {
@@ -83,5 +84,67 @@ TEST(TessellatorTest, TessellatorBuilderReturnsCorrectResultStatus) {
   }
 }
 
+TEST(TessellatorTest, PathGenerationIDChangesOnMutation) {
+  PathBuilder builder;
+  auto path = builder.AddLine({0, 0}, {10, 10}).TakePath();
+  auto generation = path.GetGenerationID();
+
+  // Copies share the generation id until mutated.
+  auto copy = path;
+  ASSERT_EQ(copy.GetGenerationID(), generation);
+
+  copy.AddLinearComponent({10, 10}, {20, 20});
+  ASSERT_NE(copy.GetGenerationID(), generation);
+  ASSERT_EQ(path.GetGenerationID(), generation);
+
+  path.SetFillType(FillType::kOdd);
+  ASSERT_NE(path.GetGenerationID(), generation);
+}
+
+TEST(TessellationCacheTest, CachesAndEvictsByByteBudget) {
+  auto make_mesh = [](size_t triangle_count) {
+    auto mesh = std::make_shared<TessellationCache::Mesh>();
+    mesh->vertices.resize(triangle_count * 6);
+    mesh->indices.resize(triangle_count * 3);
+    return mesh;
+  };
+
+  auto mesh = make_mesh(10);
+  TessellationCache cache(10u * mesh->GetByteSize());
+
+  ASSERT_EQ(cache.Get(1u, 0), nullptr);
+
+  cache.Put(1u, 0, mesh);
+  ASSERT_EQ(cache.Get(1u, 0), mesh);
+  // Differing scale buckets are distinct entries.
+  ASSERT_EQ(cache.Get(1u, 1), nullptr);
+  ASSERT_EQ(cache.GetByteSize(), mesh->GetByteSize());
+
+  // Filling the cache beyond its budget evicts the least recently used
+  // entries, but never the entries touched most recently.
+  for (uint64_t generation = 2u; generation <= 20u; generation++) {
+    cache.Put(generation, 0, make_mesh(10));
+    ASSERT_NE(cache.Get(1u, 0), nullptr);
+  }
+  ASSERT_LE(cache.GetByteSize(), 10u * mesh->GetByteSize());
+  ASSERT_EQ(cache.Get(2u, 0), nullptr);
+
+  // Meshes larger than the whole budget are not cached.
+  cache.Put(100u, 0, make_mesh(1000));
+  ASSERT_EQ(cache.Get(100u, 0), nullptr);
+}
+
+TEST(TessellationCacheTest, ScaleBucketsQuantizeToPowersOfTwo) {
+  ASSERT_EQ(TessellationCache::ScaleBucket(1.0f),
+            TessellationCache::ScaleBucket(0.75f));
+  ASSERT_EQ(TessellationCache::ScaleBucket(1.5f),
+            TessellationCache::ScaleBucket(2.0f));
+  ASSERT_NE(TessellationCache::ScaleBucket(1.0f),
+            TessellationCache::ScaleBucket(4.0f));
+  // Degenerate scales share a bucket rather than spawning entries.
+  ASSERT_EQ(TessellationCache::ScaleBucket(0.0f),
+            TessellationCache::ScaleBucket(-1.0f));
+}
+
 }  // namespace testing
 }  // namespace impeller
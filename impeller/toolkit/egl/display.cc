@@ -7,11 +7,25 @@
 #include <vector>
 
 #include "impeller/toolkit/egl/context.h"
+#include "impeller/toolkit/egl/image.h"
 #include "impeller/toolkit/egl/surface.h"
+#include "impeller/toolkit/egl/sync.h"
 
 namespace impeller {
 namespace egl {
 
+static PFNEGLCREATEIMAGEKHRPROC GetCreateImageKHRProc() {
+  static auto proc = reinterpret_cast<PFNEGLCREATEIMAGEKHRPROC>(
+      ::eglGetProcAddress("eglCreateImageKHR"));
+  return proc;
+}
+
+static PFNEGLCREATESYNCKHRPROC GetCreateSyncKHRProc() {
+  static auto proc = reinterpret_cast<PFNEGLCREATESYNCKHRPROC>(
+      ::eglGetProcAddress("eglCreateSyncKHR"));
+  return proc;
+}
+
 Display::Display() {
   EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
 
@@ -206,5 +220,55 @@ std::unique_ptr<Surface> Display::CreatePixelBufferSurface(const Config& config,
   return std::make_unique<Surface>(display_, surface);
 }
 
+std::unique_ptr<Image> Display::CreateImage(
+    EGLenum target,
+    EGLClientBuffer client_buffer) const {
+  const auto create_image = GetCreateImageKHRProc();
+  if (create_image == nullptr || client_buffer == nullptr) {
+    return nullptr;
+  }
+  // The image must remain valid if the buffer's producer releases it before
+  // the consumer is done sampling.
+  const EGLint attribs[] = {EGL_IMAGE_PRESERVED_KHR, EGL_TRUE, EGL_NONE};
+  auto image = create_image(display_,        // display
+                            EGL_NO_CONTEXT,  // context
+                            target,          // target
+                            client_buffer,   // buffer
+                            attribs          // attrib_list
+  );
+  if (image == EGL_NO_IMAGE_KHR) {
+    IMPELLER_LOG_EGL_ERROR;
+    return nullptr;
+  }
+  return std::make_unique<Image>(display_, image);
+}
+
+#if FML_OS_ANDROID
+std::unique_ptr<Image> Display::CreateImage(
+    AHardwareBuffer* hardware_buffer) const {
+  static auto get_native_client_buffer =
+      reinterpret_cast<PFNEGLGETNATIVECLIENTBUFFERANDROIDPROC>(
+          ::eglGetProcAddress("eglGetNativeClientBufferANDROID"));
+  if (get_native_client_buffer == nullptr || hardware_buffer == nullptr) {
+    return nullptr;
+  }
+  return CreateImage(EGL_NATIVE_BUFFER_ANDROID,
+                     get_native_client_buffer(hardware_buffer));
+}
+#endif  // FML_OS_ANDROID
+
+std::unique_ptr<Sync> Display::CreateFenceSync() const {
+  const auto create_sync = GetCreateSyncKHRProc();
+  if (create_sync == nullptr) {
+    return nullptr;
+  }
+  auto sync = create_sync(display_, EGL_SYNC_FENCE_KHR, nullptr);
+  if (sync == EGL_NO_SYNC_KHR) {
+    IMPELLER_LOG_EGL_ERROR;
+    return nullptr;
+  }
+  return std::make_unique<Sync>(display_, sync);
+}
+
 }  // namespace egl
 }  // namespace impeller
@@ -7,15 +7,22 @@
 #include <memory>
 #include <optional>
 
+#include "flutter/fml/build_config.h"
 #include "flutter/fml/macros.h"
 #include "impeller/toolkit/egl/config.h"
 #include "impeller/toolkit/egl/egl.h"
 
+#if FML_OS_ANDROID
+struct AHardwareBuffer;
+#endif  // FML_OS_ANDROID
+
 namespace impeller {
 namespace egl {
 
 class Context;
+class Image;
 class Surface;
+class Sync;
 
 class Display {
  public:
@@ -37,6 +44,29 @@ class Display {
                                                     size_t width,
                                                     size_t height);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Import a client buffer as an EGLImage. The image aliases
+  ///             the buffer's memory and can be bound to a texture for
+  ///             zero-copy sampling. Requires EGL_KHR_image_base.
+  ///
+  std::unique_ptr<Image> CreateImage(EGLenum target,
+                                     EGLClientBuffer client_buffer) const;
+
+#if FML_OS_ANDROID
+  //----------------------------------------------------------------------------
+  /// @brief      Import an Android hardware buffer as an EGLImage. Requires
+  ///             EGL_ANDROID_get_native_client_buffer and
+  ///             EGL_ANDROID_image_native_buffer.
+  ///
+  std::unique_ptr<Image> CreateImage(AHardwareBuffer* hardware_buffer) const;
+#endif  // FML_OS_ANDROID
+
+  //----------------------------------------------------------------------------
+  /// @brief      Insert a fence sync into the command stream of the current
+  ///             context. Requires EGL_KHR_fence_sync.
+  ///
+  std::unique_ptr<Sync> CreateFenceSync() const;
+
  private:
   EGLDisplay display_ = EGL_NO_DISPLAY;
 
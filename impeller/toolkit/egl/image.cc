@@ -0,0 +1,40 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/toolkit/egl/image.h"
+
+#include "impeller/toolkit/egl/egl.h"
+
+namespace impeller {
+namespace egl {
+
+static PFNEGLDESTROYIMAGEKHRPROC GetDestroyImageKHRProc() {
+  static auto proc = reinterpret_cast<PFNEGLDESTROYIMAGEKHRPROC>(
+      ::eglGetProcAddress("eglDestroyImageKHR"));
+  return proc;
+}
+
+Image::Image(EGLDisplay display, EGLImageKHR image)
+    : display_(display), image_(image) {}
+
+Image::~Image() {
+  if (image_ != EGL_NO_IMAGE_KHR) {
+    const auto destroy_image = GetDestroyImageKHRProc();
+    if (destroy_image == nullptr ||
+        destroy_image(display_, image_) != EGL_TRUE) {
+      IMPELLER_LOG_EGL_ERROR;
+    }
+  }
+}
+
+bool Image::IsValid() const {
+  return image_ != EGL_NO_IMAGE_KHR;
+}
+
+const EGLImageKHR& Image::GetHandle() const {
+  return image_;
+}
+
+}  // namespace egl
+}  // namespace impeller
@@ -0,0 +1,40 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include "flutter/fml/macros.h"
+
+namespace impeller {
+namespace egl {
+
+//------------------------------------------------------------------------------
+/// @brief      An EGLImageKHR imported from a client buffer along with its
+///             owning display. Imported images alias the client buffer's
+///             memory, so binding one to a texture samples the buffer
+///             contents without a copy. Instances are created via
+///             |Display::CreateImage| and destroy the image when collected.
+///
+class Image {
+ public:
+  Image(EGLDisplay display, EGLImageKHR image);
+
+  ~Image();
+
+  bool IsValid() const;
+
+  const EGLImageKHR& GetHandle() const;
+
+ private:
+  EGLDisplay display_ = EGL_NO_DISPLAY;
+  EGLImageKHR image_ = EGL_NO_IMAGE_KHR;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(Image);
+};
+
+}  // namespace egl
+}  // namespace impeller
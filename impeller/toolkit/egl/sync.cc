@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/toolkit/egl/sync.h"
+
+#include "impeller/toolkit/egl/egl.h"
+
+namespace impeller {
+namespace egl {
+
+static PFNEGLDESTROYSYNCKHRPROC GetDestroySyncKHRProc() {
+  static auto proc = reinterpret_cast<PFNEGLDESTROYSYNCKHRPROC>(
+      ::eglGetProcAddress("eglDestroySyncKHR"));
+  return proc;
+}
+
+static PFNEGLCLIENTWAITSYNCKHRPROC GetClientWaitSyncKHRProc() {
+  static auto proc = reinterpret_cast<PFNEGLCLIENTWAITSYNCKHRPROC>(
+      ::eglGetProcAddress("eglClientWaitSyncKHR"));
+  return proc;
+}
+
+static PFNEGLGETSYNCATTRIBKHRPROC GetSyncAttribKHRProc() {
+  static auto proc = reinterpret_cast<PFNEGLGETSYNCATTRIBKHRPROC>(
+      ::eglGetProcAddress("eglGetSyncAttribKHR"));
+  return proc;
+}
+
+Sync::Sync(EGLDisplay display, EGLSyncKHR sync)
+    : display_(display), sync_(sync) {}
+
+Sync::~Sync() {
+  if (sync_ != EGL_NO_SYNC_KHR) {
+    const auto destroy_sync = GetDestroySyncKHRProc();
+    if (destroy_sync == nullptr ||
+        destroy_sync(display_, sync_) != EGL_TRUE) {
+      IMPELLER_LOG_EGL_ERROR;
+    }
+  }
+}
+
+bool Sync::IsValid() const {
+  return sync_ != EGL_NO_SYNC_KHR;
+}
+
+const EGLSyncKHR& Sync::GetHandle() const {
+  return sync_;
+}
+
+bool Sync::ClientWait(uint64_t timeout_ns) const {
+  const auto client_wait = GetClientWaitSyncKHRProc();
+  if (!IsValid() || client_wait == nullptr) {
+    return false;
+  }
+  const auto result = client_wait(
+      display_, sync_, EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, timeout_ns);
+  if (result == EGL_FALSE) {
+    IMPELLER_LOG_EGL_ERROR;
+    return false;
+  }
+  return result == EGL_CONDITION_SATISFIED_KHR;
+}
+
+bool Sync::IsSignaled() const {
+  const auto get_sync_attrib = GetSyncAttribKHRProc();
+  if (!IsValid() || get_sync_attrib == nullptr) {
+    return false;
+  }
+  EGLint status = EGL_UNSIGNALED_KHR;
+  if (get_sync_attrib(display_, sync_, EGL_SYNC_STATUS_KHR, &status) !=
+      EGL_TRUE) {
+    IMPELLER_LOG_EGL_ERROR;
+    return false;
+  }
+  return status == EGL_SIGNALED_KHR;
+}
+
+}  // namespace egl
+}  // namespace impeller
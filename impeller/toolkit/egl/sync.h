@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstdint>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include "flutter/fml/macros.h"
+
+namespace impeller {
+namespace egl {
+
+//------------------------------------------------------------------------------
+/// @brief      An EGLSyncKHR fence inserted into the command stream of the
+///             current context. Producers signal consumers about the
+///             readiness of a shared resource (such as an imported
+///             |Image|) by creating a fence after writing to it via
+///             |Display::CreateFenceSync| and having the consumer wait on
+///             the fence before sampling. The fence is destroyed when the
+///             instance is collected.
+///
+class Sync {
+ public:
+  Sync(EGLDisplay display, EGLSyncKHR sync);
+
+  ~Sync();
+
+  bool IsValid() const;
+
+  const EGLSyncKHR& GetHandle() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Block the calling thread till the fence signals or the
+  ///             timeout expires, flushing the current context's commands
+  ///             first so the fence is guaranteed to make progress.
+  ///
+  /// @param[in]  timeout_ns  The timeout in nanoseconds.
+  ///
+  /// @return     If the fence signaled before the timeout expired.
+  ///
+  bool ClientWait(uint64_t timeout_ns) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Poll the fence without blocking.
+  ///
+  /// @return     If the fence has already signaled.
+  ///
+  bool IsSignaled() const;
+
+ private:
+  EGLDisplay display_ = EGL_NO_DISPLAY;
+  EGLSyncKHR sync_ = EGL_NO_SYNC_KHR;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(Sync);
+};
+
+}  // namespace egl
+}  // namespace impeller
@@ -10,6 +10,8 @@
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/allocation.h"
 #include "impeller/renderer/allocator.h"
+#include "impeller/renderer/blit_pass.h"
+#include "impeller/renderer/command_buffer.h"
 #include "impeller/typographer/backends/skia/typeface_skia.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkCanvas.h"
@@ -58,14 +60,16 @@ static FontGlyphPair::Vector CollectUniqueFontGlyphPairs(
   return vector;
 }
 
-static size_t PairsFitInAtlasOfSize(const FontGlyphPair::Vector& pairs,
-                                    const ISize& atlas_size,
-                                    std::vector<Rect>& glyph_positions) {
+static size_t PairsFitInAtlasOfSize(
+    const FontGlyphPair::Vector& pairs,
+    const ISize& atlas_size,
+    std::vector<Rect>& glyph_positions,
+    std::shared_ptr<GrRectanizer>& rect_packer) {
   if (atlas_size.IsEmpty()) {
     return false;
   }
 
-  auto rect_packer = std::unique_ptr<GrRectanizer>(
+  rect_packer = std::shared_ptr<GrRectanizer>(
       GrRectanizer::Factory(atlas_size.width, atlas_size.height));
 
   glyph_positions.clear();
@@ -93,9 +97,47 @@ static size_t PairsFitInAtlasOfSize(const FontGlyphPair::Vector& pairs,
   return 0;
 }
 
+static bool CanAppendToExistingAtlas(
+    const FontGlyphPair::Vector& extra_pairs,
+    const ISize& atlas_size,
+    const std::shared_ptr<GrRectanizer>& rect_packer,
+    std::vector<Rect>& glyph_positions) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  if (!rect_packer || atlas_size.IsEmpty()) {
+    return false;
+  }
+
+  // The rect packer retains the positions of the glyphs already in the atlas,
+  // so only the new pairs need to find space.
+  glyph_positions.clear();
+  glyph_positions.reserve(extra_pairs.size());
+
+  for (size_t i = 0; i < extra_pairs.size(); i++) {
+    const auto& pair = extra_pairs[i];
+    const auto glyph_size =
+        ISize::Ceil(pair.font.GetMetrics().GetBoundingBox().size *
+                    pair.font.GetMetrics().scale);
+    SkIPoint16 location_in_atlas;
+    if (!rect_packer->addRect(glyph_size.width,   //
+                              glyph_size.height,  //
+                              &location_in_atlas  //
+                              )) {
+      return false;
+    }
+    glyph_positions.emplace_back(Rect::MakeXYWH(location_in_atlas.x(),  //
+                                                location_in_atlas.y(),  //
+                                                glyph_size.width,       //
+                                                glyph_size.height       //
+                                                ));
+  }
+
+  return true;
+}
+
 static ISize OptimumAtlasSizeForFontGlyphPairs(
     const FontGlyphPair::Vector& pairs,
-    std::vector<Rect>& glyph_positions) {
+    std::vector<Rect>& glyph_positions,
+    std::shared_ptr<GrRectanizer>& rect_packer) {
   static constexpr auto kMinAtlasSize = 8u;
   static constexpr auto kMaxAtlasSize = 4096u;
 
@@ -104,8 +146,8 @@ static ISize OptimumAtlasSizeForFontGlyphPairs(
   ISize current_size(kMinAtlasSize, kMinAtlasSize);
   size_t total_pairs = pairs.size() + 1;
   do {
-    auto remaining_pairs =
-        PairsFitInAtlasOfSize(pairs, current_size, glyph_positions);
+    auto remaining_pairs = PairsFitInAtlasOfSize(pairs, current_size,
+                                                 glyph_positions, rect_packer);
     if (remaining_pairs == 0) {
       return current_size;
     } else if (remaining_pairs < std::ceil(total_pairs / 2)) {
@@ -238,6 +280,33 @@ static void ConvertBitmapToSignedDistanceField(uint8_t* pixels,
 #undef nearestpt
 }
 
+static void DrawGlyph(SkCanvas* canvas,
+                      const FontGlyphPair& font_glyph,
+                      const Rect& location) {
+  const auto& metrics = font_glyph.font.GetMetrics();
+  const auto position = SkPoint::Make(location.origin.x / metrics.scale,
+                                      location.origin.y / metrics.scale);
+  SkGlyphID glyph_id = font_glyph.glyph.index;
+
+  SkFont sk_font(
+      TypefaceSkia::Cast(*font_glyph.font.GetTypeface()).GetSkiaTypeface(),
+      metrics.point_size);
+  auto glyph_color = SK_ColorWHITE;
+
+  SkPaint glyph_paint;
+  glyph_paint.setColor(glyph_color);
+  canvas->resetMatrix();
+  canvas->scale(metrics.scale, metrics.scale);
+  canvas->drawGlyphs(1u,         // count
+                     &glyph_id,  // glyphs
+                     &position,  // positions
+                     SkPoint::Make(-metrics.min_extent.x,
+                                   -metrics.ascent),  // origin
+                     sk_font,                         // font
+                     glyph_paint                      // paint
+  );
+}
+
 static std::shared_ptr<SkBitmap> CreateAtlasBitmap(const GlyphAtlas& atlas,
                                                    const ISize& atlas_size) {
   TRACE_EVENT0("impeller", __FUNCTION__);
@@ -269,34 +338,121 @@ static std::shared_ptr<SkBitmap> CreateAtlasBitmap(const GlyphAtlas& atlas,
 
   atlas.IterateGlyphs([canvas](const FontGlyphPair& font_glyph,
                                const Rect& location) -> bool {
-    const auto& metrics = font_glyph.font.GetMetrics();
-    const auto position = SkPoint::Make(location.origin.x / metrics.scale,
-                                        location.origin.y / metrics.scale);
-    SkGlyphID glyph_id = font_glyph.glyph.index;
-
-    SkFont sk_font(
-        TypefaceSkia::Cast(*font_glyph.font.GetTypeface()).GetSkiaTypeface(),
-        metrics.point_size);
-    auto glyph_color = SK_ColorWHITE;
-
-    SkPaint glyph_paint;
-    glyph_paint.setColor(glyph_color);
-    canvas->resetMatrix();
-    canvas->scale(metrics.scale, metrics.scale);
-    canvas->drawGlyphs(1u,         // count
-                       &glyph_id,  // glyphs
-                       &position,  // positions
-                       SkPoint::Make(-metrics.min_extent.x,
-                                     -metrics.ascent),  // origin
-                       sk_font,                         // font
-                       glyph_paint                      // paint
-    );
+    DrawGlyph(canvas, font_glyph, location);
     return true;
   });
 
   return bitmap;
 }
 
+static bool UpdateAtlasBitmap(const GlyphAtlas& atlas,
+                              const std::shared_ptr<SkBitmap>& bitmap,
+                              const FontGlyphPair::Vector& new_pairs) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  FML_DCHECK(bitmap != nullptr);
+
+  auto surface = SkSurface::MakeRasterDirect(bitmap->pixmap());
+  if (!surface) {
+    return false;
+  }
+  auto canvas = surface->getCanvas();
+  if (!canvas) {
+    return false;
+  }
+
+  for (const auto& pair : new_pairs) {
+    auto position = atlas.FindFontGlyphPosition(pair);
+    if (!position.has_value()) {
+      continue;
+    }
+    DrawGlyph(canvas, pair, position.value());
+  }
+  return true;
+}
+
+static IRect ComputeDirtyRegion(const std::vector<Rect>& glyph_positions) {
+  auto region = glyph_positions.front();
+  for (size_t i = 1; i < glyph_positions.size(); i++) {
+    region = region.Union(glyph_positions[i]);
+  }
+  return IRect::MakeXYWH(std::floor(region.origin.x),     //
+                         std::floor(region.origin.y),     //
+                         std::ceil(region.size.width),    //
+                         std::ceil(region.size.height));  //
+}
+
+// Uploads only the dirty region of the backing bitmap by blitting a staging
+// texture into place, so that newly seen glyphs don't cost a full atlas
+// upload.
+static bool UploadDirtyAtlasRegion(const std::shared_ptr<Context>& context,
+                                   const std::shared_ptr<SkBitmap>& bitmap,
+                                   const std::shared_ptr<Texture>& texture,
+                                   IRect region) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  if (!context || !texture || region.size.IsEmpty()) {
+    return false;
+  }
+
+  region = region.Intersection(IRect::MakeSize(texture->GetSize()))
+               .value_or(IRect{});
+  if (region.size.IsEmpty()) {
+    return false;
+  }
+
+  const auto& pixmap = bitmap->pixmap();
+  const auto bytes_per_pixel = pixmap.info().bytesPerPixel();
+  const auto region_row_bytes = region.size.width * bytes_per_pixel;
+
+  auto buffer = std::make_shared<std::vector<uint8_t>>(region_row_bytes *
+                                                       region.size.height);
+  if (!pixmap.readPixels(
+          pixmap.info().makeWH(region.size.width, region.size.height),
+          buffer->data(), region_row_bytes, region.origin.x,
+          region.origin.y)) {
+    return false;
+  }
+
+  TextureDescriptor staging_descriptor;
+  staging_descriptor.storage_mode = StorageMode::kHostVisible;
+  staging_descriptor.format = texture->GetTextureDescriptor().format;
+  staging_descriptor.size = ISize(region.size.width, region.size.height);
+  auto staging_texture =
+      context->GetResourceAllocator()->CreateTexture(staging_descriptor);
+  if (!staging_texture || !staging_texture->IsValid()) {
+    return false;
+  }
+  staging_texture->SetLabel("GlyphAtlasStaging");
+
+  auto mapping = std::make_shared<fml::NonOwnedMapping>(
+      buffer->data(),                                  // data
+      buffer->size(),                                  // size
+      [buffer](auto, auto) mutable { buffer.reset(); }  // proc
+  );
+  if (!staging_texture->SetContents(mapping)) {
+    return false;
+  }
+
+  auto cmd_buffer = context->CreateCommandBuffer();
+  if (!cmd_buffer) {
+    return false;
+  }
+  auto blit_pass = cmd_buffer->CreateBlitPass();
+  if (!blit_pass || !blit_pass->IsValid()) {
+    return false;
+  }
+  blit_pass->SetLabel("Glyph Atlas Update");
+  if (!blit_pass->AddCopy(staging_texture,                             //
+                          texture,                                     //
+                          std::nullopt,                                //
+                          IPoint(region.origin.x, region.origin.y))) {
+    return false;
+  }
+  if (!blit_pass->EncodeCommands(context->GetResourceAllocator())) {
+    return false;
+  }
+  return cmd_buffer->SubmitCommands();
+}
+
 static std::shared_ptr<Texture> UploadGlyphTextureAtlas(
     const std::shared_ptr<Allocator>& allocator,
     std::shared_ptr<SkBitmap> bitmap,
@@ -366,21 +522,58 @@ std::shared_ptr<GlyphAtlas> TextRenderContextSkia::CreateGlyphAtlas(
     return last_atlas;
   }
 
+  // ---------------------------------------------------------------------------
+  // Step 3: If the atlas type is unchanged, append the newly seen glyphs to
+  //         the existing atlas instead of rebuilding it. The SDF conversion
+  //         is a whole-bitmap transform, so SDF atlases always rebuild.
+  // ---------------------------------------------------------------------------
+  if (last_atlas->GetType() == type && last_atlas->IsValid() &&
+      type != GlyphAtlas::Type::kSignedDistanceField) {
+    FontGlyphPair::Vector new_glyphs;
+    for (const auto& pair : font_glyph_pairs) {
+      if (!last_atlas->FindFontGlyphPosition(pair).has_value()) {
+        new_glyphs.push_back(pair);
+      }
+    }
+
+    std::vector<Rect> new_glyph_positions;
+    auto bitmap = atlas_context->GetBitmap();
+    if (bitmap != nullptr &&
+        CanAppendToExistingAtlas(new_glyphs, atlas_context->GetAtlasSize(),
+                                 atlas_context->GetRectPacker(),
+                                 new_glyph_positions)) {
+      for (size_t i = 0, count = new_glyphs.size(); i < count; i++) {
+        last_atlas->AddTypefaceGlyphPosition(new_glyphs[i],
+                                             new_glyph_positions[i]);
+      }
+      if (UpdateAtlasBitmap(*last_atlas, bitmap, new_glyphs) &&
+          UploadDirtyAtlasRegion(GetContext(), bitmap,
+                                 last_atlas->GetTexture(),
+                                 ComputeDirtyRegion(new_glyph_positions))) {
+        return last_atlas;
+      }
+    }
+    // Fall through to a full rebuild on failure. The free slots recorded in
+    // the rect packer are recycled when it is replaced below.
+  }
+
   auto glyph_atlas = std::make_shared<GlyphAtlas>(type);
-  atlas_context->UpdateGlyphAtlas(glyph_atlas);
 
   // ---------------------------------------------------------------------------
-  // Step 3: Get the optimum size of the texture atlas.
+  // Step 4: Get the optimum size of the texture atlas.
   // ---------------------------------------------------------------------------
   std::vector<Rect> glyph_positions;
-  const auto atlas_size =
-      OptimumAtlasSizeForFontGlyphPairs(font_glyph_pairs, glyph_positions);
+  std::shared_ptr<GrRectanizer> rect_packer;
+  const auto atlas_size = OptimumAtlasSizeForFontGlyphPairs(
+      font_glyph_pairs, glyph_positions, rect_packer);
+  atlas_context->UpdateGlyphAtlas(glyph_atlas, atlas_size);
   if (atlas_size.IsEmpty()) {
     return nullptr;
   }
+  atlas_context->UpdateRectPacker(std::move(rect_packer));
 
   // ---------------------------------------------------------------------------
-  // Step 4: Find location of font-glyph pairs in the atlas. We have this from
+  // Step 5: Find location of font-glyph pairs in the atlas. We have this from
   // the last step. So no need to do create another rect packer. But just do a
   // sanity check of counts. This could also be just an assertion as only a
   // construction issue would cause such a failure.
@@ -390,7 +583,7 @@ std::shared_ptr<GlyphAtlas> TextRenderContextSkia::CreateGlyphAtlas(
   }
 
   // ---------------------------------------------------------------------------
-  // Step 5: Record the positions in the glyph atlas.
+  // Step 6: Record the positions in the glyph atlas.
   // ---------------------------------------------------------------------------
   for (size_t i = 0, count = glyph_positions.size(); i < count; i++) {
     glyph_atlas->AddTypefaceGlyphPosition(font_glyph_pairs[i],
@@ -398,15 +591,16 @@ std::shared_ptr<GlyphAtlas> TextRenderContextSkia::CreateGlyphAtlas(
   }
 
   // ---------------------------------------------------------------------------
-  // Step 6: Draw font-glyph pairs in the correct spot in the atlas.
+  // Step 7: Draw font-glyph pairs in the correct spot in the atlas.
   // ---------------------------------------------------------------------------
   auto bitmap = CreateAtlasBitmap(*glyph_atlas, atlas_size);
   if (!bitmap) {
     return nullptr;
   }
+  atlas_context->UpdateBitmap(bitmap);
 
   // ---------------------------------------------------------------------------
-  // Step 7: Upload the atlas as a texture.
+  // Step 8: Upload the atlas as a texture.
   // ---------------------------------------------------------------------------
   PixelFormat format;
   switch (type) {
@@ -428,7 +622,7 @@ std::shared_ptr<GlyphAtlas> TextRenderContextSkia::CreateGlyphAtlas(
   }
 
   // ---------------------------------------------------------------------------
-  // Step 8: Record the texture in the glyph atlas.
+  // Step 9: Record the texture in the glyph atlas.
   // ---------------------------------------------------------------------------
   glyph_atlas->SetTexture(std::move(texture));
 
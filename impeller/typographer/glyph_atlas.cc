@@ -17,8 +17,31 @@ std::shared_ptr<GlyphAtlas> GlyphAtlasContext::GetGlyphAtlas() const {
   return atlas_;
 }
 
-void GlyphAtlasContext::UpdateGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas) {
+const ISize& GlyphAtlasContext::GetAtlasSize() const {
+  return atlas_size_;
+}
+
+std::shared_ptr<SkBitmap> GlyphAtlasContext::GetBitmap() const {
+  return bitmap_;
+}
+
+std::shared_ptr<GrRectanizer> GlyphAtlasContext::GetRectPacker() const {
+  return rect_packer_;
+}
+
+void GlyphAtlasContext::UpdateGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas,
+                                         ISize size) {
   atlas_ = std::move(atlas);
+  atlas_size_ = size;
+}
+
+void GlyphAtlasContext::UpdateBitmap(std::shared_ptr<SkBitmap> bitmap) {
+  bitmap_ = std::move(bitmap);
+}
+
+void GlyphAtlasContext::UpdateRectPacker(
+    std::shared_ptr<GrRectanizer> rect_packer) {
+  rect_packer_ = std::move(rect_packer);
 }
 
 GlyphAtlas::GlyphAtlas(Type type) : type_(type) {}
@@ -15,6 +15,9 @@
 #include "impeller/renderer/texture.h"
 #include "impeller/typographer/font_glyph_pair.h"
 
+class GrRectanizer;
+class SkBitmap;
+
 namespace impeller {
 
 //------------------------------------------------------------------------------
@@ -142,6 +145,11 @@ class GlyphAtlas {
 //------------------------------------------------------------------------------
 /// @brief      A container for caching a glyph atlas across frames.
 ///
+///             Besides the atlas itself, this holds the pieces needed to grow
+///             it incrementally: the rect packer with the remaining free
+///             space and the backing bitmap that newly seen glyphs are
+///             rendered into.
+///
 class GlyphAtlasContext {
  public:
   GlyphAtlasContext();
@@ -152,12 +160,37 @@ class GlyphAtlasContext {
   /// @brief      Retrieve the current glyph atlas.
   std::shared_ptr<GlyphAtlas> GetGlyphAtlas() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Retrieve the size of the current glyph atlas.
+  const ISize& GetAtlasSize() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Retrieve the backing bitmap of the current glyph atlas, if
+  ///             any.
+  std::shared_ptr<SkBitmap> GetBitmap() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Retrieve the rect packer that tracks the free space of the
+  ///             current glyph atlas, if any.
+  std::shared_ptr<GrRectanizer> GetRectPacker() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Update the context with a newly constructed glyph atlas.
-  void UpdateGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas);
+  void UpdateGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas, ISize size);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Update the backing bitmap of the current glyph atlas.
+  void UpdateBitmap(std::shared_ptr<SkBitmap> bitmap);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Update the rect packer of the current glyph atlas.
+  void UpdateRectPacker(std::shared_ptr<GrRectanizer> rect_packer);
 
  private:
   std::shared_ptr<GlyphAtlas> atlas_;
+  ISize atlas_size_;
+  std::shared_ptr<SkBitmap> bitmap_;
+  std::shared_ptr<GrRectanizer> rect_packer_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(GlyphAtlasContext);
 };
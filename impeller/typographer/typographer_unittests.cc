@@ -137,6 +137,34 @@ TEST_P(TypographerTest, GlyphAtlasIsRecycledIfUnchanged) {
   ASSERT_EQ(atlas_context->GetGlyphAtlas(), atlas);
 }
 
+TEST_P(TypographerTest, GlyphAtlasIsUpdatedIncrementallyForNewGlyphs) {
+  auto context = TextRenderContext::Create(GetContext());
+  auto atlas_context = std::make_shared<GlyphAtlasContext>();
+  ASSERT_TRUE(context && context->IsValid());
+  SkFont sk_font;
+  auto blob = SkTextBlob::MakeFromString("spooky skellingtons", sk_font);
+  ASSERT_TRUE(blob);
+  auto atlas =
+      context->CreateGlyphAtlas(GlyphAtlas::Type::kAlphaBitmap, atlas_context,
+                                TextFrameFromTextBlob(blob));
+  ASSERT_NE(atlas, nullptr);
+  ASSERT_NE(atlas->GetTexture(), nullptr);
+  auto old_texture = atlas->GetTexture();
+  auto old_glyph_count = atlas->GetGlyphCount();
+
+  // A blob that introduces a few new glyphs appends to the existing atlas
+  // and texture instead of rebuilding them.
+  auto blob_with_new_glyphs =
+      SkTextBlob::MakeFromString("spooky skellingtons 123", sk_font);
+  ASSERT_TRUE(blob_with_new_glyphs);
+  auto next_atlas =
+      context->CreateGlyphAtlas(GlyphAtlas::Type::kAlphaBitmap, atlas_context,
+                                TextFrameFromTextBlob(blob_with_new_glyphs));
+  ASSERT_EQ(atlas, next_atlas);
+  ASSERT_EQ(next_atlas->GetTexture(), old_texture);
+  ASSERT_GT(next_atlas->GetGlyphCount(), old_glyph_count);
+}
+
 TEST_P(TypographerTest, GlyphAtlasWithLotsOfdUniqueGlyphSize) {
   auto context = TextRenderContext::Create(GetContext());
   auto atlas_context = std::make_shared<GlyphAtlasContext>();
@@ -34,10 +34,10 @@ namespace flutter {
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, SceneBuilder);
 
-SceneBuilder::SceneBuilder() {
+SceneBuilder::SceneBuilder() : layer_arena_(std::make_shared<LayerArena>()) {
   // Add a ContainerLayer as the root layer, so that AddLayer operations are
   // always valid.
-  PushLayer(std::make_shared<flutter::ContainerLayer>());
+  PushLayer(layer_arena_->Make<flutter::ContainerLayer>());
 }
 
 SceneBuilder::~SceneBuilder() = default;
@@ -46,7 +46,7 @@ void SceneBuilder::pushTransform(Dart_Handle layer_handle,
                                  tonic::Float64List& matrix4,
                                  const fml::RefPtr<EngineLayer>& oldLayer) {
   SkMatrix sk_matrix = ToSkMatrix(matrix4);
-  auto layer = std::make_shared<flutter::TransformLayer>(sk_matrix);
+  auto layer = layer_arena_->Make<flutter::TransformLayer>(sk_matrix);
   PushLayer(layer);
   // matrix4 has to be released before we can return another Dart object
   matrix4.Release();
@@ -62,7 +62,7 @@ void SceneBuilder::pushOffset(Dart_Handle layer_handle,
                               double dy,
                               const fml::RefPtr<EngineLayer>& oldLayer) {
   SkMatrix sk_matrix = SkMatrix::Translate(dx, dy);
-  auto layer = std::make_shared<flutter::TransformLayer>(sk_matrix);
+  auto layer = layer_arena_->Make<flutter::TransformLayer>(sk_matrix);
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -81,7 +81,7 @@ void SceneBuilder::pushClipRect(Dart_Handle layer_handle,
   SkRect clipRect = SkRect::MakeLTRB(left, top, right, bottom);
   flutter::Clip clip_behavior = static_cast<flutter::Clip>(clipBehavior);
   auto layer =
-      std::make_shared<flutter::ClipRectLayer>(clipRect, clip_behavior);
+      layer_arena_->Make<flutter::ClipRectLayer>(clipRect, clip_behavior);
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -95,8 +95,8 @@ void SceneBuilder::pushClipRRect(Dart_Handle layer_handle,
                                  int clipBehavior,
                                  const fml::RefPtr<EngineLayer>& oldLayer) {
   flutter::Clip clip_behavior = static_cast<flutter::Clip>(clipBehavior);
-  auto layer =
-      std::make_shared<flutter::ClipRRectLayer>(rrect.sk_rrect, clip_behavior);
+  auto layer = layer_arena_->Make<flutter::ClipRRectLayer>(rrect.sk_rrect,
+                                                           clip_behavior);
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -112,7 +112,7 @@ void SceneBuilder::pushClipPath(Dart_Handle layer_handle,
   flutter::Clip clip_behavior = static_cast<flutter::Clip>(clipBehavior);
   FML_DCHECK(clip_behavior != flutter::Clip::none);
   auto layer =
-      std::make_shared<flutter::ClipPathLayer>(path->path(), clip_behavior);
+      layer_arena_->Make<flutter::ClipPathLayer>(path->path(), clip_behavior);
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -127,7 +127,7 @@ void SceneBuilder::pushOpacity(Dart_Handle layer_handle,
                                double dy,
                                const fml::RefPtr<EngineLayer>& oldLayer) {
   auto layer =
-      std::make_shared<flutter::OpacityLayer>(alpha, SkPoint::Make(dx, dy));
+      layer_arena_->Make<flutter::OpacityLayer>(alpha, SkPoint::Make(dx, dy));
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -140,7 +140,7 @@ void SceneBuilder::pushColorFilter(Dart_Handle layer_handle,
                                    const ColorFilter* color_filter,
                                    const fml::RefPtr<EngineLayer>& oldLayer) {
   auto layer =
-      std::make_shared<flutter::ColorFilterLayer>(color_filter->filter());
+      layer_arena_->Make<flutter::ColorFilterLayer>(color_filter->filter());
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -153,7 +153,7 @@ void SceneBuilder::pushImageFilter(Dart_Handle layer_handle,
                                    const ImageFilter* image_filter,
                                    const fml::RefPtr<EngineLayer>& oldLayer) {
   auto layer =
-      std::make_shared<flutter::ImageFilterLayer>(image_filter->filter());
+      layer_arena_->Make<flutter::ImageFilterLayer>(image_filter->filter());
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
 
@@ -167,7 +167,7 @@ void SceneBuilder::pushBackdropFilter(
     ImageFilter* filter,
     int blendMode,
     const fml::RefPtr<EngineLayer>& oldLayer) {
-  auto layer = std::make_shared<flutter::BackdropFilterLayer>(
+  auto layer = layer_arena_->Make<flutter::BackdropFilterLayer>(
       filter->filter(), static_cast<DlBlendMode>(blendMode));
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
@@ -189,7 +189,7 @@ void SceneBuilder::pushShaderMask(Dart_Handle layer_handle,
   SkRect rect = SkRect::MakeLTRB(maskRectLeft, maskRectTop, maskRectRight,
                                  maskRectBottom);
   auto sampling = ImageFilter::SamplingFromIndex(filterQualityIndex);
-  auto layer = std::make_shared<flutter::ShaderMaskLayer>(
+  auto layer = layer_arena_->Make<flutter::ShaderMaskLayer>(
       shader->shader(sampling), rect, static_cast<DlBlendMode>(blendMode));
   PushLayer(layer);
   EngineLayer::MakeRetained(layer_handle, layer);
@@ -206,7 +206,7 @@ void SceneBuilder::pushPhysicalShape(Dart_Handle layer_handle,
                                      int shadow_color,
                                      int clipBehavior,
                                      const fml::RefPtr<EngineLayer>& oldLayer) {
-  auto layer = std::make_shared<flutter::PhysicalShapeLayer>(
+  auto layer = layer_arena_->Make<flutter::PhysicalShapeLayer>(
       static_cast<SkColor>(color), static_cast<SkColor>(shadow_color),
       static_cast<float>(elevation), path->path(),
       static_cast<flutter::Clip>(clipBehavior));
@@ -238,7 +238,7 @@ void SceneBuilder::addPicture(double dx,
   // Explicitly check for display_list, since the picture object might have
   // been disposed but not collected yet, but the display list is null.
   if (picture->display_list()) {
-    auto layer = std::make_unique<flutter::DisplayListLayer>(
+    auto layer = layer_arena_->Make<flutter::DisplayListLayer>(
         SkPoint::Make(dx, dy),
         UIDartState::CreateGPUObject(picture->display_list()), !!(hints & 1),
         !!(hints & 2));
@@ -254,7 +254,7 @@ void SceneBuilder::addTexture(double dx,
                               bool freeze,
                               int filterQualityIndex) {
   auto sampling = ImageFilter::SamplingFromIndex(filterQualityIndex);
-  auto layer = std::make_unique<flutter::TextureLayer>(
+  auto layer = layer_arena_->Make<flutter::TextureLayer>(
       SkPoint::Make(dx, dy), SkSize::Make(width, height), textureId, freeze,
       sampling);
   AddLayer(std::move(layer));
@@ -265,7 +265,7 @@ void SceneBuilder::addPlatformView(double dx,
                                    double width,
                                    double height,
                                    int64_t viewId) {
-  auto layer = std::make_unique<flutter::PlatformViewLayer>(
+  auto layer = layer_arena_->Make<flutter::PlatformViewLayer>(
       SkPoint::Make(dx, dy), SkSize::Make(width, height), viewId);
   AddLayer(std::move(layer));
 }
@@ -277,7 +277,7 @@ void SceneBuilder::addPerformanceOverlay(uint64_t enabledOptions,
                                          double bottom) {
   SkRect rect = SkRect::MakeLTRB(left, top, right, bottom);
   auto layer =
-      std::make_unique<flutter::PerformanceOverlayLayer>(enabledOptions);
+      layer_arena_->Make<flutter::PerformanceOverlayLayer>(enabledOptions);
   layer->set_paint_bounds(rect);
   AddLayer(std::move(layer));
 }
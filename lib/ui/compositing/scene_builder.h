@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 
+#include "flutter/flow/layer_arena.h"
 #include "flutter/flow/layers/container_layer.h"
 #include "flutter/lib/ui/compositing/scene.h"
 #include "flutter/lib/ui/dart_wrapper.h"
@@ -139,6 +140,10 @@ class SceneBuilder : public RefCountedDartWrappable<SceneBuilder> {
   void PushLayer(std::shared_ptr<ContainerLayer> layer);
   void PopLayer();
 
+  // Arena holding the layers built by this scene builder in contiguous
+  // slabs. The layers (and any older arenas their retained subtrees were
+  // allocated from) keep the slabs alive past the builder's lifetime.
+  std::shared_ptr<LayerArena> layer_arena_;
   std::vector<std::shared_ptr<ContainerLayer>> layer_stack_;
   int rasterizer_tracing_threshold_ = 0;
   bool checkerboard_raster_cache_images_ = false;
@@ -36,6 +36,7 @@
 #include "flutter/lib/ui/text/font_collection.h"
 #include "flutter/lib/ui/text/paragraph.h"
 #include "flutter/lib/ui/text/paragraph_builder.h"
+#include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
@@ -110,6 +111,7 @@ typedef CanvasPath Path;
   V(DartRuntimeHooks::GetCallbackHandle, 1)                           \
   V(DartRuntimeHooks::GetCallbackFromHandle, 1)                       \
   V(DartPluginRegistrant_EnsureInitialized, 0)                        \
+  V(UIDartState::GetEngineAllocationBytes, 0)                         \
   V(Vertices::init, 6)
 
 // List of native instance methods used as @FfiNative functions.
@@ -135,6 +137,7 @@ typedef CanvasPath Path;
   V(Canvas, drawAtlas, 10)                             \
   V(Canvas, drawCircle, 6)                             \
   V(Canvas, drawColor, 3)                              \
+  V(Canvas, drawCommands, 4)                           \
   V(Canvas, drawDRRect, 5)                             \
   V(Canvas, drawImage, 7)                              \
   V(Canvas, drawImageNine, 13)                         \
@@ -223,6 +226,7 @@ typedef CanvasPath Path;
   V(PathMeasure, setPath, 3)                           \
   V(PathMeasure, getLength, 2)                         \
   V(PathMeasure, getPosTan, 3)                         \
+  V(PathMeasure, getPosTans, 4)                        \
   V(PathMeasure, getSegment, 6)                        \
   V(PathMeasure, isClosed, 2)                          \
   V(PathMeasure, nextContour, 1)                       \
@@ -219,6 +219,115 @@ void sendSemanticsUpdate() {
 
 void _semanticsUpdate(SemanticsUpdate update) native 'SemanticsUpdate';
 
+/// Echoes every platform message straight back so ui_benchmarks can measure
+/// the full send/response round trip.
+@pragma('vm:entry-point')
+void platformMessageEcho() {
+  PlatformDispatcher.instance.onPlatformMessage =
+      (String name, ByteData? data, PlatformMessageResponseCallback? callback) {
+    callback!(data);
+  };
+  _finish();
+}
+
+/// Signals the Finish native once per received pointer packet so
+/// ui_benchmarks can measure dispatch-to-Dart latency.
+@pragma('vm:entry-point')
+void pointerDataPacketLatency() {
+  PlatformDispatcher.instance.onPointerDataPacket = (PointerDataPacket packet) {
+    _finish();
+  };
+  _finish();
+}
+
+/// Builds and disposes a semantics update of [nodeCount] plain nodes; invoked
+/// repeatedly by ui_benchmarks to measure the transfer cost per node.
+@pragma('vm:entry-point')
+void buildSemanticsUpdate(int nodeCount) {
+  final SemanticsUpdateBuilder builder = SemanticsUpdateBuilder();
+  final Float64List transform = Float64List(16);
+  transform[0] = 1;
+  transform[5] = 1;
+  transform[10] = 1;
+  transform[15] = 1;
+  final Int32List noChildren = Int32List(0);
+  const List<StringAttribute> noAttributes = <StringAttribute>[];
+  for (int id = 0; id < nodeCount; id++) {
+    builder.updateNode(
+      id: id,
+      flags: 0,
+      actions: 0,
+      maxValueLength: 0,
+      currentValueLength: 0,
+      textSelectionBase: -1,
+      textSelectionExtent: -1,
+      platformViewId: -1,
+      scrollChildren: 0,
+      scrollIndex: 0,
+      scrollPosition: 0,
+      scrollExtentMax: 0,
+      scrollExtentMin: 0,
+      rect: Rect.fromLTRB(0, 0, 10, 10),
+      elevation: 0,
+      thickness: 0,
+      label: 'node $id',
+      labelAttributes: noAttributes,
+      value: 'value $id',
+      valueAttributes: noAttributes,
+      increasedValue: '',
+      increasedValueAttributes: noAttributes,
+      decreasedValue: '',
+      decreasedValueAttributes: noAttributes,
+      hint: '',
+      hintAttributes: noAttributes,
+      textDirection: TextDirection.ltr,
+      transform: transform,
+      childrenInTraversalOrder: noChildren,
+      childrenInHitTestOrder: noChildren,
+      additionalActions: noChildren,
+    );
+  }
+  builder.build().dispose();
+}
+
+/// Records [opCount] canvas calls of [opType] into a picture; invoked
+/// repeatedly by ui_benchmarks to measure per-op recording throughput.
+@pragma('vm:entry-point')
+void recordCanvasOps(String opType, int opCount) {
+  final PictureRecorder recorder = PictureRecorder();
+  final Canvas canvas = Canvas(recorder);
+  final Paint paint = Paint();
+  final Rect rect = Rect.fromLTWH(10, 10, 100, 100);
+  final Path path = Path()
+    ..moveTo(0, 0)
+    ..cubicTo(20, 10, 40, 60, 80, 10);
+  switch (opType) {
+    case 'drawRect':
+      for (int i = 0; i < opCount; i++) {
+        canvas.drawRect(rect, paint);
+      }
+      break;
+    case 'drawLine':
+      for (int i = 0; i < opCount; i++) {
+        canvas.drawLine(Offset.zero, const Offset(100, 100), paint);
+      }
+      break;
+    case 'drawCircle':
+      for (int i = 0; i < opCount; i++) {
+        canvas.drawCircle(const Offset(50, 50), 25, paint);
+      }
+      break;
+    case 'drawPath':
+      for (int i = 0; i < opCount; i++) {
+        canvas.drawPath(path, paint);
+      }
+      break;
+    default:
+      throw Exception('unknown op type: $opType');
+  }
+  recorder.endRecording().dispose();
+}
+
 @pragma('vm:entry-point')
 void createPath() {
   final Path path = Path()..lineTo(10, 10);
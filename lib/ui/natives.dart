@@ -83,6 +83,25 @@ Future<developer.ServiceExtensionResponse> _getImpellerEnabled(
   }));
 }
 
+// Returns the engine-side bytes attributed to this isolate as a list of four
+// integers: display list, image, path and semantics bytes, in that order.
+@FfiNative<Handle Function()>('UIDartState::GetEngineAllocationBytes')
+external List<int> _getEngineAllocationBytes();
+
+Future<developer.ServiceExtensionResponse> _getEngineAllocations(
+  String method,
+  Map<String, String> parameters,
+) async {
+  final List<int> bytes = _getEngineAllocationBytes();
+  return developer.ServiceExtensionResponse.result(json.encode(<String, Object>{
+    'type': 'Success',
+    'displayListBytes': bytes[0],
+    'imageBytes': bytes[1],
+    'pathBytes': bytes[2],
+    'semanticsBytes': bytes[3],
+  }));
+}
+
 @pragma('vm:entry-point')
 void _setupHooks() {
   assert(() {
@@ -103,6 +122,13 @@ void _setupHooks() {
       'ext.ui.window.impellerEnabled',
       _getImpellerEnabled,
     );
+
+    // In debug and profile mode, allow tools to query engine-side memory
+    // attributed to this isolate.
+    developer.registerExtension(
+      'ext.ui.window.engineAllocations',
+      _getEngineAllocations,
+    );
   }
 }
 
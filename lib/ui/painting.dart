@@ -2984,6 +2984,19 @@ class PathMetric {
     return _measure.getTangentForOffset(contourIndex, distance);
   }
 
+  /// Computes the position and tangent for each distance in `distances` with
+  /// a single native call.
+  ///
+  /// The returned list contains five floats per distance: a success flag
+  /// (zero if the contour could not be measured at that distance, mirroring
+  /// the null return of [getTangentForOffset]), the position x and y, and the
+  /// tangent vector x and y. This avoids crossing the native boundary and
+  /// allocating a [Tangent] per sample when measuring many positions along a
+  /// path, such as when animating along a polyline.
+  Float32List getPosTanList(Float32List distances) {
+    return _measure.getPosTanList(contourIndex, distances);
+  }
+
   /// Given a start and end distance, return the intervening segment(s).
   ///
   /// `start` and `end` are clamped to legal values (0..[length])
@@ -3030,6 +3043,17 @@ class _PathMeasure extends NativeFieldWrapperClass1 {
   @FfiNative<Handle Function(Pointer<Void>, Int32, Float)>('PathMeasure::getPosTan')
   external Float32List _getPosTan(int contourIndex, double distance);
 
+  Float32List getPosTanList(int contourIndex, Float32List distances) {
+    assert(contourIndex <= currentContourIndex,
+        'Iterator must be advanced before index $contourIndex can be used.');
+    final Float32List posTan = Float32List(distances.length * 5);
+    _getPosTans(contourIndex, distances, posTan);
+    return posTan;
+  }
+
+  @FfiNative<Void Function(Pointer<Void>, Int32, Handle, Handle)>('PathMeasure::getPosTans')
+  external void _getPosTans(int contourIndex, Float32List distances, Float32List posTan);
+
   Path extractPath(int contourIndex, double start, double end,
       {bool startWithMoveTo = true}) {
     assert(contourIndex <= currentContourIndex, 'Iterator must be advanced before index $contourIndex can be used.');
@@ -5256,6 +5280,45 @@ class Canvas extends NativeFieldWrapperClass1 {
   @FfiNative<Void Function(Pointer<Void>, Handle, Handle, Int32, Handle)>('Canvas::drawPoints')
   external void _drawPoints(List<Object?>? paintObjects, ByteData paintData, int pointMode, Float32List points);
 
+  /// Replays a batch of packed drawing commands with a single call into the
+  /// engine.
+  ///
+  /// The `commands` list is a sequence of commands, each encoded as an opcode
+  /// followed by its arguments:
+  ///
+  ///  * 0: save (no arguments)
+  ///  * 1: restore (no arguments)
+  ///  * 2: translate (dx, dy)
+  ///  * 3: scale (sx, sy)
+  ///  * 4: rotate (radians)
+  ///  * 5: skew (sx, sy)
+  ///  * 6: clipRect (left, top, right, bottom, clipOp, doAntiAlias)
+  ///  * 7: drawRect (left, top, right, bottom)
+  ///  * 8: drawOval (left, top, right, bottom)
+  ///  * 9: drawCircle (x, y, radius)
+  ///  * 10: drawLine (x1, y1, x2, y2)
+  ///  * 11: drawArc (left, top, right, bottom, startAngle, sweepAngle,
+  ///    useCenter)
+  ///  * 12: drawRRect (left, top, right, bottom, followed by the x and y
+  ///    radii of the top-left, top-right, bottom-right and bottom-left
+  ///    corners)
+  ///
+  /// Boolean arguments are encoded as 0 (false) or 1 (true), and `clipOp` is
+  /// a [ClipOp] index. All drawing commands use the given [paint]. Custom
+  /// painters that issue many simple commands per frame can use this to
+  /// amortize the per-call overhead of the individual [Canvas] methods.
+  ///
+  /// Throws if the buffer contains an unknown opcode or is truncated
+  /// mid-command.
+  void drawRawCommands(Float32List commands, Paint paint) {
+    assert(commands != null);
+    assert(paint != null);
+    _drawCommands(paint._objects, paint._data, commands);
+  }
+
+  @FfiNative<Void Function(Pointer<Void>, Handle, Handle, Handle)>('Canvas::drawCommands')
+  external void _drawCommands(List<Object?>? paintObjects, ByteData paintData, Float32List commands);
+
   /// Draws the set of [Vertices] onto the canvas.
   ///
   /// The [blendMode] parameter is used to control how the colors in
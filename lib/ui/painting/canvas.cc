@@ -529,6 +529,120 @@ void Canvas::drawPoints(Dart_Handle paint_objects,
   }
 }
 
+namespace {
+
+// Opcodes understood by Canvas::drawCommands. These must be kept in sync
+// with the encoding documented on Canvas.drawRawCommands in painting.dart.
+enum CanvasCommandOp {
+  kCommandSave = 0,
+  kCommandRestore = 1,
+  kCommandTranslate = 2,
+  kCommandScale = 3,
+  kCommandRotate = 4,
+  kCommandSkew = 5,
+  kCommandClipRect = 6,
+  kCommandDrawRect = 7,
+  kCommandDrawOval = 8,
+  kCommandDrawCircle = 9,
+  kCommandDrawLine = 10,
+  kCommandDrawArc = 11,
+  kCommandDrawRRect = 12,
+};
+
+// Number of arguments following each opcode, indexed by opcode.
+constexpr int kCommandArgCounts[] = {0, 0, 2, 2, 1, 2, 6, 4, 4, 3, 4, 7, 12};
+
+}  // namespace
+
+void Canvas::drawCommands(Dart_Handle paint_objects,
+                          Dart_Handle paint_data,
+                          const tonic::Float32List& commands) {
+  Paint paint(paint_objects, paint_data);
+
+  FML_DCHECK(paint.isNotNull());
+  if (!display_list_recorder_) {
+    return;
+  }
+  const float* data = commands.data();
+  int length = commands.num_elements();
+  int i = 0;
+  while (i < length) {
+    int op = static_cast<int>(data[i]);
+    if (op < kCommandSave || op > kCommandDrawRRect ||
+        i + 1 + kCommandArgCounts[op] > length) {
+      Dart_ThrowException(
+          ToDart("Canvas.drawRawCommands called with a malformed buffer."));
+      return;
+    }
+    const float* args = data + i + 1;
+    i += 1 + kCommandArgCounts[op];
+    switch (op) {
+      case kCommandSave:
+        builder()->save();
+        break;
+      case kCommandRestore:
+        builder()->restore();
+        break;
+      case kCommandTranslate:
+        builder()->translate(args[0], args[1]);
+        break;
+      case kCommandScale:
+        builder()->scale(args[0], args[1]);
+        break;
+      case kCommandRotate:
+        builder()->rotate(args[0] * 180.0 / M_PI);
+        break;
+      case kCommandSkew:
+        builder()->skew(args[0], args[1]);
+        break;
+      case kCommandClipRect:
+        builder()->clipRect(
+            SkRect::MakeLTRB(args[0], args[1], args[2], args[3]),
+            static_cast<SkClipOp>(static_cast<int>(args[4])), args[5] != 0);
+        break;
+      case kCommandDrawRect:
+        paint.sync_to(builder(), kDrawRectFlags);
+        builder()->drawRect(
+            SkRect::MakeLTRB(args[0], args[1], args[2], args[3]));
+        break;
+      case kCommandDrawOval:
+        paint.sync_to(builder(), kDrawOvalFlags);
+        builder()->drawOval(
+            SkRect::MakeLTRB(args[0], args[1], args[2], args[3]));
+        break;
+      case kCommandDrawCircle:
+        paint.sync_to(builder(), kDrawCircleFlags);
+        builder()->drawCircle(SkPoint::Make(args[0], args[1]), args[2]);
+        break;
+      case kCommandDrawLine:
+        paint.sync_to(builder(), kDrawLineFlags);
+        builder()->drawLine(SkPoint::Make(args[0], args[1]),
+                            SkPoint::Make(args[2], args[3]));
+        break;
+      case kCommandDrawArc:
+        paint.sync_to(builder(), args[6] != 0  //
+                                     ? kDrawArcWithCenterFlags
+                                     : kDrawArcNoCenterFlags);
+        builder()->drawArc(SkRect::MakeLTRB(args[0], args[1], args[2], args[3]),
+                           args[4] * 180.0 / M_PI, args[5] * 180.0 / M_PI,
+                           args[6] != 0);
+        break;
+      case kCommandDrawRRect: {
+        paint.sync_to(builder(), kDrawRRectFlags);
+        SkVector radii[4] = {{args[4], args[5]},
+                             {args[6], args[7]},
+                             {args[8], args[9]},
+                             {args[10], args[11]}};
+        SkRRect rrect;
+        rrect.setRectRadii(SkRect::MakeLTRB(args[0], args[1], args[2], args[3]),
+                           radii);
+        builder()->drawRRect(rrect);
+        break;
+      }
+    }
+  }
+}
+
 void Canvas::drawVertices(const Vertices* vertices,
                           DlBlendMode blend_mode,
                           Dart_Handle paint_objects,
@@ -167,6 +167,14 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
                   SkCanvas::PointMode point_mode,
                   const tonic::Float32List& points);
 
+  // Replays a batch of packed draw commands sharing a single paint with one
+  // native call. The buffer is a sequence of opcodes, each followed by its
+  // arguments; see the opcode table in canvas.cc and the encoding
+  // documentation on Canvas.drawRawCommands in painting.dart.
+  void drawCommands(Dart_Handle paint_objects,
+                    Dart_Handle paint_data,
+                    const tonic::Float32List& commands);
+
   void drawVertices(const Vertices* vertices,
                     DlBlendMode blend_mode,
                     Dart_Handle paint_objects,
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <utility>
 
 #include "flutter/lib/ui/painting/image_encoding.h"
 #include "third_party/tonic/converter/dart_converter.h"
@@ -27,15 +28,38 @@ const tonic::DartWrapperInfo& Image::dart_wrapper_info_ =
 
 CanvasImage::CanvasImage() = default;
 
-CanvasImage::~CanvasImage() = default;
+CanvasImage::~CanvasImage() {
+  if (allocation_bytes_attributed_ != 0) {
+    if (auto* state = UIDartState::Current()) {
+      state->AdjustAllocationBytes(UIDartState::AllocationCategory::kImage,
+                                   -allocation_bytes_attributed_);
+    }
+  }
+}
 
 Dart_Handle CanvasImage::toByteData(int format, Dart_Handle callback) {
   return EncodeImage(this, format, callback);
 }
 
+void CanvasImage::set_image(sk_sp<DlImage> image) {
+  image_ = std::move(image);
+  UpdateAttributedBytes();
+}
+
 void CanvasImage::dispose() {
   image_.reset();
+  UpdateAttributedBytes();
   ClearDartWrapper();
 }
 
+void CanvasImage::UpdateAttributedBytes() {
+  int64_t bytes =
+      image_ ? static_cast<int64_t>(image_->GetApproximateByteSize()) : 0;
+  if (auto* state = UIDartState::Current()) {
+    state->AdjustAllocationBytes(UIDartState::AllocationCategory::kImage,
+                                 bytes - allocation_bytes_attributed_);
+    allocation_bytes_attributed_ = bytes;
+  }
+}
+
 }  // namespace flutter
@@ -35,12 +35,20 @@ class CanvasImage final : public RefCountedDartWrappable<CanvasImage> {
 
   sk_sp<DlImage> image() const { return image_; }
 
-  void set_image(sk_sp<DlImage> image) { image_ = image; }
+  void set_image(sk_sp<DlImage> image);
 
  private:
   CanvasImage();
 
+  // Reconciles the owning isolate's image allocation counter with the
+  // approximate size of the currently held image.
+  void UpdateAttributedBytes();
+
   sk_sp<DlImage> image_;
+
+  // Bytes currently attributed to the owning isolate's image allocation
+  // counter for this wrapper.
+  int64_t allocation_bytes_attributed_ = 0;
 };
 
 }  // namespace flutter
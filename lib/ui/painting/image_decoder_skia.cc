@@ -5,13 +5,134 @@
 #include "flutter/lib/ui/painting/image_decoder_skia.h"
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
 #include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/lib/ui/painting/display_list_image_gpu.h"
+#include "third_party/skia/include/core/SkCanvas.h"
 
 namespace flutter {
 
+namespace {
+
+// Destination images at least this large are resampled in row strips spread
+// across the concurrent worker pool instead of in one pass on the decoding
+// worker.
+constexpr int64_t kParallelResizeMinDstPixels = 1 << 21;
+
+// The minimum number of destination rows worth handing to a worker. Strips
+// smaller than this are dominated by scheduling overhead.
+constexpr int kParallelResizeMinStripRows = 64;
+
+// Resample |image| into the rows [strip_top, strip_bottom) of |dst_pixmap|.
+// Every strip draws the same full-size image-to-destination mapping with a
+// translated origin, so the samples match a single-pass resample exactly and
+// strips join without seams.
+bool ResizeImageStrip(const sk_sp<SkImage>& image,
+                      const SkPixmap& dst_pixmap,
+                      int strip_top,
+                      int strip_bottom) {
+  SkPixmap strip;
+  if (!dst_pixmap.extractSubset(&strip,
+                                SkIRect::MakeLTRB(0, strip_top,
+                                                  dst_pixmap.width(),
+                                                  strip_bottom))) {
+    return false;
+  }
+
+  auto canvas = SkCanvas::MakeRasterDirect(strip.info(), strip.writable_addr(),
+                                           strip.rowBytes());
+  if (!canvas) {
+    return false;
+  }
+
+  canvas->translate(0, -strip_top);
+  canvas->drawImageRect(
+      image,
+      SkRect::MakeIWH(dst_pixmap.width(), dst_pixmap.height()),
+      SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kNone));
+  return true;
+}
+
+// Shared state for a strip-parallel resample. Strips are claimed with an
+// atomic index, so the decoding worker makes progress on its own even if the
+// pool is saturated and the helper tasks never run; the helpers simply find
+// no strips left to claim.
+struct ParallelResizeJob {
+  ParallelResizeJob(sk_sp<SkImage> p_image,
+                    const SkPixmap& p_dst_pixmap,
+                    int p_strip_count,
+                    int p_strip_rows)
+      : image(std::move(p_image)),
+        dst_pixmap(p_dst_pixmap),
+        strip_count(p_strip_count),
+        strip_rows(p_strip_rows),
+        latch(p_strip_count) {}
+
+  const sk_sp<SkImage> image;
+  const SkPixmap dst_pixmap;
+  const int strip_count;
+  const int strip_rows;
+  std::atomic<int> next_strip{0};
+  std::atomic<bool> all_strips_ok{true};
+  fml::CountDownLatch latch;
+
+  void RunStrips() {
+    int strip;
+    while ((strip = next_strip.fetch_add(1)) < strip_count) {
+      const int top = strip * strip_rows;
+      const int bottom = strip == strip_count - 1 ? dst_pixmap.height()
+                                                  : top + strip_rows;
+      if (!ResizeImageStrip(image, dst_pixmap, top, bottom)) {
+        all_strips_ok = false;
+      }
+      latch.CountDown();
+    }
+  }
+};
+
+// Resample |image| into |dst_pixmap|, spreading the work across the worker
+// pool for large destinations when a pool is available.
+bool ResizePixmapFromImage(
+    const sk_sp<SkImage>& image,
+    const SkPixmap& dst_pixmap,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker_pool) {
+  const int64_t dst_pixels =
+      static_cast<int64_t>(dst_pixmap.width()) * dst_pixmap.height();
+
+  int strip_count = 0;
+  if (worker_pool && dst_pixels >= kParallelResizeMinDstPixels) {
+    const int worker_bound =
+        std::max(1u, std::thread::hardware_concurrency());
+    const int row_bound = dst_pixmap.height() / kParallelResizeMinStripRows;
+    strip_count = std::min(worker_bound, row_bound);
+  }
+
+  if (strip_count < 2) {
+    return image->scalePixels(
+        dst_pixmap, SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kNone),
+        SkImage::kDisallow_CachingHint);
+  }
+
+  TRACE_EVENT0("flutter", "ParallelResizeRasterImage");
+
+  const int strip_rows = dst_pixmap.height() / strip_count;
+  auto job = std::make_shared<ParallelResizeJob>(image, dst_pixmap,
+                                                 strip_count, strip_rows);
+  for (int i = 1; i < strip_count; i++) {
+    worker_pool->PostTask([job]() { job->RunStrips(); });
+  }
+  job->RunStrips();
+  job->latch.Wait();
+
+  return job->all_strips_ok;
+}
+
+}  // namespace
+
 ImageDecoderSkia::ImageDecoderSkia(
     const TaskRunners& runners,
     std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner,
@@ -22,9 +143,11 @@ ImageDecoderSkia::ImageDecoderSkia(
 
 ImageDecoderSkia::~ImageDecoderSkia() = default;
 
-static sk_sp<SkImage> ResizeRasterImage(const sk_sp<SkImage>& image,
-                                        const SkISize& resized_dimensions,
-                                        const fml::tracing::TraceFlow& flow) {
+static sk_sp<SkImage> ResizeRasterImage(
+    const sk_sp<SkImage>& image,
+    const SkISize& resized_dimensions,
+    const fml::tracing::TraceFlow& flow,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker_pool = nullptr) {
   FML_DCHECK(!image->isTextureBacked());
 
   TRACE_EVENT0("flutter", __FUNCTION__);
@@ -49,10 +172,7 @@ static sk_sp<SkImage> ResizeRasterImage(const sk_sp<SkImage>& image,
     return nullptr;
   }
 
-  if (!image->scalePixels(
-          scaled_bitmap.pixmap(),
-          SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kNone),
-          SkImage::kDisallow_CachingHint)) {
+  if (!ResizePixmapFromImage(image, scaled_bitmap.pixmap(), worker_pool)) {
     FML_LOG(ERROR) << "Could not scale pixels";
     return nullptr;
   }
@@ -74,7 +194,8 @@ static sk_sp<SkImage> ImageFromDecompressedData(
     ImageDescriptor* descriptor,
     uint32_t target_width,
     uint32_t target_height,
-    const fml::tracing::TraceFlow& flow) {
+    const fml::tracing::TraceFlow& flow,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker_pool) {
   TRACE_EVENT0("flutter", __FUNCTION__);
   flow.Step(__FUNCTION__);
   auto image = SkImage::MakeRasterData(
@@ -91,14 +212,15 @@ static sk_sp<SkImage> ImageFromDecompressedData(
   }
 
   return ResizeRasterImage(image, SkISize::Make(target_width, target_height),
-                           flow);
+                           flow, worker_pool);
 }
 
 sk_sp<SkImage> ImageDecoderSkia::ImageFromCompressedData(
     ImageDescriptor* descriptor,
     uint32_t target_width,
     uint32_t target_height,
-    const fml::tracing::TraceFlow& flow) {
+    const fml::tracing::TraceFlow& flow,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker_pool) {
   TRACE_EVENT0("flutter", __FUNCTION__);
   flow.Step(__FUNCTION__);
 
@@ -144,7 +266,8 @@ sk_sp<SkImage> ImageDecoderSkia::ImageFromCompressedData(
             << "Could not create a scaled image from a scaled bitmap.";
         return nullptr;
       }
-      return ResizeRasterImage(decoded_image, resized_dimensions, flow);
+      return ResizeRasterImage(decoded_image, resized_dimensions, flow,
+                               worker_pool);
     }
   }
 
@@ -153,7 +276,7 @@ sk_sp<SkImage> ImageDecoderSkia::ImageFromCompressedData(
     return nullptr;
   }
 
-  return ResizeRasterImage(image, resized_dimensions, flow);
+  return ResizeRasterImage(image, resized_dimensions, flow, worker_pool);
 }
 
 static SkiaGPUObject<SkImage> UploadRasterImage(
@@ -264,6 +387,7 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
       fml::MakeCopyable([raw_descriptor,                          //
                          io_manager = io_manager_,                //
                          io_runner = runners_.GetIOTaskRunner(),  //
+                         worker_pool = concurrent_task_runner_,   //
                          result,                                  //
                          target_width = target_width,             //
                          target_height = target_height,           //
@@ -272,15 +396,18 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
         // Step 1: Decompress the image.
         // On Worker.
 
-        auto decompressed = raw_descriptor->is_compressed()
-                                ? ImageFromCompressedData(raw_descriptor,  //
-                                                          target_width,    //
-                                                          target_height,   //
-                                                          flow)
-                                : ImageFromDecompressedData(raw_descriptor,  //
-                                                            target_width,    //
-                                                            target_height,   //
-                                                            flow);
+        auto decompressed =
+            raw_descriptor->is_compressed()
+                ? ImageFromCompressedData(raw_descriptor,  //
+                                          target_width,    //
+                                          target_height,   //
+                                          flow,            //
+                                          worker_pool)
+                : ImageFromDecompressedData(raw_descriptor,  //
+                                            target_width,    //
+                                            target_height,   //
+                                            flow,            //
+                                            worker_pool);
 
         if (!decompressed) {
           FML_DLOG(ERROR) << "Could not decompress image.";
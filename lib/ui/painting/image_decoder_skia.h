@@ -25,11 +25,15 @@ class ImageDecoderSkia final : public ImageDecoder {
               uint32_t target_height,
               const ImageResult& result) override;
 
+  /// The optional worker pool is used to spread the resample of large decoded
+  /// images across workers; when null, the resample happens on the calling
+  /// thread.
   static sk_sp<SkImage> ImageFromCompressedData(
       ImageDescriptor* descriptor,
       uint32_t target_width,
       uint32_t target_height,
-      const fml::tracing::TraceFlow& flow);
+      const fml::tracing::TraceFlow& flow,
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& worker_pool = nullptr);
 
  private:
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoderSkia);
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "flutter/lib/ui/painting/image_generator_registry.h"
 #include "third_party/skia/include/codec/SkCodec.h"
@@ -48,7 +49,15 @@ ImageGeneratorRegistry::~ImageGeneratorRegistry() = default;
 
 void ImageGeneratorRegistry::AddFactory(ImageGeneratorFactory factory,
                                         int32_t priority) {
-  image_generator_factories_.insert({std::move(factory), priority, ++nonce_});
+  AddFactory(std::move(factory), priority, nullptr);
+}
+
+void ImageGeneratorRegistry::AddFactory(
+    ImageGeneratorFactory factory,
+    int32_t priority,
+    ImageGeneratorCapabilityCallback capability) {
+  image_generator_factories_.insert(
+      {std::move(factory), std::move(capability), priority, ++nonce_});
 }
 
 std::shared_ptr<ImageGenerator>
@@ -62,8 +71,32 @@ ImageGeneratorRegistry::CreateCompatibleGenerator(const sk_sp<SkData>& buffer) {
            "file a bug on https://github.com/flutter/flutter/issues.";
   }
 
+  // Score every factory for this specific buffer. Factories without a
+  // capability callback compete with their registration priority, so the
+  // original priority ordering is preserved among them.
+  std::vector<std::pair<int32_t, const PrioritizedFactory*>> candidates;
+  candidates.reserve(image_generator_factories_.size());
   for (auto& factory : image_generator_factories_) {
-    std::shared_ptr<ImageGenerator> result = factory.callback(buffer);
+    int32_t score = factory.priority;
+    if (factory.capability) {
+      score = factory.capability(buffer);
+      if (score == kCannotDecode) {
+        continue;
+      }
+    }
+    candidates.emplace_back(score, &factory);
+  }
+
+  // The set already iterates in descending priority (then registration)
+  // order, so a stable sort keeps that as the tie breaker between factories
+  // with equal scores.
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const auto& lhs, const auto& rhs) {
+                     return lhs.first > rhs.first;
+                   });
+
+  for (const auto& candidate : candidates) {
+    std::shared_ptr<ImageGenerator> result = candidate.second->callback(buffer);
     if (result) {
       return result;
     }
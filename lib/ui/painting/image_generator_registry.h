@@ -6,6 +6,7 @@
 #define FLUTTER_LIB_UI_PAINTING_IMAGE_GENERATOR_REGISTRY_H_
 
 #include <functional>
+#include <limits>
 #include <set>
 
 #include "flutter/fml/mapping.h"
@@ -21,12 +22,30 @@ namespace flutter {
 using ImageGeneratorFactory =
     std::function<std::shared_ptr<ImageGenerator>(sk_sp<SkData> buffer)>;
 
+/// @brief  Scores how well a factory's decoder handles a particular encoded
+///         buffer, before any generator is constructed. Implementations
+///         typically sniff the container format and dimensions from the
+///         buffer's header and answer with a score informed by offline
+///         benchmarks of their decoder — e.g. a hardware AVIF decoder answers
+///         a high score for AVIF buffers of the size classes it wins at and
+///         `ImageGeneratorRegistry::kCannotDecode` for everything else.
+///         The highest scoring factory is tried first; factories registered
+///         without a capability callback compete with their registration
+///         priority as their score.
+using ImageGeneratorCapabilityCallback =
+    std::function<int32_t(const sk_sp<SkData>& buffer)>;
+
 /// @brief Keeps a priority-ordered registry of image generator builders to be
 ///        used when decoding images. This object must be created, accessed, and
 ///        collected on the UI thread (typically the engine or its runtime
 ///        controller).
 class ImageGeneratorRegistry {
  public:
+  /// Score returned by an `ImageGeneratorCapabilityCallback` whose decoder
+  /// cannot handle the given buffer at all; the factory is skipped without
+  /// being constructed.
+  static constexpr int32_t kCannotDecode = std::numeric_limits<int32_t>::min();
+
   ImageGeneratorRegistry();
 
   ~ImageGeneratorRegistry();
@@ -44,6 +63,24 @@ class ImageGeneratorRegistry {
   /// @see        `CreateCompatibleGenerator`
   void AddFactory(ImageGeneratorFactory factory, int32_t priority);
 
+  /// @brief      Install a new factory for image generators along with a
+  ///             capability callback that scores the factory's decoder for
+  ///             each individual buffer. This lets an embedder register a
+  ///             format specific decoder (e.g. SIMD or hardware accelerated)
+  ///             that wins selection only for the buffers it is actually
+  ///             fastest at, instead of globally outprioritizing the builtin
+  ///             decoders.
+  /// @param[in]  factory     Callback that produces `ImageGenerator`s for
+  ///                         compatible input data.
+  /// @param[in]  priority    Tie breaker when multiple factories score the
+  ///                         same for a buffer, and the score used when the
+  ///                         capability callback is null.
+  /// @param[in]  capability  Scores the factory's decoder for a given buffer.
+  /// @see        `ImageGeneratorCapabilityCallback`
+  void AddFactory(ImageGeneratorFactory factory,
+                  int32_t priority,
+                  ImageGeneratorCapabilityCallback capability);
+
   /// @brief      Walks the list of image generator builders in descending
   ///             priority order until a compatible `ImageGenerator` is able to
   ///             be built. This method is safe to perform on the UI thread, as
@@ -63,6 +100,9 @@ class ImageGeneratorRegistry {
  private:
   struct PrioritizedFactory {
     ImageGeneratorFactory callback;
+    // Optionally scores the factory per buffer; see
+    // `ImageGeneratorCapabilityCallback`.
+    ImageGeneratorCapabilityCallback capability;
 
     int32_t priority = 0;
     // Used as a fallback priority comparison when equal.
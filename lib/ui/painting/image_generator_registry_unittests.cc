@@ -129,6 +129,49 @@ TEST_F(ShellTest, DefaultGeneratorsTakePrecedentOverZeroPriority) {
   ASSERT_EQ(result->GetInfo().width(), 3024);
 }
 
+TEST_F(ShellTest, CapabilityScoreWinsSelectionForBuffersItClaims) {
+  ImageGeneratorRegistry registry;
+
+  // A "hardware" decoder registered at a modest priority, but which scores
+  // highly for every buffer it sees.
+  registry.AddFactory(
+      [](const sk_sp<SkData>& buffer) {
+        return std::make_unique<FakeImageGenerator>(1337);
+      },
+      1, [](const sk_sp<SkData>& buffer) { return 100; });
+
+  // A higher-priority factory without a capability callback competes with its
+  // registration priority and loses.
+  registry.AddFactory(
+      [](const sk_sp<SkData>& buffer) {
+        return std::make_unique<FakeImageGenerator>(7777);
+      },
+      50);
+
+  auto result = registry.CreateCompatibleGenerator(SkData::MakeEmpty());
+  ASSERT_EQ(result->GetInfo().width(), 1337);
+}
+
+TEST_F(ShellTest, FactoriesReportingCannotDecodeAreSkipped) {
+  ImageGeneratorRegistry registry;
+
+  registry.AddFactory(
+      [](const sk_sp<SkData>& buffer) {
+        return std::make_unique<FakeImageGenerator>(1337);
+      },
+      100, [](const sk_sp<SkData>& buffer) {
+        return ImageGeneratorRegistry::kCannotDecode;
+      });
+  registry.AddFactory(
+      [](const sk_sp<SkData>& buffer) {
+        return std::make_unique<FakeImageGenerator>(7777);
+      },
+      1);
+
+  auto result = registry.CreateCompatibleGenerator(SkData::MakeEmpty());
+  ASSERT_EQ(result->GetInfo().width(), 7777);
+}
+
 TEST_F(ShellTest, ImageGeneratorsWithSamePriorityCascadeChronologically) {
   ImageGeneratorRegistry registry;
 
@@ -72,8 +72,10 @@ Dart_Handle ImmutableBuffer::initFromAsset(Dart_Handle buffer_handle,
   }
 
   auto size = data->GetSize();
-  const void* bytes = static_cast<const void*>(data->GetMapping());
-  auto sk_data = MakeSkDataWithCopy(bytes, size);
+  auto sk_data = MakeSkDataFromMapping(std::move(data));
+  if (sk_data == nullptr) {
+    return tonic::ToDart("Asset could not be mapped");
+  }
   auto buffer = fml::MakeRefCounted<ImmutableBuffer>(sk_data);
   buffer->AssociateWithDartWrapper(buffer_handle);
   tonic::DartInvoke(callback_handle, {tonic::ToDart(size)});
@@ -135,8 +137,7 @@ Dart_Handle ImmutableBuffer::initFromFile(Dart_Handle raw_buffer_handle,
         size_t buffer_size = 0;
         if (mapping->IsValid()) {
           buffer_size = mapping->GetSize();
-          const void* bytes = static_cast<const void*>(mapping->GetMapping());
-          sk_data = MakeSkDataWithCopy(bytes, buffer_size);
+          sk_data = MakeSkDataFromMapping(std::move(mapping));
         }
         ui_task_runner->PostTask(
             [sk_data = std::move(sk_data), ui_task = ui_task, buffer_size]() {
@@ -191,4 +192,27 @@ sk_sp<SkData> ImmutableBuffer::MakeSkDataWithCopy(const void* data,
 
 #endif  // FML_OS_ANDROID
 
+sk_sp<SkData> ImmutableBuffer::MakeSkDataFromMapping(
+    std::unique_ptr<fml::Mapping> mapping) {
+  FML_DCHECK(mapping);
+  if (mapping->GetSize() == 0) {
+    return SkData::MakeEmpty();
+  }
+
+  const void* bytes = static_cast<const void*>(mapping->GetMapping());
+  if (bytes == nullptr) {
+    return nullptr;
+  }
+
+  // Note that unlike MakeSkDataWithCopy, no anonymous mapping workaround is
+  // needed here on Android: the bytes stay in the mapping that backed them,
+  // so no malloc'd block crosses threads.
+  SkData::ReleaseProc proc = [](const void* ptr, void* context) {
+    delete static_cast<fml::Mapping*>(context);
+  };
+
+  const size_t size = mapping->GetSize();
+  return SkData::MakeWithProc(bytes, size, proc, mapping.release());
+}
+
 }  // namespace flutter
@@ -6,8 +6,10 @@
 #define FLUTTER_LIB_UI_PAINTNIG_IMMUTABLE_BUFER_H_
 
 #include <cstdint>
+#include <memory>
 
 #include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/tonic/dart_library_natives.h"
@@ -96,6 +98,13 @@ class ImmutableBuffer : public RefCountedDartWrappable<ImmutableBuffer> {
 
   static sk_sp<SkData> MakeSkDataWithCopy(const void* data, size_t length);
 
+  /// Wraps the mapping as SkData without copying the bytes. The release proc
+  /// keeps the mapping alive until the last reference to the data is dropped,
+  /// so mmap backed mappings cost address space instead of pages. Returns
+  /// nullptr if the mapping has no address.
+  static sk_sp<SkData> MakeSkDataFromMapping(
+      std::unique_ptr<fml::Mapping> mapping);
+
   DEFINE_WRAPPERTYPEINFO();
   FML_FRIEND_MAKE_REF_COUNTED(ImmutableBuffer);
   FML_DISALLOW_COPY_AND_ASSIGN(ImmutableBuffer);
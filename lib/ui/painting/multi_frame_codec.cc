@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/painting/image.h"
 #if IMPELLER_SUPPORTS_RENDERING
 #include "flutter/lib/ui/painting/image_decoder_impeller.h"
@@ -82,11 +83,8 @@ static bool CopyToBitmap(SkBitmap* dst,
   return true;
 }
 
-sk_sp<DlImage> MultiFrameCodec::State::GetNextFrameImage(
-    fml::WeakPtr<GrDirectContext> resourceContext,
-    const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
-    std::shared_ptr<impeller::Context> impeller_context_,
-    fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue) {
+bool MultiFrameCodec::State::DecodeFrameBitmap(int frame_index,
+                                               SkBitmap* bitmap_out) {
   SkBitmap bitmap = SkBitmap();
   SkImageInfo info = generator_->GetInfo().makeColorType(kN32_SkColorType);
   if (info.alphaType() == kUnpremul_SkAlphaType) {
@@ -95,8 +93,7 @@ sk_sp<DlImage> MultiFrameCodec::State::GetNextFrameImage(
   }
   bitmap.allocPixels(info);
 
-  ImageGenerator::FrameInfo frameInfo =
-      generator_->GetFrameInfo(nextFrameIndex_);
+  ImageGenerator::FrameInfo frameInfo = generator_->GetFrameInfo(frame_index);
 
   const int requiredFrameIndex =
       frameInfo.required_frame.value_or(SkCodec::kNoFrame);
@@ -104,10 +101,10 @@ sk_sp<DlImage> MultiFrameCodec::State::GetNextFrameImage(
 
   if (requiredFrameIndex != SkCodec::kNoFrame) {
     if (lastRequiredFrame_ == nullptr) {
-      FML_LOG(ERROR) << "Frame " << nextFrameIndex_ << " depends on frame "
+      FML_LOG(ERROR) << "Frame " << frame_index << " depends on frame "
                      << requiredFrameIndex
                      << " and no required frames are cached.";
-      return nullptr;
+      return false;
     } else if (lastRequiredFrameIndex_ != requiredFrameIndex) {
       FML_DLOG(INFO) << "Required frame " << requiredFrameIndex
                      << " is not cached. Using " << lastRequiredFrameIndex_
@@ -122,17 +119,131 @@ sk_sp<DlImage> MultiFrameCodec::State::GetNextFrameImage(
   }
 
   if (!generator_->GetPixels(info, bitmap.getPixels(), bitmap.rowBytes(),
-                             nextFrameIndex_, requiredFrameIndex)) {
-    FML_LOG(ERROR) << "Could not getPixels for frame " << nextFrameIndex_;
-    return nullptr;
+                             frame_index, requiredFrameIndex)) {
+    FML_LOG(ERROR) << "Could not getPixels for frame " << frame_index;
+    return false;
   }
 
   // Hold onto this if we need it to decode future frames.
   if (frameInfo.disposal_method == SkCodecAnimation::DisposalMethod::kKeep) {
     lastRequiredFrame_ = std::make_unique<SkBitmap>(bitmap);
-    lastRequiredFrameIndex_ = nextFrameIndex_;
+    lastRequiredFrameIndex_ = frame_index;
+  }
+
+  *bitmap_out = bitmap;
+  return true;
+}
+
+bool MultiFrameCodec::State::TakeCachedFrame(int frame_index,
+                                             SkBitmap* bitmap) {
+  auto found = frame_cache_.find(frame_index);
+  if (found == frame_cache_.end()) {
+    return false;
+  }
+  *bitmap = std::move(found->second.bitmap);
+  frame_cache_bytes_ -= bitmap->computeByteSize();
+  frame_cache_lru_.erase(found->second.lru_position);
+  frame_cache_.erase(found);
+  return true;
+}
+
+void MultiFrameCodec::State::StoreCachedFrame(int frame_index,
+                                              const SkBitmap& bitmap) {
+  if (frame_cache_.count(frame_index) != 0) {
+    return;
+  }
+
+  const size_t bytes = bitmap.computeByteSize();
+  if (bytes > kFrameCacheByteBudget) {
+    return;
   }
 
+  // Evict the least recently used entries until the new frame fits.
+  while (frame_cache_bytes_ + bytes > kFrameCacheByteBudget &&
+         !frame_cache_lru_.empty()) {
+    auto victim = frame_cache_.find(frame_cache_lru_.back());
+    FML_DCHECK(victim != frame_cache_.end());
+    frame_cache_bytes_ -= victim->second.bitmap.computeByteSize();
+    frame_cache_.erase(victim);
+    frame_cache_lru_.pop_back();
+  }
+
+  frame_cache_lru_.push_front(frame_index);
+  frame_cache_[frame_index] =
+      CachedFrame{bitmap, frame_cache_lru_.begin()};
+  frame_cache_bytes_ += bytes;
+}
+
+void MultiFrameCodec::State::DecodeAhead(
+    const fml::RefPtr<fml::TaskRunner>& io_task_runner,
+    std::weak_ptr<State> weak_state) {
+  decode_ahead_pending_ = false;
+
+  for (int i = 0; i < kDecodeAheadFrameCount; i++) {
+    const int frame_index = (nextFrameIndex_ + i) % frameCount_;
+    if (frame_cache_.count(frame_index) != 0) {
+      continue;
+    }
+
+    TRACE_EVENT0("flutter", "MultiFrameCodecDecodeAhead");
+
+    SkBitmap bitmap;
+    if (!DecodeFrameBitmap(frame_index, &bitmap)) {
+      return;
+    }
+
+    const size_t cached_before = frame_cache_.size();
+    StoreCachedFrame(frame_index, bitmap);
+    if (frame_cache_.size() == cached_before) {
+      // The frame did not fit the byte budget; decoding further ahead would
+      // not fit either.
+      return;
+    }
+
+    // One frame per task so on-demand requests posted to the IO task runner
+    // are not starved; pick up the rest of the window afterwards.
+    if (i + 1 < kDecodeAheadFrameCount) {
+      ScheduleDecodeAhead(io_task_runner, std::move(weak_state));
+    }
+    return;
+  }
+}
+
+void MultiFrameCodec::State::ScheduleDecodeAhead(
+    const fml::RefPtr<fml::TaskRunner>& io_task_runner,
+    std::weak_ptr<State> weak_state) {
+  if (decode_ahead_pending_) {
+    return;
+  }
+  decode_ahead_pending_ = true;
+  io_task_runner->PostTask([io_task_runner, weak_state]() {
+    if (auto state = weak_state.lock()) {
+      state->DecodeAhead(io_task_runner, weak_state);
+    }
+  });
+}
+
+sk_sp<DlImage> MultiFrameCodec::State::GetNextFrameImage(
+    fml::WeakPtr<GrDirectContext> resourceContext,
+    const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
+    std::shared_ptr<impeller::Context> impeller_context_,
+    fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue) {
+  SkBitmap bitmap;
+  if (TakeCachedFrame(nextFrameIndex_, &bitmap)) {
+    cache_hit_count_++;
+  } else {
+    cache_miss_count_++;
+    if (!DecodeFrameBitmap(nextFrameIndex_, &bitmap)) {
+      return nullptr;
+    }
+  }
+
+  FML_TRACE_COUNTER("flutter", "MultiFrameCodecFrameCache",
+                    reinterpret_cast<int64_t>(this),               //
+                    "cacheHits", cache_hit_count_,                 //
+                    "cacheMisses", cache_miss_count_,              //
+                    "cacheBytes", frame_cache_bytes_);
+
 #if IMPELLER_SUPPORTS_RENDERING
   if (is_impeller_enabled_) {
     sk_sp<DlImage> result;
@@ -180,7 +291,9 @@ void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
     fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue,
     const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
     size_t trace_id,
-    std::shared_ptr<impeller::Context> impeller_context) {
+    std::shared_ptr<impeller::Context> impeller_context,
+    const fml::RefPtr<fml::TaskRunner>& io_task_runner,
+    std::weak_ptr<State> weak_state) {
   fml::RefPtr<CanvasImage> image = nullptr;
   int duration = 0;
   sk_sp<DlImage> dlImage =
@@ -195,6 +308,12 @@ void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
   }
   nextFrameIndex_ = (nextFrameIndex_ + 1) % frameCount_;
 
+  // With the current frame served, use IO task runner idle time to decode
+  // ahead of the playback position, including across the loop boundary.
+  if (frameCount_ > 1) {
+    ScheduleDecodeAhead(io_task_runner, std::move(weak_state));
+  }
+
   // The static leak checker gets confused by the use of fml::MakeCopyable.
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
   ui_task_runner->PostTask(fml::MakeCopyable([callback = std::move(callback),
@@ -232,6 +351,7 @@ Dart_Handle MultiFrameCodec::getNextFrame(Dart_Handle callback_handle) {
            tonic::DartState::Current(), callback_handle),
        weak_state = std::weak_ptr<MultiFrameCodec::State>(state_), trace_id,
        ui_task_runner = task_runners.GetUITaskRunner(),
+       io_task_runner = task_runners.GetIOTaskRunner(),
        io_manager = dart_state->GetIOManager()]() mutable {
         auto state = weak_state.lock();
         if (!state) {
@@ -243,7 +363,7 @@ Dart_Handle MultiFrameCodec::getNextFrame(Dart_Handle callback_handle) {
             std::move(callback), ui_task_runner,
             io_manager->GetResourceContext(), io_manager->GetSkiaUnrefQueue(),
             io_manager->GetIsGpuDisabledSyncSwitch(), trace_id,
-            io_manager->GetImpellerContext());
+            io_manager->GetImpellerContext(), io_task_runner, weak_state);
       }));
 
   return Dart_Null();
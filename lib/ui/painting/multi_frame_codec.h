@@ -5,6 +5,9 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_MUTLI_FRAME_CODEC_H_
 #define FLUTTER_LIB_UI_PAINTING_MUTLI_FRAME_CODEC_H_
 
+#include <list>
+#include <map>
+
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/painting/codec.h"
 #include "flutter/lib/ui/painting/image_generator.h"
@@ -41,6 +44,16 @@ class MultiFrameCodec : public Codec {
   struct State {
     explicit State(std::shared_ptr<ImageGenerator> generator);
 
+    // The number of frames decoded ahead of the last requested frame while
+    // the IO task runner is otherwise idle.
+    static constexpr int kDecodeAheadFrameCount = 2;
+
+    // Upper bound on the bytes retained by decoded frames awaiting
+    // consumption. Frames that would push the cache past the budget evict the
+    // least recently used entries; a frame larger than the entire budget is
+    // not cached at all.
+    static constexpr size_t kFrameCacheByteBudget = 24u * 1024 * 1024;
+
     const std::shared_ptr<ImageGenerator> generator_;
     const int frameCount_;
     const int repetitionCount_;
@@ -56,6 +69,42 @@ class MultiFrameCodec : public Codec {
     // The index of the last decoded required frame.
     int lastRequiredFrameIndex_ = -1;
 
+    // Decoded frames awaiting consumption, keyed by frame index. Entries are
+    // taken out of the cache when served and the least recently stored
+    // entries are evicted when the byte budget is exceeded.
+    struct CachedFrame {
+      SkBitmap bitmap;
+      std::list<int>::iterator lru_position;
+    };
+    std::map<int, CachedFrame> frame_cache_;
+    // Frame indices ordered most to least recently used.
+    std::list<int> frame_cache_lru_;
+    size_t frame_cache_bytes_ = 0;
+    size_t cache_hit_count_ = 0;
+    size_t cache_miss_count_ = 0;
+    bool decode_ahead_pending_ = false;
+
+    // Decode the bitmap for |frame_index|. Frames must be decoded in
+    // presentation order so that the required-frame state carried in
+    // |lastRequiredFrame_| matches what the codec expects.
+    bool DecodeFrameBitmap(int frame_index, SkBitmap* bitmap);
+
+    // Remove the cached frame for |frame_index| from the cache and move its
+    // bitmap into |bitmap|. Returns false when the frame is not cached.
+    bool TakeCachedFrame(int frame_index, SkBitmap* bitmap);
+
+    void StoreCachedFrame(int frame_index, const SkBitmap& bitmap);
+
+    // Decode at most one missing frame in the decode-ahead window and
+    // reschedule itself while frames in the window remain missing. Runs as an
+    // idle task on the IO task runner so on-demand frame requests are never
+    // queued behind more than a single ahead decode.
+    void DecodeAhead(const fml::RefPtr<fml::TaskRunner>& io_task_runner,
+                     std::weak_ptr<State> weak_state);
+
+    void ScheduleDecodeAhead(const fml::RefPtr<fml::TaskRunner>& io_task_runner,
+                             std::weak_ptr<State> weak_state);
+
     sk_sp<DlImage> GetNextFrameImage(
         fml::WeakPtr<GrDirectContext> resourceContext,
         const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
@@ -69,7 +118,9 @@ class MultiFrameCodec : public Codec {
         fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue,
         const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
         size_t trace_id,
-        std::shared_ptr<impeller::Context> impeller_context_);
+        std::shared_ptr<impeller::Context> impeller_context_,
+        const fml::RefPtr<fml::TaskRunner>& io_task_runner,
+        std::weak_ptr<State> weak_state);
   };
 
   // Shared across the UI and IO task runners.
@@ -28,15 +28,49 @@ CanvasPath::CanvasPath()
   resetVolatility();
 }
 
-CanvasPath::~CanvasPath() = default;
+CanvasPath::~CanvasPath() {
+  if (allocation_bytes_attributed_ != 0) {
+    if (auto* state = UIDartState::Current()) {
+      state->AdjustAllocationBytes(UIDartState::AllocationCategory::kPath,
+                                   -allocation_bytes_attributed_);
+    }
+  }
+}
 
 void CanvasPath::resetVolatility() {
   if (!tracked_path_->tracking_volatility) {
     mutable_path().setIsVolatile(true);
-    tracked_path_->frame_count = 0;
     tracked_path_->tracking_volatility = true;
     path_tracker_->Track(tracked_path_);
   }
+  // Any mutation invalidates previously measured contours.
+  contour_measures_[0].reset();
+  contour_measures_[1].reset();
+  UpdateAttributedBytes();
+}
+
+std::shared_ptr<const std::vector<sk_sp<SkContourMeasure>>>
+CanvasPath::contourMeasures(bool force_closed) const {
+  auto& cached = contour_measures_[force_closed ? 1 : 0];
+  if (!cached) {
+    auto measures = std::make_shared<std::vector<sk_sp<SkContourMeasure>>>();
+    SkContourMeasureIter iter(path(), force_closed, /*resScale=*/1);
+    while (auto measure = iter.next()) {
+      measures->push_back(std::move(measure));
+    }
+    cached = std::move(measures);
+  }
+  return cached;
+}
+
+void CanvasPath::UpdateAttributedBytes() {
+  int64_t bytes = static_cast<int64_t>(sizeof(CanvasPath) +
+                                       path().approximateBytesUsed());
+  if (auto* state = UIDartState::Current()) {
+    state->AdjustAllocationBytes(UIDartState::AllocationCategory::kPath,
+                                 bytes - allocation_bytes_attributed_);
+    allocation_bytes_attributed_ = bytes;
+  }
 }
 
 int CanvasPath::getFillType() {
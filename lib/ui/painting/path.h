@@ -5,10 +5,14 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_PATH_H_
 #define FLUTTER_LIB_UI_PAINTING_PATH_H_
 
+#include <memory>
+#include <vector>
+
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "flutter/lib/ui/painting/rrect.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/volatile_path_tracker.h"
+#include "third_party/skia/include/core/SkContourMeasure.h"
 #include "third_party/skia/include/core/SkPath.h"
 #include "third_party/skia/include/pathops/SkPathOps.h"
 #include "third_party/tonic/typed_data/typed_list.h"
@@ -26,6 +30,7 @@ class CanvasPath : public RefCountedDartWrappable<CanvasPath> {
     auto path = fml::MakeRefCounted<CanvasPath>();
     path->AssociateWithDartWrapper(path_handle);
     path->tracked_path_->path = src;
+    path->UpdateAttributedBytes();
   }
 
   static fml::RefPtr<CanvasPath> Create(Dart_Handle wrapper) {
@@ -111,6 +116,14 @@ class CanvasPath : public RefCountedDartWrappable<CanvasPath> {
 
   const SkPath& path() const { return tracked_path_->path; }
 
+  // Returns the measured contours of this path, measuring them on first use.
+  // The result is cached per forceClosed flag and invalidated whenever the
+  // path is mutated, so repeated measurement of a static path is a lookup.
+  // Callers may keep the returned vector alive past a subsequent mutation;
+  // the measures snapshot the geometry at measurement time.
+  std::shared_ptr<const std::vector<sk_sp<SkContourMeasure>>> contourMeasures(
+      bool force_closed) const;
+
  private:
   CanvasPath();
 
@@ -120,7 +133,22 @@ class CanvasPath : public RefCountedDartWrappable<CanvasPath> {
   // Must be called whenever the path is created or mutated.
   void resetVolatility();
 
+  // Reconciles the owning isolate's path allocation counter with the bytes
+  // currently used by the path. Called from resetVolatility so the counter
+  // tracks mutations.
+  void UpdateAttributedBytes();
+
   SkPath& mutable_path() { return tracked_path_->path; }
+
+  // Bytes currently attributed to the owning isolate's path allocation
+  // counter for this path.
+  int64_t allocation_bytes_attributed_ = 0;
+
+  // Cached contour measures, indexed by the forceClosed flag they were
+  // measured with. Cleared by resetVolatility whenever the path is mutated.
+  // Mutable so measuring a const path can populate the cache.
+  mutable std::shared_ptr<const std::vector<sk_sp<SkContourMeasure>>>
+      contour_measures_[2];
 };
 
 }  // namespace flutter
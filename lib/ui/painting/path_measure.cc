@@ -26,12 +26,12 @@ void CanvasPathMeasure::Create(Dart_Handle wrapper,
   fml::RefPtr<CanvasPathMeasure> pathMeasure =
       fml::MakeRefCounted<CanvasPathMeasure>();
   if (path) {
-    const SkPath skPath = path->path();
-    SkScalar resScale = 1;
-    pathMeasure->path_measure_ =
-        std::make_unique<SkContourMeasureIter>(skPath, forceClosed, resScale);
+    // The measures are cached on the path; re-measuring a path that has not
+    // been mutated since it was last measured is a lookup.
+    pathMeasure->contours_ = path->contourMeasures(forceClosed);
   } else {
-    pathMeasure->path_measure_ = std::make_unique<SkContourMeasureIter>();
+    pathMeasure->contours_ =
+        std::make_shared<std::vector<sk_sp<SkContourMeasure>>>();
   }
   pathMeasure->AssociateWithDartWrapper(wrapper);
 }
@@ -41,14 +41,13 @@ CanvasPathMeasure::CanvasPathMeasure() {}
 CanvasPathMeasure::~CanvasPathMeasure() {}
 
 void CanvasPathMeasure::setPath(const CanvasPath* path, bool isClosed) {
-  const SkPath& skPath = path->path();
-  path_measure_->reset(skPath, isClosed);
+  contours_ = path->contourMeasures(isClosed);
+  exposed_contours_ = 0;
 }
 
 float CanvasPathMeasure::getLength(int contour_index) {
-  if (static_cast<std::vector<sk_sp<SkContourMeasure>>::size_type>(
-          contour_index) < measures_.size()) {
-    return measures_[contour_index]->length();
+  if (static_cast<size_t>(contour_index) < exposed_contours_) {
+    return (*contours_)[contour_index]->length();
   }
   return -1;
 }
@@ -57,14 +56,13 @@ tonic::Float32List CanvasPathMeasure::getPosTan(int contour_index,
                                                 float distance) {
   tonic::Float32List posTan(Dart_NewTypedData(Dart_TypedData_kFloat32, 5));
   posTan[0] = 0;  // dart code will check for this for failure
-  if (static_cast<std::vector<sk_sp<SkContourMeasure>>::size_type>(
-          contour_index) >= measures_.size()) {
+  if (static_cast<size_t>(contour_index) >= exposed_contours_) {
     return posTan;
   }
 
   SkPoint pos;
   SkVector tan;
-  bool success = measures_[contour_index]->getPosTan(distance, &pos, &tan);
+  bool success = (*contours_)[contour_index]->getPosTan(distance, &pos, &tan);
 
   if (success) {
     posTan[0] = 1;  // dart code will check for this for success
@@ -77,18 +75,50 @@ tonic::Float32List CanvasPathMeasure::getPosTan(int contour_index,
   return posTan;
 }
 
+void CanvasPathMeasure::getPosTans(int contour_index,
+                                   Dart_Handle distances_handle,
+                                   Dart_Handle pos_tan_handle) {
+  tonic::Float32List distances(distances_handle);
+  tonic::Float32List pos_tan(pos_tan_handle);
+  int count = distances.num_elements();
+  if (pos_tan.num_elements() < count * 5) {
+    count = pos_tan.num_elements() / 5;
+  }
+  const bool valid_contour =
+      static_cast<size_t>(contour_index) < exposed_contours_;
+  const SkContourMeasure* measure =
+      valid_contour ? (*contours_)[contour_index].get() : nullptr;
+
+  SkPoint pos;
+  SkVector tan;
+  for (int i = 0; i < count; ++i) {
+    if (measure && measure->getPosTan(distances[i], &pos, &tan)) {
+      pos_tan[i * 5] = 1;  // dart code will check for this for success
+      pos_tan[i * 5 + 1] = pos.x();
+      pos_tan[i * 5 + 2] = pos.y();
+      pos_tan[i * 5 + 3] = tan.x();
+      pos_tan[i * 5 + 4] = tan.y();
+    } else {
+      pos_tan[i * 5] = 0;  // dart code will check for this for failure
+      pos_tan[i * 5 + 1] = 0;
+      pos_tan[i * 5 + 2] = 0;
+      pos_tan[i * 5 + 3] = 0;
+      pos_tan[i * 5 + 4] = 0;
+    }
+  }
+}
+
 void CanvasPathMeasure::getSegment(Dart_Handle path_handle,
                                    int contour_index,
                                    float start_d,
                                    float stop_d,
                                    bool start_with_move_to) {
-  if (static_cast<std::vector<sk_sp<SkContourMeasure>>::size_type>(
-          contour_index) >= measures_.size()) {
+  if (static_cast<size_t>(contour_index) >= exposed_contours_) {
     CanvasPath::Create(path_handle);
   }
   SkPath dst;
-  bool success = measures_[contour_index]->getSegment(start_d, stop_d, &dst,
-                                                      start_with_move_to);
+  bool success = (*contours_)[contour_index]->getSegment(start_d, stop_d, &dst,
+                                                         start_with_move_to);
   if (!success) {
     CanvasPath::Create(path_handle);
   } else {
@@ -97,17 +127,15 @@ void CanvasPathMeasure::getSegment(Dart_Handle path_handle,
 }
 
 bool CanvasPathMeasure::isClosed(int contour_index) {
-  if (static_cast<std::vector<sk_sp<SkContourMeasure>>::size_type>(
-          contour_index) < measures_.size()) {
-    return measures_[contour_index]->isClosed();
+  if (static_cast<size_t>(contour_index) < exposed_contours_) {
+    return (*contours_)[contour_index]->isClosed();
   }
   return false;
 }
 
 bool CanvasPathMeasure::nextContour() {
-  auto measure = path_measure_->next();
-  if (measure) {
-    measures_.push_back(std::move(measure));
+  if (exposed_contours_ < contours_->size()) {
+    exposed_contours_++;
     return true;
   }
   return false;
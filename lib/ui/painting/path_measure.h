@@ -5,6 +5,7 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_PATH_MEASURE_H_
 #define FLUTTER_LIB_UI_PAINTING_PATH_MEASURE_H_
 
+#include <memory>
 #include <vector>
 
 #include "flutter/lib/ui/dart_wrapper.h"
@@ -31,6 +32,14 @@ class CanvasPathMeasure : public RefCountedDartWrappable<CanvasPathMeasure> {
   void setPath(const CanvasPath* path, bool isClosed);
   float getLength(int contour_index);
   tonic::Float32List getPosTan(int contour_index, float distance);
+
+  // Fills pos_tan_handle with five floats per distance in distances_handle
+  // (success flag, position x/y, tangent x/y), mirroring getPosTan, with a
+  // single native call.
+  void getPosTans(int contour_index,
+                  Dart_Handle distances_handle,
+                  Dart_Handle pos_tan_handle);
+
   void getSegment(Dart_Handle path_handle,
                   int contour_index,
                   float start_d,
@@ -39,13 +48,16 @@ class CanvasPathMeasure : public RefCountedDartWrappable<CanvasPathMeasure> {
   bool isClosed(int contour_index);
   bool nextContour();
 
-  const SkContourMeasureIter& pathMeasure() const { return *path_measure_; }
-
  private:
   CanvasPathMeasure();
 
-  std::unique_ptr<SkContourMeasureIter> path_measure_;
-  std::vector<sk_sp<SkContourMeasure>> measures_;
+  // Contour measures shared with the source CanvasPath's measure cache.
+  // The measures snapshot the geometry at measurement time, so they remain
+  // valid even if the source path is mutated afterwards.
+  std::shared_ptr<const std::vector<sk_sp<SkContourMeasure>>> contours_;
+
+  // The number of contours made addressable so far via nextContour.
+  size_t exposed_contours_ = 0;
 };
 
 }  // namespace flutter
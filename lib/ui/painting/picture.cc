@@ -35,9 +35,17 @@ fml::RefPtr<Picture> Picture::Create(
 }
 
 Picture::Picture(flutter::SkiaGPUObject<DisplayList> display_list)
-    : display_list_(std::move(display_list)) {}
+    : display_list_(std::move(display_list)) {
+  allocation_bytes_attributed_ = static_cast<int64_t>(GetAllocationSize());
+  if (auto* state = UIDartState::Current()) {
+    state->AdjustAllocationBytes(UIDartState::AllocationCategory::kDisplayList,
+                                 allocation_bytes_attributed_);
+  }
+}
 
-Picture::~Picture() = default;
+Picture::~Picture() {
+  ReleaseAttributedBytes();
+}
 
 Dart_Handle Picture::toImage(uint32_t width,
                              uint32_t height,
@@ -104,9 +112,21 @@ void Picture::RasterizeToImageSync(sk_sp<DisplayList> display_list,
 
 void Picture::dispose() {
   display_list_.reset();
+  ReleaseAttributedBytes();
   ClearDartWrapper();
 }
 
+void Picture::ReleaseAttributedBytes() {
+  if (allocation_bytes_attributed_ == 0) {
+    return;
+  }
+  if (auto* state = UIDartState::Current()) {
+    state->AdjustAllocationBytes(UIDartState::AllocationCategory::kDisplayList,
+                                 -allocation_bytes_attributed_);
+  }
+  allocation_bytes_attributed_ = 0;
+}
+
 size_t Picture::GetAllocationSize() const {
   if (auto display_list = display_list_.skia_object()) {
     return display_list->bytes() + sizeof(Picture);
@@ -199,22 +219,26 @@ Dart_Handle Picture::RasterizeToImage(const sk_sp<DisplayList>& display_list,
       raster_task_runner,
       [ui_task_runner, snapshot_delegate, display_list, picture_bounds, ui_task,
        layer_tree = std::move(layer_tree)] {
-        sk_sp<DlImage> image;
+        // The callback fires once the GPU has finished with the snapshot,
+        // which frees the raster thread to produce the next frame instead of
+        // draining the GPU. Backends without completion hooks invoke it
+        // inline.
+        auto completion = [ui_task_runner, ui_task](sk_sp<DlImage> image) {
+          fml::TaskRunner::RunNowOrPostTask(
+              ui_task_runner, [ui_task, image]() { ui_task(image); });
+        };
         if (layer_tree) {
           auto display_list = layer_tree->Flatten(
               SkRect::MakeWH(picture_bounds.width(), picture_bounds.height()),
               snapshot_delegate->GetTextureRegistry(),
               snapshot_delegate->GetGrContext());
 
-          image = snapshot_delegate->MakeRasterSnapshot(display_list,
-                                                        picture_bounds);
+          snapshot_delegate->MakeRasterSnapshotAsync(
+              display_list, picture_bounds, completion);
         } else {
-          image = snapshot_delegate->MakeRasterSnapshot(display_list,
-                                                        picture_bounds);
+          snapshot_delegate->MakeRasterSnapshotAsync(
+              display_list, picture_bounds, completion);
         }
-
-        fml::TaskRunner::RunNowOrPostTask(
-            ui_task_runner, [ui_task, image]() { ui_task(image); });
       });
 
   return Dart_Null();
@@ -70,7 +70,15 @@ class Picture : public RefCountedDartWrappable<Picture> {
  private:
   explicit Picture(flutter::SkiaGPUObject<DisplayList> display_list);
 
+  // Subtracts the bytes recorded in allocation_bytes_attributed_ from the
+  // owning isolate's display list allocation counter.
+  void ReleaseAttributedBytes();
+
   flutter::SkiaGPUObject<DisplayList> display_list_;
+
+  // Bytes currently attributed to the owning isolate's display list
+  // allocation counter for this picture.
+  int64_t allocation_bytes_attributed_ = 0;
 };
 
 }  // namespace flutter
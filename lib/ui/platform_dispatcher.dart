@@ -1466,6 +1466,45 @@ enum FramePhase {
   /// This is useful for correlating time raster finish time with the system
   /// clock to integrate with other profiling tools.
   rasterFinishWallTime,
+
+  /// When the raster thread started waiting to acquire the surface's drawable
+  /// or framebuffer for the frame.
+  ///
+  /// See also [FrameTiming.bufferAcquireDuration].
+  bufferAcquireStart,
+
+  /// When the raster thread finished acquiring the surface's drawable or
+  /// framebuffer for the frame.
+  ///
+  /// See also [FrameTiming.bufferAcquireDuration].
+  bufferAcquireFinish,
+
+  /// When the raster thread finished encoding the frame's drawing commands,
+  /// before flushing and presenting the frame.
+  ///
+  /// See also [FrameTiming.rasterEncodeDuration].
+  rasterEncodeFinish,
+
+  /// When the present/swap of the frame began on the raster thread.
+  ///
+  /// See also [FrameTiming.presentDuration].
+  presentStart,
+
+  /// When the present/swap call for the frame returned.
+  ///
+  /// When the engine presents on a separate thread the return time is not
+  /// observable and this reports the same timestamp as [rasterFinish].
+  ///
+  /// See also [FrameTiming.presentDuration].
+  presentFinish,
+
+  /// When the GPU finished executing the frame's work.
+  ///
+  /// Backends that cannot observe GPU completion report the same timestamp as
+  /// [rasterFinish].
+  ///
+  /// See also [FrameTiming.gpuDuration].
+  gpuWorkFinish,
 }
 
 enum _FrameTimingInfo {
@@ -1512,6 +1551,12 @@ class FrameTiming {
     required int rasterStart,
     required int rasterFinish,
     required int rasterFinishWallTime,
+    int bufferAcquireStart = 0,
+    int bufferAcquireFinish = 0,
+    int rasterEncodeFinish = 0,
+    int presentStart = 0,
+    int presentFinish = 0,
+    int gpuWorkFinish = 0,
     int layerCacheCount = 0,
     int layerCacheBytes = 0,
     int pictureCacheCount = 0,
@@ -1525,6 +1570,12 @@ class FrameTiming {
       rasterStart,
       rasterFinish,
       rasterFinishWallTime,
+      bufferAcquireStart,
+      bufferAcquireFinish,
+      rasterEncodeFinish,
+      presentStart,
+      presentFinish,
+      gpuWorkFinish,
       layerCacheCount,
       layerCacheBytes,
       pictureCacheCount,
@@ -1576,6 +1627,33 @@ class FrameTiming {
   /// {@macro dart.ui.FrameTiming.fps_milliseconds}
   Duration get rasterDuration => _rawDuration(FramePhase.rasterFinish) - _rawDuration(FramePhase.rasterStart);
 
+  /// The duration the raster thread spent waiting to acquire the surface's
+  /// drawable or framebuffer before rasterizing the frame.
+  ///
+  /// A consistently high acquisition wait indicates compositor backpressure (a
+  /// full buffer queue) rather than expensive rasterization.
+  Duration get bufferAcquireDuration => _rawDuration(FramePhase.bufferAcquireFinish) - _rawDuration(FramePhase.bufferAcquireStart);
+
+  /// The duration the raster thread spent encoding the frame's drawing
+  /// commands, excluding the flush/submit and present.
+  ///
+  /// This isolates the CPU rasterization cost from [rasterDuration], which
+  /// also includes swap/present waits.
+  Duration get rasterEncodeDuration => _rawDuration(FramePhase.rasterEncodeFinish) - _rawDuration(FramePhase.rasterStart);
+
+  /// The duration of the present/swap call for the frame.
+  ///
+  /// When the engine presents on a separate thread this covers only the
+  /// submission from the raster thread; the swap itself is not included.
+  Duration get presentDuration => _rawDuration(FramePhase.presentFinish) - _rawDuration(FramePhase.presentStart);
+
+  /// The duration from the start of rasterization until the GPU finished
+  /// executing the frame's work.
+  ///
+  /// Reports the same value as [rasterDuration] on backends that cannot
+  /// observe GPU completion.
+  Duration get gpuDuration => _rawDuration(FramePhase.gpuWorkFinish) - _rawDuration(FramePhase.rasterStart);
+
   /// The duration between receiving the vsync signal and starting building the
   /// frame.
   Duration get vsyncOverhead => _rawDuration(FramePhase.buildStart) - _rawDuration(FramePhase.vsyncStart);
@@ -28,9 +28,19 @@ void SemanticsUpdate::create(Dart_Handle semantics_update_handle,
 
 SemanticsUpdate::SemanticsUpdate(SemanticsNodeUpdates nodes,
                                  CustomAccessibilityActionUpdates actions)
-    : nodes_(std::move(nodes)), actions_(std::move(actions)) {}
+    : nodes_(std::move(nodes)), actions_(std::move(actions)) {
+  allocation_bytes_attributed_ = static_cast<int64_t>(
+      nodes_.size() * sizeof(SemanticsNode) +
+      actions_.size() * sizeof(CustomAccessibilityAction));
+  if (auto* state = UIDartState::Current()) {
+    state->AdjustAllocationBytes(UIDartState::AllocationCategory::kSemantics,
+                                 allocation_bytes_attributed_);
+  }
+}
 
-SemanticsUpdate::~SemanticsUpdate() = default;
+SemanticsUpdate::~SemanticsUpdate() {
+  ReleaseAttributedBytes();
+}
 
 SemanticsNodeUpdates SemanticsUpdate::takeNodes() {
   return std::move(nodes_);
@@ -41,7 +51,19 @@ CustomAccessibilityActionUpdates SemanticsUpdate::takeActions() {
 }
 
 void SemanticsUpdate::dispose() {
+  ReleaseAttributedBytes();
   ClearDartWrapper();
 }
 
+void SemanticsUpdate::ReleaseAttributedBytes() {
+  if (allocation_bytes_attributed_ == 0) {
+    return;
+  }
+  if (auto* state = UIDartState::Current()) {
+    state->AdjustAllocationBytes(UIDartState::AllocationCategory::kSemantics,
+                                 -allocation_bytes_attributed_);
+  }
+  allocation_bytes_attributed_ = 0;
+}
+
 }  // namespace flutter
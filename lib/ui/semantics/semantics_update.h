@@ -31,8 +31,16 @@ class SemanticsUpdate : public RefCountedDartWrappable<SemanticsUpdate> {
   explicit SemanticsUpdate(SemanticsNodeUpdates nodes,
                            CustomAccessibilityActionUpdates updates);
 
+  // Subtracts the bytes recorded in allocation_bytes_attributed_ from the
+  // owning isolate's semantics allocation counter.
+  void ReleaseAttributedBytes();
+
   SemanticsNodeUpdates nodes_;
   CustomAccessibilityActionUpdates actions_;
+
+  // Bytes currently attributed to the owning isolate's semantics allocation
+  // counter for this update.
+  int64_t allocation_bytes_attributed_ = 0;
 };
 
 }  // namespace flutter
@@ -18,6 +18,10 @@ namespace flutter {
 void pushStringAttributes(
     StringAttributes& destination,
     const std::vector<NativeStringAttribute*>& native_attributes) {
+  // The destination may hold attributes from an earlier update of the same
+  // node in this batch.
+  destination.clear();
+  destination.reserve(native_attributes.size());
   for (const auto& native_attribute : native_attributes) {
     destination.push_back(native_attribute->GetAttribute());
   }
@@ -71,7 +75,10 @@ void SemanticsUpdateBuilder::updateNode(
             (scrollChildren > 0 && childrenInHitTestOrder.data()))
       << "Semantics update contained scrollChildren but did not have "
          "childrenInHitTestOrder";
-  SemanticsNode node;
+  // Build the node directly in its map slot so no fully populated node is
+  // ever deep copied; a repeated update of the same id in one batch reuses
+  // the existing string and vector storage.
+  SemanticsNode& node = nodes_[id];
   node.id = id;
   node.flags = flags;
   node.actions = actions;
@@ -105,29 +112,27 @@ void SemanticsUpdateBuilder::updateNode(
     scalarTransform[i] = transform.data()[i];
   }
   node.transform = SkM44::ColMajor(scalarTransform);
-  node.childrenInTraversalOrder =
-      std::vector<int32_t>(childrenInTraversalOrder.data(),
-                           childrenInTraversalOrder.data() +
-                               childrenInTraversalOrder.num_elements());
-  node.childrenInHitTestOrder = std::vector<int32_t>(
+  node.childrenInTraversalOrder.assign(
+      childrenInTraversalOrder.data(),
+      childrenInTraversalOrder.data() +
+          childrenInTraversalOrder.num_elements());
+  node.childrenInHitTestOrder.assign(
       childrenInHitTestOrder.data(),
       childrenInHitTestOrder.data() + childrenInHitTestOrder.num_elements());
-  node.customAccessibilityActions = std::vector<int32_t>(
+  node.customAccessibilityActions.assign(
       localContextActions.data(),
       localContextActions.data() + localContextActions.num_elements());
-  nodes_[id] = node;
 }
 
 void SemanticsUpdateBuilder::updateCustomAction(int id,
                                                 std::string label,
                                                 std::string hint,
                                                 int overrideId) {
-  CustomAccessibilityAction action;
+  CustomAccessibilityAction& action = actions_[id];
   action.id = id;
   action.overrideId = overrideId;
   action.label = std::move(label);
   action.hint = std::move(hint);
-  actions_[id] = action;
 }
 
 void SemanticsUpdateBuilder::build(Dart_Handle semantics_update_handle) {
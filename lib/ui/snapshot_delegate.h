@@ -5,6 +5,7 @@
 #ifndef FLUTTER_LIB_UI_SNAPSHOT_DELEGATE_H_
 #define FLUTTER_LIB_UI_SNAPSHOT_DELEGATE_H_
 
+#include <functional>
 #include <string>
 
 #include "flutter/common/graphics/texture.h"
@@ -72,6 +73,19 @@ class SnapshotDelegate {
   virtual sk_sp<DlImage> MakeRasterSnapshot(sk_sp<DisplayList> display_list,
                                             SkISize picture_size) = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Same as |MakeRasterSnapshot| but invokes the callback once
+  ///             the GPU has finished rendering the snapshot instead of
+  ///             stalling the calling thread on the GPU. Backends without
+  ///             completion hooks invoke the callback inline.
+  ///
+  ///             The callback may be invoked on an arbitrary thread.
+  ///
+  virtual void MakeRasterSnapshotAsync(
+      sk_sp<DisplayList> display_list,
+      SkISize picture_size,
+      const std::function<void(sk_sp<DlImage>)>& callback) = 0;
+
   virtual sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) = 0;
 };
 
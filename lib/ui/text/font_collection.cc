@@ -6,18 +6,22 @@
 
 #include <mutex>
 
+#include "flutter/fml/make_copyable.h"
 #include "flutter/lib/ui/text/asset_manager_font_provider.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
 #include "flutter/runtime/test_font_data.h"
 #include "rapidjson/document.h"
 #include "rapidjson/rapidjson.h"
+#include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkFontMgr.h"
 #include "third_party/skia/include/core/SkGraphics.h"
 #include "third_party/skia/include/core/SkStream.h"
+#include "third_party/skia/include/core/SkString.h"
 #include "third_party/skia/include/core/SkTypeface.h"
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_library_natives.h"
+#include "third_party/tonic/dart_persistent_value.h"
 #include "third_party/tonic/logging/dart_invoke.h"
 #include "third_party/tonic/typed_data/typed_list.h"
 #include "txt/asset_font_manager.h"
@@ -43,6 +47,7 @@ std::shared_ptr<txt::FontCollection> FontCollection::GetFontCollection() const {
 void FontCollection::SetupDefaultFontManager(
     uint32_t font_initialization_data) {
   collection_->SetupDefaultFontManager(font_initialization_data);
+  paragraph_cache_.Clear();
 }
 
 // Font manifest yaml format:
@@ -118,6 +123,7 @@ void FontCollection::RegisterFonts(
 
   collection_->SetAssetFontManager(
       sk_make_sp<txt::AssetFontManager>(std::move(font_provider)));
+  paragraph_cache_.Clear();
 }
 
 void FontCollection::RegisterTestFonts() {
@@ -141,6 +147,7 @@ void FontCollection::RegisterTestFonts() {
       sk_make_sp<txt::TestFontManager>(std::move(font_provider), names));
 
   collection_->DisableFontFallback();
+  paragraph_cache_.Clear();
 }
 
 void FontCollection::LoadFontFromList(Dart_Handle font_data_handle,
@@ -148,26 +155,76 @@ void FontCollection::LoadFontFromList(Dart_Handle font_data_handle,
                                       const std::string& family_name) {
   tonic::Uint8List font_data(font_data_handle);
   UIDartState::ThrowIfUIOperationsProhibited();
-  FontCollection& font_collection = UIDartState::Current()
-                                        ->platform_configuration()
-                                        ->client()
-                                        ->GetFontCollection();
-
-  std::unique_ptr<SkStreamAsset> font_stream = std::make_unique<SkMemoryStream>(
-      font_data.data(), font_data.num_elements(), true);
-  sk_sp<SkTypeface> typeface =
-      SkTypeface::MakeFromStream(std::move(font_stream));
-  txt::TypefaceFontAssetProvider& font_provider =
-      font_collection.dynamic_font_manager_->font_provider();
-  if (family_name.empty()) {
-    font_provider.RegisterTypeface(typeface);
-  } else {
-    font_provider.RegisterTypeface(typeface, family_name);
-  }
-  font_collection.collection_->ClearFontFamilyCache();
+  auto* dart_state = UIDartState::Current();
 
+  // The font data must be copied since the Dart typed data is released
+  // before the worker runs.
+  sk_sp<SkData> typeface_data =
+      SkData::MakeWithCopy(font_data.data(), font_data.num_elements());
   font_data.Release();
-  tonic::DartInvoke(callback, {tonic::ToDart(0)});
+
+  auto ui_task_runner = dart_state->GetTaskRunners().GetUITaskRunner();
+  auto callback_value =
+      std::make_unique<tonic::DartPersistentValue>(dart_state, callback);
+
+  auto ui_task = fml::MakeCopyable(
+      [callback_value = std::move(callback_value),
+       family_name](sk_sp<SkTypeface> typeface) mutable {
+        auto dart_state = callback_value->dart_state().lock();
+        if (!dart_state) {
+          return;
+        }
+        tonic::DartState::Scope scope(dart_state);
+        UIDartState::Current()
+            ->platform_configuration()
+            ->client()
+            ->GetFontCollection()
+            .RegisterLoadedTypeface(std::move(typeface), family_name);
+        tonic::DartInvoke(callback_value->Get(), {tonic::ToDart(0)});
+      });
+
+  // Parsing the font file is the expensive part of loading it, so large
+  // fonts are parsed on a worker instead of stalling the UI thread. The
+  // typeface is registered back on the UI thread, where the collection
+  // lives.
+  dart_state->GetConcurrentTaskRunner()->PostTask(
+      [typeface_data = std::move(typeface_data),
+       ui_task_runner = std::move(ui_task_runner), ui_task]() {
+        std::unique_ptr<SkStreamAsset> font_stream =
+            std::make_unique<SkMemoryStream>(typeface_data);
+        sk_sp<SkTypeface> typeface =
+            SkTypeface::MakeFromStream(std::move(font_stream));
+        ui_task_runner->PostTask(
+            [typeface = std::move(typeface), ui_task = ui_task]() mutable {
+              ui_task(std::move(typeface));
+            });
+      });
+}
+
+void FontCollection::RegisterLoadedTypeface(sk_sp<SkTypeface> typeface,
+                                            const std::string& family_name) {
+  if (typeface == nullptr) {
+    return;
+  }
+
+  std::string registered_family = family_name;
+  if (registered_family.empty()) {
+    SkString sk_family_name;
+    typeface->getFamilyName(&sk_family_name);
+    registered_family =
+        std::string(sk_family_name.c_str(), sk_family_name.size());
+  }
+
+  txt::TypefaceFontAssetProvider& font_provider =
+      dynamic_font_manager_->font_provider();
+  font_provider.RegisterTypeface(std::move(typeface), registered_family);
+
+  // Only invalidate the cached collections the new family can affect;
+  // collections for unrelated families survive the load. Recycled
+  // paragraphs may reference the old resolution of the family, so they are
+  // all dropped.
+  collection_->ClearFontFamilyCache(registered_family);
+  paragraph_cache_.Clear();
 }
 
 }  // namespace flutter
@@ -11,6 +11,8 @@
 #include "flutter/assets/asset_manager.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_ptr.h"
+#include "flutter/lib/ui/text/paragraph_cache.h"
+#include "third_party/skia/include/core/SkTypeface.h"
 #include "third_party/tonic/typed_data/typed_list.h"
 #include "txt/font_collection.h"
 
@@ -24,6 +26,11 @@ class FontCollection {
 
   std::shared_ptr<txt::FontCollection> GetFontCollection() const;
 
+  // Laid out paragraphs recycled across identical rebuilds. Lives alongside
+  // the font collection so that any font registration can drop the cached
+  // shaping results that reference the old fonts.
+  ParagraphCache& GetParagraphCache() { return paragraph_cache_; }
+
   void SetupDefaultFontManager(uint32_t font_initialization_data);
 
   void RegisterFonts(const std::shared_ptr<AssetManager>& asset_manager);
@@ -35,8 +42,15 @@ class FontCollection {
                                const std::string& family_name);
 
  private:
+  // Registers a typeface parsed on a worker thread with the dynamic font
+  // manager and invalidates only the cached collections the new family can
+  // affect. Must be called on the UI task runner.
+  void RegisterLoadedTypeface(sk_sp<SkTypeface> typeface,
+                              const std::string& family_name);
+
   std::shared_ptr<txt::FontCollection> collection_;
   sk_sp<txt::DynamicFontManager> dynamic_font_manager_;
+  ParagraphCache paragraph_cache_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(FontCollection);
 };
@@ -8,6 +8,10 @@
 #include "flutter/common/task_runners.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/lib/ui/text/font_collection.h"
+#include "flutter/lib/ui/text/paragraph_cache.h"
+#include "flutter/lib/ui/ui_dart_state.h"
+#include "flutter/lib/ui/window/platform_configuration.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_binding_macros.h"
@@ -17,8 +21,21 @@ namespace flutter {
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, Paragraph);
 
-Paragraph::Paragraph(std::unique_ptr<txt::Paragraph> paragraph)
-    : m_paragraph(std::move(paragraph)) {}
+namespace {
+
+ParagraphCache& GetParagraphCache() {
+  return UIDartState::Current()
+      ->platform_configuration()
+      ->client()
+      ->GetFontCollection()
+      .GetParagraphCache();
+}
+
+}  // namespace
+
+Paragraph::Paragraph(std::unique_ptr<txt::Paragraph> paragraph,
+                     std::string cache_key)
+    : m_paragraph(std::move(paragraph)), cache_key_(std::move(cache_key)) {}
 
 Paragraph::~Paragraph() = default;
 
@@ -55,7 +72,22 @@ bool Paragraph::didExceedMaxLines() {
 }
 
 void Paragraph::layout(double width) {
-  m_paragraph->Layout(width);
+  if (cache_key_.empty()) {
+    m_paragraph->Layout(width);
+    return;
+  }
+
+  std::string layout_key = cache_key_;
+  layout_key.append(reinterpret_cast<const char*>(&width), sizeof(width));
+  if (std::unique_ptr<txt::Paragraph> recycled =
+          GetParagraphCache().Take(layout_key)) {
+    // An identical paragraph was laid out at this width and disposed; adopt
+    // its layout instead of shaping from scratch.
+    m_paragraph = std::move(recycled);
+  } else {
+    m_paragraph->Layout(width);
+  }
+  layout_key_ = std::move(layout_key);
 }
 
 void Paragraph::paint(Canvas* canvas, double x, double y) {
@@ -167,6 +199,9 @@ tonic::Float64List Paragraph::computeLineMetrics() {
 }
 
 void Paragraph::dispose() {
+  if (!layout_key_.empty() && m_paragraph) {
+    GetParagraphCache().Donate(std::move(layout_key_), std::move(m_paragraph));
+  }
   m_paragraph.reset();
   ClearDartWrapper();
 }
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_LIB_UI_TEXT_PARAGRAPH_H_
 #define FLUTTER_LIB_UI_TEXT_PARAGRAPH_H_
 
+#include <string>
+
 #include "flutter/fml/message_loop.h"
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "flutter/lib/ui/painting/canvas.h"
@@ -20,8 +22,10 @@ class Paragraph : public RefCountedDartWrappable<Paragraph> {
 
  public:
   static void Create(Dart_Handle paragraph_handle,
-                     std::unique_ptr<txt::Paragraph> txt_paragraph) {
-    auto paragraph = fml::MakeRefCounted<Paragraph>(std::move(txt_paragraph));
+                     std::unique_ptr<txt::Paragraph> txt_paragraph,
+                     std::string cache_key = std::string()) {
+    auto paragraph = fml::MakeRefCounted<Paragraph>(std::move(txt_paragraph),
+                                                    std::move(cache_key));
     paragraph->AssociateWithDartWrapper(paragraph_handle);
   }
 
@@ -54,7 +58,15 @@ class Paragraph : public RefCountedDartWrappable<Paragraph> {
  private:
   std::unique_ptr<txt::Paragraph> m_paragraph;
 
-  explicit Paragraph(std::unique_ptr<txt::Paragraph> paragraph);
+  // Byte stream of the builder operations that produced this paragraph, or
+  // empty when the paragraph is not cacheable. See ParagraphCache.
+  std::string cache_key_;
+  // |cache_key_| plus the width of the most recent layout; the key under
+  // which the paragraph is donated back to the cache on dispose.
+  std::string layout_key_;
+
+  explicit Paragraph(std::unique_ptr<txt::Paragraph> paragraph,
+                     std::string cache_key = std::string());
 };
 
 }  // namespace flutter
@@ -5,6 +5,8 @@
 #include "flutter/lib/ui/text/paragraph_builder.h"
 
 #include <cstring>
+#include <map>
+#include <type_traits>
 
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
@@ -139,6 +141,105 @@ const int kSHeightMask = 1 << kSHeightIndex;
 const int kSLeadingMask = 1 << kSLeadingIndex;
 const int kSForceStrutHeightMask = 1 << kSForceStrutHeightIndex;
 
+// Paragraph cache key encoding. Each builder operation appends a tag byte
+// followed by its fields; variable length values are length prefixed so the
+// byte stream is unambiguous.
+
+void appendBytesToKey(std::string* key, const void* data, size_t size) {
+  key->append(static_cast<const char*>(data), size);
+}
+
+template <typename T>
+void appendValueToKey(std::string* key, const T& value) {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "cache key values must be raw encodable");
+  appendBytesToKey(key, &value, sizeof(T));
+}
+
+void appendStringToKey(std::string* key, const std::string& value) {
+  appendValueToKey(key, value.size());
+  appendBytesToKey(key, value.data(), value.size());
+}
+
+void appendString16ToKey(std::string* key, const std::u16string& value) {
+  appendValueToKey(key, value.size());
+  appendBytesToKey(key, value.data(), value.size() * sizeof(char16_t));
+}
+
+void appendStringListToKey(std::string* key,
+                           const std::vector<std::string>& values) {
+  appendValueToKey(key, values.size());
+  for (const std::string& value : values) {
+    appendStringToKey(key, value);
+  }
+}
+
+void appendParagraphStyleToKey(std::string* key,
+                               const txt::ParagraphStyle& style) {
+  appendValueToKey(key, style.font_weight);
+  appendValueToKey(key, style.font_style);
+  appendStringToKey(key, style.font_family);
+  appendValueToKey(key, style.font_size);
+  appendValueToKey(key, style.height);
+  appendValueToKey(key, style.has_height_override);
+  appendValueToKey(key, style.text_height_behavior);
+  appendValueToKey(key, style.strut_enabled);
+  appendValueToKey(key, style.strut_font_weight);
+  appendValueToKey(key, style.strut_font_style);
+  appendStringListToKey(key, style.strut_font_families);
+  appendValueToKey(key, style.strut_font_size);
+  appendValueToKey(key, style.strut_height);
+  appendValueToKey(key, style.strut_has_height_override);
+  appendValueToKey(key, style.strut_half_leading);
+  appendValueToKey(key, style.strut_leading);
+  appendValueToKey(key, style.force_strut_height);
+  appendValueToKey(key, style.text_align);
+  appendValueToKey(key, style.text_direction);
+  appendValueToKey(key, style.max_lines);
+  appendString16ToKey(key, style.ellipsis);
+  appendStringToKey(key, style.locale);
+  appendValueToKey(key, style.break_strategy);
+}
+
+// Returns false when the style cannot be encoded into a cache key: custom
+// paints may carry shaders or filters that cannot be cheaply fingerprinted.
+bool appendTextStyleToKey(std::string* key, const txt::TextStyle& style) {
+  if (style.has_background || style.has_foreground) {
+    return false;
+  }
+  appendValueToKey(key, style.color);
+  appendValueToKey(key, style.decoration);
+  appendValueToKey(key, style.decoration_color);
+  appendValueToKey(key, style.decoration_style);
+  appendValueToKey(key, style.decoration_thickness_multiplier);
+  appendValueToKey(key, style.font_weight);
+  appendValueToKey(key, style.font_style);
+  appendValueToKey(key, style.text_baseline);
+  appendValueToKey(key, style.half_leading);
+  appendStringListToKey(key, style.font_families);
+  appendValueToKey(key, style.font_size);
+  appendValueToKey(key, style.letter_spacing);
+  appendValueToKey(key, style.word_spacing);
+  appendValueToKey(key, style.height);
+  appendValueToKey(key, style.has_height_override);
+  appendStringToKey(key, style.locale);
+  appendValueToKey(key, style.text_shadows.size());
+  for (const txt::TextShadow& shadow : style.text_shadows) {
+    appendValueToKey(key, shadow.color);
+    appendValueToKey(key, shadow.offset);
+    appendValueToKey(key, shadow.blur_sigma);
+  }
+  appendStringToKey(key, style.font_features.GetFeatureSettings());
+  const std::map<std::string, float>& axis_values =
+      style.font_variations.GetAxisValues();
+  appendValueToKey(key, axis_values.size());
+  for (const auto& axis : axis_values) {
+    appendStringToKey(key, axis.first);
+    appendValueToKey(key, axis.second);
+  }
+  return true;
+}
+
 }  // namespace
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, ParagraphBuilder);
@@ -314,6 +415,14 @@ ParagraphBuilder::ParagraphBuilder(
 #endif  // FLUTTER_ENABLE_SKSHAPER
 
   m_paragraphBuilder = factory(style, font_collection.GetFontCollection());
+
+  appendValueToKey(&cache_key_, 'P');
+#if FLUTTER_ENABLE_SKSHAPER
+  // The two builders shape differently, so their paragraphs must not be
+  // recycled across a change of the flag.
+  appendValueToKey(&cache_key_, enable_skparagraph);
+#endif
+  appendParagraphStyleToKey(&cache_key_, style);
 }
 
 ParagraphBuilder::~ParagraphBuilder() = default;
@@ -504,10 +613,22 @@ void ParagraphBuilder::pushStyle(const tonic::Int32List& encoded,
   }
 
   m_paragraphBuilder->PushStyle(style);
+
+  if (cacheable_) {
+    appendValueToKey(&cache_key_, 'S');
+    if (!appendTextStyleToKey(&cache_key_, style)) {
+      cacheable_ = false;
+      cache_key_.clear();
+    }
+  }
 }
 
 void ParagraphBuilder::pop() {
   m_paragraphBuilder->Pop();
+
+  if (cacheable_) {
+    appendValueToKey(&cache_key_, 'X');
+  }
 }
 
 Dart_Handle ParagraphBuilder::addText(const std::u16string& text) {
@@ -527,6 +648,11 @@ Dart_Handle ParagraphBuilder::addText(const std::u16string& text) {
 
   m_paragraphBuilder->AddText(text);
 
+  if (cacheable_) {
+    appendValueToKey(&cache_key_, 'T');
+    appendString16ToKey(&cache_key_, text);
+  }
+
   return Dart_Null();
 }
 
@@ -540,10 +666,20 @@ void ParagraphBuilder::addPlaceholder(double width,
       static_cast<txt::TextBaseline>(baseline), baseline_offset);
 
   m_paragraphBuilder->AddPlaceholder(placeholder_run);
+
+  if (cacheable_) {
+    appendValueToKey(&cache_key_, 'H');
+    appendValueToKey(&cache_key_, width);
+    appendValueToKey(&cache_key_, height);
+    appendValueToKey(&cache_key_, alignment);
+    appendValueToKey(&cache_key_, baseline_offset);
+    appendValueToKey(&cache_key_, baseline);
+  }
 }
 
 void ParagraphBuilder::build(Dart_Handle paragraph_handle) {
-  Paragraph::Create(paragraph_handle, m_paragraphBuilder->Build());
+  Paragraph::Create(paragraph_handle, m_paragraphBuilder->Build(),
+                    cacheable_ ? std::move(cache_key_) : std::string());
   m_paragraphBuilder.reset();
   ClearDartWrapper();
 }
@@ -79,6 +79,12 @@ class ParagraphBuilder : public RefCountedDartWrappable<ParagraphBuilder> {
                             const std::string& locale);
 
   std::unique_ptr<txt::ParagraphBuilder> m_paragraphBuilder;
+
+  // Byte stream of every builder operation, used as the paragraph cache key
+  // so identical rebuilds can recycle a laid out paragraph. Empty when the
+  // paragraph is not cacheable (e.g. a style carries a custom paint).
+  std::string cache_key_;
+  bool cacheable_ = true;
 };
 
 }  // namespace flutter
@@ -0,0 +1,95 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/text/paragraph_cache.h"
+
+#include <utility>
+
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+namespace {
+
+// A laid out paragraph cannot be measured cheaply, so an entry is charged for
+// its key (which embeds the full text and every style) at a multiplier
+// approximating the shaped glyph and line data, plus a fixed overhead.
+constexpr size_t kShapedBytesPerKeyByte = 8;
+constexpr size_t kEntryOverheadBytes = 1024;
+
+constexpr size_t kParagraphCacheByteBudget = 8 * (1 << 20);  // 8MB
+
+size_t EstimateEntryBytes(const std::string& key) {
+  return key.size() * kShapedBytesPerKeyByte + kEntryOverheadBytes;
+}
+
+}  // anonymous namespace
+
+ParagraphCache::ParagraphCache() = default;
+
+ParagraphCache::~ParagraphCache() = default;
+
+std::unique_ptr<txt::Paragraph> ParagraphCache::Take(const std::string& key) {
+  auto found = entries_.find(key);
+  if (found == entries_.end()) {
+    miss_count_++;
+    return nullptr;
+  }
+  hit_count_++;
+  std::unique_ptr<txt::Paragraph> paragraph =
+      std::move(found->second.paragraph);
+  bytes_ -= found->second.bytes;
+  lru_.erase(found->second.lru_position);
+  entries_.erase(found);
+
+  FML_TRACE_COUNTER("flutter", "ParagraphCache",
+                    reinterpret_cast<int64_t>(this),      //
+                    "hits", static_cast<int64_t>(hit_count_),
+                    "misses", static_cast<int64_t>(miss_count_),
+                    "bytes", static_cast<int64_t>(bytes_));
+  return paragraph;
+}
+
+void ParagraphCache::Donate(std::string key,
+                            std::unique_ptr<txt::Paragraph> paragraph) {
+  if (paragraph == nullptr) {
+    return;
+  }
+  const size_t bytes = EstimateEntryBytes(key);
+  if (bytes > kParagraphCacheByteBudget) {
+    return;
+  }
+  // A later donation under the same key replaces the earlier one; both hold
+  // identical layouts, but the newer paragraph is warmer in the glyph atlas.
+  auto found = entries_.find(key);
+  if (found != entries_.end()) {
+    bytes_ -= found->second.bytes;
+    lru_.erase(found->second.lru_position);
+    entries_.erase(found);
+  }
+
+  while (bytes_ + bytes > kParagraphCacheByteBudget && !lru_.empty()) {
+    auto evicted = entries_.find(lru_.back());
+    FML_DCHECK(evicted != entries_.end());
+    bytes_ -= evicted->second.bytes;
+    entries_.erase(evicted);
+    lru_.pop_back();
+  }
+
+  lru_.push_front(key);
+  Entry entry;
+  entry.paragraph = std::move(paragraph);
+  entry.bytes = bytes;
+  entry.lru_position = lru_.begin();
+  entries_.emplace(std::move(key), std::move(entry));
+  bytes_ += bytes;
+}
+
+void ParagraphCache::Clear() {
+  entries_.clear();
+  lru_.clear();
+  bytes_ = 0;
+}
+
+}  // namespace flutter
@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_TEXT_PARAGRAPH_CACHE_H_
+#define FLUTTER_LIB_UI_TEXT_PARAGRAPH_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "flutter/fml/macros.h"
+#include "flutter/third_party/txt/src/txt/paragraph.h"
+
+namespace flutter {
+
+/// A byte budgeted LRU of laid out paragraphs, keyed by the byte stream of
+/// builder operations concatenated with the layout width.
+///
+/// txt::Paragraph objects are uniquely owned and mutated by Layout, so
+/// entries are never shared. Instead, a paragraph is donated to the cache
+/// when its Dart wrapper is disposed, and taken back out (transferring
+/// ownership) when an identical paragraph is built and laid out at the same
+/// width. This matches the framework's rebuild pattern, where a widget whose
+/// text did not change discards its old paragraph and immediately shapes an
+/// identical replacement; a cache hit skips shaping and layout entirely.
+///
+/// Must be created, accessed, and collected on the UI thread.
+class ParagraphCache {
+ public:
+  ParagraphCache();
+
+  ~ParagraphCache();
+
+  /// Removes and returns the laid out paragraph stored under |key|, or
+  /// nullptr if no identical paragraph has been donated.
+  std::unique_ptr<txt::Paragraph> Take(const std::string& key);
+
+  /// Stores a laid out paragraph that is no longer referenced from Dart.
+  /// Evicts least recently used entries to stay within the byte budget.
+  void Donate(std::string key, std::unique_ptr<txt::Paragraph> paragraph);
+
+  /// Drops all entries. Called when the font collection changes, since
+  /// cached paragraphs hold shaped glyphs from the old fonts.
+  void Clear();
+
+ private:
+  struct Entry {
+    std::unique_ptr<txt::Paragraph> paragraph;
+    size_t bytes = 0;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  std::unordered_map<std::string, Entry> entries_;
+  // Keys ordered from most to least recently donated.
+  std::list<std::string> lru_;
+  size_t bytes_ = 0;
+  size_t hit_count_ = 0;
+  size_t miss_count_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ParagraphCache);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_TEXT_PARAGRAPH_CACHE_H_
@@ -3,13 +3,21 @@
 // found in the LICENSE file.
 
 #include "flutter/benchmarking/benchmarking.h"
+#include "flutter/benchmarking/perf_counters.h"
 #include "flutter/common/settings.h"
+#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/lib/ui/volatile_path_tracker.h"
+#include "flutter/lib/ui/window/platform_message.h"
 #include "flutter/lib/ui/window/platform_message_response_dart.h"
+#include "flutter/lib/ui/window/pointer_data_packet.h"
 #include "flutter/runtime/dart_vm_lifecycle.h"
+#include "flutter/shell/common/shell.h"
 #include "flutter/shell/common/thread_host.h"
 #include "flutter/testing/dart_isolate_runner.h"
 #include "flutter/testing/fixture_test.h"
+#include "third_party/tonic/converter/dart_converter.h"
+#include "third_party/tonic/logging/dart_error.h"
 
 #include <future>
 
@@ -19,6 +27,105 @@ class Fixture : public testing::FixtureTest {
   void TestBody() override{};
 };
 
+namespace {
+
+// Completes into a caller-owned latch so round-trip benchmarks can block on
+// the response leg. One response object is good for one message.
+class LatchedMessageResponse : public PlatformMessageResponse {
+ public:
+  void Complete(std::unique_ptr<fml::Mapping> data) override {
+    is_complete_ = true;
+    latch_->Signal();
+  }
+
+  void CompleteEmpty() override {
+    is_complete_ = true;
+    latch_->Signal();
+  }
+
+ private:
+  explicit LatchedMessageResponse(fml::AutoResetWaitableEvent* latch)
+      : latch_(latch) {}
+
+  fml::AutoResetWaitableEvent* latch_;
+
+  FML_FRIEND_MAKE_REF_COUNTED(LatchedMessageResponse);
+};
+
+// Brings up a real Shell running a fixture entrypoint so benchmarks can
+// cross the platform-message and pointer-event boundaries the same way an
+// embedder does. The entrypoint is expected to invoke the Finish native once
+// its dispatcher callbacks are installed, and again whenever the benchmark
+// wants a per-event signal.
+class ShellHarness {
+ public:
+  explicit ShellHarness(const std::string& entrypoint)
+      : thread_host_(ThreadHost::ThreadHostConfig(
+            "test",
+            ThreadHost::Type::Platform | ThreadHost::Type::RASTER |
+                ThreadHost::Type::IO | ThreadHost::Type::UI)),
+        task_runners_("test",
+                      thread_host_.platform_thread->GetTaskRunner(),
+                      thread_host_.raster_thread->GetTaskRunner(),
+                      thread_host_.ui_thread->GetTaskRunner(),
+                      thread_host_.io_thread->GetTaskRunner()) {
+    fixture_.AddNativeCallback(
+        "Finish", CREATE_NATIVE_ENTRY([this](Dart_NativeArguments args) {
+          finish_latch_.Signal();
+        }));
+    auto settings = fixture_.CreateSettingsForFixture();
+    shell_ = Shell::Create(
+        flutter::PlatformData(), task_runners_, settings,
+        [](Shell& shell) {
+          return std::make_unique<PlatformView>(shell, shell.GetTaskRunners());
+        },
+        [](Shell& shell) { return std::make_unique<Rasterizer>(shell); });
+    FML_CHECK(shell_ && shell_->IsSetup());
+
+    auto run_configuration = RunConfiguration::InferFromSettings(settings);
+    run_configuration.SetEntrypoint(entrypoint);
+    RunOnPlatformThread([&]() {
+      shell_->RunEngine(std::move(run_configuration), [](auto result) {
+        FML_CHECK(result == Engine::RunStatus::Success);
+      });
+    });
+
+    // Wait for the entrypoint to install its dispatcher callbacks.
+    WaitForFinish();
+  }
+
+  ~ShellHarness() {
+    // Shutdown must occur synchronously on the platform thread.
+    RunOnPlatformThread([this]() { shell_.reset(); });
+  }
+
+  Shell* shell() { return shell_.get(); }
+
+  // Runs |task| on the platform thread and waits for it to finish.
+  void RunOnPlatformThread(const fml::closure& task) {
+    fml::AutoResetWaitableEvent latch;
+    fml::TaskRunner::RunNowOrPostTask(
+        thread_host_.platform_thread->GetTaskRunner(), [&]() {
+          task();
+          latch.Signal();
+        });
+    latch.Wait();
+  }
+
+  void WaitForFinish() { finish_latch_.Wait(); }
+
+ private:
+  Fixture fixture_;
+  ThreadHost thread_host_;
+  TaskRunners task_runners_;
+  std::unique_ptr<Shell> shell_;
+  fml::AutoResetWaitableEvent finish_latch_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ShellHarness);
+};
+
+}  // namespace
+
 static void BM_PlatformMessageResponseDartComplete(benchmark::State& state) {
   ThreadHost thread_host(ThreadHost::ThreadHostConfig(
       "test", ThreadHost::Type::Platform | ThreadHost::Type::RASTER |
@@ -34,6 +141,7 @@ static void BM_PlatformMessageResponseDartComplete(benchmark::State& state) {
       testing::RunDartCodeInIsolate(vm_ref, settings, task_runners, "main", {},
                                     testing::GetDefaultKernelFilePath(), {});
 
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     state.PauseTiming();
     bool successful = isolate->RunInIsolateScope([&]() -> bool {
@@ -78,6 +186,7 @@ static void BM_PathVolatilityTracker(benchmark::State& state) {
 
   VolatilePathTracker tracker(task_runners.GetUITaskRunner(), true);
 
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     std::vector<std::shared_ptr<VolatilePathTracker::TrackedPath>> paths;
     constexpr int path_count = 1000;
@@ -112,9 +221,174 @@ static void BM_PathVolatilityTracker(benchmark::State& state) {
   }
 }
 
+// Round trips a platform message of the given size to a Dart handler that
+// echoes its payload back, measuring the full embedder-visible send/response
+// crossing through PlatformConfiguration.
+static void BM_PlatformMessageRoundTrip(benchmark::State& state) {
+  ShellHarness harness("platformMessageEcho");
+  const size_t message_size = state.range(0);
+  std::vector<uint8_t> payload(message_size, 0x42);
+
+  fml::AutoResetWaitableEvent response_latch;
+  benchmarking::ScopedPerfCounters perf(state);
+  auto start = fml::TimePoint::Now();
+  while (state.KeepRunning()) {
+    auto message = std::make_unique<PlatformMessage>(
+        "benchmark/echo",
+        fml::MallocMapping::Copy(payload.data(), payload.size()),
+        fml::MakeRefCounted<LatchedMessageResponse>(&response_latch));
+    harness.RunOnPlatformThread(fml::MakeCopyable(
+        [&harness, message = std::move(message)]() mutable {
+          harness.shell()->GetPlatformView()->DispatchPlatformMessage(
+              std::move(message));
+        }));
+    response_latch.Wait();
+  }
+  auto elapsed = fml::TimePoint::Now() - start;
+  perf.StopAndReport();
+  state.counters["ns/op"] = benchmark::Counter(
+      static_cast<double>(elapsed.ToNanoseconds()) / state.iterations());
+}
+
+// Dispatches pointer packets of the given sample count to a Dart
+// onPointerDataPacket handler that signals back per packet, measuring
+// dispatch-to-Dart latency per pointer sample.
+static void BM_PointerDataPacketDispatch(benchmark::State& state) {
+  ShellHarness harness("pointerDataPacketLatency");
+  const size_t pointer_count = state.range(0);
+
+  benchmarking::ScopedPerfCounters perf(state);
+  auto start = fml::TimePoint::Now();
+  while (state.KeepRunning()) {
+    auto packet = std::make_unique<PointerDataPacket>(pointer_count);
+    for (size_t i = 0; i < pointer_count; i++) {
+      PointerData data;
+      data.Clear();
+      data.time_stamp = i;
+      data.change = PointerData::Change::kMove;
+      data.kind = PointerData::DeviceKind::kTouch;
+      data.physical_x = i;
+      data.physical_y = i;
+      packet->SetPointerData(i, data);
+    }
+    harness.RunOnPlatformThread(
+        fml::MakeCopyable([&harness, packet = std::move(packet)]() mutable {
+          harness.shell()->GetPlatformView()->DispatchPointerDataPacket(
+              std::move(packet));
+        }));
+    harness.WaitForFinish();
+  }
+  auto elapsed = fml::TimePoint::Now() - start;
+  perf.StopAndReport();
+  state.counters["ns/op"] =
+      benchmark::Counter(static_cast<double>(elapsed.ToNanoseconds()) /
+                         (state.iterations() * pointer_count));
+}
+
+// Has Dart build and dispose a SemanticsUpdate of the given node count,
+// measuring the per-node cost of moving semantics data across the FFI
+// boundary into the engine-side representation.
+static void BM_SemanticsUpdateTransfer(benchmark::State& state) {
+  ThreadHost thread_host(ThreadHost::ThreadHostConfig(
+      "test", ThreadHost::Type::Platform | ThreadHost::Type::RASTER |
+                  ThreadHost::Type::IO | ThreadHost::Type::UI));
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  Fixture fixture;
+  auto settings = fixture.CreateSettingsForFixture();
+  auto vm_ref = DartVMRef::Create(settings);
+  auto isolate =
+      testing::RunDartCodeInIsolate(vm_ref, settings, task_runners, "main", {},
+                                    testing::GetDefaultKernelFilePath(), {});
+  const int64_t node_count = state.range(0);
+
+  benchmarking::ScopedPerfCounters perf(state);
+  auto start = fml::TimePoint::Now();
+  while (state.KeepRunning()) {
+    bool successful = isolate->RunInIsolateScope([node_count]() -> bool {
+      Dart_Handle args[] = {Dart_NewInteger(node_count)};
+      Dart_Handle result =
+          Dart_Invoke(Dart_RootLibrary(),
+                      tonic::ToDart("buildSemanticsUpdate"), 1, args);
+      return !tonic::LogIfError(result);
+    });
+    FML_CHECK(successful);
+  }
+  auto elapsed = fml::TimePoint::Now() - start;
+  perf.StopAndReport();
+  state.counters["ns/op"] =
+      benchmark::Counter(static_cast<double>(elapsed.ToNanoseconds()) /
+                         (state.iterations() * node_count));
+}
+
+// Has Dart record a fixed number of canvas calls of one op type into a
+// picture, measuring per-op recording throughput across the FFI boundary.
+static void BM_CanvasRecordOps(benchmark::State& state, const char* op_type) {
+  ThreadHost thread_host(ThreadHost::ThreadHostConfig(
+      "test", ThreadHost::Type::Platform | ThreadHost::Type::RASTER |
+                  ThreadHost::Type::IO | ThreadHost::Type::UI));
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  Fixture fixture;
+  auto settings = fixture.CreateSettingsForFixture();
+  auto vm_ref = DartVMRef::Create(settings);
+  auto isolate =
+      testing::RunDartCodeInIsolate(vm_ref, settings, task_runners, "main", {},
+                                    testing::GetDefaultKernelFilePath(), {});
+  constexpr int64_t op_count = 1000;
+
+  benchmarking::ScopedPerfCounters perf(state);
+  auto start = fml::TimePoint::Now();
+  while (state.KeepRunning()) {
+    bool successful = isolate->RunInIsolateScope([op_type]() -> bool {
+      Dart_Handle args[] = {tonic::ToDart(op_type), Dart_NewInteger(op_count)};
+      Dart_Handle result = Dart_Invoke(
+          Dart_RootLibrary(), tonic::ToDart("recordCanvasOps"), 2, args);
+      return !tonic::LogIfError(result);
+    });
+    FML_CHECK(successful);
+  }
+  auto elapsed = fml::TimePoint::Now() - start;
+  perf.StopAndReport();
+  state.counters["ns/op"] =
+      benchmark::Counter(static_cast<double>(elapsed.ToNanoseconds()) /
+                         (state.iterations() * op_count));
+}
+
 BENCHMARK(BM_PlatformMessageResponseDartComplete)
     ->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_PathVolatilityTracker)->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_PlatformMessageRoundTrip)
+    ->Arg(256)
+    ->Arg(16 << 10)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_PointerDataPacketDispatch)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(128)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_SemanticsUpdateTransfer)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(128)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_CanvasRecordOps, drawRect, "drawRect")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_CanvasRecordOps, drawLine, "drawLine")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_CanvasRecordOps, drawCircle, "drawCircle")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_CanvasRecordOps, drawPath, "drawPath")
+    ->Unit(benchmark::kMicrosecond);
+
 }  // namespace flutter
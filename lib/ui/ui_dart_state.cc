@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include <utility>
+#include <vector>
 
 #include "flutter/fml/message_loop.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
@@ -86,6 +87,29 @@ bool UIDartState::IsImpellerEnabled() const {
   return context_.enable_impeller;
 }
 
+void UIDartState::AdjustAllocationBytes(AllocationCategory category,
+                                        int64_t delta) {
+  allocation_bytes_[static_cast<size_t>(category)].fetch_add(
+      delta, std::memory_order_relaxed);
+}
+
+int64_t UIDartState::GetAllocationBytes(AllocationCategory category) const {
+  return allocation_bytes_[static_cast<size_t>(category)].load(
+      std::memory_order_relaxed);
+}
+
+Dart_Handle UIDartState::GetEngineAllocationBytes() {
+  auto* state = UIDartState::Current();
+  std::vector<int64_t> counters(kAllocationCategoryCount, 0);
+  if (state) {
+    for (size_t i = 0; i < kAllocationCategoryCount; i++) {
+      counters[i] =
+          state->GetAllocationBytes(static_cast<AllocationCategory>(i));
+    }
+  }
+  return tonic::DartConverter<std::vector<int64_t>>::ToDart(counters);
+}
+
 void UIDartState::DidSetIsolate() {
   main_port_ = Dart_GetMainPortId();
   std::ostringstream debug_name;
@@ -5,6 +5,9 @@
 #ifndef FLUTTER_LIB_UI_UI_DART_STATE_H_
 #define FLUTTER_LIB_UI_UI_DART_STATE_H_
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -177,6 +180,30 @@ class UIDartState : public tonic::DartState {
   /// Whether Impeller is enabled for this application.
   bool IsImpellerEnabled() const;
 
+  /// Categories of engine-side memory attributed to this isolate. Used to
+  /// index the per-isolate allocation counters maintained by
+  /// AdjustAllocationBytes.
+  enum class AllocationCategory : size_t {
+    kDisplayList = 0,
+    kImage,
+    kPath,
+    kSemantics,
+  };
+
+  static constexpr size_t kAllocationCategoryCount = 4;
+
+  /// Adds (or, for a negative delta, subtracts) bytes from the counter for
+  /// the given category. Safe to call from any thread.
+  void AdjustAllocationBytes(AllocationCategory category, int64_t delta);
+
+  /// Returns the number of engine-side bytes currently attributed to this
+  /// isolate for the given category.
+  int64_t GetAllocationBytes(AllocationCategory category) const;
+
+  /// Returns the current isolate's allocation counters as a list of four
+  /// integers: display list, image, path and semantics bytes, in that order.
+  static Dart_Handle GetEngineAllocationBytes();
+
  protected:
   UIDartState(TaskObserverAdd add_callback,
               TaskObserverRemove remove_callback,
@@ -213,6 +240,12 @@ class UIDartState : public tonic::DartState {
   const bool enable_skparagraph_;
   UIDartState::Context context_;
 
+  // Engine-side bytes attributed to this isolate, indexed by
+  // AllocationCategory. Atomic because image resources may be released from
+  // threads other than the UI thread.
+  std::array<std::atomic<int64_t>, kAllocationCategoryCount>
+      allocation_bytes_ = {};
+
   void AddOrRemoveTaskObserver(bool add);
 };
 
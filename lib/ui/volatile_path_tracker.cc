@@ -21,7 +21,8 @@ void VolatilePathTracker::Track(const std::shared_ptr<TrackedPath>& path) {
     path->path.setIsVolatile(false);
     return;
   }
-  paths_.push_back(path);
+  buckets_[(frame_index_ + kFramesOfVolatility) % kBucketCount].push_back(
+      path);
 }
 
 void VolatilePathTracker::OnFrame() {
@@ -30,21 +31,20 @@ void VolatilePathTracker::OnFrame() {
     return;
   }
 
-  paths_.erase(std::remove_if(paths_.begin(), paths_.end(),
-                              [](const std::weak_ptr<TrackedPath>& weak_path) {
-                                auto path = weak_path.lock();
-                                if (!path) {
-                                  return true;
-                                }
-                                path->frame_count++;
-                                if (path->frame_count >= kFramesOfVolatility) {
-                                  path->path.setIsVolatile(false);
-                                  path->tracking_volatility = false;
-                                  return true;
-                                }
-                                return false;
-                              }),
-               paths_.end());
+  // Only the bucket scheduled for this frame matures; paths in the other
+  // buckets are left untouched. Paths released by the Dart VM before their
+  // bucket matures are dropped here without ever being visited in between.
+  frame_index_ = (frame_index_ + 1) % kBucketCount;
+  std::vector<std::weak_ptr<TrackedPath>>& matured = buckets_[frame_index_];
+  for (const std::weak_ptr<TrackedPath>& weak_path : matured) {
+    auto path = weak_path.lock();
+    if (!path) {
+      continue;
+    }
+    path->path.setIsVolatile(false);
+    path->tracking_volatility = false;
+  }
+  matured.clear();
 }
 
 }  // namespace flutter
@@ -5,9 +5,8 @@
 #ifndef FLUTTER_LIB_VOLATILE_PATH_TRACKER_H_
 #define FLUTTER_LIB_VOLATILE_PATH_TRACKER_H_
 
-#include <deque>
+#include <array>
 #include <memory>
-#include <mutex>
 #include <vector>
 
 #include "flutter/fml/macros.h"
@@ -38,7 +37,6 @@ class VolatilePathTracker {
   /// The fields of this struct must only accessed on the UI task runner.
   struct TrackedPath {
     bool tracking_volatility = false;
-    int frame_count = 0;
     SkPath path;
   };
 
@@ -65,8 +63,15 @@ class VolatilePathTracker {
   bool enabled() const { return enabled_; }
 
  private:
+  // Paths are bucketed by the frame on which they will mature, so OnFrame
+  // only visits the paths whose volatility flips this frame instead of
+  // walking every tracked path. The extra bucket holds paths tracked since
+  // the last OnFrame.
+  static constexpr size_t kBucketCount = kFramesOfVolatility + 1;
+
   fml::RefPtr<fml::TaskRunner> ui_task_runner_;
-  std::vector<std::weak_ptr<TrackedPath>> paths_;
+  std::array<std::vector<std::weak_ptr<TrackedPath>>, kBucketCount> buckets_;
+  size_t frame_index_ = 0;
   bool enabled_ = true;
 
   friend class testing::ShellTest;
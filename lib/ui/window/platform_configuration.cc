@@ -26,6 +26,25 @@ Dart_Handle ToByteData(const fml::Mapping& buffer) {
   return tonic::DartByteData::Create(buffer.GetMapping(), buffer.GetSize());
 }
 
+void MappingFinalizer(void* isolate_callback_data, void* peer) {
+  delete static_cast<fml::Mapping*>(peer);
+}
+
+// Hand the mapping to Dart as an external typed data view without copying
+// it. The Dart GC owns the mapping from here on and frees it through the
+// finalizer once the view is collected.
+Dart_Handle ToExternalByteData(std::unique_ptr<fml::Mapping> mapping) {
+  const void* data = mapping->GetMapping();
+  const intptr_t size = mapping->GetSize();
+  return Dart_NewUnmodifiableExternalTypedDataWithFinalizer(
+      /*type=*/Dart_TypedData_kByteData,
+      /*data=*/data,
+      /*length=*/size,
+      /*peer=*/mapping.release(),
+      /*external_allocation_size=*/size,
+      /*callback=*/MappingFinalizer);
+}
+
 }  // namespace
 
 PlatformConfigurationClient::~PlatformConfigurationClient() {}
@@ -150,8 +169,20 @@ void PlatformConfiguration::DispatchPlatformMessage(
     return;
   }
   tonic::DartState::Scope scope(dart_state);
-  Dart_Handle data_handle =
-      (message->hasData()) ? ToByteData(message->data()) : Dart_Null();
+  Dart_Handle data_handle = Dart_Null();
+  if (message->hasSharedData()) {
+    data_handle = ToExternalByteData(message->releaseSharedData());
+  } else if (message->hasData()) {
+    if (message->data().GetSize() >
+        tonic::DartByteData::kExternalSizeThreshold) {
+      // Large payloads skip the copy into the Dart heap; the message's
+      // backing store is handed off instead.
+      data_handle = ToExternalByteData(
+          std::make_unique<fml::MallocMapping>(message->releaseData()));
+    } else {
+      data_handle = ToByteData(message->data());
+    }
+  }
   if (Dart_IsError(data_handle)) {
     FML_DLOG(WARNING)
         << "Dropping platform message because of a Dart error on channel: "
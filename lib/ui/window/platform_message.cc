@@ -15,6 +15,15 @@ PlatformMessage::PlatformMessage(std::string channel,
       data_(std::move(data)),
       hasData_(true),
       response_(std::move(response)) {}
+PlatformMessage::PlatformMessage(std::string channel,
+                                 std::unique_ptr<fml::Mapping> shared_data,
+                                 fml::RefPtr<PlatformMessageResponse> response)
+    : channel_(std::move(channel)),
+      data_(),
+      shared_data_(std::move(shared_data)),
+      hasData_(false),
+      response_(std::move(response)) {}
+
 PlatformMessage::PlatformMessage(std::string channel,
                                  fml::RefPtr<PlatformMessageResponse> response)
     : channel_(std::move(channel)),
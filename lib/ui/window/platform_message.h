@@ -5,20 +5,37 @@
 #ifndef FLUTTER_LIB_UI_PLATFORM_PLATFORM_MESSAGE_H_
 #define FLUTTER_LIB_UI_PLATFORM_PLATFORM_MESSAGE_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "flutter/fml/mapping.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/memory/ref_ptr.h"
 #include "flutter/lib/ui/window/platform_message_response.h"
 
 namespace flutter {
 
+// Payloads at or below this size are cheaper to copy into the Dart heap than
+// to track as external references. Embedders should prefer the shared-data
+// constructor above it; framework-internal channel messages are well below
+// it, which keeps them readable through |PlatformMessage::data|.
+constexpr size_t kSharedPlatformMessageSizeThreshold = 32 * 1024;
+
 class PlatformMessage {
  public:
   PlatformMessage(std::string channel,
                   fml::MallocMapping data,
                   fml::RefPtr<PlatformMessageResponse> response);
+  // Carry an externally owned payload (shared memory, a retained platform
+  // buffer, etc.) without copying it. The mapping travels with the message
+  // and is handed off to Dart as an external typed data view; its ownership
+  // transfers to the Dart GC when the message is dispatched. Shared payloads
+  // are not visible through |data| and must not target framework-internal
+  // channels, which parse |data| directly.
+  PlatformMessage(std::string channel,
+                  std::unique_ptr<fml::Mapping> shared_data,
+                  fml::RefPtr<PlatformMessageResponse> response);
   PlatformMessage(std::string channel,
                   fml::RefPtr<PlatformMessageResponse> response);
   ~PlatformMessage();
@@ -26,16 +43,21 @@ class PlatformMessage {
   const std::string& channel() const { return channel_; }
   const fml::MallocMapping& data() const { return data_; }
   bool hasData() { return hasData_; }
+  bool hasSharedData() const { return shared_data_ != nullptr; }
 
   const fml::RefPtr<PlatformMessageResponse>& response() const {
     return response_;
   }
 
   fml::MallocMapping releaseData() { return std::move(data_); }
+  std::unique_ptr<fml::Mapping> releaseSharedData() {
+    return std::move(shared_data_);
+  }
 
  private:
   std::string channel_;
   fml::MallocMapping data_;
+  std::unique_ptr<fml::Mapping> shared_data_;
   bool hasData_;
   fml::RefPtr<PlatformMessageResponse> response_;
 };
@@ -5,6 +5,7 @@
 #include "flutter/lib/ui/window/pointer_data_packet.h"
 
 #include <cstring>
+#include <utility>
 
 namespace flutter {
 
@@ -14,10 +15,27 @@ PointerDataPacket::PointerDataPacket(size_t count)
 PointerDataPacket::PointerDataPacket(uint8_t* data, size_t num_bytes)
     : data_(data, data + num_bytes) {}
 
+PointerDataPacket::PointerDataPacket(std::vector<uint8_t> data)
+    : data_(std::move(data)) {}
+
 PointerDataPacket::~PointerDataPacket() = default;
 
 void PointerDataPacket::SetPointerData(size_t i, const PointerData& data) {
   memcpy(&data_[i * sizeof(PointerData)], &data, sizeof(PointerData));
 }
 
+PointerData PointerDataPacket::GetPointerData(size_t i) const {
+  PointerData result;
+  memcpy(&result, &data_[i * sizeof(PointerData)], sizeof(PointerData));
+  return result;
+}
+
+size_t PointerDataPacket::GetLength() const {
+  return data_.size() / sizeof(PointerData);
+}
+
+std::vector<uint8_t> PointerDataPacket::TakeData() {
+  return std::move(data_);
+}
+
 }  // namespace flutter
@@ -17,11 +17,18 @@ class PointerDataPacket {
  public:
   explicit PointerDataPacket(size_t count);
   PointerDataPacket(uint8_t* data, size_t num_bytes);
+  explicit PointerDataPacket(std::vector<uint8_t> data);
   ~PointerDataPacket();
 
   void SetPointerData(size_t i, const PointerData& data);
+  PointerData GetPointerData(size_t i) const;
+  size_t GetLength() const;
   const std::vector<uint8_t>& data() const { return data_; }
 
+  // Releases the underlying byte buffer, leaving this packet empty. Allows
+  // callers that are done with a packet to recycle its storage.
+  std::vector<uint8_t> TakeData();
+
  private:
   std::vector<uint8_t> data_;
 
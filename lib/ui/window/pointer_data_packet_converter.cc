@@ -6,6 +6,7 @@
 
 #include <cmath>
 #include <cstring>
+#include <utility>
 
 #include "flutter/fml/logging.h"
 
@@ -18,24 +19,30 @@ PointerDataPacketConverter::~PointerDataPacketConverter() = default;
 std::unique_ptr<PointerDataPacket> PointerDataPacketConverter::Convert(
     std::unique_ptr<PointerDataPacket> packet) {
   size_t kBytesPerPointerData = kPointerDataFieldCount * kBytesPerField;
-  auto buffer = packet->data();
+  const std::vector<uint8_t>& buffer = packet->data();
   size_t buffer_length = buffer.size();
 
-  std::vector<PointerData> converted_pointers;
   // Converts each pointer data in the buffer and stores it in the
-  // converted_pointers.
+  // converted_pointers_ scratch vector. The vector keeps its capacity across
+  // packets, so synthesized events only allocate while a gesture is still
+  // growing the high-water mark.
+  converted_pointers_.clear();
   for (size_t i = 0; i < buffer_length / kBytesPerPointerData; i++) {
     PointerData pointer_data;
     memcpy(&pointer_data, &buffer[i * kBytesPerPointerData],
            sizeof(PointerData));
-    ConvertPointerData(pointer_data, converted_pointers);
+    ConvertPointerData(pointer_data, converted_pointers_);
   }
 
-  // Writes converted_pointers into converted_packet.
-  auto converted_packet =
-      std::make_unique<flutter::PointerDataPacket>(converted_pointers.size());
+  // Writes the converted pointers back over the inbound packet's storage.
+  // The inbound packet is about to be destroyed anyway; adopting its buffer
+  // avoids allocating a fresh packet per conversion.
+  std::vector<uint8_t> converted_buffer = packet->TakeData();
+  converted_buffer.resize(converted_pointers_.size() * kBytesPerPointerData);
+  auto converted_packet = std::make_unique<flutter::PointerDataPacket>(
+      std::move(converted_buffer));
   size_t count = 0;
-  for (auto& converted_pointer : converted_pointers) {
+  for (const PointerData& converted_pointer : converted_pointers_) {
     converted_packet->SetPointerData(count++, converted_pointer);
   }
 
@@ -101,6 +101,10 @@ class PointerDataPacketConverter {
 
   int64_t pointer_;
 
+  // Scratch space reused across Convert calls so steady-state conversion is
+  // allocation-free. Cleared at the start of every conversion.
+  std::vector<PointerData> converted_pointers_;
+
   void ConvertPointerData(PointerData pointer_data,
                           std::vector<PointerData>& converted_pointers);
 
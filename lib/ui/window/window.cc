@@ -13,29 +13,60 @@
 
 namespace flutter {
 
+namespace {
+
+void PointerDataPacketFinalizer(void* isolate_callback_data, void* peer) {
+  delete static_cast<PointerDataPacket*>(peer);
+}
+
+}  // namespace
+
 Window::Window(int64_t window_id, ViewportMetrics metrics)
     : window_id_(window_id), viewport_metrics_(std::move(metrics)) {
   library_.Set(tonic::DartState::Current(),
                Dart_LookupLibrary(tonic::ToDart("dart:ui")));
+  dispatch_pointer_data_packet_.Set(
+      tonic::DartState::Current(),
+      Dart_GetField(library_.value(),
+                    tonic::ToDart("_dispatchPointerDataPacket")));
 }
 
 Window::~Window() {}
 
-void Window::DispatchPointerDataPacket(const PointerDataPacket& packet) {
+void Window::DispatchPointerDataPacket(
+    std::unique_ptr<PointerDataPacket> packet) {
   std::shared_ptr<tonic::DartState> dart_state = library_.dart_state().lock();
   if (!dart_state) {
     return;
   }
   tonic::DartState::Scope scope(dart_state);
 
-  const std::vector<uint8_t>& buffer = packet.data();
-  Dart_Handle data_handle =
-      tonic::DartByteData::Create(buffer.data(), buffer.size());
+  const std::vector<uint8_t>& buffer = packet->data();
+  Dart_Handle data_handle;
+  if (buffer.size() <= tonic::DartByteData::kExternalSizeThreshold) {
+    // Typical packets hold one or two samples; copying those into the Dart
+    // heap is cheaper than an external typed data embedder object.
+    data_handle = tonic::DartByteData::Create(buffer.data(), buffer.size());
+  } else {
+    // Coalesced packets (e.g. high-rate stylus input resampled per frame)
+    // are handed off without copying; the finalizer frees the packet once
+    // the framework is done with the view.
+    data_handle = Dart_NewUnmodifiableExternalTypedDataWithFinalizer(
+        /*type=*/Dart_TypedData_kByteData,
+        /*data=*/buffer.data(),
+        /*length=*/buffer.size(),
+        /*peer=*/packet.get(),
+        /*external_allocation_size=*/buffer.size(),
+        /*callback=*/PointerDataPacketFinalizer);
+    if (!Dart_IsError(data_handle)) {
+      packet.release();
+    }
+  }
   if (Dart_IsError(data_handle)) {
     return;
   }
-  tonic::CheckAndHandleError(tonic::DartInvokeField(
-      library_.value(), "_dispatchPointerDataPacket", {data_handle}));
+  tonic::CheckAndHandleError(
+      tonic::DartInvoke(dispatch_pointer_data_packet_.Get(), {data_handle}));
 }
 
 void Window::UpdateWindowMetrics(const ViewportMetrics& metrics) {
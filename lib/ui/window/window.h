@@ -6,6 +6,7 @@
 #define FLUTTER_LIB_UI_WINDOW_WINDOW_H_
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -29,12 +30,17 @@ class Window final {
   const ViewportMetrics& viewport_metrics() const { return viewport_metrics_; }
 
   // Dispatch a packet to the framework that indicates one or a few pointer
-  // events.
-  void DispatchPointerDataPacket(const PointerDataPacket& packet);
+  // events. Large packets are handed off to Dart as external typed data
+  // without copying; the packet is kept alive by the Dart GC until the view
+  // is collected.
+  void DispatchPointerDataPacket(std::unique_ptr<PointerDataPacket> packet);
   void UpdateWindowMetrics(const ViewportMetrics& metrics);
 
  private:
   tonic::DartPersistentValue library_;
+  // Cached closure of the dart:ui _dispatchPointerDataPacket hook, so
+  // high-frequency dispatches skip the per-event library field lookup.
+  tonic::DartPersistentValue dispatch_pointer_data_packet_;
   int64_t window_id_;
   ViewportMetrics viewport_metrics_;
 };
@@ -252,6 +252,12 @@ enum FramePhase {
   rasterStart,
   rasterFinish,
   rasterFinishWallTime,
+  bufferAcquireStart,
+  bufferAcquireFinish,
+  rasterEncodeFinish,
+  presentStart,
+  presentFinish,
+  gpuWorkFinish,
 }
 
 enum _FrameTimingInfo {
@@ -270,6 +276,12 @@ class FrameTiming {
     required int rasterStart,
     required int rasterFinish,
     required int rasterFinishWallTime,
+    int bufferAcquireStart = 0,
+    int bufferAcquireFinish = 0,
+    int rasterEncodeFinish = 0,
+    int presentStart = 0,
+    int presentFinish = 0,
+    int gpuWorkFinish = 0,
     int layerCacheCount = 0,
     int layerCacheBytes = 0,
     int pictureCacheCount = 0,
@@ -283,6 +295,12 @@ class FrameTiming {
       rasterStart,
       rasterFinish,
       rasterFinishWallTime,
+      bufferAcquireStart,
+      bufferAcquireFinish,
+      rasterEncodeFinish,
+      presentStart,
+      presentFinish,
+      gpuWorkFinish,
       layerCacheCount,
       layerCacheBytes,
       pictureCacheCount,
@@ -308,6 +326,18 @@ class FrameTiming {
   Duration get rasterDuration =>
       _rawDuration(FramePhase.rasterFinish) - _rawDuration(FramePhase.rasterStart);
 
+  Duration get bufferAcquireDuration =>
+      _rawDuration(FramePhase.bufferAcquireFinish) - _rawDuration(FramePhase.bufferAcquireStart);
+
+  Duration get rasterEncodeDuration =>
+      _rawDuration(FramePhase.rasterEncodeFinish) - _rawDuration(FramePhase.rasterStart);
+
+  Duration get presentDuration =>
+      _rawDuration(FramePhase.presentFinish) - _rawDuration(FramePhase.presentStart);
+
+  Duration get gpuDuration =>
+      _rawDuration(FramePhase.gpuWorkFinish) - _rawDuration(FramePhase.rasterStart);
+
   Duration get vsyncOverhead => _rawDuration(FramePhase.buildStart) - _rawDuration(FramePhase.vsyncStart);
 
   Duration get totalSpan =>
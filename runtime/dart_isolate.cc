@@ -15,6 +15,7 @@
 #include "flutter/lib/ui/dart_runtime_hooks.h"
 #include "flutter/lib/ui/dart_ui.h"
 #include "flutter/runtime/dart_isolate_group_data.h"
+#include "flutter/runtime/dart_isolate_warmup_pool.h"
 #include "flutter/runtime/dart_plugin_registrant.h"
 #include "flutter/runtime/dart_service_isolate.h"
 #include "flutter/runtime/dart_vm.h"
@@ -112,6 +113,20 @@ std::weak_ptr<DartIsolate> DartIsolate::CreateRunningRootIsolate(
       isolate_configuration->IsNullSafetyEnabled(*isolate_snapshot));
   isolate_flags.SetIsDontNeedSafe(isolate_snapshot->IsDontNeedSafe());
 
+  // Claim a warm isolate prepared for this snapshot if the VM's warmup pool
+  // has one. The root isolate then spawns into the warmed group, which skips
+  // kernel loading and library setup.
+  std::shared_ptr<DartIsolate> warmed_isolate;
+  if (spawning_isolate == nullptr) {
+    if (auto* vm = DartVMRef::GetRunningVM()) {
+      warmed_isolate =
+          vm->GetIsolateWarmupPool()->TakeWarmedIsolate(isolate_snapshot.get());
+      if (warmed_isolate) {
+        spawning_isolate = warmed_isolate.get();
+      }
+    }
+  }
+
   auto isolate = CreateRootIsolate(settings,                           //
                                    isolate_snapshot,                   //
                                    std::move(platform_configuration),  //
@@ -123,6 +138,17 @@ std::weak_ptr<DartIsolate> DartIsolate::CreateRunningRootIsolate(
                                    )
                      .lock();
 
+  if (warmed_isolate) {
+    // Whether or not the spawn succeeded, the claimed warm member has served
+    // its purpose; a successful spawn keeps the warmed group alive through
+    // the new root isolate.
+    if (!warmed_isolate->Shutdown()) {
+      FML_DLOG(ERROR) << "Could not shut down the claimed warm isolate.";
+    }
+    warmed_isolate.reset();
+    spawning_isolate = nullptr;
+  }
+
   if (!isolate) {
     FML_LOG(ERROR) << "Could not create root isolate.";
     return {};
@@ -809,7 +835,9 @@ Dart_Isolate DartIsolate::DartCreateAndStartServiceIsolate(
           settings.disable_service_auth_codes,  // disable VM service auth codes
           settings.enable_service_port_fallback,  // enable fallback to port 0
                                                   // when bind fails.
-          error                                   // error (out)
+          settings.defer_observatory_server_start,  // defer the web server
+                                                    // startup
+          error                                     // error (out)
           )) {
     // Error is populated by call to startup.
     FML_DLOG(ERROR) << *error;
@@ -402,6 +402,7 @@ class DartIsolate : public UIDartState {
     FML_DISALLOW_COPY_AND_ASSIGN(AutoFireClosure);
   };
   friend class DartVM;
+  friend class DartIsolateWarmupPool;
 
   Phase phase_ = Phase::Unknown;
   std::vector<std::shared_ptr<const fml::Mapping>> kernel_buffers_;
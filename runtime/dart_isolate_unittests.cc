@@ -77,6 +77,57 @@ TEST_F(DartIsolateTest, RootIsolateCreationAndShutdown) {
   ASSERT_TRUE(root_isolate->Shutdown());
 }
 
+TEST_F(DartIsolateTest, WarmIsolateIsClaimedForRootIsolateCreation) {
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+  auto settings = CreateSettingsForFixture();
+  auto vm_ref = DartVMRef::Create(settings);
+  ASSERT_TRUE(vm_ref);
+  auto vm_data = vm_ref.GetVMData();
+  ASSERT_TRUE(vm_data);
+
+  const auto& warmup_pool = vm_ref->GetIsolateWarmupPool();
+  ASSERT_TRUE(warmup_pool->WarmOne(
+      vm_data->GetSettings(),                          // settings
+      vm_data->GetIsolateSnapshot(),                   // isolate snapshot
+      IsolateConfiguration::InferFromSettings(settings),  // configuration
+      "main.dart",                                     // advisory URI
+      "main"                                           // advisory entrypoint
+      ));
+  ASSERT_EQ(warmup_pool->GetWarmedCount(), 1u);
+
+  TaskRunners task_runners(GetCurrentTestName(),    //
+                           GetCurrentTaskRunner(),  //
+                           GetCurrentTaskRunner(),  //
+                           GetCurrentTaskRunner(),  //
+                           GetCurrentTaskRunner()   //
+  );
+  auto isolate_configuration =
+      IsolateConfiguration::InferFromSettings(settings);
+  UIDartState::Context context(task_runners);
+  context.advisory_script_uri = "main.dart";
+  context.advisory_script_entrypoint = "main";
+  auto weak_isolate = DartIsolate::CreateRunningRootIsolate(
+      vm_data->GetSettings(),              // settings
+      vm_data->GetIsolateSnapshot(),       // isolate snapshot
+      nullptr,                             // platform configuration
+      DartIsolate::Flags{},                // flags
+      nullptr,                             // root_isolate_create_callback
+      settings.isolate_create_callback,    // isolate create callback
+      settings.isolate_shutdown_callback,  // isolate shutdown callback
+      "main",                              // dart entrypoint
+      std::nullopt,                        // dart entrypoint library
+      {},                                  // dart entrypoint arguments
+      std::move(isolate_configuration),    // isolate configuration
+      context                              // engine context
+  );
+  auto root_isolate = weak_isolate.lock();
+  ASSERT_TRUE(root_isolate);
+  ASSERT_EQ(root_isolate->GetPhase(), DartIsolate::Phase::Running);
+  // The warm member was claimed and consumed by the launch.
+  ASSERT_EQ(warmup_pool->GetWarmedCount(), 0u);
+  ASSERT_TRUE(root_isolate->Shutdown());
+}
+
 TEST_F(DartIsolateTest, IsolateShutdownCallbackIsInIsolateScope) {
   ASSERT_FALSE(DartVMRef::IsInstanceRunning());
   auto settings = CreateSettingsForFixture();
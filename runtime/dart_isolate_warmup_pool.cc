@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/runtime/dart_isolate_warmup_pool.h"
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "flutter/runtime/dart_isolate.h"
+#include "flutter/runtime/dart_isolate_group_data.h"
+#include "flutter/runtime/isolate_configuration.h"
+
+namespace flutter {
+
+DartIsolateWarmupPool::DartIsolateWarmupPool() = default;
+
+DartIsolateWarmupPool::~DartIsolateWarmupPool() {
+  std::vector<std::shared_ptr<DartIsolate>> leftovers;
+  {
+    std::scoped_lock lock(pool_mutex_);
+    leftovers.swap(warm_isolates_);
+  }
+  for (const auto& isolate : leftovers) {
+    if (!isolate->Shutdown()) {
+      FML_DLOG(ERROR) << "Could not shut down a parked warm isolate.";
+    }
+  }
+}
+
+bool DartIsolateWarmupPool::WarmOne(
+    const Settings& settings,
+    const fml::RefPtr<const DartSnapshot>& isolate_snapshot,
+    std::unique_ptr<IsolateConfiguration> isolate_configuration,
+    const std::string& advisory_script_uri,
+    const std::string& advisory_script_entrypoint) {
+  TRACE_EVENT0("flutter", "DartIsolateWarmupPool::WarmOne");
+  if (!isolate_snapshot || !isolate_configuration) {
+    return false;
+  }
+
+  // Warm isolates never run application code and have no shell, so they use
+  // placeholder task runners just like the VM service isolate spawn does.
+  TaskRunners null_task_runners(advisory_script_uri,
+                                /* platform= */ nullptr,
+                                /* raster= */ nullptr,
+                                /* ui= */ nullptr,
+                                /* io= */ nullptr);
+  UIDartState::Context context(null_task_runners);
+  context.advisory_script_uri = advisory_script_uri;
+  context.advisory_script_entrypoint = advisory_script_entrypoint;
+
+  DartIsolate::Flags isolate_flags;
+  isolate_flags.SetNullSafetyEnabled(
+      isolate_configuration->IsNullSafetyEnabled(*isolate_snapshot));
+  isolate_flags.SetIsDontNeedSafe(isolate_snapshot->IsDontNeedSafe());
+
+  auto isolate = DartIsolate::CreateRootIsolate(settings,          //
+                                                isolate_snapshot,  //
+                                                nullptr,  // platform config
+                                                isolate_flags,    //
+                                                nullptr,  // create callback
+                                                nullptr,  // shutdown callback
+                                                context   //
+                                                )
+                     .lock();
+  if (!isolate) {
+    FML_LOG(ERROR) << "Could not create a warm root isolate.";
+    return false;
+  }
+
+  if (isolate->GetPhase() != DartIsolate::Phase::LibrariesSetup ||
+      !isolate_configuration->PrepareIsolate(*isolate.get()) ||
+      isolate->GetPhase() != DartIsolate::Phase::Ready) {
+    FML_LOG(ERROR) << "Could not prepare the warm isolate.";
+    if (!isolate->Shutdown()) {
+      FML_DLOG(ERROR) << "Could not shut down the unprepared warm isolate.";
+    }
+    return false;
+  }
+
+  std::scoped_lock lock(pool_mutex_);
+  warm_isolates_.push_back(std::move(isolate));
+  return true;
+}
+
+std::shared_ptr<DartIsolate> DartIsolateWarmupPool::TakeWarmedIsolate(
+    const DartSnapshot* isolate_snapshot) {
+  std::scoped_lock lock(pool_mutex_);
+  for (auto it = warm_isolates_.begin(); it != warm_isolates_.end(); it++) {
+    if ((*it)->GetIsolateGroupData().GetIsolateSnapshot().get() ==
+        isolate_snapshot) {
+      auto isolate = std::move(*it);
+      warm_isolates_.erase(it);
+      return isolate;
+    }
+  }
+  return nullptr;
+}
+
+size_t DartIsolateWarmupPool::GetWarmedCount() const {
+  std::scoped_lock lock(pool_mutex_);
+  return warm_isolates_.size();
+}
+
+}  // namespace flutter
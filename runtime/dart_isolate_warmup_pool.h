@@ -0,0 +1,90 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_RUNTIME_DART_ISOLATE_WARMUP_POOL_H_
+#define FLUTTER_RUNTIME_DART_ISOLATE_WARMUP_POOL_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "flutter/common/settings.h"
+#include "flutter/fml/macros.h"
+#include "flutter/runtime/dart_snapshot.h"
+
+namespace flutter {
+
+class DartIsolate;
+class IsolateConfiguration;
+
+//------------------------------------------------------------------------------
+/// @brief      A pool of warm root isolates managed alongside the Dart VM.
+///
+///             Root isolate creation walks through isolate group creation,
+///             library binding and isolate preparation serially on every
+///             engine launch, which dominates add-to-app engine spin-up. An
+///             embedder may warm the pool during idle time; each warm member
+///             is advanced through the phases of
+///             `DartIsolate::CreateRunningRootIsolate` up to (but not
+///             including) entrypoint invocation, using placeholder task
+///             runners like the VM service isolate does.
+///
+///             When a root isolate is later created for the same snapshot,
+///             `DartIsolate::CreateRunningRootIsolate` claims a warm member
+///             and spawns the real root isolate into the warmed group, which
+///             skips kernel loading and library setup. The claimed member is
+///             shut down once the group has a new resident.
+///
+///             Warm members must be created with the same settings and
+///             isolate configuration that the launch will use; the pool only
+///             verifies that the snapshot matches.
+///
+class DartIsolateWarmupPool {
+ public:
+  DartIsolateWarmupPool();
+
+  ~DartIsolateWarmupPool();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Creates one warm root isolate prepared up to the ready phase
+  ///             and parks it in the pool. May be called on any thread on
+  ///             which Dart isolates may be created, typically during idle
+  ///             time before an engine launch is expected.
+  ///
+  /// @return     Whether a warm isolate was created and parked.
+  ///
+  bool WarmOne(const Settings& settings,
+               const fml::RefPtr<const DartSnapshot>& isolate_snapshot,
+               std::unique_ptr<IsolateConfiguration> isolate_configuration,
+               const std::string& advisory_script_uri,
+               const std::string& advisory_script_entrypoint);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Claims a warm isolate whose group was prepared for the given
+  ///             snapshot. The caller hands the result to
+  ///             `DartIsolate::CreateRunningRootIsolate` as the spawning
+  ///             isolate and shuts it down afterwards.
+  ///
+  /// @return     A warm isolate, or nullptr if the pool has none for the
+  ///             snapshot.
+  ///
+  std::shared_ptr<DartIsolate> TakeWarmedIsolate(
+      const DartSnapshot* isolate_snapshot);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of currently parked warm isolates.
+  ///
+  size_t GetWarmedCount() const;
+
+ private:
+  mutable std::mutex pool_mutex_;
+  std::vector<std::shared_ptr<DartIsolate>> warm_isolates_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DartIsolateWarmupPool);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_RUNTIME_DART_ISOLATE_WARMUP_POOL_H_
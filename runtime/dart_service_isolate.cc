@@ -132,6 +132,7 @@ bool DartServiceIsolate::Startup(const std::string& server_ip,
                                  bool disable_origin_check,
                                  bool disable_service_auth_codes,
                                  bool enable_service_port_fallback,
+                                 bool deferred_server_start,
                                  char** error) {
   Dart_Isolate isolate = Dart_CurrentIsolate();
   FML_CHECK(isolate);
@@ -164,8 +165,12 @@ bool DartServiceIsolate::Startup(const std::string& server_ip,
   result = Dart_SetField(library, Dart_NewStringFromCString("_ip"),
                          Dart_NewStringFromCString(server_ip.c_str()));
   SHUTDOWN_ON_ERROR(result);
-  // If we have a port specified, start the server immediately.
-  bool auto_start = server_port >= 0;
+  // If we have a port specified, start the server immediately unless the
+  // embedder asked for the server startup to be deferred. A deferred server
+  // can be brought up later from any isolate via `Service.controlWebServer` in
+  // `dart:developer`; until then, no socket is bound and no HTTP machinery
+  // runs in the service isolate.
+  bool auto_start = server_port >= 0 && !deferred_server_start;
   if (server_port < 0) {
     // Adjust server_port to port 0 which will result in the first available
     // port when the HTTP server is started.
@@ -51,6 +51,17 @@ class DartServiceIsolate {
   ///                                           enabled.
   /// @param[in]  enable_service_port_fallback  If fallback to port 0 must be
   ///                                           enabled when the bind fails.
+  /// @param[in]  deferred_server_start         If the HTTP server must not be
+  ///                                           started during startup. The
+  ///                                           service isolate itself is still
+  ///                                           created and made runnable (its
+  ///                                           lifecycle is owned by the VM),
+  ///                                           but the socket bind and web
+  ///                                           server startup are skipped
+  ///                                           until a client requests the
+  ///                                           server, typically via
+  ///                                           `Service.controlWebServer` from
+  ///                                           `dart:developer`.
   /// @param      error                         The error when this method
   ///                                           returns false. This string must
   ///                                           be freed by the caller using
@@ -65,6 +76,7 @@ class DartServiceIsolate {
                       bool disable_origin_check,
                       bool disable_service_auth_codes,
                       bool enable_service_port_fallback,
+                      bool deferred_server_start,
                       char** error);
 
   //----------------------------------------------------------------------------
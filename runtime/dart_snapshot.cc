@@ -10,6 +10,7 @@
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/lib/snapshot/snapshot.h"
+#include "flutter/runtime/dart_snapshot_container.h"
 #include "flutter/runtime/dart_vm.h"
 #include "third_party/dart/runtime/include/dart_api.h"
 
@@ -32,11 +33,18 @@ const char* DartSnapshot::kIsolateInstructionsSymbol =
 static std::unique_ptr<const fml::Mapping> GetFileMapping(
     const std::string& path,
     bool executable) {
+  std::unique_ptr<fml::FileMapping> mapping;
   if (executable) {
-    return fml::FileMapping::CreateReadExecute(path);
+    mapping = fml::FileMapping::CreateReadExecute(path);
   } else {
-    return fml::FileMapping::CreateReadOnly(path);
+    mapping = fml::FileMapping::CreateReadOnly(path);
   }
+  // Tooling may package the segment compressed for slow storage media; such
+  // files are detected by magic and inflated before use.
+  if (DartSnapshotContainer::IsContainer(mapping.get())) {
+    return DartSnapshotContainer::Decompress(*mapping, executable);
+  }
+  return mapping;
 }
 
 // The first party embedders don't yet use the stable embedder API and depend on
@@ -264,6 +272,29 @@ bool DartSnapshot::IsDontNeedSafe() const {
   return true;
 }
 
+void DartSnapshot::PrefetchResidentPages() const {
+  TRACE_EVENT0("flutter", "DartSnapshot::PrefetchResidentPages");
+  if (data_) {
+    data_->Advise(fml::Mapping::ResidencyHint::kWillNeed);
+  }
+  if (instructions_) {
+    instructions_->Advise(fml::Mapping::ResidencyHint::kWillNeed);
+  }
+}
+
+void DartSnapshot::ReleaseResidentPages() const {
+  if (!IsDontNeedSafe()) {
+    return;
+  }
+  TRACE_EVENT0("flutter", "DartSnapshot::ReleaseResidentPages");
+  if (data_) {
+    data_->Advise(fml::Mapping::ResidencyHint::kDontNeed);
+  }
+  if (instructions_) {
+    instructions_->Advise(fml::Mapping::ResidencyHint::kDontNeed);
+  }
+}
+
 bool DartSnapshot::IsNullSafetyEnabled(const fml::Mapping* kernel) const {
   return ::Dart_DetectNullSafety(
       nullptr,           // script_uri (unsupported by Flutter)
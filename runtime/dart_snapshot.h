@@ -165,6 +165,21 @@ class DartSnapshot : public fml::RefCountedThreadSafe<DartSnapshot> {
   ///             safe to use with madvise(DONTNEED).
   bool IsDontNeedSafe() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Hints to the OS that the heap and instructions mappings will
+  ///             be needed shortly, typically just before VM or isolate group
+  ///             creation, so a cold launch faults the snapshot in with
+  ///             read-ahead instead of one page at a time.
+  void PrefetchResidentPages() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Hints to the OS that the snapshot pages are no longer needed,
+  ///             typically after the first frame has been rasterized, so cold
+  ///             regions can be reclaimed on low-RAM devices. Regions that are
+  ///             still hot are refaulted from the backing file on next use. A
+  ///             no-op when the mappings are not DontNeed safe.
+  void ReleaseResidentPages() const;
+
   bool IsNullSafetyEnabled(
       const fml::Mapping* application_kernel_mapping) const;
 
@@ -0,0 +1,228 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/runtime/dart_snapshot_container.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "flutter/fml/build_config.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "flutter/fml/trace_event.h"
+
+#if FML_OS_WIN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#if defined(FLUTTER_SNAPSHOT_ZSTD)
+// Provided by the build when zstd chunk support is enabled.
+#include <zstd.h>
+#endif
+
+namespace flutter {
+
+namespace {
+
+constexpr uint8_t kContainerMagic[4] = {'F', 'S', 'C', '1'};
+constexpr size_t kHeaderSize = 24;
+
+template <typename T>
+T ReadLittleEndian(const uint8_t* data) {
+  T value = 0;
+  for (size_t i = 0; i < sizeof(T); i++) {
+    value |= static_cast<T>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+/// An anonymous read-write mapping that inflation writes into and that is
+/// sealed to read-only or read-execute once the payload is in place.
+class ReservedMapping : public fml::Mapping {
+ public:
+  static std::unique_ptr<ReservedMapping> Make(size_t size) {
+#if FML_OS_WIN
+    void* memory =
+        ::VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (memory == nullptr) {
+      return nullptr;
+    }
+#else
+    void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+      return nullptr;
+    }
+#endif
+    return std::unique_ptr<ReservedMapping>(
+        new ReservedMapping(static_cast<uint8_t*>(memory), size));
+  }
+
+  ~ReservedMapping() override {
+#if FML_OS_WIN
+    ::VirtualFree(memory_, 0, MEM_RELEASE);
+#else
+    ::munmap(memory_, size_);
+#endif
+  }
+
+  bool Seal(bool executable) {
+#if FML_OS_WIN
+    DWORD old_protection = 0;
+    return ::VirtualProtect(memory_, size_,
+                            executable ? PAGE_EXECUTE_READ : PAGE_READONLY,
+                            &old_protection) != 0;
+#else
+    return ::mprotect(memory_, size_,
+                      executable ? (PROT_READ | PROT_EXEC) : PROT_READ) == 0;
+#endif
+  }
+
+  uint8_t* GetMutableMapping() { return memory_; }
+
+  size_t GetSize() const override { return size_; }
+
+  const uint8_t* GetMapping() const override { return memory_; }
+
+  bool IsDontNeedSafe() const override { return false; }
+
+ private:
+  ReservedMapping(uint8_t* memory, size_t size)
+      : memory_(memory), size_(size) {}
+
+  uint8_t* const memory_;
+  const size_t size_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ReservedMapping);
+};
+
+bool DecompressChunk(uint32_t codec,
+                     const uint8_t* compressed,
+                     size_t compressed_size,
+                     uint8_t* destination,
+                     size_t destination_size) {
+  switch (codec) {
+    case DartSnapshotContainer::kStore:
+      if (compressed_size != destination_size) {
+        return false;
+      }
+      ::memcpy(destination, compressed, compressed_size);
+      return true;
+    case DartSnapshotContainer::kZstd:
+#if defined(FLUTTER_SNAPSHOT_ZSTD)
+    {
+      const size_t inflated = ZSTD_decompress(destination, destination_size,
+                                              compressed, compressed_size);
+      return !ZSTD_isError(inflated) && inflated == destination_size;
+    }
+#else
+      return false;
+#endif
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+bool DartSnapshotContainer::IsContainer(const fml::Mapping* mapping) {
+  return mapping != nullptr && mapping->GetSize() >= kHeaderSize &&
+         ::memcmp(mapping->GetMapping(), kContainerMagic,
+                  sizeof(kContainerMagic)) == 0;
+}
+
+std::unique_ptr<fml::Mapping> DartSnapshotContainer::Decompress(
+    const fml::Mapping& mapping,
+    bool executable) {
+  TRACE_EVENT0("flutter", "DartSnapshotContainer::Decompress");
+  if (!IsContainer(&mapping)) {
+    return nullptr;
+  }
+
+  const uint8_t* data = mapping.GetMapping();
+  const size_t container_size = mapping.GetSize();
+
+  const uint32_t codec = ReadLittleEndian<uint32_t>(data + 4);
+  const uint64_t uncompressed_size = ReadLittleEndian<uint64_t>(data + 8);
+  const uint32_t chunk_size = ReadLittleEndian<uint32_t>(data + 16);
+  const uint32_t chunk_count = ReadLittleEndian<uint32_t>(data + 20);
+
+  if (uncompressed_size == 0 || chunk_size == 0 || chunk_count == 0) {
+    FML_LOG(ERROR) << "Snapshot container header is malformed.";
+    return nullptr;
+  }
+  if ((uncompressed_size + chunk_size - 1) / chunk_size != chunk_count) {
+    FML_LOG(ERROR) << "Snapshot container chunk count is inconsistent.";
+    return nullptr;
+  }
+  if (kHeaderSize + chunk_count * sizeof(uint32_t) > container_size) {
+    FML_LOG(ERROR) << "Snapshot container chunk table is truncated.";
+    return nullptr;
+  }
+
+  // Gather per-chunk payload offsets from the chunk table.
+  const uint8_t* chunk_table = data + kHeaderSize;
+  std::vector<size_t> payload_offsets(chunk_count);
+  size_t payload_offset = kHeaderSize + chunk_count * sizeof(uint32_t);
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    payload_offsets[i] = payload_offset;
+    payload_offset +=
+        ReadLittleEndian<uint32_t>(chunk_table + i * sizeof(uint32_t));
+  }
+  if (payload_offset > container_size) {
+    FML_LOG(ERROR) << "Snapshot container payload is truncated.";
+    return nullptr;
+  }
+
+  auto reserved = ReservedMapping::Make(uncompressed_size);
+  if (!reserved) {
+    FML_LOG(ERROR) << "Could not reserve memory for the inflated snapshot.";
+    return nullptr;
+  }
+
+  // Inflate the chunks in parallel; each chunk is independent and writes to a
+  // disjoint range of the reserved mapping.
+  const size_t worker_count = std::min<size_t>(
+      chunk_count, std::max<size_t>(1u, std::thread::hardware_concurrency()));
+  auto worker_pool = fml::ConcurrentMessageLoop::Create(worker_count);
+  fml::CountDownLatch latch(chunk_count);
+  std::atomic<bool> failed(false);
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    worker_pool->GetTaskRunner()->PostTask([&, i]() {
+      const size_t destination_offset = static_cast<size_t>(i) * chunk_size;
+      const size_t destination_size = std::min<size_t>(
+          chunk_size, uncompressed_size - destination_offset);
+      const size_t compressed_size =
+          ReadLittleEndian<uint32_t>(chunk_table + i * sizeof(uint32_t));
+      if (!DecompressChunk(codec, data + payload_offsets[i], compressed_size,
+                           reserved->GetMutableMapping() + destination_offset,
+                           destination_size)) {
+        failed = true;
+      }
+      latch.CountDown();
+    });
+  }
+  latch.Wait();
+
+  if (failed) {
+    FML_LOG(ERROR) << "Could not inflate the snapshot container (codec "
+                   << codec << ").";
+    return nullptr;
+  }
+
+  if (!reserved->Seal(executable)) {
+    FML_LOG(ERROR) << "Could not protect the inflated snapshot mapping.";
+    return nullptr;
+  }
+
+  return reserved;
+}
+
+}  // namespace flutter
@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_RUNTIME_DART_SNAPSHOT_CONTAINER_H_
+#define FLUTTER_RUNTIME_DART_SNAPSHOT_CONTAINER_H_
+
+#include <memory>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      A container format for compressed Dart snapshot segments.
+///
+///             Host tooling may package a VM or isolate snapshot segment
+///             compressed when the raw read bandwidth of the storage medium
+///             (slow eMMC) dominates startup. The container is detected by
+///             magic when the snapshot is resolved and is inflated into a
+///             freshly reserved anonymous mapping by decompressing its
+///             fixed-size chunks in parallel on a transient worker pool.
+///
+///             Layout (all fields little-endian):
+///
+///               offset 0   uint8_t[4]  magic "FSC1"
+///               offset 4   uint32_t    codec (kStore or kZstd)
+///               offset 8   uint64_t    uncompressed payload size
+///               offset 16  uint32_t    uncompressed chunk size
+///               offset 20  uint32_t    chunk count
+///               offset 24  uint32_t[]  compressed size of each chunk
+///                          uint8_t[]   chunk payloads, back to back
+///
+///             Chunks compress independently so they can inflate in parallel.
+///             zstd chunks are only supported when the engine is built with
+///             FLUTTER_SNAPSHOT_ZSTD; store chunks are always supported.
+///
+class DartSnapshotContainer {
+ public:
+  enum Codec : uint32_t {
+    kStore = 0,
+    kZstd = 1,
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Determines whether `mapping` starts with the container
+  ///             magic.
+  ///
+  static bool IsContainer(const fml::Mapping* mapping);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Inflates the container in `mapping` into a freshly reserved
+  ///             anonymous mapping. The chunks are decompressed in parallel
+  ///             on a transient worker pool that is joined before this method
+  ///             returns. When `executable` is true the result is remapped
+  ///             read-execute once inflation completes; otherwise it is
+  ///             remapped read-only.
+  ///
+  /// @return     The inflated mapping, or nullptr if the container is
+  ///             malformed or uses an unsupported codec.
+  ///
+  static std::unique_ptr<fml::Mapping> Decompress(const fml::Mapping& mapping,
+                                                  bool executable);
+
+ private:
+  FML_DISALLOW_IMPLICIT_CONSTRUCTORS(DartSnapshotContainer);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_RUNTIME_DART_SNAPSHOT_CONTAINER_H_
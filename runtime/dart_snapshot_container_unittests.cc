@@ -0,0 +1,78 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/runtime/dart_snapshot_container.h"
+
+#include <numeric>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+template <typename T>
+void AppendLittleEndian(std::vector<uint8_t>& buffer, T value) {
+  for (size_t i = 0; i < sizeof(T); i++) {
+    buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+std::vector<uint8_t> MakeStoreContainer(const std::vector<uint8_t>& payload,
+                                        uint32_t chunk_size) {
+  const uint32_t chunk_count = (payload.size() + chunk_size - 1) / chunk_size;
+  std::vector<uint8_t> container = {'F', 'S', 'C', '1'};
+  AppendLittleEndian<uint32_t>(container, DartSnapshotContainer::kStore);
+  AppendLittleEndian<uint64_t>(container, payload.size());
+  AppendLittleEndian<uint32_t>(container, chunk_size);
+  AppendLittleEndian<uint32_t>(container, chunk_count);
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    const uint32_t this_chunk = std::min<size_t>(
+        chunk_size, payload.size() - static_cast<size_t>(i) * chunk_size);
+    AppendLittleEndian<uint32_t>(container, this_chunk);
+  }
+  container.insert(container.end(), payload.begin(), payload.end());
+  return container;
+}
+
+}  // namespace
+
+TEST(DartSnapshotContainer, DetectsContainerMagic) {
+  std::vector<uint8_t> payload(16, 0xab);
+  auto container = MakeStoreContainer(payload, 8);
+  fml::NonOwnedMapping mapping(container.data(), container.size());
+  ASSERT_TRUE(DartSnapshotContainer::IsContainer(&mapping));
+
+  fml::NonOwnedMapping raw(payload.data(), payload.size());
+  ASSERT_FALSE(DartSnapshotContainer::IsContainer(&raw));
+}
+
+TEST(DartSnapshotContainer, InflatesStoreChunksInParallel) {
+  // Large enough for many chunks so multiple workers take part.
+  std::vector<uint8_t> payload(64 * 1024 + 123);
+  std::iota(payload.begin(), payload.end(), 0);
+  auto container = MakeStoreContainer(payload, 4096);
+  fml::NonOwnedMapping mapping(container.data(), container.size());
+
+  auto inflated =
+      DartSnapshotContainer::Decompress(mapping, /*executable=*/false);
+  ASSERT_TRUE(inflated);
+  ASSERT_EQ(inflated->GetSize(), payload.size());
+  ASSERT_EQ(::memcmp(inflated->GetMapping(), payload.data(), payload.size()),
+            0);
+}
+
+TEST(DartSnapshotContainer, RejectsTruncatedContainer) {
+  std::vector<uint8_t> payload(1024, 0x5a);
+  auto container = MakeStoreContainer(payload, 256);
+  container.resize(container.size() - 100);
+  fml::NonOwnedMapping mapping(container.data(), container.size());
+
+  ASSERT_EQ(DartSnapshotContainer::Decompress(mapping, /*executable=*/false),
+            nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
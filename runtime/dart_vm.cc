@@ -289,7 +289,8 @@ DartVM::DartVM(const std::shared_ptr<const DartVMData>& vm_data,
               const fml::closure& work) { runner->PostTask(work); }),
       vm_data_(vm_data),
       isolate_name_server_(std::move(isolate_name_server)),
-      service_protocol_(std::make_shared<ServiceProtocol>()) {
+      service_protocol_(std::make_shared<ServiceProtocol>()),
+      isolate_warmup_pool_(std::make_shared<DartIsolateWarmupPool>()) {
   TRACE_EVENT0("flutter", "DartVMInitializer");
 
   gVMLaunchCount++;
@@ -435,6 +436,17 @@ DartVM::DartVM(const std::shared_ptr<const DartVMData>& vm_data,
 
   dart::bin::SetExecutableName(settings_.executable_name.c_str());
 
+  if (settings_.snapshot_residency_hints) {
+    // Warm the snapshot ranges before the VM starts executing out of them, so
+    // the cold launch faults them in with read-ahead instead of on demand.
+    // This also runs before any Dart_CreateIsolateGroup can reference the
+    // isolate snapshot.
+    vm_data_->GetVMSnapshot().PrefetchResidentPages();
+    if (auto isolate_snapshot = vm_data_->GetIsolateSnapshot()) {
+      isolate_snapshot->PrefetchResidentPages();
+    }
+  }
+
   {
     TRACE_EVENT0("flutter", "Dart_Initialize");
     Dart_InitializeParams params = {};
@@ -538,8 +550,18 @@ DartVM::GetConcurrentWorkerTaskRunner() const {
   return concurrent_message_loop_->GetTaskRunner();
 }
 
+std::shared_ptr<fml::ConcurrentTaskRunner> DartVM::MakeClientWorkerTaskRunner()
+    const {
+  return concurrent_message_loop_->MakeClientTaskRunner();
+}
+
 std::shared_ptr<fml::ConcurrentMessageLoop> DartVM::GetConcurrentMessageLoop() {
   return concurrent_message_loop_;
 }
 
+const std::shared_ptr<DartIsolateWarmupPool>& DartVM::GetIsolateWarmupPool()
+    const {
+  return isolate_warmup_pool_;
+}
+
 }  // namespace flutter
@@ -18,6 +18,7 @@
 #include "flutter/fml/message_loop.h"
 #include "flutter/lib/ui/isolate_name_server/isolate_name_server.h"
 #include "flutter/runtime/dart_isolate.h"
+#include "flutter/runtime/dart_isolate_warmup_pool.h"
 #include "flutter/runtime/dart_snapshot.h"
 #include "flutter/runtime/dart_vm_data.h"
 #include "flutter/runtime/service_protocol.h"
@@ -147,6 +148,19 @@ class DartVM {
   std::shared_ptr<fml::ConcurrentTaskRunner> GetConcurrentWorkerTaskRunner()
       const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a task runner with its own fairness queue on the
+  ///             shared concurrent worker pool. Because every shell instance
+  ///             in the process shares the pool, components that post bursts
+  ///             of work (image decoding, parallel rasterization) should post
+  ///             through a client runner so one busy shell cannot starve the
+  ///             others.
+  ///
+  /// @return     A new client task runner for the concurrent worker pool.
+  ///
+  std::shared_ptr<fml::ConcurrentTaskRunner> MakeClientWorkerTaskRunner()
+      const;
+
   //----------------------------------------------------------------------------
   /// @brief      The concurrent message loop hosts threads that are used by the
   ///             engine to perform tasks long running background tasks.
@@ -160,6 +174,15 @@ class DartVM {
   ///
   std::shared_ptr<fml::ConcurrentMessageLoop> GetConcurrentMessageLoop();
 
+  //----------------------------------------------------------------------------
+  /// @brief      The pool of warm root isolates for this running VM instance.
+  ///             Embedders may warm the pool during idle time; root isolate
+  ///             creation claims matching warm members automatically.
+  ///
+  /// @return     The warmup pool.
+  ///
+  const std::shared_ptr<DartIsolateWarmupPool>& GetIsolateWarmupPool() const;
+
  private:
   const Settings settings_;
   std::shared_ptr<fml::ConcurrentMessageLoop> concurrent_message_loop_;
@@ -167,6 +190,7 @@ class DartVM {
   std::shared_ptr<const DartVMData> vm_data_;
   const std::shared_ptr<IsolateNameServer> isolate_name_server_;
   const std::shared_ptr<ServiceProtocol> service_protocol_;
+  const std::shared_ptr<DartIsolateWarmupPool> isolate_warmup_pool_;
 
   friend class DartVMRef;
   friend class DartIsolate;
@@ -86,20 +86,24 @@ class KernelListIsolateConfiguration final : public IsolateConfiguration {
       return false;
     }
 
-    ResolveKernelPiecesIfNecessary();
+    const size_t piece_count = kernel_piece_futures_.size();
 
-    if (resolved_kernel_pieces_.empty()) {
+    if (piece_count == 0) {
       FML_DLOG(ERROR) << "No kernel pieces provided to prepare this isolate.";
       return false;
     }
 
-    for (size_t i = 0; i < resolved_kernel_pieces_.size(); i++) {
+    for (size_t i = 0; i < piece_count; i++) {
+      // Block only on the piece about to be fed to the isolate. Pieces behind
+      // it keep resolving on the IO worker while the VM parses this one,
+      // overlapping kernel I/O with isolate preparation.
+      ResolveKernelPiecesUpTo(i);
       if (!resolved_kernel_pieces_[i]) {
         FML_DLOG(ERROR) << "This kernel list isolate configuration was already "
                            "used to prepare an isolate.";
         return false;
       }
-      const bool last_piece = i + 1 == resolved_kernel_pieces_.size();
+      const bool last_piece = i + 1 == piece_count;
       if (!isolate.PrepareForRunningFromKernel(
               std::move(resolved_kernel_pieces_[i]), /*child_isolate=*/false,
               last_piece)) {
@@ -112,27 +116,32 @@ class KernelListIsolateConfiguration final : public IsolateConfiguration {
 
   // |IsolateConfiguration|
   bool IsNullSafetyEnabled(const DartSnapshot& snapshot) override {
-    ResolveKernelPiecesIfNecessary();
+    // Only the first piece is consulted for the null safety mode; the rest
+    // may keep resolving in the background.
+    ResolveKernelPiecesUpTo(0);
     const auto kernel = resolved_kernel_pieces_.empty()
                             ? nullptr
                             : resolved_kernel_pieces_.front().get();
     return snapshot.IsNullSafetyEnabled(kernel);
   }
 
-  // This must be call as late as possible before accessing any of the kernel
-  // pieces. This will delay blocking on the futures for as long as possible. So
-  // far, only Fuchsia depends on this optimization and only on the non-AOT
-  // configs.
-  void ResolveKernelPiecesIfNecessary() {
-    if (resolved_kernel_pieces_.size() == kernel_piece_futures_.size()) {
-      return;
-    }
-
-    resolved_kernel_pieces_.clear();
-    for (auto& piece : kernel_piece_futures_) {
+  // Blocks on the futures of the kernel pieces up to (and including) the given
+  // index and leaves pieces past it resolving on the worker. This must be
+  // called as late as possible before accessing a kernel piece so that
+  // blocking on the futures is delayed for as long as possible. So far, only
+  // Fuchsia depends on this optimization and only on the non-AOT configs.
+  void ResolveKernelPiecesUpTo(size_t index) {
+    while (resolved_kernel_pieces_.size() <= index &&
+           resolved_kernel_pieces_.size() < kernel_piece_futures_.size()) {
       // The get() call will xfer the unique pointer out and leave an empty
       // future in the original vector.
-      resolved_kernel_pieces_.emplace_back(piece.get());
+      auto piece =
+          kernel_piece_futures_[resolved_kernel_pieces_.size()].get();
+      if (piece) {
+        // The VM parses the kernel blob front to back.
+        piece->Advise(fml::Mapping::ResidencyHint::kSequential);
+      }
+      resolved_kernel_pieces_.emplace_back(std::move(piece));
     }
   }
 
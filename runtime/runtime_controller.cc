@@ -20,6 +20,16 @@
 
 namespace flutter {
 
+namespace {
+
+// Channels that carry user interactions. Messages on these channels bypass
+// frame-aligned batching so that input latency is unaffected by it.
+bool IsUrgentPlatformMessage(const PlatformMessage& message) {
+  return message.channel() == "flutter/keyevent";
+}
+
+}  // namespace
+
 RuntimeController::RuntimeController(RuntimeDelegate& p_client,
                                      const TaskRunners& task_runners)
     : client_(p_client), vm_(nullptr), context_(task_runners) {}
@@ -195,6 +205,7 @@ bool RuntimeController::SetAccessibilityFeatures(int32_t flags) {
 bool RuntimeController::BeginFrame(fml::TimePoint frame_time,
                                    uint64_t frame_number) {
   if (auto* platform_configuration = GetPlatformConfigurationIfAvailable()) {
+    FlushBatchedPlatformMessages(platform_configuration);
     platform_configuration->BeginFrame(frame_time, frame_number);
     return true;
   }
@@ -233,6 +244,13 @@ bool RuntimeController::DispatchPlatformMessage(
     std::unique_ptr<PlatformMessage> message) {
   if (auto* platform_configuration = GetPlatformConfigurationIfAvailable()) {
     TRACE_EVENT0("flutter", "RuntimeController::DispatchPlatformMessage");
+    if (platform_message_batching_enabled_ &&
+        !IsUrgentPlatformMessage(*message)) {
+      batched_platform_messages_.push_back(std::move(message));
+      return true;
+    }
+    // Urgent messages may not overtake messages batched before them.
+    FlushBatchedPlatformMessages(platform_configuration);
     platform_configuration->DispatchPlatformMessage(std::move(message));
     return true;
   }
@@ -240,11 +258,48 @@ bool RuntimeController::DispatchPlatformMessage(
   return false;
 }
 
+void RuntimeController::SetPlatformMessageBatchingEnabled(bool enabled) {
+  if (platform_message_batching_enabled_ == enabled) {
+    return;
+  }
+  platform_message_batching_enabled_ = enabled;
+  if (!enabled) {
+    if (auto* platform_configuration = GetPlatformConfigurationIfAvailable()) {
+      FlushBatchedPlatformMessages(platform_configuration);
+    }
+  }
+}
+
+void RuntimeController::FlushBatchedPlatformMessages(
+    PlatformConfiguration* platform_configuration) {
+  if (batched_platform_messages_.empty()) {
+    return;
+  }
+  TRACE_EVENT0("flutter", "RuntimeController::FlushBatchedPlatformMessages");
+  std::vector<std::unique_ptr<PlatformMessage>> messages;
+  messages.swap(batched_platform_messages_);
+  std::shared_ptr<DartIsolate> root_isolate = root_isolate_.lock();
+  if (!root_isolate) {
+    return;
+  }
+  // A single outer scope amortizes the Dart entry/exit and handle scope setup
+  // over every message in the batch; the scopes taken by the individual
+  // dispatches nest within it.
+  tonic::DartState::Scope scope(root_isolate);
+  for (auto& message : messages) {
+    platform_configuration->DispatchPlatformMessage(std::move(message));
+  }
+}
+
 bool RuntimeController::DispatchPointerDataPacket(
-    const PointerDataPacket& packet) {
+    std::unique_ptr<PointerDataPacket> packet) {
   if (auto* platform_configuration = GetPlatformConfigurationIfAvailable()) {
     TRACE_EVENT0("flutter", "RuntimeController::DispatchPointerDataPacket");
-    platform_configuration->get_window(0)->DispatchPointerDataPacket(packet);
+    // Pointer data is a user interaction and is never batched, but it may not
+    // overtake messages batched before it.
+    FlushBatchedPlatformMessages(platform_configuration);
+    platform_configuration->get_window(0)->DispatchPointerDataPacket(
+        std::move(packet));
     return true;
   }
 
@@ -37,16 +37,28 @@ const std::string_view ServiceProtocol::kGetSkSLsExtensionName =
 const std::string_view
     ServiceProtocol::kEstimateRasterCacheMemoryExtensionName =
         "_flutter.estimateRasterCacheMemory";
+const std::string_view ServiceProtocol::kGetRasterCacheStatsExtensionName =
+    "_flutter.getRasterCacheStats";
 const std::string_view
     ServiceProtocol::kRenderFrameWithRasterStatsExtensionName =
         "_flutter.renderFrameWithRasterStats";
 const std::string_view ServiceProtocol::kReloadAssetFonts =
     "_flutter.reloadAssetFonts";
+const std::string_view ServiceProtocol::kGetTaskQueueMetricsExtensionName =
+    "_flutter.getTaskQueueMetrics";
+const std::string_view ServiceProtocol::kGetFrameTimeStatsExtensionName =
+    "_flutter.getFrameTimeStats";
+const std::string_view ServiceProtocol::kSetSkiaTracingExtensionName =
+    "_flutter.setSkiaTracing";
 
 static constexpr std::string_view kViewIdPrefx = "_flutterView/";
 static constexpr std::string_view kListViewsExtensionName =
     "_flutter.listViews";
 
+// The initial size of the reusable response arena as well as the response size
+// above which serialization is moved to the dedicated worker thread.
+static constexpr size_t kLargeResponseThresholdBytes = 64 * 1024;
+
 ServiceProtocol::ServiceProtocol()
     : endpoints_({
           // Private
@@ -61,8 +73,12 @@ ServiceProtocol::ServiceProtocol()
           kGetDisplayRefreshRateExtensionName,
           kGetSkSLsExtensionName,
           kEstimateRasterCacheMemoryExtensionName,
+          kGetRasterCacheStatsExtensionName,
           kRenderFrameWithRasterStatsExtensionName,
           kReloadAssetFonts,
+          kGetTaskQueueMetricsExtensionName,
+          kGetFrameTimeStatsExtensionName,
+          kSetSkiaTracingExtensionName,
       }),
       handlers_mutex_(fml::SharedMutex::Create()) {}
 
@@ -130,16 +146,42 @@ bool ServiceProtocol::HandleMessage(const char* method,
   }
 #endif  // NDEBUG
 
-  rapidjson::Document document;
-  bool result = HandleMessage(std::string_view{method},                  //
-                              params,                                    //
-                              static_cast<ServiceProtocol*>(user_data),  //
-                              &document                                  //
-  );
-  rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-  document.Accept(writer);
-  *json_object = fml::strdup(buffer.GetString());
+  auto* service_protocol = static_cast<ServiceProtocol*>(user_data);
+
+  bool result = false;
+  if (service_protocol == nullptr) {
+    rapidjson::Document document;
+    result = HandleMessage(std::string_view{method}, params, nullptr,  //
+                           &document);
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    document.Accept(writer);
+    *json_object = fml::strdup(buffer.GetString());
+  } else {
+    std::scoped_lock lock(service_protocol->serialization_mutex_);
+    auto& arena = service_protocol->response_arena_;
+    if (arena.empty()) {
+      arena.resize(kLargeResponseThresholdBytes);
+    }
+    size_t arena_bytes_used = 0;
+    {
+      // The document allocates out of the retained arena so that repeated
+      // queries reuse the same backing pages instead of taking short-lived
+      // heap allocations sized to the response.
+      rapidjson::MemoryPoolAllocator<> allocator(arena.data(), arena.size());
+      rapidjson::Document document(&allocator);
+      result = HandleMessage(std::string_view{method}, params,
+                             service_protocol, &document);
+      *json_object = service_protocol->SerializeResponse(document);
+      arena_bytes_used = allocator.Size();
+    }
+    // Retain enough arena capacity that the next response of this size is
+    // built without overflow chunk allocations. The arena may only be resized
+    // once the allocator referencing it has been destroyed.
+    if (arena_bytes_used > arena.size()) {
+      arena.assign(arena_bytes_used, 0);
+    }
+  }
 
 #ifndef NDEBUG
   FML_DLOG(INFO) << "Response: " << *json_object;
@@ -149,6 +191,38 @@ bool ServiceProtocol::HandleMessage(const char* method,
   return result;
 }
 
+const char* ServiceProtocol::SerializeResponse(rapidjson::Document& response) {
+  auto serialize = [&]() {
+    response_buffer_.Clear();
+    rapidjson::Writer<rapidjson::StringBuffer> writer(response_buffer_);
+    response.Accept(writer);
+    return fml::strdup(response_buffer_.GetString());
+  };
+
+  // Small responses are serialized inline; the cost of a thread hop would
+  // dwarf the serialization itself.
+  if (response.GetAllocator().Size() < kLargeResponseThresholdBytes) {
+    return serialize();
+  }
+
+  // The embedder service request callback must reply synchronously, so the
+  // calling thread still waits for the result. Running the serialization
+  // burst on the dedicated worker keeps its CPU cost off the thread hosting
+  // the handling isolate, which may be producing frames.
+  if (!serialization_thread_) {
+    serialization_thread_ =
+        std::make_unique<fml::Thread>("io.flutter.service_protocol");
+  }
+  const char* json = nullptr;
+  fml::AutoResetWaitableEvent latch;
+  serialization_thread_->GetTaskRunner()->PostTask([&]() {
+    json = serialize();
+    latch.Signal();
+  });
+  latch.Wait();
+  return json;
+}
+
 bool ServiceProtocol::HandleMessage(std::string_view method,
                                     const Handler::ServiceProtocolMap& params,
                                     ServiceProtocol* service_protocol,
@@ -6,16 +6,20 @@
 #define FLUTTER_RUNTIME_SERVICE_PROTOCOL_H_
 
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "flutter/fml/compiler_specific.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/synchronization/atomic_object.h"
 #include "flutter/fml/synchronization/shared_mutex.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/fml/thread.h"
 #include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
 
 namespace flutter {
 
@@ -29,8 +33,12 @@ class ServiceProtocol {
   static const std::string_view kGetDisplayRefreshRateExtensionName;
   static const std::string_view kGetSkSLsExtensionName;
   static const std::string_view kEstimateRasterCacheMemoryExtensionName;
+  static const std::string_view kGetRasterCacheStatsExtensionName;
   static const std::string_view kRenderFrameWithRasterStatsExtensionName;
   static const std::string_view kReloadAssetFonts;
+  static const std::string_view kGetTaskQueueMetricsExtensionName;
+  static const std::string_view kGetFrameTimeStatsExtensionName;
+  static const std::string_view kSetSkiaTracingExtensionName;
 
   class Handler {
    public:
@@ -79,6 +87,15 @@ class ServiceProtocol {
   const std::set<std::string_view> endpoints_;
   std::unique_ptr<fml::SharedMutex> handlers_mutex_;
   std::map<Handler*, fml::AtomicObject<Handler::Description>> handlers_;
+  // Scratch state reused across requests when building and serializing
+  // responses. Large responses (SkSL dumps, timelines) would otherwise churn
+  // through short-lived multi-megabyte allocations on every query. Guarded by
+  // `serialization_mutex_`.
+  std::mutex serialization_mutex_;
+  std::vector<char> response_arena_;
+  rapidjson::StringBuffer response_buffer_;
+  // Lazily created the first time a large response needs to be serialized.
+  std::unique_ptr<fml::Thread> serialization_thread_;
 
   [[nodiscard]] static bool HandleMessage(const char* method,
                                           const char** param_keys,
@@ -97,6 +114,8 @@ class ServiceProtocol {
 
   [[nodiscard]] bool HandleListViewsMethod(rapidjson::Document* response) const;
 
+  [[nodiscard]] const char* SerializeResponse(rapidjson::Document& response);
+
   FML_DISALLOW_COPY_AND_ASSIGN(ServiceProtocol);
 };
 
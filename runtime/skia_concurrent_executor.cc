@@ -4,12 +4,37 @@
 
 #include "flutter/runtime/skia_concurrent_executor.h"
 
+#include <deque>
+#include <mutex>
+
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
 
+namespace {
+
+thread_local SkiaConcurrentExecutor::TaskLane tCurrentTaskLane =
+    SkiaConcurrentExecutor::TaskLane::kBackground;
+
+}  // namespace
+
+struct SkiaConcurrentExecutor::TaskLanes {
+  std::mutex mutex;
+  std::deque<fml::closure> frame_critical;
+  std::deque<fml::closure> background;
+};
+
+SkiaConcurrentExecutor::ScopedTaskLane::ScopedTaskLane(TaskLane lane)
+    : previous_lane_(tCurrentTaskLane) {
+  tCurrentTaskLane = lane;
+}
+
+SkiaConcurrentExecutor::ScopedTaskLane::~ScopedTaskLane() {
+  tCurrentTaskLane = previous_lane_;
+}
+
 SkiaConcurrentExecutor::SkiaConcurrentExecutor(const OnWorkCallback& on_work)
-    : on_work_(on_work) {}
+    : on_work_(on_work), lanes_(std::make_shared<TaskLanes>()) {}
 
 SkiaConcurrentExecutor::~SkiaConcurrentExecutor() = default;
 
@@ -17,9 +42,42 @@ void SkiaConcurrentExecutor::add(fml::closure work) {
   if (!work) {
     return;
   }
-  on_work_([work]() {
-    TRACE_EVENT0("flutter", "SkiaExecutor");
-    work();
+  {
+    std::scoped_lock lock(lanes_->mutex);
+    if (tCurrentTaskLane == TaskLane::kFrameCritical) {
+      lanes_->frame_critical.push_back(std::move(work));
+    } else {
+      lanes_->background.push_back(std::move(work));
+    }
+  }
+  // Each queued task gets one drain job on the worker pool. A drain job runs
+  // the highest priority task pending at the time it executes, so a
+  // frame-critical task enqueued behind several background tasks still runs
+  // in the very next drain.
+  on_work_([lanes = lanes_]() {
+    fml::closure task;
+    bool frame_critical = false;
+    {
+      std::scoped_lock lock(lanes->mutex);
+      if (!lanes->frame_critical.empty()) {
+        task = std::move(lanes->frame_critical.front());
+        lanes->frame_critical.pop_front();
+        frame_critical = true;
+      } else if (!lanes->background.empty()) {
+        task = std::move(lanes->background.front());
+        lanes->background.pop_front();
+      }
+    }
+    if (!task) {
+      return;
+    }
+    if (frame_critical) {
+      TRACE_EVENT0("flutter", "SkiaExecutorFrameCritical");
+      task();
+    } else {
+      TRACE_EVENT0("flutter", "SkiaExecutor");
+      task();
+    }
   });
 }
 
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_RUNTIME_SKIA_CONCURRENT_EXECUTOR_H_
 #define FLUTTER_RUNTIME_SKIA_CONCURRENT_EXECUTOR_H_
 
+#include <memory>
+
 #include "flutter/fml/closure.h"
 #include "flutter/fml/macros.h"
 #include "third_party/skia/include/core/SkExecutor.h"
@@ -24,8 +26,22 @@ namespace flutter {
 ///             worker pool is held next to the process global Dart VM instance.
 ///             The Skia executor is wired up there as well.
 ///
+///             Tasks are queued in one of two priority lanes. Frame-critical
+///             tasks always run before queued background tasks regardless of
+///             the order in which they were added, so that (for example) a
+///             shader compilation the raster thread is about to block on never
+///             waits behind a backlog of image decodes.
+///
 class SkiaConcurrentExecutor : public SkExecutor {
  public:
+  //----------------------------------------------------------------------------
+  /// The priority lane a task is queued in. Background is the default.
+  ///
+  enum class TaskLane {
+    kBackground,
+    kFrameCritical,
+  };
+
   //----------------------------------------------------------------------------
   /// The callback invoked by the executor to schedule the given task onto an
   /// engine managed background thread.
@@ -45,8 +61,33 @@ class SkiaConcurrentExecutor : public SkExecutor {
   // |SkExecutor|
   void add(fml::closure work) override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Classifies tasks added to this executor from the current
+  ///             thread for the duration of the scope. The `SkExecutor`
+  ///             interface cannot carry a priority, so callers that hand
+  ///             frame-blocking work to Skia (GrContext driven shader
+  ///             compilation, for example) wrap the call site in a scope
+  ///             selecting the frame-critical lane instead.
+  ///
+  class ScopedTaskLane {
+   public:
+    explicit ScopedTaskLane(TaskLane lane);
+
+    ~ScopedTaskLane();
+
+   private:
+    TaskLane previous_lane_;
+
+    FML_DISALLOW_COPY_AND_ASSIGN(ScopedTaskLane);
+  };
+
  private:
+  struct TaskLanes;
+
   OnWorkCallback on_work_;
+  // Held by reference in drain jobs posted to the worker pool so that tasks
+  // still queued when this executor is collected remain valid.
+  std::shared_ptr<TaskLanes> lanes_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(SkiaConcurrentExecutor);
 };
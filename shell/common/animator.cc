@@ -4,7 +4,10 @@
 
 #include "flutter/shell/common/animator.h"
 
+#include <algorithm>
+
 #include "flutter/flow/frame_timings.h"
+#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/dart/runtime/include/dart_tools_api.h"
@@ -19,6 +22,20 @@ namespace {
 constexpr fml::TimeDelta kNotifyIdleTaskWaitTime =
     fml::TimeDelta::FromMilliseconds(51);
 
+// The number of rasterized frames the latency governor considers. The
+// governor only engages once the window is full and uses the worst recent
+// frame, so a single heavy frame backs the delay off for the whole window.
+constexpr size_t kLatencyGovernorWindowSize = 10;
+
+// Headroom the latency governor keeps between the delayed frame start and
+// the point at which the worst recent workload would miss the deadline.
+constexpr fml::TimeDelta kLatencyGovernorMargin =
+    fml::TimeDelta::FromMilliseconds(3);
+
+// Delays below this are not worth the scheduling jitter of a delayed task.
+constexpr fml::TimeDelta kMinLatencyGovernorDelay =
+    fml::TimeDelta::FromMilliseconds(2);
+
 }  // namespace
 
 Animator::Animator(Delegate& delegate,
@@ -106,6 +123,19 @@ void Animator::BeginFrame(
   FML_DCHECK(producer_continuation_);
   const fml::TimePoint frame_target_time =
       frame_timings_recorder_->GetVsyncTargetTime();
+  if (last_begin_frame_target_time_ != fml::TimePoint()) {
+    const fml::TimeDelta interval =
+        frame_target_time - last_begin_frame_target_time_;
+    // Intervals beyond a second mean the animator was idle, not slow; they
+    // would poison the cadence estimate.
+    if (interval > fml::TimeDelta::Zero() &&
+        interval < fml::TimeDelta::FromSeconds(1)) {
+      average_frame_cadence_ = average_frame_cadence_ == fml::TimeDelta::Zero()
+                                   ? interval
+                                   : (average_frame_cadence_ + interval) / 2;
+    }
+  }
+  last_begin_frame_target_time_ = frame_target_time;
   dart_frame_deadline_ = FxlToDartOrEarlier(frame_target_time);
   uint64_t frame_number = frame_timings_recorder_->GetFrameNumber();
   delegate_.OnAnimatorBeginFrame(frame_target_time, frame_number);
@@ -248,7 +278,7 @@ void Animator::AwaitVSync() {
           if (self->CanReuseLastLayerTree()) {
             self->DrawLastLayerTree(std::move(frame_timings_recorder));
           } else {
-            self->BeginFrame(std::move(frame_timings_recorder));
+            self->ScheduleBeginFrame(std::move(frame_timings_recorder));
           }
         }
       });
@@ -257,6 +287,67 @@ void Animator::AwaitVSync() {
   }
 }
 
+void Animator::ScheduleBeginFrame(
+    std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder) {
+  const fml::TimeDelta delay = ComputeFrameStartDelay(*frame_timings_recorder);
+  if (delay == fml::TimeDelta::Zero()) {
+    BeginFrame(std::move(frame_timings_recorder));
+    return;
+  }
+  TRACE_EVENT1("flutter", "Animator::DelayFrameStart", "delay_micros",
+               std::to_string(delay.ToMicroseconds()).c_str());
+  task_runners_.GetUITaskRunner()->PostDelayedTask(
+      fml::MakeCopyable(
+          [self = weak_factory_.GetWeakPtr(),
+           frame_timings_recorder = std::move(frame_timings_recorder)]() mutable {
+            if (self) {
+              self->BeginFrame(std::move(frame_timings_recorder));
+            }
+          }),
+      delay);
+}
+
+fml::TimeDelta Animator::ComputeFrameStartDelay(
+    const FrameTimingsRecorder& frame_timings_recorder) const {
+  if (recent_frame_work_durations_.size() < kLatencyGovernorWindowSize) {
+    return fml::TimeDelta::Zero();
+  }
+  fml::TimeDelta max_work = fml::TimeDelta::Zero();
+  for (const auto& work : recent_frame_work_durations_) {
+    max_work = std::max(max_work, work);
+  }
+  // Measure headroom against the actual time left until the frame deadline
+  // so that late vsync delivery automatically shrinks the delay.
+  const fml::TimeDelta time_to_deadline =
+      frame_timings_recorder.GetVsyncTargetTime() - fml::TimePoint::Now();
+  const fml::TimeDelta delay =
+      time_to_deadline - max_work - kLatencyGovernorMargin;
+  if (delay < kMinLatencyGovernorDelay) {
+    return fml::TimeDelta::Zero();
+  }
+  return delay;
+}
+
+void Animator::RecordFrameTiming(const FrameTiming& timing) {
+  const fml::TimeDelta work =
+      (timing.Get(FrameTiming::kBuildFinish) -
+       timing.Get(FrameTiming::kBuildStart)) +
+      (timing.Get(FrameTiming::kRasterFinish) -
+       timing.Get(FrameTiming::kRasterStart));
+  recent_frame_work_durations_.push_back(work);
+  if (recent_frame_work_durations_.size() > kLatencyGovernorWindowSize) {
+    recent_frame_work_durations_.pop_front();
+  }
+}
+
+fml::TimeDelta Animator::GetAverageFrameCadence() const {
+  return average_frame_cadence_;
+}
+
+void Animator::SetMaxRefreshRate(double max_refresh_rate) {
+  waiter_->SetMaxRefreshRate(max_refresh_rate);
+}
+
 void Animator::ScheduleSecondaryVsyncCallback(uintptr_t id,
                                               const fml::closure& callback) {
   waiter_->ScheduleSecondaryCallback(id, callback);
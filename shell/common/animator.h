@@ -7,6 +7,7 @@
 
 #include <deque>
 
+#include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/flow/frame_timings.h"
 #include "flutter/fml/memory/ref_ptr.h"
@@ -81,9 +82,52 @@ class Animator final {
   // active rendering.
   void EnqueueTraceFlowId(uint64_t trace_flow_id);
 
+  //--------------------------------------------------------------------------
+  /// @brief    Feeds the timings of a rasterized frame back to the animator.
+  ///
+  ///           The animator watches recent build and raster durations and,
+  ///           when they leave ample headroom within the vsync interval,
+  ///           delays the start of subsequent frames past vsync. Input
+  ///           delivered during the delay is handled by the frame it would
+  ///           otherwise have missed, reducing touch latency for light
+  ///           workloads. A single heavy frame in the window backs the delay
+  ///           off to zero.
+  ///
+  ///           Must be called on the UI task runner.
+  ///
+  void RecordFrameTiming(const FrameTiming& timing);
+
+  //--------------------------------------------------------------------------
+  /// @brief    Returns the smoothed interval between the target times of
+  ///           recently begun frames, or zero before two frames have begun.
+  ///
+  ///           This is the cadence at which the engine is actually producing
+  ///           frames rather than the display's nominal rate; frame rate
+  ///           policies compare the two to decide whether a lower refresh
+  ///           rate should be requested from the platform. Must be called on
+  ///           the UI task runner.
+  fml::TimeDelta GetAverageFrameCadence() const;
+
+  //--------------------------------------------------------------------------
+  /// @brief    Caps the rate at which this animator begins frames by pacing
+  ///           the underlying `VsyncWaiter`. A rate of zero removes the cap.
+  ///
+  ///           Used when the platform cannot (or will not) lower the physical
+  ///           refresh rate: wakeups stay aligned to vsync but frames are
+  ///           only begun at the granted rate.
+  void SetMaxRefreshRate(double max_refresh_rate);
+
  private:
   void BeginFrame(std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder);
 
+  // Calls |BeginFrame| immediately, or after the delay the latency governor
+  // computed from recent frame timings.
+  void ScheduleBeginFrame(
+      std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder);
+
+  fml::TimeDelta ComputeFrameStartDelay(
+      const FrameTimingsRecorder& frame_timings_recorder) const;
+
   bool CanReuseLastLayerTree();
 
   void DrawLastLayerTree(
@@ -110,6 +154,13 @@ class Animator final {
   SkISize last_layer_tree_size_ = {0, 0};
   std::deque<uint64_t> trace_flow_ids_;
   bool has_rendered_ = false;
+  // Recent per-frame build plus raster durations used by the latency
+  // governor. Only touched on the UI thread.
+  std::deque<fml::TimeDelta> recent_frame_work_durations_;
+  // Cadence observation for frame rate policies. Only touched on the UI
+  // thread.
+  fml::TimePoint last_begin_frame_target_time_;
+  fml::TimeDelta average_frame_cadence_;
 
   fml::WeakPtrFactory<Animator> weak_factory_;
 
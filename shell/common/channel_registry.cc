@@ -0,0 +1,41 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/channel_registry.h"
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+ChannelRegistry::ChannelRegistry() = default;
+
+ChannelRegistry::~ChannelRegistry() = default;
+
+ChannelRegistry::ChannelId ChannelRegistry::RegisterHandler(
+    const std::string& channel,
+    Handler handler) {
+  FML_DCHECK(channel_ids_.find(channel) == channel_ids_.end());
+  ChannelId id = handlers_.size();
+  channel_ids_[channel] = id;
+  handlers_.push_back(std::move(handler));
+  return id;
+}
+
+bool ChannelRegistry::Dispatch(
+    std::unique_ptr<PlatformMessage>& message) const {
+  auto found = channel_ids_.find(message->channel());
+  if (found == channel_ids_.end()) {
+    return false;
+  }
+  return Dispatch(found->second, message);
+}
+
+bool ChannelRegistry::Dispatch(
+    ChannelId id,
+    std::unique_ptr<PlatformMessage>& message) const {
+  FML_DCHECK(id < handlers_.size());
+  return handlers_[id](message);
+}
+
+}  // namespace flutter
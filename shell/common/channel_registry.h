@@ -0,0 +1,74 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_CHANNEL_REGISTRY_H_
+#define FLUTTER_SHELL_COMMON_CHANNEL_REGISTRY_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/lib/ui/window/platform_message.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Interns platform channel names to small integer ids and routes messages
+/// through a flat handler table instead of a chain of string comparisons.
+/// A channel name is hashed at most once per message to recover its id;
+/// handler selection is an index into the table, and callers that keep the
+/// id returned at registration time can skip the name lookup entirely.
+///
+/// Handlers receive the message by mutable reference and return true if they
+/// consumed it. A handler that returns false must leave the message intact so
+/// the caller can forward it elsewhere (for example to the root isolate).
+///
+/// The registry is not synchronized; like the rest of the message routing
+/// machinery it must be used on a single thread. The same mechanism serves
+/// engine-side (inbound) and platform-view-side (outbound) routing.
+class ChannelRegistry {
+ public:
+  using ChannelId = size_t;
+  using Handler =
+      std::function<bool(std::unique_ptr<PlatformMessage>& message)>;
+
+  ChannelRegistry();
+
+  ~ChannelRegistry();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Registers |handler| for |channel| and returns the interned
+  ///             channel id. At most one handler may be registered per
+  ///             channel.
+  ///
+  ChannelId RegisterHandler(const std::string& channel, Handler handler);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Routes |message| to the handler registered for its channel.
+  ///
+  /// @return     True if a handler consumed the message. False, with the
+  ///             message left intact, if no handler is registered for the
+  ///             channel or the handler declined it.
+  ///
+  bool Dispatch(std::unique_ptr<PlatformMessage>& message) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Routes |message| to the handler with the given interned id,
+  ///             skipping the channel name lookup.
+  ///
+  bool Dispatch(ChannelId id, std::unique_ptr<PlatformMessage>& message) const;
+
+ private:
+  std::unordered_map<std::string, ChannelId> channel_ids_;
+  std::vector<Handler> handlers_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ChannelRegistry);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_CHANNEL_REGISTRY_H_
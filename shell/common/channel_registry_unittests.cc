@@ -0,0 +1,79 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/channel_registry.h"
+
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+static std::unique_ptr<PlatformMessage> MakeMessage(std::string channel) {
+  return std::make_unique<PlatformMessage>(std::move(channel), nullptr);
+}
+
+TEST(ChannelRegistryTest, DispatchesByChannelName) {
+  ChannelRegistry registry;
+  int lifecycle_count = 0;
+  int settings_count = 0;
+  registry.RegisterHandler(
+      "flutter/lifecycle", [&](std::unique_ptr<PlatformMessage>& message) {
+        lifecycle_count++;
+        return true;
+      });
+  registry.RegisterHandler(
+      "flutter/settings", [&](std::unique_ptr<PlatformMessage>& message) {
+        settings_count++;
+        return true;
+      });
+
+  auto message = MakeMessage("flutter/settings");
+  ASSERT_TRUE(registry.Dispatch(message));
+  ASSERT_EQ(lifecycle_count, 0);
+  ASSERT_EQ(settings_count, 1);
+}
+
+TEST(ChannelRegistryTest, UnknownChannelLeavesMessageIntact) {
+  ChannelRegistry registry;
+  registry.RegisterHandler("flutter/lifecycle",
+                           [](std::unique_ptr<PlatformMessage>& message) {
+                             message.reset();
+                             return true;
+                           });
+
+  auto message = MakeMessage("plugin/custom");
+  ASSERT_FALSE(registry.Dispatch(message));
+  ASSERT_NE(message, nullptr);
+  ASSERT_EQ(message->channel(), "plugin/custom");
+}
+
+TEST(ChannelRegistryTest, DecliningHandlerLeavesMessageIntact) {
+  ChannelRegistry registry;
+  registry.RegisterHandler("flutter/navigation",
+                           [](std::unique_ptr<PlatformMessage>& message) {
+                             // Decline so the caller forwards the message.
+                             return false;
+                           });
+
+  auto message = MakeMessage("flutter/navigation");
+  ASSERT_FALSE(registry.Dispatch(message));
+  ASSERT_NE(message, nullptr);
+}
+
+TEST(ChannelRegistryTest, DispatchesByInternedId) {
+  ChannelRegistry registry;
+  int count = 0;
+  auto id = registry.RegisterHandler(
+      "flutter/skia", [&](std::unique_ptr<PlatformMessage>& message) {
+        count++;
+        return true;
+      });
+
+  auto message = MakeMessage("flutter/skia");
+  ASSERT_TRUE(registry.Dispatch(id, message));
+  ASSERT_EQ(count, 1);
+}
+
+}  // namespace testing
+}  // namespace flutter
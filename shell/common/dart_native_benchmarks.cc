@@ -5,6 +5,7 @@
 #include "flutter/shell/common/shell.h"
 
 #include "flutter/benchmarking/benchmarking.h"
+#include "flutter/benchmarking/perf_counters.h"
 #include "flutter/shell/common/thread_host.h"
 #include "flutter/testing/dart_fixture.h"
 #include "flutter/testing/dart_isolate_runner.h"
@@ -31,6 +32,7 @@ class DartNativeBenchmarks : public DartFixture, public benchmark::Fixture {
 
 BENCHMARK_F(DartNativeBenchmarks, TimeToFirstNativeMessageFromIsolateInNewVM)
 (benchmark::State& st) {
+  benchmarking::ScopedPerfCounters perf(st);
   while (st.KeepRunning()) {
     fml::AutoResetWaitableEvent latch;
     st.PauseTiming();
@@ -68,6 +70,7 @@ BENCHMARK_F(DartNativeBenchmarks, TimeToFirstNativeMessageFromIsolateInNewVM)
 
 BENCHMARK_F(DartNativeBenchmarks, MultipleDartToNativeMessages)
 (benchmark::State& st) {
+  benchmarking::ScopedPerfCounters perf(st);
   while (st.KeepRunning()) {
     fml::CountDownLatch latch(1000);
     st.PauseTiming();
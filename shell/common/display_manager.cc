@@ -37,6 +37,34 @@ void DisplayManager::HandleDisplayUpdates(
   }
 }
 
+void DisplayManager::SetRefreshRateRequestListener(
+    RefreshRateRequestListener listener) {
+  std::scoped_lock lock(displays_mutex_);
+  refresh_rate_request_listener_ = std::move(listener);
+}
+
+void DisplayManager::RequestRefreshRate(double refresh_rate) {
+  FML_DCHECK(refresh_rate >= 0);
+  RefreshRateRequestListener listener;
+  {
+    std::scoped_lock lock(displays_mutex_);
+    if (requested_refresh_rate_ == refresh_rate) {
+      return;
+    }
+    requested_refresh_rate_ = refresh_rate;
+    listener = refresh_rate_request_listener_;
+  }
+  // Invoked outside the lock as the listener may re-enter this class.
+  if (listener) {
+    listener(refresh_rate);
+  }
+}
+
+double DisplayManager::GetRequestedRefreshRate() const {
+  std::scoped_lock lock(displays_mutex_);
+  return requested_refresh_rate_;
+}
+
 void DisplayManager::CheckDisplayConfiguration(
     const std::vector<std::unique_ptr<Display>>& displays) const {
   FML_CHECK(!displays.empty());
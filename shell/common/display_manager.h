@@ -5,6 +5,7 @@
 #ifndef FLUTTER_SHELL_COMMON_DISPLAY_MANAGER_H_
 #define FLUTTER_SHELL_COMMON_DISPLAY_MANAGER_H_
 
+#include <functional>
 #include <mutex>
 #include <vector>
 
@@ -42,10 +43,33 @@ class DisplayManager {
   void HandleDisplayUpdates(DisplayUpdateType update_type,
                             std::vector<std::unique_ptr<Display>> displays);
 
+  /// Signature of the callback invoked on `RequestRefreshRate`. Registered by
+  /// the platform view so the embedder can forward the request to the
+  /// operating system (e.g. `preferredFramesPerSecond` on iOS or
+  /// `Surface.setFrameRate` on Android). The requested rate is a hint; the
+  /// display may be granted a different rate or none at all.
+  using RefreshRateRequestListener = std::function<void(double)>;
+
+  /// Registers the listener that receives refresh rate requests. Passing a
+  /// null listener removes the current one.
+  void SetRefreshRateRequestListener(RefreshRateRequestListener listener);
+
+  /// Requests that the main display run at the given refresh rate in frames
+  /// per second. A rate of zero relinquishes any previous request. The
+  /// request is recorded and forwarded to the registered listener; whether
+  /// the physical rate actually changes is up to the operating system.
+  void RequestRefreshRate(double refresh_rate);
+
+  /// Returns the most recently requested refresh rate, or zero if no request
+  /// is outstanding.
+  double GetRequestedRefreshRate() const;
+
  private:
-  /// Guards `displays_` vector.
+  /// Guards `displays_` vector as well as the refresh rate request state.
   mutable std::mutex displays_mutex_;
   std::vector<std::unique_ptr<Display>> displays_;
+  RefreshRateRequestListener refresh_rate_request_listener_;
+  double requested_refresh_rate_ = 0;
 
   /// Checks that the provided display configuration is valid. Currently this
   /// ensures that all the displays have an id in the case there are multiple
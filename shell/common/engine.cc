@@ -51,13 +51,40 @@ Engine::Engine(
       animator_(std::move(animator)),
       runtime_controller_(std::move(runtime_controller)),
       font_collection_(font_collection),
+      concurrent_task_runner_(std::move(image_decoder_task_runner)),
       image_decoder_(ImageDecoder::Make(settings_,
                                         task_runners,
-                                        std::move(image_decoder_task_runner),
+                                        concurrent_task_runner_,
                                         std::move(io_manager))),
       task_runners_(task_runners),
       weak_factory_(this) {
   pointer_data_dispatcher_ = dispatcher_maker(*this);
+
+  // Framework channels the engine handles itself. Handlers that return false
+  // leave the message intact for the root isolate.
+  channel_registry_.RegisterHandler(
+      kLifecycleChannel, [this](std::unique_ptr<PlatformMessage>& message) {
+        return HandleLifecyclePlatformMessage(message.get());
+      });
+  channel_registry_.RegisterHandler(
+      kLocalizationChannel, [this](std::unique_ptr<PlatformMessage>& message) {
+        return HandleLocalizationPlatformMessage(message.get());
+      });
+  channel_registry_.RegisterHandler(
+      kSettingsChannel, [this](std::unique_ptr<PlatformMessage>& message) {
+        HandleSettingsPlatformMessage(message.get());
+        return true;
+      });
+  channel_registry_.RegisterHandler(
+      kNavigationChannel, [this](std::unique_ptr<PlatformMessage>& message) {
+        if (runtime_controller_->IsRootIsolateRunning()) {
+          // The running isolate handles navigation messages itself.
+          return false;
+        }
+        // If there's no runtime_, we may still need to set the initial route.
+        HandleNavigationPlatformMessage(std::move(message));
+        return true;
+      });
 }
 
 Engine::Engine(Delegate& delegate,
@@ -74,7 +101,7 @@ Engine::Engine(Delegate& delegate,
                std::shared_ptr<VolatilePathTracker> volatile_path_tracker)
     : Engine(delegate,
              dispatcher_maker,
-             vm.GetConcurrentWorkerTaskRunner(),
+             vm.MakeClientWorkerTaskRunner(),
              task_runners,
              settings,
              std::move(animator),
@@ -100,7 +127,7 @@ Engine::Engine(Delegate& delegate,
           settings_.advisory_script_uri,           // advisory script uri
           settings_.advisory_script_entrypoint,    // advisory script entrypoint
           std::move(volatile_path_tracker),        // volatile path tracker
-          vm.GetConcurrentWorkerTaskRunner(),      // concurrent task runner
+          concurrent_task_runner_,                 // concurrent task runner
           settings_.enable_impeller,               // enable impeller
       });
 }
@@ -117,7 +144,7 @@ std::unique_ptr<Engine> Engine::Spawn(
       /*delegate=*/delegate,
       /*dispatcher_maker=*/dispatcher_maker,
       /*image_decoder_task_runner=*/
-      runtime_controller_->GetDartVM()->GetConcurrentWorkerTaskRunner(),
+      runtime_controller_->GetDartVM()->MakeClientWorkerTaskRunner(),
       /*task_runners=*/task_runners_,
       /*settings=*/settings,
       /*animator=*/std::move(animator),
@@ -292,25 +319,11 @@ void Engine::SetViewportMetrics(const ViewportMetrics& metrics) {
 }
 
 void Engine::DispatchPlatformMessage(std::unique_ptr<PlatformMessage> message) {
-  std::string channel = message->channel();
-  if (channel == kLifecycleChannel) {
-    if (HandleLifecyclePlatformMessage(message.get())) {
-      return;
-    }
-  } else if (channel == kLocalizationChannel) {
-    if (HandleLocalizationPlatformMessage(message.get())) {
-      return;
-    }
-  } else if (channel == kSettingsChannel) {
-    HandleSettingsPlatformMessage(message.get());
-    return;
-  } else if (!runtime_controller_->IsRootIsolateRunning() &&
-             channel == kNavigationChannel) {
-    // If there's no runtime_, we may still need to set the initial route.
-    HandleNavigationPlatformMessage(std::move(message));
+  if (channel_registry_.Dispatch(message)) {
     return;
   }
 
+  std::string channel = message->channel();
   if (runtime_controller_->IsRootIsolateRunning() &&
       runtime_controller_->DispatchPlatformMessage(std::move(message))) {
     return;
@@ -441,6 +454,18 @@ void Engine::ScheduleFrame(bool regenerate_layer_tree) {
   animator_->RequestFrame(regenerate_layer_tree);
 }
 
+void Engine::RecordFrameTiming(const FrameTiming& timing) {
+  animator_->RecordFrameTiming(timing);
+}
+
+fml::TimeDelta Engine::GetAverageFrameCadence() const {
+  return animator_->GetAverageFrameCadence();
+}
+
+void Engine::SetMaxRefreshRate(double max_refresh_rate) {
+  animator_->SetMaxRefreshRate(max_refresh_rate);
+}
+
 void Engine::Render(std::shared_ptr<flutter::LayerTree> layer_tree) {
   if (!layer_tree) {
     return;
@@ -494,7 +519,7 @@ void Engine::DoDispatchPacket(std::unique_ptr<PointerDataPacket> packet,
                               uint64_t trace_flow_id) {
   animator_->EnqueueTraceFlowId(trace_flow_id);
   if (runtime_controller_) {
-    runtime_controller_->DispatchPointerDataPacket(*packet);
+    runtime_controller_->DispatchPointerDataPacket(std::move(packet));
   }
 }
 
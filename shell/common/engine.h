@@ -26,6 +26,7 @@
 #include "flutter/runtime/runtime_controller.h"
 #include "flutter/runtime/runtime_delegate.h"
 #include "flutter/shell/common/animator.h"
+#include "flutter/shell/common/channel_registry.h"
 #include "flutter/shell/common/display_manager.h"
 #include "flutter/shell/common/platform_view.h"
 #include "flutter/shell/common/pointer_data_dispatcher.h"
@@ -759,6 +760,33 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   /// tree.
   void ScheduleFrame() { ScheduleFrame(true); }
 
+  //----------------------------------------------------------------------------
+  /// @brief      Feeds the timings of a rasterized frame to the animator so
+  ///             it can adapt the start of subsequent frames to the observed
+  ///             workload. Must be called on the UI task runner.
+  ///
+  /// @param[in]  timing  The timings of the rasterized frame.
+  ///
+  void RecordFrameTiming(const FrameTiming& timing);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the smoothed interval between recently begun frames
+  ///             as observed by the animator. Frame rate policies compare
+  ///             this against the display's nominal rate. Must be called on
+  ///             the UI task runner.
+  ///
+  fml::TimeDelta GetAverageFrameCadence() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Caps the rate at which the animator begins frames. Used when
+  ///             a lower refresh rate has been requested but the platform
+  ///             keeps driving vsync at the panel's full rate. A rate of zero
+  ///             removes the cap. Must be called on the UI task runner.
+  ///
+  /// @param[in]  max_refresh_rate  The cap in frames per second.
+  ///
+  void SetMaxRefreshRate(double max_refresh_rate);
+
   // |RuntimeDelegate|
   FontCollection& GetFontCollection() override;
 
@@ -939,12 +967,20 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   // is destructed first.
   std::unique_ptr<PointerDataDispatcher> pointer_data_dispatcher_;
 
+  // Routes inbound framework channel messages to their handlers by interned
+  // channel id instead of comparing channel names per message.
+  ChannelRegistry channel_registry_;
+
   std::string last_entry_point_;
   std::string last_entry_point_library_;
   std::vector<std::string> last_entry_point_args_;
   std::string initial_route_;
   std::shared_ptr<AssetManager> asset_manager_;
   std::shared_ptr<FontCollection> font_collection_;
+  // One fairness client on the process-wide concurrent worker pool per
+  // engine instance; serves both image decoding and isolate background
+  // work so a busy engine cannot starve its siblings.
+  std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner_;
   const std::unique_ptr<ImageDecoder> image_decoder_;
   ImageGeneratorRegistry image_generator_registry_;
   TaskRunners task_runners_;
@@ -362,5 +362,40 @@ TEST_F(PersistentCacheTest, PurgeAllowsFutureSkSLCache) {
   DestroyShell(std::move(shell));
 }
 
+TEST_F(PersistentCacheTest, PackedSkSLCacheRoundTrip) {
+  PersistentCache::SetAssetManager(nullptr);
+  fml::ScopedTemporaryDirectory base_dir;
+  ASSERT_TRUE(base_dir.fd().is_valid());
+  auto sksl_dir = fml::CreateDirectory(
+      base_dir.fd(),
+      {"flutter_engine", GetFlutterEngineVersion(), "skia", GetSkiaVersion(),
+       PersistentCache::kSkSLSubdirName},
+      fml::FilePermission::kReadWrite);
+  PersistentCache::SetCacheDirectoryPath(base_dir.path());
+  PersistentCache::ResetCacheForProcess();
+
+  // Write one SkSL cache entry the way |store| would.
+  sk_sp<SkData> key = SkData::MakeWithCString("key");
+  sk_sp<SkData> value = SkData::MakeWithCString("value");
+  auto mapping = PersistentCache::BuildCacheObject(*key, *value);
+  std::string file_name = PersistentCache::SkKeyToFilePath(*key);
+  ASSERT_TRUE(fml::WriteAtomically(sksl_dir, file_name.c_str(), *mapping));
+
+  // The directory scan finds the entry and rebuilds the packed file (inline,
+  // as no worker task runner is registered).
+  auto* cache = PersistentCache::GetCacheForProcess();
+  ASSERT_EQ(cache->LoadSkSLs().size(), 1u);
+
+  // Remove the individual file; the packed file alone now serves the load.
+  ASSERT_TRUE(fml::UnlinkFile(sksl_dir, file_name.c_str()));
+  auto shaders = cache->LoadSkSLs();
+  ASSERT_EQ(shaders.size(), 1u);
+  CheckTextSkData(shaders[0].key, "key");
+  CheckTextSkData(shaders[0].value, "value");
+
+  // Cleanup.
+  fml::RemoveFilesInDirectory(base_dir.fd());
+}
+
 }  // namespace testing
 }  // namespace flutter
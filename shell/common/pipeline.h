@@ -14,6 +14,7 @@
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/synchronization/semaphore.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -49,12 +50,16 @@ class Pipeline {
     ProducerContinuation() : trace_id_(0) {}
 
     ProducerContinuation(ProducerContinuation&& other)
-        : continuation_(other.continuation_), trace_id_(other.trace_id_) {
+        : pipeline_(other.pipeline_),
+          continuation_(other.continuation_),
+          trace_id_(other.trace_id_) {
+      other.pipeline_ = nullptr;
       other.continuation_ = nullptr;
       other.trace_id_ = 0;
     }
 
     ProducerContinuation& operator=(ProducerContinuation&& other) {
+      std::swap(pipeline_, other.pipeline_);
       std::swap(continuation_, other.continuation_);
       std::swap(trace_id_, other.trace_id_);
       return *this;
@@ -62,7 +67,7 @@ class Pipeline {
 
     ~ProducerContinuation() {
       if (continuation_) {
-        continuation_(nullptr, trace_id_);
+        (pipeline_->*continuation_)(nullptr, trace_id_);
         TRACE_EVENT_ASYNC_END0("flutter", "PipelineProduce", trace_id_);
         // The continuation is being dropped on the floor. End the flow.
         TRACE_FLOW_END("flutter", "PipelineItem", trace_id_);
@@ -73,7 +78,7 @@ class Pipeline {
     [[nodiscard]] PipelineProduceResult Complete(ResourcePtr resource) {
       PipelineProduceResult result;
       if (continuation_) {
-        result = continuation_(std::move(resource), trace_id_);
+        result = (pipeline_->*continuation_)(std::move(resource), trace_id_);
         continuation_ = nullptr;
         TRACE_EVENT_ASYNC_END0("flutter", "PipelineProduce", trace_id_);
         TRACE_FLOW_STEP("flutter", "PipelineItem", trace_id_);
@@ -85,14 +90,19 @@ class Pipeline {
 
    private:
     friend class Pipeline;
-    using Continuation =
-        std::function<PipelineProduceResult(ResourcePtr, size_t)>;
+    // A pointer to member (instead of a bound std::function) keeps the
+    // per-frame producer handoff free of heap allocations.
+    using Continuation = PipelineProduceResult (Pipeline::*)(ResourcePtr,
+                                                             size_t);
 
-    Continuation continuation_;
+    Pipeline* pipeline_ = nullptr;
+    Continuation continuation_ = nullptr;
     size_t trace_id_;
 
-    ProducerContinuation(const Continuation& continuation, size_t trace_id)
-        : continuation_(continuation), trace_id_(trace_id) {
+    ProducerContinuation(Pipeline* pipeline,
+                         Continuation continuation,
+                         size_t trace_id)
+        : pipeline_(pipeline), continuation_(continuation), trace_id_(trace_id) {
       TRACE_FLOW_BEGIN("flutter", "PipelineItem", trace_id_);
       TRACE_EVENT_ASYNC_BEGIN0("flutter", "PipelineItem", trace_id_);
       TRACE_EVENT_ASYNC_BEGIN0("flutter", "PipelineProduce", trace_id_);
@@ -102,26 +112,24 @@ class Pipeline {
   };
 
   explicit Pipeline(uint32_t depth)
-      : depth_(depth), empty_(depth), available_(0), inflight_(0) {}
+      : depth_(depth),
+        effective_depth_(depth),
+        empty_(depth),
+        available_(0),
+        inflight_(0) {}
 
   ~Pipeline() = default;
 
   bool IsValid() const { return empty_.IsValid() && available_.IsValid(); }
 
   ProducerContinuation Produce() {
-    if (!empty_.TryWait()) {
+    if (!TryReserve()) {
       return {};
     }
-    ++inflight_;
-    FML_TRACE_COUNTER("flutter", "Pipeline Depth",
-                      reinterpret_cast<int64_t>(this),      //
-                      "frames in flight", inflight_.load()  //
-    );
 
-    return ProducerContinuation{
-        std::bind(&Pipeline::ProducerCommit, this, std::placeholders::_1,
-                  std::placeholders::_2),  // continuation
-        GetNextPipelineTraceID()};         // trace id
+    return ProducerContinuation{this,                       //
+                                &Pipeline::ProducerCommit,  // continuation
+                                GetNextPipelineTraceID()};  // trace id
   }
 
   // Create a `ProducerContinuation` that will only push the task if the queue
@@ -129,19 +137,61 @@ class Pipeline {
   // Prefer using |Produce|. ProducerContinuation returned by this method
   // doesn't guarantee that the frame will be rendered.
   ProducerContinuation ProduceIfEmpty() {
-    if (!empty_.TryWait()) {
+    if (!TryReserve()) {
       return {};
     }
-    ++inflight_;
-    FML_TRACE_COUNTER("flutter", "Pipeline Depth",
-                      reinterpret_cast<int64_t>(this),      //
-                      "frames in flight", inflight_.load()  //
-    );
 
-    return ProducerContinuation{
-        std::bind(&Pipeline::ProducerCommitIfEmpty, this, std::placeholders::_1,
-                  std::placeholders::_2),  // continuation
-        GetNextPipelineTraceID()};         // trace id
+    return ProducerContinuation{this,                              //
+                                &Pipeline::ProducerCommitIfEmpty,  //
+                                GetNextPipelineTraceID()};         // trace id
+  }
+
+  /// The number of frames the pipeline currently allows in flight. Starts at
+  /// the constructed depth and adapts with consumer feedback given to
+  /// |RecordFrameRasterTimes|.
+  uint32_t GetEffectiveDepth() const {
+    return effective_depth_.load(std::memory_order_relaxed);
+  }
+
+  //----------------------------------------------------------------------------
+  /// @brief      Gives the pipeline consumer-side frame timing feedback used
+  ///             to adapt the effective depth.
+  ///
+  ///             When frames consistently miss their vsync targets, deep
+  ///             pipelining only adds latency without improving throughput,
+  ///             so the effective depth drops to one. When frames are back on
+  ///             time and the producer has since been throttled by the
+  ///             shallower pipeline (bursty UI production), the depth is
+  ///             raised again, one slot at a time, up to the constructed
+  ///             depth.
+  ///
+  void RecordFrameRasterTimes(fml::TimePoint frame_target_time,
+                              fml::TimePoint raster_end_time) {
+    if (depth_ <= 1u) {
+      return;
+    }
+    if (raster_end_time > frame_target_time) {
+      on_time_frames_ = 0;
+      if (++late_frames_ >= kLateFramesToReduceDepth) {
+        late_frames_ = 0;
+        saturated_produce_attempts_.store(0, std::memory_order_relaxed);
+        effective_depth_.store(1u, std::memory_order_relaxed);
+      }
+    } else {
+      late_frames_ = 0;
+      if (++on_time_frames_ >= kOnTimeFramesToRaiseDepth) {
+        on_time_frames_ = 0;
+        if (saturated_produce_attempts_.exchange(
+                0, std::memory_order_relaxed) > 0) {
+          const uint32_t effective_depth =
+              effective_depth_.load(std::memory_order_relaxed);
+          if (effective_depth < depth_) {
+            effective_depth_.store(effective_depth + 1u,
+                                   std::memory_order_relaxed);
+          }
+        }
+      }
+    }
   }
 
   using Consumer = std::function<void(ResourcePtr)>;
@@ -180,13 +230,46 @@ class Pipeline {
   }
 
  private:
+  // How many consecutive frames must miss their vsync targets before the
+  // effective depth drops to one, and how many must hit them again before the
+  // depth may be raised.
+  static constexpr uint32_t kLateFramesToReduceDepth = 4u;
+  static constexpr uint32_t kOnTimeFramesToRaiseDepth = 4u;
+
   const uint32_t depth_;
+  std::atomic<uint32_t> effective_depth_;
+  // Produce attempts rejected by the adapted depth. Written by the producer,
+  // consumed by |RecordFrameRasterTimes| on the consumer side.
+  std::atomic<uint32_t> saturated_produce_attempts_ = 0;
+  // Consecutive frame tallies. Only touched on the consumer side.
+  uint32_t late_frames_ = 0;
+  uint32_t on_time_frames_ = 0;
   fml::Semaphore empty_;
   fml::Semaphore available_;
   std::atomic<int> inflight_;
   std::mutex queue_mutex_;
   std::deque<std::pair<ResourcePtr, size_t>> queue_;
 
+  bool TryReserve() {
+    // A stale read can only over-count frames in flight since this is the
+    // sole thread that increments it; throttling is never missed.
+    if (static_cast<uint32_t>(inflight_.load()) >=
+        effective_depth_.load(std::memory_order_relaxed)) {
+      saturated_produce_attempts_.fetch_add(1u, std::memory_order_relaxed);
+      return false;
+    }
+    if (!empty_.TryWait()) {
+      saturated_produce_attempts_.fetch_add(1u, std::memory_order_relaxed);
+      return false;
+    }
+    ++inflight_;
+    FML_TRACE_COUNTER("flutter", "Pipeline Depth",
+                      reinterpret_cast<int64_t>(this),      //
+                      "frames in flight", inflight_.load()  //
+    );
+    return true;
+  }
+
   PipelineProduceResult ProducerCommit(ResourcePtr resource, size_t trace_id) {
     bool is_first_item = false;
     {
@@ -144,5 +144,74 @@ TEST(PipelineTest, ProduceIfEmptySuccessfulIfQueueIsEmpty) {
   ASSERT_EQ(consume_result_1, PipelineConsumeResult::Done);
 }
 
+TEST(PipelineTest, ConsistentlyLateFramesReduceEffectiveDepthToOne) {
+  const int depth = 2;
+  std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(depth);
+
+  const fml::TimePoint frame_target_time = fml::TimePoint::Now();
+  const fml::TimePoint late_raster_end_time =
+      frame_target_time + fml::TimeDelta::FromMilliseconds(8);
+  for (int i = 0; i < 4; i++) {
+    pipeline->RecordFrameRasterTimes(frame_target_time, late_raster_end_time);
+  }
+  ASSERT_EQ(pipeline->GetEffectiveDepth(), 1u);
+
+  Continuation continuation_1 = pipeline->Produce();
+  ASSERT_TRUE(static_cast<bool>(continuation_1));
+  Continuation continuation_2 = pipeline->Produce();
+  ASSERT_FALSE(static_cast<bool>(continuation_2));
+}
+
+TEST(PipelineTest, OnTimeFramesRaiseEffectiveDepthAfterThrottling) {
+  const int depth = 2;
+  std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(depth);
+
+  const fml::TimePoint frame_target_time = fml::TimePoint::Now();
+  const fml::TimePoint late_raster_end_time =
+      frame_target_time + fml::TimeDelta::FromMilliseconds(8);
+  for (int i = 0; i < 4; i++) {
+    pipeline->RecordFrameRasterTimes(frame_target_time, late_raster_end_time);
+  }
+  ASSERT_EQ(pipeline->GetEffectiveDepth(), 1u);
+
+  // The producer gets throttled by the reduced depth.
+  Continuation continuation_1 = pipeline->Produce();
+  ASSERT_TRUE(static_cast<bool>(continuation_1));
+  Continuation continuation_2 = pipeline->Produce();
+  ASSERT_FALSE(static_cast<bool>(continuation_2));
+
+  // On-time frames with a throttled producer restore a slot of depth.
+  const fml::TimePoint on_time_raster_end_time =
+      frame_target_time - fml::TimeDelta::FromMilliseconds(8);
+  for (int i = 0; i < 4; i++) {
+    pipeline->RecordFrameRasterTimes(frame_target_time,
+                                     on_time_raster_end_time);
+  }
+  ASSERT_EQ(pipeline->GetEffectiveDepth(), 2u);
+}
+
+TEST(PipelineTest, OnTimeFramesWithoutThrottlingKeepEffectiveDepth) {
+  const int depth = 2;
+  std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(depth);
+
+  const fml::TimePoint frame_target_time = fml::TimePoint::Now();
+  const fml::TimePoint late_raster_end_time =
+      frame_target_time + fml::TimeDelta::FromMilliseconds(8);
+  for (int i = 0; i < 4; i++) {
+    pipeline->RecordFrameRasterTimes(frame_target_time, late_raster_end_time);
+  }
+  ASSERT_EQ(pipeline->GetEffectiveDepth(), 1u);
+
+  // Without any throttled produce attempts there is no demand for additional
+  // depth and the added latency it brings.
+  const fml::TimePoint on_time_raster_end_time =
+      frame_target_time - fml::TimeDelta::FromMilliseconds(8);
+  for (int i = 0; i < 8; i++) {
+    pipeline->RecordFrameRasterTimes(frame_target_time,
+                                     on_time_raster_end_time);
+  }
+  ASSERT_EQ(pipeline->GetEffectiveDepth(), 1u);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -8,11 +8,29 @@
 
 namespace flutter {
 
+namespace {
+
+// Once consecutive samples of a device are further apart than this, the
+// gesture has effectively restarted and the old velocity is discarded.
+constexpr int64_t kMaxVelocitySampleGapMicros = 40 * 1000;
+
+}  // namespace
+
 PointerDataDispatcher::~PointerDataDispatcher() = default;
 DefaultPointerDataDispatcher::~DefaultPointerDataDispatcher() = default;
 
+constexpr fml::TimeDelta SmoothPointerDataDispatcher::kDefaultPredictionHorizon;
+
 SmoothPointerDataDispatcher::SmoothPointerDataDispatcher(Delegate& delegate)
-    : DefaultPointerDataDispatcher(delegate), weak_factory_(this) {}
+    : SmoothPointerDataDispatcher(delegate, kDefaultPredictionHorizon) {}
+
+SmoothPointerDataDispatcher::SmoothPointerDataDispatcher(
+    Delegate& delegate,
+    fml::TimeDelta prediction_horizon)
+    : DefaultPointerDataDispatcher(delegate),
+      prediction_horizon_(prediction_horizon),
+      weak_factory_(this) {}
+
 SmoothPointerDataDispatcher::~SmoothPointerDataDispatcher() = default;
 
 void DefaultPointerDataDispatcher::DispatchPacket(
@@ -29,6 +47,8 @@ void SmoothPointerDataDispatcher::DispatchPacket(
   TRACE_EVENT0("flutter", "SmoothPointerDataDispatcher::DispatchPacket");
   TRACE_FLOW_STEP("flutter", "PointerEvent", trace_flow_id);
 
+  TrackPointerVelocities(*packet);
+
   if (is_pointer_data_in_progress_) {
     if (pending_packet_ != nullptr) {
       DispatchPendingPacket();
@@ -61,6 +81,9 @@ void SmoothPointerDataDispatcher::ScheduleSecondaryVsyncCallback() {
 void SmoothPointerDataDispatcher::DispatchPendingPacket() {
   FML_DCHECK(pending_packet_ != nullptr);
   FML_DCHECK(is_pointer_data_in_progress_);
+  if (prediction_horizon_ > fml::TimeDelta::Zero()) {
+    ExtrapolatePendingPacket();
+  }
   DefaultPointerDataDispatcher::DispatchPacket(std::move(pending_packet_),
                                                pending_trace_flow_id_);
   pending_packet_ = nullptr;
@@ -68,4 +91,78 @@ void SmoothPointerDataDispatcher::DispatchPendingPacket() {
   ScheduleSecondaryVsyncCallback();
 }
 
+void SmoothPointerDataDispatcher::TrackPointerVelocities(
+    const PointerDataPacket& packet) {
+  for (size_t i = 0; i < packet.GetLength(); i++) {
+    PointerData pointer_data = packet.GetPointerData(i);
+    switch (pointer_data.change) {
+      case PointerData::Change::kAdd:
+      case PointerData::Change::kDown: {
+        PointerPredictionState state;
+        state.physical_x = pointer_data.physical_x;
+        state.physical_y = pointer_data.physical_y;
+        state.time_stamp = pointer_data.time_stamp;
+        pointer_states_[pointer_data.device] = state;
+        break;
+      }
+      case PointerData::Change::kMove: {
+        auto& state = pointer_states_[pointer_data.device];
+        const int64_t dt_micros = pointer_data.time_stamp - state.time_stamp;
+        if (state.time_stamp == 0 || dt_micros <= 0 ||
+            dt_micros > kMaxVelocitySampleGapMicros) {
+          state.has_velocity = false;
+        } else {
+          double velocity_x =
+              (pointer_data.physical_x - state.physical_x) / dt_micros;
+          double velocity_y =
+              (pointer_data.physical_y - state.physical_y) / dt_micros;
+          if (state.has_velocity) {
+            // A one-tap low pass filter: equal parts previous estimate and
+            // newest sample, enough to keep sensor jitter out of the
+            // prediction without the lag of a longer window.
+            velocity_x = (velocity_x + state.velocity_x) / 2;
+            velocity_y = (velocity_y + state.velocity_y) / 2;
+          }
+          state.velocity_x = velocity_x;
+          state.velocity_y = velocity_y;
+          state.has_velocity = true;
+        }
+        state.physical_x = pointer_data.physical_x;
+        state.physical_y = pointer_data.physical_y;
+        state.time_stamp = pointer_data.time_stamp;
+        break;
+      }
+      case PointerData::Change::kUp:
+      case PointerData::Change::kCancel:
+      case PointerData::Change::kRemove:
+        pointer_states_.erase(pointer_data.device);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+void SmoothPointerDataDispatcher::ExtrapolatePendingPacket() {
+  const double horizon_micros =
+      static_cast<double>(prediction_horizon_.ToMicroseconds());
+  for (size_t i = 0; i < pending_packet_->GetLength(); i++) {
+    PointerData pointer_data = pending_packet_->GetPointerData(i);
+    if (pointer_data.change != PointerData::Change::kMove) {
+      continue;
+    }
+    auto it = pointer_states_.find(pointer_data.device);
+    if (it == pointer_states_.end() || !it->second.has_velocity) {
+      continue;
+    }
+    const double dx = it->second.velocity_x * horizon_micros;
+    const double dy = it->second.velocity_y * horizon_micros;
+    pointer_data.physical_x += dx;
+    pointer_data.physical_y += dy;
+    pointer_data.physical_delta_x += dx;
+    pointer_data.physical_delta_y += dy;
+    pending_packet_->SetPointerData(i, pointer_data);
+  }
+}
+
 }  // namespace flutter
@@ -5,6 +5,9 @@
 #ifndef POINTER_DATA_DISPATCHER_H_
 #define POINTER_DATA_DISPATCHER_H_
 
+#include <unordered_map>
+
+#include "flutter/fml/time/time_delta.h"
 #include "flutter/runtime/runtime_controller.h"
 #include "flutter/shell/common/animator.h"
 
@@ -139,8 +142,23 @@ class DefaultPointerDataDispatcher : public PointerDataDispatcher {
 /// See also input_events_unittests.cc where we test all our claims above.
 class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
  public:
+  /// The default extrapolation horizon for deferred move events. Half a frame
+  /// at 60Hz (a full frame at 120Hz): enough to compensate for the one-frame
+  /// deferral without producing visible overshoot when the finger reverses.
+  static constexpr fml::TimeDelta kDefaultPredictionHorizon =
+      fml::TimeDelta::FromMilliseconds(8);
+
   explicit SmoothPointerDataDispatcher(Delegate& delegate);
 
+  /// Construct with a platform-tuned prediction horizon. Deferring a packet
+  /// to the next vsync makes its positions roughly one frame stale by the
+  /// time they render; deferred move events are extrapolated along the
+  /// pointer's recent velocity by the horizon to compensate. Platforms pick
+  /// the horizon in their `PointerDataDispatcherMaker`; a zero horizon
+  /// disables prediction.
+  SmoothPointerDataDispatcher(Delegate& delegate,
+                              fml::TimeDelta prediction_horizon);
+
   // |PointerDataDispatcer|
   void DispatchPacket(std::unique_ptr<PointerDataPacket> packet,
                       uint64_t trace_flow_id) override;
@@ -148,9 +166,29 @@ class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
   virtual ~SmoothPointerDataDispatcher();
 
  private:
+  // The most recent observed position and filtered velocity of one pointer
+  // device, in physical pixels and physical pixels per microsecond.
+  struct PointerPredictionState {
+    double physical_x = 0;
+    double physical_y = 0;
+    double velocity_x = 0;
+    double velocity_y = 0;
+    int64_t time_stamp = 0;
+    bool has_velocity = false;
+  };
+
   void DispatchPendingPacket();
   void ScheduleSecondaryVsyncCallback();
 
+  // Update the per-device velocity estimates from the unmodified positions of
+  // a newly arrived packet.
+  void TrackPointerVelocities(const PointerDataPacket& packet);
+
+  // Extrapolate the move events of the pending packet by the prediction
+  // horizon along their device's velocity. Later packets carry the real
+  // sampled positions, so any prediction error lasts a single frame.
+  void ExtrapolatePendingPacket();
+
   // If non-null, this will be a pending pointer data packet for the next frame
   // to consume. This is used to smooth out the irregular drag events delivery.
   // See also `DispatchPointerDataPacket` and input_events_unittests.cc.
@@ -158,6 +196,9 @@ class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
   int pending_trace_flow_id_ = -1;
   bool is_pointer_data_in_progress_ = false;
 
+  std::unordered_map<int64_t, PointerPredictionState> pointer_states_;
+  const fml::TimeDelta prediction_horizon_;
+
   // WeakPtrFactory must be the last member.
   fml::WeakPtrFactory<SmoothPointerDataDispatcher> weak_factory_;
   FML_DISALLOW_COPY_AND_ASSIGN(SmoothPointerDataDispatcher);
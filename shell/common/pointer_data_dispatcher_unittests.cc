@@ -0,0 +1,127 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/pointer_data_dispatcher.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+class TestDispatcherDelegate : public PointerDataDispatcher::Delegate {
+ public:
+  void DoDispatchPacket(std::unique_ptr<PointerDataPacket> packet,
+                        uint64_t trace_flow_id) override {
+    dispatched_packets.push_back(std::move(packet));
+  }
+
+  void ScheduleSecondaryVsyncCallback(uintptr_t id,
+                                      const fml::closure& callback) override {
+    vsync_callback = callback;
+  }
+
+  void FireVsync() {
+    fml::closure callback = vsync_callback;
+    vsync_callback = nullptr;
+    if (callback) {
+      callback();
+    }
+  }
+
+  std::vector<std::unique_ptr<PointerDataPacket>> dispatched_packets;
+  fml::closure vsync_callback;
+};
+
+PointerData CreatePointerData(PointerData::Change change,
+                              int64_t time_stamp_micros,
+                              double x,
+                              double y) {
+  PointerData data;
+  data.Clear();
+  data.change = change;
+  data.time_stamp = time_stamp_micros;
+  data.physical_x = x;
+  data.physical_y = y;
+  data.device = 1;
+  return data;
+}
+
+std::unique_ptr<PointerDataPacket> CreatePacket(PointerData::Change change,
+                                                int64_t time_stamp_micros,
+                                                double x,
+                                                double y) {
+  auto packet = std::make_unique<PointerDataPacket>(1);
+  packet->SetPointerData(0,
+                         CreatePointerData(change, time_stamp_micros, x, y));
+  return packet;
+}
+
+}  // namespace
+
+TEST(SmoothPointerDataDispatcherTest, DeferredMoveEventsAreExtrapolated) {
+  TestDispatcherDelegate delegate;
+  SmoothPointerDataDispatcher dispatcher(delegate,
+                                         fml::TimeDelta::FromMilliseconds(8));
+
+  // The first packet dispatches immediately and marks a dispatch in progress.
+  dispatcher.DispatchPacket(CreatePacket(PointerData::Change::kDown, 0, 0, 0),
+                            0);
+  ASSERT_EQ(delegate.dispatched_packets.size(), 1u);
+
+  // A move arriving before the frame ends is deferred to the next vsync.
+  // It travels at 1 physical pixel per millisecond on both axes.
+  dispatcher.DispatchPacket(
+      CreatePacket(PointerData::Change::kMove, 10000, 10, 10), 1);
+  ASSERT_EQ(delegate.dispatched_packets.size(), 1u);
+
+  delegate.FireVsync();
+  ASSERT_EQ(delegate.dispatched_packets.size(), 2u);
+
+  // The deferred move is extrapolated by the 8ms horizon: 10px + 8px.
+  PointerData dispatched = delegate.dispatched_packets[1]->GetPointerData(0);
+  EXPECT_DOUBLE_EQ(dispatched.physical_x, 18);
+  EXPECT_DOUBLE_EQ(dispatched.physical_y, 18);
+  EXPECT_DOUBLE_EQ(dispatched.physical_delta_x, 8);
+  EXPECT_DOUBLE_EQ(dispatched.physical_delta_y, 8);
+}
+
+TEST(SmoothPointerDataDispatcherTest, ZeroHorizonDisablesPrediction) {
+  TestDispatcherDelegate delegate;
+  SmoothPointerDataDispatcher dispatcher(delegate, fml::TimeDelta::Zero());
+
+  dispatcher.DispatchPacket(CreatePacket(PointerData::Change::kDown, 0, 0, 0),
+                            0);
+  dispatcher.DispatchPacket(
+      CreatePacket(PointerData::Change::kMove, 10000, 10, 10), 1);
+  delegate.FireVsync();
+
+  ASSERT_EQ(delegate.dispatched_packets.size(), 2u);
+  PointerData dispatched = delegate.dispatched_packets[1]->GetPointerData(0);
+  EXPECT_DOUBLE_EQ(dispatched.physical_x, 10);
+  EXPECT_DOUBLE_EQ(dispatched.physical_y, 10);
+}
+
+TEST(SmoothPointerDataDispatcherTest, NoPredictionWithoutVelocitySamples) {
+  TestDispatcherDelegate delegate;
+  SmoothPointerDataDispatcher dispatcher(delegate,
+                                         fml::TimeDelta::FromMilliseconds(8));
+
+  // The down event alone carries no velocity, so a deferred down (or a move
+  // for an untracked device) passes through unmodified.
+  dispatcher.DispatchPacket(CreatePacket(PointerData::Change::kDown, 0, 5, 5),
+                            0);
+  dispatcher.DispatchPacket(CreatePacket(PointerData::Change::kDown, 1000, 5, 5),
+                            1);
+  delegate.FireVsync();
+
+  ASSERT_EQ(delegate.dispatched_packets.size(), 2u);
+  PointerData dispatched = delegate.dispatched_packets[1]->GetPointerData(0);
+  EXPECT_DOUBLE_EQ(dispatched.physical_x, 5);
+  EXPECT_DOUBLE_EQ(dispatched.physical_y, 5);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -10,11 +10,15 @@
 
 #include "flow/frame_timings.h"
 #include "flutter/common/graphics/persistent_cache.h"
+#include "flutter/display_list/display_list_complexity.h"
+#include "flutter/display_list/display_list_complexity_calibration.h"
+#include "flutter/display_list/display_list_tiled_raster.h"
 #include "flutter/flow/layers/offscreen_surface.h"
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/shell/common/serialization_callbacks.h"
 #include "fml/make_copyable.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImageEncoder.h"
 #include "third_party/skia/include/core/SkPictureRecorder.h"
 #include "third_party/skia/include/core/SkSerialProcs.h"
@@ -38,6 +42,8 @@ Rasterizer::Rasterizer(Delegate& delegate,
           SnapshotController::Make(*this, delegate.GetSettings())),
       weak_factory_(this) {
   FML_DCHECK(compositor_context_);
+  compositor_context_->raster_cache().SetCacheByteBudget(
+      delegate.GetSettings().raster_cache_max_bytes);
 }
 
 Rasterizer::~Rasterizer() = default;
@@ -64,6 +70,10 @@ void Rasterizer::Setup(std::unique_ptr<Surface> surface) {
     compositor_context_->OnGrContextCreated();
   }
 
+  if (delegate_.GetSettings().enable_complexity_calibration) {
+    SetupComplexityCalibration();
+  }
+
   if (external_view_embedder_ &&
       external_view_embedder_->SupportsDynamicThreadMerging() &&
       !raster_thread_merger_) {
@@ -84,6 +94,39 @@ void Rasterizer::Setup(std::unique_ptr<Surface> surface) {
   }
 }
 
+void Rasterizer::SetupComplexityCalibration() {
+  GrDirectContext* context = surface_ ? surface_->GetContext() : nullptr;
+  DisplayListComplexityCalculator* calculator =
+      context
+          ? DisplayListComplexityCalculator::GetForBackend(context->backend())
+          : DisplayListComplexityCalculator::GetForSoftware();
+  sk_sp<SkData> key = DisplayListComplexityCalibration::PersistentCacheKey();
+  PersistentCache* cache = PersistentCache::GetCacheForProcess();
+  std::shared_ptr<DisplayListComplexityCalibration> calibration;
+  if (sk_sp<SkData> data = cache->load(*key)) {
+    calibration = DisplayListComplexityCalibration::Deserialize(data.get());
+  }
+  if (!calibration) {
+    // First launch on this device: run the microbenchmark suite against an
+    // offscreen surface and persist the fitted table for later launches.
+    SkImageInfo info = SkImageInfo::MakeN32Premul(512, 512);
+    sk_sp<SkSurface> offscreen =
+        context ? SkSurface::MakeRenderTarget(context, SkBudgeted::kYes, info)
+                : SkSurface::MakeRaster(info);
+    if (offscreen) {
+      calibration =
+          DisplayListComplexityCalibration::Calibrate(offscreen.get(),
+                                                      calculator);
+    }
+    if (calibration) {
+      cache->store(*key, *calibration->Serialize());
+    }
+  }
+  if (calibration) {
+    calculator->SetCalibration(std::move(calibration));
+  }
+}
+
 void Rasterizer::TeardownExternalViewEmbedder() {
   if (external_view_embedder_) {
     external_view_embedder_->Teardown();
@@ -91,6 +134,11 @@ void Rasterizer::TeardownExternalViewEmbedder() {
 }
 
 void Rasterizer::Teardown() {
+  // Frames handed to the present thread reference the surface's underlying
+  // client API objects, so they must all present before the surface goes
+  // away.
+  DrainPendingPresents();
+
   if (surface_) {
     auto context_switch = surface_->MakeRenderContextCurrent();
     if (context_switch->GetResult()) {
@@ -191,12 +239,20 @@ RasterStatus Rasterizer::Draw(
         std::shared_ptr<LayerTree> layer_tree = std::move(item->layer_tree);
         std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder =
             std::move(item->frame_timings_recorder);
+        const fml::TimePoint frame_target_time =
+            frame_timings_recorder->GetVsyncTargetTime();
         if (discard_callback(*layer_tree.get())) {
           raster_status = RasterStatus::kDiscarded;
         } else {
           raster_status =
               DoDraw(std::move(frame_timings_recorder), std::move(layer_tree));
         }
+        if (raster_status == RasterStatus::kSuccess) {
+          // Feed the frame timings back to the pipeline so it can adapt its
+          // effective depth to the raster workload.
+          pipeline->RecordFrameRasterTimes(frame_target_time,
+                                           fml::TimePoint::Now());
+        }
       };
 
   PipelineConsumeResult consume_result = pipeline->Consume(consumer);
@@ -257,7 +313,8 @@ bool Rasterizer::ShouldResubmitFrame(const RasterStatus& raster_status) {
 namespace {
 std::unique_ptr<SnapshotDelegate::GpuImageResult> MakeBitmapImage(
     const sk_sp<DisplayList>& display_list,
-    const SkImageInfo& image_info) {
+    const SkImageInfo& image_info,
+    fml::BasicTaskRunner* parallel_raster_worker) {
   FML_DCHECK(display_list);
   // Use 16384 as a proxy for the maximum texture size for a GPU image.
   // This is meant to be large enough to avoid false positives in test contexts,
@@ -270,6 +327,21 @@ std::unique_ptr<SnapshotDelegate::GpuImageResult> MakeBitmapImage(
         "unable to create render target at specified size");
   };
 
+  if (parallel_raster_worker != nullptr) {
+    SkBitmap bitmap;
+    SkPixmap pixmap;
+    if (bitmap.tryAllocPixels(image_info) && bitmap.peekPixels(&pixmap)) {
+      bitmap.eraseColor(SK_ColorTRANSPARENT);
+      DisplayListTiledRaster::Rasterize(display_list, pixmap,
+                                        parallel_raster_worker);
+      bitmap.setImmutable();
+      sk_sp<SkImage> image = SkImage::MakeFromBitmap(bitmap);
+      return std::make_unique<SnapshotDelegate::GpuImageResult>(
+          GrBackendTexture(), nullptr, image,
+          image ? "" : "Unable to create image");
+    }
+  }
+
   sk_sp<SkSurface> surface = SkSurface::MakeRaster(image_info);
   SkCanvas* canvas = surface->getCanvas();
   canvas->clear(SK_ColorTRANSPARENT);
@@ -292,27 +364,30 @@ std::unique_ptr<Rasterizer::GpuImageResult> Rasterizer::MakeSkiaGpuImage(
 // I can't seem to get the GPU path working on it.
 // https://github.com/flutter/flutter/issues/108835
 #if FML_OS_LINUX
-  return MakeBitmapImage(std::move(display_list), image_info);
+  return MakeBitmapImage(std::move(display_list), image_info,
+                         parallel_raster_worker_.get());
 #endif
 
   std::unique_ptr<SnapshotDelegate::GpuImageResult> result;
   delegate_.GetIsGpuDisabledSyncSwitch()->Execute(
       fml::SyncSwitch::Handlers()
-          .SetIfTrue([&result, &image_info, &display_list] {
-            result = MakeBitmapImage(display_list, image_info);
+          .SetIfTrue([&result, &image_info, &display_list,
+                      worker = parallel_raster_worker_.get()] {
+            result = MakeBitmapImage(display_list, image_info, worker);
           })
           .SetIfFalse([&result, &image_info, &display_list,
                        surface = surface_.get(),
-                       gpu_image_behavior = gpu_image_behavior_] {
+                       gpu_image_behavior = gpu_image_behavior_,
+                       worker = parallel_raster_worker_.get()] {
             if (!surface ||
                 gpu_image_behavior == MakeGpuImageBehavior::kBitmap) {
-              result = MakeBitmapImage(display_list, image_info);
+              result = MakeBitmapImage(display_list, image_info, worker);
               return;
             }
 
             auto* context = surface->GetContext();
             if (!context) {
-              result = MakeBitmapImage(display_list, image_info);
+              result = MakeBitmapImage(display_list, image_info, worker);
               return;
             }
 
@@ -351,6 +426,14 @@ sk_sp<DlImage> Rasterizer::MakeRasterSnapshot(sk_sp<DisplayList> display_list,
   return snapshot_controller_->MakeRasterSnapshot(display_list, picture_size);
 }
 
+void Rasterizer::MakeRasterSnapshotAsync(
+    sk_sp<DisplayList> display_list,
+    SkISize picture_size,
+    const std::function<void(sk_sp<DlImage>)>& callback) {
+  snapshot_controller_->MakeRasterSnapshotAsync(std::move(display_list),
+                                                picture_size, callback);
+}
+
 sk_sp<SkImage> Rasterizer::ConvertToRasterImage(sk_sp<SkImage> image) {
   TRACE_EVENT0("flutter", __FUNCTION__);
   return snapshot_controller_->ConvertToRasterImage(image);
@@ -507,7 +590,9 @@ RasterStatus Rasterizer::DrawToSurfaceUnsafe(
   //
   // Deleting a surface also clears the GL context. Therefore, acquire the
   // frame after calling `BeginFrame` as this operation resets the GL context.
+  frame_timings_recorder.RecordBufferAcquireStart(fml::TimePoint::Now());
   auto frame = surface_->AcquireFrame(layer_tree.frame_size());
+  frame_timings_recorder.RecordBufferAcquireEnd(fml::TimePoint::Now());
   if (frame == nullptr) {
     return RasterStatus::kFailed;
   }
@@ -550,6 +635,9 @@ RasterStatus Rasterizer::DrawToSurfaceUnsafe(
           (!raster_thread_merger_ || raster_thread_merger_->IsMerged());
 
       damage = std::make_unique<FrameDamage>();
+      if (parallel_diff_worker_) {
+        damage->SetConcurrentTaskRunner(parallel_diff_worker_.get());
+      }
       if (frame->framebuffer_info().existing_damage && !force_full_repaint) {
         damage->SetPreviousLayerTree(last_layer_tree_.get());
         damage->AddAdditionalDamage(*frame->framebuffer_info().existing_damage);
@@ -574,6 +662,7 @@ RasterStatus Rasterizer::DrawToSurfaceUnsafe(
         raster_status == RasterStatus::kSkipAndRetry) {
       return raster_status;
     }
+    frame_timings_recorder.RecordRasterEncodeEnd(fml::TimePoint::Now());
 
     SurfaceFrame::SubmitInfo submit_info;
     // TODO (https://github.com/flutter/flutter/issues/105596): this can be in
@@ -587,18 +676,33 @@ RasterStatus Rasterizer::DrawToSurfaceUnsafe(
     if (damage) {
       submit_info.frame_damage = damage->GetFrameDamage();
       submit_info.buffer_damage = damage->GetBufferDamage();
+      submit_info.frame_damage_rects = damage->GetFrameDamageRects();
     }
 
     frame->set_submit_info(submit_info);
 
+    frame_timings_recorder.RecordPresentStart(fml::TimePoint::Now());
+    bool present_deferred = false;
     if (external_view_embedder_ &&
         (!raster_thread_merger_ || raster_thread_merger_->IsMerged())) {
       FML_DCHECK(!frame->IsSubmitted());
       external_view_embedder_->SubmitFrame(surface_->GetContext(),
                                            std::move(frame));
+    } else if (frame->SupportsThreadedPresent()) {
+      // The submit callback only encodes and flushes the frame; the
+      // swap/present runs on the present thread so a blocking swap (e.g. a
+      // full buffer queue) overlaps with the next frame's rasterization
+      // instead of eating its budget.
+      if (frame->SubmitDeferringPresent()) {
+        EnqueuePresent(std::move(frame));
+      }
+      present_deferred = true;
     } else {
       frame->Submit();
     }
+    if (!present_deferred) {
+      frame_timings_recorder.RecordPresentEnd(fml::TimePoint::Now());
+    }
 
     compositor_context_->raster_cache().EndFrame();
     frame_timings_recorder.RecordRasterEnd(
@@ -747,6 +851,29 @@ void Rasterizer::SetExternalViewEmbedder(
   external_view_embedder_ = view_embedder;
 }
 
+void Rasterizer::SetBackgroundRasterizationWorker(
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker) {
+  background_rasterization_worker_ = worker;
+  compositor_context_->raster_cache().SetBackgroundRasterizationTaskRunner(
+      worker.get());
+}
+
+void Rasterizer::SetParallelDiffWorker(
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker) {
+  parallel_diff_worker_ = worker;
+}
+
+void Rasterizer::SetParallelPrerollWorker(
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker) {
+  parallel_preroll_worker_ = worker;
+  compositor_context_->SetPrerollTaskRunner(worker.get());
+}
+
+void Rasterizer::SetParallelRasterWorker(
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker) {
+  parallel_raster_worker_ = worker;
+}
+
 void Rasterizer::SetSnapshotSurfaceProducer(
     std::unique_ptr<SnapshotSurfaceProducer> producer) {
   snapshot_surface_producer_ = std::move(producer);
@@ -756,6 +883,42 @@ fml::RefPtr<fml::RasterThreadMerger> Rasterizer::GetRasterThreadMerger() {
   return raster_thread_merger_;
 }
 
+void Rasterizer::EnqueuePresent(std::unique_ptr<SurfaceFrame> frame) {
+  if (!present_thread_) {
+    present_thread_ = std::make_unique<fml::Thread>(
+        fml::Thread::SetCurrentThreadName,
+        fml::Thread::ThreadConfig("io.flutter.raster.present",
+                                  fml::Thread::ThreadPriority::RASTER));
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(present_queue_mutex_);
+    present_queue_cv_.wait(
+        lock, [this] { return pending_presents_ < kMaxPendingPresents; });
+    pending_presents_++;
+  }
+
+  present_thread_->GetTaskRunner()->PostTask(
+      fml::MakeCopyable([this, frame = std::move(frame)]() mutable {
+        TRACE_EVENT0("flutter", "SurfaceFramePresent");
+        frame->Present();
+        frame.reset();
+        {
+          std::scoped_lock lock(present_queue_mutex_);
+          pending_presents_--;
+        }
+        present_queue_cv_.notify_all();
+      }));
+}
+
+void Rasterizer::DrainPendingPresents() {
+  if (!present_thread_) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(present_queue_mutex_);
+  present_queue_cv_.wait(lock, [this] { return pending_presents_ == 0; });
+}
+
 void Rasterizer::FireNextFrameCallbackIfPresent() {
   if (!next_frame_callback_) {
     return;
@@ -791,6 +954,20 @@ void Rasterizer::SetResourceCacheMaxBytes(size_t max_bytes, bool from_user) {
   }
 }
 
+void Rasterizer::SetRasterCacheByteBudget(size_t budget_bytes) {
+  compositor_context_->raster_cache().SetCacheByteBudget(budget_bytes);
+}
+
+std::vector<RasterCache::TransferableEntry>
+Rasterizer::CollectTransferableRasterCacheEntries() const {
+  return compositor_context_->raster_cache().ExportTransferableEntries();
+}
+
+void Rasterizer::SeedRasterCache(
+    const std::vector<RasterCache::TransferableEntry>& entries) {
+  compositor_context_->raster_cache().SeedCacheEntries(entries);
+}
+
 std::optional<size_t> Rasterizer::GetResourceCacheMaxBytes() const {
   if (!surface_) {
     return std::nullopt;
@@ -5,7 +5,9 @@
 #ifndef SHELL_COMMON_RASTERIZER_H_
 #define SHELL_COMMON_RASTERIZER_H_
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 #include "flutter/common/settings.h"
@@ -17,10 +19,12 @@
 #include "flutter/flow/layers/layer_tree.h"
 #include "flutter/flow/surface.h"
 #include "flutter/fml/closure.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/raster_thread_merger.h"
 #include "flutter/fml/synchronization/sync_switch.h"
 #include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/lib/ui/snapshot_delegate.h"
@@ -387,6 +391,55 @@ class Rasterizer final : public SnapshotDelegate,
   void SetSnapshotSurfaceProducer(
       std::unique_ptr<SnapshotSurfaceProducer> producer);
 
+  //----------------------------------------------------------------------------
+  /// @brief Set the worker on which display list raster cache entries are
+  ///        rasterized in the background instead of inline on the raster
+  ///        thread. This is done on shell initialization when background
+  ///        raster cache population is enabled in the settings.
+  ///
+  /// @param[in]  worker  The concurrent worker used to populate cache
+  ///                     entries. The rasterizer retains the worker for its
+  ///                     own lifetime.
+  ///
+  void SetBackgroundRasterizationWorker(
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& worker);
+
+  //----------------------------------------------------------------------------
+  /// @brief Set the worker used to diff independent layer subtrees
+  ///        concurrently when computing partial repaint damage. This is done
+  ///        on shell initialization when parallel layer diffing is enabled
+  ///        in the settings.
+  ///
+  /// @param[in]  worker  The concurrent worker used for subtree diffs. The
+  ///                     rasterizer retains the worker for its own lifetime.
+  ///
+  void SetParallelDiffWorker(
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& worker);
+
+  //----------------------------------------------------------------------------
+  /// @brief Set the worker used to preroll independent layer subtrees
+  ///        concurrently before painting. This is done on shell
+  ///        initialization when parallel layer tree preroll is enabled in
+  ///        the settings.
+  ///
+  /// @param[in]  worker  The concurrent worker used for subtree preroll. The
+  ///                     rasterizer retains the worker for its own lifetime.
+  ///
+  void SetParallelPrerollWorker(
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& worker);
+
+  //----------------------------------------------------------------------------
+  /// @brief Set the worker used to rasterize software (CPU) bitmap images
+  ///        tile by tile instead of on one thread. This is done on shell
+  ///        initialization when parallel software rasterization is enabled
+  ///        in the settings.
+  ///
+  /// @param[in]  worker  The concurrent worker used for tile raster. The
+  ///                     rasterizer retains the worker for its own lifetime.
+  ///
+  void SetParallelRasterWorker(
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& worker);
+
   //----------------------------------------------------------------------------
   /// @brief      Returns a pointer to the compositor context used by this
   ///             rasterizer. This pointer will never be `nullptr`.
@@ -430,6 +483,39 @@ class Rasterizer final : public SnapshotDelegate,
   ///
   void SetResourceCacheMaxBytes(size_t max_bytes, bool from_user);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Set the `RasterCache` byte budget enforced after each frame.
+  ///             Used by the shell to scale the cache down under platform
+  ///             memory pressure and back up on recovery. A budget of zero
+  ///             disables byte based eviction.
+  ///
+  /// @see        `RasterCache::SetCacheByteBudget`
+  ///
+  /// @param[in]  budget_bytes  The maximum byte size of images retained by
+  ///                           the raster cache across frames.
+  ///
+  void SetRasterCacheByteBudget(size_t budget_bytes);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Export the CPU backed entries of this rasterizer's
+  ///             `RasterCache` for seeding a freshly spawned shell's
+  ///             rasterizer. Must be called on the raster task runner.
+  ///
+  /// @see        `RasterCache::ExportTransferableEntries`
+  ///
+  std::vector<RasterCache::TransferableEntry>
+  CollectTransferableRasterCacheEntries() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Seed this rasterizer's `RasterCache` with entries exported
+  ///             from another rasterizer, typically the spawning shell's.
+  ///             Must be called on the raster task runner.
+  ///
+  /// @see        `RasterCache::SeedCacheEntries`
+  ///
+  void SeedRasterCache(
+      const std::vector<RasterCache::TransferableEntry>& entries);
+
   //----------------------------------------------------------------------------
   /// @brief      The current value of Skia's resource cache size, if a surface
   ///             is present.
@@ -469,6 +555,11 @@ class Rasterizer final : public SnapshotDelegate,
   void DisableThreadMergerIfNeeded();
 
  private:
+  // Loads the persisted display list complexity calibration for this
+  // device, running the microbenchmark suite to fit one on first launch,
+  // and installs it on the calculator for the surface's backend.
+  void SetupComplexityCalibration();
+
   // |SnapshotDelegate|
   std::unique_ptr<GpuImageResult> MakeSkiaGpuImage(
       sk_sp<DisplayList> display_list,
@@ -478,6 +569,12 @@ class Rasterizer final : public SnapshotDelegate,
   sk_sp<DlImage> MakeRasterSnapshot(sk_sp<DisplayList> display_list,
                                     SkISize picture_size) override;
 
+  // |SnapshotDelegate|
+  void MakeRasterSnapshotAsync(
+      sk_sp<DisplayList> display_list,
+      SkISize picture_size,
+      const std::function<void(sk_sp<DlImage>)>& callback) override;
+
   // |SnapshotDelegate|
   sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) override;
 
@@ -522,6 +619,15 @@ class Rasterizer final : public SnapshotDelegate,
 
   void FireNextFrameCallbackIfPresent();
 
+  // Hand a submitted frame to the present thread, creating the thread on
+  // first use. At most |kMaxPendingPresents| frames may be awaiting
+  // presentation; beyond that the raster thread blocks here, so a stalled
+  // swap applies back-pressure instead of queueing frames without bound.
+  void EnqueuePresent(std::unique_ptr<SurfaceFrame> frame);
+
+  // Blocks until every frame handed to the present thread has presented.
+  void DrainPendingPresents();
+
   static bool NoDiscard(const flutter::LayerTree& layer_tree) { return false; }
   static bool ShouldResubmitFrame(const RasterStatus& raster_status);
 
@@ -543,6 +649,20 @@ class Rasterizer final : public SnapshotDelegate,
   fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger_;
   std::shared_ptr<ExternalViewEmbedder> external_view_embedder_;
   std::unique_ptr<SnapshotController> snapshot_controller_;
+  // Keeps the raster cache's background rasterization worker alive for as
+  // long as the cache may post tasks to it.
+  std::shared_ptr<fml::ConcurrentTaskRunner> background_rasterization_worker_;
+  std::shared_ptr<fml::ConcurrentTaskRunner> parallel_diff_worker_;
+  std::shared_ptr<fml::ConcurrentTaskRunner> parallel_preroll_worker_;
+  std::shared_ptr<fml::ConcurrentTaskRunner> parallel_raster_worker_;
+  // Guard the pending-present count. The present thread is declared after
+  // them so its destructor joins (and drains the queue) before they are
+  // destroyed.
+  std::mutex present_queue_mutex_;
+  std::condition_variable present_queue_cv_;
+  size_t pending_presents_ = 0;
+  static constexpr size_t kMaxPendingPresents = 2;
+  std::unique_ptr<fml::Thread> present_thread_;
 
   // WeakPtrFactory must be the last member.
   fml::TaskRunnerAffineWeakPtrFactory<Rasterizer> weak_factory_;
@@ -6,6 +6,23 @@
 
 namespace flutter {
 
+namespace {
+
+// The percentage of the configured budgets retained at each pressure stage.
+size_t ScalePercentage(MemoryPressureLevel level) {
+  switch (level) {
+    case MemoryPressureLevel::kNone:
+      return 100u;
+    case MemoryPressureLevel::kModerate:
+      return 60u;
+    case MemoryPressureLevel::kCritical:
+      return 30u;
+  }
+  return 100u;
+}
+
+}  // namespace
+
 size_t ResourceCacheLimitCalculator::GetResourceCacheMaxBytes() {
   size_t max_bytes = 0;
   size_t max_bytes_threshold = max_bytes_threshold_ > 0
@@ -19,7 +36,24 @@ size_t ResourceCacheLimitCalculator::GetResourceCacheMaxBytes() {
     }
   }
   items_ = std::move(live_items);
-  return std::min(max_bytes, max_bytes_threshold);
+  return ScaleForMemoryPressure(std::min(max_bytes, max_bytes_threshold));
+}
+
+void ResourceCacheLimitCalculator::SetMemoryPressureLevel(
+    MemoryPressureLevel level) {
+  if (level >= applied_level_) {
+    applied_level_ = level;
+    return;
+  }
+  // Recovery: step back up one stage per notification so the caches
+  // re-inflate gradually.
+  applied_level_ =
+      static_cast<MemoryPressureLevel>(static_cast<int>(applied_level_) - 1);
+}
+
+size_t ResourceCacheLimitCalculator::ScaleForMemoryPressure(
+    size_t bytes) const {
+  return bytes * ScalePercentage(applied_level_) / 100u;
 }
 
 }  // namespace flutter
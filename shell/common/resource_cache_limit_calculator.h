@@ -12,6 +12,19 @@
 #include "flutter/fml/memory/weak_ptr.h"
 
 namespace flutter {
+
+// The memory pressure stages reported by the platform, ordered from least to
+// most severe. Each stage scales the GPU cache budgets down so memory is
+// returned to the OS before it resorts to killing the process.
+enum class MemoryPressureLevel : int {
+  // No pressure: caches run at their full configured budgets.
+  kNone = 0,
+  // The OS is running low: budgets are scaled to 60%.
+  kModerate = 1,
+  // The process is a kill candidate: budgets are scaled to 30%.
+  kCritical = 2,
+};
+
 class ResourceCacheLimitItem {
  public:
   // The expected GPU resource cache limit in bytes. This will be called on the
@@ -35,12 +48,31 @@ class ResourceCacheLimitCalculator {
   }
 
   // The maximum GPU resource cache limit in bytes calculated by
-  // 'ResourceCacheLimitItem's. This will be called on the platform thread.
+  // 'ResourceCacheLimitItem's, scaled by the applied memory pressure stage.
+  // This will be called on the platform thread.
   size_t GetResourceCacheMaxBytes();
 
+  // Record a memory pressure notification from the platform. Worsening
+  // pressure takes effect immediately, while recovery steps the applied
+  // stage back up by at most one stage per call so repeated recovery
+  // notifications restore the budgets gradually instead of re-inflating the
+  // caches all at once. This will be called on the platform thread.
+  void SetMemoryPressureLevel(MemoryPressureLevel level);
+
+  // The pressure stage currently applied to the budgets. This may be more
+  // severe than the last reported level while a recovery is being stepped
+  // through.
+  MemoryPressureLevel GetAppliedMemoryPressureLevel() const {
+    return applied_level_;
+  }
+
+  // Scale a byte budget by the applied memory pressure stage.
+  size_t ScaleForMemoryPressure(size_t bytes) const;
+
  private:
   std::vector<fml::WeakPtr<ResourceCacheLimitItem>> items_;
   size_t max_bytes_threshold_;
+  MemoryPressureLevel applied_level_ = MemoryPressureLevel::kNone;
   FML_DISALLOW_COPY_AND_ASSIGN(ResourceCacheLimitCalculator);
 };
 }  // namespace flutter
@@ -50,5 +50,41 @@ TEST(ResourceCacheLimitCalculatorTest, GetResourceCacheMaxBytes) {
   EXPECT_EQ(calculator.GetResourceCacheMaxBytes(), static_cast<size_t>(500U));
 }
 
+TEST(ResourceCacheLimitCalculatorTest, MemoryPressureScalesMaxBytes) {
+  ResourceCacheLimitCalculator calculator(0U);
+  auto item = std::make_unique<TestResourceCacheLimitItem>(1000U);
+  calculator.AddResourceCacheLimitItem(item->GetWeakPtr());
+  EXPECT_EQ(calculator.GetResourceCacheMaxBytes(), static_cast<size_t>(1000U));
+
+  calculator.SetMemoryPressureLevel(MemoryPressureLevel::kModerate);
+  EXPECT_EQ(calculator.GetResourceCacheMaxBytes(), static_cast<size_t>(600U));
+
+  calculator.SetMemoryPressureLevel(MemoryPressureLevel::kCritical);
+  EXPECT_EQ(calculator.GetResourceCacheMaxBytes(), static_cast<size_t>(300U));
+  EXPECT_EQ(calculator.ScaleForMemoryPressure(500U), static_cast<size_t>(150U));
+}
+
+TEST(ResourceCacheLimitCalculatorTest, MemoryPressureRecoversOneStagePerCall) {
+  ResourceCacheLimitCalculator calculator(0U);
+  auto item = std::make_unique<TestResourceCacheLimitItem>(1000U);
+  calculator.AddResourceCacheLimitItem(item->GetWeakPtr());
+
+  // Worsening pressure may skip stages and applies immediately.
+  calculator.SetMemoryPressureLevel(MemoryPressureLevel::kCritical);
+  EXPECT_EQ(calculator.GetAppliedMemoryPressureLevel(),
+            MemoryPressureLevel::kCritical);
+
+  // Recovery steps back up a single stage per notification.
+  calculator.SetMemoryPressureLevel(MemoryPressureLevel::kNone);
+  EXPECT_EQ(calculator.GetAppliedMemoryPressureLevel(),
+            MemoryPressureLevel::kModerate);
+  EXPECT_EQ(calculator.GetResourceCacheMaxBytes(), static_cast<size_t>(600U));
+
+  calculator.SetMemoryPressureLevel(MemoryPressureLevel::kNone);
+  EXPECT_EQ(calculator.GetAppliedMemoryPressureLevel(),
+            MemoryPressureLevel::kNone);
+  EXPECT_EQ(calculator.GetResourceCacheMaxBytes(), static_cast<size_t>(1000U));
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -5,6 +5,7 @@
 #define RAPIDJSON_HAS_STDSTRING 1
 #include "flutter/shell/common/shell.h"
 
+#include <cstdlib>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -19,6 +20,7 @@
 #include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/message_loop.h"
+#include "flutter/fml/message_loop_task_queues.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/runtime/dart_vm.h"
@@ -205,22 +207,20 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
       });
 
   // Create the platform view on the platform thread (this thread).
+  auto platform_setup_trace_id = fml::tracing::TraceNonce();
+  TRACE_EVENT_ASYNC_BEGIN0("flutter", "ShellSetupPlatformSubsystem",
+                           platform_setup_trace_id);
   auto platform_view = on_create_platform_view(*shell.get());
   if (!platform_view || !platform_view->GetWeakPtr()) {
     return nullptr;
   }
 
-  // Ask the platform view for the vsync waiter. This will be used by the engine
-  // to create the animator.
-  auto vsync_waiter = platform_view->CreateVSyncWaiter();
-  if (!vsync_waiter) {
-    return nullptr;
-  }
-
   // Create the IO manager on the IO thread. The IO manager must be initialized
   // first because it has state that the other subsystems depend on. It must
   // first be booted and the necessary references obtained to initialize the
-  // other subsystems.
+  // other subsystems. The task is posted as soon as the platform view exists
+  // so resource context and GrContext warmup overlap the remaining
+  // platform-thread setup.
   std::promise<std::shared_ptr<ShellIOManager>> io_manager_promise;
   auto io_manager_future = io_manager_promise.get_future();
   std::promise<fml::WeakPtr<ShellIOManager>> weak_io_manager_promise;
@@ -259,9 +259,18 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
         io_manager_promise.set_value(io_manager);
       });
 
+  // Ask the platform view for the vsync waiter. This will be used by the engine
+  // to create the animator.
+  auto vsync_waiter = platform_view->CreateVSyncWaiter();
+  if (!vsync_waiter) {
+    return nullptr;
+  }
+
   // Send dispatcher_maker to the engine constructor because shell won't have
   // platform_view set until Shell::Setup is called later.
   auto dispatcher_maker = platform_view->GetDispatcherMaker();
+  TRACE_EVENT_ASYNC_END0("flutter", "ShellSetupPlatformSubsystem",
+                         platform_setup_trace_id);
 
   // Create the engine on the UI thread.
   std::promise<std::unique_ptr<Engine>> engine_promise;
@@ -301,6 +310,10 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
                              shell->volatile_path_tracker_));
       }));
 
+  // Join on the concurrent subsystem setup. Each subsystem traces its own
+  // phase; this span shows how long the platform thread stalls on the
+  // slowest of them.
+  TRACE_EVENT0("flutter", "ShellSetupJoin");
   if (!shell->Setup(std::move(platform_view),  //
                     engine_future.get(),       //
                     rasterizer_future.get(),   //
@@ -436,6 +449,15 @@ Shell::Shell(DartVMRef vm,
           task_runners_.GetUITaskRunner(),
           std::bind(&Shell::OnServiceProtocolGetDisplayRefreshRate, this,
                     std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetTaskQueueMetricsExtensionName] = {
+          task_runners_.GetUITaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetTaskQueueMetrics, this,
+                    std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_[ServiceProtocol::kGetFrameTimeStatsExtensionName] =
+      {task_runners_.GetUITaskRunner(),
+       std::bind(&Shell::OnServiceProtocolGetFrameTimeStats, this,
+                 std::placeholders::_1, std::placeholders::_2)};
   service_protocol_handlers_[ServiceProtocol::kGetSkSLsExtensionName] = {
       task_runners_.GetIOTaskRunner(),
       std::bind(&Shell::OnServiceProtocolGetSkSLs, this, std::placeholders::_1,
@@ -445,6 +467,11 @@ Shell::Shell(DartVMRef vm,
           task_runners_.GetRasterTaskRunner(),
           std::bind(&Shell::OnServiceProtocolEstimateRasterCacheMemory, this,
                     std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetRasterCacheStatsExtensionName] = {
+          task_runners_.GetRasterTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetRasterCacheStats, this,
+                    std::placeholders::_1, std::placeholders::_2)};
   service_protocol_handlers_
       [ServiceProtocol::kRenderFrameWithRasterStatsExtensionName] = {
           task_runners_.GetRasterTaskRunner(),
@@ -454,6 +481,10 @@ Shell::Shell(DartVMRef vm,
       task_runners_.GetPlatformTaskRunner(),
       std::bind(&Shell::OnServiceProtocolReloadAssetFonts, this,
                 std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_[ServiceProtocol::kSetSkiaTracingExtensionName] = {
+      task_runners_.GetPlatformTaskRunner(),
+      std::bind(&Shell::OnServiceProtocolSetSkiaTracing, this,
+                std::placeholders::_1, std::placeholders::_2)};
 }
 
 Shell::~Shell() {
@@ -546,6 +577,23 @@ std::unique_ptr<Shell> Shell::Spawn(
             /*snapshot_delegate=*/std::move(snapshot_delegate));
       },
       is_gpu_disabled);
+
+  // Warm-start the spawn. The persistent shader cache is process global and
+  // the typographer caches travel with the shared FontCollection, so only the
+  // raster cache needs an explicit transfer. Both rasterizers live on the
+  // shared raster task runner, so a single task can read the parent and seed
+  // the child. Exported entries share their immutable images with the parent;
+  // seeds whose keys the spawn never references are evicted by its first
+  // frame's unused-entry sweep.
+  task_runners_.GetRasterTaskRunner()->PostTask(
+      [parent = rasterizer_->GetWeakPtr(),
+       child = result->rasterizer_->GetWeakPtr()]() {
+        if (parent && child) {
+          child->SeedRasterCache(
+              parent->CollectTransferableRasterCacheEntries());
+        }
+      });
+
   result->RunEngine(std::move(run_configuration));
   return result;
 }
@@ -572,6 +620,30 @@ void Shell::NotifyLowMemoryWarning() const {
   // to purge them.
 }
 
+void Shell::NotifyMemoryPressure(MemoryPressureLevel level) {
+  FML_DCHECK(is_setup_);
+  FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
+
+  resource_cache_limit_calculator_->SetMemoryPressureLevel(level);
+
+  // Both budgets are recomputed from their unscaled bases on every
+  // notification, so repeated calls converge on the configured limits as the
+  // applied stage recovers.
+  const size_t resource_cache_max_bytes =
+      resource_cache_limit_calculator_->GetResourceCacheMaxBytes();
+  const size_t raster_cache_byte_budget =
+      resource_cache_limit_calculator_->ScaleForMemoryPressure(
+          settings_.raster_cache_max_bytes);
+  task_runners_.GetRasterTaskRunner()->PostTask(
+      [rasterizer = rasterizer_->GetWeakPtr(), resource_cache_max_bytes,
+       raster_cache_byte_budget] {
+        if (rasterizer) {
+          rasterizer->SetResourceCacheMaxBytes(resource_cache_max_bytes, false);
+          rasterizer->SetRasterCacheByteBudget(raster_cache_byte_budget);
+        }
+      });
+}
+
 void Shell::RunEngine(RunConfiguration run_configuration) {
   RunEngine(std::move(run_configuration), nullptr);
 }
@@ -676,6 +748,27 @@ bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
   rasterizer_->SetSnapshotSurfaceProducer(
       platform_view_->CreateSnapshotSurfaceProducer());
 
+  // The concurrent worker pool is shared by every shell in the process (it
+  // lives on the leased Dart VM), so this shell posts its burst work through
+  // one fairness client to avoid starving sibling shells.
+  worker_task_runner_ = vm_->MakeClientWorkerTaskRunner();
+
+  if (settings_.enable_background_raster_cache_population) {
+    rasterizer_->SetBackgroundRasterizationWorker(worker_task_runner_);
+  }
+
+  if (settings_.enable_parallel_layer_tree_diff) {
+    rasterizer_->SetParallelDiffWorker(worker_task_runner_);
+  }
+
+  if (settings_.enable_parallel_layer_tree_preroll) {
+    rasterizer_->SetParallelPrerollWorker(worker_task_runner_);
+  }
+
+  if (settings_.enable_parallel_software_rasterization) {
+    rasterizer_->SetParallelRasterWorker(worker_task_runner_);
+  }
+
   // The weak ptr must be generated in the platform thread which owns the unique
   // ptr.
   weak_engine_ = engine_->GetWeakPtr();
@@ -938,6 +1031,13 @@ void Shell::OnPlatformViewSetViewportMetrics(const ViewportMetrics& metrics) {
         }
       });
 
+  // Let the unref queue drain eagerly once it holds a significant fraction
+  // of the GPU resource budget instead of waiting out its drain delay. The
+  // threshold setter is thread safe, so no hop to the IO thread is needed.
+  if (auto unref_queue = io_manager_->GetSkiaUnrefQueue()) {
+    unref_queue->SetDrainImmediatelyByteThreshold(resource_cache_max_bytes / 4);
+  }
+
   task_runners_.GetUITaskRunner()->PostTask(
       [engine = engine_->GetWeakPtr(), metrics]() {
         if (engine) {
@@ -961,12 +1061,14 @@ void Shell::OnPlatformViewDispatchPlatformMessage(
 
   // The static leak checker gets confused by the use of fml::MakeCopyable.
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
-  task_runners_.GetUITaskRunner()->PostTask(fml::MakeCopyable(
-      [engine = engine_->GetWeakPtr(), message = std::move(message)]() mutable {
+  task_runners_.GetUITaskRunner()->PostTaskWithGrade(
+      fml::MakeCopyable([engine = engine_->GetWeakPtr(),
+                         message = std::move(message)]() mutable {
         if (engine) {
           engine->DispatchPlatformMessage(std::move(message));
         }
-      }));
+      }),
+      fml::TaskSourceGrade::kUserInteraction);
 }
 
 // |PlatformView::Delegate|
@@ -976,13 +1078,14 @@ void Shell::OnPlatformViewDispatchPointerDataPacket(
   TRACE_FLOW_BEGIN("flutter", "PointerEvent", next_pointer_flow_id_);
   FML_DCHECK(is_setup_);
   FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
-  task_runners_.GetUITaskRunner()->PostTask(
+  task_runners_.GetUITaskRunner()->PostTaskWithGrade(
       fml::MakeCopyable([engine = weak_engine_, packet = std::move(packet),
                          flow_id = next_pointer_flow_id_]() mutable {
         if (engine) {
           engine->DispatchPointerDataPacket(std::move(packet), flow_id);
         }
-      }));
+      }),
+      fml::TaskSourceGrade::kUserInteraction);
   next_pointer_flow_id_++;
 }
 
@@ -1034,14 +1137,15 @@ void Shell::OnPlatformViewRegisterTexture(
   FML_DCHECK(is_setup_);
   FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
 
-  task_runners_.GetRasterTaskRunner()->PostTask(
-      [rasterizer = rasterizer_->GetWeakPtr(), texture] {
-        if (rasterizer) {
-          if (auto registry = rasterizer->GetTextureRegistry()) {
-            registry->RegisterTexture(texture);
-          }
-        }
-      });
+  // Registration only publishes a new registry version and invokes no
+  // texture callbacks, so it can happen right here on the platform thread
+  // instead of queueing work ahead of the next frame on the raster thread.
+  // The raster thread picks up the new version on its next lookup.
+  if (rasterizer_) {
+    if (auto registry = rasterizer_->GetTextureRegistry()) {
+      registry->RegisterTexture(std::move(texture));
+    }
+  }
 }
 
 // |PlatformView::Delegate|
@@ -1443,6 +1547,27 @@ void Shell::OnFrameRasterized(const FrameTiming& timing) {
     settings_.frame_rasterized_callback(timing);
   }
 
+  // Let the animator's latency governor adapt the start of subsequent frames
+  // to the observed frame workload.
+  task_runners_.GetUITaskRunner()->PostTask([engine = weak_engine_, timing]() {
+    if (engine) {
+      engine->RecordFrameTiming(timing);
+    }
+  });
+
+  if (settings_.snapshot_residency_hints && !snapshot_pages_released_) {
+    // The launch-critical snapshot pages have served their purpose; let the
+    // OS reclaim the cold ones. Regions that are still hot refault from the
+    // backing file on next use.
+    snapshot_pages_released_ = true;
+    if (auto vm_data = vm_->GetVMData()) {
+      vm_data->GetVMSnapshot().ReleaseResidentPages();
+      if (auto isolate_snapshot = vm_data->GetIsolateSnapshot()) {
+        isolate_snapshot->ReleaseResidentPages();
+      }
+    }
+  }
+
   if (!needs_report_timings_) {
     return;
   }
@@ -1719,10 +1844,119 @@ bool Shell::OnServiceProtocolGetDisplayRefreshRate(
   return true;
 }
 
+bool Shell::OnServiceProtocolGetTaskQueueMetrics(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetUITaskRunner()->RunsTasksOnCurrentThread());
+
+  // An optional "enable" param toggles process-wide collection; the counters
+  // reported below only advance while collection is enabled.
+  auto enable_param = params.find("enable");
+  if (enable_param != params.end()) {
+    fml::MessageLoopTaskQueues::SetMetricsEnabled(enable_param->second ==
+                                                  "true");
+  }
+
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "TaskQueueMetrics", allocator);
+  response->AddMember("enabled",
+                      fml::MessageLoopTaskQueues::GetMetricsEnabled(),
+                      allocator);
+
+  const std::pair<const char*, fml::RefPtr<fml::TaskRunner>> runners[] = {
+      {"platform", task_runners_.GetPlatformTaskRunner()},
+      {"ui", task_runners_.GetUITaskRunner()},
+      {"raster", task_runners_.GetRasterTaskRunner()},
+      {"io", task_runners_.GetIOTaskRunner()},
+  };
+
+  auto* task_queues = fml::MessageLoopTaskQueues::GetInstance();
+  rapidjson::Value queues(rapidjson::kArrayType);
+  for (const auto& [name, runner] : runners) {
+    if (!runner) {
+      continue;
+    }
+    const auto queue_id = runner->GetTaskQueueId();
+    const auto metrics = task_queues->GetMetrics(queue_id);
+
+    rapidjson::Value queue(rapidjson::kObjectType);
+    queue.AddMember("name", rapidjson::Value(name, allocator), allocator);
+    queue.AddMember("queueId", static_cast<uint64_t>(queue_id), allocator);
+    queue.AddMember("depthHighWatermark",
+                    static_cast<uint64_t>(metrics.depth_high_watermark),
+                    allocator);
+    queue.AddMember("wakeUpCount", metrics.wake_up_count, allocator);
+    queue.AddMember("tasksRunCount", metrics.tasks_run_count, allocator);
+
+    rapidjson::Value buckets(rapidjson::kArrayType);
+    for (uint64_t count : metrics.latency_buckets) {
+      buckets.PushBack(count, allocator);
+    }
+    queue.AddMember("latencyBucketsMicros", buckets, allocator);
+    queues.PushBack(queue, allocator);
+  }
+  response->AddMember("queues", queues, allocator);
+  return true;
+}
+
+bool Shell::OnServiceProtocolGetFrameTimeStats(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetUITaskRunner()->RunsTasksOnCurrentThread());
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "FrameTimeStats", allocator);
+  response->AddMember("sampleWindowSize",
+                      static_cast<uint64_t>(Stopwatch::kMaxSamples), allocator);
+
+  if (!rasterizer_) {
+    return true;
+  }
+
+  // The stopwatches are written on the raster thread; their atomic lap ring
+  // buffers make this cross-thread read safe without stalling that thread.
+  auto* compositor_context = rasterizer_->compositor_context();
+  const std::pair<const char*, const Stopwatch&> stopwatches[] = {
+      {"ui", compositor_context->ui_time()},
+      {"raster", compositor_context->raster_time()},
+  };
+  for (const auto& [name, stopwatch] : stopwatches) {
+    Stopwatch::Statistics stats = stopwatch.GetStatistics();
+    rapidjson::Value entry(rapidjson::kObjectType);
+    entry.AddMember("averageMicros", stats.average.ToMicroseconds(), allocator);
+    entry.AddMember("maxMicros", stats.max.ToMicroseconds(), allocator);
+    entry.AddMember("p50Micros", stats.p50.ToMicroseconds(), allocator);
+    entry.AddMember("p90Micros", stats.p90.ToMicroseconds(), allocator);
+    entry.AddMember("p99Micros", stats.p99.ToMicroseconds(), allocator);
+    response->AddMember(rapidjson::Value(name, allocator), entry, allocator);
+  }
+  return true;
+}
+
 double Shell::GetMainDisplayRefreshRate() {
   return display_manager_->GetMainDisplayRefreshRate();
 }
 
+void Shell::RequestDisplayRefreshRate(double refresh_rate) {
+  FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
+  FML_DCHECK(is_setup_);
+  FML_DCHECK(refresh_rate >= 0);
+
+  display_manager_->RequestRefreshRate(refresh_rate);
+
+  // Pace frame production regardless of whether the platform lowers the
+  // physical rate: wakeups stay vsync aligned, but frames are only begun at
+  // the requested rate.
+  fml::TaskRunner::RunNowOrPostTask(
+      task_runners_.GetUITaskRunner(),
+      [engine = engine_->GetWeakPtr(), refresh_rate]() {
+        if (engine) {
+          engine->SetMaxRefreshRate(refresh_rate);
+        }
+      });
+}
+
 void Shell::RegisterImageDecoder(ImageGeneratorFactory factory,
                                  int32_t priority) {
   FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
@@ -1738,6 +1972,50 @@ void Shell::RegisterImageDecoder(ImageGeneratorFactory factory,
       });
 }
 
+bool Shell::OnServiceProtocolSetSkiaTracing(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "SetSkiaTracing", allocator);
+
+  if (auto found = params.find("samplingInterval"); found != params.end()) {
+    const std::string value(found->second);
+    char* end = nullptr;
+    unsigned long interval = strtoul(value.c_str(), &end, 10);
+    if (end != value.c_str()) {
+      SetSkiaTracingSamplingInterval(static_cast<uint32_t>(interval));
+      response->AddMember("samplingInterval",
+                          static_cast<uint32_t>(interval == 0 ? 1 : interval),
+                          allocator);
+    }
+  }
+
+  if (auto found = params.find("category"); found != params.end()) {
+    bool enabled = true;
+    if (auto enabled_param = params.find("enabled");
+        enabled_param != params.end()) {
+      enabled = enabled_param->second == "true";
+    }
+    const bool updated =
+        SetSkiaTracingCategoryEnabled(std::string(found->second), enabled);
+    response->AddMember("updated", updated, allocator);
+  }
+
+  rapidjson::Value categories(rapidjson::kArrayType);
+  for (const auto& category : GetSkiaTracingCategories()) {
+    rapidjson::Value entry(rapidjson::kObjectType);
+    entry.AddMember("name", rapidjson::Value(category.name, allocator),
+                    allocator);
+    entry.AddMember("enabled", category.enabled, allocator);
+    entry.AddMember("eventCount", category.event_count, allocator);
+    categories.PushBack(entry, allocator);
+  }
+  response->AddMember("categories", categories, allocator);
+  return true;
+}
+
 bool Shell::OnServiceProtocolGetSkSLs(
     const ServiceProtocol::Handler::ServiceProtocolMap& params,
     rapidjson::Document* response) {
@@ -1786,6 +2064,37 @@ bool Shell::OnServiceProtocolEstimateRasterCacheMemory(
   return true;
 }
 
+bool Shell::OnServiceProtocolGetRasterCacheStats(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  const auto& raster_cache = rasterizer_->compositor_context()->raster_cache();
+  const RasterCache::Statistics stats = raster_cache.GetStatistics();
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "RasterCacheStats", allocator);
+  response->AddMember<uint64_t>("layerEntryCount", stats.layer_entry_count,
+                                allocator);
+  response->AddMember<uint64_t>("pictureEntryCount", stats.picture_entry_count,
+                                allocator);
+  response->AddMember<uint64_t>("layerBytes", stats.layer_bytes, allocator);
+  response->AddMember<uint64_t>("pictureBytes", stats.picture_bytes, allocator);
+  response->AddMember<uint64_t>("frameHitCount", stats.frame_hit_count,
+                                allocator);
+  response->AddMember<uint64_t>("frameMissCount", stats.frame_miss_count,
+                                allocator);
+  response->AddMember<uint64_t>("frameEvictionCount",
+                                stats.frame_eviction_count, allocator);
+  response->AddMember<uint64_t>("frameEvictionBytes",
+                                stats.frame_eviction_bytes, allocator);
+  response->AddMember<int64_t>(
+      "frameConstructionTimeSavedMicros",
+      stats.frame_construction_time_saved.ToMicroseconds(), allocator);
+  response->AddMember<uint64_t>("cacheByteBudget", stats.cache_byte_budget,
+                                allocator);
+  return true;
+}
+
 // Service protocol handler
 bool Shell::OnServiceProtocolSetAssetBundlePath(
     const ServiceProtocol::Handler::ServiceProtocolMap& params,
@@ -1900,6 +2209,9 @@ bool Shell::OnServiceProtocolRenderFrameWithRasterStats(
 
     LayerSnapshotStore& store =
         rasterizer_->compositor_context()->snapshot_store();
+    // Compress the captured snapshots on the worker pool so the encode cost
+    // does not land on the raster thread alongside the frame being measured.
+    store.EncodeSnapshots(worker_task_runner_.get());
     for (const LayerSnapshotData& data : store) {
       snapshots.PushBack(
           SerializeLayerSnapshot(device_pixel_ratio_, data, response),
@@ -188,6 +188,13 @@ class Shell final : public PlatformView::Delegate,
   ///             second Shell is mostly independent from the original Shell
   ///             and the original Shell doesn't need to keep running for the
   ///             spawned Shell to keep functioning.
+  ///
+  ///             In addition to the DartVM, IO manager, persistent shader
+  ///             cache (which is process global) and typographer caches
+  ///             (which travel with the shared FontCollection), the spawned
+  ///             Shell's raster cache is seeded with the parent's CPU backed
+  ///             entries so its first frames start closer to the parent's
+  ///             steady state.
   /// @param[in]  run_configuration  A RunConfiguration used to run the Isolate
   ///             associated with this new Shell. It doesn't have to be the same
   ///             configuration as the current Shell but it needs to be in the
@@ -285,6 +292,20 @@ class Shell final : public PlatformView::Delegate,
   ///             the rasterizer cache is purged.
   void NotifyLowMemoryWarning() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Used by embedders to forward staged memory pressure levels
+  ///             from the platform. Unlike |NotifyLowMemoryWarning|, which
+  ///             purges the caches outright, this scales the Skia resource
+  ///             cache and `RasterCache` byte budgets by stage (100%, 60%,
+  ///             30%) so warm cache entries survive moderate pressure.
+  ///             Worsening pressure applies immediately; the budgets are
+  ///             restored one stage per recovery notification. Must be called
+  ///             on the platform task runner.
+  ///
+  /// @param[in]  level  The pressure stage reported by the platform.
+  ///
+  void NotifyMemoryPressure(MemoryPressureLevel level);
+
   //----------------------------------------------------------------------------
   /// @brief      Used by embedders to check if all shell subcomponents are
   ///             initialized. It is the embedder's responsibility to make this
@@ -382,6 +403,21 @@ class Shell final : public PlatformView::Delegate,
   ///
   double GetMainDisplayRefreshRate();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Requests that the main display run at the given refresh rate
+  ///             in frames per second. A rate of zero relinquishes any
+  ///             previous request.
+  ///
+  ///             The request is recorded on the `DisplayManager` and forwarded
+  ///             to the platform listener registered there. Whether or not the
+  ///             platform grants a lower physical rate, the animator's
+  ///             `VsyncWaiter` is paced to the requested rate so that frames
+  ///             are not produced faster than the caller asked for.
+  ///
+  ///             Must be called on the platform task runner.
+  ///
+  void RequestDisplayRefreshRate(double refresh_rate);
+
   //----------------------------------------------------------------------------
   /// @brief      Install a new factory that can match against and decode image
   ///             data.
@@ -421,6 +457,9 @@ class Shell final : public PlatformView::Delegate,
   std::unique_ptr<Engine> engine_;               // on UI task runner
   std::unique_ptr<Rasterizer> rasterizer_;       // on raster task runner
   std::shared_ptr<ShellIOManager> io_manager_;   // on IO task runner
+  // This shell's fairness client on the process-wide concurrent worker
+  // pool, shared by the parallel raster workers and snapshot encoding.
+  std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner_;
   std::shared_ptr<fml::SyncSwitch> is_gpu_disabled_sync_switch_;
   std::shared_ptr<VolatilePathTracker> volatile_path_tracker_;
   std::shared_ptr<PlatformMessageHandler> platform_message_handler_;
@@ -443,6 +482,7 @@ class Shell final : public PlatformView::Delegate,
   uint64_t next_pointer_flow_id_ = 0;
 
   bool first_frame_rasterized_ = false;
+  bool snapshot_pages_released_ = false;
   std::atomic<bool> waiting_for_first_frame_ = true;
   std::mutex waiting_for_first_frame_mutex_;
   std::condition_variable waiting_for_first_frame_condition_;
@@ -691,6 +731,32 @@ class Shell final : public PlatformView::Delegate,
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
       rapidjson::Document* response);
 
+  // Service protocol handler
+  //
+  // Reports the fml::MessageLoopTaskQueues metrics counters for the shell's
+  // task queues and optionally toggles collection via the "enable" param.
+  bool OnServiceProtocolGetTaskQueueMetrics(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Reports rolling frame-time statistics (average, max, p50/p90/p99) for
+  // the UI and raster stopwatches over their 120-frame sample windows.
+  bool OnServiceProtocolGetFrameTimeStats(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Adjusts Skia event tracing at runtime: the "category" and "enabled"
+  // params toggle forwarding of a single Skia trace category and the
+  // "samplingInterval" param records only one in N events per category.
+  // Responds with every registered category, its state and its event count.
+  bool OnServiceProtocolSetSkiaTracing(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
   // Service protocol handler
   //
   // The returned SkSLs are base64 encoded. Decode before storing them to files.
@@ -703,6 +769,15 @@ class Shell final : public PlatformView::Delegate,
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
       rapidjson::Document* response);
 
+  // Service protocol handler
+  //
+  // Reports a snapshot of the raster cache: entry counts and bytes by kind,
+  // the last frame's hit/miss and eviction traffic, and an estimate of the
+  // rasterization time the cache saved that frame.
+  bool OnServiceProtocolGetRasterCacheStats(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
   // Service protocol handler
   //
   // Renders a frame and responds with various statistics pertaining to the
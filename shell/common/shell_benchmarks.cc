@@ -5,6 +5,7 @@
 #include "flutter/shell/common/shell.h"
 
 #include "flutter/benchmarking/benchmarking.h"
+#include "flutter/benchmarking/perf_counters.h"
 #include "flutter/fml/logging.h"
 #include "flutter/runtime/dart_vm.h"
 #include "flutter/shell/common/thread_host.h"
@@ -97,6 +98,7 @@ static void StartupAndShutdownShell(benchmark::State& state,
 }
 
 static void BM_ShellInitialization(benchmark::State& state) {
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     StartupAndShutdownShell(state, true, false);
   }
@@ -105,6 +107,7 @@ static void BM_ShellInitialization(benchmark::State& state) {
 BENCHMARK(BM_ShellInitialization);
 
 static void BM_ShellShutdown(benchmark::State& state) {
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     StartupAndShutdownShell(state, false, true);
   }
@@ -113,6 +116,7 @@ static void BM_ShellShutdown(benchmark::State& state) {
 BENCHMARK(BM_ShellShutdown);
 
 static void BM_ShellInitializationAndShutdown(benchmark::State& state) {
+  benchmarking::ScopedPerfCounters perf(state);
   while (state.KeepRunning()) {
     StartupAndShutdownShell(state, true, true);
   }
@@ -0,0 +1,256 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Benchmarks the full frame pipeline (animator -> pipeline -> rasterizer)
+// of a headless Shell under synthetic, parameterized workloads, so pipeline
+// changes can be A/B measured without a device. The synthetic layer trees
+// vary draw op count, layer nesting depth, raster cache candidates and
+// embedded platform view count, and per-phase times are collected from the
+// FrameTiming reports the engine already produces.
+
+#include "flutter/shell/common/shell.h"
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/benchmarking/perf_counters.h"
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/flow/layers/display_list_layer.h"
+#include "flutter/flow/layers/platform_view_layer.h"
+#include "flutter/flow/layers/transform_layer.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/runtime/dart_vm.h"
+#include "flutter/shell/common/shell_test.h"
+#include "flutter/shell/common/thread_host.h"
+#include "flutter/shell/common/vsync_waiter_fallback.h"
+#include "flutter/testing/elf_loader.h"
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+namespace {
+
+constexpr double kFrameWidth = 1000.0;
+constexpr double kFrameHeight = 1000.0;
+
+// Describes one synthetic frame workload.
+struct FrameWorkload {
+  // Number of draw ops in the display list at the bottom of the tree.
+  int op_count = 128;
+  // Nesting depth of transform layers between the root and the leaves.
+  int layer_depth = 1;
+  // Number of additional display list layers marked complex, i.e. raster
+  // cache candidates.
+  int cache_candidates = 0;
+  // Number of embedded platform view layers.
+  int platform_views = 0;
+};
+
+sk_sp<DisplayList> MakeDisplayList(int op_count) {
+  DisplayListBuilder builder;
+  for (int i = 0; i < op_count; i++) {
+    builder.setColor(DlColor(0xFF000000 | (i * 0x000F0F0F)));
+    builder.drawRect(SkRect::MakeXYWH((i * 13) % 800, (i * 23) % 800,  //
+                                      80, 60));
+  }
+  return builder.Build();
+}
+
+void BuildWorkloadTree(const std::shared_ptr<ContainerLayer>& root,
+                       const FrameWorkload& workload) {
+  std::shared_ptr<ContainerLayer> parent = root;
+  for (int i = 0; i < workload.layer_depth; i++) {
+    auto transform = std::make_shared<TransformLayer>(
+        SkMatrix::Translate(0.1f * (i % 2), 0.1f * ((i + 1) % 2)));
+    parent->Add(transform);
+    parent = transform;
+  }
+  parent->Add(std::make_shared<DisplayListLayer>(
+      SkPoint::Make(0, 0),
+      SkiaGPUObject<DisplayList>(MakeDisplayList(workload.op_count), nullptr),
+      /*is_complex=*/false, /*will_change=*/true));
+  for (int i = 0; i < workload.cache_candidates; i++) {
+    parent->Add(std::make_shared<DisplayListLayer>(
+        SkPoint::Make(i % 10, i / 10),
+        SkiaGPUObject<DisplayList>(MakeDisplayList(16), nullptr),
+        /*is_complex=*/true, /*will_change=*/false));
+  }
+  for (int i = 0; i < workload.platform_views; i++) {
+    parent->Add(std::make_shared<PlatformViewLayer>(
+        SkPoint::Make(i * 10, 0), SkSize::Make(100, 100), /*view_id=*/i + 1));
+  }
+}
+
+// Owns a headless Shell with a test backend surface and drives synthetic
+// frames through it. Per-phase times are accumulated from the FrameTiming
+// reports delivered via Settings::frame_rasterized_callback.
+class FrameWorkloadHost {
+ public:
+  FrameWorkloadHost() {
+    assets_dir_ = fml::OpenDirectory(testing::GetFixturesPath(), false,
+                                     fml::FilePermission::kRead);
+    Settings settings = {};
+    settings.task_observer_add = [](intptr_t, const fml::closure&) {};
+    settings.task_observer_remove = [](intptr_t) {};
+    settings.frame_rasterized_callback = [this](const FrameTiming& timing) {
+      OnFrameRasterized(timing);
+    };
+
+    if (DartVM::IsRunningPrecompiledCode()) {
+      aot_symbols_ = testing::LoadELFSymbolFromFixturesIfNeccessary(
+          testing::kDefaultAOTAppELFFileName);
+      FML_CHECK(
+          testing::PrepareSettingsForAOTWithSymbols(settings, aot_symbols_))
+          << "Could not set up settings with AOT symbols.";
+    } else {
+      settings.application_kernels = [this]() {
+        std::vector<std::unique_ptr<const fml::Mapping>> kernel_mappings;
+        kernel_mappings.emplace_back(
+            fml::FileMapping::CreateReadOnly(assets_dir_, "kernel_blob.bin"));
+        return kernel_mappings;
+      };
+    }
+
+    thread_host_ = std::make_unique<ThreadHost>(ThreadHost::ThreadHostConfig(
+        "io.flutter.bench.", ThreadHost::Type::Platform |
+                                 ThreadHost::Type::RASTER |
+                                 ThreadHost::Type::IO | ThreadHost::Type::UI));
+
+    TaskRunners task_runners("test",
+                             thread_host_->platform_thread->GetTaskRunner(),
+                             thread_host_->raster_thread->GetTaskRunner(),
+                             thread_host_->ui_thread->GetTaskRunner(),
+                             thread_host_->io_thread->GetTaskRunner());
+
+    auto vsync_clock = std::make_shared<ShellTestVsyncClock>();
+    CreateVsyncWaiter create_vsync_waiter = [task_runners]() {
+      return static_cast<std::unique_ptr<VsyncWaiter>>(
+          std::make_unique<VsyncWaiterFallback>(task_runners, true));
+    };
+
+    shell_ = Shell::Create(
+        flutter::PlatformData(), task_runners, settings,
+        [vsync_clock, &create_vsync_waiter](Shell& shell) {
+          return ShellTestPlatformView::Create(
+              shell, shell.GetTaskRunners(), vsync_clock, create_vsync_waiter,
+              ShellTestPlatformView::BackendType::kDefaultBackend, nullptr);
+        },
+        [](Shell& shell) { return std::make_unique<Rasterizer>(shell); });
+    FML_CHECK(shell_);
+
+    // Create the surface so frames actually rasterize.
+    ShellTest::PlatformViewNotifyCreated(shell_.get());
+  }
+
+  ~FrameWorkloadHost() {
+    ShellTest::PlatformViewNotifyDestroyed(shell_.get());
+
+    // Shutdown must occur synchronously on the platform thread.
+    fml::AutoResetWaitableEvent latch;
+    fml::TaskRunner::RunNowOrPostTask(
+        thread_host_->platform_thread->GetTaskRunner(), [this, &latch]() {
+          shell_.reset();
+          latch.Signal();
+        });
+    latch.Wait();
+    thread_host_.reset();
+  }
+
+  // Pumps one frame with the given workload through the pipeline and blocks
+  // until it has been rasterized.
+  void PumpFrame(const FrameWorkload& workload) {
+    ShellTest::PumpOneFrame(
+        shell_.get(), kFrameWidth, kFrameHeight,
+        [&workload](const std::shared_ptr<ContainerLayer>& root) {
+          BuildWorkloadTree(root, workload);
+        });
+    frame_rasterized_latch_.Wait();
+  }
+
+  // Publishes the accumulated per-phase averages as user counters.
+  void Report(benchmark::State& state) const {
+    if (frame_count_ == 0) {
+      return;
+    }
+    state.counters["BuildTimeUs"] =
+        benchmark::Counter(build_time_us_ / frame_count_);
+    state.counters["RasterTimeUs"] =
+        benchmark::Counter(raster_time_us_ / frame_count_);
+    state.counters["FrameTimeUs"] =
+        benchmark::Counter(frame_time_us_ / frame_count_);
+  }
+
+ private:
+  void OnFrameRasterized(const FrameTiming& timing) {
+    // Runs on the raster thread; PumpFrame is blocked on the latch, so the
+    // accumulators are not read concurrently.
+    build_time_us_ += (timing.Get(FrameTiming::kBuildFinish) -
+                       timing.Get(FrameTiming::kBuildStart))
+                          .ToMicrosecondsF();
+    raster_time_us_ += (timing.Get(FrameTiming::kRasterFinish) -
+                        timing.Get(FrameTiming::kRasterStart))
+                           .ToMicrosecondsF();
+    frame_time_us_ += (timing.Get(FrameTiming::kRasterFinish) -
+                       timing.Get(FrameTiming::kVsyncStart))
+                          .ToMicrosecondsF();
+    frame_count_++;
+    frame_rasterized_latch_.Signal();
+  }
+
+  fml::UniqueFD assets_dir_;
+  testing::ELFAOTSymbols aot_symbols_;
+  std::unique_ptr<ThreadHost> thread_host_;
+  std::unique_ptr<Shell> shell_;
+  fml::AutoResetWaitableEvent frame_rasterized_latch_;
+  double build_time_us_ = 0;
+  double raster_time_us_ = 0;
+  double frame_time_us_ = 0;
+  int64_t frame_count_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FrameWorkloadHost);
+};
+
+void RunFrameWorkload(benchmark::State& state, const FrameWorkload& workload) {
+  FrameWorkloadHost host;
+  benchmarking::ScopedPerfCounters perf(state);
+  while (state.KeepRunning()) {
+    host.PumpFrame(workload);
+  }
+  perf.StopAndReport();
+  host.Report(state);
+}
+
+void BM_FramePipelineOpCount(benchmark::State& state) {
+  FrameWorkload workload;
+  workload.op_count = state.range(0);
+  RunFrameWorkload(state, workload);
+}
+
+BENCHMARK(BM_FramePipelineOpCount)->Arg(16)->Arg(256)->Arg(4096);
+
+void BM_FramePipelineLayerDepth(benchmark::State& state) {
+  FrameWorkload workload;
+  workload.layer_depth = state.range(0);
+  RunFrameWorkload(state, workload);
+}
+
+BENCHMARK(BM_FramePipelineLayerDepth)->Arg(1)->Arg(16)->Arg(64);
+
+void BM_FramePipelineCacheCandidates(benchmark::State& state) {
+  FrameWorkload workload;
+  workload.cache_candidates = state.range(0);
+  RunFrameWorkload(state, workload);
+}
+
+BENCHMARK(BM_FramePipelineCacheCandidates)->Arg(0)->Arg(8)->Arg(32);
+
+void BM_FramePipelinePlatformViews(benchmark::State& state) {
+  FrameWorkload workload;
+  workload.platform_views = state.range(0);
+  RunFrameWorkload(state, workload);
+}
+
+BENCHMARK(BM_FramePipelinePlatformViews)->Arg(0)->Arg(2)->Arg(8);
+
+}  // namespace
+}  // namespace testing
+}  // namespace flutter
@@ -265,6 +265,9 @@ void ShellTest::OnServiceProtocol(
       case ServiceProtocolEnum::kEstimateRasterCacheMemory:
         shell->OnServiceProtocolEstimateRasterCacheMemory(params, response);
         break;
+      case ServiceProtocolEnum::kGetRasterCacheStats:
+        shell->OnServiceProtocolGetRasterCacheStats(params, response);
+        break;
       case ServiceProtocolEnum::kSetAssetBundlePath:
         shell->OnServiceProtocolSetAssetBundlePath(params, response);
         break;
@@ -274,6 +277,9 @@ void ShellTest::OnServiceProtocol(
       case ServiceProtocolEnum::kRenderFrameWithRasterStats:
         shell->OnServiceProtocolRenderFrameWithRasterStats(params, response);
         break;
+      case ServiceProtocolEnum::kSetSkiaTracing:
+        shell->OnServiceProtocolSetSkiaTracing(params, response);
+        break;
     }
     finished.set_value(true);
   });
@@ -389,11 +395,15 @@ void ShellTest::DestroyShell(std::unique_ptr<Shell> shell,
 
 size_t ShellTest::GetLiveTrackedPathCount(
     const std::shared_ptr<VolatilePathTracker>& tracker) {
-  return std::count_if(
-      tracker->paths_.begin(), tracker->paths_.end(),
-      [](const std::weak_ptr<VolatilePathTracker::TrackedPath>& path) {
-        return path.lock();
-      });
+  size_t count = 0;
+  for (const auto& bucket : tracker->buckets_) {
+    count += std::count_if(
+        bucket.begin(), bucket.end(),
+        [](const std::weak_ptr<VolatilePathTracker::TrackedPath>& path) {
+          return path.lock();
+        });
+  }
+  return count;
 }
 
 }  // namespace testing
@@ -105,9 +105,11 @@ class ShellTest : public FixtureTest {
   enum ServiceProtocolEnum {
     kGetSkSLs,
     kEstimateRasterCacheMemory,
+    kGetRasterCacheStats,
     kSetAssetBundlePath,
     kRunInView,
     kRenderFrameWithRasterStats,
+    kSetSkiaTracing,
   };
 
   // Helper method to test private method Shell::OnServiceProtocolGetSkSLs.
@@ -30,6 +30,7 @@
 #include "flutter/shell/common/shell_test.h"
 #include "flutter/shell/common/shell_test_external_view_embedder.h"
 #include "flutter/shell/common/shell_test_platform_view.h"
+#include "flutter/shell/common/skia_event_tracer_impl.h"
 #include "flutter/shell/common/switches.h"
 #include "flutter/shell/common/thread_host.h"
 #include "flutter/shell/common/vsync_waiter_fallback.h"
@@ -844,8 +845,8 @@ TEST_F(ShellTest, PushBackdropFilterToVisitedPlatformViews) {
 
   auto filter = DlBlurImageFilter(5, 5, DlTileMode::kClamp);
   auto mutator = *external_view_embedder->GetStack(50).Begin();
-  ASSERT_EQ(mutator->GetType(), MutatorType::kBackdropFilter);
-  ASSERT_EQ(mutator->GetFilter(), filter);
+  ASSERT_EQ(mutator.GetType(), MutatorType::kBackdropFilter);
+  ASSERT_EQ(mutator.GetFilter(), filter);
 
   DestroyShell(std::move(shell));
 }
@@ -1860,7 +1861,7 @@ class MockTexture : public Texture {
 
   void OnGrContextDestroyed() override {}
 
-  void MarkNewFrameAvailable() override {
+  void OnNewFrameAvailable() override {
     frames_available_++;
     latch_->Signal();
   }
@@ -2522,6 +2523,56 @@ TEST_F(ShellTest, OnServiceProtocolEstimateRasterCacheMemoryWorks) {
   DestroyShell(std::move(shell));
 }
 
+TEST_F(ShellTest, OnServiceProtocolGetRasterCacheStatsWorks) {
+  Settings settings = CreateSettingsForFixture();
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+
+  ServiceProtocol::Handler::ServiceProtocolMap empty_params;
+  rapidjson::Document document;
+  OnServiceProtocol(shell.get(), ServiceProtocolEnum::kGetRasterCacheStats,
+                    shell->GetTaskRunners().GetRasterTaskRunner(), empty_params,
+                    &document);
+
+  ASSERT_TRUE(document.IsObject());
+  ASSERT_STREQ(document["type"].GetString(), "RasterCacheStats");
+  // Nothing has been rasterized, so every statistic reports an empty cache.
+  ASSERT_EQ(document["layerEntryCount"].GetUint64(), 0u);
+  ASSERT_EQ(document["pictureEntryCount"].GetUint64(), 0u);
+  ASSERT_EQ(document["layerBytes"].GetUint64(), 0u);
+  ASSERT_EQ(document["pictureBytes"].GetUint64(), 0u);
+  ASSERT_EQ(document["frameHitCount"].GetUint64(), 0u);
+  ASSERT_EQ(document["frameMissCount"].GetUint64(), 0u);
+  ASSERT_EQ(document["frameEvictionCount"].GetUint64(), 0u);
+  ASSERT_EQ(document["frameEvictionBytes"].GetUint64(), 0u);
+  ASSERT_EQ(document["frameConstructionTimeSavedMicros"].GetInt64(), 0);
+  ASSERT_EQ(document["cacheByteBudget"].GetUint64(), 0u);
+
+  DestroyShell(std::move(shell));
+}
+
+TEST_F(ShellTest, OnServiceProtocolSetSkiaTracingWorks) {
+  auto settings = CreateSettingsForFixture();
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+
+  ServiceProtocol::Handler::ServiceProtocolMap params;
+  params["samplingInterval"] = "4";
+  rapidjson::Document document;
+  OnServiceProtocol(shell.get(), ServiceProtocolEnum::kSetSkiaTracing,
+                    shell->GetTaskRunners().GetPlatformTaskRunner(), params,
+                    &document);
+
+  ASSERT_TRUE(document.HasMember("type"));
+  ASSERT_STREQ(document["type"].GetString(), "SetSkiaTracing");
+  ASSERT_TRUE(document.HasMember("samplingInterval"));
+  ASSERT_EQ(document["samplingInterval"].GetUint(), 4u);
+  ASSERT_TRUE(document.HasMember("categories"));
+  ASSERT_TRUE(document["categories"].IsArray());
+
+  // Restore unsampled tracing for the rest of the suite.
+  SetSkiaTracingSamplingInterval(1);
+  DestroyShell(std::move(shell));
+}
+
 // ktz
 TEST_F(ShellTest, OnServiceProtocolRenderFrameWithRasterStatsWorks) {
   auto settings = CreateSettingsForFixture();
@@ -2916,6 +2967,43 @@ TEST_F(ShellTest, AssetManagerMulti) {
   }
 }
 
+TEST_F(ShellTest, AssetManagerPrefetchAll) {
+  fml::ScopedTemporaryDirectory asset_dir;
+  fml::UniqueFD asset_dir_fd = fml::OpenDirectory(
+      asset_dir.path().c_str(), false, fml::FilePermission::kRead);
+
+  std::string filename = "prefetched";
+  std::string content = "prefetched_content";
+
+  bool success = fml::WriteAtomically(asset_dir_fd, filename.c_str(),
+                                      fml::DataMapping(content));
+  ASSERT_TRUE(success);
+
+  auto asset_manager = std::make_shared<AssetManager>();
+  asset_manager->PushBack(
+      std::make_unique<DirectoryAssetBundle>(std::move(asset_dir_fd), false));
+
+  auto loop = fml::ConcurrentMessageLoop::Create(1);
+  asset_manager->PrefetchAll({filename, "missing"},
+                             loop->GetTaskRunner().get());
+
+  // The loop has a single worker, so a task posted after the prefetch runs
+  // once the prefetch is done.
+  fml::AutoResetWaitableEvent latch;
+  loop->GetTaskRunner()->PostTask([&latch]() { latch.Signal(); });
+  latch.Wait();
+
+  auto mapping = asset_manager->GetAsMapping(filename);
+  ASSERT_TRUE(mapping != nullptr);
+
+  std::string result(reinterpret_cast<const char*>(mapping->GetMapping()),
+                     mapping->GetSize());
+  ASSERT_TRUE(result == content);
+
+  // The directory index rejects missing assets without opening anything.
+  ASSERT_TRUE(asset_manager->GetAsMapping("missing") == nullptr);
+}
+
 #if defined(OS_FUCHSIA)
 TEST_F(ShellTest, AssetManagerMultiSubdir) {
   std::string subdir_path = "subdir";
@@ -5,8 +5,11 @@
 #include "flutter/shell/common/skia_event_tracer_impl.h"
 
 #define TRACE_EVENT_HIDE_MACROS
+#include <atomic>
+#include <cstddef>
 #include <map>
 #include <set>
+#include <type_traits>
 #include <vector>
 
 #include "flutter/fml/logging.h"
@@ -99,6 +102,47 @@ class FlutterEventTracer : public SkEventTracer {
                                       const uint8_t* p_arg_types,
                                       const uint64_t* p_arg_values,
                                       uint8_t flags) override {
+    // Sampling: forward only one in |sampling_interval_| duration and instant
+    // events per category while keeping full per-category event counts. The
+    // skip decision for a begin is remembered in a thread local depth so the
+    // matching end (which arrives in LIFO order on the same thread) is
+    // dropped alongside it and sections stay balanced. Async events are
+    // matched by id across threads and are never sampled.
+    const uint32_t interval =
+        sampling_interval_.load(std::memory_order_relaxed);
+    if (interval > 1 && category_enabled_flag != nullptr) {
+      auto* state = reinterpret_cast<CategoryState*>(
+          const_cast<uint8_t*>(category_enabled_flag));
+      switch (phase) {
+        case TRACE_EVENT_PHASE_BEGIN:
+        case TRACE_EVENT_PHASE_COMPLETE:
+        case TRACE_EVENT_PHASE_INSTANT: {
+          const uint64_t count =
+              state->event_count.fetch_add(1, std::memory_order_relaxed) + 1;
+          if (count % interval != 0) {
+            if (phase != TRACE_EVENT_PHASE_INSTANT) {
+              skip_depth_++;
+            }
+            return 0;
+          }
+          break;
+        }
+        case TRACE_EVENT_PHASE_END:
+          if (skip_depth_ > 0) {
+            skip_depth_--;
+            return 0;
+          }
+          break;
+        default:
+          break;
+      }
+    } else if (category_enabled_flag != nullptr) {
+      auto* state = reinterpret_cast<CategoryState*>(
+          const_cast<uint8_t*>(category_enabled_flag));
+      if (phase != TRACE_EVENT_PHASE_END) {
+        state->event_count.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
 #if defined(OS_FUCHSIA)
     static trace_site_t trace_site;
     trace_string_ref_t category_ref;
@@ -263,6 +307,11 @@ class FlutterEventTracer : public SkEventTracer {
   void updateTraceEventDuration(const uint8_t* category_enabled_flag,
                                 const char* name,
                                 SkEventTracer::Handle handle) override {
+    // Scoped events whose begin was sampled out must drop their end as well.
+    if (skip_depth_ > 0) {
+      skip_depth_--;
+      return;
+    }
     // This is only ever called from a scoped trace event so we will just end
     // the section.
 #if defined(OS_FUCHSIA)
@@ -284,14 +333,52 @@ class FlutterEventTracer : public SkEventTracer {
       } else {
         allowed = false;
       }
-      flag_it = category_flag_map_.insert(std::make_pair(name, allowed)).first;
-      const uint8_t* flag = &flag_it->second;
+      flag_it = category_flag_map_.try_emplace(name).first;
+      flag_it->second.flag = allowed ? kYes : kNo;
+      const uint8_t* flag = &flag_it->second.flag;
       reverse_flag_map_.insert(std::make_pair(flag, name));
       if (kShaderCategoryName == name) {
         shaders_category_flag_ = flag;
       }
     }
-    return &flag_it->second;
+    return &flag_it->second.flag;
+  }
+
+  // Flip the forwarding flag of an already registered category. |category| is
+  // named without Skia's category prefix.
+  bool SetCategoryEnabled(const std::string& category, bool enabled) {
+    const std::string full_name =
+        std::string(kTraceCategoryPrefix) + category;
+    std::lock_guard<std::mutex> lock(flag_map_mutex_);
+    for (auto& entry : category_flag_map_) {
+      // Keys are string literal addresses, so compare contents here.
+      if (full_name == entry.first || category == entry.first) {
+        entry.second.flag = enabled ? kYes : kNo;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void SetSamplingInterval(uint32_t interval) {
+    sampling_interval_.store(interval == 0 ? 1 : interval,
+                             std::memory_order_relaxed);
+  }
+
+  std::vector<SkiaTracingCategory> GetCategories() {
+    std::vector<SkiaTracingCategory> result;
+    std::lock_guard<std::mutex> lock(flag_map_mutex_);
+    for (const auto& entry : category_flag_map_) {
+      std::string name = entry.first;
+      if (name.compare(0, kTraceCategoryPrefix.size(), kTraceCategoryPrefix) ==
+          0) {
+        name = name.substr(kTraceCategoryPrefix.size());
+      }
+      result.push_back(
+          {std::move(name), entry.second.flag == kYes,
+           entry.second.event_count.load(std::memory_order_relaxed)});
+    }
+    return result;
   }
 
   const char* getCategoryGroupName(
@@ -306,22 +393,71 @@ class FlutterEventTracer : public SkEventTracer {
   }
 
  private:
+  // Per-category state. The flag byte must stay the first member: Skia hands
+  // its address back as the category_enabled_flag, and the hot path recovers
+  // the surrounding state from it without a map lookup.
+  struct CategoryState {
+    uint8_t flag = kNo;
+    std::atomic<uint64_t> event_count{0};
+  };
+  static_assert(std::is_standard_layout<CategoryState>::value,
+                "CategoryState must be standard layout so the enabled flag "
+                "address can be converted back to the state address.");
+  static_assert(offsetof(CategoryState, flag) == 0,
+                "The enabled flag must be the first CategoryState member.");
+
+  // Number of skipped begins on this thread whose matching ends must also be
+  // skipped.
+  static thread_local uint64_t skip_depth_;
+
   uint8_t enabled_;
   std::optional<std::set<std::string>> allowlist_;
+  std::atomic<uint32_t> sampling_interval_{1};
   std::mutex flag_map_mutex_;
-  std::map<const char*, uint8_t> category_flag_map_;
+  std::map<const char*, CategoryState> category_flag_map_;
   std::map<const uint8_t*, const char*> reverse_flag_map_;
   const uint8_t* shaders_category_flag_ = nullptr;
   FML_DISALLOW_COPY_AND_ASSIGN(FlutterEventTracer);
 };
 
+thread_local uint64_t FlutterEventTracer::skip_depth_ = 0;
+
+namespace {
+
+// The installed tracer. Skia owns the instance, but it lives for the rest of
+// the process so the runtime controls below may keep a reference to it.
+FlutterEventTracer* g_flutter_event_tracer = nullptr;
+
+}  // namespace
+
 void InitSkiaEventTracer(
     bool enabled,
     const std::optional<std::vector<std::string>>& allowlist) {
   auto tracer = new FlutterEventTracer(enabled, allowlist);
+  g_flutter_event_tracer = tracer;
   // Initialize the binding to Skia's tracing events. Skia will
   // take ownership of and clean up the memory allocated here.
   SkEventTracer::SetInstance(tracer);
 }
 
+bool SetSkiaTracingCategoryEnabled(const std::string& category, bool enabled) {
+  if (g_flutter_event_tracer == nullptr) {
+    return false;
+  }
+  return g_flutter_event_tracer->SetCategoryEnabled(category, enabled);
+}
+
+void SetSkiaTracingSamplingInterval(uint32_t interval) {
+  if (g_flutter_event_tracer != nullptr) {
+    g_flutter_event_tracer->SetSamplingInterval(interval);
+  }
+}
+
+std::vector<SkiaTracingCategory> GetSkiaTracingCategories() {
+  if (g_flutter_event_tracer == nullptr) {
+    return {};
+  }
+  return g_flutter_event_tracer->GetCategories();
+}
+
 }  // namespace flutter
@@ -5,6 +5,7 @@
 #ifndef FLUTTER_SHELL_COMMON_SKIA_EVENT_TRACER_IMPL_H_
 #define FLUTTER_SHELL_COMMON_SKIA_EVENT_TRACER_IMPL_H_
 
+#include <cstdint>
 #include <mutex>
 #include <optional>
 #include <string>
@@ -16,6 +17,32 @@ void InitSkiaEventTracer(
     bool enabled,
     const std::optional<std::vector<std::string>>& allowlist);
 
+// A category known to the Skia event tracer along with its runtime state.
+// Categories are registered lazily the first time Skia traces into them.
+struct SkiaTracingCategory {
+  std::string name;
+  bool enabled;
+  // The number of events observed for this category, including the ones
+  // skipped by sampling.
+  uint64_t event_count;
+};
+
+// Enable or disable forwarding of a single Skia trace category at runtime.
+// The category is named without Skia's "disabled-by-default-" prefix. Returns
+// false when no tracer is installed or the category has not been registered
+// by Skia yet.
+bool SetSkiaTracingCategoryEnabled(const std::string& category, bool enabled);
+
+// Forward only one in |interval| Skia duration and instant events per
+// category. The per-category event counts keep counting the skipped events so
+// true totals can be reconstructed from a sampled timeline. An interval of
+// zero or one forwards every event. Async events are never sampled because
+// their begin and end halves are matched by id.
+void SetSkiaTracingSamplingInterval(uint32_t interval);
+
+// Snapshot the categories Skia has registered so far.
+std::vector<SkiaTracingCategory> GetSkiaTracingCategories();
+
 }  // namespace flutter
 
 #endif  // FLUTTER_SHELL_COMMON_SKIA_EVENT_TRACER_IMPL_H_
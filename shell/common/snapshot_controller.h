@@ -34,6 +34,19 @@ class SnapshotController {
   virtual sk_sp<DlImage> MakeRasterSnapshot(sk_sp<DisplayList> display_list,
                                             SkISize size) = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Same as |MakeRasterSnapshot| but invokes |callback| when the
+  ///             GPU has finished rendering the snapshot. The default
+  ///             implementation takes the snapshot synchronously and invokes
+  ///             the callback inline; backends with GPU completion hooks
+  ///             override this to keep the calling thread free of the GPU
+  ///             drain. The callback may be invoked on an arbitrary thread.
+  ///
+  virtual void MakeRasterSnapshotAsync(
+      sk_sp<DisplayList> display_list,
+      SkISize size,
+      const std::function<void(sk_sp<DlImage>)>& callback);
+
   virtual sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) = 0;
 
  protected:
@@ -11,35 +11,22 @@
 #include "flutter/impeller/display_list/display_list_dispatcher.h"
 #include "flutter/impeller/display_list/display_list_image_impeller.h"
 #include "flutter/impeller/geometry/size.h"
+#include "flutter/impeller/renderer/command_buffer.h"
 #include "flutter/shell/common/snapshot_controller.h"
 
 namespace flutter {
 
-sk_sp<DlImage> SnapshotControllerImpeller::MakeRasterSnapshot(
-    sk_sp<DisplayList> display_list,
-    SkISize size) {
-  sk_sp<DlImage> result;
-  GetDelegate().GetIsGpuDisabledSyncSwitch()->Execute(
-      fml::SyncSwitch::Handlers()
-          .SetIfTrue([&] {
-            // Do nothing.
-          })
-          .SetIfFalse(
-              [&] { result = DoMakeRasterSnapshot(display_list, size); }));
-
-  return result;
-}
+namespace {
 
-sk_sp<DlImage> SnapshotControllerImpeller::DoMakeRasterSnapshot(
+std::shared_ptr<impeller::Image> RenderToImage(
+    const SnapshotController::Delegate& delegate,
     const sk_sp<DisplayList>& display_list,
     SkISize size) {
   impeller::DisplayListDispatcher dispatcher;
   display_list->Dispatch(dispatcher);
   impeller::Picture picture = dispatcher.EndRecordingAsPicture();
-  if (GetDelegate().GetSurface() &&
-      GetDelegate().GetSurface()->GetAiksContext()) {
-    impeller::AiksContext* context =
-        GetDelegate().GetSurface()->GetAiksContext();
+  if (delegate.GetSurface() && delegate.GetSurface()->GetAiksContext()) {
+    impeller::AiksContext* context = delegate.GetSurface()->GetAiksContext();
 
     auto max_size = context->GetContext()
                         ->GetResourceAllocator()
@@ -61,16 +48,85 @@ sk_sp<DlImage> SnapshotControllerImpeller::DoMakeRasterSnapshot(
       render_target_size.height *= scale_factor;
     }
 
-    std::shared_ptr<impeller::Image> image =
-        picture.ToImage(*context, render_target_size);
-    if (image) {
-      return impeller::DlImageImpeller::Make(image->GetTexture());
-    }
+    return picture.ToImage(*context, render_target_size);
+  }
+
+  return nullptr;
+}
+
+}  // namespace
+
+sk_sp<DlImage> SnapshotControllerImpeller::MakeRasterSnapshot(
+    sk_sp<DisplayList> display_list,
+    SkISize size) {
+  sk_sp<DlImage> result;
+  GetDelegate().GetIsGpuDisabledSyncSwitch()->Execute(
+      fml::SyncSwitch::Handlers()
+          .SetIfTrue([&] {
+            // Do nothing.
+          })
+          .SetIfFalse(
+              [&] { result = DoMakeRasterSnapshot(display_list, size); }));
+
+  return result;
+}
+
+void SnapshotControllerImpeller::MakeRasterSnapshotAsync(
+    sk_sp<DisplayList> display_list,
+    SkISize size,
+    const std::function<void(sk_sp<DlImage>)>& callback) {
+  GetDelegate().GetIsGpuDisabledSyncSwitch()->Execute(
+      fml::SyncSwitch::Handlers()
+          .SetIfTrue([&] { callback(nullptr); })
+          .SetIfFalse([&] {
+            DoMakeRasterSnapshotAsync(display_list, size, callback);
+          }));
+}
+
+sk_sp<DlImage> SnapshotControllerImpeller::DoMakeRasterSnapshot(
+    const sk_sp<DisplayList>& display_list,
+    SkISize size) {
+  std::shared_ptr<impeller::Image> image =
+      RenderToImage(GetDelegate(), display_list, size);
+  if (image) {
+    return impeller::DlImageImpeller::Make(image->GetTexture());
   }
 
   return nullptr;
 }
 
+void SnapshotControllerImpeller::DoMakeRasterSnapshotAsync(
+    const sk_sp<DisplayList>& display_list,
+    SkISize size,
+    const std::function<void(sk_sp<DlImage>)>& callback) {
+  std::shared_ptr<impeller::Image> image =
+      RenderToImage(GetDelegate(), display_list, size);
+  if (!image) {
+    callback(nullptr);
+    return;
+  }
+  auto dl_image = impeller::DlImageImpeller::Make(image->GetTexture());
+
+  // Submit an empty command buffer behind the snapshot's render passes. The
+  // queue executes command buffers in submission order, so its completion
+  // fences the snapshot's GPU work without stalling this thread.
+  auto context = GetDelegate().GetSurface()->GetAiksContext()->GetContext();
+  auto fence_buffer = context->CreateCommandBuffer();
+  if (fence_buffer &&
+      fence_buffer->SubmitCommands(
+          [callback, dl_image](impeller::CommandBuffer::Status status) {
+            callback(status == impeller::CommandBuffer::Status::kError
+                         ? nullptr
+                         : dl_image);
+          })) {
+    return;
+  }
+
+  // A fence could not be scheduled. Complete inline like the synchronous
+  // path would.
+  callback(dl_image);
+}
+
 sk_sp<SkImage> SnapshotControllerImpeller::ConvertToRasterImage(
     sk_sp<SkImage> image) {
   FML_UNREACHABLE();
@@ -18,12 +18,23 @@ class SnapshotControllerImpeller : public SnapshotController {
   sk_sp<DlImage> MakeRasterSnapshot(sk_sp<DisplayList> display_list,
                                     SkISize size) override;
 
+  // |SnapshotController|
+  void MakeRasterSnapshotAsync(
+      sk_sp<DisplayList> display_list,
+      SkISize size,
+      const std::function<void(sk_sp<DlImage>)>& callback) override;
+
   sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) override;
 
  private:
   sk_sp<DlImage> DoMakeRasterSnapshot(const sk_sp<DisplayList>& display_list,
                                       SkISize size);
 
+  void DoMakeRasterSnapshotAsync(
+      const sk_sp<DisplayList>& display_list,
+      SkISize size,
+      const std::function<void(sk_sp<DlImage>)>& callback);
+
   FML_DISALLOW_COPY_AND_ASSIGN(SnapshotControllerImpeller);
 };
 
@@ -243,6 +243,10 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
   settings.enable_observatory_publication = !command_line.HasOption(
       FlagForSwitch(Switch::DisableObservatoryPublication));
 
+  // Defer Observatory server startup
+  settings.defer_observatory_server_start =
+      command_line.HasOption(FlagForSwitch(Switch::DeferObservatoryStart));
+
   // Set Observatory Host
   if (command_line.HasOption(FlagForSwitch(Switch::DeviceObservatoryHost))) {
     command_line.GetOptionValue(FlagForSwitch(Switch::DeviceObservatoryHost),
@@ -474,6 +478,22 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
         std::stoi(resource_cache_max_bytes_threshold);
   }
 
+  if (command_line.HasOption(FlagForSwitch(Switch::RasterCacheMaxBytes))) {
+    std::string raster_cache_max_bytes;
+    command_line.GetOptionValue(FlagForSwitch(Switch::RasterCacheMaxBytes),
+                                &raster_cache_max_bytes);
+    settings.raster_cache_max_bytes = std::stoi(raster_cache_max_bytes);
+  }
+
+  settings.enable_background_raster_cache_population = command_line.HasOption(
+      FlagForSwitch(Switch::EnableBackgroundRasterCachePopulation));
+
+  settings.enable_parallel_layer_tree_diff = command_line.HasOption(
+      FlagForSwitch(Switch::EnableParallelLayerDiff));
+
+  settings.enable_parallel_layer_tree_preroll = command_line.HasOption(
+      FlagForSwitch(Switch::EnableParallelLayerPreroll));
+
   if (command_line.HasOption(FlagForSwitch(Switch::MsaaSamples))) {
     std::string msaa_samples;
     command_line.GetOptionValue(FlagForSwitch(Switch::MsaaSamples),
@@ -70,6 +70,12 @@ DEF_SWITCH(DartFlags,
            "dart-flags",
            "Flags passed directly to the Dart VM without being interpreted "
            "by the Flutter shell.")
+DEF_SWITCH(DeferObservatoryStart,
+           "defer-observatory-start",
+           "Defer the Dart Observatory HTTP server startup until a client "
+           "requests it via Service.controlWebServer from dart:developer. "
+           "The service isolate is still created. Ignored if the observatory "
+           "is disabled.")
 DEF_SWITCH(DeviceObservatoryHost,
            "observatory-host",
            "The hostname/IP address on which the Dart Observatory should "
@@ -229,6 +235,26 @@ DEF_SWITCH(OldGenHeapSize,
 DEF_SWITCH(ResourceCacheMaxBytesThreshold,
            "resource-cache-max-bytes-threshold",
            "The max bytes threshold of resource cache, or 0 for unlimited.")
+DEF_SWITCH(RasterCacheMaxBytes,
+           "raster-cache-max-bytes",
+           "The max bytes of rasterized images retained by the raster cache "
+           "across frames, or 0 for unlimited. When exceeded, the least "
+           "recently drawn cache images are evicted.")
+DEF_SWITCH(EnableBackgroundRasterCachePopulation,
+           "enable-background-raster-cache-population",
+           "Rasterize display list raster cache entries on the concurrent "
+           "worker pool instead of inline on the raster thread. Items draw "
+           "directly until their cache image is ready.")
+DEF_SWITCH(EnableParallelLayerDiff,
+           "enable-parallel-layer-diff",
+           "Fan independent layer subtree diffs out to the concurrent worker "
+           "pool when computing partial repaint damage. Only effective when "
+           "partial repaint is supported.")
+DEF_SWITCH(EnableParallelLayerPreroll,
+           "enable-parallel-layer-preroll",
+           "Preroll independent layer subtrees on the concurrent worker pool "
+           "before painting. Preroll stays on the raster thread for frames "
+           "that composite platform views.")
 DEF_SWITCH(EnableSkParagraph,
            "enable-skparagraph",
            "Selects the SkParagraph implementation of the text layout engine.")
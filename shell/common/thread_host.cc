@@ -29,6 +29,39 @@ std::string ThreadHost::ThreadHostConfig::MakeThreadName(
   }
 }
 
+ThreadHost::ThreadHostConfig
+ThreadHost::ThreadHostConfig::MakeFrameCriticalProfile(
+    const std::string& name_prefix,
+    uint64_t mask,
+    const ThreadConfigSetter& setter) {
+  ThreadHostConfig host_config(name_prefix, mask, setter);
+  if (host_config.isThreadNeeded(ThreadHost::Type::UI)) {
+    host_config.ui_config = fml::Thread::ThreadConfig(
+        MakeThreadName(Type::UI, name_prefix),
+        fml::Thread::ThreadPriority::DISPLAY,
+        fml::Thread::CoreAffinity::kPerformance);
+  }
+  if (host_config.isThreadNeeded(ThreadHost::Type::RASTER)) {
+    host_config.raster_config = fml::Thread::ThreadConfig(
+        MakeThreadName(Type::RASTER, name_prefix),
+        fml::Thread::ThreadPriority::RASTER,
+        fml::Thread::CoreAffinity::kPerformance);
+  }
+  if (host_config.isThreadNeeded(ThreadHost::Type::IO)) {
+    host_config.io_config = fml::Thread::ThreadConfig(
+        MakeThreadName(Type::IO, name_prefix),
+        fml::Thread::ThreadPriority::NORMAL,
+        fml::Thread::CoreAffinity::kEfficiency);
+  }
+  if (host_config.isThreadNeeded(ThreadHost::Type::Profiler)) {
+    host_config.profiler_config = fml::Thread::ThreadConfig(
+        MakeThreadName(Type::Profiler, name_prefix),
+        fml::Thread::ThreadPriority::BACKGROUND,
+        fml::Thread::CoreAffinity::kEfficiency);
+  }
+  return host_config;
+}
+
 void ThreadHost::ThreadHostConfig::SetIOConfig(const ThreadConfig& config) {
   type_mask |= ThreadHost::Type::IO;
   io_config = config;
@@ -51,6 +51,17 @@ struct ThreadHost {
     /// Use the prefix and thread type to generator a thread name.
     static std::string MakeThreadName(Type type, const std::string& prefix);
 
+    /// Create a configuration whose frame-critical threads (UI and raster)
+    /// request elevated priorities and performance-core affinity, while the
+    /// IO and profiler threads prefer efficiency cores. Embedders supply
+    /// platform-specific behavior through the setter, which receives each
+    /// thread's priority and affinity class (see
+    /// |fml::Thread::TrySetCurrentThreadAffinity|).
+    static ThreadHostConfig MakeFrameCriticalProfile(
+        const std::string& name_prefix,
+        uint64_t mask,
+        const ThreadConfigSetter& setter = fml::Thread::SetCurrentThreadName);
+
     /// Specified the UI Thread Config, meanwhile set the mask.
     void SetUIConfig(const ThreadConfig&);
 
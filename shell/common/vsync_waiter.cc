@@ -84,6 +84,27 @@ void VsyncWaiter::ScheduleSecondaryCallback(uintptr_t id,
   AwaitVSyncForSecondaryCallback();
 }
 
+void VsyncWaiter::SetMaxRefreshRate(double max_refresh_rate) {
+  std::scoped_lock lock(callback_mutex_);
+  max_refresh_rate_ = max_refresh_rate;
+}
+
+bool VsyncWaiter::ShouldDeferFrameCallbackLocked(
+    fml::TimePoint frame_target_time) const {
+  if (max_refresh_rate_ <= 0) {
+    return false;
+  }
+  if (last_frame_target_time_ == fml::TimePoint()) {
+    // The first frame after the cap is installed always fires.
+    return false;
+  }
+  // Firing once three quarters of the pacing interval has elapsed tolerates
+  // vsync jitter without drifting: a 60Hz cap on a 120Hz display settles on
+  // every other vsync rather than occasionally slipping to every third.
+  const auto threshold = fml::TimeDelta::FromSecondsF(0.75 / max_refresh_rate_);
+  return frame_target_time - last_frame_target_time_ < threshold;
+}
+
 void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
                                fml::TimePoint frame_target_time,
                                bool pause_secondary_tasks) {
@@ -91,17 +112,28 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
 
   Callback callback;
   std::vector<fml::closure> secondary_callbacks;
+  bool frame_callback_deferred = false;
 
   {
     std::scoped_lock lock(callback_mutex_);
-    callback = std::move(callback_);
+    if (callback_ && ShouldDeferFrameCallbackLocked(frame_target_time)) {
+      // This vsync falls between pacing slots of the refresh rate cap. Leave
+      // the frame callback armed so a later vsync delivers it.
+      TRACE_EVENT_INSTANT0("flutter", "VsyncPacedFrameCallback");
+      frame_callback_deferred = true;
+    } else {
+      callback = std::move(callback_);
+      if (callback) {
+        last_frame_target_time_ = frame_target_time;
+      }
+    }
     for (auto& pair : secondary_callbacks_) {
       secondary_callbacks.push_back(std::move(pair.second));
     }
     secondary_callbacks_.clear();
   }
 
-  if (!callback && secondary_callbacks.empty()) {
+  if (!callback && secondary_callbacks.empty() && !frame_callback_deferred) {
     // This means that the vsync waiter implementation fired a callback for a
     // request we did not make. This is a paranoid check but we still want to
     // make sure we catch misbehaving vsync implementations.
@@ -126,7 +158,10 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
     fml::TaskQueueId ui_task_queue_id =
         task_runners_.GetUITaskRunner()->GetTaskQueueId();
 
-    task_runners_.GetUITaskRunner()->PostTask(
+    // Frame production must not wait behind already queued housekeeping on
+    // the UI thread, so the BeginFrame dispatch is graded as user
+    // interaction.
+    task_runners_.GetUITaskRunner()->PostTaskWithGrade(
         [ui_task_queue_id, callback, flow_identifier, frame_start_time,
          frame_target_time, pause_secondary_tasks]() {
           FML_TRACE_EVENT("flutter", kVsyncTraceName, "StartTime",
@@ -140,12 +175,18 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
           if (pause_secondary_tasks) {
             ResumeDartMicroTasks(ui_task_queue_id);
           }
-        });
+        },
+        fml::TaskSourceGrade::kUserInteraction);
   }
 
   for (auto& secondary_callback : secondary_callbacks) {
     task_runners_.GetUITaskRunner()->PostTask(secondary_callback);
   }
+
+  if (frame_callback_deferred) {
+    // Re-arm for the vsync that will land in the next pacing slot.
+    AwaitVSync();
+  }
 }
 
 void VsyncWaiter::PauseDartMicroTasks() {
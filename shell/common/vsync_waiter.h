@@ -32,6 +32,13 @@ class VsyncWaiter : public std::enable_shared_from_this<VsyncWaiter> {
   /// |Animator::ScheduleMaybeClearTraceFlowIds|.
   void ScheduleSecondaryCallback(uintptr_t id, const fml::closure& callback);
 
+  /// Caps the rate at which frame callbacks are delivered. Vsyncs that arrive
+  /// inside the pacing interval re-arm the waiter instead of producing a
+  /// frame, so a 60Hz cap on a 120Hz display delivers every other vsync.
+  /// Secondary callbacks (input flow) are never throttled. A rate of zero
+  /// removes the cap. May be called from any thread.
+  void SetMaxRefreshRate(double max_refresh_rate);
+
  protected:
   // On some backends, the |FireCallback| needs to be made from a static C
   // method.
@@ -75,6 +82,13 @@ class VsyncWaiter : public std::enable_shared_from_this<VsyncWaiter> {
   std::mutex callback_mutex_;
   Callback callback_;
   std::unordered_map<uintptr_t, fml::closure> secondary_callbacks_;
+  double max_refresh_rate_ = 0;
+  fml::TimePoint last_frame_target_time_;
+
+  // Returns true if the given vsync falls inside the pacing interval of the
+  // refresh rate cap and the armed frame callback should be kept for a later
+  // vsync. Must be called with |callback_mutex_| held.
+  bool ShouldDeferFrameCallbackLocked(fml::TimePoint frame_target_time) const;
 
   void PauseDartMicroTasks();
   static void ResumeDartMicroTasks(fml::TaskQueueId ui_task_queue_id);
@@ -20,6 +20,12 @@ class TestVsyncWaiter : public VsyncWaiter {
 
   int await_vsync_call_count_ = 0;
 
+  void FireVsync(fml::TimePoint frame_start_time,
+                 fml::TimePoint frame_target_time) {
+    FireCallback(frame_start_time, frame_target_time,
+                 /*pause_secondary_tasks=*/false);
+  }
+
  protected:
   void AwaitVSync() override { await_vsync_call_count_++; }
 };
@@ -43,5 +49,45 @@ TEST(VsyncWaiterTest, NoUnneededAwaitVsync) {
   EXPECT_EQ(vsync_waiter.await_vsync_call_count_, 1);
 }
 
+TEST(VsyncWaiterTest, MaxRefreshRatePacesFrameCallbacks) {
+  using flutter::ThreadHost;
+  std::string prefix = "vsync_waiter_test";
+
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  auto task_runner = fml::MessageLoop::GetCurrent().GetTaskRunner();
+
+  const flutter::TaskRunners task_runners(prefix, task_runner, task_runner,
+                                          task_runner, task_runner);
+
+  TestVsyncWaiter vsync_waiter(task_runners);
+  vsync_waiter.SetMaxRefreshRate(60);
+
+  // Simulate a 120Hz display: vsyncs arrive half a 60Hz interval apart.
+  const fml::TimePoint t0 = fml::TimePoint::Now();
+  const fml::TimeDelta half_frame = fml::TimeDelta::FromMicroseconds(8333);
+
+  // The first vsync after the cap is installed always delivers the frame.
+  vsync_waiter.AsyncWaitForVsync([](std::unique_ptr<FrameTimingsRecorder>) {});
+  EXPECT_EQ(vsync_waiter.await_vsync_call_count_, 1);
+  vsync_waiter.FireVsync(t0, t0);
+
+  // A vsync inside the pacing interval keeps the frame callback armed and
+  // re-arms the waiter instead of delivering.
+  vsync_waiter.AsyncWaitForVsync([](std::unique_ptr<FrameTimingsRecorder>) {});
+  EXPECT_EQ(vsync_waiter.await_vsync_call_count_, 2);
+  vsync_waiter.FireVsync(t0, t0 + half_frame);
+  EXPECT_EQ(vsync_waiter.await_vsync_call_count_, 3);
+
+  // The deferred frame request is still armed, so a new request within the
+  // frame interval must not arm the waiter again.
+  vsync_waiter.AsyncWaitForVsync([](std::unique_ptr<FrameTimingsRecorder>) {});
+  EXPECT_EQ(vsync_waiter.await_vsync_call_count_, 3);
+
+  // The next 120Hz vsync lands in the pacing slot and delivers the frame
+  // without re-arming.
+  vsync_waiter.FireVsync(t0, t0 + half_frame * 2);
+  EXPECT_EQ(vsync_waiter.await_vsync_call_count_, 3);
+}
+
 }  // namespace testing
 }  // namespace flutter
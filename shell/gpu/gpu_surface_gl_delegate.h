@@ -6,6 +6,7 @@
 #define FLUTTER_SHELL_GPU_GPU_SURFACE_GL_DELEGATE_H_
 
 #include <optional>
+#include <vector>
 
 #include "flutter/common/graphics/gl_context_switch.h"
 #include "flutter/flow/embedded_views.h"
@@ -48,6 +49,11 @@ struct GLPresentInfo {
   // The buffer damage refers to the region that needs to be set as damaged
   // within the frame buffer.
   const std::optional<SkIRect>& buffer_damage;
+
+  // Optional breakdown of frame_damage into a bounded list of rectangles,
+  // for backends that can present multiple damage rectangles. May be null
+  // or empty when only the single frame_damage bound is known.
+  const std::vector<SkIRect>* frame_damage_rects = nullptr;
 };
 
 class GPUSurfaceGLDelegate {
@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_GPU_GPU_SURFACE_METAL_DRAWABLE_PACER_H_
+#define FLUTTER_SHELL_GPU_GPU_SURFACE_METAL_DRAWABLE_PACER_H_
+
+#include <dispatch/dispatch.h>
+
+#include <atomic>
+#include <cstdint>
+
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+// Paces CAMetalLayer drawable acquisition so that the raster thread blocks on
+// an instrumented semaphore instead of inside -[CAMetalLayer nextDrawable],
+// which waits without any visibility when the compositor is holding on to
+// drawables.
+//
+// A slot is taken with |WaitForSlot| before acquiring a drawable and returned
+// with |ReturnSlot| once the compositor has presented the drawable or the
+// frame has been discarded before presentation. Frames that are dropped
+// without returning their slot self-heal through the wait timeout.
+//
+// The pacer is shared with the presented handlers of in-flight drawables so
+// that it outlives the surface that created it.
+class MetalDrawablePacer {
+ public:
+  explicit MetalDrawablePacer(uint32_t maximum_drawables)
+      : semaphore_(dispatch_semaphore_create(maximum_drawables)) {}
+
+  ~MetalDrawablePacer() {
+    // A dispatch semaphore must be released at (or above) the value it was
+    // created with. Slots lost to dropped frames are returned here; presented
+    // handlers keep the pacer alive through their shared reference, so none
+    // of them can signal after this point.
+    for (uint32_t i = pending_.load(); i > 0; i--) {
+      dispatch_semaphore_signal(semaphore_);
+    }
+    dispatch_release(semaphore_);
+  }
+
+  // Blocks until fewer than the maximum number of drawables are in flight.
+  // Returns false when the wait timed out, in which case no slot was taken
+  // and the frame proceeds unpaced.
+  bool WaitForSlot() {
+    if (dispatch_semaphore_wait(
+            semaphore_, dispatch_time(DISPATCH_TIME_NOW, kSlotTimeoutNanos)) !=
+        0) {
+      return false;
+    }
+    pending_.fetch_add(1u);
+    return true;
+  }
+
+  // Returns a slot taken by |WaitForSlot|, either because the drawable it was
+  // taken for has been presented or because the frame was discarded before
+  // presentation.
+  void ReturnSlot() {
+    pending_.fetch_sub(1u);
+    dispatch_semaphore_signal(semaphore_);
+  }
+
+ private:
+  // A frame that waits this long has lost its slot to a dropped frame rather
+  // than to compositor backpressure; give up on pacing it instead of stalling
+  // the raster thread indefinitely.
+  static constexpr int64_t kSlotTimeoutNanos = 1 * NSEC_PER_SEC;
+
+  dispatch_semaphore_t semaphore_;
+  std::atomic<uint32_t> pending_ = {0u};
+
+  FML_DISALLOW_COPY_AND_ASSIGN(MetalDrawablePacer);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_GPU_GPU_SURFACE_METAL_DRAWABLE_PACER_H_
@@ -13,6 +13,8 @@
 
 namespace flutter {
 
+class MetalDrawablePacer;
+
 class SK_API_AVAILABLE_CA_METAL_LAYER GPUSurfaceMetalImpeller : public Surface {
  public:
   GPUSurfaceMetalImpeller(GPUSurfaceMetalDelegate* delegate,
@@ -29,6 +31,11 @@ class SK_API_AVAILABLE_CA_METAL_LAYER GPUSurfaceMetalImpeller : public Surface {
   std::shared_ptr<impeller::Renderer> impeller_renderer_;
   std::shared_ptr<impeller::AiksContext> aiks_context_;
 
+  // Limits the number of drawables in flight so the raster thread waits on an
+  // instrumented semaphore instead of inside nextDrawable. Shared with the
+  // presented handlers of in-flight drawables.
+  std::shared_ptr<MetalDrawablePacer> drawable_pacer_;
+
   // |Surface|
   std::unique_ptr<SurfaceFrame> AcquireFrame(const SkISize& size) override;
 
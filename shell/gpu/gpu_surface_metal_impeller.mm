@@ -7,10 +7,14 @@
 #import <Metal/Metal.h>
 #import <QuartzCore/QuartzCore.h>
 
+#include <algorithm>
+
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/mapping.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/impeller/display_list/display_list_dispatcher.h"
 #include "flutter/impeller/renderer/backend/metal/surface_mtl.h"
+#include "flutter/shell/gpu/gpu_surface_metal_drawable_pacer.h"
 
 static_assert(!__has_feature(objc_arc), "ARC must be disabled.");
 
@@ -55,9 +59,48 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrame(const SkISiz
 
   auto* mtl_layer = (CAMetalLayer*)layer;
 
+  if (!drawable_pacer_) {
+    uint32_t maximum_drawables = 3u;
+    if (@available(iOS 11.2, macOS 10.13.2, *)) {
+      maximum_drawables = std::max<uint32_t>(1u, mtl_layer.maximumDrawableCount);
+    }
+    drawable_pacer_ = std::make_shared<MetalDrawablePacer>(maximum_drawables);
+  }
+
+  // Wait for a previously presented drawable to come back before asking the
+  // layer for the next one, so that compositor backpressure shows up as an
+  // instrumented wait instead of an opaque stall inside nextDrawable.
+  bool paced = false;
+  {
+    TRACE_EVENT0("flutter", "WaitForFrameInFlight");
+    paced = drawable_pacer_->WaitForSlot();
+    if (!paced) {
+      FML_DLOG(ERROR) << "Timed out waiting for a drawable slot; the compositor is likely "
+                         "holding on to drawables.";
+    }
+  }
+
   auto surface = impeller::SurfaceMTL::WrapCurrentMetalLayerDrawable(
       impeller_renderer_->GetContext(), mtl_layer);
 
+  if (paced) {
+    bool handler_added = false;
+    if (surface) {
+      if (@available(iOS 10.3, macOS 10.15.4, *)) {
+        // Return the pacing slot once the compositor has actually shown the
+        // drawable; this is what establishes the frames-in-flight limit.
+        auto pacer = drawable_pacer_;
+        [surface->drawable() addPresentedHandler:^(id<MTLDrawable> presented) {
+          pacer->ReturnSlot();
+        }];
+        handler_added = true;
+      }
+    }
+    if (!handler_added) {
+      drawable_pacer_->ReturnSlot();
+    }
+  }
+
   SurfaceFrame::SubmitCallback submit_callback =
       fml::MakeCopyable([renderer = impeller_renderer_,  //
                          aiks_context = aiks_context_,   //
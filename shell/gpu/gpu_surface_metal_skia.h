@@ -14,6 +14,8 @@
 
 namespace flutter {
 
+class MetalDrawablePacer;
+
 class SK_API_AVAILABLE_CA_METAL_LAYER GPUSurfaceMetalSkia : public Surface {
  public:
   GPUSurfaceMetalSkia(GPUSurfaceMetalDelegate* delegate,
@@ -44,6 +46,11 @@ class SK_API_AVAILABLE_CA_METAL_LAYER GPUSurfaceMetalSkia : public Surface {
   // MTLTexture for each drawable
   std::map<uintptr_t, SkIRect> damage_;
 
+  // Limits the number of drawables in flight so the raster thread waits on an
+  // instrumented semaphore instead of inside nextDrawable. Shared with the
+  // presented handlers of in-flight drawables.
+  std::shared_ptr<MetalDrawablePacer> drawable_pacer_;
+
   // |Surface|
   std::unique_ptr<SurfaceFrame> AcquireFrame(const SkISize& size) override;
 
@@ -7,6 +7,7 @@
 #import <Metal/Metal.h>
 #import <QuartzCore/QuartzCore.h>
 
+#include <algorithm>
 #include <utility>
 
 #include "flutter/common/graphics/persistent_cache.h"
@@ -15,6 +16,7 @@
 #include "flutter/fml/platform/darwin/scoped_nsobject.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/shell/gpu/gpu_surface_metal_delegate.h"
+#include "flutter/shell/gpu/gpu_surface_metal_drawable_pacer.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkColorSpace.h"
 #include "third_party/skia/include/core/SkColorType.h"
@@ -123,11 +125,39 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalSkia::AcquireFrameFromCAMetalLayer(
   }
 
   auto* mtl_layer = (CAMetalLayer*)layer;
+
+  if (!drawable_pacer_) {
+    uint32_t maximum_drawables = 3u;
+    if (@available(iOS 11.2, macOS 10.13.2, *)) {
+      maximum_drawables = std::max<uint32_t>(1u, mtl_layer.maximumDrawableCount);
+    }
+    drawable_pacer_ = std::make_shared<MetalDrawablePacer>(maximum_drawables);
+  }
+
+  // Wait for a previously presented drawable to come back before asking the
+  // layer for the next one, so that compositor backpressure shows up as an
+  // instrumented wait instead of an opaque stall inside nextDrawable.
+  bool paced = false;
+  {
+    TRACE_EVENT0("flutter", "WaitForFrameInFlight");
+    paced = drawable_pacer_->WaitForSlot();
+    if (!paced) {
+      FML_DLOG(ERROR) << "Timed out waiting for a drawable slot; the compositor is likely "
+                         "holding on to drawables.";
+    }
+  }
+
   // Get the drawable eagerly, we will need texture object to identify target framebuffer
-  fml::scoped_nsprotocol<id<CAMetalDrawable>> drawable(
-      reinterpret_cast<id<CAMetalDrawable>>([[mtl_layer nextDrawable] retain]));
+  fml::scoped_nsprotocol<id<CAMetalDrawable>> drawable;
+  {
+    TRACE_EVENT0("flutter", "WaitForNextDrawable");
+    drawable.reset(reinterpret_cast<id<CAMetalDrawable>>([[mtl_layer nextDrawable] retain]));
+  }
 
   if (!drawable.get()) {
+    if (paced) {
+      drawable_pacer_->ReturnSlot();
+    }
     FML_LOG(ERROR) << "Could not obtain drawable from the metal layer.";
     return nullptr;
   }
@@ -141,6 +171,9 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalSkia::AcquireFrameFromCAMetalLayer(
   );
 
   if (!surface) {
+    if (paced) {
+      drawable_pacer_->ReturnSlot();
+    }
     FML_LOG(ERROR) << "Could not create the SkSurface from the CAMetalLayer.";
     return nullptr;
   }
@@ -172,6 +205,28 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalSkia::AcquireFrameFromCAMetalLayer(
       damage_[texture] = SkIRect::MakeEmpty();
     }
 
+    return true;
+  };
+
+  // Presenting a drawable waits until the flushed command buffers are scheduled, which can
+  // block for several milliseconds when the compositor is holding buffers. The command queue
+  // is thread safe and queue submission order is established by the flush in the submit
+  // callback, so the wait can run on the rasterizer's present thread and overlap with the
+  // next frame's rasterization.
+  auto present_callback = [this, drawable, pacer = drawable_pacer_,
+                           paced](const SurfaceFrame& surface_frame) -> bool {
+    TRACE_EVENT0("flutter", "GPUSurfaceMetal::PresentDrawable");
+    if (paced) {
+      if (@available(iOS 10.3, macOS 10.15.4, *)) {
+        // Return the pacing slot once the compositor has actually shown the
+        // drawable; this is what establishes the frames-in-flight limit.
+        [drawable.get() addPresentedHandler:^(id<MTLDrawable> presented) {
+          pacer->ReturnSlot();
+        }];
+      } else {
+        pacer->ReturnSlot();
+      }
+    }
     return delegate_->PresentDrawable(drawable);
   };
 
@@ -189,8 +244,10 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalSkia::AcquireFrameFromCAMetalLayer(
     framebuffer_info.supports_partial_repaint = true;
   }
 
-  return std::make_unique<SurfaceFrame>(std::move(surface), framebuffer_info, submit_callback,
-                                        frame_info);
+  auto surface_frame = std::make_unique<SurfaceFrame>(std::move(surface), framebuffer_info,
+                                                      submit_callback, frame_info);
+  surface_frame->set_present_callback(present_callback);
+  return surface_frame;
 }
 
 std::unique_ptr<SurfaceFrame> GPUSurfaceMetalSkia::AcquireFrameFromMTLTexture(
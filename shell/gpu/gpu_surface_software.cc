@@ -71,7 +71,17 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceSoftware::AcquireFrame(
 
     canvas->flush();
 
-    return self->delegate_->PresentBackingStore(surface_frame.SkiaSurface());
+    // Prefer the per-rect breakdown of the frame damage; fall back to its
+    // bounding rectangle. An empty list tells the delegate the damage is
+    // unknown and the entire backing store must be presented.
+    const auto& submit_info = surface_frame.submit_info();
+    std::vector<SkIRect> damage_rects = submit_info.frame_damage_rects;
+    if (damage_rects.empty() && submit_info.frame_damage.has_value()) {
+      damage_rects.push_back(submit_info.frame_damage.value());
+    }
+
+    return self->delegate_->PresentBackingStore(surface_frame.SkiaSurface(),
+                                                damage_rects);
   };
 
   return std::make_unique<SurfaceFrame>(backing_store, framebuffer_info,
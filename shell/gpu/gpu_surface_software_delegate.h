@@ -5,6 +5,8 @@
 #ifndef FLUTTER_SHELL_GPU_GPU_SURFACE_SOFTWARE_DELEGATE_H_
 #define FLUTTER_SHELL_GPU_GPU_SURFACE_SOFTWARE_DELEGATE_H_
 
+#include <vector>
+
 #include "flutter/flow/embedded_views.h"
 #include "flutter/fml/macros.h"
 #include "third_party/skia/include/core/SkSurface.h"
@@ -42,12 +44,20 @@ class GPUSurfaceSoftwareDelegate {
   /// @brief      Called by the platform when a frame has been rendered into the
   ///             backing store and the platform must display it on-screen.
   ///
+  ///             The damage rects describe the area of the backing store that
+  ///             changed since the previous frame; platform surfaces that copy
+  ///             the backing store on-screen may restrict the copy to that
+  ///             area. An empty list means the damage is unknown and the
+  ///             entire backing store must be presented.
+  ///
   /// @param[in]  backing_store  The software backing store to present.
+  /// @param[in]  damage_rects   The changed area, or empty when unknown.
   ///
   /// @return     Returns if the platform could present the backing store onto
   ///             the screen.
   ///
-  virtual bool PresentBackingStore(sk_sp<SkSurface> backing_store) = 0;
+  virtual bool PresentBackingStore(sk_sp<SkSurface> backing_store,
+                                   const std::vector<SkIRect>& damage_rects) = 0;
 };
 
 }  // namespace flutter
@@ -132,8 +132,11 @@ class AndroidEGLSurfaceDamage {
       return std::nullopt;
     }
 
-    EGLint age;
-    eglQuerySurface(display, surface, EGL_BUFFER_AGE_EXT, &age);
+    EGLint age = 0;
+    if (eglQuerySurface(display, surface, EGL_BUFFER_AGE_EXT, &age) !=
+        EGL_TRUE) {
+      return std::nullopt;  // full repaint
+    }
 
     if (age == 0) {  // full repaint
       return std::nullopt;
@@ -145,21 +148,44 @@ class AndroidEGLSurfaceDamage {
            i != damage_history_.rend() && age > 0; ++i, --age) {
         res.join(*i);
       }
+      if (age > 0) {
+        // The buffer is older than the recorded damage history, so the
+        // content it retains cannot be validated. Full repaint.
+        return std::nullopt;
+      }
       return res;
     }
   }
 
   bool SwapBuffersWithDamage(EGLDisplay display,
                              EGLSurface surface,
-                             const std::optional<SkIRect>& damage) {
+                             const std::optional<SkIRect>& damage,
+                             const std::vector<SkIRect>& damage_rects = {}) {
     if (swap_buffers_with_damage_ && damage) {
+      // The damage history is used to compute initial damage from the buffer
+      // age, which only needs the overall bound.
       damage_history_.push_back(*damage);
       if (damage_history_.size() > kMaxHistorySize) {
         damage_history_.pop_front();
       }
-      auto rects = RectToInts(display, surface, *damage);
-      return swap_buffers_with_damage_(display, surface, rects.data(), 1);
+      std::vector<EGLint> rects;
+      if (damage_rects.empty()) {
+        auto ints = RectToInts(display, surface, *damage);
+        rects.assign(ints.begin(), ints.end());
+      } else {
+        rects.reserve(4 * damage_rects.size());
+        for (const auto& damage_rect : damage_rects) {
+          auto ints = RectToInts(display, surface, damage_rect);
+          rects.insert(rects.end(), ints.begin(), ints.end());
+        }
+      }
+      return swap_buffers_with_damage_(display, surface, rects.data(),
+                                       rects.size() / 4);
     } else {
+      // A swap without known damage invalidates the correspondence between
+      // buffer age and the history; clear it so |InitialDamage| requests full
+      // repaints until enough damage-tracked frames accumulate again.
+      damage_history_.clear();
       return eglSwapBuffers(display, surface);
     }
   }
@@ -261,6 +287,14 @@ bool AndroidEGLSurface::SwapBuffers(
   return damage_->SwapBuffersWithDamage(display_, surface_, surface_damage);
 }
 
+bool AndroidEGLSurface::SwapBuffers(
+    const std::vector<SkIRect>& damage_rects,
+    const std::optional<SkIRect>& surface_damage) {
+  TRACE_EVENT0("flutter", "AndroidContextGL::SwapBuffers");
+  return damage_->SwapBuffersWithDamage(display_, surface_, surface_damage,
+                                        damage_rects);
+}
+
 bool AndroidEGLSurface::SupportsPartialRepaint() const {
   return damage_->SupportsPartialRepaint();
 }
@@ -9,6 +9,7 @@
 #include <EGL/eglext.h>
 #include <KHR/khrplatform.h>
 #include <optional>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/time/time_point.h"
@@ -95,6 +96,18 @@ class AndroidEGLSurface {
   ///
   bool SwapBuffers(const std::optional<SkIRect>& surface_damage);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Same as |SwapBuffers| but presents the individual damage
+  ///             rectangles instead of their single bound when the EGL
+  ///             implementation supports swapping with a damage list.
+  ///             |surface_damage| must be the bounding rectangle of
+  ///             |damage_rects|.
+  ///
+  /// @return     Whether the EGL surface color buffer was swapped.
+  ///
+  bool SwapBuffers(const std::vector<SkIRect>& damage_rects,
+                   const std::optional<SkIRect>& surface_damage);
+
   //----------------------------------------------------------------------------
   /// @return     The size of an `EGLSurface`.
   ///
@@ -34,7 +34,7 @@ void AndroidExternalTextureGL::OnGrContextCreated() {
   state_ = AttachmentState::uninitialized;
 }
 
-void AndroidExternalTextureGL::MarkNewFrameAvailable() {
+void AndroidExternalTextureGL::OnNewFrameAvailable() {
   new_frame_ready_ = true;
 }
 
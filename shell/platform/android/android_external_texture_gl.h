@@ -30,7 +30,7 @@ class AndroidExternalTextureGL : public flutter::Texture {
 
   void OnGrContextDestroyed() override;
 
-  void MarkNewFrameAvailable() override;
+  void OnNewFrameAvailable() override;
 
   void OnTextureUnregistered() override;
 
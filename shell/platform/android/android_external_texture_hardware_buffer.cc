@@ -0,0 +1,227 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/android/android_external_texture_hardware_buffer.h"
+
+#include <GLES/glext.h>
+#include <unistd.h>
+
+#include <optional>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/native_library.h"
+#include "third_party/skia/include/core/SkAlphaType.h"
+#include "third_party/skia/include/core/SkColorSpace.h"
+#include "third_party/skia/include/core/SkColorType.h"
+#include "third_party/skia/include/core/SkImage.h"
+#include "third_party/skia/include/gpu/GrBackendSurface.h"
+#include "third_party/skia/include/gpu/GrDirectContext.h"
+
+// Only available on API 26+. The descriptor layout is part of the NDK's
+// stable ABI; only the fields read below are declared.
+typedef struct AHardwareBuffer_Desc {
+  uint32_t width;
+  uint32_t height;
+  uint32_t layers;
+  uint32_t format;
+  uint64_t usage;
+  uint32_t stride;
+  uint32_t rfu0;
+  uint64_t rfu1;
+} AHardwareBuffer_Desc;
+
+typedef void (*AHardwareBuffer_release_FPN)(AHardwareBuffer* buffer);
+typedef void (*AHardwareBuffer_describe_FPN)(const AHardwareBuffer* buffer,
+                                             AHardwareBuffer_Desc* out_desc);
+static AHardwareBuffer_release_FPN hardware_buffer_release;
+static AHardwareBuffer_describe_FPN hardware_buffer_describe;
+
+static PFNEGLGETNATIVECLIENTBUFFERANDROIDPROC egl_get_native_client_buffer;
+static PFNEGLCREATEIMAGEKHRPROC egl_create_image;
+static PFNEGLDESTROYIMAGEKHRPROC egl_destroy_image;
+static PFNEGLCREATESYNCKHRPROC egl_create_sync;
+static PFNEGLDESTROYSYNCKHRPROC egl_destroy_sync;
+static PFNEGLWAITSYNCKHRPROC egl_wait_sync;
+static PFNGLEGLIMAGETARGETTEXTURE2DOESPROC gl_egl_image_target_texture;
+
+namespace flutter {
+
+AndroidExternalTextureHardwareBuffer::AndroidExternalTextureHardwareBuffer(
+    int64_t id,
+    std::shared_ptr<AndroidHardwareBufferProvider> provider)
+    : Texture(id), provider_(std::move(provider)) {
+  FML_DCHECK(IsSupported());
+}
+
+AndroidExternalTextureHardwareBuffer::~AndroidExternalTextureHardwareBuffer() {
+  if (state_ == AttachmentState::attached) {
+    ReleaseImage();
+    glDeleteTextures(1, &texture_name_);
+  }
+}
+
+bool AndroidExternalTextureHardwareBuffer::IsSupported() {
+  static std::optional<bool> supported;
+  if (supported) {
+    return supported.value();
+  }
+  supported = false;
+  auto libandroid = fml::NativeLibrary::Create("libandroid.so");
+  if (!libandroid) {
+    return false;
+  }
+  auto release_fn = libandroid->ResolveFunction<AHardwareBuffer_release_FPN>(
+      "AHardwareBuffer_release");
+  auto describe_fn = libandroid->ResolveFunction<AHardwareBuffer_describe_FPN>(
+      "AHardwareBuffer_describe");
+  auto get_native_client_buffer_fn =
+      reinterpret_cast<PFNEGLGETNATIVECLIENTBUFFERANDROIDPROC>(
+          eglGetProcAddress("eglGetNativeClientBufferANDROID"));
+  auto create_image_fn = reinterpret_cast<PFNEGLCREATEIMAGEKHRPROC>(
+      eglGetProcAddress("eglCreateImageKHR"));
+  auto destroy_image_fn = reinterpret_cast<PFNEGLDESTROYIMAGEKHRPROC>(
+      eglGetProcAddress("eglDestroyImageKHR"));
+  auto create_sync_fn = reinterpret_cast<PFNEGLCREATESYNCKHRPROC>(
+      eglGetProcAddress("eglCreateSyncKHR"));
+  auto destroy_sync_fn = reinterpret_cast<PFNEGLDESTROYSYNCKHRPROC>(
+      eglGetProcAddress("eglDestroySyncKHR"));
+  auto wait_sync_fn = reinterpret_cast<PFNEGLWAITSYNCKHRPROC>(
+      eglGetProcAddress("eglWaitSyncKHR"));
+  auto image_target_texture_fn =
+      reinterpret_cast<PFNGLEGLIMAGETARGETTEXTURE2DOESPROC>(
+          eglGetProcAddress("glEGLImageTargetTexture2DOES"));
+  if (!release_fn || !describe_fn || !get_native_client_buffer_fn ||
+      !create_image_fn || !destroy_image_fn || !create_sync_fn ||
+      !destroy_sync_fn || !wait_sync_fn || !image_target_texture_fn) {
+    return false;
+  }
+  hardware_buffer_release = release_fn.value();
+  hardware_buffer_describe = describe_fn.value();
+  egl_get_native_client_buffer = get_native_client_buffer_fn;
+  egl_create_image = create_image_fn;
+  egl_destroy_image = destroy_image_fn;
+  egl_create_sync = create_sync_fn;
+  egl_destroy_sync = destroy_sync_fn;
+  egl_wait_sync = wait_sync_fn;
+  gl_egl_image_target_texture = image_target_texture_fn;
+  supported = true;
+  return true;
+}
+
+void AndroidExternalTextureHardwareBuffer::OnGrContextCreated() {
+  state_ = AttachmentState::uninitialized;
+  // The GL texture was lost with the old context; re-import on the next paint.
+  new_frame_ready_ = true;
+}
+
+void AndroidExternalTextureHardwareBuffer::OnNewFrameAvailable() {
+  new_frame_ready_ = true;
+}
+
+void AndroidExternalTextureHardwareBuffer::Paint(
+    PaintContext& context,
+    const SkRect& bounds,
+    bool freeze,
+    const SkSamplingOptions& sampling) {
+  if (state_ == AttachmentState::detached) {
+    return;
+  }
+  if (state_ == AttachmentState::uninitialized) {
+    glGenTextures(1, &texture_name_);
+    state_ = AttachmentState::attached;
+  }
+  if (!freeze && new_frame_ready_) {
+    int acquire_fence_fd = -1;
+    AHardwareBuffer* latest = provider_->AcquireLatestBuffer(&acquire_fence_fd);
+    if (latest != nullptr) {
+      ImportBuffer(latest, acquire_fence_fd);
+    }
+    new_frame_ready_ = false;
+  }
+  if (image_ == EGL_NO_IMAGE_KHR) {
+    return;
+  }
+  GrGLTextureInfo textureInfo = {GL_TEXTURE_EXTERNAL_OES, texture_name_,
+                                 GL_RGBA8_OES};
+  GrBackendTexture backendTexture(size_.width(), size_.height(),
+                                  GrMipMapped::kNo, textureInfo);
+  sk_sp<SkImage> image = SkImage::MakeFromTexture(
+      context.gr_context, backendTexture, kTopLeft_GrSurfaceOrigin,
+      kRGBA_8888_SkColorType, kPremul_SkAlphaType, nullptr);
+  if (image) {
+    // AHardwareBuffers are imported with their natural orientation and need
+    // neither the vertical flip nor the texture coordinate transform that
+    // SurfaceTexture frames require.
+    context.canvas->drawImageRect(image, bounds, sampling, context.sk_paint);
+  }
+}
+
+void AndroidExternalTextureHardwareBuffer::ImportBuffer(
+    AHardwareBuffer* buffer,
+    int acquire_fence_fd) {
+  EGLDisplay display = eglGetCurrentDisplay();
+  if (acquire_fence_fd >= 0) {
+    // Queue a server-side wait on the producer's fence so the GPU never
+    // samples a buffer that is still being written. The raster thread is not
+    // blocked.
+    const EGLint sync_attribs[] = {EGL_SYNC_NATIVE_FENCE_FD_ANDROID,
+                                   acquire_fence_fd, EGL_NONE};
+    EGLSyncKHR sync =
+        egl_create_sync(display, EGL_SYNC_NATIVE_FENCE_ANDROID, sync_attribs);
+    if (sync != EGL_NO_SYNC_KHR) {
+      egl_wait_sync(display, sync, 0);
+      // The sync owns the descriptor now; destroying it does not cancel the
+      // queued wait.
+      egl_destroy_sync(display, sync);
+    } else {
+      close(acquire_fence_fd);
+    }
+  }
+  EGLClientBuffer client_buffer = egl_get_native_client_buffer(buffer);
+  const EGLint image_attribs[] = {EGL_IMAGE_PRESERVED_KHR, EGL_TRUE, EGL_NONE};
+  EGLImageKHR image = egl_create_image(display, EGL_NO_CONTEXT,
+                                       EGL_NATIVE_BUFFER_ANDROID,
+                                       client_buffer, image_attribs);
+  if (image == EGL_NO_IMAGE_KHR) {
+    FML_LOG(ERROR) << "eglCreateImageKHR failed for hardware buffer texture "
+                   << Id();
+    hardware_buffer_release(buffer);
+    return;
+  }
+  // The previous frame's image and buffer are only released once the
+  // replacement import has succeeded, so a failed import keeps showing the
+  // last good frame.
+  ReleaseImage();
+  buffer_ = buffer;
+  image_ = image;
+  AHardwareBuffer_Desc desc = {};
+  hardware_buffer_describe(buffer_, &desc);
+  size_ = SkISize::Make(desc.width, desc.height);
+  glBindTexture(GL_TEXTURE_EXTERNAL_OES, texture_name_);
+  gl_egl_image_target_texture(GL_TEXTURE_EXTERNAL_OES,
+                              static_cast<GLeglImageOES>(image_));
+}
+
+void AndroidExternalTextureHardwareBuffer::ReleaseImage() {
+  if (image_ != EGL_NO_IMAGE_KHR) {
+    egl_destroy_image(eglGetCurrentDisplay(), image_);
+    image_ = EGL_NO_IMAGE_KHR;
+  }
+  if (buffer_ != nullptr) {
+    hardware_buffer_release(buffer_);
+    buffer_ = nullptr;
+  }
+}
+
+void AndroidExternalTextureHardwareBuffer::OnGrContextDestroyed() {
+  if (state_ == AttachmentState::attached) {
+    ReleaseImage();
+    glDeleteTextures(1, &texture_name_);
+  }
+  state_ = AttachmentState::detached;
+}
+
+void AndroidExternalTextureHardwareBuffer::OnTextureUnregistered() {}
+
+}  // namespace flutter
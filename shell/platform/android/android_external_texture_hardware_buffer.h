@@ -0,0 +1,117 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_ANDROID_EXTERNAL_TEXTURE_HARDWARE_BUFFER_H_
+#define FLUTTER_SHELL_PLATFORM_ANDROID_EXTERNAL_TEXTURE_HARDWARE_BUFFER_H_
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GLES/gl.h>
+
+#include <memory>
+
+#include "flutter/common/graphics/texture.h"
+#include "flutter/fml/macros.h"
+
+// Opaque NDK type (API 26+). Resolved at runtime, never linked directly.
+typedef struct AHardwareBuffer AHardwareBuffer;
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Supplies the frames for an `AndroidExternalTextureHardwareBuffer`.
+///
+/// Implemented by the producer side of a video or camera pipeline, typically
+/// backed by an `AImageReader` whose images expose their backing
+/// AHardwareBuffers. Called on the raster thread once per painted frame.
+///
+class AndroidHardwareBufferProvider {
+ public:
+  virtual ~AndroidHardwareBufferProvider() = default;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the most recently produced buffer, or nullptr when no
+  ///             frame is available. The returned buffer carries a reference
+  ///             acquired for the caller; the caller releases it when done.
+  ///
+  /// @param[out] out_acquire_fence_fd  A sync file descriptor the GPU must
+  ///             wait on before sampling the buffer, or -1 when the buffer is
+  ///             already safe to read. Ownership of the descriptor transfers
+  ///             to the caller.
+  ///
+  virtual AHardwareBuffer* AcquireLatestBuffer(int* out_acquire_fence_fd) = 0;
+};
+
+//------------------------------------------------------------------------------
+/// An external texture that samples AHardwareBuffers directly.
+///
+/// Unlike `AndroidExternalTextureGL`, which binds a SurfaceTexture to the
+/// raster context and serializes against the producer inside
+/// `updateTexImage`, this path imports the latest buffer as an EGLImage and
+/// defers producer synchronization to a server-side fence wait. No pixels are
+/// copied and no SurfaceTexture lock is taken. The same buffers could be bound
+/// as VkImages via VK_ANDROID_external_memory_android_hardware_buffer by a
+/// Vulkan-backed rasterizer; this class implements the GLES half used by the
+/// current surfaces.
+///
+class AndroidExternalTextureHardwareBuffer : public flutter::Texture {
+ public:
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the NDK and EGL entry points this texture needs are
+  ///             available on this device (API 26+ with the Android EGL
+  ///             extensions). Must return true before an instance is created.
+  ///
+  static bool IsSupported();
+
+  AndroidExternalTextureHardwareBuffer(
+      int64_t id,
+      std::shared_ptr<AndroidHardwareBufferProvider> provider);
+
+  ~AndroidExternalTextureHardwareBuffer() override;
+
+  // |flutter::Texture|
+  void Paint(PaintContext& context,
+             const SkRect& bounds,
+             bool freeze,
+             const SkSamplingOptions& sampling) override;
+
+  // |flutter::Texture|
+  void OnGrContextCreated() override;
+
+  // |flutter::Texture|
+  void OnGrContextDestroyed() override;
+
+  // |flutter::Texture|
+  void OnNewFrameAvailable() override;
+
+  // |flutter::Texture|
+  void OnTextureUnregistered() override;
+
+ private:
+  void ImportBuffer(AHardwareBuffer* buffer, int acquire_fence_fd);
+
+  void ReleaseImage();
+
+  enum class AttachmentState { uninitialized, attached, detached };
+
+  std::shared_ptr<AndroidHardwareBufferProvider> provider_;
+
+  AttachmentState state_ = AttachmentState::uninitialized;
+
+  bool new_frame_ready_ = true;
+
+  GLuint texture_name_ = 0;
+
+  EGLImageKHR image_ = EGL_NO_IMAGE_KHR;
+
+  AHardwareBuffer* buffer_ = nullptr;
+
+  SkISize size_ = SkISize::MakeEmpty();
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AndroidExternalTextureHardwareBuffer);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_ANDROID_EXTERNAL_TEXTURE_HARDWARE_BUFFER_H_
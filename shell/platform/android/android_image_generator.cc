@@ -4,17 +4,122 @@
 
 #include "flutter/shell/platform/android/android_image_generator.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <optional>
 
 #include <android/bitmap.h>
 #include <android/hardware_buffer.h>
 
+#include "flutter/fml/native_library.h"
 #include "flutter/fml/platform/android/jni_util.h"
 
 #include "third_party/skia/include/codec/SkCodecAnimation.h"
 
+// AImageDecoder is only available on API 30+. The symbols are resolved at
+// runtime so the engine keeps running on older devices; the typedefs mirror
+// <android/imagedecoder.h>.
+typedef void AImageDecoder;
+typedef void AImageDecoderHeaderInfo;
+typedef int (*AImageDecoder_createFromBuffer_FPN)(const void* buffer,
+                                                  size_t length,
+                                                  AImageDecoder** out_decoder);
+typedef void (*AImageDecoder_delete_FPN)(AImageDecoder* decoder);
+typedef const AImageDecoderHeaderInfo* (*AImageDecoder_getHeaderInfo_FPN)(
+    AImageDecoder* decoder);
+typedef int32_t (*AImageDecoderHeaderInfo_getWidth_FPN)(
+    const AImageDecoderHeaderInfo* info);
+typedef int32_t (*AImageDecoderHeaderInfo_getHeight_FPN)(
+    const AImageDecoderHeaderInfo* info);
+typedef int32_t (*AImageDecoderHeaderInfo_getAlphaFlags_FPN)(
+    const AImageDecoderHeaderInfo* info);
+typedef int (*AImageDecoder_setAndroidBitmapFormat_FPN)(AImageDecoder* decoder,
+                                                        int32_t format);
+typedef int (*AImageDecoder_setTargetSize_FPN)(AImageDecoder* decoder,
+                                               int32_t width,
+                                               int32_t height);
+typedef int (*AImageDecoder_decodeImage_FPN)(AImageDecoder* decoder,
+                                             void* pixels,
+                                             size_t stride,
+                                             size_t size);
+static AImageDecoder_createFromBuffer_FPN AImageDecoder_createFromBuffer;
+static AImageDecoder_delete_FPN AImageDecoder_delete;
+static AImageDecoder_getHeaderInfo_FPN AImageDecoder_getHeaderInfo;
+static AImageDecoderHeaderInfo_getWidth_FPN AImageDecoderHeaderInfo_getWidth;
+static AImageDecoderHeaderInfo_getHeight_FPN AImageDecoderHeaderInfo_getHeight;
+static AImageDecoderHeaderInfo_getAlphaFlags_FPN
+    AImageDecoderHeaderInfo_getAlphaFlags;
+static AImageDecoder_setAndroidBitmapFormat_FPN
+    AImageDecoder_setAndroidBitmapFormat;
+static AImageDecoder_setTargetSize_FPN AImageDecoder_setTargetSize;
+static AImageDecoder_decodeImage_FPN AImageDecoder_decodeImage;
+
+// ANDROID_IMAGE_DECODER_SUCCESS from <android/imagedecoder.h>.
+static constexpr int kAImageDecoderSuccess = 0;
+// ANDROID_BITMAP_FLAGS_ALPHA_OPAQUE from the API 30 <android/bitmap.h>.
+static constexpr int32_t kAndroidBitmapFlagsAlphaOpaque = 1;
+
 namespace flutter {
 
+namespace {
+
+bool ResolveAImageDecoderSymbols() {
+  static std::optional<bool> resolved;
+  if (resolved) {
+    return resolved.value();
+  }
+  auto libjnigraphics = fml::NativeLibrary::Create("libjnigraphics.so");
+  FML_DCHECK(libjnigraphics);
+  auto create_fn =
+      libjnigraphics->ResolveFunction<AImageDecoder_createFromBuffer_FPN>(
+          "AImageDecoder_createFromBuffer");
+  auto delete_fn = libjnigraphics->ResolveFunction<AImageDecoder_delete_FPN>(
+      "AImageDecoder_delete");
+  auto get_header_info_fn =
+      libjnigraphics->ResolveFunction<AImageDecoder_getHeaderInfo_FPN>(
+          "AImageDecoder_getHeaderInfo");
+  auto get_width_fn =
+      libjnigraphics->ResolveFunction<AImageDecoderHeaderInfo_getWidth_FPN>(
+          "AImageDecoderHeaderInfo_getWidth");
+  auto get_height_fn =
+      libjnigraphics->ResolveFunction<AImageDecoderHeaderInfo_getHeight_FPN>(
+          "AImageDecoderHeaderInfo_getHeight");
+  auto get_alpha_flags_fn =
+      libjnigraphics
+          ->ResolveFunction<AImageDecoderHeaderInfo_getAlphaFlags_FPN>(
+              "AImageDecoderHeaderInfo_getAlphaFlags");
+  auto set_format_fn =
+      libjnigraphics
+          ->ResolveFunction<AImageDecoder_setAndroidBitmapFormat_FPN>(
+              "AImageDecoder_setAndroidBitmapFormat");
+  auto set_target_size_fn =
+      libjnigraphics->ResolveFunction<AImageDecoder_setTargetSize_FPN>(
+          "AImageDecoder_setTargetSize");
+  auto decode_image_fn =
+      libjnigraphics->ResolveFunction<AImageDecoder_decodeImage_FPN>(
+          "AImageDecoder_decodeImage");
+  if (create_fn && delete_fn && get_header_info_fn && get_width_fn &&
+      get_height_fn && get_alpha_flags_fn && set_format_fn &&
+      set_target_size_fn && decode_image_fn) {
+    AImageDecoder_createFromBuffer = create_fn.value();
+    AImageDecoder_delete = delete_fn.value();
+    AImageDecoder_getHeaderInfo = get_header_info_fn.value();
+    AImageDecoderHeaderInfo_getWidth = get_width_fn.value();
+    AImageDecoderHeaderInfo_getHeight = get_height_fn.value();
+    AImageDecoderHeaderInfo_getAlphaFlags = get_alpha_flags_fn.value();
+    AImageDecoder_setAndroidBitmapFormat = set_format_fn.value();
+    AImageDecoder_setTargetSize = set_target_size_fn.value();
+    AImageDecoder_decodeImage = decode_image_fn.value();
+    resolved = true;
+  } else {
+    resolved = false;
+  }
+  return resolved.value();
+}
+
+}  // namespace
+
 static fml::jni::ScopedJavaGlobalRef<jclass>* g_flutter_jni_class = nullptr;
 static jmethodID g_decode_image_method = nullptr;
 
@@ -44,7 +149,17 @@ const ImageGenerator::FrameInfo AndroidImageGenerator::GetFrameInfo(
 }
 
 SkISize AndroidImageGenerator::GetScaledDimensions(float desired_scale) {
-  return GetInfo().dimensions();
+  SkISize dimensions = GetInfo().dimensions();
+  if (!use_native_decoder_ || desired_scale >= 1.0f || dimensions.isEmpty()) {
+    return dimensions;
+  }
+  // AImageDecoder decodes straight to an arbitrary smaller target size, so
+  // any downscale can be honored without an intermediate full-size bitmap.
+  return SkISize::Make(
+      std::max(1, static_cast<int32_t>(
+                      std::round(dimensions.width() * desired_scale))),
+      std::max(1, static_cast<int32_t>(
+                      std::round(dimensions.height() * desired_scale))));
 }
 
 bool AndroidImageGenerator::GetPixels(const SkImageInfo& info,
@@ -52,6 +167,12 @@ bool AndroidImageGenerator::GetPixels(const SkImageInfo& info,
                                       size_t row_bytes,
                                       unsigned int frame_index,
                                       std::optional<unsigned int> prior_frame) {
+  header_decoded_latch_.Wait();
+
+  if (use_native_decoder_) {
+    return DecodePixelsNative(info, pixels, row_bytes);
+  }
+
   fully_decoded_latch_.Wait();
 
   if (!software_decoded_data_) {
@@ -84,12 +205,91 @@ bool AndroidImageGenerator::GetPixels(const SkImageInfo& info,
 }
 
 void AndroidImageGenerator::DecodeImage() {
-  DoDecodeImage();
+  // Prefer the NDK decoder: it runs entirely on this thread with no JNI
+  // marshalling or platform thread involvement, and pixel decodes happen
+  // lazily, direct to the destination buffer, in |DecodePixelsNative|.
+  if (DoDecodeImageHeaderNative()) {
+    use_native_decoder_ = true;
+  } else {
+    DoDecodeImage();
+  }
 
   header_decoded_latch_.Signal();
   fully_decoded_latch_.Signal();
 }
 
+bool AndroidImageGenerator::DoDecodeImageHeaderNative() {
+  if (!ResolveAImageDecoderSymbols()) {
+    return false;
+  }
+
+  AImageDecoder* decoder = nullptr;
+  if (AImageDecoder_createFromBuffer(data_->data(), data_->size(), &decoder) !=
+          kAImageDecoderSuccess ||
+      decoder == nullptr) {
+    return false;
+  }
+  const AImageDecoderHeaderInfo* header = AImageDecoder_getHeaderInfo(decoder);
+  int32_t width = AImageDecoderHeaderInfo_getWidth(header);
+  int32_t height = AImageDecoderHeaderInfo_getHeight(header);
+  bool opaque = AImageDecoderHeaderInfo_getAlphaFlags(header) ==
+                kAndroidBitmapFlagsAlphaOpaque;
+  AImageDecoder_delete(decoder);
+
+  if (width <= 0 || height <= 0) {
+    return false;
+  }
+  image_info_ = SkImageInfo::Make(
+      width, height, kRGBA_8888_SkColorType,
+      opaque ? kOpaque_SkAlphaType : kPremul_SkAlphaType);
+  return true;
+}
+
+bool AndroidImageGenerator::DecodePixelsNative(const SkImageInfo& info,
+                                               void* pixels,
+                                               size_t row_bytes) {
+  if (kRGBA_8888_SkColorType != info.colorType()) {
+    return false;
+  }
+
+  switch (info.alphaType()) {
+    case kOpaque_SkAlphaType:
+      if (kOpaque_SkAlphaType != image_info_.alphaType()) {
+        return false;
+      }
+      break;
+    case kPremul_SkAlphaType:
+      break;
+    default:
+      return false;
+  }
+
+  // A fresh decoder is created per decode: decoder handles are not thread
+  // safe and multiple frames may be requested concurrently from the worker
+  // pool.
+  AImageDecoder* decoder = nullptr;
+  if (AImageDecoder_createFromBuffer(data_->data(), data_->size(), &decoder) !=
+          kAImageDecoderSuccess ||
+      decoder == nullptr) {
+    return false;
+  }
+  bool success = AImageDecoder_setAndroidBitmapFormat(
+                     decoder, ANDROID_BITMAP_FORMAT_RGBA_8888) ==
+                 kAImageDecoderSuccess;
+  if (success && info.dimensions() != image_info_.dimensions()) {
+    success = AImageDecoder_setTargetSize(decoder, info.width(),
+                                          info.height()) ==
+              kAImageDecoderSuccess;
+  }
+  if (success) {
+    success = AImageDecoder_decodeImage(decoder, pixels, row_bytes,
+                                        row_bytes * info.height()) ==
+              kAImageDecoderSuccess;
+  }
+  AImageDecoder_delete(decoder);
+  return success;
+}
+
 void AndroidImageGenerator::DoDecodeImage() {
   FML_DCHECK(g_flutter_jni_class);
   FML_DCHECK(g_decode_image_method);
@@ -64,6 +64,11 @@ class AndroidImageGenerator : public ImageGenerator {
 
   SkImageInfo image_info_;
 
+  /// Whether decoding uses the NDK AImageDecoder (API 30+) instead of the
+  /// JNI android.graphics.BitmapFactory path. Written before the header latch
+  /// is signaled and read-only afterwards.
+  bool use_native_decoder_ = false;
+
   /// Blocks until the header of the image has been decoded and the image
   /// dimensions have been determined.
   fml::ManualResetWaitableEvent header_decoded_latch_;
@@ -73,6 +78,17 @@ class AndroidImageGenerator : public ImageGenerator {
 
   void DoDecodeImage();
 
+  /// Decodes only the image header with AImageDecoder and fills
+  /// `image_info_`. Returns false when the decoder is unavailable on this
+  /// device or rejects the data, in which case the JNI path is used.
+  bool DoDecodeImageHeaderNative();
+
+  /// Decodes directly into `pixels` with AImageDecoder, downscaling natively
+  /// when the requested dimensions are smaller than the image.
+  bool DecodePixelsNative(const SkImageInfo& info,
+                          void* pixels,
+                          size_t row_bytes);
+
   bool IsValidImageData();
 
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(AndroidImageGenerator);
@@ -0,0 +1,120 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/android/android_performance_hint.h"
+
+#include <optional>
+
+#include "flutter/fml/native_library.h"
+
+// Only available on API 33+.
+typedef void APerformanceHintManager;
+typedef void APerformanceHintSession;
+typedef APerformanceHintManager* (*APerformanceHint_getManager_FPN)();
+typedef APerformanceHintSession* (*APerformanceHint_createSession_FPN)(
+    APerformanceHintManager* manager,
+    const int32_t* thread_ids,
+    size_t size,
+    int64_t initial_target_work_duration_nanos);
+typedef int (*APerformanceHint_updateTargetWorkDuration_FPN)(
+    APerformanceHintSession* session,
+    int64_t target_duration_nanos);
+typedef int (*APerformanceHint_reportActualWorkDuration_FPN)(
+    APerformanceHintSession* session,
+    int64_t actual_duration_nanos);
+typedef void (*APerformanceHint_closeSession_FPN)(
+    APerformanceHintSession* session);
+static APerformanceHint_getManager_FPN APerformanceHint_getManager;
+static APerformanceHint_createSession_FPN APerformanceHint_createSession;
+static APerformanceHint_updateTargetWorkDuration_FPN
+    APerformanceHint_updateTargetWorkDuration;
+static APerformanceHint_reportActualWorkDuration_FPN
+    APerformanceHint_reportActualWorkDuration;
+static APerformanceHint_closeSession_FPN APerformanceHint_closeSession;
+
+namespace flutter {
+
+bool AndroidPerformanceHint::IsSupported() {
+  static std::optional<bool> supported;
+  if (supported) {
+    return supported.value();
+  }
+  supported = false;
+  auto libandroid = fml::NativeLibrary::Create("libandroid.so");
+  if (!libandroid) {
+    return false;
+  }
+  auto get_manager_fn =
+      libandroid->ResolveFunction<APerformanceHint_getManager_FPN>(
+          "APerformanceHint_getManager");
+  auto create_session_fn =
+      libandroid->ResolveFunction<APerformanceHint_createSession_FPN>(
+          "APerformanceHint_createSession");
+  auto update_target_fn =
+      libandroid->ResolveFunction<APerformanceHint_updateTargetWorkDuration_FPN>(
+          "APerformanceHint_updateTargetWorkDuration");
+  auto report_actual_fn =
+      libandroid->ResolveFunction<APerformanceHint_reportActualWorkDuration_FPN>(
+          "APerformanceHint_reportActualWorkDuration");
+  auto close_session_fn =
+      libandroid->ResolveFunction<APerformanceHint_closeSession_FPN>(
+          "APerformanceHint_closeSession");
+  if (get_manager_fn && create_session_fn && update_target_fn &&
+      report_actual_fn && close_session_fn) {
+    APerformanceHint_getManager = get_manager_fn.value();
+    APerformanceHint_createSession = create_session_fn.value();
+    APerformanceHint_updateTargetWorkDuration = update_target_fn.value();
+    APerformanceHint_reportActualWorkDuration = report_actual_fn.value();
+    APerformanceHint_closeSession = close_session_fn.value();
+    supported = true;
+  }
+  return supported.value();
+}
+
+std::unique_ptr<AndroidPerformanceHint> AndroidPerformanceHint::Create(
+    const std::vector<int32_t>& thread_ids,
+    int64_t target_duration_ns) {
+  if (!IsSupported() || thread_ids.empty()) {
+    return nullptr;
+  }
+  APerformanceHintManager* manager = APerformanceHint_getManager();
+  if (!manager) {
+    return nullptr;
+  }
+  APerformanceHintSession* session = APerformanceHint_createSession(
+      manager, thread_ids.data(), thread_ids.size(), target_duration_ns);
+  if (!session) {
+    return nullptr;
+  }
+  return std::unique_ptr<AndroidPerformanceHint>(
+      new AndroidPerformanceHint(session, target_duration_ns));
+}
+
+AndroidPerformanceHint::AndroidPerformanceHint(void* session,
+                                               int64_t target_duration_ns)
+    : session_(session), target_duration_ns_(target_duration_ns) {}
+
+AndroidPerformanceHint::~AndroidPerformanceHint() {
+  APerformanceHint_closeSession(
+      static_cast<APerformanceHintSession*>(session_));
+}
+
+void AndroidPerformanceHint::UpdateTargetDuration(int64_t target_duration_ns) {
+  if (target_duration_ns == target_duration_ns_ || target_duration_ns <= 0) {
+    return;
+  }
+  target_duration_ns_ = target_duration_ns;
+  APerformanceHint_updateTargetWorkDuration(
+      static_cast<APerformanceHintSession*>(session_), target_duration_ns);
+}
+
+void AndroidPerformanceHint::ReportActualDuration(int64_t actual_duration_ns) {
+  if (actual_duration_ns <= 0) {
+    return;
+  }
+  APerformanceHint_reportActualWorkDuration(
+      static_cast<APerformanceHintSession*>(session_), actual_duration_ns);
+}
+
+}  // namespace flutter
@@ -0,0 +1,70 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_PERFORMANCE_HINT_H_
+#define FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_PERFORMANCE_HINT_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// A performance hint session over the NDK APerformanceHint API (API 33+).
+///
+/// The session tells the scheduler which threads produce frames, how long a
+/// frame may take, and how long each frame actually took, so CPU clocks are
+/// raised before a deadline is missed rather than after the resulting jank.
+///
+class AndroidPerformanceHint {
+ public:
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the performance hint entry points are available on
+  ///             this device. The symbols ship with API 33.
+  ///
+  static bool IsSupported();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a session covering the given threads. Returns nullptr
+  ///             when the API is unavailable or the system refuses the
+  ///             session.
+  ///
+  /// @param[in]  thread_ids          Kernel thread ids of the threads doing
+  ///                                 the frame work.
+  /// @param[in]  target_duration_ns  The initial per-frame budget, typically
+  ///                                 one vsync interval.
+  ///
+  static std::unique_ptr<AndroidPerformanceHint> Create(
+      const std::vector<int32_t>& thread_ids,
+      int64_t target_duration_ns);
+
+  ~AndroidPerformanceHint();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Updates the per-frame budget. No-op when the target has not
+  ///             changed, so this is cheap to call every frame with the
+  ///             current vsync interval.
+  ///
+  void UpdateTargetDuration(int64_t target_duration_ns);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Reports how long the frame that just finished actually took.
+  ///
+  void ReportActualDuration(int64_t actual_duration_ns);
+
+ private:
+  AndroidPerformanceHint(void* session, int64_t target_duration_ns);
+
+  void* session_;
+  int64_t target_duration_ns_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AndroidPerformanceHint);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_PERFORMANCE_HINT_H_
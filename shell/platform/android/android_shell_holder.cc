@@ -10,11 +10,13 @@
 #include <sys/resource.h>
 #include <sys/time.h>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
@@ -27,8 +29,10 @@
 #include "flutter/shell/common/thread_host.h"
 #include "flutter/shell/platform/android/android_display.h"
 #include "flutter/shell/platform/android/android_image_generator.h"
+#include "flutter/shell/platform/android/android_performance_hint.h"
 #include "flutter/shell/platform/android/context/android_context.h"
 #include "flutter/shell/platform/android/platform_view_android.h"
+#include "flutter/shell/platform/android/vsync_waiter_android.h"
 
 namespace flutter {
 
@@ -38,6 +42,10 @@ static void AndroidPlatformThreadConfigSetter(
     const fml::Thread::ThreadConfig& config) {
   // set thread name
   fml::Thread::SetCurrentThreadName(config);
+  // Pin the thread to its preferred core class so the scheduler does not
+  // migrate frame-critical threads onto efficiency cores mid-scroll. Best
+  // effort: homogeneous devices and restricted OEM kernels are left alone.
+  fml::Thread::TrySetCurrentThreadAffinity(config.affinity);
   // set thread priority
   switch (config.priority) {
     case fml::Thread::ThreadPriority::BACKGROUND: {
@@ -77,6 +85,43 @@ static PlatformData GetDefaultPlatformData() {
   return platform_data;
 }
 
+// The pre-warm pool. Entries are constructed and claimed on the platform
+// thread; the lock only defends against misuse.
+static std::mutex g_prewarm_pool_mutex;
+static std::vector<AndroidShellHolder::Prewarmed>& GetPrewarmPool() {
+  static std::vector<AndroidShellHolder::Prewarmed>* pool =
+      new std::vector<AndroidShellHolder::Prewarmed>();
+  return *pool;
+}
+
+void AndroidShellHolder::Prewarm(
+    size_t count,
+    const std::function<std::shared_ptr<PlatformViewAndroidJNI>()>&
+        facade_factory,
+    const flutter::Settings& settings) {
+  for (size_t i = 0; i < count; i++) {
+    auto jni_facade = facade_factory();
+    auto holder = std::make_unique<AndroidShellHolder>(settings, jni_facade);
+    if (!holder->IsValid()) {
+      FML_LOG(ERROR) << "Could not pre-warm an Android shell.";
+      return;
+    }
+    std::scoped_lock lock(g_prewarm_pool_mutex);
+    GetPrewarmPool().push_back({std::move(holder), std::move(jni_facade)});
+  }
+}
+
+std::optional<AndroidShellHolder::Prewarmed> AndroidShellHolder::Claim() {
+  std::scoped_lock lock(g_prewarm_pool_mutex);
+  auto& pool = GetPrewarmPool();
+  if (pool.empty()) {
+    return std::nullopt;
+  }
+  Prewarmed prewarmed = std::move(pool.back());
+  pool.pop_back();
+  return prewarmed;
+}
+
 AndroidShellHolder::AndroidShellHolder(
     flutter::Settings settings,
     std::shared_ptr<PlatformViewAndroidJNI> jni_facade)
@@ -87,20 +132,9 @@ AndroidShellHolder::AndroidShellHolder(
   auto mask =
       ThreadHost::Type::UI | ThreadHost::Type::RASTER | ThreadHost::Type::IO;
 
-  flutter::ThreadHost::ThreadHostConfig host_config(
-      thread_label, mask, AndroidPlatformThreadConfigSetter);
-  host_config.ui_config = fml::Thread::ThreadConfig(
-      flutter::ThreadHost::ThreadHostConfig::MakeThreadName(
-          flutter::ThreadHost::Type::UI, thread_label),
-      fml::Thread::ThreadPriority::DISPLAY);
-  host_config.raster_config = fml::Thread::ThreadConfig(
-      flutter::ThreadHost::ThreadHostConfig::MakeThreadName(
-          flutter::ThreadHost::Type::RASTER, thread_label),
-      fml::Thread::ThreadPriority::RASTER);
-  host_config.io_config = fml::Thread::ThreadConfig(
-      flutter::ThreadHost::ThreadHostConfig::MakeThreadName(
-          flutter::ThreadHost::Type::IO, thread_label),
-      fml::Thread::ThreadPriority::NORMAL);
+  flutter::ThreadHost::ThreadHostConfig host_config =
+      flutter::ThreadHost::ThreadHostConfig::MakeFrameCriticalProfile(
+          thread_label, mask, AndroidPlatformThreadConfigSetter);
 
   thread_host_ = std::make_shared<ThreadHost>(host_config);
 
@@ -147,10 +181,38 @@ AndroidShellHolder::AndroidShellHolder(
                                     io_runner         // io
   );
 
+  // Report per-frame work durations to the scheduler through an ADPF hint
+  // session so CPU clocks ramp up before a frame deadline is missed instead
+  // of after the jank. The session is created asynchronously below once the
+  // UI and raster thread ids are known; until then the callback is a no-op.
+  flutter::Settings shell_settings = settings_;
+  std::shared_ptr<std::unique_ptr<AndroidPerformanceHint>> hint_session;
+  if (AndroidPerformanceHint::IsSupported()) {
+    hint_session = std::make_shared<std::unique_ptr<AndroidPerformanceHint>>();
+    auto existing_callback = shell_settings.frame_rasterized_callback;
+    shell_settings.frame_rasterized_callback =
+        [hint_session, existing_callback](const FrameTiming& timing) {
+          if (existing_callback) {
+            existing_callback(timing);
+          }
+          if (auto& session = *hint_session) {
+            // The budget tracks the vsync interval so display mode switches
+            // (e.g. 60Hz <-> 120Hz) adjust the target; the update is a no-op
+            // when the interval has not changed.
+            session->UpdateTargetDuration(
+                VsyncWaiterAndroid::GetRefreshPeriodNanos());
+            session->ReportActualDuration(
+                (timing.Get(FrameTiming::kRasterFinish) -
+                 timing.Get(FrameTiming::kBuildStart))
+                    .ToNanoseconds());
+          }
+        };
+  }
+
   shell_ =
       Shell::Create(GetDefaultPlatformData(),  // window data
                     task_runners,              // task runners
-                    settings_,                 // settings
+                    shell_settings,            // settings
                     on_create_platform_view,   // platform view create callback
                     on_create_rasterizer       // rasterizer create callback
       );
@@ -168,6 +230,23 @@ AndroidShellHolder::AndroidShellHolder(
         },
         -1);
     FML_DLOG(INFO) << "Registered Android SDK image decoder (API level 28+)";
+
+    if (hint_session) {
+      // The session must name the kernel ids of the frame-producing threads,
+      // so collect them on their own threads: first the UI thread, which then
+      // hands off to the raster thread where the session is created. The
+      // frame_rasterized_callback also runs on the raster thread, so the
+      // session pointer is only ever touched from there.
+      ui_runner->PostTask([hint_session, raster_runner]() {
+        int32_t ui_tid = gettid();
+        raster_runner->PostTask([hint_session, ui_tid]() {
+          std::vector<int32_t> thread_ids = {ui_tid,
+                                             static_cast<int32_t>(gettid())};
+          *hint_session = AndroidPerformanceHint::Create(
+              thread_ids, VsyncWaiterAndroid::GetRefreshPeriodNanos());
+        });
+      });
+    }
   }
 
   platform_view_ = weak_platform_view;
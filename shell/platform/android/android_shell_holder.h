@@ -5,7 +5,9 @@
 #ifndef FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_SHELL_HOLDER_H_
 #define FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_SHELL_HOLDER_H_
 
+#include <functional>
 #include <memory>
+#include <optional>
 
 #include "flutter/assets/asset_manager.h"
 #include "flutter/fml/macros.h"
@@ -46,6 +48,39 @@ class AndroidShellHolder {
 
   ~AndroidShellHolder();
 
+  //----------------------------------------------------------------------------
+  /// @brief      An entry in the pre-warm pool: a fully constructed holder
+  ///             plus the JNI facade it was built with, so the claimant can
+  ///             rebind that facade to a live FlutterJNI instance.
+  ///
+  struct Prewarmed {
+    std::unique_ptr<AndroidShellHolder> holder;
+    std::shared_ptr<PlatformViewAndroidJNI> jni_facade;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Constructs holders ahead of need so the first FlutterView
+  ///             attach does not pay for thread creation, VM startup and
+  ///             Shell construction.
+  ///
+  /// @details    Must be called on the thread that will serve as the platform
+  ///             thread of the claimed engines, i.e. the Android main thread.
+  ///             The facades produced by `facade_factory` should hold an
+  ///             empty JNI reference so their callbacks no-op until a
+  ///             FlutterJNI claims the holder and rebinds them.
+  ///
+  static void Prewarm(
+      size_t count,
+      const std::function<std::shared_ptr<PlatformViewAndroidJNI>()>&
+          facade_factory,
+      const flutter::Settings& settings);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Claims a pre-warmed holder, or std::nullopt when the pool is
+  ///             empty and the caller must construct one itself.
+  ///
+  static std::optional<Prewarmed> Claim();
+
   bool IsValid() const;
 
   //----------------------------------------------------------------------------
@@ -159,6 +159,11 @@ bool AndroidSurfaceGLSkia::GLContextPresent(const GLPresentInfo& present_info) {
   if (present_info.presentation_time) {
     onscreen_surface_->SetPresentationTime(*present_info.presentation_time);
   }
+  if (present_info.frame_damage_rects != nullptr &&
+      !present_info.frame_damage_rects->empty()) {
+    return onscreen_surface_->SwapBuffers(*present_info.frame_damage_rects,
+                                          present_info.frame_damage);
+  }
   return onscreen_surface_->SwapBuffers(present_info.frame_damage);
 }
 
@@ -4,6 +4,7 @@
 
 #include "flutter/shell/platform/android/android_surface_software.h"
 
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -102,7 +103,8 @@ sk_sp<SkSurface> AndroidSurfaceSoftware::AcquireBackingStore(
 }
 
 bool AndroidSurfaceSoftware::PresentBackingStore(
-    sk_sp<SkSurface> backing_store) {
+    sk_sp<SkSurface> backing_store,
+    const std::vector<SkIRect>& damage_rects) {
   TRACE_EVENT0("flutter", "AndroidSurfaceSoftware::PresentBackingStore");
   if (!IsValid() || backing_store == nullptr) {
     return false;
@@ -113,28 +115,77 @@ bool AndroidSurfaceSoftware::PresentBackingStore(
     return false;
   }
 
+  // When the damage is known, lock only its bounding rectangle so that rows
+  // outside of it are neither copied nor flushed. The system may grow the
+  // rectangle to cover rows this back buffer has not seen since it was last
+  // posted; the copy below uses the grown rectangle.
+  SkIRect damage_bounds = SkIRect::MakeEmpty();
+  for (const SkIRect& rect : damage_rects) {
+    damage_bounds.join(rect);
+  }
+  const bool damage_known = !damage_rects.empty();
+  if (damage_known && damage_bounds.isEmpty()) {
+    // Nothing changed since the last frame.
+    return true;
+  }
+
+  ARect dirty_rect = {damage_bounds.left(), damage_bounds.top(),
+                      damage_bounds.right(), damage_bounds.bottom()};
+
   ANativeWindow_Buffer native_buffer;
-  if (ANativeWindow_lock(native_window_->handle(), &native_buffer, nullptr)) {
+  if (ANativeWindow_lock(native_window_->handle(), &native_buffer,
+                         damage_known ? &dirty_rect : nullptr)) {
     return false;
   }
 
+  bool copied = false;
+
   SkColorType color_type;
   SkAlphaType alpha_type;
   if (GetSkColorType(native_buffer.format, &color_type, &alpha_type)) {
-    SkImageInfo native_image_info = SkImageInfo::Make(
-        native_buffer.width, native_buffer.height, color_type, alpha_type);
-
-    std::unique_ptr<SkCanvas> canvas = SkCanvas::MakeRasterDirect(
-        native_image_info, native_buffer.bits,
-        native_buffer.stride * SkColorTypeBytesPerPixel(color_type));
-
-    if (canvas) {
-      SkBitmap bitmap;
-      if (bitmap.installPixels(pixmap)) {
-        canvas->drawImageRect(
-            bitmap.asImage(),
-            SkRect::MakeIWH(native_buffer.width, native_buffer.height),
-            SkSamplingOptions());
+    if (damage_known && color_type == pixmap.colorType() &&
+        native_buffer.width == pixmap.width() &&
+        native_buffer.height == pixmap.height()) {
+      SkIRect copy_rect = SkIRect::MakeLTRB(dirty_rect.left, dirty_rect.top,
+                                            dirty_rect.right, dirty_rect.bottom);
+      if (copy_rect.intersect(SkIRect::MakeWH(pixmap.width(), pixmap.height()))) {
+        // Copy only the dirty rows. The per-row memcpy compiles down to the
+        // widest vector loads and stores available on the target.
+        const size_t bytes_per_pixel = SkColorTypeBytesPerPixel(color_type);
+        const size_t dst_row_bytes = native_buffer.stride * bytes_per_pixel;
+        const size_t copy_bytes = copy_rect.width() * bytes_per_pixel;
+        const uint8_t* src = static_cast<const uint8_t*>(
+            pixmap.addr(copy_rect.left(), copy_rect.top()));
+        uint8_t* dst = static_cast<uint8_t*>(native_buffer.bits) +
+                       copy_rect.top() * dst_row_bytes +
+                       copy_rect.left() * bytes_per_pixel;
+        for (int y = 0; y < copy_rect.height(); y++) {
+          memcpy(dst, src, copy_bytes);
+          src += pixmap.rowBytes();
+          dst += dst_row_bytes;
+        }
+      }
+      copied = true;
+    }
+
+    if (!copied) {
+      // Unknown damage or a format/size mismatch: blit the entire backing
+      // store through Skia, which also performs the pixel conversion.
+      SkImageInfo native_image_info = SkImageInfo::Make(
+          native_buffer.width, native_buffer.height, color_type, alpha_type);
+
+      std::unique_ptr<SkCanvas> canvas = SkCanvas::MakeRasterDirect(
+          native_image_info, native_buffer.bits,
+          native_buffer.stride * SkColorTypeBytesPerPixel(color_type));
+
+      if (canvas) {
+        SkBitmap bitmap;
+        if (bitmap.installPixels(pixmap)) {
+          canvas->drawImageRect(
+              bitmap.asImage(),
+              SkRect::MakeIWH(native_buffer.width, native_buffer.height),
+              SkSamplingOptions());
+        }
       }
     }
   }
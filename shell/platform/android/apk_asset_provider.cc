@@ -4,12 +4,15 @@
 
 #include "flutter/shell/platform/android/apk_asset_provider.h"
 
+#include <sys/mman.h>
 #include <unistd.h>
 
 #include <algorithm>
+#include <mutex>
 #include <sstream>
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/unique_fd.h"
 
 namespace flutter {
 
@@ -22,17 +25,76 @@ class APKAssetMapping : public fml::Mapping {
   size_t GetSize() const override { return AAsset_getLength(asset_); }
 
   const uint8_t* GetMapping() const override {
-    return reinterpret_cast<const uint8_t*>(AAsset_getBuffer(asset_));
+    // Deferred until first access so that compressed entries are inflated on
+    // the thread that consumes the asset (for example a worker warming it via
+    // AssetManager::PrefetchAll) instead of on the IO thread at open time.
+    std::call_once(inflated_flag_, [this]() {
+      buffer_ = reinterpret_cast<const uint8_t*>(AAsset_getBuffer(asset_));
+    });
+    return buffer_;
   }
 
   bool IsDontNeedSafe() const override { return !AAsset_isAllocated(asset_); }
 
  private:
   AAsset* const asset_;
+  mutable std::once_flag inflated_flag_;
+  mutable const uint8_t* buffer_ = nullptr;
 
   FML_DISALLOW_COPY_AND_ASSIGN(APKAssetMapping);
 };
 
+// A mapping of a stored (uncompressed) APK entry that maps the APK file
+// region directly instead of copying it into anonymous memory.
+class APKStoredAssetMapping : public fml::Mapping {
+ public:
+  static std::unique_ptr<APKStoredAssetMapping> Make(const fml::UniqueFD& fd,
+                                                     off64_t start,
+                                                     off64_t length) {
+    if (length <= 0) {
+      return nullptr;
+    }
+    const off64_t page_size = sysconf(_SC_PAGESIZE);
+    const off64_t aligned_start = start - (start % page_size);
+    const size_t map_size = static_cast<size_t>(length + start - aligned_start);
+    void* mapping = ::mmap64(nullptr, map_size, PROT_READ, MAP_PRIVATE,
+                             fd.get(), aligned_start);
+    if (mapping == MAP_FAILED) {
+      return nullptr;
+    }
+    return std::unique_ptr<APKStoredAssetMapping>(new APKStoredAssetMapping(
+        mapping, map_size, static_cast<size_t>(start - aligned_start),
+        static_cast<size_t>(length)));
+  }
+
+  ~APKStoredAssetMapping() override { ::munmap(mapping_, map_size_); }
+
+  size_t GetSize() const override { return length_; }
+
+  const uint8_t* GetMapping() const override {
+    return static_cast<const uint8_t*>(mapping_) + data_offset_;
+  }
+
+  bool IsDontNeedSafe() const override { return true; }
+
+ private:
+  APKStoredAssetMapping(void* mapping,
+                        size_t map_size,
+                        size_t data_offset,
+                        size_t length)
+      : mapping_(mapping),
+        map_size_(map_size),
+        data_offset_(data_offset),
+        length_(length) {}
+
+  void* const mapping_;
+  const size_t map_size_;
+  const size_t data_offset_;
+  const size_t length_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(APKStoredAssetMapping);
+};
+
 class APKAssetProviderImpl : public APKAssetProviderInternal {
  public:
   explicit APKAssetProviderImpl(JNIEnv* env,
@@ -55,6 +117,21 @@ class APKAssetProviderImpl : public APKAssetProviderInternal {
       return nullptr;
     }
 
+    // Stored (uncompressed) entries hand out a file descriptor into the APK;
+    // map that region directly so multi-megabyte assets are not copied.
+    off64_t start = 0;
+    off64_t length = 0;
+    fml::UniqueFD fd(AAsset_openFileDescriptor64(asset, &start, &length));
+    if (fd.is_valid()) {
+      auto mapping = APKStoredAssetMapping::Make(fd, start, length);
+      if (mapping) {
+        AAsset_close(asset);
+        return mapping;
+      }
+    }
+
+    // Compressed entries fall back to the inflating mapping, which defers
+    // decompression to the first access of the buffer.
     return std::make_unique<APKAssetMapping>(asset);
   };
 
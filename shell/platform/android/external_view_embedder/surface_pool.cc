@@ -27,10 +27,18 @@ std::shared_ptr<OverlayLayer> SurfacePool::GetLayer(
     const std::shared_ptr<PlatformViewAndroidJNI>& jni_facade,
     const std::shared_ptr<AndroidSurfaceFactory>& surface_factory) {
   std::lock_guard lock(mutex_);
-  // Destroy current layers in the pool if the frame size has changed.
+  // Retire the current layers under their size class if the frame size has
+  // changed, and revive any generation previously retired under the new size
+  // so its surfaces are reused as-is.
   if (requested_frame_size_ != current_frame_size_) {
-    DestroyLayersLocked(jni_facade);
+    RetireLayersLocked();
+    auto retired = retired_layers_.find(FrameSizeKey(requested_frame_size_));
+    if (retired != retired_layers_.end()) {
+      layers_ = std::move(retired->second.layers);
+      retired_layers_.erase(retired);
+    }
   }
+  ExpireRetiredLayersLocked();
   intptr_t gr_context_key = reinterpret_cast<intptr_t>(gr_context);
   // Allocate a new surface if there isn't one available.
   if (available_layer_index_ >= layers_.size()) {
@@ -78,11 +86,12 @@ std::shared_ptr<OverlayLayer> SurfacePool::GetLayer(
 void SurfacePool::RecycleLayers() {
   std::lock_guard lock(mutex_);
   available_layer_index_ = 0;
+  frame_count_++;
 }
 
 bool SurfacePool::HasLayers() {
   std::lock_guard lock(mutex_);
-  return !layers_.empty();
+  return !layers_.empty() || !retired_layers_.empty();
 }
 
 void SurfacePool::DestroyLayers(
@@ -93,14 +102,47 @@ void SurfacePool::DestroyLayers(
 
 void SurfacePool::DestroyLayersLocked(
     const std::shared_ptr<PlatformViewAndroidJNI>& jni_facade) {
-  if (layers_.empty()) {
+  if (layers_.empty() && retired_layers_.empty()) {
     return;
   }
   jni_facade->FlutterViewDestroyOverlaySurfaces();
   layers_.clear();
+  retired_layers_.clear();
+  available_layer_index_ = 0;
+}
+
+int64_t SurfacePool::FrameSizeKey(const SkISize& frame_size) {
+  return (static_cast<int64_t>(frame_size.width()) << 32) |
+         static_cast<uint32_t>(frame_size.height());
+}
+
+void SurfacePool::RetireLayersLocked() {
+  if (layers_.empty()) {
+    return;
+  }
+  RetiredLayers& retired = retired_layers_[FrameSizeKey(current_frame_size_)];
+  retired.retired_at_frame = frame_count_;
+  for (auto& layer : layers_) {
+    retired.layers.push_back(std::move(layer));
+  }
+  layers_.clear();
   available_layer_index_ = 0;
 }
 
+void SurfacePool::ExpireRetiredLayersLocked() {
+  for (auto it = retired_layers_.begin(); it != retired_layers_.end();) {
+    if (frame_count_ - it->second.retired_at_frame > kRetiredLayerFrameBudget) {
+      // Only the GPU surfaces are released here. The Java views backing these
+      // layers are already hidden by the platform side and are torn down with
+      // everything else in |DestroyLayers|, since there is no per-overlay
+      // destroy call.
+      it = retired_layers_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 std::vector<std::shared_ptr<OverlayLayer>> SurfacePool::GetUnusedLayers() {
   std::lock_guard lock(mutex_);
   std::vector<std::shared_ptr<OverlayLayer>> results;
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_SHELL_PLATFORM_ANDROID_EXTERNAL_VIEW_EMBEDDER_SURFACE_POOL_H_
 #define FLUTTER_SHELL_PLATFORM_ANDROID_EXTERNAL_VIEW_EMBEDDER_SURFACE_POOL_H_
 
+#include <cstdint>
+#include <map>
 #include <mutex>
 
 #include "flutter/flow/surface.h"
@@ -45,6 +47,11 @@ struct OverlayLayer {
 
 class SurfacePool {
  public:
+  // Number of frames a retired layer generation survives without being
+  // revived before its GPU surfaces are released. Two seconds at 60fps:
+  // enough to cover a keyboard or orientation round trip.
+  static constexpr uint64_t kRetiredLayerFrameBudget = 120;
+
   SurfacePool();
 
   ~SurfacePool();
@@ -69,8 +76,10 @@ class SurfacePool {
   void DestroyLayers(const std::shared_ptr<PlatformViewAndroidJNI>& jni_facade);
 
   // Sets the frame size used by the layers in the pool.
-  // If the current layers in the pool have a different frame size,
-  // then they are deallocated as soon as |GetLayer| is called.
+  // If the current layers in the pool have a different frame size, they are
+  // retired under their size class as soon as |GetLayer| is called, and
+  // revived with their surfaces intact when that frame size comes back
+  // within |kRetiredLayerFrameBudget| frames.
   void SetFrameSize(SkISize frame_size);
 
   // Returns true if the current pool has layers in use.
@@ -100,9 +109,31 @@ class SurfacePool {
   // The frame size to be used by future layers.
   SkISize requested_frame_size_;
 
+  // Layers retired on a frame size change, keyed by the size they were
+  // created for. Toggling back to a retired size (keyboard, orientation)
+  // revives the whole generation instead of paying the JNI round trip and
+  // surface setup again.
+  struct RetiredLayers {
+    // The value of `frame_count_` when the generation was retired.
+    uint64_t retired_at_frame = 0;
+    std::vector<std::shared_ptr<OverlayLayer>> layers;
+  };
+
+  std::map<int64_t, RetiredLayers> retired_layers_;
+
+  // Incremented once per frame by |RecycleLayers|. Used to age out retired
+  // layer generations.
+  uint64_t frame_count_ = 0;
+
   // Used to guard public methods.
   std::mutex mutex_;
 
+  static int64_t FrameSizeKey(const SkISize& frame_size);
+
+  void RetireLayersLocked();
+
+  void ExpireRetiredLayersLocked();
+
   void DestroyLayersLocked(
       const std::shared_ptr<PlatformViewAndroidJNI>& jni_facade);
 };
@@ -226,7 +226,7 @@ TEST(SurfacePool, DestroyLayers) {
   ASSERT_TRUE(pool->GetUnusedLayers().empty());
 }
 
-TEST(SurfacePool, DestroyLayersFrameSizeChanged) {
+TEST(SurfacePool, RetireLayersFrameSizeChanged) {
   auto pool = std::make_unique<SurfacePool>();
   auto jni_mock = std::make_shared<JNIMock>();
 
@@ -259,17 +259,35 @@ TEST(SurfacePool, DestroyLayersFrameSizeChanged) {
 
   ASSERT_TRUE(pool->HasLayers());
 
+  // The 10x10 generation is retired under its size class rather than
+  // destroyed; a new surface is created for the new size.
   pool->SetFrameSize(SkISize::Make(20, 20));
-  EXPECT_CALL(*jni_mock, FlutterViewDestroyOverlaySurfaces()).Times(1);
+  EXPECT_CALL(*jni_mock, FlutterViewDestroyOverlaySurfaces()).Times(0);
   EXPECT_CALL(*jni_mock, FlutterViewCreateOverlaySurface())
       .Times(1)
       .WillOnce(Return(
           ByMove(std::make_unique<PlatformViewAndroidJNI::OverlayMetadata>(
               1, window))));
-  pool->GetLayer(gr_context.get(), *android_context, jni_mock, surface_factory);
+  auto layer_20 = pool->GetLayer(gr_context.get(), *android_context, jni_mock,
+                                 surface_factory);
+  ASSERT_EQ(1, layer_20->id);
 
   ASSERT_TRUE(pool->GetUnusedLayers().empty());
   ASSERT_TRUE(pool->HasLayers());
+
+  pool->RecycleLayers();
+
+  // Toggling back to the retired size revives the generation with its
+  // surfaces intact: no new overlay is requested from the platform.
+  pool->SetFrameSize(SkISize::Make(10, 10));
+  auto layer_10 = pool->GetLayer(gr_context.get(), *android_context, jni_mock,
+                                 surface_factory);
+  ASSERT_EQ(0, layer_10->id);
+
+  // Teardown destroys the in-use and retired layers alike.
+  EXPECT_CALL(*jni_mock, FlutterViewDestroyOverlaySurfaces()).Times(1);
+  pool->DestroyLayers(jni_mock);
+  ASSERT_FALSE(pool->HasLayers());
 }
 
 }  // namespace testing
@@ -397,6 +397,21 @@ public class FlutterJNI {
 
   private native long nativeAttach(@NonNull FlutterJNI flutterJNI);
 
+  /**
+   * Pre-warms {@code count} native engines (threads created, VM started, shell constructed) so a
+   * later {@link #attachToNative()} claims one instantly instead of paying the full spin-up.
+   *
+   * <p>Must be invoked from the main thread, after {@code FlutterLoader} initialization, and before
+   * the engines are needed. Pre-warmed engines that are never claimed are retained for the lifetime
+   * of the process.
+   */
+  @UiThread
+  public static void prewarmEngines(int count) {
+    nativePrewarmEngines(count);
+  }
+
+  private static native void nativePrewarmEngines(int count);
+
   /**
    * Spawns a new FlutterJNI instance from the current instance.
    *
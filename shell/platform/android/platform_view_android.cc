@@ -13,6 +13,7 @@
 #include "flutter/shell/platform/android/android_context_gl_impeller.h"
 #include "flutter/shell/platform/android/android_context_gl_skia.h"
 #include "flutter/shell/platform/android/android_external_texture_gl.h"
+#include "flutter/shell/platform/android/android_external_texture_hardware_buffer.h"
 #include "flutter/shell/platform/android/android_surface_gl_impeller.h"
 #include "flutter/shell/platform/android/android_surface_gl_skia.h"
 #include "flutter/shell/platform/android/android_surface_software.h"
@@ -265,6 +266,22 @@ void PlatformViewAndroid::RegisterExternalTexture(
   }
 }
 
+void PlatformViewAndroid::RegisterHardwareBufferTexture(
+    int64_t texture_id,
+    std::shared_ptr<AndroidHardwareBufferProvider> provider) {
+  if (android_context_->RenderingApi() != AndroidRenderingAPI::kOpenGLES) {
+    FML_LOG(INFO) << "Attempted to use a GL texture in a non GL context.";
+    return;
+  }
+  if (!AndroidExternalTextureHardwareBuffer::IsSupported()) {
+    FML_LOG(INFO) << "Hardware buffer textures are not supported on this "
+                     "device.";
+    return;
+  }
+  RegisterTexture(std::make_shared<AndroidExternalTextureHardwareBuffer>(
+      texture_id, std::move(provider)));
+}
+
 // |PlatformView|
 std::unique_ptr<VsyncWaiter> PlatformViewAndroid::CreateVSyncWaiter() {
   return std::make_unique<VsyncWaiterAndroid>(task_runners_);
@@ -24,6 +24,8 @@
 
 namespace flutter {
 
+class AndroidHardwareBufferProvider;
+
 class AndroidSurfaceFactoryImpl : public AndroidSurfaceFactory {
  public:
   AndroidSurfaceFactoryImpl(const std::shared_ptr<AndroidContext>& context,
@@ -93,6 +95,16 @@ class PlatformViewAndroid final : public PlatformView {
       int64_t texture_id,
       const fml::jni::ScopedJavaGlobalRef<jobject>& surface_texture);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Registers an external texture fed by AHardwareBuffers
+  ///             instead of a SurfaceTexture. Only valid when the device
+  ///             supports hardware buffer import; see
+  ///             `AndroidExternalTextureHardwareBuffer::IsSupported`.
+  ///
+  void RegisterHardwareBufferTexture(
+      int64_t texture_id,
+      std::shared_ptr<AndroidHardwareBufferProvider> provider);
+
   // |PlatformView|
   void LoadDartDeferredLibrary(
       intptr_t loading_unit_id,
@@ -125,6 +125,14 @@ static jmethodID g_mutators_stack_push_cliprrect_method = nullptr;
 // Called By Java
 static jlong AttachJNI(JNIEnv* env, jclass clazz, jobject flutterJNI) {
   fml::jni::JavaObjectWeakGlobalRef java_object(env, flutterJNI);
+  if (auto prewarmed = AndroidShellHolder::Claim()) {
+    // The facade was constructed with an empty reference at pre-warm time so
+    // its callbacks have been no-ops; bind it to the attaching FlutterJNI
+    // before anything is launched.
+    static_cast<PlatformViewAndroidJNIImpl*>(prewarmed->jni_facade.get())
+        ->UpdateJavaObject(java_object);
+    return reinterpret_cast<jlong>(prewarmed->holder.release());
+  }
   std::shared_ptr<PlatformViewAndroidJNI> jni_facade =
       std::make_shared<PlatformViewAndroidJNIImpl>(java_object);
   auto shell_holder = std::make_unique<AndroidShellHolder>(
@@ -136,6 +144,19 @@ static jlong AttachJNI(JNIEnv* env, jclass clazz, jobject flutterJNI) {
   }
 }
 
+static void PrewarmEnginesJNI(JNIEnv* env, jclass clazz, jint count) {
+  if (count <= 0) {
+    return;
+  }
+  AndroidShellHolder::Prewarm(
+      static_cast<size_t>(count),
+      []() -> std::shared_ptr<PlatformViewAndroidJNI> {
+        return std::make_shared<PlatformViewAndroidJNIImpl>(
+            fml::jni::JavaObjectWeakGlobalRef());
+      },
+      FlutterMain::Get().GetSettings());
+}
+
 static void DestroyJNI(JNIEnv* env, jobject jcaller, jlong shell_holder) {
   delete ANDROID_SHELL_HOLDER;
 }
@@ -647,6 +668,11 @@ bool RegisterApi(JNIEnv* env) {
           .signature = "(Lio/flutter/embedding/engine/FlutterJNI;)J",
           .fnPtr = reinterpret_cast<void*>(&AttachJNI),
       },
+      {
+          .name = "nativePrewarmEngines",
+          .signature = "(I)V",
+          .fnPtr = reinterpret_cast<void*>(&PrewarmEnginesJNI),
+      },
       {
           .name = "nativeDestroy",
           .signature = "(J)V",
@@ -1137,6 +1163,11 @@ PlatformViewAndroidJNIImpl::PlatformViewAndroidJNIImpl(
 
 PlatformViewAndroidJNIImpl::~PlatformViewAndroidJNIImpl() = default;
 
+void PlatformViewAndroidJNIImpl::UpdateJavaObject(
+    const fml::jni::JavaObjectWeakGlobalRef& java_object) {
+  java_object_ = java_object;
+}
+
 void PlatformViewAndroidJNIImpl::FlutterViewHandlePlatformMessage(
     std::unique_ptr<flutter::PlatformMessage> message,
     int responseId) {
@@ -1415,12 +1446,11 @@ void PlatformViewAndroidJNIImpl::FlutterViewOnDisplayPlatformView(
   jobject mutatorsStack = env->NewObject(g_mutators_stack_class->obj(),
                                          g_mutators_stack_init_method);
 
-  std::vector<std::shared_ptr<Mutator>>::const_iterator iter =
-      mutators_stack.Begin();
+  std::vector<Mutator>::const_iterator iter = mutators_stack.Begin();
   while (iter != mutators_stack.End()) {
-    switch ((*iter)->GetType()) {
+    switch (iter->GetType()) {
       case kTransform: {
-        const SkMatrix& matrix = (*iter)->GetMatrix();
+        const SkMatrix& matrix = iter->GetMatrix();
         SkScalar matrix_array[9];
         matrix.get9(matrix_array);
         fml::jni::ScopedJavaLocalRef<jfloatArray> transformMatrix(
@@ -1433,7 +1463,7 @@ void PlatformViewAndroidJNIImpl::FlutterViewOnDisplayPlatformView(
         break;
       }
       case kClipRect: {
-        const SkRect& rect = (*iter)->GetRect();
+        const SkRect& rect = iter->GetRect();
         env->CallVoidMethod(
             mutatorsStack, g_mutators_stack_push_cliprect_method,
             static_cast<int>(rect.left()), static_cast<int>(rect.top()),
@@ -1441,7 +1471,7 @@ void PlatformViewAndroidJNIImpl::FlutterViewOnDisplayPlatformView(
         break;
       }
       case kClipRRect: {
-        const SkRRect& rrect = (*iter)->GetRRect();
+        const SkRRect& rrect = iter->GetRRect();
         const SkRect& rect = rrect.rect();
         const SkVector& upper_left = rrect.radii(SkRRect::kUpperLeft_Corner);
         const SkVector& upper_right = rrect.radii(SkRRect::kUpperRight_Corner);
@@ -84,9 +84,20 @@ class PlatformViewAndroidJNIImpl final : public PlatformViewAndroidJNI {
 
   bool RequestDartDeferredLibrary(int loading_unit_id) override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Rebinds this facade to another FlutterJNI instance.
+  ///
+  /// @details    Used when a pre-warmed AndroidShellHolder, constructed with
+  ///             an empty reference so every callback no-ops, is claimed by an
+  ///             attaching FlutterJNI. Must be called before the engine is
+  ///             launched; the reference is not synchronized against
+  ///             concurrent callbacks.
+  ///
+  void UpdateJavaObject(const fml::jni::JavaObjectWeakGlobalRef& java_object);
+
  private:
   // Reference to FlutterJNI object.
-  const fml::jni::JavaObjectWeakGlobalRef java_object_;
+  fml::jni::JavaObjectWeakGlobalRef java_object_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(PlatformViewAndroidJNIImpl);
 };
@@ -66,6 +66,11 @@ void VsyncWaiterAndroid::OnVsyncFromNDK(int64_t frame_nanos, void* data) {
   ConsumePendingCallback(weak_this, frame_time, target_time);
 }
 
+// static
+int64_t VsyncWaiterAndroid::GetRefreshPeriodNanos() {
+  return static_cast<int64_t>(1000000000.0 / g_refresh_rate_);
+}
+
 // static
 void VsyncWaiterAndroid::OnVsyncFromJava(JNIEnv* env,
                                          jclass jcaller,
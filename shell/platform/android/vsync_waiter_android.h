@@ -24,6 +24,13 @@ class VsyncWaiterAndroid final : public VsyncWaiter {
 
   ~VsyncWaiterAndroid() override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The current vsync interval in nanoseconds, derived from the
+  ///             refresh rate last reported by the Java display listener.
+  ///             Tracks display mode switches. Safe to call from any thread.
+  ///
+  static int64_t GetRefreshPeriodNanos();
+
  private:
   // |VsyncWaiter|
   void AwaitVSync() override;
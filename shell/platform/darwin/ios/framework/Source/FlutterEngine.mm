@@ -1138,10 +1138,19 @@ static void SetEntryPoint(flutter::Settings* settings, NSString* entrypoint, NSS
                                 callback(reply);
                               },
                               _shell->GetTaskRunners().GetPlatformTaskRunner());
-  std::unique_ptr<flutter::PlatformMessage> platformMessage =
-      (message == nil) ? std::make_unique<flutter::PlatformMessage>(channel.UTF8String, response)
-                       : std::make_unique<flutter::PlatformMessage>(
-                             channel.UTF8String, flutter::CopyNSDataToMapping(message), response);
+  std::unique_ptr<flutter::PlatformMessage> platformMessage;
+  if (message == nil) {
+    platformMessage = std::make_unique<flutter::PlatformMessage>(channel.UTF8String, response);
+  } else if (message.length > flutter::kSharedPlatformMessageSizeThreshold) {
+    // Large payloads (camera frames, file transfers) travel to Dart as a
+    // retained reference to the immutable NSData instead of being copied at
+    // the boundary; the retain is released when the Dart view is collected.
+    platformMessage = std::make_unique<flutter::PlatformMessage>(
+        channel.UTF8String, flutter::ConvertNSDataToMappingPtr(message), response);
+  } else {
+    platformMessage = std::make_unique<flutter::PlatformMessage>(
+        channel.UTF8String, flutter::CopyNSDataToMapping(message), response);
+  }
 
   _shell->GetPlatformView()->DispatchPlatformMessage(std::move(platformMessage));
   // platformMessage takes ownership of response.
@@ -391,10 +391,10 @@ std::vector<DisplayListBuilder*> FlutterPlatformViewsController::GetCurrentBuild
 }
 
 int FlutterPlatformViewsController::CountClips(const MutatorsStack& mutators_stack) {
-  std::vector<std::shared_ptr<Mutator>>::const_reverse_iterator iter = mutators_stack.Bottom();
+  std::vector<Mutator>::const_reverse_iterator iter = mutators_stack.Bottom();
   int clipCount = 0;
   while (iter != mutators_stack.Top()) {
-    if ((*iter)->IsClipType()) {
+    if (iter->IsClipType()) {
       clipCount++;
     }
     ++iter;
@@ -429,32 +429,32 @@ void FlutterPlatformViewsController::ApplyMutators(const MutatorsStack& mutators
 
   auto iter = mutators_stack.Begin();
   while (iter != mutators_stack.End()) {
-    switch ((*iter)->GetType()) {
+    switch (iter->GetType()) {
       case kTransform: {
-        CATransform3D transform = GetCATransform3DFromSkMatrix((*iter)->GetMatrix());
+        CATransform3D transform = GetCATransform3DFromSkMatrix(iter->GetMatrix());
         finalTransform = CATransform3DConcat(transform, finalTransform);
         break;
       }
       case kClipRect:
-        [maskView clipRect:(*iter)->GetRect() matrix:finalTransform];
+        [maskView clipRect:iter->GetRect() matrix:finalTransform];
         break;
       case kClipRRect:
-        [maskView clipRRect:(*iter)->GetRRect() matrix:finalTransform];
+        [maskView clipRRect:iter->GetRRect() matrix:finalTransform];
         break;
       case kClipPath:
-        [maskView clipPath:(*iter)->GetPath() matrix:finalTransform];
+        [maskView clipPath:iter->GetPath() matrix:finalTransform];
         break;
       case kOpacity:
-        embedded_view.alpha = (*iter)->GetAlphaFloat() * embedded_view.alpha;
+        embedded_view.alpha = iter->GetAlphaFloat() * embedded_view.alpha;
         break;
       case kBackdropFilter: {
         // We only support DlBlurImageFilter for BackdropFilter.
-        if ((*iter)->GetFilter().asBlur() && canApplyBlurBackdrop) {
+        if (iter->GetFilter().asBlur() && canApplyBlurBackdrop) {
           // sigma_x is arbitrarily chosen as the radius value because Quartz sets
           // sigma_x and sigma_y equal to each other. DlBlurImageFilter's Tile Mode
           // is not supported in Quartz's gaussianBlur CAFilter, so it is not used
           // to blur the PlatformView.
-          [blurRadii addObject:@((*iter)->GetFilter().asBlur()->sigma_x())];
+          [blurRadii addObject:@(iter->GetFilter().asBlur()->sigma_x())];
         }
         break;
       }
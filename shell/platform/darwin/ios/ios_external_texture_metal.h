@@ -38,7 +38,7 @@ class IOSExternalTextureMetal final : public Texture {
   void OnGrContextDestroyed() override;
 
   // |Texture|
-  void MarkNewFrameAvailable() override;
+  void OnNewFrameAvailable() override;
 
   // |Texture|
   void OnTextureUnregistered() override;
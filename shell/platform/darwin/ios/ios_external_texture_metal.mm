@@ -32,7 +32,7 @@ void IOSExternalTextureMetal::OnGrContextDestroyed() {
   [darwin_external_texture_metal_ onGrContextDestroyed];
 }
 
-void IOSExternalTextureMetal::MarkNewFrameAvailable() {
+void IOSExternalTextureMetal::OnNewFrameAvailable() {
   [darwin_external_texture_metal_ markNewFrameAvailable];
 }
 
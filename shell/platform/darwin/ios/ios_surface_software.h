@@ -35,7 +35,8 @@ class IOSSurfaceSoftware final : public IOSSurface, public GPUSurfaceSoftwareDel
   sk_sp<SkSurface> AcquireBackingStore(const SkISize& size) override;
 
   // |GPUSurfaceSoftwareDelegate|
-  bool PresentBackingStore(sk_sp<SkSurface> backing_store) override;
+  bool PresentBackingStore(sk_sp<SkSurface> backing_store,
+                           const std::vector<SkIRect>& damage_rects) override;
 
  private:
   fml::scoped_nsobject<CALayer> layer_;
@@ -270,28 +270,40 @@ InferOpenGLPlatformViewCreationCallback(
     if (present) {
       return present(user_data);
     } else {
-      // Format the frame and buffer damages accordingly. Note that, since the
-      // current compute damage algorithm only returns one rectangle for damage
-      // we are assuming the number of rectangles provided in frame and buffer
-      // damage are always 1. Once the function that computes damage implements
-      // support for multiple damage rectangles, GLPresentInfo should also
-      // contain the number of damage rectangles.
-      const size_t num_rects = 1;
-
-      std::array<FlutterRect, num_rects> frame_damage_rect = {
-          SkIRectToFlutterRect(*(gl_present_info.frame_damage))};
-      std::array<FlutterRect, num_rects> buffer_damage_rect = {
-          SkIRectToFlutterRect(*(gl_present_info.buffer_damage))};
+      // Format the frame and buffer damages accordingly. The frame damage is
+      // presented as the multi-rect breakdown when the damage algorithm
+      // provided one, and as the single bounding rectangle otherwise. The
+      // buffer damage is always a single rectangle.
+      std::vector<FlutterRect> frame_damage_rects;
+      if (gl_present_info.frame_damage_rects != nullptr &&
+          !gl_present_info.frame_damage_rects->empty()) {
+        frame_damage_rects.reserve(gl_present_info.frame_damage_rects->size());
+        for (const auto& rect : *gl_present_info.frame_damage_rects) {
+          frame_damage_rects.push_back(SkIRectToFlutterRect(rect));
+        }
+      } else if (gl_present_info.frame_damage.has_value()) {
+        frame_damage_rects.push_back(
+            SkIRectToFlutterRect(*(gl_present_info.frame_damage)));
+      }
+
+      // The damage may be absent when damage tracking was skipped for the
+      // frame (for example, when leaf layer tracing is enabled). Embedders
+      // treat an empty damage region as unknown and perform a full repaint.
+      std::vector<FlutterRect> buffer_damage_rects;
+      if (gl_present_info.buffer_damage.has_value()) {
+        buffer_damage_rects.push_back(
+            SkIRectToFlutterRect(*(gl_present_info.buffer_damage)));
+      }
 
       FlutterDamage frame_damage{
           .struct_size = sizeof(FlutterDamage),
-          .num_rects = frame_damage_rect.size(),
-          .damage = frame_damage_rect.data(),
+          .num_rects = frame_damage_rects.size(),
+          .damage = frame_damage_rects.data(),
       };
       FlutterDamage buffer_damage{
           .struct_size = sizeof(FlutterDamage),
-          .num_rects = buffer_damage_rect.size(),
-          .damage = buffer_damage_rect.data(),
+          .num_rects = buffer_damage_rects.size(),
+          .damage = buffer_damage_rects.data(),
       };
 
       // Construct the present information concerning the frame being rendered.
@@ -1037,6 +1049,8 @@ InferExternalViewEmbedderFromArgs(const FlutterCompositor* compositor) {
       SAFE_ACCESS(compositor, present_layers_callback, nullptr);
   bool avoid_backing_store_cache =
       SAFE_ACCESS(compositor, avoid_backing_store_cache, false);
+  size_t backing_store_cache_frames =
+      SAFE_ACCESS(compositor, backing_store_cache_frames, 0);
 
   // Make sure the required callbacks are present
   if (!c_create_callback || !c_collect_callback || !c_present_callback) {
@@ -1063,8 +1077,8 @@ InferExternalViewEmbedderFromArgs(const FlutterCompositor* compositor) {
       };
 
   return {std::make_unique<flutter::EmbedderExternalViewEmbedder>(
-              avoid_backing_store_cache, create_render_target_callback,
-              present_callback),
+              avoid_backing_store_cache, backing_store_cache_frames,
+              create_render_target_callback, present_callback),
           false};
 }
 
@@ -2712,6 +2726,52 @@ FlutterEngineResult FlutterEngineNotifyLowMemoryWarning(
                    "Could not dispatch the low memory notification message.");
 }
 
+FlutterEngineResult FlutterEngineTrimMemory(
+    FLUTTER_API_SYMBOL(FlutterEngine) raw_engine,
+    FlutterMemoryPressureLevel level) {
+  auto engine = reinterpret_cast<flutter::EmbedderEngine*>(raw_engine);
+  if (engine == nullptr || !engine->IsValid()) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Engine was invalid.");
+  }
+
+  flutter::MemoryPressureLevel pressure_level;
+  switch (level) {
+    case kFlutterMemoryPressureLevelNone:
+      pressure_level = flutter::MemoryPressureLevel::kNone;
+      break;
+    case kFlutterMemoryPressureLevelModerate:
+      pressure_level = flutter::MemoryPressureLevel::kModerate;
+      break;
+    case kFlutterMemoryPressureLevelCritical:
+      pressure_level = flutter::MemoryPressureLevel::kCritical;
+      break;
+    default:
+      return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                                "Invalid memory pressure level.");
+  }
+
+  engine->GetShell().NotifyMemoryPressure(pressure_level);
+
+  if (level != kFlutterMemoryPressureLevelCritical) {
+    return kSuccess;
+  }
+
+  // At the critical stage, also ask the framework to flush its caches (chief
+  // among them the framework image cache) the same way the unstaged warning
+  // does.
+  rapidjson::Document document;
+  auto& allocator = document.GetAllocator();
+
+  document.SetObject();
+  document.AddMember("type", "memoryPressure", allocator);
+
+  return DispatchJSONPlatformMessage(raw_engine, document, "flutter/system")
+             ? kSuccess
+             : LOG_EMBEDDER_ERROR(
+                   kInternalInconsistency,
+                   "Could not dispatch the memory pressure message.");
+}
+
 FlutterEngineResult FlutterEnginePostCallbackOnAllNativeThreads(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
     FlutterNativeThreadCallback callback,
@@ -2886,6 +2946,7 @@ FlutterEngineResult FlutterEngineGetProcAddresses(
   SET_PROC(NotifyDisplayUpdate, FlutterEngineNotifyDisplayUpdate);
   SET_PROC(ScheduleFrame, FlutterEngineScheduleFrame);
   SET_PROC(SetNextFrameCallback, FlutterEngineSetNextFrameCallback);
+  SET_PROC(TrimMemory, FlutterEngineTrimMemory);
 #undef SET_PROC
 
   return kSuccess;
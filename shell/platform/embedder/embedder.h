@@ -363,6 +363,14 @@ typedef struct {
   size_t width;
   /// Height of the texture.
   size_t height;
+  /// Optional. When set, `target`, `name` and `format` are ignored and the
+  /// engine streams the contents of this CPU buffer into an engine managed
+  /// texture instead. The buffer must hold `width` * `height` tightly packed
+  /// RGBA pixels and both dimensions must be non-zero. The engine double
+  /// buffers the destination textures so a new frame can be uploaded while the
+  /// previous one is still being sampled. The `destruction_callback` is
+  /// invoked as soon as the engine has finished reading the buffer.
+  const uint8_t* buffer;
 } FlutterOpenGLTexture;
 
 typedef struct {
@@ -1449,6 +1457,12 @@ typedef struct {
   FlutterLayersPresentCallback present_layers_callback;
   /// Avoid caching backing stores provided by this compositor.
   bool avoid_backing_store_cache;
+  /// The number of frames an unused backing store is retained by the engine
+  /// before `collect_backing_store_callback` is invoked for it. Cached backing
+  /// stores of a matching size may be reused across platform view instances.
+  /// A value of zero retains unused backing stores for a single frame. This
+  /// field is ignored when `avoid_backing_store_cache` is set.
+  size_t backing_store_cache_frames;
 } FlutterCompositor;
 
 typedef struct {
@@ -2499,6 +2513,44 @@ FLUTTER_EXPORT
 FlutterEngineResult FlutterEngineNotifyLowMemoryWarning(
     FLUTTER_API_SYMBOL(FlutterEngine) engine);
 
+/// The staged memory pressure levels an embedder may report via
+/// `FlutterEngineTrimMemory`, ordered from least to most severe.
+typedef enum {
+  /// The platform reports no memory pressure. Cache budgets are restored
+  /// toward their configured limits, one stage per notification.
+  kFlutterMemoryPressureLevelNone = 0,
+  /// The OS is running low on memory. Cache budgets are reduced but warm
+  /// cache entries survive.
+  kFlutterMemoryPressureLevelModerate,
+  /// The process is a candidate for termination. Cache budgets are reduced to
+  /// their minimum stage and the framework is asked to flush its own caches.
+  kFlutterMemoryPressureLevelCritical,
+} FlutterMemoryPressureLevel;
+
+//------------------------------------------------------------------------------
+/// @brief      Reports a staged memory pressure level to a running engine
+///             instance. Unlike `FlutterEngineNotifyLowMemoryWarning`, which
+///             purges the engine caches outright and causes a cold-cache
+///             stutter on the next frame, this scales the Skia resource cache
+///             and raster cache byte budgets by stage so warm entries survive
+///             moderate pressure. Worsening pressure takes effect immediately;
+///             the budgets are restored one stage per recovery notification.
+///             At the critical level the framework is additionally notified
+///             via `WidgetsBindingObserver.didHaveMemoryPressure` so it can
+///             flush its image cache. Must be called on the thread used to
+///             launch the engine.
+///
+/// @param[in]  engine     A running engine instance.
+/// @param[in]  level      The memory pressure level reported by the platform.
+///
+/// @return     If the memory pressure level was forwarded to the running
+///             engine instance.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineTrimMemory(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterMemoryPressureLevel level);
+
 //------------------------------------------------------------------------------
 /// @brief      Schedule a callback to be run on all engine managed threads.
 ///             The engine will attempt to service this callback the next time
@@ -2708,6 +2760,9 @@ typedef FlutterEngineResult (*FlutterEngineSetNextFrameCallbackFnPtr)(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
     VoidCallback callback,
     void* user_data);
+typedef FlutterEngineResult (*FlutterEngineTrimMemoryFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterMemoryPressureLevel level);
 
 /// Function-pointer-based versions of the APIs above.
 typedef struct {
@@ -2754,6 +2809,7 @@ typedef struct {
   FlutterEngineNotifyDisplayUpdateFnPtr NotifyDisplayUpdate;
   FlutterEngineScheduleFrameFnPtr ScheduleFrame;
   FlutterEngineSetNextFrameCallbackFnPtr SetNextFrameCallback;
+  FlutterEngineTrimMemoryFnPtr TrimMemory;
 } FlutterEngineProcTable;
 
 //------------------------------------------------------------------------------
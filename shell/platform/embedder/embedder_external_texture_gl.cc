@@ -11,7 +11,10 @@
 #include "third_party/skia/include/core/SkColorSpace.h"
 #include "third_party/skia/include/core/SkColorType.h"
 #include "third_party/skia/include/core/SkImage.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
+#include "third_party/skia/include/core/SkPixmap.h"
 #include "third_party/skia/include/core/SkSize.h"
+#include "third_party/skia/include/core/SkSurface.h"
 #include "third_party/skia/include/gpu/GrBackendSurface.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
 
@@ -64,6 +67,10 @@ sk_sp<SkImage> EmbedderExternalTextureGL::ResolveTexture(
     return nullptr;
   }
 
+  if (texture->buffer != nullptr) {
+    return UploadPixelBuffer(context, texture.get());
+  }
+
   GrGLTextureInfo gr_texture_info = {texture->target, texture->name,
                                      texture->format};
 
@@ -102,14 +109,64 @@ sk_sp<SkImage> EmbedderExternalTextureGL::ResolveTexture(
   return image;
 }
 
+sk_sp<SkImage> EmbedderExternalTextureGL::UploadPixelBuffer(
+    GrDirectContext* context,
+    const FlutterOpenGLTexture* texture) {
+  if (texture->width == 0 || texture->height == 0) {
+    FML_LOG(ERROR)
+        << "Embedder supplied pixel buffers must declare their dimensions.";
+    return nullptr;
+  }
+
+  const auto image_info =
+      SkImageInfo::Make(texture->width, texture->height,
+                        kRGBA_8888_SkColorType, kPremul_SkAlphaType);
+
+  // Upload into the least recently presented surface of the ring. The surface
+  // presented last frame may still be referenced by in-flight rendering
+  // commands. Writing into a different surface keeps the upload from
+  // serializing against those commands (Skia would otherwise have to copy the
+  // destination texture on write).
+  auto& surface = upload_surfaces_[next_upload_index_];
+  next_upload_index_ = (next_upload_index_ + 1u) % kUploadRingSize;
+
+  if (!surface || surface->imageInfo() != image_info ||
+      surface->recordingContext() != context) {
+    surface = SkSurface::MakeRenderTarget(context, SkBudgeted::kNo, image_info);
+    if (!surface) {
+      FML_LOG(ERROR) << "Could not create an upload surface for the embedder "
+                        "supplied pixel buffer.";
+      return nullptr;
+    }
+  }
+
+  SkPixmap pixmap(image_info, texture->buffer, image_info.minRowBytes());
+  surface->writePixels(pixmap, 0, 0);
+
+  // The pixels have been staged for upload. The embedder may now reuse or
+  // collect the buffer.
+  if (texture->destruction_callback) {
+    texture->destruction_callback(texture->user_data);
+  }
+
+  return surface->makeImageSnapshot();
+}
+
 // |flutter::Texture|
 void EmbedderExternalTextureGL::OnGrContextCreated() {}
 
 // |flutter::Texture|
-void EmbedderExternalTextureGL::OnGrContextDestroyed() {}
+void EmbedderExternalTextureGL::OnGrContextDestroyed() {
+  // The upload surfaces are owned by the context being torn down and must not
+  // outlive it.
+  for (auto& surface : upload_surfaces_) {
+    surface = nullptr;
+  }
+  last_image_ = nullptr;
+}
 
 // |flutter::Texture|
-void EmbedderExternalTextureGL::MarkNewFrameAvailable() {
+void EmbedderExternalTextureGL::OnNewFrameAvailable() {
   last_image_ = nullptr;
 }
 
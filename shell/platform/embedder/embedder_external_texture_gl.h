@@ -10,6 +10,7 @@
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkSize.h"
+#include "third_party/skia/include/core/SkSurface.h"
 
 namespace flutter {
 
@@ -24,13 +25,24 @@ class EmbedderExternalTextureGL : public flutter::Texture {
   ~EmbedderExternalTextureGL();
 
  private:
+  static constexpr size_t kUploadRingSize = 2u;
+
   const ExternalTextureCallback& external_texture_callback_;
   sk_sp<SkImage> last_image_;
+  // A ring of persistent engine managed GPU surfaces used to stream embedder
+  // provided CPU pixel buffers. Uploading into a surface whose previous
+  // snapshot is no longer referenced avoids both a per frame texture
+  // allocation and a stall against frames still sampling the last upload.
+  sk_sp<SkSurface> upload_surfaces_[kUploadRingSize];
+  size_t next_upload_index_ = 0u;
 
   sk_sp<SkImage> ResolveTexture(int64_t texture_id,
                                 GrDirectContext* context,
                                 const SkISize& size);
 
+  sk_sp<SkImage> UploadPixelBuffer(GrDirectContext* context,
+                                   const FlutterOpenGLTexture* texture);
+
   // |flutter::Texture|
   void Paint(PaintContext& context,
              const SkRect& bounds,
@@ -44,7 +56,7 @@ class EmbedderExternalTextureGL : public flutter::Texture {
   void OnGrContextDestroyed() override;
 
   // |flutter::Texture|
-  void MarkNewFrameAvailable() override;
+  void OnNewFrameAvailable() override;
 
   // |flutter::Texture|
   void OnTextureUnregistered() override;
@@ -44,7 +44,7 @@ class EmbedderExternalTextureMetal : public flutter::Texture {
   void OnGrContextDestroyed() override;
 
   // |flutter::Texture|
-  void MarkNewFrameAvailable() override;
+  void OnNewFrameAvailable() override;
 
   // |flutter::Texture|
   void OnTextureUnregistered() override;
@@ -109,7 +109,7 @@ void EmbedderExternalTextureMetal::OnGrContextCreated() {}
 void EmbedderExternalTextureMetal::OnGrContextDestroyed() {}
 
 // |flutter::Texture|
-void EmbedderExternalTextureMetal::MarkNewFrameAvailable() {
+void EmbedderExternalTextureMetal::OnNewFrameAvailable() {
   last_image_ = nullptr;
 }
 
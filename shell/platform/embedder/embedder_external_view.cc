@@ -4,7 +4,6 @@
 
 #include "flutter/shell/platform/embedder/embedder_external_view.h"
 #include "flutter/fml/trace_event.h"
-#include "flutter/shell/common/canvas_spy.h"
 
 namespace flutter {
 
@@ -30,10 +29,8 @@ EmbedderExternalView::EmbedderExternalView(
       surface_transformation_(surface_transformation),
       view_identifier_(view_identifier),
       embedded_view_params_(std::move(params)),
-      recorder_(std::make_unique<SkPictureRecorder>()),
-      canvas_spy_(std::make_unique<CanvasSpy>(
-          recorder_->beginRecording(frame_size.width(), frame_size.height()))) {
-}
+      recorder_(sk_make_sp<DisplayListCanvasRecorder>(
+          SkRect::Make(frame_size))) {}
 
 EmbedderExternalView::~EmbedderExternalView() = default;
 
@@ -43,7 +40,7 @@ EmbedderExternalView::CreateRenderTargetDescriptor() const {
 }
 
 SkCanvas* EmbedderExternalView::GetCanvas() const {
-  return canvas_spy_->GetSpyingCanvas();
+  return recorder_.get();
 }
 
 SkISize EmbedderExternalView::GetRenderSurfaceSize() const {
@@ -59,7 +56,13 @@ bool EmbedderExternalView::HasPlatformView() const {
 }
 
 bool EmbedderExternalView::HasEngineRenderedContents() const {
-  return canvas_spy_->DidDrawIntoCanvas();
+  if (has_engine_rendered_contents_.has_value()) {
+    return has_engine_rendered_contents_.value();
+  }
+  // The builder counts rendering ops as they record, so this costs a
+  // field read instead of the second dispatch of the whole op stream the
+  // old CanvasSpy paid.
+  return recorder_->builder()->render_op_count() > 0;
 }
 
 EmbedderExternalView::ViewIdentifier EmbedderExternalView::GetViewIdentifier()
@@ -78,8 +81,9 @@ bool EmbedderExternalView::Render(const EmbedderRenderTarget& render_target) {
       << "Unnecessarily asked to render into a render target when there was "
          "nothing to render.";
 
-  auto picture = recorder_->finishRecordingAsPicture();
-  if (!picture) {
+  has_engine_rendered_contents_ = HasEngineRenderedContents();
+  auto display_list = recorder_->Build();
+  if (!display_list) {
     return false;
   }
 
@@ -98,7 +102,7 @@ bool EmbedderExternalView::Render(const EmbedderRenderTarget& render_target) {
 
   canvas->setMatrix(surface_transformation_);
   canvas->clear(SK_ColorTRANSPARENT);
-  canvas->drawPicture(picture);
+  display_list->RenderTo(canvas);
   canvas->flush();
 
   return true;
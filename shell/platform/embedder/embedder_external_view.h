@@ -9,12 +9,11 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "flutter/display_list/display_list_canvas_recorder.h"
 #include "flutter/flow/embedded_views.h"
 #include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
-#include "flutter/shell/common/canvas_spy.h"
 #include "flutter/shell/platform/embedder/embedder_render_target.h"
-#include "third_party/skia/include/core/SkPictureRecorder.h"
 
 namespace flutter {
 
@@ -116,8 +115,11 @@ class EmbedderExternalView {
   const SkMatrix surface_transformation_;
   ViewIdentifier view_identifier_;
   std::unique_ptr<EmbeddedViewParams> embedded_view_params_;
-  std::unique_ptr<SkPictureRecorder> recorder_;
-  std::unique_ptr<CanvasSpy> canvas_spy_;
+  sk_sp<DisplayListCanvasRecorder> recorder_;
+  // Latched from the recorder's builder when |Render| consumes the
+  // recording, so the did-draw query keeps answering after the builder
+  // is gone.
+  std::optional<bool> has_engine_rendered_contents_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderExternalView);
 };
@@ -15,9 +15,11 @@ namespace flutter {
 
 EmbedderExternalViewEmbedder::EmbedderExternalViewEmbedder(
     bool avoid_backing_store_cache,
+    size_t backing_store_cache_frames,
     const CreateRenderTargetCallback& create_render_target_callback,
     const PresentCallback& present_callback)
     : avoid_backing_store_cache_(avoid_backing_store_cache),
+      backing_store_cache_frames_(backing_store_cache_frames),
       create_render_target_callback_(create_render_target_callback),
       present_callback_(present_callback) {
   FML_DCHECK(create_render_target_callback_);
@@ -160,9 +162,15 @@ void EmbedderExternalViewEmbedder::SubmitFrame(
   // around this issue while that embedder migrates, collection of render
   // targets is deferred after the presentation.
   //
+  // Only the targets that exceeded the configured retention are collected;
+  // the rest stay cached so transient layer changes (resizes, overlays that
+  // blink out for a frame) do not round trip through the embedder's
+  // create/collect callbacks.
+  //
   // @warning: Embedder may trample on our OpenGL context here.
   auto deferred_cleanup_render_targets =
-      render_target_cache_.ClearAllRenderTargetsInCache();
+      render_target_cache_.CollectStaleRenderTargets(
+          backing_store_cache_frames_);
 
   for (const auto& pending_key : pending_keys) {
     const auto& external_view = pending_views_.at(pending_key);
@@ -271,8 +279,9 @@ void EmbedderExternalViewEmbedder::SubmitFrame(
   // @warning: Embedder may trample on our OpenGL context here.
   deferred_cleanup_render_targets.clear();
 
-  // Hold all rendered layers in the render target cache for one frame to
-  // see if they may be reused next frame.
+  // Hold all rendered layers in the render target cache to see if they may be
+  // reused on subsequent frames. They will be collected once they have been
+  // unused for longer than the configured retention.
   for (auto& render_target : matched_render_targets) {
     if (!avoid_backing_store_cache_) {
       render_target_cache_.CacheRenderTarget(render_target.first,
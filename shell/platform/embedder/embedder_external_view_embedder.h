@@ -45,6 +45,13 @@ class EmbedderExternalViewEmbedder final : public ExternalViewEmbedder {
   ///                                      engine composited layer. The result
   ///                                      will not cached.
   ///
+  /// @param[in] backing_store_cache_frames The number of frames an unused
+  ///                                      backing store is retained before it
+  ///                                      is collected. Zero reproduces the
+  ///                                      original one-frame retention.
+  ///                                      Ignored when
+  ///                                      avoid_backing_store_cache is set.
+  ///
   /// @param[in]  create_render_target_callback
   ///                                     The render target callback used to
   ///                                     request the render target for a layer.
@@ -55,6 +62,7 @@ class EmbedderExternalViewEmbedder final : public ExternalViewEmbedder {
   ///
   EmbedderExternalViewEmbedder(
       bool avoid_backing_store_cache,
+      size_t backing_store_cache_frames,
       const CreateRenderTargetCallback& create_render_target_callback,
       const PresentCallback& present_callback);
 
@@ -108,6 +116,7 @@ class EmbedderExternalViewEmbedder final : public ExternalViewEmbedder {
 
  private:
   const bool avoid_backing_store_cache_;
+  const uint64_t backing_store_cache_frames_;
   const CreateRenderTargetCallback create_render_target_callback_;
   const PresentCallback present_callback_;
   SurfaceTransformationCallback surface_transformation_callback_;
@@ -114,24 +114,24 @@ void EmbedderLayers::PushPlatformViewLayer(
 
     for (auto i = mutators.Bottom(); i != mutators.Top(); ++i) {
       const auto& mutator = *i;
-      switch (mutator->GetType()) {
+      switch (mutator.GetType()) {
         case MutatorType::kClipRect: {
           mutations_array.push_back(
               mutations_referenced_
-                  .emplace_back(ConvertMutation(mutator->GetRect()))
+                  .emplace_back(ConvertMutation(mutator.GetRect()))
                   .get());
         } break;
         case MutatorType::kClipRRect: {
           mutations_array.push_back(
               mutations_referenced_
-                  .emplace_back(ConvertMutation(mutator->GetRRect()))
+                  .emplace_back(ConvertMutation(mutator.GetRRect()))
                   .get());
         } break;
         case MutatorType::kClipPath: {
           // Unsupported mutation.
         } break;
         case MutatorType::kTransform: {
-          const auto& matrix = mutator->GetMatrix();
+          const auto& matrix = mutator.GetMatrix();
           if (!matrix.isIdentity()) {
             mutations_array.push_back(
                 mutations_referenced_.emplace_back(ConvertMutation(matrix))
@@ -140,7 +140,7 @@ void EmbedderLayers::PushPlatformViewLayer(
         } break;
         case MutatorType::kOpacity: {
           const double opacity =
-              std::clamp(mutator->GetAlphaFloat(), 0.0f, 1.0f);
+              std::clamp(mutator.GetAlphaFloat(), 0.0f, 1.0f);
           if (opacity < 1.0) {
             mutations_array.push_back(
                 mutations_referenced_.emplace_back(ConvertMutation(opacity))
@@ -10,10 +10,21 @@ EmbedderRenderTargetCache::EmbedderRenderTargetCache() = default;
 
 EmbedderRenderTargetCache::~EmbedderRenderTargetCache() = default;
 
+// Backing stores are interchangeable between views of the same size, so the
+// cache buckets by size alone. Clearing the identifier from the descriptor
+// lets a target rendered for one platform-view instance be picked up by
+// another.
+static EmbedderExternalView::RenderTargetDescriptor SizeClassDescriptor(
+    EmbedderExternalView::RenderTargetDescriptor descriptor) {
+  descriptor.view_identifier = EmbedderExternalView::ViewIdentifier{};
+  return descriptor;
+}
+
 std::pair<EmbedderRenderTargetCache::RenderTargets,
           EmbedderExternalView::ViewIdentifierSet>
 EmbedderRenderTargetCache::GetExistingTargetsInCache(
     const EmbedderExternalView::PendingViews& pending_views) {
+  frame_count_++;
   RenderTargets resolved_render_targets;
   EmbedderExternalView::ViewIdentifierSet unmatched_identifiers;
 
@@ -22,14 +33,15 @@ EmbedderRenderTargetCache::GetExistingTargetsInCache(
     if (!external_view->HasEngineRenderedContents()) {
       continue;
     }
-    auto& compatible_targets =
-        cached_render_targets_[external_view->CreateRenderTargetDescriptor()];
-    if (compatible_targets.empty()) {
+    auto found = cached_render_targets_.find(
+        SizeClassDescriptor(external_view->CreateRenderTargetDescriptor()));
+    if (found == cached_render_targets_.end() || found->second.empty()) {
       unmatched_identifiers.insert(view.first);
     } else {
+      auto& compatible_targets = found->second;
       std::unique_ptr<EmbedderRenderTarget> target =
-          std::move(compatible_targets.top());
-      compatible_targets.pop();
+          std::move(compatible_targets.back().target);
+      compatible_targets.pop_back();
       resolved_render_targets[view.first] = std::move(target);
     }
   }
@@ -40,16 +52,39 @@ std::set<std::unique_ptr<EmbedderRenderTarget>>
 EmbedderRenderTargetCache::ClearAllRenderTargetsInCache() {
   std::set<std::unique_ptr<EmbedderRenderTarget>> cleared_targets;
   for (auto& targets : cached_render_targets_) {
-    auto& targets_stack = targets.second;
-    while (!targets_stack.empty()) {
-      cleared_targets.emplace(std::move(targets_stack.top()));
-      targets_stack.pop();
+    for (auto& cached_target : targets.second) {
+      cleared_targets.emplace(std::move(cached_target.target));
     }
   }
   cached_render_targets_.clear();
   return cleared_targets;
 }
 
+std::set<std::unique_ptr<EmbedderRenderTarget>>
+EmbedderRenderTargetCache::CollectStaleRenderTargets(
+    uint64_t max_unused_frames) {
+  std::set<std::unique_ptr<EmbedderRenderTarget>> stale_targets;
+  for (auto bucket = cached_render_targets_.begin();
+       bucket != cached_render_targets_.end();) {
+    auto& targets = bucket->second;
+    for (auto cached_target = targets.begin();
+         cached_target != targets.end();) {
+      if (frame_count_ - cached_target->last_used_frame > max_unused_frames) {
+        stale_targets.emplace(std::move(cached_target->target));
+        cached_target = targets.erase(cached_target);
+      } else {
+        ++cached_target;
+      }
+    }
+    if (targets.empty()) {
+      bucket = cached_render_targets_.erase(bucket);
+    } else {
+      ++bucket;
+    }
+  }
+  return stale_targets;
+}
+
 void EmbedderRenderTargetCache::CacheRenderTarget(
     EmbedderExternalView::ViewIdentifier view_identifier,
     std::unique_ptr<EmbedderRenderTarget> target) {
@@ -57,9 +92,9 @@ void EmbedderRenderTargetCache::CacheRenderTarget(
     return;
   }
   auto surface = target->GetRenderSurface();
-  auto desc = EmbedderExternalView::RenderTargetDescriptor{
-      view_identifier, SkISize::Make(surface->width(), surface->height())};
-  cached_render_targets_[desc].push(std::move(target));
+  auto desc = SizeClassDescriptor(EmbedderExternalView::RenderTargetDescriptor{
+      view_identifier, SkISize::Make(surface->width(), surface->height())});
+  cached_render_targets_[desc].push_back({std::move(target), frame_count_});
 }
 
 size_t EmbedderRenderTargetCache::GetCachedTargetsCount() const {
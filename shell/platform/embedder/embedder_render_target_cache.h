@@ -5,10 +5,11 @@
 #ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_RENDER_TARGET_CACHE_H_
 #define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_RENDER_TARGET_CACHE_H_
 
+#include <cstdint>
 #include <set>
-#include <stack>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/embedder/embedder_external_view.h"
@@ -17,7 +18,9 @@ namespace flutter {
 
 //------------------------------------------------------------------------------
 /// @brief      A cache used to reference render targets that are owned by the
-///             embedder but needed by th engine to render a frame.
+///             embedder but needed by th engine to render a frame. Targets are
+///             bucketed by their size alone so a store rendered for one
+///             platform-view interleaving can be reused by another.
 ///
 class EmbedderRenderTargetCache {
  public:
@@ -38,20 +41,41 @@ class EmbedderRenderTargetCache {
   std::set<std::unique_ptr<EmbedderRenderTarget>>
   ClearAllRenderTargetsInCache();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Removes and returns the targets that have not been rendered
+  ///             into for more than `max_unused_frames` frames, leaving the
+  ///             rest cached for reuse. A value of zero reproduces the
+  ///             original behavior of collecting every target that missed a
+  ///             single frame. One frame is one call to
+  ///             `GetExistingTargetsInCache`.
+  ///
+  std::set<std::unique_ptr<EmbedderRenderTarget>> CollectStaleRenderTargets(
+      uint64_t max_unused_frames);
+
   void CacheRenderTarget(EmbedderExternalView::ViewIdentifier view_identifier,
                          std::unique_ptr<EmbedderRenderTarget> target);
 
   size_t GetCachedTargetsCount() const;
 
  private:
+  struct CachedRenderTarget {
+    std::unique_ptr<EmbedderRenderTarget> target;
+    // The value of `frame_count_` when this target was last rendered into.
+    uint64_t last_used_frame = 0;
+  };
+
   using CachedRenderTargets =
       std::unordered_map<EmbedderExternalView::RenderTargetDescriptor,
-                         std::stack<std::unique_ptr<EmbedderRenderTarget>>,
+                         std::vector<CachedRenderTarget>,
                          EmbedderExternalView::RenderTargetDescriptor::Hash,
                          EmbedderExternalView::RenderTargetDescriptor::Equal>;
 
   CachedRenderTargets cached_render_targets_;
 
+  // Incremented once per frame by |GetExistingTargetsInCache|. Used to age
+  // out targets that stay unused.
+  uint64_t frame_count_ = 0;
+
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderRenderTargetCache);
 };
 
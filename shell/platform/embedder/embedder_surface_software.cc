@@ -81,7 +81,8 @@ sk_sp<SkSurface> EmbedderSurfaceSoftware::AcquireBackingStore(
 
 // |GPUSurfaceSoftwareDelegate|
 bool EmbedderSurfaceSoftware::PresentBackingStore(
-    sk_sp<SkSurface> backing_store) {
+    sk_sp<SkSurface> backing_store,
+    const std::vector<SkIRect>& damage_rects) {
   if (!IsValid()) {
     FML_LOG(ERROR) << "Tried to present an invalid software surface.";
     return false;
@@ -45,7 +45,8 @@ class EmbedderSurfaceSoftware final : public EmbedderSurface,
   sk_sp<SkSurface> AcquireBackingStore(const SkISize& size) override;
 
   // |GPUSurfaceSoftwareDelegate|
-  bool PresentBackingStore(sk_sp<SkSurface> backing_store) override;
+  bool PresentBackingStore(sk_sp<SkSurface> backing_store,
+                           const std::vector<SkIRect>& damage_rects) override;
 
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderSurfaceSoftware);
 };
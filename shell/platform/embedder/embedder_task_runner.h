@@ -76,18 +76,17 @@ class EmbedderTaskRunner final : public fml::TaskRunner {
   DispatchTable dispatch_table_;
   std::mutex tasks_mutex_;
   uint64_t last_baton_ = 0;
-  std::unordered_map<uint64_t, fml::closure> pending_tasks_;
+  std::unordered_map<uint64_t, fml::Closure> pending_tasks_;
   fml::TaskQueueId placeholder_id_;
 
   // |fml::TaskRunner|
-  void PostTask(const fml::closure& task) override;
+  void PostTask(fml::Closure task) override;
 
   // |fml::TaskRunner|
-  void PostTaskForTime(const fml::closure& task,
-                       fml::TimePoint target_time) override;
+  void PostTaskForTime(fml::Closure task, fml::TimePoint target_time) override;
 
   // |fml::TaskRunner|
-  void PostDelayedTask(const fml::closure& task, fml::TimeDelta delay) override;
+  void PostDelayedTask(fml::Closure task, fml::TimeDelta delay) override;
 
   // |fml::TaskRunner|
   bool RunsTasksOnCurrentThread() override;
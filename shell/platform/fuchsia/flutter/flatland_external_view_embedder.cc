@@ -519,32 +519,32 @@ FlatlandExternalViewEmbedder::ParseMutatorStack(
 
   for (auto i = mutators_stack.Begin(); i != mutators_stack.End(); ++i) {
     const auto& mutator = *i;
-    switch (mutator->GetType()) {
+    switch (mutator.GetType()) {
       case flutter::MutatorType::kOpacity: {
-        mutators.opacity *= std::clamp(mutator->GetAlphaFloat(), 0.f, 1.f);
+        mutators.opacity *= std::clamp(mutator.GetAlphaFloat(), 0.f, 1.f);
       } break;
       case flutter::MutatorType::kTransform: {
-        total_transform.preConcat(mutator->GetMatrix());
-        transform_accumulator.preConcat(mutator->GetMatrix());
+        total_transform.preConcat(mutator.GetMatrix());
+        transform_accumulator.preConcat(mutator.GetMatrix());
       } break;
       case flutter::MutatorType::kClipRect: {
         mutators.clips.emplace_back(TransformedClip{
             .transform = transform_accumulator,
-            .rect = mutator->GetRect(),
+            .rect = mutator.GetRect(),
         });
         transform_accumulator = SkMatrix::I();
       } break;
       case flutter::MutatorType::kClipRRect: {
         mutators.clips.emplace_back(TransformedClip{
             .transform = transform_accumulator,
-            .rect = mutator->GetRRect().getBounds(),
+            .rect = mutator.GetRRect().getBounds(),
         });
         transform_accumulator = SkMatrix::I();
       } break;
       case flutter::MutatorType::kClipPath: {
         mutators.clips.emplace_back(TransformedClip{
             .transform = transform_accumulator,
-            .rect = mutator->GetPath().getBounds(),
+            .rect = mutator.GetPath().getBounds(),
         });
         transform_accumulator = SkMatrix::I();
       } break;
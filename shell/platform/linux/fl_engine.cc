@@ -211,10 +211,22 @@ static uint32_t fl_engine_gl_get_fbo(void* user_data) {
   return fl_renderer_get_fbo(self->renderer);
 }
 
-static bool fl_engine_gl_present(void* user_data) {
-  // No action required, as this is handled in
-  // compositor_present_layers_callback.
-  return true;
+static bool fl_engine_gl_present_with_info(void* user_data,
+                                           const FlutterPresentInfo* info) {
+  FlEngine* self = static_cast<FlEngine*>(user_data);
+  // Compositing is handled in compositor_present_layers_callback. This
+  // forwards the frame damage so only the changed regions are blitted to the
+  // window.
+  return fl_renderer_present_with_info(self->renderer, info);
+}
+
+static void fl_engine_gl_populate_existing_damage(
+    void* user_data,
+    const intptr_t fbo_id,
+    FlutterDamage* existing_damage) {
+  FlEngine* self = static_cast<FlEngine*>(user_data);
+  fl_renderer_populate_existing_damage(self->renderer, fbo_id,
+                                       existing_damage);
 }
 
 static bool fl_engine_gl_make_resource_current(void* user_data) {
@@ -463,7 +475,9 @@ gboolean fl_engine_start(FlEngine* self, GError** error) {
   config.open_gl.make_current = fl_engine_gl_make_current;
   config.open_gl.clear_current = fl_engine_gl_clear_current;
   config.open_gl.fbo_callback = fl_engine_gl_get_fbo;
-  config.open_gl.present = fl_engine_gl_present;
+  config.open_gl.present_with_info = fl_engine_gl_present_with_info;
+  config.open_gl.populate_existing_damage =
+      fl_engine_gl_populate_existing_damage;
   config.open_gl.make_resource_current = fl_engine_gl_make_resource_current;
   config.open_gl.gl_external_texture_frame_callback =
       fl_engine_gl_external_texture_frame_callback;
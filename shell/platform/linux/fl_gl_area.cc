@@ -130,5 +130,6 @@ void fl_gl_area_queue_render(FlGLArea* self, FlBackingStoreProvider* texture) {
   g_clear_object(&self->texture);
   g_set_object(&self->texture, texture);
 
-  gtk_widget_queue_draw(GTK_WIDGET(self));
+  // Invalidation is driven by the damage reported when the frame is
+  // presented; see fl_view_queue_draw_region.
 }
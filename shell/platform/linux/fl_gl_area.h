@@ -34,7 +34,8 @@ GtkWidget* fl_gl_area_new(GdkGLContext* context);
  * @area: an #FlGLArea.
  * @texture: queued OpenGL texture.
  *
- * Queues a texture to be drawn later.
+ * Queues a texture to be drawn later. The caller is responsible for
+ * invalidating the region of the widget that changed.
  */
 void fl_gl_area_queue_render(FlGLArea* area, FlBackingStoreProvider* texture);
 
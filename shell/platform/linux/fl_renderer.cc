@@ -7,12 +7,21 @@
 #include <epoxy/egl.h>
 #include <epoxy/gl.h>
 
+#include <math.h>
+
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/linux/fl_backing_store_provider.h"
 #include "flutter/shell/platform/linux/fl_engine_private.h"
+#include "flutter/shell/platform/linux/fl_view_private.h"
 
 G_DEFINE_QUARK(fl_renderer_error_quark, fl_renderer_error)
 
+// Number of recent frame damage regions tracked for buffer age estimation.
+// GDK does not expose the length of the swapchain backing its surfaces, so the
+// renderer conservatively assumes buffers are reused within this many frames
+// and reports the union of everything newer as existing damage.
+static constexpr size_t kMaxDamageHistory = 4;
+
 typedef struct {
   FlView* view;
 
@@ -27,10 +36,38 @@ typedef struct {
   // was rendered
   bool had_first_frame;
 
+  // ring of damage regions from the most recent frames, newest first; used to
+  // answer existing damage queries for partial repaint
+  GdkRectangle damage_history[kMaxDamageHistory];
+  size_t damage_history_length;
+
+  // storage for the rectangle handed back from
+  // fl_renderer_populate_existing_damage
+  FlutterRect existing_damage_rect;
+
   GdkGLContext* main_context;
   GdkGLContext* resource_context;
 } FlRendererPrivate;
 
+// Computes the bounding rectangle of a damage region, in pixels.
+static GdkRectangle flutter_damage_bounds(const FlutterDamage* damage) {
+  GdkRectangle bounds = {0, 0, 0, 0};
+  for (size_t i = 0; i < damage->num_rects; ++i) {
+    const FlutterRect* rect = &damage->damage[i];
+    GdkRectangle r;
+    r.x = static_cast<int>(floor(rect->left));
+    r.y = static_cast<int>(floor(rect->top));
+    r.width = static_cast<int>(ceil(rect->right)) - r.x;
+    r.height = static_cast<int>(ceil(rect->bottom)) - r.y;
+    if (i == 0) {
+      bounds = r;
+    } else {
+      gdk_rectangle_union(&bounds, &r, &bounds);
+    }
+  }
+  return bounds;
+}
+
 G_DEFINE_TYPE_WITH_PRIVATE(FlRenderer, fl_renderer, G_TYPE_OBJECT)
 
 static void fl_renderer_unblock_main_thread(FlRenderer* self) {
@@ -137,6 +174,88 @@ gboolean fl_renderer_collect_backing_store(
                                                             backing_store);
 }
 
+void fl_renderer_populate_existing_damage(FlRenderer* self,
+                                          intptr_t fbo_id,
+                                          FlutterDamage* existing_damage) {
+  g_return_if_fail(FL_IS_RENDERER(self));
+  FlRendererPrivate* priv = reinterpret_cast<FlRendererPrivate*>(
+      fl_renderer_get_instance_private(self));
+
+  existing_damage->struct_size = sizeof(FlutterDamage);
+
+  // Until enough history has accumulated to cover the oldest buffer GDK may
+  // hand back, the buffer's age is unknown. Reporting no rectangles makes the
+  // engine fall back to a full repaint.
+  if (priv->damage_history_length < kMaxDamageHistory) {
+    existing_damage->num_rects = 0;
+    existing_damage->damage = nullptr;
+    return;
+  }
+
+  GdkRectangle accumulated = priv->damage_history[0];
+  for (size_t i = 1; i < priv->damage_history_length; ++i) {
+    gdk_rectangle_union(&accumulated, &priv->damage_history[i], &accumulated);
+  }
+
+  priv->existing_damage_rect = {
+      .left = static_cast<double>(accumulated.x),
+      .top = static_cast<double>(accumulated.y),
+      .right = static_cast<double>(accumulated.x + accumulated.width),
+      .bottom = static_cast<double>(accumulated.y + accumulated.height),
+  };
+  existing_damage->num_rects = 1;
+  existing_damage->damage = &priv->existing_damage_rect;
+}
+
+gboolean fl_renderer_present_with_info(FlRenderer* self,
+                                       const FlutterPresentInfo* info) {
+  g_return_val_if_fail(FL_IS_RENDERER(self), FALSE);
+  FlRendererPrivate* priv = reinterpret_cast<FlRendererPrivate*>(
+      fl_renderer_get_instance_private(self));
+
+  if (info->frame_damage.num_rects == 0) {
+    // The engine skipped damage tracking for this frame, so the regions that
+    // changed are unknown. Drop the history so existing damage queries force
+    // full repaints until it has been rebuilt, and redraw everything.
+    priv->damage_history_length = 0;
+    if (priv->view != nullptr) {
+      gtk_widget_queue_draw(GTK_WIDGET(priv->view));
+    }
+    return TRUE;
+  }
+
+  for (size_t i = MIN(priv->damage_history_length, kMaxDamageHistory - 1);
+       i > 0; --i) {
+    priv->damage_history[i] = priv->damage_history[i - 1];
+  }
+  priv->damage_history[0] = flutter_damage_bounds(&info->frame_damage);
+  priv->damage_history_length =
+      MIN(priv->damage_history_length + 1, kMaxDamageHistory);
+
+  if (priv->view == nullptr) {
+    return TRUE;
+  }
+
+  // Invalidate only the damaged regions, converted from pixels to logical
+  // coordinates and expanded to cover partially damaged logical pixels.
+  gint scale = gtk_widget_get_scale_factor(GTK_WIDGET(priv->view));
+  g_autofree GdkRectangle* regions =
+      g_new(GdkRectangle, info->frame_damage.num_rects);
+  for (size_t i = 0; i < info->frame_damage.num_rects; ++i) {
+    const FlutterRect* rect = &info->frame_damage.damage[i];
+    regions[i].x = static_cast<int>(floor(rect->left / scale));
+    regions[i].y = static_cast<int>(floor(rect->top / scale));
+    regions[i].width =
+        static_cast<int>(ceil(rect->right / scale)) - regions[i].x;
+    regions[i].height =
+        static_cast<int>(ceil(rect->bottom / scale)) - regions[i].y;
+  }
+  fl_view_queue_draw_region(priv->view, regions,
+                            info->frame_damage.num_rects);
+
+  return TRUE;
+}
+
 void fl_renderer_wait_for_frame(FlRenderer* self,
                                 int target_width,
                                 int target_height) {
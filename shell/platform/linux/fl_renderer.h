@@ -230,6 +230,37 @@ gboolean fl_renderer_present_layers(FlRenderer* renderer,
                                     const FlutterLayer** layers,
                                     size_t layers_count);
 
+/**
+ * fl_renderer_populate_existing_damage:
+ * @renderer: an #FlRenderer.
+ * @fbo_id: id of the framebuffer that is about to be rendered into.
+ * @existing_damage: (out): the damage that has accumulated in the framebuffer
+ * since it was last rendered into.
+ *
+ * Callback invoked by the engine before rasterizing a frame so that only the
+ * stale regions of the framebuffer need to be repainted. If the age of the
+ * framebuffer cannot be determined no rectangles are reported, which makes
+ * the engine fall back to a full repaint.
+ */
+void fl_renderer_populate_existing_damage(FlRenderer* renderer,
+                                          intptr_t fbo_id,
+                                          FlutterDamage* existing_damage);
+
+/**
+ * fl_renderer_present_with_info:
+ * @renderer: an #FlRenderer.
+ * @info: struct with the damage for the presented frame.
+ *
+ * Callback invoked by the engine after the layers of a frame have been
+ * composited. Records the frame damage for buffer age tracking and
+ * invalidates only the damaged region of the view so unchanged pixels are not
+ * blitted to the window again.
+ *
+ * Returns %TRUE if successful.
+ */
+gboolean fl_renderer_present_with_info(FlRenderer* renderer,
+                                       const FlutterPresentInfo* info);
+
 /**
  * fl_renderer_wait_for_frame:
  * @renderer: an #FlRenderer.
@@ -961,6 +961,8 @@ void fl_view_add_widget(FlView* view,
 }
 
 void fl_view_end_frame(FlView* view) {
+  gboolean children_changed = FALSE;
+
   for (GList* pending_child = view->pending_children_list; pending_child;
        pending_child = pending_child->next) {
     FlViewChild* pending_view_child =
@@ -974,6 +976,7 @@ void fl_view_end_frame(FlView* view) {
     } else {
       // newly added child
       gtk_widget_set_parent(pending_view_child->widget, GTK_WIDGET(view));
+      children_changed = TRUE;
     }
   }
 
@@ -985,6 +988,7 @@ void fl_view_end_frame(FlView* view) {
       gtk_widget_unparent(view_child->widget);
       g_free(view_child);
       child->data = nullptr;
+      children_changed = TRUE;
     }
   }
 
@@ -999,5 +1003,32 @@ void fl_view_end_frame(FlView* view) {
 
   gtk_container_forall(GTK_CONTAINER(view), fl_view_reorder_forall, &data);
 
-  gtk_widget_queue_draw(GTK_WIDGET(view));
+  // A full redraw is only needed when the set of child widgets changed. Plain
+  // content updates are invalidated by the damage reported when the frame is
+  // presented; see fl_view_queue_draw_region.
+  if (children_changed) {
+    gtk_widget_queue_draw(GTK_WIDGET(view));
+  }
+}
+
+void fl_view_queue_draw_region(FlView* view,
+                               const GdkRectangle* rects,
+                               size_t n_rects) {
+  g_return_if_fail(FL_IS_VIEW(view));
+
+  // The rendering areas have their own windows, so invalidating the view
+  // itself would not reach them; the damage has to be queued on each area.
+  for (GList* link = view->gl_area_list; link; link = link->next) {
+    GtkWidget* area = GTK_WIDGET(link->data);
+    if (!gtk_widget_get_realized(area)) {
+      continue;
+    }
+    GtkAllocation allocation;
+    gtk_widget_get_allocation(area, &allocation);
+    for (size_t i = 0; i < n_rects; ++i) {
+      gtk_widget_queue_draw_area(area, rects[i].x - allocation.x,
+                                 rects[i].y - allocation.y, rects[i].width,
+                                 rects[i].height);
+    }
+  }
 }
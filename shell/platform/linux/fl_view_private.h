@@ -48,8 +48,24 @@ void fl_view_add_widget(FlView* view,
  * fl_view_end_frame:
  * @view: an #FlView.
  *
- * Apply changes made by fl_view_add_gl_area and fl_view_add_widget.
+ * Apply changes made by fl_view_add_gl_area and fl_view_add_widget. A full
+ * redraw is only queued when the set of child widgets changed; content
+ * updates are invalidated by fl_view_queue_draw_region when the frame is
+ * presented.
  */
 void fl_view_end_frame(FlView* view);
 
+/**
+ * fl_view_queue_draw_region:
+ * @view: an #FlView.
+ * @rects: (array length=n_rects): regions to redraw, in view coordinates.
+ * @n_rects: number of regions.
+ *
+ * Invalidates only the given regions of the view's rendering areas instead of
+ * the entire view, so unchanged pixels are not blitted to the window again.
+ */
+void fl_view_queue_draw_region(FlView* view,
+                               const GdkRectangle* rects,
+                               size_t n_rects);
+
 #endif  // FLUTTER_SHELL_PLATFORM_LINUX_FL_VIEW_PRIVATE_H_
@@ -4,6 +4,7 @@
 
 #include "flutter/shell/platform/windows/angle_surface_manager.h"
 
+#include <cstring>
 #include <vector>
 
 #include "flutter/fml/logging.h"
@@ -169,6 +170,23 @@ bool AngleSurfaceManager::Initialize() {
     return false;
   }
 
+  // Swapping with damage lets ANGLE issue Present1 with a dirty rectangle
+  // list so the compositor only copies the regions that changed. This is an
+  // optional optimization; its absence just means full swaps.
+  const char* extensions = eglQueryString(egl_display_, EGL_EXTENSIONS);
+  if (extensions != nullptr) {
+    if (strstr(extensions, "EGL_KHR_swap_buffers_with_damage") != nullptr) {
+      swap_buffers_with_damage_ =
+          reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+              eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+    } else if (strstr(extensions, "EGL_EXT_swap_buffers_with_damage") !=
+               nullptr) {
+      swap_buffers_with_damage_ =
+          reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+              eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+    }
+  }
+
   return true;
 }
 
@@ -292,6 +310,27 @@ EGLBoolean AngleSurfaceManager::SwapBuffers() {
   return (eglSwapBuffers(egl_display_, render_surface_));
 }
 
+EGLBoolean AngleSurfaceManager::SwapBuffersWithDamage(
+    const std::vector<RECT>& rects) {
+  if (swap_buffers_with_damage_ == nullptr || rects.empty()) {
+    return SwapBuffers();
+  }
+
+  // EGL damage rectangles are specified as x, y, width, height quadruples
+  // with the origin at the bottom-left of the surface.
+  std::vector<EGLint> egl_rects;
+  egl_rects.reserve(rects.size() * 4);
+  for (const RECT& rect : rects) {
+    egl_rects.push_back(rect.left);
+    egl_rects.push_back(surface_height_ - rect.bottom);
+    egl_rects.push_back(rect.right - rect.left);
+    egl_rects.push_back(rect.bottom - rect.top);
+  }
+  return swap_buffers_with_damage_(egl_display_, render_surface_,
+                                   egl_rects.data(),
+                                   static_cast<EGLint>(rects.size()));
+}
+
 EGLSurface AngleSurfaceManager::CreateSurfaceFromHandle(
     EGLenum handle_type,
     EGLClientBuffer handle,
@@ -17,6 +17,7 @@
 #include <windows.h>
 #include <wrl/client.h>
 #include <memory>
+#include <vector>
 
 #include "window_binding_handler.h"
 
@@ -71,6 +72,19 @@ class AngleSurfaceManager {
   // not null.
   EGLBoolean SwapBuffers();
 
+  // Swaps the buffers passing |rects| as the damaged regions so ANGLE can
+  // forward them to the swapchain as Present1 dirty rectangles. The
+  // rectangles are in framebuffer coordinates with a top-left origin and are
+  // converted to the bottom-left origin EGL expects. Falls back to a full
+  // swap when the display does not support swap-with-damage or |rects| is
+  // empty.
+  EGLBoolean SwapBuffersWithDamage(const std::vector<RECT>& rects);
+
+  // Whether the display supports passing damage rectangles at swap time.
+  bool SupportsSwapWithDamage() const {
+    return swap_buffers_with_damage_ != nullptr;
+  }
+
   // Creates a |EGLSurface| from the provided handle.
   EGLSurface CreateSurfaceFromHandle(EGLenum handle_type,
                                      EGLClientBuffer handle,
@@ -123,6 +137,10 @@ class AngleSurfaceManager {
   // The current D3D device.
   Microsoft::WRL::ComPtr<ID3D11Device> resolved_device_;
 
+  // eglSwapBuffersWithDamageKHR (or the EXT equivalent), or nullptr when the
+  // display does not support swapping with damage.
+  PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC swap_buffers_with_damage_ = nullptr;
+
   // Number of active instances of AngleSurfaceManager
   static int instance_count_;
 };
@@ -25,6 +25,15 @@ typedef void (*glTexImage2DProc)(GLenum target,
                                  GLenum format,
                                  GLenum type,
                                  const void* data);
+typedef void (*glTexSubImage2DProc)(GLenum target,
+                                    GLint level,
+                                    GLint xoffset,
+                                    GLint yoffset,
+                                    GLsizei width,
+                                    GLsizei height,
+                                    GLenum format,
+                                    GLenum type,
+                                    const void* data);
 
 // A struct containing pointers to resolved gl* functions.
 struct GlProcs {
@@ -33,6 +42,7 @@ struct GlProcs {
   glBindTextureProc glBindTexture;
   glTexParameteriProc glTexParameteri;
   glTexImage2DProc glTexImage2D;
+  glTexSubImage2DProc glTexSubImage2D;
   bool valid;
 };
 
@@ -81,19 +81,25 @@ bool ExternalTextureD3d::CreateOrUpdateTexture(
   }
 
   auto handle = SAFE_ACCESS(descriptor, handle, nullptr);
-  if (handle != last_surface_handle_) {
+  auto surface_width = SAFE_ACCESS(descriptor, width, 0);
+  auto surface_height = SAFE_ACCESS(descriptor, height, 0);
+  // The binding is kept across frames; only recreate it when the producer
+  // hands over a different surface. The dimensions are part of the key as a
+  // recreated surface can be allocated at the previous handle value.
+  if (handle != last_surface_handle_ ||
+      surface_width != last_surface_width_ ||
+      surface_height != last_surface_height_) {
     ReleaseImage();
 
-    EGLint attributes[] = {
-        EGL_WIDTH,
-        static_cast<EGLint>(SAFE_ACCESS(descriptor, width, 0)),
-        EGL_HEIGHT,
-        static_cast<EGLint>(SAFE_ACCESS(descriptor, height, 0)),
-        EGL_TEXTURE_TARGET,
-        EGL_TEXTURE_2D,
-        EGL_TEXTURE_FORMAT,
-        EGL_TEXTURE_RGBA,  // always EGL_TEXTURE_RGBA
-        EGL_NONE};
+    EGLint attributes[] = {EGL_WIDTH,
+                           static_cast<EGLint>(surface_width),
+                           EGL_HEIGHT,
+                           static_cast<EGLint>(surface_height),
+                           EGL_TEXTURE_TARGET,
+                           EGL_TEXTURE_2D,
+                           EGL_TEXTURE_FORMAT,
+                           EGL_TEXTURE_RGBA,  // always EGL_TEXTURE_RGBA
+                           EGL_NONE};
 
     egl_surface_ = surface_manager_->CreateSurfaceFromHandle(
         (type_ == kFlutterDesktopGpuSurfaceTypeD3d11Texture2D)
@@ -107,6 +113,8 @@ bool ExternalTextureD3d::CreateOrUpdateTexture(
       FML_LOG(ERROR) << "Binding D3D surface failed.";
     }
     last_surface_handle_ = handle;
+    last_surface_width_ = surface_width;
+    last_surface_height_ = surface_height;
   }
 
   auto release_callback = SAFE_ACCESS(descriptor, release_callback, nullptr);
@@ -42,6 +42,11 @@ class ExternalTextureD3d : public ExternalTexture {
   GLuint gl_texture_ = 0;
   EGLSurface egl_surface_ = EGL_NO_SURFACE;
   void* last_surface_handle_ = nullptr;
+  // Dimensions the cached binding was created with. The binding is recreated
+  // when the producer recreates the surface at a new size, even if the handle
+  // value happens to be reused.
+  size_t last_surface_width_ = 0;
+  size_t last_surface_height_ = 0;
 };
 
 }  // namespace flutter
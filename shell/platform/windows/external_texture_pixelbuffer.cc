@@ -15,8 +15,10 @@ ExternalTexturePixelBuffer::ExternalTexturePixelBuffer(
       gl_(gl_procs) {}
 
 ExternalTexturePixelBuffer::~ExternalTexturePixelBuffer() {
-  if (gl_texture_ != 0) {
-    gl_.glDeleteTextures(1, &gl_texture_);
+  for (size_t i = 0; i < kUploadRingSize; i++) {
+    if (gl_textures_[i] != 0) {
+      gl_.glDeleteTextures(1, &gl_textures_[i]);
+    }
   }
 }
 
@@ -30,7 +32,7 @@ bool ExternalTexturePixelBuffer::PopulateTexture(
 
   // Populate the texture object used by the engine.
   opengl_texture->target = GL_TEXTURE_2D;
-  opengl_texture->name = gl_texture_;
+  opengl_texture->name = gl_textures_[current_texture_];
   opengl_texture->format = GL_RGBA8_OES;
   opengl_texture->destruction_callback = nullptr;
   opengl_texture->user_data = nullptr;
@@ -50,21 +52,34 @@ bool ExternalTexturePixelBuffer::CopyPixelBuffer(size_t& width,
   width = pixel_buffer->width;
   height = pixel_buffer->height;
 
-  if (gl_texture_ == 0) {
-    gl_.glGenTextures(1, &gl_texture_);
+  // Upload into the next texture of the ring so the texture sampled by the
+  // previous frame remains untouched while the GPU may still be reading it.
+  current_texture_ = (current_texture_ + 1) % kUploadRingSize;
+  if (gl_textures_[current_texture_] == 0) {
+    gl_.glGenTextures(1, &gl_textures_[current_texture_]);
 
-    gl_.glBindTexture(GL_TEXTURE_2D, gl_texture_);
+    gl_.glBindTexture(GL_TEXTURE_2D, gl_textures_[current_texture_]);
     gl_.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     gl_.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     gl_.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     gl_.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
   } else {
-    gl_.glBindTexture(GL_TEXTURE_2D, gl_texture_);
+    gl_.glBindTexture(GL_TEXTURE_2D, gl_textures_[current_texture_]);
+  }
+  if (texture_widths_[current_texture_] == pixel_buffer->width &&
+      texture_heights_[current_texture_] == pixel_buffer->height) {
+    // Update the existing storage in place rather than reallocating it.
+    gl_.glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, pixel_buffer->width,
+                        pixel_buffer->height, GL_RGBA, GL_UNSIGNED_BYTE,
+                        pixel_buffer->buffer);
+  } else {
+    gl_.glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, pixel_buffer->width,
+                     pixel_buffer->height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     pixel_buffer->buffer);
+    texture_widths_[current_texture_] = pixel_buffer->width;
+    texture_heights_[current_texture_] = pixel_buffer->height;
   }
-  gl_.glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, pixel_buffer->width,
-                   pixel_buffer->height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                   pixel_buffer->buffer);
   if (pixel_buffer->release_callback) {
     pixel_buffer->release_callback(pixel_buffer->release_context);
   }
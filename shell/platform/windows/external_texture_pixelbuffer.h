@@ -11,6 +11,11 @@
 namespace flutter {
 
 // An abstraction of an pixel-buffer based texture.
+//
+// Uploads alternate between a small ring of GL textures so that the raster
+// thread never writes into the texture the GPU is still sampling from the
+// previous frame, and reuses each texture's storage via sub-image updates
+// when the pixel buffer dimensions are unchanged.
 class ExternalTexturePixelBuffer : public ExternalTexture {
  public:
   ExternalTexturePixelBuffer(
@@ -34,10 +39,17 @@ class ExternalTexturePixelBuffer : public ExternalTexture {
   // by |texture_callback_| was invalid.
   bool CopyPixelBuffer(size_t& width, size_t& height);
 
+  // The number of textures the uploads cycle through. Two are sufficient to
+  // decouple the current upload from the texture sampled last frame.
+  static constexpr size_t kUploadRingSize = 2u;
+
   const FlutterDesktopPixelBufferTextureCallback texture_callback_ = nullptr;
   void* const user_data_ = nullptr;
   const GlProcs& gl_;
-  GLuint gl_texture_ = 0;
+  GLuint gl_textures_[kUploadRingSize] = {0};
+  size_t texture_widths_[kUploadRingSize] = {0};
+  size_t texture_heights_[kUploadRingSize] = {0};
+  size_t current_texture_ = 0;
 };
 
 }  // namespace flutter
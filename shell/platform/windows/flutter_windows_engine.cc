@@ -60,12 +60,25 @@ FlutterRendererConfig GetOpenGLRendererConfig() {
     }
     return host->view()->ClearContext();
   };
-  config.open_gl.present = [](void* user_data) -> bool {
+  config.open_gl.present_with_info =
+      [](void* user_data, const FlutterPresentInfo* info) -> bool {
     auto host = static_cast<FlutterWindowsEngine*>(user_data);
     if (!host->view()) {
       return false;
     }
-    return host->view()->SwapBuffers();
+    return host->view()->PresentWithInfo(info);
+  };
+  config.open_gl.populate_existing_damage =
+      [](void* user_data, const intptr_t fbo_id,
+         FlutterDamage* existing_damage) {
+    auto host = static_cast<FlutterWindowsEngine*>(user_data);
+    if (host->view()) {
+      host->view()->PopulateExistingDamage(fbo_id, existing_damage);
+    } else {
+      existing_damage->struct_size = sizeof(FlutterDamage);
+      existing_damage->num_rects = 0;
+      existing_damage->damage = nullptr;
+    }
   };
   config.open_gl.fbo_reset_after_present = true;
   config.open_gl.fbo_with_frame_info_callback =
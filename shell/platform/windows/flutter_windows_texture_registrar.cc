@@ -137,10 +137,12 @@ void FlutterWindowsTextureRegistrar::ResolveGlFunctions(GlProcs& procs) {
       eglGetProcAddress("glTexParameteri"));
   procs.glTexImage2D =
       reinterpret_cast<glTexImage2DProc>(eglGetProcAddress("glTexImage2D"));
+  procs.glTexSubImage2D = reinterpret_cast<glTexSubImage2DProc>(
+      eglGetProcAddress("glTexSubImage2D"));
 
   procs.valid = procs.glGenTextures && procs.glDeleteTextures &&
                 procs.glBindTexture && procs.glTexParameteri &&
-                procs.glTexImage2D;
+                procs.glTexImage2D && procs.glTexSubImage2D;
 }
 
 };  // namespace flutter
@@ -189,6 +189,20 @@ TEST(FlutterWindowsTextureRegistrarTest, PopulatePixelBufferTexture) {
   EXPECT_EQ(flutter_texture.height, height);
   EXPECT_EQ(flutter_texture.target, GL_TEXTURE_2D);
   EXPECT_TRUE(release_callback_called);
+
+  // Populating again cycles through the upload ring and reuses the existing
+  // texture storage.
+  release_callback_called = false;
+  result = registrar.PopulateTexture(texture_id, 640, 480, &flutter_texture);
+  EXPECT_TRUE(result);
+  EXPECT_EQ(flutter_texture.width, width);
+  EXPECT_EQ(flutter_texture.height, height);
+  EXPECT_TRUE(release_callback_called);
+
+  release_callback_called = false;
+  result = registrar.PopulateTexture(texture_id, 640, 480, &flutter_texture);
+  EXPECT_TRUE(result);
+  EXPECT_TRUE(release_callback_called);
 }
 
 TEST(FlutterWindowsTextureRegistrarTest, PopulateD3dTextureWithHandle) {
@@ -4,7 +4,9 @@
 
 #include "flutter/shell/platform/windows/flutter_windows_view.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 
 #include "flutter/shell/platform/common/accessibility_bridge.h"
 #include "flutter/shell/platform/windows/keyboard_key_channel_handler.h"
@@ -578,10 +580,49 @@ bool FlutterWindowsView::ClearContext() {
   return engine_->surface_manager()->ClearContext();
 }
 
-bool FlutterWindowsView::SwapBuffers() {
+// Converts a damage region to dirty rectangles in framebuffer coordinates,
+// expanded to cover partially damaged pixels.
+static std::vector<RECT> DamageToDirtyRects(const FlutterDamage& damage) {
+  std::vector<RECT> rects;
+  rects.reserve(damage.num_rects);
+  for (size_t i = 0; i < damage.num_rects; ++i) {
+    const FlutterRect& rect = damage.damage[i];
+    RECT dirty_rect;
+    dirty_rect.left = static_cast<LONG>(std::floor(rect.left));
+    dirty_rect.top = static_cast<LONG>(std::floor(rect.top));
+    dirty_rect.right = static_cast<LONG>(std::ceil(rect.right));
+    dirty_rect.bottom = static_cast<LONG>(std::ceil(rect.bottom));
+    rects.push_back(dirty_rect);
+  }
+  return rects;
+}
+
+// Returns the bounding rectangle of a damage region.
+static FlutterRect DamageBounds(const FlutterDamage& damage) {
+  FlutterRect bounds = damage.damage[0];
+  for (size_t i = 1; i < damage.num_rects; ++i) {
+    bounds.left = std::min(bounds.left, damage.damage[i].left);
+    bounds.top = std::min(bounds.top, damage.damage[i].top);
+    bounds.right = std::max(bounds.right, damage.damage[i].right);
+    bounds.bottom = std::max(bounds.bottom, damage.damage[i].bottom);
+  }
+  return bounds;
+}
+
+bool FlutterWindowsView::SwapBuffers(const FlutterPresentInfo* present_info) {
   // Called on an engine-controlled (non-platform) thread.
   std::unique_lock<std::mutex> lock(resize_mutex_);
 
+  AngleSurfaceManager* surface_manager = engine_->surface_manager();
+  auto swap = [surface_manager, present_info]() -> bool {
+    if (present_info != nullptr && surface_manager->SupportsSwapWithDamage() &&
+        present_info->frame_damage.num_rects > 0) {
+      return surface_manager->SwapBuffersWithDamage(
+          DamageToDirtyRects(present_info->frame_damage));
+    }
+    return surface_manager->SwapBuffers();
+  };
+
   switch (resize_status_) {
     // SwapBuffer requests during resize are ignored until the frame with the
     // right dimensions has been generated. This is marked with
@@ -596,21 +637,67 @@ bool FlutterWindowsView::SwapBuffers() {
       // SwapBuffers waits for vsync and there's no point doing that for
       // invisible windows.
       if (visible) {
-        swap_buffers_result = engine_->surface_manager()->SwapBuffers();
+        swap_buffers_result = swap();
       }
       resize_status_ = ResizeState::kDone;
       lock.unlock();
       resize_cv_.notify_all();
       binding_handler_->OnWindowResized();
       if (!visible) {
-        swap_buffers_result = engine_->surface_manager()->SwapBuffers();
+        swap_buffers_result = swap();
       }
       return swap_buffers_result;
     }
     case ResizeState::kDone:
     default:
-      return engine_->surface_manager()->SwapBuffers();
+      return swap();
+  }
+}
+
+bool FlutterWindowsView::PresentWithInfo(const FlutterPresentInfo* info) {
+  // Called on an engine-controlled (non-platform) thread.
+  if (info->frame_damage.num_rects == 0) {
+    // Damage tracking was skipped for this frame, so the regions that changed
+    // are unknown. Drop the history so existing-damage queries force full
+    // repaints until it has been rebuilt.
+    damage_history_.clear();
+    return SwapBuffers();
+  }
+
+  damage_history_.insert(damage_history_.begin(),
+                         DamageBounds(info->frame_damage));
+  if (damage_history_.size() > kMaxDamageHistory) {
+    damage_history_.pop_back();
   }
+  return SwapBuffers(info);
+}
+
+void FlutterWindowsView::PopulateExistingDamage(
+    intptr_t fbo_id,
+    FlutterDamage* existing_damage) {
+  existing_damage->struct_size = sizeof(FlutterDamage);
+
+  // Until enough history has accumulated to cover the oldest buffer the
+  // swapchain may hand back, the buffer's age is unknown. Reporting no
+  // rectangles makes the engine fall back to a full repaint.
+  if (damage_history_.size() < kMaxDamageHistory) {
+    existing_damage->num_rects = 0;
+    existing_damage->damage = nullptr;
+    return;
+  }
+
+  FlutterRect accumulated = damage_history_[0];
+  for (size_t i = 1; i < damage_history_.size(); ++i) {
+    accumulated.left = std::min(accumulated.left, damage_history_[i].left);
+    accumulated.top = std::min(accumulated.top, damage_history_[i].top);
+    accumulated.right = std::max(accumulated.right, damage_history_[i].right);
+    accumulated.bottom =
+        std::max(accumulated.bottom, damage_history_[i].bottom);
+  }
+
+  existing_damage_rect_ = accumulated;
+  existing_damage->num_rects = 1;
+  existing_damage->damage = &existing_damage_rect_;
 }
 
 bool FlutterWindowsView::PresentSoftwareBitmap(const void* allocation,
@@ -77,7 +77,18 @@ class FlutterWindowsView : public WindowBindingHandlerDelegate,
   bool ClearContext();
   bool MakeCurrent();
   bool MakeResourceCurrent();
-  bool SwapBuffers();
+  bool SwapBuffers(const FlutterPresentInfo* present_info = nullptr);
+
+  // Callback invoked by the engine when presenting a frame. Records the frame
+  // damage for later existing-damage queries and forwards it to the swapchain
+  // as dirty rectangles when swapping.
+  bool PresentWithInfo(const FlutterPresentInfo* info);
+
+  // Callback invoked by the engine before rasterizing a frame. Populates the
+  // damage that has accumulated in the window framebuffer since it was last
+  // rendered into. Reports no rectangles until enough history is available,
+  // which makes the engine perform a full repaint.
+  void PopulateExistingDamage(intptr_t fbo_id, FlutterDamage* existing_damage);
 
   // Callback for presenting a software bitmap.
   bool PresentSoftwareBitmap(const void* allocation,
@@ -400,6 +411,18 @@ class FlutterWindowsView : public WindowBindingHandlerDelegate,
 
   // True when flutter's semantics tree is enabled.
   bool semantics_enabled_ = false;
+
+  // Number of recent frame damage regions retained for partial repaint. ANGLE
+  // does not expose the age of the swapchain buffer being rendered into, so
+  // existing damage is answered conservatively as the union of this history.
+  static constexpr size_t kMaxDamageHistory = 4;
+
+  // Bounds of the frame damage of the most recent presents, newest first.
+  // Only accessed on the raster thread.
+  std::vector<FlutterRect> damage_history_;
+
+  // Storage for the rectangle handed back from PopulateExistingDamage.
+  FlutterRect existing_damage_rect_;
 };
 
 }  // namespace flutter
@@ -19,6 +19,7 @@ class MockGlFunctions {
     gl_procs_.glBindTexture = &glBindTexture;
     gl_procs_.glTexParameteri = &glTexParameteri;
     gl_procs_.glTexImage2D = &glTexImage2D;
+    gl_procs_.glTexSubImage2D = &glTexSubImage2D;
     gl_procs_.valid = true;
   }
 
@@ -43,6 +44,15 @@ class MockGlFunctions {
                            GLenum format,
                            GLenum type,
                            const void* data) {}
+  static void glTexSubImage2D(GLenum target,
+                              GLint level,
+                              GLint xoffset,
+                              GLint yoffset,
+                              GLsizei width,
+                              GLsizei height,
+                              GLenum format,
+                              GLenum type,
+                              const void* data) {}
 
  private:
   GlProcs gl_procs_;
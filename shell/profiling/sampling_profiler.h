@@ -5,13 +5,17 @@
 #ifndef FLUTTER_SHELL_PROFILING_SAMPLING_PROFILER_H_
 #define FLUTTER_SHELL_PROFILING_SAMPLING_PROFILER_H_
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -72,6 +76,22 @@ struct ProfileSample {
  */
 using Sampler = std::function<ProfileSample(void)>;
 
+/**
+ * @brief A fixed-size snapshot of one `ProfileSample` and its capture time,
+ * as retained by the preallocated ring in low-overhead mode.
+ *
+ * @see flutter::SamplingProfiler::SetLowOverheadMode
+ */
+struct RecordedProfileSample {
+  fml::TimePoint timestamp;
+  bool has_cpu_usage = false;
+  CpuUsageInfo cpu_usage = {};
+  bool has_memory_usage = false;
+  MemoryUsageInfo memory_usage = {};
+  bool has_gpu_usage = false;
+  GpuUsageInfo gpu_usage = {};
+};
+
 /**
  * @brief a Sampling Profiler that runs peridically and calls the `Sampler`
  * which servers as a value function to gather various profiling metrics as
@@ -108,6 +128,28 @@ class SamplingProfiler {
 
   void Stop();
 
+  /**
+   * @brief Number of samples the low-overhead ring retains by default: ten
+   * minutes of history at one sample per second.
+   */
+  static constexpr size_t kDefaultRingSize = 600;
+
+  /**
+   * @brief Toggles low-overhead (production) mode. While enabled, samples are
+   * written into a preallocated ring instead of being posted to the timeline
+   * and no per-sample allocation is performed; once the ring is full the
+   * oldest samples are overwritten. The ring is allocated on the first enable
+   * and keeps that size for the lifetime of the profiler.
+   */
+  void SetLowOverheadMode(bool enabled, size_t ring_size = kDefaultRingSize);
+
+  /**
+   * @brief Drains the samples recorded since the last drain, oldest first.
+   * Samples overwritten before being drained are lost. Safe to call from any
+   * thread while the profiler is sampling, but expects a single consumer.
+   */
+  std::vector<RecordedProfileSample> DrainRecordedSamples();
+
  private:
   const std::string thread_label_;
   const fml::RefPtr<fml::TaskRunner> profiler_task_runner_;
@@ -116,7 +158,22 @@ class SamplingProfiler {
   bool is_running_ = false;
   std::atomic<fml::AutoResetWaitableEvent*> shutdown_latch_ = nullptr;
 
-  void SampleRepeatedly(fml::TimeDelta task_delay) const;
+  // Low-overhead mode state. The sampling thread writes the ring and the
+  // published count without taking a lock; the mutex only serializes the ring
+  // allocation and the drain bookkeeping.
+  std::atomic<bool> low_overhead_mode_ = false;
+  std::vector<RecordedProfileSample> ring_;
+  std::atomic<uint64_t> recorded_count_ = 0;
+  uint64_t drained_count_ = 0;
+  std::mutex drain_mutex_;
+
+  void SampleRepeatedly(fml::TimeDelta task_delay);
+
+  /**
+   * @brief Copies one sample into the next ring slot. Runs on the profiler
+   * task runner; performs no allocation and emits no timeline event.
+   */
+  void RecordSample(const ProfileSample& sample);
 
   /**
    * @brief This doesn't update the underlying OS thread name for the thread
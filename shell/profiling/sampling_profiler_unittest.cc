@@ -18,11 +18,11 @@ class MockTaskRunner : public fml::TaskRunner {
   inline static RefPtr<MockTaskRunner> Create() {
     return AdoptRef(new MockTaskRunner());
   }
-  MOCK_METHOD1(PostTask, void(const fml::closure& task));
+  MOCK_METHOD1(PostTask, void(fml::Closure task));
   MOCK_METHOD2(PostTaskForTime,
-               void(const fml::closure& task, fml::TimePoint target_time));
+               void(fml::Closure task, fml::TimePoint target_time));
   MOCK_METHOD2(PostDelayedTask,
-               void(const fml::closure& task, fml::TimeDelta delay));
+               void(fml::Closure task, fml::TimeDelta delay));
   MOCK_METHOD0(RunsTasksOnCurrentThread, bool());
   MOCK_METHOD0(GetTaskQueueId, TaskQueueId());
 
@@ -44,9 +44,9 @@ TEST(SamplingProfilerTest, DeleteAfterStart) {
   // Dart.
   EXPECT_CALL(*task_runner, PostDelayedTask(_, _))
       .WillRepeatedly(
-          Invoke([&](const fml::closure& task, fml::TimeDelta delay) {
+          Invoke([&](fml::Closure task, fml::TimeDelta delay) {
             invoke_count.fetch_add(1);
-            thread->GetTaskRunner()->PostTask(task);
+            thread->GetTaskRunner()->PostTask(std::move(task));
           }));
 
   {
@@ -61,4 +61,44 @@ TEST(SamplingProfilerTest, DeleteAfterStart) {
   ASSERT_EQ(invoke_count_at_delete, invoke_count.load());
 }
 
+TEST(SamplingProfilerTest, LowOverheadModeRecordsIntoRing) {
+  auto thread =
+      std::make_unique<fml::Thread>(flutter::testing::GetCurrentTestName());
+  auto task_runner = fml::MockTaskRunner::Create();
+
+  EXPECT_CALL(*task_runner, PostDelayedTask(_, _))
+      .WillRepeatedly(
+          Invoke([&](fml::Closure task, fml::TimeDelta delay) {
+            thread->GetTaskRunner()->PostTask(std::move(task));
+          }));
+
+  auto profiler = SamplingProfiler(
+      "profiler",
+      /*profiler_task_runner=*/task_runner,
+      [] {
+        ProfileSample sample;
+        CpuUsageInfo cpu_usage;
+        cpu_usage.num_threads = 2;
+        cpu_usage.total_cpu_usage = 50.0;
+        sample.cpu_usage = cpu_usage;
+        return sample;
+      },
+      /*num_samples_per_sec=*/1000);
+  profiler.SetLowOverheadMode(true, /*ring_size=*/4);
+  profiler.Start();
+
+  std::vector<RecordedProfileSample> samples;
+  while (samples.empty()) {
+    samples = profiler.DrainRecordedSamples();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  // The ring never hands out more samples than it retains.
+  ASSERT_LE(samples.size(), 4u);
+  ASSERT_TRUE(samples[0].has_cpu_usage);
+  ASSERT_EQ(samples[0].cpu_usage.num_threads, 2u);
+  ASSERT_EQ(samples[0].cpu_usage.total_cpu_usage, 50.0);
+  ASSERT_FALSE(samples[0].has_memory_usage);
+  ASSERT_FALSE(samples[0].has_gpu_usage);
+}
+
 }  // namespace flutter
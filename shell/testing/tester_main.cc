@@ -117,7 +117,8 @@ class TesterPlatformView : public PlatformView,
   }
 
   // |GPUSurfaceSoftwareDelegate|
-  bool PresentBackingStore(sk_sp<SkSurface> backing_store) override {
+  bool PresentBackingStore(sk_sp<SkSurface> backing_store,
+                           const std::vector<SkIRect>& damage_rects) override {
     return true;
   }
 
@@ -539,6 +539,48 @@ void main() {
     expect(data, listEquals(dataSync));
   });
 
+  test('drawRawCommands matches the individual draw calls', () async {
+    final Paint paint = Paint()..color = const Color(0xFF2196F3);
+    final Image direct = await toImage((Canvas canvas) {
+      canvas.save();
+      canvas.translate(10, 10);
+      canvas.drawRect(const Rect.fromLTRB(0, 0, 40, 40), paint);
+      canvas.drawCircle(const Offset(60, 20), 15, paint);
+      canvas.drawLine(const Offset(0, 60), const Offset(80, 60), paint);
+      canvas.restore();
+    }, 100, 100);
+
+    final Image batched = await toImage((Canvas canvas) {
+      canvas.drawRawCommands(Float32List.fromList(<double>[
+        0, // save
+        2, 10, 10, // translate
+        7, 0, 0, 40, 40, // drawRect
+        9, 60, 20, 15, // drawCircle
+        10, 0, 60, 80, 60, // drawLine
+        1, // restore
+      ]), paint);
+    }, 100, 100);
+
+    final ByteData directData = (await direct.toByteData())!;
+    final ByteData batchedData = (await batched.toByteData())!;
+    expect(batchedData, listEquals(directData));
+  });
+
+  test('drawRawCommands rejects malformed buffers', () async {
+    final Paint paint = Paint();
+    final PictureRecorder recorder = PictureRecorder();
+    final Canvas canvas = Canvas(recorder);
+
+    Object? error;
+    try {
+      // drawRect opcode with a truncated argument list.
+      canvas.drawRawCommands(Float32List.fromList(<double>[7, 0, 0]), paint);
+    } catch (e) {
+      error = e;
+    }
+    expect(error, isNotNull);
+  });
+
   test('Canvas.drawParagraph throws when Paragraph.layout was not called', () async {
     // Regression test for https://github.com/flutter/flutter/issues/97172
     bool assertsEnabled = false;
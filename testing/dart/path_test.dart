@@ -2,7 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
-import 'dart:typed_data' show Float64List;
+import 'dart:typed_data' show Float32List, Float64List;
 import 'dart:ui';
 
 import 'package:litetest/litetest.dart';
@@ -225,4 +225,20 @@ void main() {
     expect(newFirstMetric.getTangentForOffset(4.0)!.vector, const Offset(0.0, 1.0));
     expect(newFirstMetric.extractPath(4.0, 10.0).computeMetrics().first.length, 6.0);
   });
+
+  test('PathMetric.getPosTanList matches getTangentForOffset', () {
+    final Path path = Path()..lineTo(10.0, 10.0);
+    final PathMetric metric = path.computeMetrics().first;
+    final Float32List distances = Float32List.fromList(<double>[0.0, metric.length / 2, metric.length]);
+    final Float32List posTans = metric.getPosTanList(distances);
+    expect(posTans.length, distances.length * 5);
+    for (int i = 0; i < distances.length; i += 1) {
+      final Tangent tangent = metric.getTangentForOffset(distances[i])!;
+      expect(posTans[i * 5], 1.0);
+      expect(posTans[i * 5 + 1], tangent.position.dx);
+      expect(posTans[i * 5 + 2], tangent.position.dy);
+      expect(posTans[i * 5 + 3], tangent.vector.dx);
+      expect(posTans[i * 5 + 4], tangent.vector.dy);
+    }
+  });
 }
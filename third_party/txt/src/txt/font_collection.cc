@@ -391,6 +391,43 @@ void FontCollection::ClearFontFamilyCache() {
 #endif
 }
 
+void FontCollection::ClearFontFamilyCache(const std::string& family_name) {
+  if (family_name.empty()) {
+    ClearFontFamilyCache();
+    return;
+  }
+
+  // FamilyKey::font_families is the comma terminated concatenation of the
+  // requested families, so an entry mentions the family exactly when
+  // "family," appears at the start of the key or right after another comma.
+  const std::string needle = family_name + ',';
+  for (auto it = font_collections_cache_.begin();
+       it != font_collections_cache_.end();) {
+    const std::string& families = it->first.font_families;
+    bool mentions_family = false;
+    for (size_t pos = families.find(needle); pos != std::string::npos;
+         pos = families.find(needle, pos + 1)) {
+      if (pos == 0 || families[pos - 1] == ',') {
+        mentions_family = true;
+        break;
+      }
+    }
+    // Entries that resolved to no collection are also dropped, since the new
+    // family may satisfy the query that previously failed.
+    if (mentions_family || it->second == nullptr) {
+      it = font_collections_cache_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+#if FLUTTER_ENABLE_SKSHAPER
+  if (skt_collection_) {
+    skt_collection_->clearCaches();
+  }
+#endif
+}
+
 #if FLUTTER_ENABLE_SKSHAPER
 
 sk_sp<skia::textlayout::FontCollection>
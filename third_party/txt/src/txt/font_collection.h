@@ -68,6 +68,13 @@ class FontCollection : public std::enable_shared_from_this<FontCollection> {
   // Remove all entries in the font family cache.
   void ClearFontFamilyCache();
 
+  // Remove only the cached entries that a newly registered |family_name|
+  // could affect: entries whose queries mention the family, and entries that
+  // previously failed to resolve any collection. Cached collections for
+  // unrelated families survive. Falls back to a full clear when
+  // |family_name| is empty.
+  void ClearFontFamilyCache(const std::string& family_name);
+
 #if FLUTTER_ENABLE_SKSHAPER
 
   // Construct a Skia text layout FontCollection based on this collection.
@@ -14,13 +14,19 @@ namespace vulkan {
 
 VulkanBackbuffer::VulkanBackbuffer(const VulkanProcTable& p_vk,
                                    const VulkanHandle<VkDevice>& device,
-                                   const VulkanHandle<VkCommandPool>& pool)
-    : vk(p_vk),
-      device_(device),
-      usage_command_buffer_(p_vk, device, pool),
-      render_command_buffer_(p_vk, device, pool),
-      valid_(false) {
-  if (!usage_command_buffer_.IsValid() || !render_command_buffer_.IsValid()) {
+                                   uint32_t queue_family_index)
+    : vk(p_vk), device_(device), valid_(false) {
+  if (!CreateCommandPool(queue_family_index)) {
+    FML_DLOG(INFO) << "Could not create the command pool.";
+    return;
+  }
+
+  usage_command_buffer_ =
+      std::make_unique<VulkanCommandBuffer>(vk, device_, command_pool_);
+  render_command_buffer_ =
+      std::make_unique<VulkanCommandBuffer>(vk, device_, command_pool_);
+
+  if (!usage_command_buffer_->IsValid() || !render_command_buffer_->IsValid()) {
     FML_DLOG(INFO) << "Command buffers were not valid.";
     return;
   }
@@ -46,6 +52,34 @@ bool VulkanBackbuffer::IsValid() const {
   return valid_;
 }
 
+bool VulkanBackbuffer::CreateCommandPool(uint32_t queue_family_index) {
+  // The pool is dedicated to this frame slot and its command buffers are
+  // recycled in bulk via |ResetCommandBuffers| rather than reset
+  // individually, so the reset-command-buffer bit is not requested. The
+  // transient bit hints to the driver that recordings are short-lived.
+  const VkCommandPoolCreateInfo create_info = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+      .pNext = nullptr,
+      .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+      .queueFamilyIndex = queue_family_index,
+  };
+
+  VkCommandPool command_pool = VK_NULL_HANDLE;
+
+  if (VK_CALL_LOG_ERROR(vk.CreateCommandPool(device_, &create_info, nullptr,
+                                             &command_pool)) != VK_SUCCESS) {
+    return false;
+  }
+
+  command_pool_ =
+      VulkanHandle<VkCommandPool>{command_pool, [this](VkCommandPool pool) {
+                                    vk.DestroyCommandPool(device_, pool,
+                                                          nullptr);
+                                  }};
+
+  return true;
+}
+
 bool VulkanBackbuffer::CreateSemaphores() {
   const VkSemaphoreCreateInfo create_info = {
       .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
@@ -136,12 +170,35 @@ const VulkanHandle<VkSemaphore>& VulkanBackbuffer::GetRenderSemaphore() const {
   return semaphores_[1];
 }
 
+uint64_t VulkanBackbuffer::GetPendingTimelineValue() const {
+  return pending_timeline_value_;
+}
+
+void VulkanBackbuffer::SetPendingTimelineValue(uint64_t value) {
+  pending_timeline_value_ = value;
+}
+
 VulkanCommandBuffer& VulkanBackbuffer::GetUsageCommandBuffer() {
-  return usage_command_buffer_;
+  return *usage_command_buffer_;
 }
 
 VulkanCommandBuffer& VulkanBackbuffer::GetRenderCommandBuffer() {
-  return render_command_buffer_;
+  return *render_command_buffer_;
+}
+
+bool VulkanBackbuffer::ResetCommandBuffers() {
+  return VK_CALL_LOG_ERROR(vk.ResetCommandPool(device_, command_pool_, 0)) ==
+         VK_SUCCESS;
+}
+
+std::unique_ptr<VulkanCommandBuffer>
+VulkanBackbuffer::CreateSecondaryCommandBuffer() const {
+  auto buffer = std::make_unique<VulkanCommandBuffer>(
+      vk, device_, command_pool_, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+  if (!buffer->IsValid()) {
+    return nullptr;
+  }
+  return buffer;
 }
 
 }  // namespace vulkan
@@ -6,6 +6,7 @@
 #define FLUTTER_VULKAN_VULKAN_BACKBUFFER_H_
 
 #include <array>
+#include <memory>
 
 #include "flutter/fml/compiler_specific.h"
 #include "flutter/fml/macros.h"
@@ -20,7 +21,7 @@ class VulkanBackbuffer {
  public:
   VulkanBackbuffer(const VulkanProcTable& vk,
                    const VulkanHandle<VkDevice>& device,
-                   const VulkanHandle<VkCommandPool>& pool);
+                   uint32_t queue_family_index);
 
   ~VulkanBackbuffer();
 
@@ -42,15 +43,43 @@ class VulkanBackbuffer {
 
   VulkanCommandBuffer& GetRenderCommandBuffer();
 
+  /// Recycle the recorded command buffers in bulk by resetting this
+  /// backbuffer's command pool. Must only be called once all submissions
+  /// using the command buffers have retired; the buffers return to their
+  /// initial state and may be re-recorded without a reallocation.
+  [[nodiscard]] bool ResetCommandBuffers();
+
+  /// Allocate a secondary command buffer from this backbuffer's command pool.
+  /// Its recorded commands can be replayed into the render command buffer via
+  /// |VulkanCommandBuffer::ExecuteSecondaryCommandBuffers|, and it is
+  /// recycled along with the primary buffers by |ResetCommandBuffers|. The
+  /// pool is externally synchronized, so recording must happen on the thread
+  /// that owns the backbuffer.
+  std::unique_ptr<VulkanCommandBuffer> CreateSecondaryCommandBuffer() const;
+
+  /// The timeline semaphore value signaled when this backbuffer's last
+  /// submission retires, or zero if the backbuffer has never been used. Only
+  /// meaningful when the swapchain synchronizes with a timeline semaphore
+  /// instead of the fences.
+  uint64_t GetPendingTimelineValue() const;
+
+  void SetPendingTimelineValue(uint64_t value);
+
  private:
   const VulkanProcTable& vk;
   const VulkanHandle<VkDevice>& device_;
   std::array<VulkanHandle<VkSemaphore>, 2> semaphores_;
   std::array<VulkanHandle<VkFence>, 2> use_fences_;
-  VulkanCommandBuffer usage_command_buffer_;
-  VulkanCommandBuffer render_command_buffer_;
+  // The pool is declared before the command buffers allocated from it so that
+  // the buffers are collected first on destruction.
+  VulkanHandle<VkCommandPool> command_pool_;
+  std::unique_ptr<VulkanCommandBuffer> usage_command_buffer_;
+  std::unique_ptr<VulkanCommandBuffer> render_command_buffer_;
+  uint64_t pending_timeline_value_ = 0;
   bool valid_;
 
+  bool CreateCommandPool(uint32_t queue_family_index);
+
   bool CreateSemaphores();
 
   bool CreateFences();
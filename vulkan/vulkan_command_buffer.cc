@@ -11,13 +11,14 @@ namespace vulkan {
 VulkanCommandBuffer::VulkanCommandBuffer(
     const VulkanProcTable& p_vk,
     const VulkanHandle<VkDevice>& device,
-    const VulkanHandle<VkCommandPool>& pool)
-    : vk(p_vk), device_(device), pool_(pool), valid_(false) {
+    const VulkanHandle<VkCommandPool>& pool,
+    VkCommandBufferLevel level)
+    : vk(p_vk), device_(device), pool_(pool), level_(level), valid_(false) {
   const VkCommandBufferAllocateInfo allocate_info = {
       .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
       .pNext = nullptr,
       .commandPool = pool_,
-      .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+      .level = level_,
       .commandBufferCount = 1,
   };
 
@@ -49,11 +50,26 @@ VkCommandBuffer VulkanCommandBuffer::Handle() const {
 }
 
 bool VulkanCommandBuffer::Begin() const {
+  // Secondary command buffers must supply inheritance state even when they
+  // are not recorded inside a render pass.
+  const VkCommandBufferInheritanceInfo inheritance_info = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+      .pNext = nullptr,
+      .renderPass = VK_NULL_HANDLE,
+      .subpass = 0,
+      .framebuffer = VK_NULL_HANDLE,
+      .occlusionQueryEnable = VK_FALSE,
+      .queryFlags = 0,
+      .pipelineStatistics = 0,
+  };
+
   const VkCommandBufferBeginInfo info{
       .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
       .pNext = nullptr,
       .flags = 0,
-      .pInheritanceInfo = nullptr,
+      .pInheritanceInfo = level_ == VK_COMMAND_BUFFER_LEVEL_SECONDARY
+                              ? &inheritance_info
+                              : nullptr,
   };
 
   return VK_CALL_LOG_ERROR(vk.BeginCommandBuffer(handle_, &info)) == VK_SUCCESS;
@@ -80,4 +96,15 @@ bool VulkanCommandBuffer::InsertPipelineBarrier(
   return true;
 }
 
+bool VulkanCommandBuffer::ExecuteSecondaryCommandBuffers(
+    uint32_t buffer_count,
+    const VkCommandBuffer* buffers) const {
+  if (level_ != VK_COMMAND_BUFFER_LEVEL_PRIMARY || buffer_count == 0) {
+    return false;
+  }
+
+  vk.CmdExecuteCommands(handle_, buffer_count, buffers);
+  return true;
+}
+
 }  // namespace vulkan
@@ -15,9 +15,11 @@ class VulkanProcTable;
 
 class VulkanCommandBuffer {
  public:
-  VulkanCommandBuffer(const VulkanProcTable& vk,
-                      const VulkanHandle<VkDevice>& device,
-                      const VulkanHandle<VkCommandPool>& pool);
+  VulkanCommandBuffer(
+      const VulkanProcTable& vk,
+      const VulkanHandle<VkDevice>& device,
+      const VulkanHandle<VkCommandPool>& pool,
+      VkCommandBufferLevel level = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
 
   ~VulkanCommandBuffer();
 
@@ -40,11 +42,18 @@ class VulkanCommandBuffer {
       uint32_t image_memory_barrier_count,
       const VkImageMemoryBarrier* image_memory_barriers) const;
 
+  /// Record the execution of previously recorded secondary command buffers
+  /// into this (primary) command buffer.
+  [[nodiscard]] bool ExecuteSecondaryCommandBuffers(
+      uint32_t buffer_count,
+      const VkCommandBuffer* buffers) const;
+
  private:
   const VulkanProcTable& vk;
   const VulkanHandle<VkDevice>& device_;
   const VulkanHandle<VkCommandPool>& pool_;
   VulkanHandle<VkCommandBuffer> handle_;
+  VkCommandBufferLevel level_;
   bool valid_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(VulkanCommandBuffer);
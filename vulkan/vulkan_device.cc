@@ -4,6 +4,7 @@
 
 #include "vulkan_device.h"
 
+#include <cstring>
 #include <limits>
 #include <map>
 #include <vector>
@@ -58,7 +59,7 @@ VulkanDevice::VulkanDevice(VulkanProcTable& p_vk,
       .pQueuePriorities = priorities,
   };
 
-  const char* extensions[] = {
+  std::vector<const char*> extensions = {
 #if FML_OS_ANDROID
     VK_KHR_SWAPCHAIN_EXTENSION_NAME,
 #endif
@@ -72,6 +73,24 @@ VulkanDevice::VulkanDevice(VulkanProcTable& p_vk,
 #endif
   };
 
+  // Enable timeline semaphores when the device advertises them so the
+  // swapchain can overlap recording of the next frame with execution of the
+  // previous one (see VulkanSwapchain). Implementations that export the
+  // extension are required to support the feature.
+  VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timeline_semaphore_features = {
+      .sType =
+          VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
+      .pNext = nullptr,
+      .timelineSemaphore = VK_TRUE,
+  };
+  const void* create_info_next = nullptr;
+  bool timeline_semaphore_extension_enabled = false;
+  if (IsDeviceExtensionSupported(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME)) {
+    extensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    create_info_next = &timeline_semaphore_features;
+    timeline_semaphore_extension_enabled = true;
+  }
+
   auto enabled_layers =
       DeviceLayersToEnable(vk, physical_device_, enable_validation_layers);
 
@@ -83,14 +102,14 @@ VulkanDevice::VulkanDevice(VulkanProcTable& p_vk,
 
   const VkDeviceCreateInfo create_info = {
       .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-      .pNext = nullptr,
+      .pNext = create_info_next,
       .flags = 0,
       .queueCreateInfoCount = 1,
       .pQueueCreateInfos = &queue_create,
       .enabledLayerCount = static_cast<uint32_t>(enabled_layers.size()),
       .ppEnabledLayerNames = layers,
-      .enabledExtensionCount = sizeof(extensions) / sizeof(const char*),
-      .ppEnabledExtensionNames = extensions,
+      .enabledExtensionCount = static_cast<uint32_t>(extensions.size()),
+      .ppEnabledExtensionNames = extensions.data(),
       .pEnabledFeatures = nullptr,
   };
 
@@ -110,6 +129,10 @@ VulkanDevice::VulkanDevice(VulkanProcTable& p_vk,
     return;
   }
 
+  timeline_semaphores_supported_ = timeline_semaphore_extension_enabled &&
+                                   vk.WaitSemaphoresKHR &&
+                                   vk.GetSemaphoreCounterValueKHR;
+
   VkQueue queue = VK_NULL_HANDLE;
 
   vk.GetDeviceQueue(device_, graphics_queue_index_, 0, &queue);
@@ -285,6 +308,40 @@ bool VulkanDevice::GetPhysicalDeviceFeaturesSkia(uint32_t* sk_features) const {
   return true;
 }
 
+bool VulkanDevice::SupportsTimelineSemaphores() const {
+  return timeline_semaphores_supported_;
+}
+
+bool VulkanDevice::IsDeviceExtensionSupported(
+    const char* extension_name) const {
+  if (!physical_device_ || !vk.EnumerateDeviceExtensionProperties) {
+    return false;
+  }
+
+  uint32_t count = 0;
+  if (VK_CALL_LOG_ERROR(vk.EnumerateDeviceExtensionProperties(
+          physical_device_, nullptr, &count, nullptr)) != VK_SUCCESS) {
+    return false;
+  }
+
+  std::vector<VkExtensionProperties> properties;
+  properties.resize(count, {});
+
+  if (VK_CALL_LOG_ERROR(vk.EnumerateDeviceExtensionProperties(
+          physical_device_, nullptr, &count, properties.data())) !=
+      VK_SUCCESS) {
+    return false;
+  }
+
+  for (const VkExtensionProperties& property : properties) {
+    if (strcmp(property.extensionName, extension_name) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 std::vector<VkQueueFamilyProperties> VulkanDevice::GetQueueFamilyProperties()
     const {
   uint32_t count = 0;
@@ -371,21 +428,45 @@ bool VulkanDevice::QueueSubmit(
     const std::vector<VkSemaphore>& wait_semaphores,
     const std::vector<VkSemaphore>& signal_semaphores,
     const std::vector<VkCommandBuffer>& command_buffers,
-    const VulkanHandle<VkFence>& fence) const {
+    const VulkanHandle<VkFence>& fence,
+    VkSemaphore timeline_signal_semaphore,
+    uint64_t timeline_signal_value) const {
   if (wait_semaphores.size() != wait_dest_pipeline_stages.size()) {
     return false;
   }
 
+  std::vector<VkSemaphore> all_signal_semaphores = signal_semaphores;
+  // Signal values for binary semaphores are ignored but the array must match
+  // the signal semaphore array in size.
+  std::vector<uint64_t> signal_semaphore_values(signal_semaphores.size(), 0);
+  const void* submit_info_next = nullptr;
+  VkTimelineSemaphoreSubmitInfoKHR timeline_submit_info;
+  if (timeline_signal_semaphore != VK_NULL_HANDLE) {
+    all_signal_semaphores.push_back(timeline_signal_semaphore);
+    signal_semaphore_values.push_back(timeline_signal_value);
+    timeline_submit_info = {
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+        .pNext = nullptr,
+        .waitSemaphoreValueCount = 0,
+        .pWaitSemaphoreValues = nullptr,
+        .signalSemaphoreValueCount =
+            static_cast<uint32_t>(signal_semaphore_values.size()),
+        .pSignalSemaphoreValues = signal_semaphore_values.data(),
+    };
+    submit_info_next = &timeline_submit_info;
+  }
+
   const VkSubmitInfo submit_info = {
       .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-      .pNext = nullptr,
+      .pNext = submit_info_next,
       .waitSemaphoreCount = static_cast<uint32_t>(wait_semaphores.size()),
       .pWaitSemaphores = wait_semaphores.data(),
       .pWaitDstStageMask = wait_dest_pipeline_stages.data(),
       .commandBufferCount = static_cast<uint32_t>(command_buffers.size()),
       .pCommandBuffers = command_buffers.data(),
-      .signalSemaphoreCount = static_cast<uint32_t>(signal_semaphores.size()),
-      .pSignalSemaphores = signal_semaphores.data(),
+      .signalSemaphoreCount =
+          static_cast<uint32_t>(all_signal_semaphores.size()),
+      .pSignalSemaphores = all_signal_semaphores.data(),
   };
 
   if (VK_CALL_LOG_ERROR(vk.QueueSubmit(queue_, 1, &submit_info, fence)) !=
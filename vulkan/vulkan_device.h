@@ -66,12 +66,23 @@ class VulkanDevice {
   [[nodiscard]] bool ChoosePresentMode(const VulkanSurface& surface,
                                        VkPresentModeKHR* present_mode) const;
 
+  /// @brief  Whether VK_KHR_timeline_semaphore has been enabled on this
+  ///         device and its procs have been resolved.
+  ///
+  bool SupportsTimelineSemaphores() const;
+
+  /// @brief  Submit to the device queue. When |timeline_signal_semaphore| is
+  ///         not null, it is appended to the signal semaphores and signaled
+  ///         with |timeline_signal_value| once the submission completes.
+  ///
   [[nodiscard]] bool QueueSubmit(
       std::vector<VkPipelineStageFlags> wait_dest_pipeline_stages,
       const std::vector<VkSemaphore>& wait_semaphores,
       const std::vector<VkSemaphore>& signal_semaphores,
       const std::vector<VkCommandBuffer>& command_buffers,
-      const VulkanHandle<VkFence>& fence) const;
+      const VulkanHandle<VkFence>& fence,
+      VkSemaphore timeline_signal_semaphore = VK_NULL_HANDLE,
+      uint64_t timeline_signal_value = 0) const;
 
   [[nodiscard]] bool WaitIdle() const;
 
@@ -83,9 +94,11 @@ class VulkanDevice {
   VulkanHandle<VkCommandPool> command_pool_;
   uint32_t graphics_queue_index_;
   bool valid_;
+  bool timeline_semaphores_supported_ = false;
 
   bool InitializeCommandPool();
   std::vector<VkQueueFamilyProperties> GetQueueFamilyProperties() const;
+  bool IsDeviceExtensionSupported(const char* extension_name) const;
 
   FML_DISALLOW_COPY_AND_ASSIGN(VulkanDevice);
 };
@@ -87,6 +87,7 @@ bool VulkanProcTable::SetupInstanceProcAddresses(
   ACQUIRE_PROC(CreateDevice, handle);
   ACQUIRE_PROC(DestroyDevice, handle);
   ACQUIRE_PROC(DestroyInstance, handle);
+  ACQUIRE_PROC(EnumerateDeviceExtensionProperties, handle);
   ACQUIRE_PROC(EnumerateDeviceLayerProperties, handle);
   ACQUIRE_PROC(EnumeratePhysicalDevices, handle);
   ACQUIRE_PROC(GetDeviceProcAddr, handle);
@@ -122,6 +123,7 @@ bool VulkanProcTable::SetupDeviceProcAddresses(
   ACQUIRE_PROC(AllocateMemory, handle);
   ACQUIRE_PROC(BeginCommandBuffer, handle);
   ACQUIRE_PROC(BindImageMemory, handle);
+  ACQUIRE_PROC(CmdExecuteCommands, handle);
   ACQUIRE_PROC(CmdPipelineBarrier, handle);
   ACQUIRE_PROC(CreateCommandPool, handle);
   ACQUIRE_PROC(CreateFence, handle);
@@ -140,8 +142,18 @@ bool VulkanProcTable::SetupDeviceProcAddresses(
   ACQUIRE_PROC(QueueSubmit, handle);
   ACQUIRE_PROC(QueueWaitIdle, handle);
   ACQUIRE_PROC(ResetCommandBuffer, handle);
+  ACQUIRE_PROC(ResetCommandPool, handle);
   ACQUIRE_PROC(ResetFences, handle);
   ACQUIRE_PROC(WaitForFences, handle);
+
+  // The timeline semaphore procs are optional and only present when the
+  // VK_KHR_timeline_semaphore device extension has been enabled. Users check
+  // for their presence explicitly (see VulkanDevice).
+  [this, &handle]() -> bool {
+    ACQUIRE_PROC(GetSemaphoreCounterValueKHR, handle);
+    ACQUIRE_PROC(WaitSemaphoresKHR, handle);
+    return true;
+  }();
 #ifndef TEST_VULKAN_PROCS
 #if FML_OS_ANDROID
   ACQUIRE_PROC(AcquireNextImageKHR, handle);
@@ -77,6 +77,7 @@ class VulkanProcTable : public fml::RefCountedThreadSafe<VulkanProcTable> {
   DEFINE_PROC(AllocateMemory);
   DEFINE_PROC(BeginCommandBuffer);
   DEFINE_PROC(BindImageMemory);
+  DEFINE_PROC(CmdExecuteCommands);
   DEFINE_PROC(CmdPipelineBarrier);
   DEFINE_PROC(CreateCommandPool);
   DEFINE_PROC(CreateDebugReportCallbackEXT);
@@ -97,6 +98,7 @@ class VulkanProcTable : public fml::RefCountedThreadSafe<VulkanProcTable> {
   DEFINE_PROC(DestroySwapchainKHR);
   DEFINE_PROC(DeviceWaitIdle);
   DEFINE_PROC(EndCommandBuffer);
+  DEFINE_PROC(EnumerateDeviceExtensionProperties);
   DEFINE_PROC(EnumerateDeviceLayerProperties);
   DEFINE_PROC(EnumerateInstanceExtensionProperties);
   DEFINE_PROC(EnumerateInstanceLayerProperties);
@@ -108,11 +110,14 @@ class VulkanProcTable : public fml::RefCountedThreadSafe<VulkanProcTable> {
   DEFINE_PROC(GetImageMemoryRequirements);
   DEFINE_PROC(GetPhysicalDeviceFeatures);
   DEFINE_PROC(GetPhysicalDeviceQueueFamilyProperties);
+  DEFINE_PROC(GetSemaphoreCounterValueKHR);
   DEFINE_PROC(QueueSubmit);
   DEFINE_PROC(QueueWaitIdle);
   DEFINE_PROC(ResetCommandBuffer);
+  DEFINE_PROC(ResetCommandPool);
   DEFINE_PROC(ResetFences);
   DEFINE_PROC(WaitForFences);
+  DEFINE_PROC(WaitSemaphoresKHR);
 #ifndef TEST_VULKAN_PROCS
 #if FML_OS_ANDROID
   DEFINE_PROC(GetPhysicalDeviceSurfaceCapabilitiesKHR);
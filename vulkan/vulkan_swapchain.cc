@@ -4,6 +4,8 @@
 
 #include "vulkan_swapchain.h"
 
+#include <algorithm>
+
 #include "third_party/skia/include/gpu/GrBackendSurface.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
 #include "third_party/skia/include/gpu/vk/GrVkTypes.h"
@@ -41,7 +43,8 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
                                  const VulkanSurface& surface,
                                  GrDirectContext* skia_context,
                                  std::unique_ptr<VulkanSwapchain> old_swapchain,
-                                 uint32_t queue_family_index)
+                                 uint32_t queue_family_index,
+                                 size_t frames_in_flight)
     : vk(p_vk),
       device_(device),
       capabilities_(),
@@ -49,6 +52,7 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
       current_pipeline_stage_(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT),
       current_backbuffer_index_(0),
       current_image_index_(0),
+      frames_in_flight_(std::max<size_t>(1u, frames_in_flight)),
       valid_(false) {
   if (!device_.IsValid() || !surface.IsValid() || skia_context == nullptr) {
     FML_DLOG(INFO) << "Device or surface is invalid.";
@@ -117,12 +121,23 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
                                   VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
                                   VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 
+  // Request one image more than the minimum so FIFO presentation does not
+  // serialize acquisition against the image being scanned out, capped at the
+  // surface maximum (zero meaning no limit).
+  uint32_t desired_image_count =
+      std::max(capabilities_.minImageCount + 1,
+               static_cast<uint32_t>(frames_in_flight_));
+  if (capabilities_.maxImageCount > 0 &&
+      desired_image_count > capabilities_.maxImageCount) {
+    desired_image_count = capabilities_.maxImageCount;
+  }
+
   const VkSwapchainCreateInfoKHR create_info = {
       .sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
       .pNext = nullptr,
       .flags = 0,
       .surface = surface_handle,
-      .minImageCount = capabilities_.minImageCount,
+      .minImageCount = desired_image_count,
       .imageFormat = surface_format_.format,
       .imageColorSpace = surface_format_.colorSpace,
       .imageExtent = capabilities_.currentExtent,
@@ -160,6 +175,12 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
     return;
   }
 
+  // Prefer a timeline semaphore over the per-backbuffer fence pair so that
+  // backbuffer reuse waits on a single monotonically increasing counter. The
+  // fences remain as the fallback on devices without the extension.
+  use_timeline_semaphore_ =
+      device_.SupportsTimelineSemaphores() && CreateFrameTimelineSemaphore();
+
   valid_ = true;
 }
 
@@ -263,17 +284,21 @@ bool VulkanSwapchain::CreateSwapchainImages(GrDirectContext* skia_context,
 
   const SkISize surface_size = GetSize();
 
-  for (const VkImage& image : images) {
-    // Populate the backbuffer.
+  // The backbuffers hold the per-frame synchronization and command buffer
+  // state. Their count is the number of frames whose recording may be in
+  // flight at once and is independent of the swapchain image count.
+  for (size_t i = 0; i < frames_in_flight_; i++) {
     auto backbuffer = std::make_unique<VulkanBackbuffer>(
-        vk, device_.GetHandle(), device_.GetCommandPool());
+        vk, device_.GetHandle(), device_.GetGraphicsQueueIndex());
 
     if (!backbuffer->IsValid()) {
       return false;
     }
 
     backbuffers_.emplace_back(std::move(backbuffer));
+  }
 
+  for (const VkImage& image : images) {
     // Populate the image.
     auto vulkan_image = std::make_unique<VulkanImage>(image);
 
@@ -294,12 +319,72 @@ bool VulkanSwapchain::CreateSwapchainImages(GrDirectContext* skia_context,
     surfaces_.emplace_back(std::move(surface));
   }
 
-  FML_DCHECK(backbuffers_.size() == images_.size());
+  FML_DCHECK(backbuffers_.size() == frames_in_flight_);
   FML_DCHECK(images_.size() == surfaces_.size());
 
   return true;
 }
 
+bool VulkanSwapchain::CreateFrameTimelineSemaphore() {
+  const VkSemaphoreTypeCreateInfoKHR type_create_info = {
+      .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR,
+      .pNext = nullptr,
+      .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR,
+      .initialValue = 0,
+  };
+
+  const VkSemaphoreCreateInfo create_info = {
+      .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+      .pNext = &type_create_info,
+      .flags = 0,
+  };
+
+  VkSemaphore semaphore = VK_NULL_HANDLE;
+
+  if (VK_CALL_LOG_ERROR(vk.CreateSemaphore(device_.GetHandle(), &create_info,
+                                           nullptr, &semaphore)) !=
+      VK_SUCCESS) {
+    return false;
+  }
+
+  frame_timeline_semaphore_ =
+      VulkanHandle<VkSemaphore>{semaphore, [this](VkSemaphore semaphore) {
+                                  vk.DestroySemaphore(device_.GetHandle(),
+                                                      semaphore, nullptr);
+                                }};
+
+  return true;
+}
+
+bool VulkanSwapchain::WaitForBackbufferRetirement(
+    VulkanBackbuffer* backbuffer) {
+  if (!use_timeline_semaphore_) {
+    // Wait for use readiness and put the fences back in an unsignaled state
+    // for this frame's submissions.
+    return backbuffer->WaitFences() && backbuffer->ResetFences();
+  }
+
+  uint64_t pending_value = backbuffer->GetPendingTimelineValue();
+  if (pending_value == 0) {
+    // The backbuffer has never been submitted.
+    return true;
+  }
+
+  VkSemaphore semaphore = frame_timeline_semaphore_;
+  const VkSemaphoreWaitInfoKHR wait_info = {
+      .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR,
+      .pNext = nullptr,
+      .flags = 0,
+      .semaphoreCount = 1,
+      .pSemaphores = &semaphore,
+      .pValues = &pending_value,
+  };
+
+  return VK_CALL_LOG_ERROR(vk.WaitSemaphoresKHR(
+             device_.GetHandle(), &wait_info,
+             std::numeric_limits<uint64_t>::max())) == VK_SUCCESS;
+}
+
 VulkanBackbuffer* VulkanSwapchain::GetNextBackbuffer() {
   auto available_backbuffers = backbuffers_.size();
 
@@ -340,20 +425,20 @@ VulkanSwapchain::AcquireResult VulkanSwapchain::AcquireSurface() {
   }
 
   // ---------------------------------------------------------------------------
-  // Step 1:
-  // Wait for use readiness.
+  // Step 1 & 2:
+  // Wait for use readiness. With timeline semaphores this is a single wait on
+  // the value signaled when the backbuffer's frame retired; with the fence
+  // fallback the fences are also put back in an unsignaled state.
   // ---------------------------------------------------------------------------
-  if (!backbuffer->WaitFences()) {
-    FML_DLOG(INFO) << "Failed waiting on fences.";
+  if (!WaitForBackbufferRetirement(backbuffer)) {
+    FML_DLOG(INFO) << "Failed waiting for backbuffer retirement.";
     return error;
   }
 
-  // ---------------------------------------------------------------------------
-  // Step 2:
-  // Put fences in an unsignaled state.
-  // ---------------------------------------------------------------------------
-  if (!backbuffer->ResetFences()) {
-    FML_DLOG(INFO) << "Could not reset fences.";
+  // The backbuffer's submissions have retired, so its command buffers can be
+  // recycled in bulk for this frame's recording.
+  if (!backbuffer->ResetCommandBuffers()) {
+    FML_DLOG(INFO) << "Could not reset the backbuffer command buffers.";
     return error;
   }
 
@@ -438,19 +523,36 @@ VulkanSwapchain::AcquireResult VulkanSwapchain::AcquireSurface() {
 
   // ---------------------------------------------------------------------------
   // Step 7:
-  // Submit the command buffer to the device queue.
+  // Submit the command buffer to the device queue. With timeline semaphores,
+  // signal the frame timeline instead of the usage fence; the values must be
+  // signaled in increasing order, so waiting for this frame's render value
+  // implies the usage submission has also retired.
   // ---------------------------------------------------------------------------
   std::vector<VkSemaphore> wait_semaphores = {backbuffer->GetUsageSemaphore()};
   std::vector<VkSemaphore> signal_semaphores = {};
   std::vector<VkCommandBuffer> command_buffers = {
       backbuffer->GetUsageCommandBuffer().Handle()};
 
+  uint64_t usage_timeline_value = 0;
+  if (use_timeline_semaphore_) {
+    usage_timeline_value = next_timeline_value_;
+    acquired_render_timeline_value_ = next_timeline_value_ + 1;
+    next_timeline_value_ += 2;
+  }
+
+  const VulkanHandle<VkFence> null_fence;
+
   if (!device_.QueueSubmit(
           {destination_pipeline_stage},  // wait_dest_pipeline_stages
           wait_semaphores,               // wait_semaphores
           signal_semaphores,             // signal_semaphores
           command_buffers,               // command_buffers
-          backbuffer->GetUsageFence()    // fence
+          use_timeline_semaphore_ ? null_fence
+                                  : backbuffer->GetUsageFence(),  // fence
+          use_timeline_semaphore_
+              ? static_cast<VkSemaphore>(frame_timeline_semaphore_)
+              : VK_NULL_HANDLE,  // timeline_signal_semaphore
+          usage_timeline_value   // timeline_signal_value
           )) {
     FML_DLOG(INFO) << "Could not submit to the device queue.";
     return error;
@@ -546,17 +648,30 @@ bool VulkanSwapchain::Submit() {
   std::vector<VkCommandBuffer> command_buffers = {
       backbuffer->GetRenderCommandBuffer().Handle()};
 
+  const VulkanHandle<VkFence> null_fence;
+
   if (!device_.QueueSubmit(
           {/* Empty. No wait semaphores. */},  // wait_dest_pipeline_stages
           wait_semaphores,                     // wait_semaphores
           queue_signal_semaphores,             // signal_semaphores
           command_buffers,                     // command_buffers
-          backbuffer->GetRenderFence()         // fence
+          use_timeline_semaphore_ ? null_fence
+                                  : backbuffer->GetRenderFence(),  // fence
+          use_timeline_semaphore_
+              ? static_cast<VkSemaphore>(frame_timeline_semaphore_)
+              : VK_NULL_HANDLE,              // timeline_signal_semaphore
+          acquired_render_timeline_value_    // timeline_signal_value
           )) {
     FML_DLOG(INFO) << "Could not submit to the device queue.";
     return false;
   }
 
+  if (use_timeline_semaphore_) {
+    // Reusing this backbuffer must wait until the timeline reaches the value
+    // signaled by the render submission above.
+    backbuffer->SetPendingTimelineValue(acquired_render_timeline_value_);
+  }
+
   // ---------------------------------------------------------------------------
   // Step 5:
   // Submit the present operation and wait on the render semaphore.
@@ -25,12 +25,17 @@ class VulkanImage;
 
 class VulkanSwapchain {
  public:
+  /// The default number of frames whose recording may overlap with execution
+  /// of earlier frames before the raster thread blocks.
+  static constexpr size_t kDefaultFramesInFlight = 3;
+
   VulkanSwapchain(const VulkanProcTable& vk,
                   const VulkanDevice& device,
                   const VulkanSurface& surface,
                   GrDirectContext* skia_context,
                   std::unique_ptr<VulkanSwapchain> old_swapchain,
-                  uint32_t queue_family_index);
+                  uint32_t queue_family_index,
+                  size_t frames_in_flight = kDefaultFramesInFlight);
 
   ~VulkanSwapchain();
 
@@ -73,10 +78,22 @@ class VulkanSwapchain {
   VkPipelineStageFlagBits current_pipeline_stage_;
   size_t current_backbuffer_index_;
   size_t current_image_index_;
+  size_t frames_in_flight_;
+  // Timeline semaphore signaled with monotonically increasing values as
+  // frames retire; used instead of the per-backbuffer fences when
+  // VK_KHR_timeline_semaphore is available.
+  VulkanHandle<VkSemaphore> frame_timeline_semaphore_;
+  uint64_t next_timeline_value_ = 1;
+  uint64_t acquired_render_timeline_value_ = 0;
+  bool use_timeline_semaphore_ = false;
   bool valid_;
 
   std::vector<VkImage> GetImages() const;
 
+  bool CreateFrameTimelineSemaphore();
+
+  bool WaitForBackbufferRetirement(VulkanBackbuffer* backbuffer);
+
   bool CreateSwapchainImages(GrDirectContext* skia_context,
                              SkColorType color_type,
                              sk_sp<SkColorSpace> color_space,